@@ -0,0 +1,192 @@
+#include "benchmark_header.h"
+
+/**
+ * Canonicalization for the deduplication of the URLs of a crawler: decoding
+ * the percent-encoded unreserved characters, uppercasing the other
+ * percent-encodings, removing the empty queries and fragments, and sorting
+ * the query. The baseline applies the steps one after the other, each on a
+ * copy of the href, and parses the result again, as pipelines without
+ * in-place access to the URL do.
+ */
+std::string url_examples_default[] = {
+    "https://www.google.com/"
+    "webhp?hl=en&amp;ictx=2&amp;sa=X&amp;ved=0ahUKEwil_"
+    "oSxzJj8AhVtEFkFHTHnCGQQPQgI",
+    "https://support.google.com/websearch/"
+    "?p=ws_results_help&amp;hl=en-CA&amp;fg=1",
+    "https://en.wikipedia.org/wiki/%7euser/Dog#",
+    "https://www.tiktok.com/@aguyandagolden/video/7133277734310038830?",
+    "https://business.twitter.com/en/help/troubleshooting/"
+    "how-twitter-ads-work.html?utm_source=twc&ref=web-twc-ao-gbl-adsinfo&utm_"
+    "medium=web&utm_campaign=ao&utm_content=adsinfo",
+    "https://images-na.ssl-images-amazon.com/images/I/"
+    "41Gc3C8UysL.css?AUIClients/AmazonGatewayAuiAssets",
+    "https://www.reddit.com/?after=t3_zvz1ze",
+    "https://www.reddit.com/login/?dest=https%3a%2f%2fwww.reddit.com%2f",
+    "http://example.com/%41%42%43/index.html#section",
+    "http://192.168.1.1",             // ipv4
+    "http://[2606:4700:4700::1111]",  // ipv6
+};
+
+std::vector<std::string> url_examples;
+double url_examples_bytes{};
+
+#ifdef ADA_URL_FILE
+const char* default_file = ADA_URL_FILE;
+#else
+const char* default_file = nullptr;
+#endif
+
+size_t init_data(const char* input = default_file) {
+  std::vector<std::string> inputs;
+  if (input == nullptr || !file_exists(input)) {
+    if (input != nullptr) {
+      std::cout << "File not found !" << input << std::endl;
+    }
+    for (const std::string& s : url_examples_default) {
+      inputs.emplace_back(s);
+    }
+  } else {
+    std::cout << "Loading " << input << std::endl;
+    inputs = split_string(read_file(input));
+  }
+  size_t bytes{0};
+  for (std::string& url_string : inputs) {
+    if (!ada::parse<ada::url_aggregator>(url_string)) {
+      continue;
+    }
+    bytes += url_string.size();
+    url_examples.push_back(std::move(url_string));
+  }
+  url_examples_bytes = double(bytes);
+  return url_examples.size();
+}
+
+std::vector<ada::url_aggregator> parse_examples() {
+  std::vector<ada::url_aggregator> urls;
+  urls.reserve(url_examples.size());
+  for (const std::string& url_string : url_examples) {
+    urls.push_back(*ada::parse<ada::url_aggregator>(url_string));
+  }
+  return urls;
+}
+
+/** The first step of the baseline: a copy with the unreserved decoded. */
+std::string decode_unreserved(std::string_view href) {
+  std::string result;
+  result.reserve(href.size());
+  for (size_t i = 0; i < href.size(); i++) {
+    if (href[i] == '%' && i + 2 < href.size() &&
+        std::isxdigit(uint8_t(href[i + 1])) &&
+        std::isxdigit(uint8_t(href[i + 2]))) {
+      char c =
+          char(std::stoi(std::string(href.substr(i + 1, 2)), nullptr, 16));
+      if (std::isalnum(uint8_t(c)) || c == '-' || c == '.' || c == '_' ||
+          c == '~') {
+        result += c;
+        i += 2;
+        continue;
+      }
+    }
+    result += href[i];
+  }
+  return result;
+}
+
+/** The second step of the baseline: a copy with uppercase encodings. */
+std::string uppercase_percent_encodings(std::string_view href) {
+  std::string result(href);
+  for (size_t i = 0; i + 2 < result.size(); i++) {
+    if (result[i] == '%') {
+      result[i + 1] = char(std::toupper(uint8_t(result[i + 1])));
+      result[i + 2] = char(std::toupper(uint8_t(result[i + 2])));
+    }
+  }
+  return result;
+}
+
+void canonicalize_in_steps(ada::url_aggregator& url, bool sort_query) {
+  std::string href = decode_unreserved(url.get_href());
+  href = uppercase_percent_encodings(href);
+  auto result = ada::parse<ada::url_aggregator>(href);
+  if (!result) {
+    return;
+  }
+  if (result->get_search().empty() && result->has_search()) {
+    result->set_search("");
+  }
+  if (result->get_hash().empty() && result->has_hash()) {
+    result->set_hash("");
+  }
+  if (sort_query) {
+    result->sort_search_params();
+  }
+  url = std::move(*result);
+}
+
+/**
+ * Runs canonicalize(url) on a copy of each of the pre-parsed URLs: the copy
+ * is part of the measure.
+ */
+template <class Canonicalize>
+static void run_canonicalize(benchmark::State& state,
+                             Canonicalize canonicalize) {
+  const std::vector<ada::url_aggregator> urls = parse_examples();
+  // volatile to prevent optimizations.
+  volatile size_t href_size = 0;
+  auto run = [&]() {
+    for (const ada::url_aggregator& parsed : urls) {
+      ada::url_aggregator url = parsed;
+      canonicalize(url);
+      href_size += url.get_href().size();
+    }
+  };
+  for (auto _ : state) {
+    run();
+  }
+  state.counters["allocs/url"] =
+      double(count_allocations(run)) / double(urls.size());
+  state.counters["speed"] = benchmark::Counter(
+      url_examples_bytes, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["time/url"] =
+      benchmark::Counter(double(urls.size()),
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+}
+
+static void BasicBench_Copy(benchmark::State& state) {
+  run_canonicalize(state, [](ada::url_aggregator&) {});
+}
+BENCHMARK(BasicBench_Copy);
+
+static void BasicBench_Canonicalize(benchmark::State& state) {
+  ada::canonicalize_options options;
+  options.sort_query = state.range(0) != 0;
+  run_canonicalize(state, [&options](ada::url_aggregator& url) {
+    ada::canonicalize(url, options);
+  });
+}
+BENCHMARK(BasicBench_Canonicalize)->ArgName("sort_query")->Arg(0)->Arg(1);
+
+static void BasicBench_CanonicalizeInSteps(benchmark::State& state) {
+  const bool sort_query = state.range(0) != 0;
+  run_canonicalize(state, [sort_query](ada::url_aggregator& url) {
+    canonicalize_in_steps(url, sort_query);
+  });
+}
+BENCHMARK(BasicBench_CanonicalizeInSteps)
+    ->ArgName("sort_query")
+    ->Arg(0)
+    ->Arg(1);
+
+int main(int argc, char** argv) {
+  if (argc > 1 && file_exists(argv[1])) {
+    init_data(argv[1]);
+  } else {
+    init_data();
+  }
+  benchmark::AddCustomContext("ada spec", "Ada follows whatwg/url");
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
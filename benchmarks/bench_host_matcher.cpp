@@ -0,0 +1,122 @@
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark_header.h"
+
+/**
+ * Block list lookups: N random domains, each matching itself and its
+ * subdomains, and a batch of hosts, half of them subdomains of listed
+ * domains. The baseline probes a hash set of strings once per suffix of the
+ * host, as in "www.example.com", "example.com", "com".
+ */
+struct host_workload {
+  std::vector<std::string> domains;
+  std::vector<std::string> hosts;
+};
+
+std::string random_label(std::mt19937_64& rng) {
+  static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  std::string label(4 + rng() % 12, 'a');
+  for (char& c : label) {
+    c = alphabet[rng() % (sizeof(alphabet) - 1)];
+  }
+  return label;
+}
+
+host_workload make_workload(size_t domain_count) {
+  static const char* tlds[] = {"com", "net", "org", "co.uk", "de", "io"};
+  std::mt19937_64 rng(domain_count);
+  host_workload workload;
+  for (size_t i = 0; i < domain_count; i++) {
+    workload.domains.push_back(random_label(rng) + "." +
+                               tlds[rng() % std::size(tlds)]);
+  }
+  for (size_t i = 0; i < 4096; i++) {
+    if (i % 2 == 0) {
+      workload.hosts.push_back(
+          "www." + workload.domains[rng() % workload.domains.size()]);
+    } else {
+      workload.hosts.push_back("www." + random_label(rng) + "." +
+                               tlds[rng() % std::size(tlds)]);
+    }
+  }
+  return workload;
+}
+
+static void set_counters(benchmark::State& state, size_t host_count,
+                         size_t memory) {
+  state.counters["time/host"] = benchmark::Counter(
+      double(host_count), benchmark::Counter::kIsIterationInvariantRate |
+                              benchmark::Counter::kInvert);
+  state.counters["bytes/domain"] = double(memory) / double(state.range(0));
+}
+
+static void BasicBench_HostMatcher_Match(benchmark::State& state) {
+  const host_workload workload = make_workload(size_t(state.range(0)));
+  ada::host_matcher matcher;
+  for (const std::string& domain : workload.domains) {
+    matcher.add(domain);
+  }
+  size_t matches = 0;
+  for (auto _ : state) {
+    for (const std::string& host : workload.hosts) {
+      matches += matcher.match(host);
+    }
+  }
+  benchmark::DoNotOptimize(matches);
+  set_counters(state, workload.hosts.size(), matcher.memory_usage());
+}
+
+static void BasicBench_HostMatcher_MatchMany(benchmark::State& state) {
+  const host_workload workload = make_workload(size_t(state.range(0)));
+  ada::host_matcher matcher;
+  for (const std::string& domain : workload.domains) {
+    matcher.add(domain);
+  }
+  std::vector<std::string_view> hosts(workload.hosts.begin(),
+                                      workload.hosts.end());
+  std::unique_ptr<bool[]> results(new bool[hosts.size()]);
+  size_t matches = 0;
+  for (auto _ : state) {
+    matcher.match_many(hosts.data(), hosts.size(), results.get());
+    matches += results[0];
+  }
+  benchmark::DoNotOptimize(matches);
+  set_counters(state, workload.hosts.size(), matcher.memory_usage());
+}
+
+static void BasicBench_HashSet_PerSuffix(benchmark::State& state) {
+  const host_workload workload = make_workload(size_t(state.range(0)));
+  std::unordered_set<std::string_view> set(workload.domains.begin(),
+                                           workload.domains.end());
+  size_t matches = 0;
+  for (auto _ : state) {
+    for (const std::string& host : workload.hosts) {
+      std::string_view suffix = host;
+      while (true) {
+        if (set.count(suffix) != 0) {
+          matches++;
+          break;
+        }
+        size_t dot = suffix.find('.');
+        if (dot == std::string_view::npos) {
+          break;
+        }
+        suffix.remove_prefix(dot + 1);
+      }
+    }
+  }
+  benchmark::DoNotOptimize(matches);
+  set_counters(state, workload.hosts.size(), 0);
+}
+
+#define ADA_HOST_MATCHER_BENCHMARK(name) \
+  BENCHMARK(name)->RangeMultiplier(8)->Range(1 << 12, 1 << 21)
+
+ADA_HOST_MATCHER_BENCHMARK(BasicBench_HostMatcher_Match);
+ADA_HOST_MATCHER_BENCHMARK(BasicBench_HostMatcher_MatchMany);
+ADA_HOST_MATCHER_BENCHMARK(BasicBench_HashSet_PerSuffix);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+#include <string>
+
+#include "benchmark_header.h"
+
+/**
+ * Adversarial paths: many single-dot and double-dot segments, written as
+ * '.', '..', '%2e', '%2E%2e' and separated by '/' or '\', after a long first
+ * segment or a Windows drive letter. The benchmarks run from 1k to 100k
+ * segments and Google Benchmark fits the complexity: it must remain O(N).
+ */
+enum class path_kind {
+  MixedDoubleDots,   // "/a/..", "/b/%2e%2e", "/c/%2E."
+  Backslashes,       // "\a\..\", "\b\.\"
+  LongFirstSegment,  // a long first segment, then "/b/%2e%2e" segments
+  FileDriveLetter,   // "file:///C:" then "/b/.." and "/.." segments
+  DeepThenUp,        // N segments "a/" followed by N segments "../"
+};
+
+std::string make_path(path_kind kind, size_t segments) {
+  std::string url;
+  switch (kind) {
+    case path_kind::MixedDoubleDots:
+      url = "https://example.com";
+      for (size_t i = 0; i < segments; i++) {
+        url += (i % 3 == 0) ? "/a/.." : (i % 3 == 1 ? "/b/%2e%2e" : "/c/%2E.");
+      }
+      break;
+    case path_kind::Backslashes:
+      url = "https://example.com\\";
+      for (size_t i = 0; i < segments; i++) {
+        url += (i % 2 == 0) ? "a\\..\\" : "b\\.\\";
+      }
+      break;
+    case path_kind::LongFirstSegment:
+      url = "https://example.com/" + std::string(4 * segments, 'a');
+      for (size_t i = 0; i < segments; i++) {
+        url += "/b/%2e%2e";
+      }
+      break;
+    case path_kind::FileDriveLetter:
+      url = "file:///C:";
+      for (size_t i = 0; i < segments; i++) {
+        url += (i % 2 == 0) ? "/b/.." : "/..";
+      }
+      break;
+    case path_kind::DeepThenUp:
+      url = "https://example.com/";
+      for (size_t i = 0; i < segments / 2; i++) {
+        url += "a/";
+      }
+      for (size_t i = 0; i < segments / 2; i++) {
+        url += "../";
+      }
+      break;
+  }
+  return url;
+}
+
+template <class result_type, path_kind kind>
+static void BasicBench_Path(benchmark::State& state) {
+  size_t segments = size_t(state.range(0));
+  const std::string url = make_path(kind, segments);
+  size_t href_size = 0;
+  for (auto _ : state) {
+    auto result = ada::parse<result_type>(url);
+    href_size += result ? result->get_href().size() : 0;
+  }
+  benchmark::DoNotOptimize(href_size);
+  state.SetComplexityN(state.range(0));
+  state.counters["time/byte"] = benchmark::Counter(
+      double(url.size()), benchmark::Counter::kIsIterationInvariantRate |
+                              benchmark::Counter::kInvert);
+  state.counters["time/segment"] = benchmark::Counter(
+      double(segments), benchmark::Counter::kIsIterationInvariantRate |
+                            benchmark::Counter::kInvert);
+}
+
+#define ADA_PATH_BENCHMARK(result_type, kind)                         \
+  BENCHMARK_TEMPLATE(BasicBench_Path, result_type, path_kind::kind) \
+      ->RangeMultiplier(10)                                         \
+      ->Range(1000, 100000)                                         \
+      ->Complexity(benchmark::oN)
+
+ADA_PATH_BENCHMARK(ada::url_aggregator, MixedDoubleDots);
+ADA_PATH_BENCHMARK(ada::url, MixedDoubleDots);
+ADA_PATH_BENCHMARK(ada::url_aggregator, Backslashes);
+ADA_PATH_BENCHMARK(ada::url, Backslashes);
+ADA_PATH_BENCHMARK(ada::url_aggregator, LongFirstSegment);
+ADA_PATH_BENCHMARK(ada::url, LongFirstSegment);
+ADA_PATH_BENCHMARK(ada::url_aggregator, FileDriveLetter);
+ADA_PATH_BENCHMARK(ada::url, FileDriveLetter);
+ADA_PATH_BENCHMARK(ada::url_aggregator, DeepThenUp);
+ADA_PATH_BENCHMARK(ada::url, DeepThenUp);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,173 @@
+#include "benchmark_header.h"
+
+/**
+ * Registrable domains (eTLD+1) of the hosts of the dataset, e.g., to compute
+ * cookie or site-isolation keys. The URLs are parsed once, ahead of time.
+ * BasicBench_HostnameCopy measures the copy of the hostnames alone: the cost
+ * paid before running a separate public suffix library.
+ */
+std::string url_examples_default[] = {
+    "https://www.google.com/"
+    "webhp?hl=en&amp;ictx=2&amp;sa=X&amp;ved=0ahUKEwil_"
+    "oSxzJj8AhVtEFkFHTHnCGQQPQgI",
+    "https://support.google.com/websearch/"
+    "?p=ws_results_help&amp;hl=en-CA&amp;fg=1",
+    "https://en.wikipedia.org/wiki/Dog#Roles_with_humans",
+    "https://www.tiktok.com/@aguyandagolden/video/7133277734310038830",
+    "https://business.twitter.com/en/help/troubleshooting/"
+    "how-twitter-ads-work.html?ref=web-twc-ao-gbl-adsinfo&utm_source=twc&utm_"
+    "medium=web&utm_campaign=ao&utm_content=adsinfo",
+    "https://images-na.ssl-images-amazon.com/images/I/"
+    "41Gc3C8UysL.css?AUIClients/AmazonGatewayAuiAssets",
+    "https://www.reddit.com/?after=t3_zvz1ze",
+    "https://www.bbc.co.uk/news/technology",
+    "https://user.github.io/project/",
+    "https://www.city.kobe.jp/a/b",
+    "https://shop.example.xn--fiqs8s/",
+    "http://192.168.1.1",             // ipv4
+    "http://[2606:4700:4700::1111]",  // ipv6
+};
+
+std::vector<std::string> url_examples;
+
+double url_examples_bytes{};
+
+#ifdef ADA_URL_FILE
+const char* default_file = ADA_URL_FILE;
+#else
+const char* default_file = nullptr;
+#endif
+
+size_t init_data(const char* input = default_file) {
+  std::vector<std::string> inputs;
+  if (input == nullptr || !file_exists(input)) {
+    if (input != nullptr) {
+      std::cout << "File not found !" << input << std::endl;
+    }
+    for (const std::string& s : url_examples_default) {
+      inputs.emplace_back(s);
+    }
+  } else {
+    std::cout << "Loading " << input << std::endl;
+    inputs = split_string(read_file(input));
+  }
+  size_t bytes{0};
+  for (std::string& url_string : inputs) {
+    if (!ada::parse<ada::url_aggregator>(url_string)) {
+      continue;
+    }
+    bytes += url_string.size();
+    url_examples.push_back(std::move(url_string));
+  }
+  url_examples_bytes = double(bytes);
+  return url_examples.size();
+}
+
+template <class result_type>
+std::vector<result_type> parse_examples() {
+  std::vector<result_type> urls;
+  urls.reserve(url_examples.size());
+  for (const std::string& url_string : url_examples) {
+    urls.push_back(*ada::parse<result_type>(url_string));
+  }
+  return urls;
+}
+
+/**
+ * Runs lookup(url) on each of the pre-parsed URLs.
+ */
+template <class result_type, class Lookup>
+static void run_lookup(benchmark::State& state, Lookup lookup) {
+  const std::vector<result_type> urls = parse_examples<result_type>();
+  // volatile to prevent optimizations.
+  volatile size_t domain_size = 0;
+  auto run = [&]() {
+    for (const result_type& url : urls) {
+      domain_size += lookup(url);
+    }
+  };
+
+  for (auto _ : state) {
+    run();
+  }
+  if (collector.has_events()) {
+    event_aggregate aggregate{};
+    for (size_t i = 0; i < N; i++) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      collector.start();
+      run();
+      std::atomic_thread_fence(std::memory_order_release);
+      event_count allocate_count = collector.end();
+      aggregate << allocate_count;
+    }
+    state.counters["cycles/url"] =
+        aggregate.best.cycles() / std::size(url_examples);
+    state.counters["instructions/url"] =
+        aggregate.best.instructions() / std::size(url_examples);
+    state.counters["instructions/cycle"] =
+        aggregate.best.instructions() / aggregate.best.cycles();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
+    state.counters["ns/url"] =
+        aggregate.best.elapsed_ns() / std::size(url_examples);
+  }
+  state.counters["allocs/url"] =
+      double(count_allocations(run)) / std::size(url_examples);
+  state.counters["time/url"] =
+      benchmark::Counter(double(std::size(url_examples)),
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+  state.counters["url/s"] =
+      benchmark::Counter(double(std::size(url_examples)),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <class result_type>
+static void BasicBench_RegistrableDomain(benchmark::State& state) {
+  run_lookup<result_type>(state, [](const result_type& url) {
+    return ada::public_suffix::get_registrable_domain(url).size();
+  });
+}
+BENCHMARK(BasicBench_RegistrableDomain<ada::url>);
+BENCHMARK(BasicBench_RegistrableDomain<ada::url_aggregator>);
+
+template <class result_type>
+static void BasicBench_PublicSuffix(benchmark::State& state) {
+  run_lookup<result_type>(state, [](const result_type& url) {
+    return ada::public_suffix::get_public_suffix(url).size();
+  });
+}
+BENCHMARK(BasicBench_PublicSuffix<ada::url>);
+BENCHMARK(BasicBench_PublicSuffix<ada::url_aggregator>);
+
+static void BasicBench_HostnameCopy(benchmark::State& state) {
+  run_lookup<ada::url_aggregator>(state, [](const ada::url_aggregator& url) {
+    return std::string(url.get_hostname()).size();
+  });
+}
+BENCHMARK(BasicBench_HostnameCopy);
+
+int main(int argc, char** argv) {
+  if (argc > 1 && file_exists(argv[1])) {
+    init_data(argv[1]);
+  } else {
+    init_data();
+  }
+#if (__APPLE__ && __aarch64__) || defined(__linux__)
+  if (!collector.has_events()) {
+    benchmark::AddCustomContext("performance counters",
+                                "No privileged access (sudo may help).");
+  }
+#else
+  if (!collector.has_events()) {
+    benchmark::AddCustomContext("performance counters", "Unsupported system.");
+  }
+#endif
+  benchmark::AddCustomContext("input bytes",
+                              std::to_string(size_t(url_examples_bytes)));
+  benchmark::AddCustomContext("number of URLs",
+                              std::to_string(std::size(url_examples)));
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
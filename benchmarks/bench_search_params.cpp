@@ -289,10 +289,23 @@ static void BasicBench_AdaURL(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
   }
+  state.counters["allocs/url"] =
+      double(count_allocations([&]() {
+        for (std::string& url_string : url_examples) {
+          ada::result<result_type> url = ada::parse<result_type>(url_string);
+          if (url) {
+            auto params = ada::url_search_params{url->get_search()};
+            param_count += params.size();
+          }
+        }
+      })) /
+      std::size(url_examples);
   (void)param_count;
   state.counters["time/byte"] = benchmark::Counter(
       url_examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -0,0 +1,225 @@
+#include "benchmark_header.h"
+
+/**
+ * Mutation workloads, such as the ones of a reverse proxy: each benchmark
+ * applies one setter to every URL of the dataset. The URLs are parsed once,
+ * ahead of time, and every run starts from a copy of the parsed URL. The
+ * BasicBench_Copy benchmark measures the copy alone.
+ */
+std::string url_examples_default[] = {
+    "https://www.google.com/"
+    "webhp?hl=en&amp;ictx=2&amp;sa=X&amp;ved=0ahUKEwil_"
+    "oSxzJj8AhVtEFkFHTHnCGQQPQgI",
+    "https://support.google.com/websearch/"
+    "?p=ws_results_help&amp;hl=en-CA&amp;fg=1",
+    "https://en.wikipedia.org/wiki/Dog#Roles_with_humans",
+    "https://www.tiktok.com/@aguyandagolden/video/7133277734310038830",
+    "https://business.twitter.com/en/help/troubleshooting/"
+    "how-twitter-ads-work.html?ref=web-twc-ao-gbl-adsinfo&utm_source=twc&utm_"
+    "medium=web&utm_campaign=ao&utm_content=adsinfo",
+    "https://images-na.ssl-images-amazon.com/images/I/"
+    "41Gc3C8UysL.css?AUIClients/AmazonGatewayAuiAssets",
+    "https://www.reddit.com/?after=t3_zvz1ze",
+    "https://www.reddit.com/login/?dest=https%3A%2F%2Fwww.reddit.com%2F",
+    "http://example.com/index.html#section",
+    "http://192.168.1.1",             // ipv4
+    "http://[2606:4700:4700::1111]",  // ipv6
+};
+
+std::vector<std::string> url_examples;
+// The inputs of the path prefix and query append workloads, computed once.
+std::vector<std::string> prefixed_pathnames;
+std::vector<std::string> appended_searches;
+
+double url_examples_bytes{};
+
+#ifdef ADA_URL_FILE
+const char* default_file = ADA_URL_FILE;
+#else
+const char* default_file = nullptr;
+#endif
+
+size_t init_data(const char* input = default_file) {
+  std::vector<std::string> inputs;
+  if (input == nullptr || !file_exists(input)) {
+    if (input != nullptr) {
+      std::cout << "File not found !" << input << std::endl;
+    }
+    for (const std::string& s : url_examples_default) {
+      inputs.emplace_back(s);
+    }
+  } else {
+    std::cout << "Loading " << input << std::endl;
+    inputs = split_string(read_file(input));
+  }
+  // We only keep the valid URLs: the setters require a URL.
+  size_t bytes{0};
+  for (std::string& url_string : inputs) {
+    auto url = ada::parse<ada::url_aggregator>(url_string);
+    if (!url) {
+      continue;
+    }
+    prefixed_pathnames.push_back(
+        ada::helpers::concat("/api/v2", url->get_pathname()));
+    std::string search(url->get_search());
+    search += search.empty() ? "?utm_source=proxy" : "&utm_source=proxy";
+    appended_searches.push_back(std::move(search));
+    bytes += url_string.size();
+    url_examples.push_back(std::move(url_string));
+  }
+  url_examples_bytes = double(bytes);
+  return url_examples.size();
+}
+
+template <class result_type>
+std::vector<result_type> parse_examples() {
+  std::vector<result_type> urls;
+  urls.reserve(url_examples.size());
+  for (const std::string& url_string : url_examples) {
+    urls.push_back(*ada::parse<result_type>(url_string));
+  }
+  return urls;
+}
+
+/**
+ * Runs mutate(url, i) on a copy of each of the pre-parsed URLs.
+ */
+template <class result_type, class Mutation>
+static void run_mutation(benchmark::State& state, Mutation mutate) {
+  const std::vector<result_type> urls = parse_examples<result_type>();
+  // volatile to prevent optimizations.
+  volatile size_t href_size = 0;
+  auto run = [&]() {
+    for (size_t i = 0; i < urls.size(); i++) {
+      result_type url = urls[i];
+      mutate(url, i);
+      href_size += url.get_href().size();
+    }
+  };
+
+  for (auto _ : state) {
+    run();
+  }
+  if (collector.has_events()) {
+    event_aggregate aggregate{};
+    for (size_t i = 0; i < N; i++) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      collector.start();
+      run();
+      std::atomic_thread_fence(std::memory_order_release);
+      event_count allocate_count = collector.end();
+      aggregate << allocate_count;
+    }
+    state.counters["cycles/url"] =
+        aggregate.best.cycles() / std::size(url_examples);
+    state.counters["instructions/url"] =
+        aggregate.best.instructions() / std::size(url_examples);
+    state.counters["instructions/cycle"] =
+        aggregate.best.instructions() / aggregate.best.cycles();
+    state.counters["instructions/byte"] =
+        aggregate.best.instructions() / url_examples_bytes;
+    state.counters["instructions/ns"] =
+        aggregate.best.instructions() / aggregate.best.elapsed_ns();
+    state.counters["GHz"] =
+        aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
+    state.counters["ns/url"] =
+        aggregate.best.elapsed_ns() / std::size(url_examples);
+    state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
+  }
+  // The copy of the URL is part of the count.
+  state.counters["allocs/url"] =
+      double(count_allocations(run)) / std::size(url_examples);
+  state.counters["time/url"] =
+      benchmark::Counter(double(std::size(url_examples)),
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+  state.counters["url/s"] =
+      benchmark::Counter(double(std::size(url_examples)),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <class result_type>
+static void BasicBench_Copy(benchmark::State& state) {
+  run_mutation<result_type>(state, [](result_type&, size_t) {});
+}
+BENCHMARK(BasicBench_Copy<ada::url>);
+BENCHMARK(BasicBench_Copy<ada::url_aggregator>);
+
+template <class result_type>
+static void BasicBench_HostRewrite(benchmark::State& state) {
+  run_mutation<result_type>(state, [](result_type& url, size_t) {
+    url.set_host("backend.internal:8080");
+  });
+}
+BENCHMARK(BasicBench_HostRewrite<ada::url>);
+BENCHMARK(BasicBench_HostRewrite<ada::url_aggregator>);
+
+template <class result_type>
+static void BasicBench_PathPrefix(benchmark::State& state) {
+  run_mutation<result_type>(state, [](result_type& url, size_t i) {
+    url.set_pathname(prefixed_pathnames[i]);
+  });
+}
+BENCHMARK(BasicBench_PathPrefix<ada::url>);
+BENCHMARK(BasicBench_PathPrefix<ada::url_aggregator>);
+
+template <class result_type>
+static void BasicBench_QueryAppend(benchmark::State& state) {
+  run_mutation<result_type>(state, [](result_type& url, size_t i) {
+    url.set_search(appended_searches[i]);
+  });
+}
+BENCHMARK(BasicBench_QueryAppend<ada::url>);
+BENCHMARK(BasicBench_QueryAppend<ada::url_aggregator>);
+
+template <class result_type>
+static void BasicBench_SchemeUpgrade(benchmark::State& state) {
+  run_mutation<result_type>(state, [](result_type& url, size_t) {
+    if (url.type == ada::scheme::HTTP) {
+      url.set_protocol("https");
+    }
+  });
+}
+BENCHMARK(BasicBench_SchemeUpgrade<ada::url>);
+BENCHMARK(BasicBench_SchemeUpgrade<ada::url_aggregator>);
+
+template <class result_type>
+static void BasicBench_FragmentStrip(benchmark::State& state) {
+  run_mutation<result_type>(
+      state, [](result_type& url, size_t) { url.set_hash(""); });
+}
+BENCHMARK(BasicBench_FragmentStrip<ada::url>);
+BENCHMARK(BasicBench_FragmentStrip<ada::url_aggregator>);
+
+int main(int argc, char** argv) {
+  if (argc > 1 && file_exists(argv[1])) {
+    init_data(argv[1]);
+  } else {
+    init_data();
+  }
+#if (__APPLE__ && __aarch64__) || defined(__linux__)
+  if (!collector.has_events()) {
+    benchmark::AddCustomContext("performance counters",
+                                "No privileged access (sudo may help).");
+  }
+#else
+  if (!collector.has_events()) {
+    benchmark::AddCustomContext("performance counters", "Unsupported system.");
+  }
+#endif
+  benchmark::AddCustomContext("input bytes",
+                              std::to_string(size_t(url_examples_bytes)));
+  benchmark::AddCustomContext("number of URLs",
+                              std::to_string(std::size(url_examples)));
+  benchmark::AddCustomContext(
+      "bytes/URL",
+      std::to_string(url_examples_bytes / std::size(url_examples)));
+  if (collector.has_events()) {
+    benchmark::AddCustomContext("performance counters", "Enabled");
+  }
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
@@ -0,0 +1,141 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark_header.h"
+
+/**
+ * Routing: N route patterns over 16 hosts, with path templates, wildcard
+ * hosts and query constraints, and a batch of URLs, most of them matching
+ * one of the routes. The baseline tests the patterns one after the other.
+ */
+struct route_workload {
+  std::vector<ada::url_pattern> patterns;
+  std::vector<ada::url_aggregator> urls;
+};
+
+route_workload make_workload(size_t route_count) {
+  std::mt19937_64 rng(route_count);
+  route_workload workload;
+  for (size_t i = 0; i < route_count; i++) {
+    const std::string host = "h" + std::to_string(i % 16) + ".example.com";
+    const std::string resource = "/r" + std::to_string(i);
+    std::string input;
+    switch (i % 4) {
+      case 0:
+        input = "https://" + host + resource + "/:id";
+        break;
+      case 1:
+        input = "https://" + host + resource + "/:id/items/*";
+        break;
+      case 2:
+        input = "https://*.cdn.example.com" + resource + "/*";
+        break;
+      default:
+        input = "https://" + host + resource + "?page=:page";
+    }
+    auto pattern = ada::parse_url_pattern(input);
+    if (!pattern) {
+      std::cerr << "invalid pattern " << input << std::endl;
+      std::abort();
+    }
+    workload.patterns.push_back(std::move(*pattern));
+  }
+  for (size_t i = 0; i < 4096; i++) {
+    const size_t route = rng() % route_count;
+    const std::string host = "h" + std::to_string(route % 16) + ".example.com";
+    const std::string resource = "/r" + std::to_string(route);
+    std::string href;
+    switch (route % 4) {
+      case 0:
+        href = "https://" + host + resource + "/42";
+        break;
+      case 1:
+        href = "https://" + host + resource + "/42/items/a/b";
+        break;
+      case 2:
+        href = "https://eu.cdn.example.com" + resource + "/app.js";
+        break;
+      default:
+        href = "https://" + host + resource + "?page=3";
+    }
+    if (i % 8 == 0) {
+      // A miss.
+      href = "https://" + host + "/missing/" + std::to_string(i);
+    }
+    workload.urls.push_back(*ada::parse<ada::url_aggregator>(href));
+  }
+  return workload;
+}
+
+static void set_counters(benchmark::State& state, size_t url_count) {
+  state.counters["time/url"] = benchmark::Counter(
+      double(url_count), benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+}
+
+static void BasicBench_UrlPatternSet_Match(benchmark::State& state) {
+  route_workload workload = make_workload(size_t(state.range(0)));
+  ada::url_pattern_set routes;
+  for (ada::url_pattern& pattern : workload.patterns) {
+    routes.add(std::move(pattern));
+  }
+  size_t matches = 0;
+  auto run = [&]() {
+    for (const ada::url_aggregator& url : workload.urls) {
+      matches += routes.match(url).value_or(0);
+    }
+  };
+  for (auto _ : state) {
+    run();
+  }
+  benchmark::DoNotOptimize(matches);
+  set_counters(state, workload.urls.size());
+  state.counters["allocations/url"] =
+      double(count_allocations(run)) / double(workload.urls.size());
+}
+
+static void BasicBench_UrlPatternSet_Exec(benchmark::State& state) {
+  route_workload workload = make_workload(size_t(state.range(0)));
+  ada::url_pattern_set routes;
+  for (ada::url_pattern& pattern : workload.patterns) {
+    routes.add(std::move(pattern));
+  }
+  size_t matches = 0;
+  for (auto _ : state) {
+    for (const ada::url_aggregator& url : workload.urls) {
+      auto result = routes.exec(url);
+      if (result) {
+        matches += result->second.group_count;
+      }
+    }
+  }
+  benchmark::DoNotOptimize(matches);
+  set_counters(state, workload.urls.size());
+}
+
+static void BasicBench_UrlPattern_Linear(benchmark::State& state) {
+  const route_workload workload = make_workload(size_t(state.range(0)));
+  size_t matches = 0;
+  for (auto _ : state) {
+    for (const ada::url_aggregator& url : workload.urls) {
+      for (size_t i = 0; i < workload.patterns.size(); i++) {
+        if (workload.patterns[i].test(url)) {
+          matches += i;
+          break;
+        }
+      }
+    }
+  }
+  benchmark::DoNotOptimize(matches);
+  set_counters(state, workload.urls.size());
+}
+
+#define ADA_URL_PATTERN_BENCHMARK(name) \
+  BENCHMARK(name)->RangeMultiplier(8)->Range(64, 1 << 15)
+
+ADA_URL_PATTERN_BENCHMARK(BasicBench_UrlPatternSet_Match);
+ADA_URL_PATTERN_BENCHMARK(BasicBench_UrlPatternSet_Exec);
+BENCHMARK(BasicBench_UrlPattern_Linear)->RangeMultiplier(8)->Range(64, 4096);
+
+BENCHMARK_MAIN();
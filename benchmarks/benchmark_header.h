@@ -1,5 +1,7 @@
+#include <atomic>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <cstdlib>
 #include <sstream>
 #include <fstream>
@@ -21,6 +23,75 @@ size_t N = 1000;
 
 #include <benchmark/benchmark.h>
 
+#ifndef ADA_BENCHMARK_CUSTOM_OPERATOR_NEW
+/**
+ * The global operator new counts the heap allocations, but only while
+ * count_allocations runs: the timed loops merely pay for a relaxed load.
+ * A benchmark that replaces operator new itself defines
+ * ADA_BENCHMARK_CUSTOM_OPERATOR_NEW before including this header.
+ */
+namespace allocation_counter {
+std::atomic<bool> enabled{false};
+std::atomic<size_t> allocations{0};
+}  // namespace allocation_counter
+
+ada_never_inline void* counted_allocation(size_t size) noexcept {
+  if (allocation_counter::enabled.load(std::memory_order_relaxed)) {
+    allocation_counter::allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(size_t size) {
+  void* pointer = counted_allocation(size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return counted_allocation(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return counted_allocation(size);
+}
+ada_never_inline void counted_deallocation(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer) noexcept { counted_deallocation(pointer); }
+void operator delete[](void* pointer) noexcept {
+  counted_deallocation(pointer);
+}
+void operator delete(void* pointer, size_t) noexcept {
+  counted_deallocation(pointer);
+}
+void operator delete[](void* pointer, size_t) noexcept {
+  counted_deallocation(pointer);
+}
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  counted_deallocation(pointer);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  counted_deallocation(pointer);
+}
+
+/**
+ * Runs function() once and returns the number of heap allocations it made.
+ */
+template <class Function>
+size_t count_allocations(Function function) {
+  size_t before =
+      allocation_counter::allocations.load(std::memory_order_relaxed);
+  allocation_counter::enabled.store(true, std::memory_order_relaxed);
+  function();
+  allocation_counter::enabled.store(false, std::memory_order_relaxed);
+  return allocation_counter::allocations.load(std::memory_order_relaxed) -
+         before;
+}
+#endif  // ADA_BENCHMARK_CUSTOM_OPERATOR_NEW
+
 bool file_exists(const char* filename) {
   namespace fs = std::filesystem;
   std::filesystem::path f{filename};
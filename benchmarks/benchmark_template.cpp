@@ -64,10 +64,22 @@ static void BasicBench_AdaURL(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
   }
+  state.counters["allocs/url"] =
+      double(count_allocations([&]() {
+        for (std::string& url_string : url_examples) {
+          ada::result<result_type> url = ada::parse<result_type>(url_string);
+          if (url) {
+            success++;
+          }
+        }
+      })) /
+      std::size(url_examples);
   (void)success;
   state.counters["time/byte"] = benchmark::Counter(
       url_examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -128,10 +140,19 @@ static void BasicBench_AdaURL_CanParse(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
   }
+  state.counters["allocs/url"] =
+      double(count_allocations([&]() {
+        for (std::string& url_string : url_examples) {
+          success += ada::can_parse(url_string);
+        }
+      })) /
+      std::size(url_examples);
   (void)success;
   state.counters["time/byte"] = benchmark::Counter(
       url_examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -207,6 +228,8 @@ static void BasicBench_whatwg(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -311,6 +334,8 @@ static void BasicBench_CURL(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -403,6 +428,8 @@ static void BasicBench_BoostURL(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -496,6 +523,8 @@ static void BasicBench_ZURI(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -558,6 +587,8 @@ static void BasicBench_uriparser_just_parse(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -612,6 +643,8 @@ static void BasicBench_urlparser_just_parse(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -669,6 +702,8 @@ static void BasicBench_http_parser_just_parse(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -759,6 +794,8 @@ static void BasicBench_ServoUrl(benchmark::State& state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
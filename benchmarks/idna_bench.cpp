@@ -0,0 +1,385 @@
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ada.h"
+#include "performancecounters/event_counter.h"
+#include "simdjson.h"
+event_collector collector;
+size_t N = 1000;
+
+#include <benchmark/benchmark.h>
+
+/**
+ * Benchmarks the domain to ASCII algorithm (UTS #46) stage by stage:
+ * UTF-8 to UTF-32 conversion, mapping, normalization, punycode encoding and
+ * decoding, plus the complete to_ascii and to_unicode functions. Every stage
+ * runs over the same categories of hosts, so that a regression (or a gain)
+ * can be attributed to a stage.
+ *
+ * Besides a few hand-picked hosts, the categories include the valid inputs
+ * of the IDNA conformance tests, split into ASCII and non-ASCII inputs.
+ *
+ * Usage: idna_bench [tests.json] [benchmark options]
+ * where tests.json has the format of tests/wpt/IdnaTestV2.json.
+ */
+#ifdef ADA_IDNA_TEST_FILE
+const char* default_idna_test_file = ADA_IDNA_TEST_FILE;
+#else
+const char* default_idna_test_file = "tests/wpt/IdnaTestV2.json";
+#endif
+
+struct host_category {
+  std::string name;
+  std::vector<std::string> hosts;
+};
+
+std::vector<std::string> ascii_hosts = {
+    "www.google.com",
+    "support.google.com",
+    "en.wikipedia.org",
+    "images-na.ssl-images-amazon.com",
+    "business.twitter.com",
+    "www.reddit.com",
+    "cdn.jsdelivr.net",
+    "localhost",
+    "WWW.EXAMPLE.COM",  // requires mapping to lower case
+    "Mail.Example.Org",
+};
+
+std::vector<std::string> mixed_script_hosts = {
+    "münchen.de",
+    "bücher.example",
+    "www.ÖBB.at",  // requires mapping to lower case
+    "faß.de",
+    "école.fr",
+    "e\xcc\x81" "cole.fr",  // requires normalization
+    "пример.рф",
+    "παράδειγμα.δοκιμή",
+    "例え.テスト",
+    "中国.cn",
+    "日本語.jp",
+    "مثال.إختبار",
+    "ｅｘａｍｐｌｅ．ｃｏｍ",  // full-width characters and dot
+    "shop.bücher.example.com",
+};
+
+std::vector<host_category> categories;
+
+double bytes_of(const std::vector<std::string>& inputs) {
+  size_t bytes{0};
+  for (const std::string& input : inputs) {
+    bytes += input.size();
+  }
+  return double(bytes);
+}
+
+/**
+ * Adds the inputs of the tests whose output is not null, that is, the hosts
+ * that to_ascii accepts, as two categories: the ASCII inputs and the others.
+ */
+bool load_idna_tests(const std::string& filename) {
+  if (!std::filesystem::exists(filename)) {
+    return false;
+  }
+  host_category ascii{"idna_tests_ascii", {}};
+  host_category unicode{"idna_tests_unicode", {}};
+  simdjson::ondemand::parser parser;
+  simdjson::padded_string json = simdjson::padded_string::load(filename);
+  simdjson::ondemand::document doc = parser.iterate(json);
+  for (auto element : doc.get_array()) {
+    if (element.type() != simdjson::ondemand::json_type::object) {
+      continue;
+    }
+    std::string_view input;
+    if (element["input"].get_string().get(input) != simdjson::SUCCESS) {
+      continue;
+    }
+    std::string host(input);
+    bool is_null = true;
+    if (element["output"].is_null().get(is_null) != simdjson::SUCCESS ||
+        is_null) {
+      continue;
+    }
+    bool is_ascii = std::all_of(host.begin(), host.end(),
+                                [](char c) { return uint8_t(c) < 0x80; });
+    (is_ascii ? ascii : unicode).hosts.push_back(std::move(host));
+  }
+  categories.push_back(std::move(ascii));
+  categories.push_back(std::move(unicode));
+  return true;
+}
+
+void init_data(const std::string& idna_test_file) {
+  categories.push_back({"ascii", ascii_hosts});
+  categories.push_back({"mixed_script", mixed_script_hosts});
+
+  // The punycode hosts are the ASCII serializations of the mixed-script
+  // hosts: "xn--mnchen-3ya.de" and so forth.
+  host_category punycode{"punycode", {}};
+  for (const std::string& host : mixed_script_hosts) {
+    punycode.hosts.push_back(ada::idna::to_ascii(host));
+  }
+  categories.push_back(std::move(punycode));
+
+  // Long hosts with many labels, some of which are not ASCII.
+  host_category long_hosts{"long_multi_label", {}};
+  for (size_t count : {8, 16, 32}) {
+    std::string host{};
+    for (size_t i = 0; i < count; i++) {
+      host += (i % 4 == 3) ? "bücher" : "label";
+      host += std::to_string(i);
+      host += '.';
+    }
+    host += "example.com";
+    long_hosts.hosts.push_back(std::move(host));
+  }
+  categories.push_back(std::move(long_hosts));
+
+  if (!load_idna_tests(idna_test_file)) {
+    std::cerr << "Cannot load the IDNA tests from " << idna_test_file
+              << std::endl;
+  }
+
+  // We only keep the hosts that the algorithm accepts.
+  for (host_category& category : categories) {
+    std::vector<std::string> valid{};
+    for (std::string& host : category.hosts) {
+      if (ada::idna::to_ascii(host).empty()) {
+        std::cerr << "Ignoring invalid host: " << host << std::endl;
+        continue;
+      }
+      valid.push_back(std::move(host));
+    }
+    category.hosts = std::move(valid);
+  }
+}
+
+std::vector<std::string_view> split_labels(std::string_view host) {
+  std::vector<std::string_view> labels{};
+  size_t start = 0;
+  for (size_t dot; (dot = host.find('.', start)) != std::string_view::npos;
+       start = dot + 1) {
+    labels.push_back(host.substr(start, dot - start));
+  }
+  labels.push_back(host.substr(start));
+  return labels;
+}
+
+std::u32string to_utf32(std::string_view input) {
+  std::u32string output(
+      ada::idna::utf32_length_from_utf8(input.data(), input.size()), '\0');
+  ada::idna::utf8_to_utf32(input.data(), input.size(), output.data());
+  return output;
+}
+
+/**
+ * The input of each stage, computed once from the hosts of a category. A
+ * stage whose input is empty is not registered.
+ */
+struct stage_inputs {
+  std::vector<std::string> utf8;
+  std::vector<std::string> ascii;
+  std::vector<std::u32string> utf32;
+  std::vector<std::u32string> mapped;
+  // The labels that punycode encodes: the non-ASCII labels of the mapped and
+  // normalized hosts.
+  std::vector<std::u32string> unicode_labels;
+  // The labels that punycode decodes: the "xn--" labels of the ASCII
+  // serialization, without their prefix.
+  std::vector<std::string> punycode_labels;
+};
+
+stage_inputs compute_inputs(const host_category& category) {
+  stage_inputs inputs{};
+  inputs.utf8 = category.hosts;
+  for (const std::string& host : category.hosts) {
+    std::string ascii = ada::idna::to_ascii(host);
+    for (std::string_view label : split_labels(ascii)) {
+      if (label.substr(0, 4) == "xn--") {
+        inputs.punycode_labels.emplace_back(label.substr(4));
+      }
+    }
+    inputs.ascii.push_back(std::move(ascii));
+
+    std::u32string utf32 = to_utf32(host);
+    std::u32string mapped = ada::idna::map(utf32);
+    std::u32string normalized = mapped;
+    ada::idna::normalize(normalized);
+    std::u32string_view view = normalized;
+    size_t start = 0;
+    while (start <= view.size()) {
+      size_t dot = view.find(U'.', start);
+      if (dot == std::u32string_view::npos) {
+        dot = view.size();
+      }
+      std::u32string_view label = view.substr(start, dot - start);
+      for (char32_t c : label) {
+        if (c >= 0x80) {
+          inputs.unicode_labels.emplace_back(label);
+          break;
+        }
+      }
+      start = dot + 1;
+    }
+    inputs.utf32.push_back(std::move(utf32));
+    inputs.mapped.push_back(std::move(mapped));
+  }
+  return inputs;
+}
+
+/**
+ * Runs function over all of the inputs in the timed loop, and then N more
+ * times under the performance counters when they are available.
+ */
+template <class T, class Function>
+void measure(benchmark::State& state, const std::vector<T>& inputs,
+             double bytes, Function function) {
+  auto run = [&]() {
+    for (const T& input : inputs) {
+      function(input);
+    }
+  };
+  for (auto _ : state) {
+    run();
+  }
+  if (collector.has_events()) {
+    event_aggregate aggregate{};
+    for (size_t i = 0; i < N; i++) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      collector.start();
+      run();
+      std::atomic_thread_fence(std::memory_order_release);
+      event_count allocate_count = collector.end();
+      aggregate << allocate_count;
+    }
+    state.counters["cycles/input"] =
+        aggregate.best.cycles() / std::size(inputs);
+    state.counters["instructions/input"] =
+        aggregate.best.instructions() / std::size(inputs);
+    state.counters["instructions/cycle"] =
+        aggregate.best.instructions() / aggregate.best.cycles();
+    state.counters["instructions/byte"] = aggregate.best.instructions() / bytes;
+    state.counters["GHz"] =
+        aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/input"] =
+        aggregate.best.branch_misses() / std::size(inputs);
+    state.counters["ns/input"] =
+        aggregate.best.elapsed_ns() / std::size(inputs);
+  }
+  state.counters["time/byte"] = benchmark::Counter(
+      bytes, benchmark::Counter::kIsIterationInvariantRate |
+                 benchmark::Counter::kInvert);
+  state.counters["time/input"] =
+      benchmark::Counter(double(std::size(inputs)),
+                         benchmark::Counter::kIsIterationInvariantRate |
+                             benchmark::Counter::kInvert);
+  state.counters["input/s"] =
+      benchmark::Counter(double(std::size(inputs)),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <class T, class Function>
+void register_stage(const std::string& stage, const std::string& category,
+                    const std::vector<T>& inputs, Function function) {
+  if (inputs.empty()) {
+    return;
+  }
+  // The bytes are those of the UTF-8 (or ASCII) form of the inputs.
+  double bytes{0};
+  for (const T& input : inputs) {
+    if constexpr (std::is_same_v<T, std::u32string>) {
+      bytes += double(
+          ada::idna::utf8_length_from_utf32(input.data(), input.size()));
+    } else {
+      bytes += double(input.size());
+    }
+  }
+  benchmark::RegisterBenchmark(
+      (stage + "/" + category).c_str(),
+      [&inputs, bytes, function](benchmark::State& state) {
+        measure(state, inputs, bytes, function);
+      });
+}
+
+int main(int argc, char** argv) {
+  std::string idna_test_file = default_idna_test_file;
+  if (argc > 1 && argv[1][0] != '-') {
+    idna_test_file = argv[1];
+    argv[1] = argv[0];
+    argc--;
+    argv++;
+  }
+  init_data(idna_test_file);
+  // The inputs must outlive the benchmarks, which refer to them.
+  std::vector<std::unique_ptr<stage_inputs>> all_inputs;
+  for (const host_category& category : categories) {
+    all_inputs.push_back(
+        std::make_unique<stage_inputs>(compute_inputs(category)));
+    const stage_inputs& inputs = *all_inputs.back();
+    const std::string& name = category.name;
+
+    register_stage("ToAscii", name, inputs.utf8, [](const std::string& host) {
+      benchmark::DoNotOptimize(ada::idna::to_ascii(host));
+    });
+    register_stage("ToUnicode", name, inputs.ascii,
+                   [](const std::string& host) {
+                     benchmark::DoNotOptimize(ada::idna::to_unicode(host));
+                   });
+    register_stage("Utf8ToUtf32", name, inputs.utf8,
+                   [](const std::string& host) {
+                     benchmark::DoNotOptimize(to_utf32(host));
+                   });
+    register_stage("Map", name, inputs.utf32, [](const std::u32string& host) {
+      benchmark::DoNotOptimize(ada::idna::map(host));
+    });
+    // The copy is part of the measure: normalize works in place.
+    register_stage("Normalize", name, inputs.mapped,
+                   [](const std::u32string& host) {
+                     std::u32string copy = host;
+                     ada::idna::normalize(copy);
+                     benchmark::DoNotOptimize(copy);
+                   });
+    register_stage("PunycodeEncode", name, inputs.unicode_labels,
+                   [](const std::u32string& label) {
+                     std::string out{};
+                     benchmark::DoNotOptimize(
+                         ada::idna::utf32_to_punycode(label, out));
+                     benchmark::DoNotOptimize(out);
+                   });
+    register_stage("PunycodeDecode", name, inputs.punycode_labels,
+                   [](const std::string& label) {
+                     std::u32string out{};
+                     benchmark::DoNotOptimize(
+                         ada::idna::punycode_to_utf32(label, out));
+                     benchmark::DoNotOptimize(out);
+                   });
+  }
+
+#if (__APPLE__ && __aarch64__) || defined(__linux__)
+  if (!collector.has_events()) {
+    benchmark::AddCustomContext("performance counters",
+                                "No privileged access (sudo may help).");
+  }
+#else
+  if (!collector.has_events()) {
+    benchmark::AddCustomContext("performance counters", "Unsupported system.");
+  }
+#endif
+  for (const host_category& category : categories) {
+    benchmark::AddCustomContext(
+        category.name + " hosts",
+        std::to_string(category.hosts.size()) + " hosts, " +
+            std::to_string(size_t(bytes_of(category.hosts))) + " bytes");
+  }
+  if (collector.has_events()) {
+    benchmark::AddCustomContext("performance counters", "Enabled");
+  }
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
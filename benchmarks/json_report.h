@@ -0,0 +1,92 @@
+#ifndef ADA_BENCHMARKS_JSON_REPORT_H
+#define ADA_BENCHMARKS_JSON_REPORT_H
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Results of the benchmark executables that do not use Google Benchmark,
+ * written in the JSON format of Google Benchmark (--benchmark_out_format=json):
+ *
+ * {
+ *   "context": { "executable": "latency_bench", ... },
+ *   "benchmarks": [
+ *     { "name": "...", "run_name": "...", "run_type": "iteration",
+ *       "repetitions": 1, "repetition_index": 0, "threads": 1,
+ *       "iterations": 1, "<counter>": <value>, ... }
+ *   ]
+ * }
+ *
+ * All of the benchmark results can thus be compared with
+ * tools/compare_benchmarks.py.
+ */
+struct json_report {
+  struct entry {
+    std::string name;
+    std::vector<std::pair<std::string, double>> counters;
+  };
+
+  std::vector<std::pair<std::string, std::string>> context;
+  std::vector<entry> benchmarks;
+
+  static void write_string(std::ostream& out, std::string_view value) {
+    out << '"';
+    for (const char c : value) {
+      if (c == '"' || c == '\\') {
+        out << '\\' << c;
+      } else if (uint8_t(c) < 0x20) {
+        out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+            << int(c) << std::dec << std::setfill(' ');
+      } else {
+        out << c;
+      }
+    }
+    out << '"';
+  }
+
+  void write(std::ostream& out) const {
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    out << "{\n  \"context\": {";
+    for (size_t i = 0; i < context.size(); i++) {
+      out << (i == 0 ? "\n    " : ",\n    ");
+      write_string(out, context[i].first);
+      out << ": ";
+      write_string(out, context[i].second);
+    }
+    out << "\n  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < benchmarks.size(); i++) {
+      const entry& e = benchmarks[i];
+      out << (i == 0 ? "\n    {" : ",\n    {");
+      out << "\n      \"name\": ";
+      write_string(out, e.name);
+      out << ",\n      \"run_name\": ";
+      write_string(out, e.name);
+      out << ",\n      \"run_type\": \"iteration\",\n"
+             "      \"repetitions\": 1,\n"
+             "      \"repetition_index\": 0,\n"
+             "      \"threads\": 1,\n"
+             "      \"iterations\": 1";
+      for (const auto& [counter, value] : e.counters) {
+        out << ",\n      ";
+        write_string(out, counter);
+        out << ": " << value;
+      }
+      out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+  bool write(const std::string& filename) const {
+    std::ofstream out(filename);
+    write(out);
+    return bool(out);
+  }
+};
+
+#endif  // ADA_BENCHMARKS_JSON_REPORT_H
@@ -6,6 +6,7 @@
 #include <sstream>
 
 #include "ada.h"
+#include "json_report.h"
 #include "performancecounters/event_counter.h"
 event_collector collector;
 
@@ -244,13 +245,39 @@ void print(const std::vector<stat_numbers> numbers) {
   }
 }
 
+/**
+ * Sums the best counters over all of the inputs, for the JSON summary.
+ */
+json_report::entry summarize(const std::string &name,
+                             const std::vector<stat_numbers> &numbers) {
+  double bytes{0}, cycles{0}, instructions{0}, branch_misses{0};
+  for (const stat_numbers &n : numbers) {
+    bytes += double(n.url_string.size());
+    cycles += n.counters.best.cycles();
+    instructions += n.counters.best.instructions();
+    branch_misses += n.counters.best.branch_misses();
+  }
+  const double count = double(numbers.size());
+  return {name,
+          {{"cycles/url", cycles / count},
+           {"instructions/url", instructions / count},
+           {"instructions/byte", instructions / bytes},
+           {"cycle/byte", cycles / bytes},
+           {"branch_misses/url", branch_misses / count}}};
+}
+
 int main(int argc, char **argv) {
   std::vector<std::string> input_urls;
-  if (argc == 1) {
-    input_urls = init_data();
-  } else {
-    input_urls = init_data(argv[1]);
+  const char *json_file = nullptr;
+  const char *input_file = default_file;
+  for (int i = 1; i < argc; i++) {
+    if (std::string_view(argv[i]) == "--json" && i + 1 < argc) {
+      json_file = argv[++i];
+    } else {
+      input_file = argv[i];
+    }
   }
+  input_urls = init_data(input_file);
   if (input_urls.empty()) {
     std::cout << "pass the path to a file containing a list of URL (one per "
                  "line) as a parameter."
@@ -268,12 +295,28 @@ int main(int argc, char **argv) {
   bool use_ada_url = (getenv("USE_URL") != nullptr);
   size_t trials = 100;
   std::cout << "# trials " << trials << std::endl;
+  std::vector<stat_numbers> numbers;
+  std::string name;
   if (use_ada_url) {
     std::cout << "# ada::url" << std::endl;
-    print(collect_values<ada::url>(input_urls, trials));
+    name = "model/ada::url";
+    numbers = collect_values<ada::url>(input_urls, trials);
   } else {
     std::cout << "# ada::url_aggregator" << std::endl;
-    print(collect_values<ada::url_aggregator>(input_urls, trials));
+    name = "model/ada::url_aggregator";
+    numbers = collect_values<ada::url_aggregator>(input_urls, trials);
+  }
+  print(numbers);
+  if (json_file != nullptr) {
+    json_report report{};
+    report.context = {{"executable", "model_bench"},
+                      {"trials", std::to_string(trials)},
+                      {"number of URLs", std::to_string(input_urls.size())}};
+    report.benchmarks.push_back(summarize(name, numbers));
+    if (!report.write(json_file)) {
+      std::cerr << "Cannot write " << json_file << std::endl;
+      return EXIT_FAILURE;
+    }
   }
 
   return EXIT_SUCCESS;
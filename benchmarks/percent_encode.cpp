@@ -51,6 +51,8 @@ static void Fragment(benchmark::State& state) {
         aggregate.best.instructions() / examples_bytes;
     state.counters["GHz"] =
         aggregate.total.cycles() / aggregate.total.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(examples);
   }
   state.counters["time/byte"] = benchmark::Counter(
       examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -95,6 +97,8 @@ static void Query(benchmark::State& state) {
         aggregate.best.instructions() / examples_bytes;
     state.counters["GHz"] =
         aggregate.total.cycles() / aggregate.total.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(examples);
   }
   state.counters["time/byte"] = benchmark::Counter(
       examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -139,6 +143,8 @@ static void SpecialQuery(benchmark::State& state) {
         aggregate.best.instructions() / examples_bytes;
     state.counters["GHz"] =
         aggregate.total.cycles() / aggregate.total.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(examples);
   }
   state.counters["time/byte"] = benchmark::Counter(
       examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -183,6 +189,8 @@ static void UserInfo(benchmark::State& state) {
         aggregate.best.instructions() / examples_bytes;
     state.counters["GHz"] =
         aggregate.total.cycles() / aggregate.total.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(examples);
   }
   state.counters["time/byte"] = benchmark::Counter(
       examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -227,6 +235,8 @@ static void C0Control(benchmark::State& state) {
         aggregate.best.instructions() / examples_bytes;
     state.counters["GHz"] =
         aggregate.total.cycles() / aggregate.total.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(examples);
   }
   state.counters["time/byte"] = benchmark::Counter(
       examples_bytes, benchmark::Counter::kIsIterationInvariantRate |
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "benchmark_header.h"
+#include "slow_input.h"
+
+/**
+ * Replays the corpus of slow inputs found by the performance fuzzer
+ * (fuzz/slow_input.cc, fuzz/slow_inputs): one benchmark per input, reporting
+ * the time and the heap allocations per byte. A change making one of these
+ * inputs super-linear shows up as a jump of time/byte on that input only.
+ *
+ * Usage: slow_input_bench [directory] [benchmark options]
+ */
+#ifdef ADA_SLOW_INPUT_DIR
+const char* default_directory = ADA_SLOW_INPUT_DIR;
+#else
+const char* default_directory = "fuzz/slow_inputs";
+#endif
+
+struct slow_input_file {
+  std::string name;
+  std::string content;
+};
+
+std::vector<slow_input_file> load_corpus(const std::string& directory) {
+  std::vector<slow_input_file> corpus;
+  std::error_code error;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(directory, error)) {
+    if (entry.is_regular_file()) {
+      corpus.push_back({entry.path().stem().string(),
+                        read_file(entry.path().string())});
+    }
+  }
+  std::sort(corpus.begin(), corpus.end(),
+            [](const slow_input_file& a, const slow_input_file& b) {
+              return a.name < b.name;
+            });
+  return corpus;
+}
+
+void replay(benchmark::State& state, const slow_input_file& input) {
+  volatile size_t result = 0;
+  for (auto _ : state) {
+    result = result + slow_input::run(input.content);
+  }
+  (void)result;
+  double bytes = double(input.content.size());
+  if (collector.has_events()) {
+    event_aggregate aggregate{};
+    for (size_t i = 0; i < N / 10; i++) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      collector.start();
+      result = result + slow_input::run(input.content);
+      std::atomic_thread_fence(std::memory_order_release);
+      event_count allocate_count = collector.end();
+      aggregate << allocate_count;
+    }
+    state.counters["cycle/byte"] = aggregate.best.cycles() / bytes;
+    state.counters["instructions/byte"] =
+        aggregate.best.instructions() / bytes;
+    state.counters["branch_misses/byte"] =
+        aggregate.best.branch_misses() / bytes;
+  }
+  size_t allocations =
+      count_allocations([&]() { result = slow_input::run(input.content); });
+  state.counters["allocs/byte"] = double(allocations) / bytes;
+  state.counters["bytes"] = bytes;
+  state.counters["time/byte"] = benchmark::Counter(
+      bytes, benchmark::Counter::kIsIterationInvariantRate |
+                 benchmark::Counter::kInvert);
+}
+
+int main(int argc, char** argv) {
+  std::string directory = default_directory;
+  if (argc > 1 && argv[1][0] != '-') {
+    directory = argv[1];
+    argv[1] = argv[0];
+    argc--;
+    argv++;
+  }
+  const std::vector<slow_input_file> corpus = load_corpus(directory);
+  if (corpus.empty()) {
+    std::cerr << "No input in " << directory << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (const slow_input_file& input : corpus) {
+    benchmark::RegisterBenchmark(
+        ("SlowInput/" + input.name).c_str(),
+        [&input](benchmark::State& state) { replay(state, input); });
+  }
+  benchmark::AddCustomContext("slow inputs", directory);
+  if (collector.has_events()) {
+    benchmark::AddCustomContext("performance counters", "Enabled");
+  }
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
@@ -94,6 +94,8 @@ static void BasicBench_AdaURL(benchmark::State &state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -174,6 +176,8 @@ static void BasicBench_whatwg(benchmark::State &state) {
         aggregate.best.instructions() / aggregate.best.elapsed_ns();
     state.counters["GHz"] =
         aggregate.best.cycles() / aggregate.best.elapsed_ns();
+    state.counters["branch_misses/url"] =
+        aggregate.best.branch_misses() / std::size(url_examples);
     state.counters["ns/url"] =
         aggregate.best.elapsed_ns() / std::size(url_examples);
     state.counters["cycle/byte"] = aggregate.best.cycles() / url_examples_bytes;
@@ -37,6 +37,14 @@ $CXX $CFLAGS $CXXFLAGS \
 $CXX $CFLAGS $CXXFLAGS $LIB_FUZZING_ENGINE url_search_params.o \
      -o $OUT/url_search_params
 
+$CXX $CFLAGS $CXXFLAGS \
+     -std=c++17 \
+     -I build/singleheader \
+     -c fuzz/slow_input.cc -o slow_input.o
+
+$CXX $CFLAGS $CXXFLAGS $LIB_FUZZING_ENGINE slow_input.o \
+     -o $OUT/slow_input
+
 $CXX $CFLAGS $CXXFLAGS \
      -std=c++17 \
      -I build/singleheader \
@@ -50,3 +58,4 @@ $CXX $CFLAGS $CXXFLAGS $LIB_FUZZING_ENGINE ./ada.o ada_c.o \
      -o $OUT/ada_c
 
 cp $SRC/ada-url/fuzz/*.dict $SRC/ada-url/fuzz/*.options $OUT/
+zip -j $OUT/slow_input_seed_corpus.zip $SRC/ada-url/fuzz/slow_inputs/*
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "ada.cpp"
+#include "ada.h"
+#include "slow_input.h"
+
+/**
+ * Performance fuzzer: rather than crashes, it looks for inputs (see
+ * slow_input.h for their format) whose running time or number of heap
+ * allocations exceeds a budget proportional to their size. Such an input is
+ * reported and the fuzzer aborts, so that libFuzzer saves it. Minimize it
+ * with -minimize_crash=1 and add it to fuzz/slow_inputs, which is replayed by
+ * benchmarks/slow_input_bench.cpp.
+ *
+ * The budgets are generous so that sanitizers and noise do not trigger them,
+ * and they can be set in the environment:
+ *   ADA_SLOW_INPUT_NS            fixed time budget (default 100000 ns)
+ *   ADA_SLOW_INPUT_NS_PER_BYTE   time budget per byte (default 500 ns)
+ *   ADA_SLOW_INPUT_ALLOCS        fixed allocation budget (default 64)
+ *   ADA_SLOW_INPUT_ALLOCS_PER_BYTE  allocations per byte (default 0.5)
+ */
+namespace {
+std::atomic<bool> counting{false};
+std::atomic<size_t> allocations{0};
+
+double budget(const char *name, double default_value) {
+  const char *value = std::getenv(name);
+  return value == nullptr ? default_value : std::atof(value);
+}
+
+const double fixed_ns = budget("ADA_SLOW_INPUT_NS", 100000);
+const double ns_per_byte = budget("ADA_SLOW_INPUT_NS_PER_BYTE", 500);
+const double fixed_allocations = budget("ADA_SLOW_INPUT_ALLOCS", 64);
+const double allocations_per_byte =
+    budget("ADA_SLOW_INPUT_ALLOCS_PER_BYTE", 0.5);
+}  // namespace
+
+// Out of line, so that the compiler does not see through the matching of
+// operator new with free and of malloc with operator delete.
+ada_never_inline void *counted_allocation(size_t size) {
+  if (counting.load(std::memory_order_relaxed)) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  void *pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+ada_never_inline void counted_deallocation(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void *operator new(size_t size) { return counted_allocation(size); }
+
+void *operator new[](size_t size) { return counted_allocation(size); }
+
+void operator delete(void *pointer) noexcept { counted_deallocation(pointer); }
+
+void operator delete[](void *pointer) noexcept {
+  counted_deallocation(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  counted_deallocation(pointer);
+}
+
+void operator delete[](void *pointer, size_t) noexcept {
+  counted_deallocation(pointer);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  std::string_view input(reinterpret_cast<const char *>(data), size);
+  // Count the allocations of one run, and keep the fastest of a few runs to
+  // filter out the noise.
+  allocations = 0;
+  counting = true;
+  volatile size_t result = slow_input::run(input);
+  counting = false;
+  size_t allocation_count = allocations;
+  double best_ns = 0;
+  for (size_t trial = 0; trial < 3; trial++) {
+    auto start = std::chrono::steady_clock::now();
+    result = slow_input::run(input);
+    auto end = std::chrono::steady_clock::now();
+    double ns = double(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count());
+    best_ns = trial == 0 ? ns : std::min(best_ns, ns);
+  }
+  (void)result;
+
+  double time_budget = fixed_ns + ns_per_byte * double(size);
+  double allocation_budget =
+      fixed_allocations + allocations_per_byte * double(size);
+  if (best_ns > time_budget || double(allocation_count) > allocation_budget) {
+    std::fprintf(stderr,
+                 "slow input: %zu bytes, %.0f ns (budget %.0f), %zu "
+                 "allocations (budget %.0f)\n",
+                 size, best_ns, time_budget, allocation_count,
+                 allocation_budget);
+    std::abort();
+  }
+  return 0;
+}
@@ -0,0 +1,151 @@
+#ifndef ADA_FUZZ_SLOW_INPUT_H
+#define ADA_FUZZ_SLOW_INPUT_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "ada.h"
+
+/**
+ * Scenarios of the slow-input fuzzer (slow_input.cc), replayed by
+ * benchmarks/slow_input_bench.cpp over the corpus in fuzz/slow_inputs.
+ *
+ * An input is text. Its first line names the scenario, the other lines are
+ * its arguments:
+ *
+ *   parse           the rest of the input is a URL
+ *   parse_base      a base URL on one line, the rest of the input is a URL
+ *   search_params   a query string on one line, then operation lines:
+ *                   "append k v", "set k v", "remove k", "has k",
+ *                   "sort" or "to_string"
+ *   idna            the rest of the input is a domain (ada::idna::to_ascii
+ *                   and ada::idna::to_unicode)
+ *   setters         a URL on one line, then operation lines:
+ *                   "<component> <value>" with a component among href,
+ *                   protocol, username, password, host, hostname, port,
+ *                   pathname, search and hash
+ *
+ * Inputs without a known scenario are parsed as URLs. An operation is
+ * expected to take time linear in the size of the object it works on (the
+ * entries of the search params, the href of the URL), and the operations
+ * stop once the sum of these sizes reaches work_per_byte times the size of
+ * the input. The number of operations thus grows with the input while the
+ * work of a scenario is expected to stay linear in its size: an input
+ * needing more time or more allocations per byte than the others points at
+ * super-linear behavior.
+ */
+namespace slow_input {
+
+constexpr size_t work_per_byte = 8;
+
+// Removes and returns the first line of input.
+inline std::string_view next_line(std::string_view& input) {
+  size_t end = input.find('\n');
+  std::string_view line = input.substr(0, end);
+  input.remove_prefix(end == std::string_view::npos ? input.size() : end + 1);
+  return line;
+}
+
+// Removes and returns the first space-separated word of line.
+inline std::string_view next_word(std::string_view& line) {
+  size_t end = line.find(' ');
+  std::string_view word = line.substr(0, end);
+  line.remove_prefix(end == std::string_view::npos ? line.size() : end + 1);
+  return word;
+}
+
+inline size_t run_search_params(std::string_view input) {
+  const size_t work_budget = work_per_byte * input.size();
+  ada::url_search_params params(next_line(input));
+  size_t answer = params.size();
+  for (size_t work = params.size() + 1;
+       work <= work_budget && !input.empty(); work += params.size() + 1) {
+    std::string_view arguments = next_line(input);
+    std::string_view operation = next_word(arguments);
+    std::string_view key = next_word(arguments);
+    if (operation == "append") {
+      params.append(key, arguments);
+    } else if (operation == "set") {
+      params.set(key, arguments);
+    } else if (operation == "remove") {
+      params.remove(key);
+    } else if (operation == "has") {
+      answer += params.has(key);
+    } else if (operation == "sort") {
+      params.sort();
+    } else if (operation == "to_string") {
+      answer += params.to_string().size();
+    }
+  }
+  return answer + params.size();
+}
+
+inline size_t run_setters(std::string_view input) {
+  const size_t work_budget = work_per_byte * input.size();
+  auto url = ada::parse<ada::url_aggregator>(next_line(input));
+  if (!url) {
+    return 0;
+  }
+  for (size_t work = url->get_href().size() + 1;
+       work <= work_budget && !input.empty();
+       work += url->get_href().size() + 1) {
+    std::string_view value = next_line(input);
+    std::string_view component = next_word(value);
+    if (component == "href") {
+      url->set_href(value);
+    } else if (component == "protocol") {
+      url->set_protocol(value);
+    } else if (component == "username") {
+      url->set_username(value);
+    } else if (component == "password") {
+      url->set_password(value);
+    } else if (component == "host") {
+      url->set_host(value);
+    } else if (component == "hostname") {
+      url->set_hostname(value);
+    } else if (component == "port") {
+      url->set_port(value);
+    } else if (component == "pathname") {
+      url->set_pathname(value);
+    } else if (component == "search") {
+      url->set_search(value);
+    } else if (component == "hash") {
+      url->set_hash(value);
+    }
+  }
+  return url->get_href().size();
+}
+
+/**
+ * Runs the scenario of the input, returns a value depending on the result
+ * (so that the work cannot be optimized away).
+ */
+inline size_t run(std::string_view input) {
+  std::string_view arguments = input;
+  std::string_view scenario = next_line(arguments);
+  if (scenario == "parse") {
+    auto url = ada::parse<ada::url_aggregator>(arguments);
+    return url ? url->get_href().size() : 0;
+  } else if (scenario == "parse_base") {
+    auto base = ada::parse<ada::url_aggregator>(next_line(arguments));
+    if (!base) {
+      return 0;
+    }
+    auto url = ada::parse<ada::url_aggregator>(arguments, &base.value());
+    return url ? url->get_href().size() : 0;
+  } else if (scenario == "search_params") {
+    return run_search_params(arguments);
+  } else if (scenario == "idna") {
+    std::string ascii = ada::idna::to_ascii(arguments);
+    return ascii.size() + ada::idna::to_unicode(ascii).size();
+  } else if (scenario == "setters") {
+    return run_setters(arguments);
+  }
+  auto url = ada::parse<ada::url_aggregator>(input);
+  return url ? url->get_href().size() : 0;
+}
+
+}  // namespace slow_input
+
+#endif  // ADA_FUZZ_SLOW_INPUT_H
@@ -9,7 +9,11 @@
 #include "ada/character_sets-inl.h"
 #include "ada/checkers-inl.h"
 #include "ada/common_defs.h"
+// Before log.h, which includes trace.h only with ADA_LOGGING: the single
+// header inlines each file once, at its first inclusion.
+#include "ada/trace.h"
 #include "ada/log.h"
+#include "ada/stats.h"
 #include "ada/encoding_type.h"
 #include "ada/helpers.h"
 #include "ada/parser.h"
@@ -23,8 +27,19 @@
 #include "ada/url_components.h"
 #include "ada/url_aggregator.h"
 #include "ada/url_aggregator-inl.h"
+#include "ada/url_builder.h"
+#include "ada/url_builder-inl.h"
+#include "ada/static_url.h"
+#include "ada/static_url-inl.h"
 #include "ada/url_search_params.h"
 #include "ada/url_search_params-inl.h"
+#include "ada/origin.h"
+#include "ada/origin-inl.h"
+#include "ada/hash.h"
+#include "ada/public_suffix.h"
+#include "ada/host_matcher.h"
+#include "ada/url_pattern.h"
+#include "ada/canonicalize.h"
 
 // Public API
 #include "ada/ada_version.h"
@@ -0,0 +1,56 @@
+/**
+ * @file canonicalize.h
+ * @brief Normalization of URLs beyond the WHATWG parser, e.g., for the
+ * deduplication of the URLs of a crawler.
+ */
+#ifndef ADA_CANONICALIZE_H
+#define ADA_CANONICALIZE_H
+
+#include "ada/common_defs.h"
+
+namespace ada {
+
+struct url_aggregator;
+
+/**
+ * The normalizations applied by ada::canonicalize. They follow the
+ * percent-encoding normalization of RFC 3986 (section 6.2.2).
+ *
+ * The default ports are not an option: the parser already removes the
+ * default port of the special schemes, e.g., "https://example.com:443/" is
+ * "https://example.com/".
+ */
+struct canonicalize_options {
+  /**
+   * Decode the percent-encoded unreserved characters (ALPHA, DIGIT, '-',
+   * '.', '_' and '~'): "/%7Euser" becomes "/~user". A digit that would
+   * complete a preceding '%' into a percent-encoding stays encoded: in
+   * "/%%32%65", only "%65" is decoded.
+   */
+  bool decode_unreserved{true};
+  /** Uppercase the other percent-encodings: "%2f" becomes "%2F". */
+  bool uppercase_percent_encodings{true};
+  /** Remove an empty query: "/path?" becomes "/path". */
+  bool remove_empty_query{true};
+  /** Remove an empty fragment: "/path#" becomes "/path". */
+  bool remove_empty_fragment{true};
+  /**
+   * Sort the query parameters, as url_aggregator::sort_search_params():
+   * "?b=1&a=2" becomes "?a=2&b=1".
+   */
+  bool sort_query{false};
+};
+
+/**
+ * Canonicalizes a URL in place, in a single pass over its href, keeping its
+ * components consistent. The normalizations never change the meaning of
+ * the URL for the WHATWG parser: the result parses to itself.
+ *
+ * @return true if the URL changed.
+ */
+bool canonicalize(url_aggregator &url, const canonicalize_options &options =
+                                           canonicalize_options());
+
+}  // namespace ada
+
+#endif  // ADA_CANONICALIZE_H
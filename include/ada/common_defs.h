@@ -56,6 +56,8 @@
 #define ada_unlikely(x) x
 #endif
 
+#define ada_prefetch(address) ((void)(address))
+
 #define ADA_PUSH_DISABLE_WARNINGS __pragma(warning(push))
 #define ADA_PUSH_DISABLE_ALL_WARNINGS __pragma(warning(push, 0))
 #define ADA_DISABLE_VS_WARNING(WARNING_NUMBER) \
@@ -94,6 +96,8 @@
 #define ada_unlikely(x) __builtin_expect(!!(x), 0)
 #endif
 
+#define ada_prefetch(address) __builtin_prefetch(address)
+
 #define ADA_PUSH_DISABLE_WARNINGS _Pragma("GCC diagnostic push")
 // gcc doesn't seem to disable all warnings with all and extra, add warnings
 // here as necessary
@@ -247,6 +251,8 @@ namespace ada {
 #define ADA_STR(x) #x
 
 #if ADA_DEVELOPMENT_CHECKS
+#include <iostream>
+
 #define ADA_REQUIRE(EXPR) \
   {                       \
     if (!(EXPR) { abort(); }) }
@@ -0,0 +1,100 @@
+/**
+ * @file hash.h
+ * @brief Hashing and equality of URLs, e.g., for hash maps and deduplication.
+ */
+#ifndef ADA_HASH_H
+#define ADA_HASH_H
+
+#include "ada/common_defs.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ada {
+
+struct url;
+struct url_aggregator;
+
+/**
+ * The part of the URL that is hashed and compared.
+ */
+enum class hash_options : uint8_t {
+  /** The whole URL, as get_href(). */
+  HREF,
+  /** The URL without its fragment, as get_href() up to the '#'. */
+  HREF_WITHOUT_FRAGMENT,
+  /**
+   * The origin of the URL, see ada::origin. As with origin::operator==, all
+   * the opaque origins are equal to one another: the URLs with an opaque
+   * origin (e.g., file URLs) share one hash and are one key of a hash
+   * container. Use origin::is_same_origin() for the same-origin check of the
+   * HTML standard. The inner URL of a blob URL may be parsed, see
+   * ada::origin: hashing and comparing with this option may allocate.
+   */
+  ORIGIN,
+  /** The host of the URL, as get_hostname(): the port is ignored. */
+  HOST,
+};
+
+/**
+ * Hashes a URL without serializing it: an ada::url_aggregator is hashed
+ * straight from its buffer, an ada::url from its components. An ada::url
+ * and an ada::url_aggregator representing the same URL have the same hash.
+ *
+ * The hash function reads 16 bytes at a time. Its values may change between
+ * versions of ada and between platforms: they should not be stored.
+ */
+[[nodiscard]] size_t hash(const ada::url_aggregator &url,
+                          hash_options options = hash_options::HREF);
+[[nodiscard]] size_t hash(const ada::url &url,
+                          hash_options options = hash_options::HREF);
+
+/**
+ * Whether two URLs are equal, in the sense of the options: equal URLs have
+ * the same hash. With url_aggregator instances, the offsets of the components
+ * are compared before the content of the buffers.
+ */
+[[nodiscard]] bool equals(const ada::url_aggregator &a,
+                          const ada::url_aggregator &b,
+                          hash_options options = hash_options::HREF);
+[[nodiscard]] bool equals(const ada::url &a, const ada::url &b,
+                          hash_options options = hash_options::HREF);
+
+/**
+ * Function objects for the hash containers, e.g.,
+ * std::unordered_set<ada::url_aggregator, ada::url_hash<>, ada::url_equal<>>.
+ */
+template <hash_options options = hash_options::HREF>
+struct url_hash {
+  template <class result_type>
+  size_t operator()(const result_type &url) const {
+    return ada::hash(url, options);
+  }
+};
+
+template <hash_options options = hash_options::HREF>
+struct url_equal {
+  template <class result_type>
+  bool operator()(const result_type &a, const result_type &b) const {
+    return ada::equals(a, b, options);
+  }
+};
+
+}  // namespace ada
+
+namespace std {
+template <>
+struct hash<ada::url_aggregator> {
+  size_t operator()(const ada::url_aggregator &url) const {
+    return ada::hash(url);
+  }
+};
+
+template <>
+struct hash<ada::url> {
+  size_t operator()(const ada::url &url) const { return ada::hash(url); }
+};
+}  // namespace std
+
+#endif  // ADA_HASH_H
@@ -160,6 +160,17 @@ find_authority_delimiter_special(std::string_view view) noexcept;
 ada_really_inline size_t
 find_authority_delimiter(std::string_view view) noexcept;
 
+/**
+ * @private
+ * Builds a structural index of an application/x-www-form-urlencoded string in
+ * a single pass. Bit i % 32 of structural[i / 32] is set when input[i] is '&'
+ * or '=', and the same bit of needs_decoding[i / 32] is set when input[i] is
+ * '+' or '%'. Both arrays must have room for (input.size() + 31) / 32 words.
+ * @see https://url.spec.whatwg.org/#concept-urlencoded-parser
+ */
+void index_form_urlencoded(std::string_view input, uint32_t* structural,
+                           uint32_t* needs_decoding) noexcept;
+
 /**
  * @private
  */
@@ -203,6 +214,22 @@ inline int leading_zeroes(uint32_t input_num) noexcept {
 #endif  // ADA_REGULAR_VISUAL_STUDIO
 }
 
+/**
+ * @private
+ * @return Number of trailing zeroes, the input must be non-zero.
+ */
+inline int trailing_zeroes(uint32_t input_num) noexcept {
+#if ADA_REGULAR_VISUAL_STUDIO
+  unsigned long ret;
+  // Search the mask data from least significant bit (LSB)
+  // to the most significant bit (MSB) for a set bit (1).
+  _BitScanForward(&ret, input_num);
+  return (int)ret;
+#else   // ADA_REGULAR_VISUAL_STUDIO
+  return __builtin_ctzl(input_num);
+#endif  // ADA_REGULAR_VISUAL_STUDIO
+}
+
 /**
  * @private
  * Counts the number of decimal digits necessary to represent x.
@@ -0,0 +1,97 @@
+/**
+ * @file host_matcher.h
+ * @brief Declaration for the host matcher: sets of domains, e.g., block and
+ * allow lists.
+ */
+#ifndef ADA_HOST_MATCHER_H
+#define ADA_HOST_MATCHER_H
+
+#include "ada/common_defs.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace ada {
+
+struct url_aggregator;
+
+/**
+ * A set of domains, each matching either the domain itself, its subdomains,
+ * or both, compiled into a trie of reversed labels: "www.example.com" is
+ * looked up as "com", then "example", then "www". The edges of the trie are
+ * stored in a single open addressing hash table, so that a lookup costs about
+ * one probe, and often one cache miss, per label of the host.
+ *
+ * The hosts are expected in canonical form, as returned by get_hostname():
+ * lowercase ASCII, with Unicode domains in punycode. The domains given to
+ * add() go through the host parser.
+ *
+ * A host_matcher is not thread-safe while it is being modified: any number
+ * of threads may call match() and match_many() concurrently otherwise.
+ */
+struct host_matcher {
+  enum match_type : uint8_t {
+    /** Only the domain itself: "example.com". */
+    EXACT = 1,
+    /** Only the subdomains: "www.example.com", "a.b.example.com". */
+    SUBDOMAINS = 2,
+    /** The domain and its subdomains. */
+    DOMAIN_AND_SUBDOMAINS = EXACT | SUBDOMAINS,
+  };
+
+  host_matcher();
+  host_matcher(host_matcher &&other) noexcept;
+  host_matcher &operator=(host_matcher &&other) noexcept;
+  host_matcher(const host_matcher &) = delete;
+  host_matcher &operator=(const host_matcher &) = delete;
+  ~host_matcher();
+
+  /**
+   * Adds a domain. The domain is parsed as the host of a special URL, so
+   * that "EXAMPLE.com" and "例え.jp" are accepted. A leading "*." restricts
+   * the match to the subdomains: add("*.example.com") is
+   * add("example.com", SUBDOMAINS). Adding a domain twice combines the
+   * match types.
+   *
+   * @return false if the domain is not a valid host.
+   */
+  bool add(std::string_view domain, match_type type = DOMAIN_AND_SUBDOMAINS);
+
+  /**
+   * @return whether the canonical host matches one of the domains.
+   */
+  [[nodiscard]] bool match(std::string_view host) const noexcept;
+  /**
+   * @return whether the host of the URL matches one of the domains.
+   */
+  [[nodiscard]] bool match(const ada::url_aggregator &url) const noexcept;
+
+  /**
+   * Matches a batch of hosts: results[i] = match(hosts[i]). The lookups of
+   * the hosts are interleaved, so that the cache misses of a host overlap
+   * with the work on the other hosts: with large sets, this is much faster
+   * than calling match() in a loop.
+   */
+  void match_many(const std::string_view *hosts, size_t count,
+                  bool *results) const noexcept;
+  /**
+   * Matches the hosts of a batch of URLs: results[i] = match(urls[i]).
+   */
+  void match_many(const ada::url_aggregator *urls, size_t count,
+                  bool *results) const noexcept;
+
+  /** @return the number of distinct domains in the set. */
+  [[nodiscard]] size_t size() const noexcept;
+  /** @return the memory used by the compiled set, in bytes. */
+  [[nodiscard]] size_t memory_usage() const noexcept;
+
+ private:
+  struct trie;
+  std::unique_ptr<trie> data;
+};
+
+}  // namespace ada
+
+#endif  // ADA_HOST_MATCHER_H
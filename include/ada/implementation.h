@@ -7,6 +7,7 @@
 #define ADA_IMPLEMENTATION_H
 
 #include <string>
+#include <string_view>
 #include <optional>
 
 #include "ada/parser.h"
@@ -40,6 +41,57 @@ extern template ada::result<url> parse<url>(std::string_view input,
 extern template ada::result<url_aggregator> parse<url_aggregator>(
     std::string_view input, const url_aggregator* base_url);
 
+/**
+ * Parses a UTF-16 input, e.g., a string of a JavaScript engine, without a
+ * separate transcoding pass: the input is converted to UTF-8 while it is
+ * trimmed and stripped of its ASCII tabs and newlines. Unpaired surrogates
+ * are replaced by U+FFFD.
+ *
+ * @param input the UTF-16 string input to analyze
+ * @param base_url the optional URL input to use as a base url.
+ * @return a parsed URL.
+ */
+template <class result_type = ada::url_aggregator>
+ada_warn_unused ada::result<result_type> parse(
+    std::u16string_view input, const result_type* base_url = nullptr);
+
+extern template ada::result<url> parse<url>(std::u16string_view input,
+                                            const url* base_url);
+extern template ada::result<url_aggregator> parse<url_aggregator>(
+    std::u16string_view input, const url_aggregator* base_url);
+
+/**
+ * Parses a Latin-1 (ISO-8859-1) input, e.g., a one-byte string of a
+ * JavaScript engine. An ASCII input is parsed as is, without a copy.
+ *
+ * @param input the Latin-1 string input to analyze
+ * @param base_url the optional URL input to use as a base url.
+ * @return a parsed URL.
+ */
+template <class result_type = ada::url_aggregator>
+ada_warn_unused ada::result<result_type> parse_latin1(
+    std::string_view input, const result_type* base_url = nullptr);
+
+extern template ada::result<url> parse_latin1<url>(std::string_view input,
+                                                   const url* base_url);
+extern template ada::result<url_aggregator> parse_latin1<url_aggregator>(
+    std::string_view input, const url_aggregator* base_url);
+
+/**
+ * Writes a string returned by a URL getter, e.g., url_aggregator::get_href()
+ * or url_aggregator::get_pathname(), as UTF-16 into output, e.g., for a
+ * JavaScript string. The output must have room for input.size() code units.
+ *
+ * The serialization of a valid URL is always ASCII: the parser and the
+ * setters percent-encode or punycode every other code point. The strings
+ * returned by the getters are thus also Latin-1 strings that can be used
+ * as is (e.g., as the one-byte strings of JavaScript engines), and each of
+ * their bytes becomes one code unit. Other UTF-8 input is transcoded.
+ *
+ * @return the number of code units written.
+ */
+size_t to_utf16(std::string_view input, char16_t* output) noexcept;
+
 /**
  * Verifies whether the URL strings can be parsed. The function assumes
  * that the inputs are valid ASCII or UTF-8 strings.
@@ -7,12 +7,16 @@
 #define ADA_LOG_H
 #include "ada/common_defs.h"
 
-#include <iostream>
-// To enable logging, set ADA_LOGGING to 1:
+// To enable logging, set ADA_LOGGING to 1. The messages go to the trace
+// buffers (see ada/trace.h), not directly to the standard output.
 #ifndef ADA_LOGGING
 #define ADA_LOGGING 0
 #endif
 
+#if ADA_LOGGING
+#include "ada/trace.h"
+#endif  // ADA_LOGGING
+
 namespace ada {
 
 /**
@@ -22,7 +26,8 @@ namespace ada {
 template <typename T>
 ada_really_inline void inner_log([[maybe_unused]] T t) {
 #if ADA_LOGGING
-  std::cout << t << std::endl;
+  trace::details::message_stream() << t;
+  trace::details::emit_formatted_message();
 #endif
 }
 
@@ -34,7 +39,7 @@ template <typename T, typename... Args>
 ada_really_inline void inner_log([[maybe_unused]] T t,
                                  [[maybe_unused]] Args... args) {
 #if ADA_LOGGING
-  std::cout << t;
+  trace::details::message_stream() << t;
   inner_log(args...);
 #endif
 }
@@ -47,7 +52,7 @@ template <typename T, typename... Args>
 ada_really_inline void log([[maybe_unused]] T t,
                            [[maybe_unused]] Args... args) {
 #if ADA_LOGGING
-  std::cout << "ADA_LOG: " << t;
+  trace::details::message_stream() << t;
   inner_log(args...);
 #endif
 }
@@ -59,7 +64,7 @@ ada_really_inline void log([[maybe_unused]] T t,
 template <typename T>
 ada_really_inline void log([[maybe_unused]] T t) {
 #if ADA_LOGGING
-  std::cout << "ADA_LOG: " << t << std::endl;
+  inner_log(t);
 #endif
 }
 }  // namespace ada
@@ -72,8 +77,21 @@ ada_really_inline void log([[maybe_unused]] T t) {
     ada::log(__VA_ARGS__); \
   } while (0)
 #endif  // ada_log
+
+#ifndef ada_trace_state
+#define ada_trace_state(state, position, input_size) \
+  ada::trace::details::emit_state(state, position, input_size)
+#endif  // ada_trace_state
+
+#ifndef ada_trace_result
+#define ada_trace_result(url, input_size)                              \
+  ada::trace::details::emit_result(url.is_valid, url.get_components(), \
+                                   input_size)
+#endif  // ada_trace_result
 #else
 #define ada_log(...)
+#define ada_trace_state(state, position, input_size)
+#define ada_trace_result(url, input_size)
 #endif  // ADA_LOGGING
 
 #endif  // ADA_LOG_H
@@ -0,0 +1,49 @@
+/**
+ * @file origin-inl.h
+ * @brief Inline declarations for the URL origin.
+ */
+#ifndef ADA_ORIGIN_INL_H
+#define ADA_ORIGIN_INL_H
+
+#include "ada/origin.h"
+
+namespace ada {
+
+inline bool origin::is_opaque() const noexcept { return opaque; }
+
+inline ada::scheme::type origin::get_scheme_type() const noexcept {
+  return type;
+}
+
+inline std::string_view origin::get_host() const noexcept {
+  return owned_host.empty() ? host : std::string_view(owned_host);
+}
+
+inline std::optional<uint16_t> origin::get_port() const noexcept {
+  if (port == url_components::omitted) {
+    return std::nullopt;
+  }
+  return uint16_t(port);
+}
+
+inline size_t origin::hash() const noexcept { return hash_value; }
+
+inline bool origin::operator==(const origin &other) const noexcept {
+  // The hashes, the scheme and the port are compared first: the hosts are
+  // only compared when everything else matches.
+  return hash_value == other.hash_value && opaque == other.opaque &&
+         type == other.type && port == other.port &&
+         get_host() == other.get_host();
+}
+
+inline bool origin::operator!=(const origin &other) const noexcept {
+  return !(*this == other);
+}
+
+inline bool origin::is_same_origin(const origin &other) const noexcept {
+  return !opaque && !other.opaque && *this == other;
+}
+
+}  // namespace ada
+
+#endif  // ADA_ORIGIN_INL_H
@@ -0,0 +1,112 @@
+/**
+ * @file origin.h
+ * @brief Declaration for the URL origin.
+ */
+#ifndef ADA_ORIGIN_H
+#define ADA_ORIGIN_H
+
+#include "ada/common_defs.h"
+#include "ada/scheme.h"
+#include "ada/url_components.h"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ada {
+
+struct url;
+struct url_aggregator;
+
+/**
+ * The origin of a URL, as a value: either opaque, or a tuple made of a
+ * scheme, a host and a port. Unlike get_origin(), computing an origin does
+ * not allocate, except for the blob URLs whose inner URL does not start with
+ * a scheme, a host and a port in canonical form ("http://" or "https://", a
+ * lowercase domain, then an optional port): their inner URL is parsed. Two
+ * origins are compared and hashed in constant time.
+ *
+ * The host is a view into the URL: the origin must not outlive the URL it was
+ * computed from, nor survive a modification of the URL.
+ *
+ * @see https://html.spec.whatwg.org/multipage/browsers.html#concept-origin
+ */
+struct origin {
+  /** An opaque origin. */
+  origin() = default;
+
+  /**
+   * @see https://url.spec.whatwg.org/#concept-url-origin
+   */
+  [[nodiscard]] static origin from(const ada::url_aggregator &url);
+  /**
+   * @see https://url.spec.whatwg.org/#concept-url-origin
+   */
+  [[nodiscard]] static origin from(const ada::url &url);
+
+  /** @return true for the opaque origins (file URLs, most non-special URLs). */
+  [[nodiscard]] inline bool is_opaque() const noexcept;
+  /** @return the scheme of a tuple origin, never FILE or NOT_SPECIAL. */
+  [[nodiscard]] inline ada::scheme::type get_scheme_type() const noexcept;
+  /** @return the host of a tuple origin, e.g., "example.com" or "[::1]". */
+  [[nodiscard]] inline std::string_view get_host() const noexcept;
+  /** @return the port of a tuple origin, if it is not the default port. */
+  [[nodiscard]] inline std::optional<uint16_t> get_port() const noexcept;
+  /** @return a hash of the origin, computed with the origin. */
+  [[nodiscard]] inline size_t hash() const noexcept;
+
+  /**
+   * Whether two origins are the same origin: tuple origins with the same
+   * scheme, host and port. An opaque origin is not the same origin as any
+   * other origin, unlike operator== which compares the values.
+   * @see https://html.spec.whatwg.org/multipage/browsers.html#same-origin
+   */
+  [[nodiscard]] inline bool is_same_origin(const origin &other) const noexcept;
+
+  /**
+   * The ASCII serialization of the origin, e.g., "https://example.com:8443"
+   * or "null": the value of get_origin().
+   * @see https://html.spec.whatwg.org/multipage/browsers.html#ascii-serialisation-of-an-origin
+   */
+  [[nodiscard]] std::string to_string() const;
+
+  inline bool operator==(const origin &other) const noexcept;
+  inline bool operator!=(const origin &other) const noexcept;
+
+ private:
+  origin(ada::scheme::type scheme_type, std::string_view host_view,
+         uint32_t port_value) noexcept;
+  /** Origin of the URL in the path of a blob URL. */
+  [[nodiscard]] static origin from_blob_path(std::string_view path);
+  /**
+   * Origin of the URL in the path of a blob URL, read without parsing it
+   * when the path starts with "http://" or "https://", a host and a port in
+   * canonical form, e.g., "https://example.com:8080/uuid".
+   */
+  [[nodiscard]] static std::optional<origin> from_canonical_blob_path(
+      std::string_view path) noexcept;
+
+  std::string_view host{};
+  /**
+   * The canonical host of the inner URL of a blob URL, when it does not
+   * appear as is in the URL (e.g., "blob:https://EXAMPLE.com/").
+   */
+  std::string owned_host{};
+  size_t hash_value{0};
+  uint32_t port{url_components::omitted};
+  ada::scheme::type type{ada::scheme::NOT_SPECIAL};
+  bool opaque{true};
+};
+
+}  // namespace ada
+
+namespace std {
+template <>
+struct hash<ada::origin> {
+  size_t operator()(const ada::origin &o) const noexcept { return o.hash(); }
+};
+}  // namespace std
+
+#endif  // ADA_ORIGIN_H
@@ -0,0 +1,77 @@
+/**
+ * @file public_suffix.h
+ * @brief Public suffixes and registrable domains (eTLD+1) of hosts.
+ *
+ * The rules of the Public Suffix List (https://publicsuffix.org/) are
+ * compiled into a constant table by tools/generate-public-suffix.py.
+ */
+#ifndef ADA_PUBLIC_SUFFIX_H
+#define ADA_PUBLIC_SUFFIX_H
+
+#include "ada/common_defs.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace ada {
+struct url;
+struct url_aggregator;
+}  // namespace ada
+
+namespace ada::public_suffix {
+
+/**
+ * Which rules of the Public Suffix List apply.
+ */
+enum class rules : uint8_t {
+  /**
+   * All the rules, including the private domains (e.g., "github.io"): the
+   * choice of the browsers for the cookies and the site isolation.
+   */
+  ALL,
+  /** Only the rules of the ICANN section: "co.uk", but not "github.io". */
+  ICANN,
+};
+
+/**
+ * Returns the public suffix of a canonical host, as a view into the host:
+ * "co.uk" for "www.example.co.uk". The hosts that do not match any rule use
+ * the default rule "*": the public suffix of "example.invalid" is "invalid".
+ * A trailing dot is kept: the public suffix of "example.com." is "com.".
+ *
+ * The public suffix of an IP address, or of an empty host, is empty.
+ *
+ * @see https://github.com/publicsuffix/list/wiki/Format#algorithm
+ */
+[[nodiscard]] std::string_view get_public_suffix(
+    std::string_view host, rules options = rules::ALL) noexcept;
+
+/**
+ * Returns the registrable domain of a canonical host (the "eTLD+1"), as a
+ * view into the host: "example.co.uk" for "www.example.co.uk". The result is
+ * empty when the host is a public suffix, an IP address or empty.
+ */
+[[nodiscard]] std::string_view get_registrable_domain(
+    std::string_view host, rules options = rules::ALL) noexcept;
+
+/**
+ * The public suffix of the host of the URL, as a view into the URL: the
+ * result must not outlive the URL, nor survive a modification of the URL.
+ */
+[[nodiscard]] std::string_view get_public_suffix(
+    const ada::url_aggregator &url, rules options = rules::ALL) noexcept;
+[[nodiscard]] std::string_view get_public_suffix(
+    const ada::url &url, rules options = rules::ALL) noexcept;
+
+/**
+ * The registrable domain of the host of the URL, as a view into the URL: the
+ * result must not outlive the URL, nor survive a modification of the URL.
+ */
+[[nodiscard]] std::string_view get_registrable_domain(
+    const ada::url_aggregator &url, rules options = rules::ALL) noexcept;
+[[nodiscard]] std::string_view get_registrable_domain(
+    const ada::url &url, rules options = rules::ALL) noexcept;
+
+}  // namespace ada::public_suffix
+
+#endif  // ADA_PUBLIC_SUFFIX_H
@@ -0,0 +1,164 @@
+/**
+ * @file static_url-inl.h
+ * @brief Definitions for URLs parsed at compile time.
+ */
+#ifndef ADA_STATIC_URL_INL_H
+#define ADA_STATIC_URL_INL_H
+
+#include "ada/character_sets-inl.h"
+#include "ada/scheme-inl.h"
+#include "ada/static_url.h"
+
+namespace ada {
+
+inline ada::result<url_aggregator> static_url::to_url_aggregator() const {
+  if (!is_valid) {
+    return tl::unexpected(errors::generic_error);
+  }
+  url_aggregator out;
+  out.buffer = href;
+  out.components = components;
+  out.type = type;
+  return out;
+}
+
+constexpr static_url parse_static_url(std::string_view input) noexcept {
+  static_url out{};
+  out.href = input;
+  if (input.size() >= url_components::omitted) {
+    return out;
+  }
+  auto in_set = [](const uint8_t *character_set, char c) {
+    return (character_set[uint8_t(c) >> 3] & (1 << (uint8_t(c) & 7))) != 0;
+  };
+  auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+
+  // Lowercase special scheme, other than "file", followed by "://".
+  size_t colon = input.find(':');
+  if (colon == std::string_view::npos) {
+    return out;
+  }
+  out.type = ada::scheme::get_scheme_type(input.substr(0, colon));
+  if (out.type == ada::scheme::NOT_SPECIAL ||
+      out.type == ada::scheme::FILE ||
+      input.substr(colon + 1, 2) != "//") {
+    return out;
+  }
+  out.components.protocol_end = uint32_t(colon + 1);
+  out.components.username_end = uint32_t(colon + 3);
+  out.components.host_start = uint32_t(colon + 3);
+
+  // Lowercase ASCII domain with non-empty labels. We exclude the domains that
+  // would go through IDNA ("xn-") and the ones that could be IPv4 addresses
+  // (the last label starts with a digit).
+  size_t position = input.find_first_of(":/?#", colon + 3);
+  if (position == std::string_view::npos) {
+    return out;
+  }
+  std::string_view host = input.substr(colon + 3, position - colon - 3);
+  if (host.empty() || host.front() == '.' || host.back() == '.' ||
+      host.find("..") != std::string_view::npos ||
+      host.find("xn-") != std::string_view::npos) {
+    return out;
+  }
+  for (const char c : host) {
+    if (!((c >= 'a' && c <= 'z') || is_digit(c) || c == '-' || c == '.')) {
+      return out;
+    }
+  }
+  size_t last_dot = host.rfind('.');
+  if (is_digit(host[last_dot == std::string_view::npos ? 0 : last_dot + 1])) {
+    return out;
+  }
+  out.components.host_end = uint32_t(position);
+
+  // Optional port, without leading zeroes, other than the default port.
+  if (input[position] == ':') {
+    size_t port_start = position + 1;
+    uint32_t port = 0;
+    position = port_start;
+    while (position < input.size() && is_digit(input[position])) {
+      port = port * 10 + uint32_t(input[position] - '0');
+      if (port > 65535) {
+        return out;
+      }
+      position++;
+    }
+    if (position == port_start || position == input.size() ||
+        (input[port_start] == '0' && position - port_start > 1) ||
+        port == ada::scheme::get_special_port(out.type)) {
+      return out;
+    }
+    out.components.port = port;
+  }
+
+  // The path starts with '/', it has no dot segments and no character to
+  // percent-encode.
+  if (input[position] != '/') {
+    return out;
+  }
+  out.components.pathname_start = uint32_t(position);
+  size_t path_end = input.find_first_of("?#", position);
+  if (path_end == std::string_view::npos) {
+    path_end = input.size();
+  }
+  while (position < path_end) {
+    // input[position] is '/'.
+    size_t segment_end = input.find('/', position + 1);
+    if (segment_end == std::string_view::npos || segment_end > path_end) {
+      segment_end = path_end;
+    }
+    std::string_view segment =
+        input.substr(position + 1, segment_end - position - 1);
+    size_t dots = 0;
+    for (size_t i = 0; i < segment.size(); i++) {
+      if (segment[i] == '.') {
+        dots++;
+      } else if (segment.substr(i, 3) == "%2e" ||
+                 segment.substr(i, 3) == "%2E") {
+        dots++;
+        i += 2;
+      } else {
+        dots = 3;
+        break;
+      }
+    }
+    if (!segment.empty() && dots <= 2) {
+      return out;
+    }
+    for (const char c : segment) {
+      if (c == '\\' ||
+          in_set(ada::character_sets::PATH_PERCENT_ENCODE, c)) {
+        return out;
+      }
+    }
+    position = segment_end;
+  }
+
+  // Optional query and fragment, without characters to percent-encode.
+  if (position < input.size() && input[position] == '?') {
+    out.components.search_start = uint32_t(position);
+    for (position++; position < input.size() && input[position] != '#';
+         position++) {
+      if (in_set(ada::character_sets::SPECIAL_QUERY_PERCENT_ENCODE,
+                 input[position])) {
+        return out;
+      }
+    }
+  }
+  if (position < input.size()) {
+    out.components.hash_start = uint32_t(position);
+    for (position++; position < input.size(); position++) {
+      if (in_set(ada::character_sets::FRAGMENT_PERCENT_ENCODE,
+                 input[position])) {
+        return out;
+      }
+    }
+  }
+  out.is_valid = true;
+  return out;
+}
+
+}  // namespace ada
+
+#endif  // ADA_STATIC_URL_INL_H
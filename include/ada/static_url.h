@@ -0,0 +1,58 @@
+/**
+ * @file static_url.h
+ * @brief Declaration for URLs parsed at compile time.
+ */
+#ifndef ADA_STATIC_URL_H
+#define ADA_STATIC_URL_H
+
+#include "ada/common_defs.h"
+#include "ada/implementation.h"
+#include "ada/scheme.h"
+#include "ada/url_aggregator.h"
+#include "ada/url_components.h"
+
+#include <string_view>
+
+namespace ada {
+
+/**
+ * @brief A URL literal, parsed at compile time.
+ *
+ * @details A static_url refers to its href (usually a string literal) and
+ * holds the offsets of its components, as computed by parse_static_url. When
+ * the static_url is a constexpr variable, parsing happens entirely at compile
+ * time, and the validity of the URL can be checked with static_assert:
+ *
+ * @code
+ * constexpr auto api = ada::parse_static_url("https://api.example.com/v1/");
+ * static_assert(api.is_valid);
+ * ada::result<ada::url_aggregator> url = api.to_url_aggregator();
+ * @endcode
+ */
+struct static_url {
+  std::string_view href{};
+  url_components components{};
+  ada::scheme::type type{ada::scheme::NOT_SPECIAL};
+  bool is_valid{false};
+
+  /**
+   * Returns a url_aggregator holding a copy of the href. Nothing is parsed at
+   * run time, so this costs a single allocation and a copy.
+   */
+  [[nodiscard]] inline ada::result<url_aggregator> to_url_aggregator() const;
+};
+
+/**
+ * Parses a URL at compile time. The function supports the URLs that are
+ * already in their canonical form (the href the parser would produce from
+ * them), with a special scheme other than "file", without credentials, with
+ * an ASCII domain that does not go through IDNA or IPv4 parsing, and without
+ * characters that require percent-encoding or dot segments in the path.
+ * The returned static_url is not valid when the input falls outside of this
+ * subset: such URLs must be parsed with ada::parse at run time.
+ */
+constexpr static_url parse_static_url(std::string_view input) noexcept;
+
+}  // namespace ada
+
+#endif  // ADA_STATIC_URL_H
@@ -0,0 +1,122 @@
+/**
+ * @file stats.h
+ * @brief Counters for the states and fast paths taken by the parser.
+ *
+ * When ada is built with ADA_STATS=1 (cmake -DADA_STATS=ON), the parser
+ * counts, in thread-local counters, the states of the state machine it enters
+ * and the fast and slow paths it takes. The counters of all threads are
+ * aggregated by ada::stats::get(). Without ADA_STATS, the counting compiles to
+ * nothing and ada::stats::get() returns zeros.
+ */
+#ifndef ADA_STATS_H
+#define ADA_STATS_H
+
+#include "ada/common_defs.h"
+#include "ada/state.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// To enable the counters, set ADA_STATS to 1:
+#ifndef ADA_STATS
+#define ADA_STATS 0
+#endif
+
+/**
+ * @namespace ada::stats
+ * @brief Counters for the states and fast paths taken by the parser.
+ */
+namespace ada::stats {
+
+/**
+ * Whether the library counts (ADA_STATS=1).
+ */
+constexpr bool enabled = ADA_STATS;
+
+/**
+ * Events counted by the parser, besides the states it enters.
+ */
+enum class counter : uint8_t {
+  /** Calls to the parser (ada::parse, ada::can_parse, setters...). */
+  PARSE,
+  /** Inputs containing ASCII tabs or newlines, which must be removed. */
+  TABS_OR_NEWLINE,
+  /** Inputs parsed against a base URL. */
+  BASE_RESOLUTION,
+  /** Hosts recognized as IPv4 addresses without going through IDNA. */
+  IPV4_FAST_PATH,
+  /** Hosts going through IDNA (ada::idna::to_ascii). */
+  IDNA,
+  /** Paths containing characters that must be percent-encoded. */
+  PATH_PERCENT_ENCODING,
+  /** Single-dot and double-dot path segments removed from paths. */
+  DOT_SEGMENT,
+};
+
+/** Number of values of ada::state. */
+constexpr size_t state_count = size_t(ada::state::PORT) + 1;
+/** Number of values of ada::stats::counter. */
+constexpr size_t counter_count = size_t(counter::DOT_SEGMENT) + 1;
+
+/**
+ * Totals of the counters at some point in time.
+ */
+struct snapshot {
+  /** Number of times the parser entered each state, indexed by ada::state. */
+  std::array<uint64_t, state_count> states{};
+  /** Indexed by ada::stats::counter. */
+  std::array<uint64_t, counter_count> counters{};
+
+  [[nodiscard]] uint64_t operator[](ada::state s) const noexcept {
+    return states[size_t(s)];
+  }
+  [[nodiscard]] uint64_t operator[](counter c) const noexcept {
+    return counters[size_t(c)];
+  }
+};
+
+/**
+ * Returns the sum of the counters of all threads, including the threads that
+ * have exited since the last call to reset().
+ */
+ada_warn_unused snapshot get();
+
+/**
+ * Sets all counters to zero. Counts made concurrently by other threads may be
+ * lost.
+ */
+void reset();
+
+/**
+ * Returns the name of a counter, e.g., "IDNA".
+ */
+ada_warn_unused std::string_view to_string(counter c);
+
+/**
+ * @private
+ */
+namespace details {
+/**
+ * Adds one to a counter of the current thread.
+ * @private
+ */
+void increment(size_t index) noexcept;
+
+ada_really_inline void count(counter c) noexcept {
+  increment(state_count + size_t(c));
+}
+
+ada_really_inline void count(ada::state s) noexcept { increment(size_t(s)); }
+}  // namespace details
+
+}  // namespace ada::stats
+
+#if ADA_STATS
+#define ada_stats_count(what) ada::stats::details::count(what)
+#else
+#define ada_stats_count(what)
+#endif  // ADA_STATS
+
+#endif  // ADA_STATS_H
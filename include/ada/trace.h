@@ -0,0 +1,199 @@
+/**
+ * @file trace.h
+ * @brief Binary trace of the parser, the backend of ada_log.
+ *
+ * When ada is built with ADA_LOGGING=1, the parser does not write to
+ * std::cout. Instead, each thread appends fixed-size binary events (the
+ * states of the state machine, the components of the parsed URLs and the
+ * ada_log messages) with a timestamp to its own lock-free ring buffer. A
+ * background thread drains the buffers into a sink: by default, a text sink
+ * writing to std::cerr. The binary format written by ada::trace::file_sink
+ * can be decoded with the adatrace tool.
+ *
+ * When the ring buffer of a thread is full, its events are dropped (and
+ * counted) rather than blocking the parser.
+ */
+#ifndef ADA_TRACE_H
+#define ADA_TRACE_H
+
+#include "ada/common_defs.h"
+#include "ada/state.h"
+#include "ada/url_components.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @namespace ada::trace
+ * @brief Binary trace of the parser (ADA_LOGGING=1).
+ */
+namespace ada::trace {
+
+/**
+ * Kinds of trace events.
+ */
+enum class event_kind : uint8_t {
+  /** The parser enters a state (event::state) at event::position. */
+  STATE,
+  /** A URL was parsed: event::payload.components holds its components. */
+  RESULT,
+  /**
+   * A chunk of an ada_log message (event::payload.text). When event::state is
+   * 1, the message continues in the next MESSAGE event of the same thread.
+   */
+  MESSAGE,
+  /** event::position events of this thread were dropped (full buffer). */
+  DROPPED,
+};
+
+/**
+ * A trace event: 56 bytes, written as is in binary traces.
+ */
+struct event {
+  /** Nanoseconds, from std::chrono::steady_clock. */
+  uint64_t timestamp;
+  /** Small integer identifying the thread (in order of first event). */
+  uint32_t thread;
+  event_kind kind;
+  /** An ada::state (STATE), whether the URL is valid (RESULT). */
+  uint8_t state;
+  /** Number of bytes used in payload.text (MESSAGE). */
+  uint16_t length;
+  uint32_t position;
+  uint32_t input_size;
+  union {
+    /**
+     * protocol_end, username_end, host_start, host_end, port, pathname_start,
+     * search_start and hash_start (RESULT).
+     */
+    uint32_t components[8];
+    char text[32];
+  } payload;
+};
+
+static_assert(std::is_trivially_copyable_v<event>);
+static_assert(sizeof(event) == 56);
+
+/**
+ * The binary trace starts with this magic string, followed by the size of
+ * an event as a little-endian uint32_t, followed by the events.
+ */
+constexpr std::string_view file_magic = "ADATRACE";
+
+/**
+ * Receives the events drained from the ring buffers. The calls to write are
+ * serialized.
+ */
+class sink {
+ public:
+  virtual ~sink() = default;
+  virtual void write(const event* events, size_t count) = 0;
+  virtual void flush() {}
+};
+
+/**
+ * Writes the events in the binary format (see file_magic).
+ */
+class file_sink : public sink {
+ public:
+  /** Opens (truncates) the file. Check is_open(). */
+  explicit file_sink(const char* filename);
+  file_sink(const file_sink&) = delete;
+  file_sink& operator=(const file_sink&) = delete;
+  ~file_sink() override;
+
+  [[nodiscard]] bool is_open() const noexcept { return file != nullptr; }
+  void write(const event* events, size_t count) override;
+  void flush() override;
+
+ private:
+  std::FILE* file{nullptr};
+};
+
+/**
+ * Writes the events as text, one line per event (one line per message).
+ */
+class text_sink : public sink {
+ public:
+  explicit text_sink(std::ostream& output);
+  text_sink(const text_sink&) = delete;
+  text_sink& operator=(const text_sink&) = delete;
+  ~text_sink() override;
+  void write(const event* events, size_t count) override;
+  void flush() override;
+
+ private:
+  struct pending_messages;
+  std::ostream& out;
+  /** Messages split across events, by thread. */
+  std::unique_ptr<pending_messages> pending;
+};
+
+/**
+ * Returns true if the library was built with ADA_LOGGING=1, otherwise the
+ * parser emits no event.
+ */
+ada_warn_unused bool enabled() noexcept;
+
+/**
+ * Replaces the sink (the default is a text_sink writing to std::cerr). The
+ * sink must outlive the tracing: call stop() or set_sink() before
+ * destroying it. Passing nullptr discards the events.
+ */
+void set_sink(sink* destination);
+
+/**
+ * Starts the background thread draining the buffers every period. It is
+ * started automatically, with a period of 10 ms, by the first event.
+ */
+void start(std::chrono::milliseconds period = std::chrono::milliseconds(10));
+
+/**
+ * Stops the background thread, after a last drain.
+ */
+void stop();
+
+/**
+ * Moves the events of all threads to the sink, and flushes the sink.
+ */
+void drain();
+
+/**
+ * Appends a one-line description of the event, without the text of the
+ * messages (see text_sink).
+ */
+void append_description(const event& e, std::string& out);
+
+/**
+ * @private
+ */
+namespace details {
+/** @private */
+void emit_state(ada::state s, size_t position, size_t input_size) noexcept;
+/** @private */
+void emit_result(bool is_valid, const ada::url_components& components,
+                 size_t input_size) noexcept;
+/** @private */
+void emit_message(std::string_view text) noexcept;
+/**
+ * Stream in which ada_log formats the current message of the thread.
+ * @private
+ */
+std::ostream& message_stream();
+/**
+ * Emits the message formatted in message_stream(), without copying it, and
+ * clears the stream.
+ * @private
+ */
+void emit_formatted_message() noexcept;
+}  // namespace details
+
+}  // namespace ada::trace
+
+#endif  // ADA_TRACE_H
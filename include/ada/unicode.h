@@ -9,6 +9,7 @@
 #include "ada/ada_idna.h"
 
 #include <string>
+#include <string_view>
 #include <optional>
 
 /**
@@ -75,6 +76,38 @@ bool to_ascii(std::optional<std::string>& out, std::string_view plain,
 ada_really_inline bool has_tabs_or_newline(
     std::string_view user_input) noexcept;
 
+/**
+ * @private
+ * Checks if the input is ASCII.
+ */
+ada_really_inline bool is_ascii(std::string_view input) noexcept;
+
+/**
+ * @private
+ * Converts UTF-16 to UTF-8 and prepares it for the URL parser in the same
+ * pass: the leading and trailing C0 control or space code units are trimmed
+ * and the ASCII tabs and newlines are removed. An unpaired surrogate becomes
+ * U+FFFD. The output must have room for 3 bytes per code unit.
+ * @return the number of bytes written.
+ */
+size_t utf16_to_url_input(std::u16string_view input, char* output) noexcept;
+
+/**
+ * @private
+ * As utf16_to_url_input, for Latin-1 (ISO-8859-1) input. The output must
+ * have room for 2 bytes per character.
+ * @return the number of bytes written.
+ */
+size_t latin1_to_url_input(std::string_view input, char* output) noexcept;
+
+/**
+ * @private
+ * Converts valid UTF-8 to UTF-16, widening the ASCII blocks 16 bytes at a
+ * time. The output must have room for one code unit per byte.
+ * @return the number of code units written.
+ */
+size_t utf8_to_utf16(std::string_view input, char16_t* output) noexcept;
+
 /**
  * @private
  * Checks if the input is a forbidden host code point.
@@ -182,6 +215,14 @@ ada_really_inline unsigned constexpr convert_hex_to_binary(char c) noexcept;
  */
 std::string percent_decode(std::string_view input, size_t first_percent);
 
+/**
+ * @private
+ * Replaces every U+002B (+) with U+0020 SPACE and percent-decodes the input in
+ * a single pass. A '+' obtained by decoding "%2B" is left untouched.
+ * @see https://url.spec.whatwg.org/#concept-urlencoded-parser
+ */
+std::string percent_decode_form_urlencoded(std::string_view input);
+
 /**
  * @private
  * Returns a percent-encoding string whether percent encoding was needed or not.
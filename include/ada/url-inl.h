@@ -181,34 +181,8 @@ inline void url::copy_scheme(const ada::url &u) {
 }
 
 [[nodiscard]] ada_really_inline std::string url::get_href() const noexcept {
-  std::string output = get_protocol();
-
-  if (host.has_value()) {
-    output += "//";
-    if (has_credentials()) {
-      output += username;
-      if (!password.empty()) {
-        output += ":" + get_password();
-      }
-      output += "@";
-    }
-    output += host.value();
-    if (port.has_value()) {
-      output += ":" + get_port();
-    }
-  } else if (!has_opaque_path && checkers::begins_with(path, "//")) {
-    // If url's host is null, url does not have an opaque path, url's path's
-    // size is greater than 1, and url's path[0] is the empty string, then
-    // append U+002F (/) followed by U+002E (.) to output.
-    output += "/.";
-  }
-  output += path;
-  if (query.has_value()) {
-    output += "?" + query.value();
-  }
-  if (hash.has_value()) {
-    output += "#" + hash.value();
-  }
+  std::string output;
+  write_href(output);
   return output;
 }
 
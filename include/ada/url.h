@@ -14,6 +14,7 @@
 
 #include "ada/checkers.h"
 #include "ada/common_defs.h"
+#include "ada/hash.h"
 #include "ada/log.h"
 #include "ada/scheme.h"
 #include "ada/serializers.h"
@@ -23,6 +24,8 @@
 
 namespace ada {
 
+struct url_aggregator;
+
 /**
  * @brief Generic URL struct reliant on std::string instantiation.
  *
@@ -282,6 +285,14 @@ struct url : url_base {
    */
   [[nodiscard]] ada_really_inline ada::url_components get_components()
       const noexcept;
+
+  /**
+   * Converts this URL to an ada::url_aggregator without parsing it again:
+   * the href is serialized directly in the buffer of the result and the
+   * components are computed from the ones of this URL.
+   * @see url_aggregator::to_url
+   */
+  [[nodiscard]] url_aggregator to_aggregator() const;
   /** @return true if the URL has a hash component */
   [[nodiscard]] inline bool has_hash() const noexcept override;
   /** @return true if the URL has a search component */
@@ -299,6 +310,11 @@ struct url : url_base {
                                                               const ada::url *);
   friend ada::url_aggregator ada::parser::parse_url_impl<
       ada::url_aggregator, true>(std::string_view, const ada::url_aggregator *);
+  friend struct origin;
+  friend struct url_aggregator;
+  friend size_t ada::hash(const ada::url &url, hash_options options);
+  friend bool ada::equals(const ada::url &a, const ada::url &b,
+                          hash_options options);
 
   inline void update_unencoded_base_hash(std::string_view input);
   inline void update_base_hostname(std::string_view input);
@@ -348,6 +364,12 @@ struct url : url_base {
    */
   std::string non_special_scheme{};
 
+  /**
+   * Replaces the content of output with the href, in a single pass sized up
+   * front.
+   */
+  void write_href(std::string &output) const;
+
   /**
    * A URL cannot have a username/password/port if its host is null or the empty
    * string, or its scheme is "file".
@@ -16,6 +16,7 @@
 #include "ada/scheme.h"
 #include "ada/log.h"
 
+#include <cstring>
 #include <optional>
 #include <string_view>
 
@@ -617,6 +618,130 @@ inline void url_aggregator::clear_search() {
   ADA_ASSERT_TRUE(validate());
 }
 
+template <typename Predicate>
+size_t url_aggregator::remove_search_params_if(Predicate predicate) {
+  ada_log("url_aggregator::remove_search_params_if");
+  ADA_ASSERT_TRUE(validate());
+  if (components.search_start == url_components::omitted) {
+    return 0;
+  }
+  return remove_search_params_from(components.search_start + 1, predicate);
+}
+
+template <typename Predicate>
+size_t url_aggregator::remove_search_params_from(uint32_t first,
+                                                 Predicate &predicate) {
+  ada_log("url_aggregator::remove_search_params_from ", first);
+  ADA_ASSERT_TRUE(components.search_start != url_components::omitted);
+  const uint32_t query_start = components.search_start + 1;
+  const uint32_t query_end = components.hash_start == url_components::omitted
+                                 ? uint32_t(buffer.size())
+                                 : components.hash_start;
+  // The parameters we keep are moved toward the front of the query, joined by
+  // '&'. We never write past the parameter we are currently examining.
+  bool has_kept = first != query_start;
+  uint32_t out = has_kept ? first - 1 : first;
+  uint32_t parameter_start = first;
+  size_t removed = 0;
+  char *data = buffer.data();
+  while (true) {
+    const void *ampersand =
+        std::memchr(data + parameter_start, '&', query_end - parameter_start);
+    const uint32_t parameter_end =
+        ampersand == nullptr ? query_end
+                             : uint32_t((const char *)ampersand - data);
+    std::string_view parameter(data + parameter_start,
+                               parameter_end - parameter_start);
+    bool remove = false;
+    if (!parameter.empty()) {
+      size_t equal = parameter.find('=');
+      remove = predicate(parameter.substr(0, equal),
+                         equal == std::string_view::npos
+                             ? std::string_view()
+                             : parameter.substr(equal + 1));
+    }
+    if (remove) {
+      removed++;
+    } else {
+      if (has_kept) {
+        data[out++] = '&';
+      }
+      if (out != parameter_start) {
+        std::memmove(data + out, data + parameter_start, parameter.size());
+      }
+      out += uint32_t(parameter.size());
+      has_kept = true;
+    }
+    if (parameter_end == query_end) {
+      break;
+    }
+    parameter_start = parameter_end + 1;
+  }
+  if (removed != 0) {
+    erase_search_range(out, query_end);
+  }
+  ADA_ASSERT_TRUE(validate());
+  return removed;
+}
+
+inline url_aggregator::editor url_aggregator::edit() noexcept {
+  return editor(*this);
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_protocol(
+    std::string_view input) noexcept {
+  protocol = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_username(
+    std::string_view input) noexcept {
+  username = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_password(
+    std::string_view input) noexcept {
+  password = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_host(
+    std::string_view input) noexcept {
+  host = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_hostname(
+    std::string_view input) noexcept {
+  hostname = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_port(
+    std::string_view input) noexcept {
+  port = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_pathname(
+    std::string_view input) noexcept {
+  pathname = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_search(
+    std::string_view input) noexcept {
+  search = input;
+  return *this;
+}
+
+inline url_aggregator::editor &url_aggregator::editor::set_hash(
+    std::string_view input) noexcept {
+  hash = input;
+  return *this;
+}
+
 inline void url_aggregator::clear_hash() {
   ada_log("url_aggregator::clear_hash");
   ADA_ASSERT_TRUE(validate());
@@ -5,15 +5,19 @@
 #ifndef ADA_URL_AGGREGATOR_H
 #define ADA_URL_AGGREGATOR_H
 
+#include <optional>
 #include <string>
 #include <string_view>
 
+#include "ada/canonicalize.h"
 #include "ada/common_defs.h"
 #include "ada/url_base.h"
 #include "ada/url_components.h"
 
 namespace ada {
 
+struct url;
+
 /**
  * @brief Lightweight URL struct.
  *
@@ -41,6 +45,45 @@ struct url_aggregator : url_base {
   void set_search(std::string_view input);
   void set_hash(std::string_view input);
 
+  /**
+   * Removes every parameter of the query for which predicate(key, value)
+   * returns true. The query is split on '&' and each non-empty parameter is
+   * split on its first '='; the key and value views are passed as they appear
+   * in the href (they are not percent-decoded). The buffer is edited in place:
+   * the other parameters are kept byte for byte. If the query becomes empty,
+   * it is removed.
+   * @return the number of removed parameters.
+   * @see https://url.spec.whatwg.org/#dom-urlsearchparams-delete
+   */
+  template <typename Predicate>
+  size_t remove_search_params_if(Predicate predicate);
+  /**
+   * Sets the value of the first query parameter named key to value, and
+   * removes the other parameters with the same name. When there is no such
+   * parameter, a new one is appended to the query. The key and the value are
+   * encoded as in application/x-www-form-urlencoded serialization. Only the
+   * affected parameters are rewritten.
+   * @see https://url.spec.whatwg.org/#dom-urlsearchparams-set
+   */
+  void set_search_param(std::string_view key, std::string_view value);
+  /**
+   * Sorts the query parameters by their (decoded) key, preserving the
+   * relative order of parameters with equal keys. Empty parameters are
+   * dropped. The parameters are copied as is, without being decoded and
+   * encoded again.
+   * @see https://url.spec.whatwg.org/#dom-urlsearchparams-sort
+   */
+  void sort_search_params();
+
+  class editor;
+  /**
+   * Starts an edit of several components at once, e.g.,
+   * url.edit().set_protocol("https").set_host(host).set_pathname(p).apply().
+   * The new href is built once, with a single allocation, instead of moving
+   * the tail of the buffer for every setter.
+   */
+  [[nodiscard]] inline editor edit() noexcept;
+
   [[nodiscard]] bool has_valid_domain() const noexcept override;
   /**
    * The origin getter steps are to return the serialization of this's URL's
@@ -163,6 +206,13 @@ struct url_aggregator : url_base {
    */
   [[nodiscard]] ada_really_inline const ada::url_components &get_components()
       const noexcept;
+  /**
+   * Converts this URL to an ada::url, e.g., for a URL that is mutated many
+   * times, without parsing it again: the components are copied from the
+   * buffer.
+   * @see url::to_aggregator
+   */
+  [[nodiscard]] url to_url() const;
   /**
    * Returns a string representation of this URL.
    */
@@ -210,6 +260,12 @@ struct url_aggregator : url_base {
   friend ada::url_aggregator
   ada::parser::parse_url_impl<ada::url_aggregator, false>(
       std::string_view, const ada::url_aggregator *);
+  friend class url_builder;
+  friend struct static_url;
+  friend struct origin;
+  friend struct url;
+  friend bool ada::canonicalize(url_aggregator &url,
+                                const canonicalize_options &options);
 
   std::string buffer{};
   url_components components{};
@@ -290,6 +346,18 @@ struct url_aggregator : url_base {
   [[nodiscard]] inline bool has_dash_dot() const noexcept;
   void delete_dash_dot();
   inline void consume_prepared_path(std::string_view input);
+  /**
+   * Removes the query parameters, starting with the one located at 'first',
+   * for which predicate(key, value) returns true.
+   * @return the number of removed parameters.
+   */
+  template <typename Predicate>
+  size_t remove_search_params_from(uint32_t first, Predicate &predicate);
+  /**
+   * Erases the bytes in [start, end) from the query. The query is removed
+   * altogether if nothing is left.
+   */
+  void erase_search_range(uint32_t start, uint32_t end);
   template <bool has_state_override = false>
   [[nodiscard]] ada_really_inline bool parse_scheme_with_colon(
       std::string_view input);
@@ -308,6 +376,50 @@ struct url_aggregator : url_base {
 
 };  // url_aggregator
 
+/**
+ * @brief Collects the changes to several components of a url_aggregator.
+ *
+ * @details The changes are recorded as views, so the strings they refer to
+ * must outlive the call to apply(). They take effect in the order of the
+ * href: protocol, username, password, host, hostname, port, pathname, search
+ * and hash, whatever the order of the calls.
+ */
+class url_aggregator::editor {
+ public:
+  inline editor &set_protocol(std::string_view input) noexcept;
+  inline editor &set_username(std::string_view input) noexcept;
+  inline editor &set_password(std::string_view input) noexcept;
+  inline editor &set_host(std::string_view input) noexcept;
+  inline editor &set_hostname(std::string_view input) noexcept;
+  inline editor &set_port(std::string_view input) noexcept;
+  inline editor &set_pathname(std::string_view input) noexcept;
+  inline editor &set_search(std::string_view input) noexcept;
+  inline editor &set_hash(std::string_view input) noexcept;
+
+  /**
+   * Applies the recorded changes, with the semantics of the matching
+   * url_aggregator setters. The edit is all or nothing: if one of the setters
+   * fails, the URL is left unchanged.
+   * @return true on success.
+   */
+  bool apply();
+
+ private:
+  friend struct url_aggregator;
+  explicit editor(url_aggregator &u) noexcept : url(u) {}
+
+  url_aggregator &url;
+  std::optional<std::string_view> protocol{};
+  std::optional<std::string_view> username{};
+  std::optional<std::string_view> password{};
+  std::optional<std::string_view> host{};
+  std::optional<std::string_view> hostname{};
+  std::optional<std::string_view> port{};
+  std::optional<std::string_view> pathname{};
+  std::optional<std::string_view> search{};
+  std::optional<std::string_view> hash{};
+};  // url_aggregator::editor
+
 inline std::ostream &operator<<(std::ostream &out, const ada::url &u);
 }  // namespace ada
 
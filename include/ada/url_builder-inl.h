@@ -0,0 +1,63 @@
+/**
+ * @file url_builder-inl.h
+ * @brief Inline declarations for the URL builder.
+ */
+#ifndef ADA_URL_BUILDER_INL_H
+#define ADA_URL_BUILDER_INL_H
+
+#include "ada/scheme-inl.h"
+#include "ada/url_builder.h"
+
+namespace ada {
+
+inline url_builder &url_builder::set_scheme(std::string_view input) noexcept {
+  scheme = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_scheme(
+    ada::scheme::type input) noexcept {
+  scheme = input == ada::scheme::NOT_SPECIAL
+               ? std::string_view()
+               : ada::scheme::details::is_special_list[int(input)];
+  return *this;
+}
+
+inline url_builder &url_builder::set_username(std::string_view input) noexcept {
+  username = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_password(std::string_view input) noexcept {
+  password = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_host(std::string_view input) noexcept {
+  host = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_port(uint16_t input) noexcept {
+  port = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_pathname(std::string_view input) noexcept {
+  pathname = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_search(std::string_view input) noexcept {
+  search = input;
+  return *this;
+}
+
+inline url_builder &url_builder::set_hash(std::string_view input) noexcept {
+  hash = input;
+  return *this;
+}
+
+}  // namespace ada
+
+#endif  // ADA_URL_BUILDER_INL_H
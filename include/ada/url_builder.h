@@ -0,0 +1,120 @@
+/**
+ * @file url_builder.h
+ * @brief Declaration for the URL builder.
+ */
+#ifndef ADA_URL_BUILDER_H
+#define ADA_URL_BUILDER_H
+
+#include "ada/common_defs.h"
+#include "ada/implementation.h"
+#include "ada/scheme.h"
+#include "ada/url_aggregator.h"
+#include "ada/url_components.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ada {
+
+/**
+ * @brief Builds a url_aggregator from its components.
+ *
+ * @details Each component is validated and percent-encoded with the rules the
+ * parser applies to it: the host goes through the host parser (IDNA, IPv4,
+ * IPv6 or opaque host), the path through the path parser (dot segments are
+ * resolved), and so forth. The href is written once, into a buffer that is
+ * reserved up front, without going through the URL state machine.
+ *
+ * The components are recorded as views: the strings they refer to must
+ * outlive the call to build(). The path segments and the search parameters
+ * are encoded, and copied, as they are appended.
+ *
+ * @code
+ * auto url = ada::url_builder()
+ *                .set_scheme(ada::scheme::HTTPS)
+ *                .set_host("example.com")
+ *                .append_path_segment("a b")
+ *                .append_search_param("q", "x&y")
+ *                .build();
+ * // https://example.com/a%20b?q=x%26y
+ * @endcode
+ */
+class url_builder {
+ public:
+  url_builder() = default;
+  url_builder(const url_builder &u) = default;
+  url_builder(url_builder &&u) noexcept = default;
+  url_builder &operator=(url_builder &&u) noexcept = default;
+  url_builder &operator=(const url_builder &u) = default;
+  ~url_builder() = default;
+
+  /**
+   * The scheme, with or without the trailing ':'. It is lowercased.
+   */
+  inline url_builder &set_scheme(std::string_view input) noexcept;
+  /**
+   * One of the special schemes, e.g., ada::scheme::HTTPS.
+   */
+  inline url_builder &set_scheme(ada::scheme::type input) noexcept;
+  inline url_builder &set_username(std::string_view input) noexcept;
+  inline url_builder &set_password(std::string_view input) noexcept;
+  /**
+   * The host, without the port. An IPv6 address must be within brackets.
+   * A URL with a special scheme other than "file" needs a non-empty host.
+   */
+  inline url_builder &set_host(std::string_view input) noexcept;
+  /**
+   * The port is omitted from the href when it is the default port of the
+   * scheme.
+   */
+  inline url_builder &set_port(uint16_t input) noexcept;
+  /**
+   * The path, as given to the pathname setter. The path segments, if any,
+   * are appended to it. In an opaque path (e.g., "mailto:a@b.c"), '?' and
+   * '#' are percent-encoded, so that the href parses to the same URL.
+   */
+  inline url_builder &set_pathname(std::string_view input) noexcept;
+  /**
+   * Appends a segment to the path. The segment is percent-encoded, including
+   * '%', '/' and '\', so that it remains a single segment.
+   */
+  url_builder &append_path_segment(std::string_view input);
+  /**
+   * The query, as given to the search setter. The search parameters, if any,
+   * are appended to it.
+   */
+  inline url_builder &set_search(std::string_view input) noexcept;
+  /**
+   * Appends a parameter to the query, encoded as in
+   * application/x-www-form-urlencoded serialization.
+   * @see https://url.spec.whatwg.org/#concept-urlencoded-serializer
+   */
+  url_builder &append_search_param(std::string_view key,
+                                   std::string_view value);
+  inline url_builder &set_hash(std::string_view input) noexcept;
+
+  /**
+   * Returns the URL made of the components, or an error if one of them is
+   * invalid (e.g., an invalid scheme or host, or credentials without a host).
+   */
+  [[nodiscard]] ada::result<url_aggregator> build() const;
+
+ private:
+  std::string_view scheme{};
+  std::string_view username{};
+  std::string_view password{};
+  std::optional<std::string_view> host{};
+  uint32_t port{url_components::omitted};
+  std::string_view pathname{};
+  std::string_view search{};
+  std::string_view hash{};
+  // Encoded segments, each one starts with '/'.
+  std::string path_segments{};
+  // Encoded parameters, separated by '&'.
+  std::string search_params{};
+};  // class url_builder
+
+}  // namespace ada
+
+#endif  // ADA_URL_BUILDER_H
@@ -0,0 +1,212 @@
+/**
+ * @file url_pattern.h
+ * @brief Declaration for the URL patterns, following the URLPattern
+ * standard, and for the sets of URL patterns used to route URLs.
+ */
+#ifndef ADA_URL_PATTERN_H
+#define ADA_URL_PATTERN_H
+
+#include "ada/common_defs.h"
+#include "ada/implementation.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ada {
+
+struct url_aggregator;
+
+/**
+ * The components of a URL matched by a URL pattern.
+ */
+enum class url_pattern_component : uint8_t {
+  PROTOCOL,
+  USERNAME,
+  PASSWORD,
+  HOSTNAME,
+  PORT,
+  PATHNAME,
+  SEARCH,
+  HASH,
+};
+
+/**
+ * The patterns of the components of a URL pattern, e.g.,
+ * {.hostname = "*.example.com", .pathname = "/users/:id"}. The components
+ * that are not set match any value, as "*".
+ *
+ * @see https://urlpattern.spec.whatwg.org/#dictdef-urlpatterninit
+ */
+struct url_pattern_init {
+  std::optional<std::string> protocol{};
+  std::optional<std::string> username{};
+  std::optional<std::string> password{};
+  std::optional<std::string> hostname{};
+  std::optional<std::string> port{};
+  std::optional<std::string> pathname{};
+  std::optional<std::string> search{};
+  std::optional<std::string> hash{};
+};
+
+/**
+ * The groups captured by a URL pattern matching a URL: views into the URL
+ * (the values) and into the pattern (the names). The result must not outlive
+ * the URL and the pattern, nor survive a modification of the URL.
+ */
+struct url_pattern_result {
+  /** The maximal number of groups of a URL pattern. */
+  static constexpr size_t max_groups = 32;
+
+  struct group {
+    url_pattern_component component{url_pattern_component::PROTOCOL};
+    /** The name of the group: ":id" is "id", the wildcards are numbered. */
+    std::string_view name{};
+    /** The value of the group, if it participated in the match. */
+    std::optional<std::string_view> value{};
+  };
+
+  /**
+   * The value of the group with the given name in the component, if the
+   * group exists and participated in the match.
+   */
+  [[nodiscard]] std::optional<std::string_view> get(
+      url_pattern_component component, std::string_view name) const noexcept;
+
+  group groups[max_groups]{};
+  size_t group_count{0};
+};
+
+/**
+ * A URL pattern, compiled into one matcher per component: URLs are matched
+ * against the components returned by the getters of ada::url_aggregator,
+ * without copy and without regular expression engine. Matching allocates
+ * only for a value repeated more than 16 times (e.g., ":path+" against a
+ * path of many segments) and for a match taking more than 1024 steps, whose
+ * failures are then memoized (see test()).
+ *
+ * The patterns follow the syntax of the URLPattern standard: fixed text,
+ * named groups (":id", matching a segment: up to the next '/' in a pathname,
+ * to the next '.' in a hostname), wildcards ("*"), groupings ("{www.}?"),
+ * the modifiers '?', '*' and '+', and escapes ("\\*"). The regular
+ * expression groups are not supported, except "(.*)" which is a wildcard:
+ * patterns using other regular expressions are rejected. The fixed text is
+ * canonicalized as in the URLs it is matched against: the protocol and the
+ * hostname are lowercased, the non-ASCII labels of the hostname are
+ * converted to punycode, and the other components are percent-encoded
+ * ("/café" matches "/caf%C3%A9"). A pattern whose hostname has an invalid
+ * label is rejected.
+ *
+ * @see https://urlpattern.spec.whatwg.org/
+ */
+struct url_pattern {
+  url_pattern(const url_pattern &other);
+  url_pattern(url_pattern &&other) noexcept;
+  url_pattern &operator=(const url_pattern &other);
+  url_pattern &operator=(url_pattern &&other) noexcept;
+  ~url_pattern();
+
+  /**
+   * After 1024 steps, the matcher memoizes the states that failed, so that
+   * matching a component is polynomial in its size (the memo takes up to 8
+   * MiB). It gives up, reporting no match, after 2^24 steps.
+   *
+   * @return whether the URL matches the pattern.
+   * @see https://urlpattern.spec.whatwg.org/#dom-urlpattern-test
+   */
+  [[nodiscard]] bool test(const ada::url_aggregator &url) const;
+
+  /**
+   * Matches as test() does.
+   *
+   * @return the groups captured by the pattern, if the URL matches.
+   * @see https://urlpattern.spec.whatwg.org/#dom-urlpattern-exec
+   */
+  [[nodiscard]] std::optional<url_pattern_result> exec(
+      const ada::url_aggregator &url) const;
+
+  /** @return the pattern of the component, e.g., "/users/:id". */
+  [[nodiscard]] std::string_view get_component(
+      url_pattern_component component) const noexcept;
+
+  /**
+   * @return the hostname matched by the pattern, if the pattern of the
+   * hostname is fixed text.
+   */
+  [[nodiscard]] std::optional<std::string_view> get_fixed_hostname()
+      const noexcept;
+
+ private:
+  struct compiled;
+  explicit url_pattern(std::unique_ptr<compiled> pattern) noexcept;
+  std::unique_ptr<compiled> data;
+
+  friend ada::result<url_pattern> parse_url_pattern(
+      const url_pattern_init &init);
+  friend struct url_pattern_set;
+};
+
+/**
+ * Compiles a URL pattern from the patterns of its components.
+ */
+ada_warn_unused ada::result<url_pattern> parse_url_pattern(
+    const url_pattern_init &init);
+
+/**
+ * Compiles a URL pattern from a string such as
+ * "https://:subdomain.example.com/users/:id". The components that follow the
+ * last component present in the string match any value, the components that
+ * precede it match the empty string, except the username and the password
+ * which match any value.
+ *
+ * @see https://urlpattern.spec.whatwg.org/#constructor-string-parsing
+ */
+ada_warn_unused ada::result<url_pattern> parse_url_pattern(
+    std::string_view input);
+
+/**
+ * An ordered set of URL patterns, e.g., the routes of a server: match()
+ * returns the first pattern, in the order of insertion, matching the URL.
+ * The patterns whose hostname is fixed text are indexed by hostname, so
+ * that a URL is only matched against the patterns of its hostname and the
+ * patterns accepting any hostname.
+ */
+struct url_pattern_set {
+  url_pattern_set();
+  url_pattern_set(url_pattern_set &&other) noexcept;
+  url_pattern_set &operator=(url_pattern_set &&other) noexcept;
+  url_pattern_set(const url_pattern_set &) = delete;
+  url_pattern_set &operator=(const url_pattern_set &) = delete;
+  ~url_pattern_set();
+
+  /** Adds a pattern: @return its index, the number of patterns before it. */
+  size_t add(url_pattern pattern);
+
+  /** @return the index of the first pattern matching the URL, if any. */
+  [[nodiscard]] std::optional<size_t> match(
+      const ada::url_aggregator &url) const;
+
+  /**
+   * @return the index of the first pattern matching the URL and its groups,
+   * if any.
+   */
+  [[nodiscard]] std::optional<std::pair<size_t, url_pattern_result>> exec(
+      const ada::url_aggregator &url) const;
+
+  /** @return the pattern at the given index. */
+  [[nodiscard]] const url_pattern &operator[](size_t index) const noexcept;
+
+  /** @return the number of patterns. */
+  [[nodiscard]] size_t size() const noexcept;
+
+ private:
+  struct index;
+  std::unique_ptr<index> data;
+};
+
+}  // namespace ada
+
+#endif  // ADA_URL_PATTERN_H
@@ -7,10 +7,12 @@
 
 #include "ada.h"
 #include "ada/character_sets-inl.h"
+#include "ada/helpers.h"
 #include "ada/unicode.h"
 #include "ada/url_search_params.h"
 
 #include <algorithm>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -31,40 +33,85 @@ inline void url_search_params::initialize(std::string_view input) {
   if (!input.empty() && input.front() == '?') {
     input.remove_prefix(1);
   }
+  if (input.empty()) {
+    return;
+  }
+
+  // A single pass locates every '&' and '=' and every byte that requires
+  // decoding ('+' or '%'). Short inputs do not need a heap allocation.
+  constexpr size_t stack_words = 16;
+  const size_t words = (input.size() + 31) / 32;
+  uint32_t stack_index[2 * stack_words];
+  std::unique_ptr<uint32_t[]> heap_index{};
+  uint32_t *structural = stack_index;
+  if (words > stack_words) {
+    heap_index.reset(new uint32_t[2 * words]);
+    structural = heap_index.get();
+  }
+  uint32_t *needs_decoding = structural + words;
+  helpers::index_form_urlencoded(input, structural, needs_decoding);
 
-  auto process_key_value = [&](const std::string_view current) {
-    auto equal = current.find('=');
+  // Returns true if input[start, end) contains a '+' or a '%'.
+  auto range_needs_decoding = [needs_decoding](size_t start, size_t end) {
+    if (start >= end) {
+      return false;
+    }
+    const size_t first = start / 32;
+    const size_t last = (end - 1) / 32;
+    const uint32_t first_mask = ~uint32_t(0) << (start % 32);
+    const uint32_t last_mask = ~uint32_t(0) >> (31 - (end - 1) % 32);
+    if (first == last) {
+      return (needs_decoding[first] & first_mask & last_mask) != 0;
+    }
+    if ((needs_decoding[first] & first_mask) != 0) {
+      return true;
+    }
+    for (size_t i = first + 1; i < last; i++) {
+      if (needs_decoding[i] != 0) {
+        return true;
+      }
+    }
+    return (needs_decoding[last] & last_mask) != 0;
+  };
+  // Segments without '+' or '%' are copied as is.
+  auto decode = [&](size_t start, size_t end) {
+    std::string_view segment = input.substr(start, end - start);
+    return range_needs_decoding(start, end)
+               ? unicode::percent_decode_form_urlencoded(segment)
+               : std::string(segment);
+  };
 
+  size_t start = 0;
+  size_t equal = std::string_view::npos;
+  auto add_parameter = [&](size_t end) {
+    if (end == start) {
+      return;
+    }
     if (equal == std::string_view::npos) {
-      std::string name(current);
-      std::replace(name.begin(), name.end(), '+', ' ');
-      params.emplace_back(unicode::percent_decode(name, name.find('%')), "");
+      params.emplace_back(decode(start, end), "");
     } else {
-      std::string name(current.substr(0, equal));
-      std::string value(current.substr(equal + 1));
-
-      std::replace(name.begin(), name.end(), '+', ' ');
-      std::replace(value.begin(), value.end(), '+', ' ');
-
-      params.emplace_back(unicode::percent_decode(name, name.find('%')),
-                          unicode::percent_decode(value, value.find('%')));
+      params.emplace_back(decode(start, equal), decode(equal + 1, end));
     }
   };
-
-  while (!input.empty()) {
-    auto ampersand_index = input.find('&');
-
-    if (ampersand_index == std::string_view::npos) {
-      if (!input.empty()) {
-        process_key_value(input);
+  for (size_t word = 0; word < words; word++) {
+    uint32_t bits = structural[word];
+    while (bits != 0) {
+      const size_t position =
+          word * 32 + size_t(helpers::trailing_zeroes(bits));
+      bits &= bits - 1;
+      if (input[position] == '=') {
+        // Only the first '=' splits the name from the value.
+        if (equal == std::string_view::npos) {
+          equal = position;
+        }
+        continue;
       }
-      break;
-    } else if (ampersand_index != 0) {
-      process_key_value(input.substr(0, ampersand_index));
+      add_parameter(position);
+      start = position + 1;
+      equal = std::string_view::npos;
     }
-
-    input.remove_prefix(ampersand_index + 1);
   }
+  add_parameter(input.size());
 }
 
 inline void url_search_params::append(const std::string_view key,
@@ -1,5 +1,7 @@
 #include "ada.h"
 #include "checkers.cpp"
+#include "stats.cpp"
+#include "trace.cpp"
 #include "unicode.cpp"
 #include "serializers.cpp"
 #include "implementation.cpp"
@@ -10,4 +12,11 @@
 #include "parser.cpp"
 #include "url_components.cpp"
 #include "url_aggregator.cpp"
+#include "url_builder.cpp"
+#include "origin.cpp"
+#include "hash.cpp"
+#include "public_suffix.cpp"
+#include "host_matcher.cpp"
+#include "url_pattern.cpp"
+#include "canonicalize.cpp"
 #include "ada_c.cpp"
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "ada.h"
+#include "ada/canonicalize.h"
+
+#include <cstring>
+#include <string>
+
+namespace ada::canonicalization {
+
+/**
+ * The unreserved characters of RFC 3986: ALPHA, DIGIT, '-', '.', '_' and
+ * '~'. Percent-decoding them never changes the meaning of a URL.
+ */
+static constexpr std::array<uint8_t, 256> is_unreserved = []() constexpr {
+  std::array<uint8_t, 256> result{};
+  for (int c = 'a'; c <= 'z'; c++) {
+    result[c] = result[c - 'a' + 'A'] = 1;
+  }
+  for (int c = '0'; c <= '9'; c++) {
+    result[c] = 1;
+  }
+  for (uint8_t c : {'-', '.', '_', '~'}) {
+    result[c] = 1;
+  }
+  return result;
+}();
+
+constexpr char to_upper_hex(char c) noexcept {
+  return (c >= 'a' && c <= 'f') ? char(c - 'a' + 'A') : c;
+}
+
+/**
+ * Copies buffer[read, end) to buffer[write, ...), normalizing the
+ * percent-encodings on the way. The write index never gets ahead of the
+ * read index: a percent-encoding is either kept (3 bytes) or decoded (1
+ * byte). Sets uppercased when a hexadecimal digit is uppercased.
+ */
+ada_really_inline void normalize_range(std::string &buffer, uint32_t &read,
+                                       uint32_t &write, uint32_t end,
+                                       const canonicalize_options &options,
+                                       bool &uppercased) {
+  char *data = buffer.data();
+  while (read < end) {
+    const void *found = std::memchr(data + read, '%', end - read);
+    const uint32_t percent =
+        found == nullptr ? end
+                         : uint32_t(static_cast<const char *>(found) - data);
+    if (write != read) {
+      std::memmove(data + write, data + read, percent - read);
+    }
+    write += percent - read;
+    read = percent;
+    if (read == end) {
+      return;
+    }
+    if (end - read < 3 || !unicode::is_ascii_hex_digit(data[read + 1]) ||
+        !unicode::is_ascii_hex_digit(data[read + 2])) {
+      // A '%' that does not start a percent-encoding is kept as is.
+      data[write++] = data[read++];
+      continue;
+    }
+    const char decoded =
+        char(unicode::convert_hex_to_binary(data[read + 1]) * 16 +
+             unicode::convert_hex_to_binary(data[read + 2]));
+    // A hexadecimal digit right after a '%' (or '%' and a digit) that does
+    // not start a percent-encoding stays encoded: "%%32%65" must not
+    // become the percent-encoding "%2e".
+    const bool creates_encoding =
+        unicode::is_ascii_hex_digit(decoded) && write > 0 &&
+        (data[write - 1] == '%' ||
+         (write > 1 && data[write - 2] == '%' &&
+          unicode::is_ascii_hex_digit(data[write - 1])));
+    if (options.decode_unreserved && is_unreserved[uint8_t(decoded)] &&
+        !creates_encoding) {
+      data[write++] = decoded;
+    } else if (options.uppercase_percent_encodings) {
+      const char high = to_upper_hex(data[read + 1]);
+      const char low = to_upper_hex(data[read + 2]);
+      uppercased |= high != data[read + 1] || low != data[read + 2];
+      data[write] = '%';
+      data[write + 1] = high;
+      data[write + 2] = low;
+      write += 3;
+    } else {
+      std::memmove(data + write, data + read, 3);
+      write += 3;
+    }
+    read += 3;
+  }
+}
+
+}  // namespace ada::canonicalization
+
+namespace ada {
+
+bool canonicalize(url_aggregator &url, const canonicalize_options &options) {
+  ada_log("canonicalize ", url.buffer);
+  if (!url.is_valid) {
+    return false;
+  }
+  ADA_ASSERT_TRUE(url.validate());
+  std::string &buffer = url.buffer;
+  url_components &components = url.components;
+  const auto size = uint32_t(buffer.size());
+  const uint32_t query_end = components.hash_start == url_components::omitted
+                                 ? size
+                                 : components.hash_start;
+  const bool removes_query =
+      options.remove_empty_query &&
+      components.search_start != url_components::omitted &&
+      components.search_start + 1 == query_end;
+  const bool removes_fragment =
+      options.remove_empty_fragment &&
+      components.hash_start != url_components::omitted &&
+      components.hash_start + 1 == size;
+  const bool normalizes = (options.decode_unreserved ||
+                           options.uppercase_percent_encodings) &&
+                          std::memchr(buffer.data() + components.protocol_end,
+                                      '%', size - components.protocol_end) !=
+                              nullptr;
+  bool changed = false;
+  bool uppercased = false;
+  if (normalizes || removes_query || removes_fragment) {
+    // The components start in the order of the href: each one moves by the
+    // number of bytes removed before it.
+    uint32_t *boundaries[] = {&components.username_end, &components.host_start,
+                              &components.host_end, &components.pathname_start,
+                              &components.search_start, &components.hash_start};
+    uint32_t read = components.protocol_end;
+    uint32_t write = read;
+    auto advance_to = [&](uint32_t end) {
+      if (normalizes) {
+        canonicalization::normalize_range(buffer, read, write, end, options,
+                                          uppercased);
+        return;
+      }
+      if (write != read) {
+        std::memmove(buffer.data() + write, buffer.data() + read, end - read);
+      }
+      write += end - read;
+      read = end;
+    };
+    for (uint32_t *boundary : boundaries) {
+      if (*boundary == url_components::omitted) {
+        continue;
+      }
+      advance_to(*boundary);
+      if ((boundary == &components.search_start && removes_query) ||
+          (boundary == &components.hash_start && removes_fragment)) {
+        // We skip the '?' or the '#'.
+        *boundary = url_components::omitted;
+        read++;
+      } else {
+        *boundary = write;
+      }
+    }
+    advance_to(size);
+    buffer.resize(write);
+    changed = write != size || uppercased;
+    if (removes_query || removes_fragment) {
+      // As the setters, an opaque path loses its trailing spaces.
+      helpers::strip_trailing_spaces_from_opaque_path(url);
+    }
+  }
+  if (options.sort_query && url.has_search()) {
+    const std::string query(url.get_search());
+    url.sort_search_params();
+    changed = changed || url.get_search() != query;
+  }
+  ADA_ASSERT_TRUE(url.validate());
+  return changed;
+}
+
+}  // namespace ada
@@ -0,0 +1,233 @@
+#include "ada.h"
+#include "ada/hash.h"
+
+#include <charconv>
+#include <cstring>
+#include <string_view>
+
+namespace ada::hashing {
+
+/**
+ * A streaming 64-bit hash function: the input is consumed in blocks of 16
+ * bytes, split in two independent lanes of 8 bytes, so that the
+ * multiplications of the two lanes overlap. Hashing a string in one call or
+ * in several pieces gives the same value.
+ */
+struct hasher {
+  static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+  static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+  static constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+
+  void update(std::string_view input) noexcept {
+    const char *data = input.data();
+    size_t size = input.size();
+    length += size;
+    if (pending_size > 0) {
+      size_t missing = block_size - pending_size;
+      if (size < missing) {
+        std::memcpy(pending + pending_size, data, size);
+        pending_size += size;
+        return;
+      }
+      std::memcpy(pending + pending_size, data, missing);
+      consume(pending);
+      pending_size = 0;
+      data += missing;
+      size -= missing;
+    }
+    for (; size >= block_size; data += block_size, size -= block_size) {
+      consume(data);
+    }
+    if (size > 0) {
+      std::memcpy(pending, data, size);
+      pending_size = size;
+    }
+  }
+
+  void update(char c) noexcept { update(std::string_view(&c, 1)); }
+
+  [[nodiscard]] uint64_t finish() noexcept {
+    if (pending_size > 0) {
+      std::memset(pending + pending_size, 0, block_size - pending_size);
+      consume(pending);
+    }
+    uint64_t h = rotate(lane1, 1) + rotate(lane2, 7);
+    h ^= length * prime3;
+    // Final avalanche (MurmurHash3).
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+ private:
+  static constexpr size_t block_size = 16;
+
+  static uint64_t rotate(uint64_t x, int r) noexcept {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  static uint64_t round(uint64_t lane, uint64_t word) noexcept {
+    return rotate(lane + word * prime2, 31) * prime1;
+  }
+
+  void consume(const char *block) noexcept {
+    uint64_t word1, word2;
+    std::memcpy(&word1, block, sizeof(word1));
+    std::memcpy(&word2, block + sizeof(word1), sizeof(word2));
+    lane1 = round(lane1, word1);
+    lane2 = round(lane2, word2);
+  }
+
+  uint64_t lane1{prime1 + prime2};
+  uint64_t lane2{prime2};
+  uint64_t length{0};
+  char pending[block_size]{};
+  size_t pending_size{0};
+};
+
+[[nodiscard]] size_t hash_string(std::string_view input) noexcept {
+  hasher h;
+  h.update(input);
+  return size_t(h.finish());
+}
+
+[[nodiscard]] std::string_view hostname(const ada::url &url) noexcept {
+  return url.host.has_value() ? std::string_view(*url.host)
+                              : std::string_view();
+}
+
+}  // namespace ada::hashing
+
+namespace ada {
+
+size_t hash(const ada::url_aggregator &url, hash_options options) {
+  const url_components &components = url.get_components();
+  std::string_view href = url.get_href();
+  switch (options) {
+    case hash_options::HREF:
+      return hashing::hash_string(href);
+    case hash_options::HREF_WITHOUT_FRAGMENT:
+      if (components.hash_start != url_components::omitted) {
+        href = href.substr(0, components.hash_start);
+      }
+      return hashing::hash_string(href);
+    case hash_options::ORIGIN:
+      return ada::origin::from(url).hash();
+    case hash_options::HOST:
+      return hashing::hash_string(url.get_hostname());
+  }
+  ada::unreachable();
+}
+
+size_t hash(const ada::url &url, hash_options options) {
+  switch (options) {
+    case hash_options::HREF:
+    case hash_options::HREF_WITHOUT_FRAGMENT: {
+      // We feed the serialization of the URL to the hasher, piece by piece,
+      // as url::get_href() would build it.
+      hashing::hasher h;
+      if (url.is_special()) {
+        h.update(ada::scheme::details::is_special_list[url.type]);
+      } else {
+        h.update(url.non_special_scheme);
+      }
+      h.update(':');
+      if (url.host.has_value()) {
+        h.update("//");
+        if (url.has_credentials()) {
+          h.update(url.username);
+          if (!url.password.empty()) {
+            h.update(':');
+            h.update(url.password);
+          }
+          h.update('@');
+        }
+        h.update(*url.host);
+        if (url.port.has_value()) {
+          char digits[5];
+          auto r = std::to_chars(digits, digits + sizeof(digits), *url.port);
+          h.update(':');
+          h.update(std::string_view(digits, size_t(r.ptr - digits)));
+        }
+      } else if (!url.has_opaque_path &&
+                 checkers::begins_with(url.path, "//")) {
+        h.update("/.");
+      }
+      h.update(url.path);
+      if (url.query.has_value()) {
+        h.update('?');
+        h.update(*url.query);
+      }
+      if (options == hash_options::HREF && url.hash.has_value()) {
+        h.update('#');
+        h.update(*url.hash);
+      }
+      return size_t(h.finish());
+    }
+    case hash_options::ORIGIN:
+      return ada::origin::from(url).hash();
+    case hash_options::HOST:
+      return hashing::hash_string(hashing::hostname(url));
+  }
+  ada::unreachable();
+}
+
+bool equals(const ada::url_aggregator &a, const ada::url_aggregator &b,
+            hash_options options) {
+  const url_components &x = a.get_components();
+  const url_components &y = b.get_components();
+  switch (options) {
+    case hash_options::HREF:
+    case hash_options::HREF_WITHOUT_FRAGMENT: {
+      std::string_view href_a = a.get_href();
+      std::string_view href_b = b.get_href();
+      if (options == hash_options::HREF_WITHOUT_FRAGMENT) {
+        if (x.hash_start != url_components::omitted) {
+          href_a = href_a.substr(0, x.hash_start);
+        }
+        if (y.hash_start != url_components::omitted) {
+          href_b = href_b.substr(0, y.hash_start);
+        }
+      } else if (x.hash_start != y.hash_start) {
+        return false;
+      }
+      // Equal URLs have equal offsets: comparing them first is cheap and
+      // rejects most of the URLs sharing a long prefix.
+      return href_a.size() == href_b.size() &&
+             x.protocol_end == y.protocol_end &&
+             x.username_end == y.username_end &&
+             x.host_start == y.host_start && x.host_end == y.host_end &&
+             x.port == y.port && x.pathname_start == y.pathname_start &&
+             x.search_start == y.search_start && href_a == href_b;
+    }
+    case hash_options::ORIGIN:
+      return ada::origin::from(a) == ada::origin::from(b);
+    case hash_options::HOST:
+      return a.get_hostname() == b.get_hostname();
+  }
+  ada::unreachable();
+}
+
+bool equals(const ada::url &a, const ada::url &b, hash_options options) {
+  switch (options) {
+    case hash_options::HREF:
+    case hash_options::HREF_WITHOUT_FRAGMENT:
+      return a.type == b.type && a.port == b.port &&
+             a.has_opaque_path == b.has_opaque_path &&
+             (a.is_special() || a.non_special_scheme == b.non_special_scheme) &&
+             a.host == b.host && a.path == b.path && a.query == b.query &&
+             a.username == b.username && a.password == b.password &&
+             (options == hash_options::HREF_WITHOUT_FRAGMENT ||
+              a.hash == b.hash);
+    case hash_options::ORIGIN:
+      return ada::origin::from(a) == ada::origin::from(b);
+    case hash_options::HOST:
+      return hashing::hostname(a) == hashing::hostname(b);
+  }
+  ada::unreachable();
+}
+
+}  // namespace ada
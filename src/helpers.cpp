@@ -4,6 +4,7 @@
 #include "ada/scheme.h"
 
 #include <algorithm>
+#include <array>
 #include <charconv>
 #include <cstring>
 #include <sstream>
@@ -98,21 +99,22 @@ ada_really_inline std::optional<std::string_view> prune_hash(
 
 ada_really_inline bool shorten_path(std::string& path,
                                     ada::scheme::type type) noexcept {
-  size_t first_delimiter = path.find_first_of('/', 1);
+  // We only look at the last item of the path, which we remove: each byte of
+  // the path is thus visited once when it is appended, and once when it is
+  // removed, so that normalizing a path takes linear time however many dot
+  // segments it has. Looking for the first delimiter would make it quadratic.
+  size_t last_delimiter = path.rfind('/');
 
   // Let path be url's path.
   // If url's scheme is "file", path's size is 1, and path[0] is a normalized
   // Windows drive letter, then return.
-  if (type == ada::scheme::type::FILE &&
-      first_delimiter == std::string_view::npos && !path.empty()) {
-    if (checkers::is_normalized_windows_drive_letter(
-            helpers::substring(path, 1))) {
-      return false;
-    }
+  if (type == ada::scheme::type::FILE && last_delimiter == 0 &&
+      checkers::is_normalized_windows_drive_letter(
+          helpers::substring(path, 1))) {
+    return false;
   }
 
   // Remove path's last item, if any.
-  size_t last_delimiter = path.rfind('/');
   if (last_delimiter != std::string::npos) {
     path.erase(last_delimiter);
     return true;
@@ -123,26 +125,22 @@ ada_really_inline bool shorten_path(std::string& path,
 
 ada_really_inline bool shorten_path(std::string_view& path,
                                     ada::scheme::type type) noexcept {
-  size_t first_delimiter = path.find_first_of('/', 1);
+  // As above, we only look at the last item of the path.
+  size_t last_delimiter = path.rfind('/');
 
   // Let path be url's path.
   // If url's scheme is "file", path's size is 1, and path[0] is a normalized
   // Windows drive letter, then return.
-  if (type == ada::scheme::type::FILE &&
-      first_delimiter == std::string_view::npos && !path.empty()) {
-    if (checkers::is_normalized_windows_drive_letter(
-            helpers::substring(path, 1))) {
-      return false;
-    }
+  if (type == ada::scheme::type::FILE && last_delimiter == 0 &&
+      checkers::is_normalized_windows_drive_letter(
+          helpers::substring(path, 1))) {
+    return false;
   }
 
   // Remove path's last item, if any.
-  if (!path.empty()) {
-    size_t slash_loc = path.rfind('/');
-    if (slash_loc != std::string_view::npos) {
-      path.remove_suffix(path.size() - slash_loc);
-      return true;
-    }
+  if (last_delimiter != std::string_view::npos) {
+    path.remove_suffix(path.size() - last_delimiter);
+    return true;
   }
 
   return false;
@@ -172,20 +170,6 @@ ada_really_inline void resize(std::string_view& input, size_t pos) noexcept {
   input.remove_suffix(input.size() - pos);
 }
 
-// computes the number of trailing zeroes
-// this is a private inline function only defined in this source file.
-ada_really_inline int trailing_zeroes(uint32_t input_num) noexcept {
-#ifdef ADA_REGULAR_VISUAL_STUDIO
-  unsigned long ret;
-  // Search the mask data from least significant bit (LSB)
-  // to the most significant bit (MSB) for a set bit (1).
-  _BitScanForward(&ret, input_num);
-  return (int)ret;
-#else   // ADA_REGULAR_VISUAL_STUDIO
-  return __builtin_ctzl(input_num);
-#endif  // ADA_REGULAR_VISUAL_STUDIO
-}
-
 // starting at index location, this finds the next location of a character
 // :, /, \\, ? or [. If none is found, view.size() is returned.
 // For use within get_host_delimiter_location.
@@ -628,6 +612,7 @@ ada_really_inline void parse_prepared_path(std::string_view input,
       if (new_location == std::string_view::npos) {
         std::string_view path_view = input.substr(previous_location);
         if (path_view == "..") {  // The path ends with ..
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
           // e.g., if you receive ".." with an empty path, you go to "/".
           if (path.empty()) {
             path = '/';
@@ -645,6 +630,8 @@ ada_really_inline void parse_prepared_path(std::string_view input,
         path += '/';
         if (path_view != ".") {
           path.append(path_view);
+        } else {
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         }
         return;
       } else {
@@ -653,6 +640,7 @@ ada_really_inline void parse_prepared_path(std::string_view input,
             input.substr(previous_location, new_location - previous_location);
         previous_location = new_location + 1;
         if (path_view == "..") {
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
           size_t last_delimiter = path.rfind('/');
           if (last_delimiter != std::string::npos) {
             path.erase(last_delimiter);
@@ -660,6 +648,8 @@ ada_really_inline void parse_prepared_path(std::string_view input,
         } else if (path_view != ".") {
           path += '/';
           path.append(path_view);
+        } else {
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         }
       }
     } while (true);
@@ -667,6 +657,9 @@ ada_really_inline void parse_prepared_path(std::string_view input,
     ada_log("parse_path slow");
     // we have reached the general case
     bool needs_percent_encoding = (accumulator & 1);
+    if (needs_percent_encoding) {
+      ada_stats_count(ada::stats::counter::PATH_PERCENT_ENCODING);
+    }
     std::string path_buffer_tmp;
     do {
       size_t location = (special && (accumulator & 2))
@@ -686,12 +679,14 @@ ada_really_inline void parse_prepared_path(std::string_view input,
               ? path_buffer_tmp
               : path_view;
       if (unicode::is_double_dot_path_segment(path_buffer)) {
+        ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         if ((helpers::shorten_path(path, type) || special) &&
             location == std::string_view::npos) {
           path += '/';
         }
       } else if (unicode::is_single_dot_path_segment(path_buffer) &&
                  (location == std::string_view::npos)) {
+        ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         path += '/';
       }
       // Otherwise, if path_buffer is not a single-dot path segment, then:
@@ -711,6 +706,8 @@ ada_really_inline void parse_prepared_path(std::string_view input,
           path += '/';
           path.append(path_buffer);
         }
+      } else {
+        ada_stats_count(ada::stats::counter::DOT_SEGMENT);
       }
       if (location == std::string_view::npos) {
         return;
@@ -785,6 +782,88 @@ find_authority_delimiter(std::string_view view) noexcept {
   return size_t(view.size());
 }
 
+// '&' and '=' are structural (1), '+' and '%' need decoding (2).
+static constexpr std::array<uint8_t, 256> form_urlencoded_classes =
+    []() constexpr {
+      std::array<uint8_t, 256> result{};
+      result['&'] = 1;
+      result['='] = 1;
+      result['+'] = 2;
+      result['%'] = 2;
+      return result;
+    }();
+
+void index_form_urlencoded(std::string_view input, uint32_t* structural,
+                           uint32_t* needs_decoding) noexcept {
+  ada_log("helpers::index_form_urlencoded ", input);
+  size_t i = 0;
+#if ADA_NEON
+  auto to_bitmask = [](uint8x16_t mask) -> uint32_t {
+    uint8x16_t bit_mask =
+        ada_make_uint8x16_t(0x01, 0x02, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80, 0x01,
+                            0x02, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80);
+    uint8x16_t minput = vandq_u8(mask, bit_mask);
+    uint8x16_t tmp = vpaddq_u8(minput, minput);
+    tmp = vpaddq_u8(tmp, tmp);
+    tmp = vpaddq_u8(tmp, tmp);
+    return vgetq_lane_u16(vreinterpretq_u16_u8(tmp), 0);
+  };
+  const uint8x16_t ampersand = vmovq_n_u8('&');
+  const uint8x16_t equal = vmovq_n_u8('=');
+  const uint8x16_t plus = vmovq_n_u8('+');
+  const uint8x16_t percent = vmovq_n_u8('%');
+  for (; i + 32 <= input.size(); i += 32) {
+    uint8x16_t low = vld1q_u8((const uint8_t*)input.data() + i);
+    uint8x16_t high = vld1q_u8((const uint8_t*)input.data() + i + 16);
+    structural[i / 32] =
+        to_bitmask(vorrq_u8(vceqq_u8(low, ampersand), vceqq_u8(low, equal))) |
+        to_bitmask(vorrq_u8(vceqq_u8(high, ampersand), vceqq_u8(high, equal)))
+            << 16;
+    needs_decoding[i / 32] =
+        to_bitmask(vorrq_u8(vceqq_u8(low, plus), vceqq_u8(low, percent))) |
+        to_bitmask(vorrq_u8(vceqq_u8(high, plus), vceqq_u8(high, percent)))
+            << 16;
+  }
+#elif ADA_SSE2
+  const __m128i ampersand = _mm_set1_epi8('&');
+  const __m128i equal = _mm_set1_epi8('=');
+  const __m128i plus = _mm_set1_epi8('+');
+  const __m128i percent = _mm_set1_epi8('%');
+  auto to_bitmask = [](__m128i mask) -> uint32_t {
+    return uint32_t(_mm_movemask_epi8(mask));
+  };
+  for (; i + 32 <= input.size(); i += 32) {
+    __m128i low = _mm_loadu_si128((const __m128i*)(input.data() + i));
+    __m128i high = _mm_loadu_si128((const __m128i*)(input.data() + i + 16));
+    structural[i / 32] =
+        to_bitmask(_mm_or_si128(_mm_cmpeq_epi8(low, ampersand),
+                                _mm_cmpeq_epi8(low, equal))) |
+        to_bitmask(_mm_or_si128(_mm_cmpeq_epi8(high, ampersand),
+                                _mm_cmpeq_epi8(high, equal)))
+            << 16;
+    needs_decoding[i / 32] =
+        to_bitmask(_mm_or_si128(_mm_cmpeq_epi8(low, plus),
+                                _mm_cmpeq_epi8(low, percent))) |
+        to_bitmask(_mm_or_si128(_mm_cmpeq_epi8(high, plus),
+                                _mm_cmpeq_epi8(high, percent)))
+            << 16;
+  }
+#endif
+  // Remaining bytes, or the whole input on systems without SIMD support.
+  for (; i < input.size(); i += 32) {
+    uint32_t structural_word = 0;
+    uint32_t needs_decoding_word = 0;
+    const size_t end = std::min(i + 32, input.size());
+    for (size_t j = i; j < end; j++) {
+      const uint8_t c = form_urlencoded_classes[uint8_t(input[j])];
+      structural_word |= uint32_t(c & 1) << (j - i);
+      needs_decoding_word |= uint32_t(c >> 1) << (j - i);
+    }
+    structural[i / 32] = structural_word;
+    needs_decoding[i / 32] = needs_decoding_word;
+  }
+}
+
 }  // namespace ada::helpers
 
 namespace ada {
@@ -0,0 +1,360 @@
+#include "ada.h"
+#include "ada/host_matcher.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ada {
+
+struct host_matcher::trie {
+  /** A label of a domain, the labels being read from right to left. */
+  struct node {
+    uint32_t label_offset;
+    uint32_t parent;
+    uint16_t label_length;
+    /** A combination of match_type, 0 if no domain ends at this node. */
+    uint8_t type;
+  };
+
+  /**
+   * A slot of the hash table of the edges: the child node (0 when the slot
+   * is empty: the root is never a child) and the high bits of the hash of
+   * the edge, so that most collisions are rejected without reading the node.
+   */
+  struct edge {
+    uint32_t child;
+    uint32_t tag;
+  };
+
+  std::vector<node> nodes{node{0, 0, 0, 0}};
+  std::vector<edge> edges = std::vector<edge>(16, edge{0, 0});
+  std::string labels{};
+  size_t domains{0};
+
+  /**
+   * The hash of the edge from the parent to its child with the given label.
+   * The labels are short: they are read 8 bytes at a time.
+   */
+  static ada_really_inline uint64_t edge_hash(uint32_t parent,
+                                              std::string_view label) noexcept {
+    constexpr uint64_t multiplier1 = 0x9E3779B97F4A7C15ULL;
+    constexpr uint64_t multiplier2 = 0xBF58476D1CE4E5B9ULL;
+    uint64_t h = ((uint64_t(parent) << 32) | label.size()) * multiplier1;
+    const char *data = label.data();
+    size_t size = label.size();
+    for (; size >= 8; data += 8, size -= 8) {
+      uint64_t word;
+      std::memcpy(&word, data, sizeof(word));
+      h = (h ^ word) * multiplier2;
+      h ^= h >> 29;
+    }
+    if (size > 0) {
+      uint64_t word = 0;
+      std::memcpy(&word, data, size);
+      h = (h ^ word) * multiplier2;
+      h ^= h >> 29;
+    }
+    h *= multiplier1;
+    return h ^ (h >> 32);
+  }
+
+  [[nodiscard]] ada_really_inline size_t mask() const noexcept {
+    return edges.size() - 1;
+  }
+
+  /**
+   * Returns the first slot, from the given slot, that is empty or whose tag
+   * is the tag of the hash.
+   */
+  [[nodiscard]] ada_really_inline size_t probe(size_t slot,
+                                               uint64_t hash) const noexcept {
+    const uint32_t tag = uint32_t(hash >> 32);
+    while (edges[slot].child != 0 && edges[slot].tag != tag) {
+      slot = (slot + 1) & mask();
+    }
+    return slot;
+  }
+
+  /** Whether the node is the child of the parent with the given label. */
+  [[nodiscard]] ada_really_inline bool is_edge(
+      uint32_t child, uint32_t parent, std::string_view label) const noexcept {
+    const node &candidate = nodes[child];
+    return candidate.parent == parent &&
+           candidate.label_length == label.size() &&
+           std::memcmp(labels.data() + candidate.label_offset, label.data(),
+                       label.size()) == 0;
+  }
+
+  /**
+   * Returns the child of the node with the given label: 0 if there is none.
+   */
+  [[nodiscard]] ada_really_inline uint32_t find(
+      uint32_t parent, std::string_view label, uint64_t hash) const noexcept {
+    for (size_t slot = probe(hash & mask(), hash); edges[slot].child != 0;
+         slot = probe((slot + 1) & mask(), hash)) {
+      if (is_edge(edges[slot].child, parent, label)) {
+        return edges[slot].child;
+      }
+    }
+    return 0;
+  }
+
+  void insert_edge(uint32_t child, uint64_t hash) noexcept {
+    size_t slot = hash & mask();
+    while (edges[slot].child != 0) {
+      slot = (slot + 1) & mask();
+    }
+    edges[slot] = edge{child, uint32_t(hash >> 32)};
+  }
+
+  /** Doubles the hash table, keeping its load factor under 1/2. */
+  void grow() {
+    std::vector<edge> previous(edges.size() * 2, edge{0, 0});
+    std::swap(previous, edges);
+    for (const edge &e : previous) {
+      if (e.child != 0) {
+        const node &n = nodes[e.child];
+        insert_edge(e.child,
+                    edge_hash(n.parent, std::string_view(
+                                            labels.data() + n.label_offset,
+                                            n.label_length)));
+      }
+    }
+  }
+
+  uint32_t add_child(uint32_t parent, std::string_view label) {
+    uint64_t hash = edge_hash(parent, label);
+    uint32_t child = find(parent, label, hash);
+    if (child != 0) {
+      return child;
+    }
+    if (2 * nodes.size() >= edges.size()) {
+      grow();
+    }
+    child = uint32_t(nodes.size());
+    nodes.push_back(node{uint32_t(labels.size()), parent,
+                         uint16_t(label.size()), 0});
+    labels.append(label);
+    insert_edge(child, hash);
+    return child;
+  }
+
+  /**
+   * The state of the lookup of a host: the host[0, end) prefix remains to be
+   * matched, below the given node.
+   */
+  struct lookup {
+    std::string_view host{};
+    size_t end{0};
+    uint32_t current{0};
+    // The label being matched, used by match_many.
+    std::string_view label_view{};
+    size_t label_start{0};
+    uint64_t hash{0};
+    size_t slot{0};
+
+    /**
+     * Prepares the lookup, returning false if the host cannot match.
+     */
+    ada_really_inline bool start(std::string_view input) noexcept {
+      if (!input.empty() && input.back() == '.') {
+        input.remove_suffix(1);
+      }
+      host = input;
+      end = input.size();
+      current = 0;
+      return !input.empty();
+    }
+
+    /** The next label, from right to left, and its start. */
+    ada_really_inline std::string_view label(size_t &start) const noexcept {
+      size_t dot = end == 0 ? std::string_view::npos : host.rfind('.', end - 1);
+      start = (dot == std::string_view::npos) ? 0 : dot + 1;
+      return host.substr(start, end - start);
+    }
+  };
+
+  /**
+   * Moves the lookup to the child, returning 1 (match), 0 (no match) or -1
+   * (undecided: the lookup continues with the next label).
+   */
+  [[nodiscard]] ada_really_inline int advance(
+      lookup &state, uint32_t child, size_t label_start) const noexcept {
+    if (child == 0) {
+      return 0;
+    }
+    const uint8_t type = nodes[child].type;
+    if (label_start == 0) {
+      return (type & host_matcher::EXACT) ? 1 : 0;
+    }
+    if (type & host_matcher::SUBDOMAINS) {
+      return 1;
+    }
+    state.current = child;
+    state.end = label_start - 1;
+    return -1;
+  }
+};
+
+host_matcher::host_matcher() : data(std::make_unique<trie>()) {}
+host_matcher::host_matcher(host_matcher &&other) noexcept = default;
+host_matcher &host_matcher::operator=(host_matcher &&other) noexcept = default;
+host_matcher::~host_matcher() = default;
+
+bool host_matcher::add(std::string_view domain, match_type type) {
+  if (domain.size() > 2 && domain[0] == '*' && domain[1] == '.') {
+    domain.remove_prefix(2);
+    type = SUBDOMAINS;
+  }
+  // Only a host: no credentials, port, path, query or fragment.
+  const bool is_ipv6 = !domain.empty() && domain.front() == '[';
+  if (domain.find_first_of(is_ipv6 ? "/\\?#@" : ":/\\?#@") !=
+      std::string_view::npos) {
+    return false;
+  }
+  auto url =
+      ada::parse<ada::url_aggregator>(helpers::concat("http://", domain));
+  if (!url || !url->has_hostname()) {
+    return false;
+  }
+  std::string_view hostname = url->get_hostname();
+  if (!hostname.empty() && hostname.back() == '.') {
+    hostname.remove_suffix(1);
+  }
+  // An empty label, as in "a..b", cannot match a canonical host.
+  if (hostname.empty() || hostname.front() == '.' ||
+      hostname.find("..") != std::string_view::npos) {
+    return false;
+  }
+  trie &t = *data;
+  uint32_t current = 0;
+  size_t end = hostname.size();
+  while (true) {
+    size_t dot =
+        end == 0 ? std::string_view::npos : hostname.rfind('.', end - 1);
+    size_t start = (dot == std::string_view::npos) ? 0 : dot + 1;
+    std::string_view label = hostname.substr(start, end - start);
+    if (label.size() > UINT16_MAX) {
+      return false;
+    }
+    current = t.add_child(current, label);
+    if (dot == std::string_view::npos) {
+      break;
+    }
+    end = dot;
+  }
+  if (t.nodes[current].type == 0) {
+    t.domains++;
+  }
+  t.nodes[current].type |= type;
+  return true;
+}
+
+bool host_matcher::match(std::string_view host) const noexcept {
+  const trie &t = *data;
+  trie::lookup lookup{};
+  if (!lookup.start(host)) {
+    return false;
+  }
+  while (true) {
+    size_t label_start;
+    std::string_view label = lookup.label(label_start);
+    uint32_t child =
+        t.find(lookup.current, label, trie::edge_hash(lookup.current, label));
+    int result = t.advance(lookup, child, label_start);
+    if (result >= 0) {
+      return result == 1;
+    }
+  }
+}
+
+bool host_matcher::match(const ada::url_aggregator &url) const noexcept {
+  return match(url.get_hostname());
+}
+
+void host_matcher::match_many(const std::string_view *hosts, size_t count,
+                              bool *results) const noexcept {
+  const trie &t = *data;
+  // The hosts are matched by groups, one label at a time, in stages: each
+  // stage prefetches what the next stage reads (the slot of the edge, the
+  // node, the label), for all the hosts of the group, so that the cache
+  // misses of the hosts overlap.
+  constexpr size_t group_size = 16;
+  trie::lookup lookups[group_size];
+  size_t active[group_size];
+  for (size_t base = 0; base < count; base += group_size) {
+    const size_t size = std::min(group_size, count - base);
+    size_t active_count = 0;
+    for (size_t i = 0; i < size; i++) {
+      results[base + i] = false;
+      if (lookups[i].start(hosts[base + i])) {
+        active[active_count++] = i;
+      }
+    }
+    while (active_count > 0) {
+      for (size_t j = 0; j < active_count; j++) {
+        trie::lookup &lookup = lookups[active[j]];
+        lookup.label_view = lookup.label(lookup.label_start);
+        lookup.hash = trie::edge_hash(lookup.current, lookup.label_view);
+        lookup.slot = lookup.hash & t.mask();
+        ada_prefetch(&t.edges[lookup.slot]);
+      }
+      for (size_t j = 0; j < active_count; j++) {
+        trie::lookup &lookup = lookups[active[j]];
+        lookup.slot = t.probe(lookup.slot, lookup.hash);
+        const trie::node &candidate = t.nodes[t.edges[lookup.slot].child];
+        ada_prefetch(&candidate);
+      }
+      for (size_t j = 0; j < active_count; j++) {
+        const trie::lookup &lookup = lookups[active[j]];
+        const trie::node &candidate = t.nodes[t.edges[lookup.slot].child];
+        ada_prefetch(t.labels.data() + candidate.label_offset);
+      }
+      size_t still_active = 0;
+      for (size_t j = 0; j < active_count; j++) {
+        const size_t i = active[j];
+        trie::lookup &lookup = lookups[i];
+        uint32_t child = t.edges[lookup.slot].child;
+        if (child != 0 &&
+            !t.is_edge(child, lookup.current, lookup.label_view)) {
+          // A collision of the tags: we resume the search.
+          child = t.find(lookup.current, lookup.label_view, lookup.hash);
+        }
+        int result = t.advance(lookup, child, lookup.label_start);
+        if (result < 0) {
+          active[still_active++] = i;
+        } else {
+          results[base + i] = result == 1;
+        }
+      }
+      active_count = still_active;
+    }
+  }
+}
+
+void host_matcher::match_many(const ada::url_aggregator *urls, size_t count,
+                              bool *results) const noexcept {
+  constexpr size_t group_size = 64;
+  std::string_view hosts[group_size];
+  for (size_t base = 0; base < count; base += group_size) {
+    const size_t size = std::min(group_size, count - base);
+    for (size_t i = 0; i < size; i++) {
+      hosts[i] = urls[base + i].get_hostname();
+    }
+    match_many(hosts, size, results + base);
+  }
+}
+
+size_t host_matcher::size() const noexcept { return data->domains; }
+
+size_t host_matcher::memory_usage() const noexcept {
+  return sizeof(trie) + data->nodes.capacity() * sizeof(trie::node) +
+         data->edges.capacity() * sizeof(trie::edge) +
+         data->labels.capacity();
+}
+
+}  // namespace ada
@@ -1,3 +1,4 @@
+#include <limits>
 #include <string_view>
 
 #include "ada.h"
@@ -24,6 +25,48 @@ template ada::result<url> parse<url>(std::string_view input,
 template ada::result<url_aggregator> parse<url_aggregator>(
     std::string_view input, const url_aggregator* base_url = nullptr);
 
+template <class result_type>
+ada_warn_unused tl::expected<result_type, ada::errors> parse(
+    std::u16string_view input, const result_type* base_url) {
+  // We refuse to parse URL strings that exceed 4GB, as the parser does.
+  if (input.size() > std::numeric_limits<uint32_t>::max()) {
+    return tl::unexpected(errors::generic_error);
+  }
+  // A code unit takes at most 3 bytes in UTF-8: a surrogate pair takes 4.
+  std::string buffer(input.size() * 3, '\0');
+  buffer.resize(unicode::utf16_to_url_input(input, buffer.data()));
+  return parse<result_type>(buffer, base_url);
+}
+
+template ada::result<url> parse<url>(std::u16string_view input,
+                                     const url* base_url = nullptr);
+template ada::result<url_aggregator> parse<url_aggregator>(
+    std::u16string_view input, const url_aggregator* base_url = nullptr);
+
+template <class result_type>
+ada_warn_unused tl::expected<result_type, ada::errors> parse_latin1(
+    std::string_view input, const result_type* base_url) {
+  // ASCII is valid UTF-8.
+  if (unicode::is_ascii(input)) {
+    return parse<result_type>(input, base_url);
+  }
+  if (input.size() > std::numeric_limits<uint32_t>::max()) {
+    return tl::unexpected(errors::generic_error);
+  }
+  std::string buffer(input.size() * 2, '\0');
+  buffer.resize(unicode::latin1_to_url_input(input, buffer.data()));
+  return parse<result_type>(buffer, base_url);
+}
+
+template ada::result<url> parse_latin1<url>(std::string_view input,
+                                            const url* base_url = nullptr);
+template ada::result<url_aggregator> parse_latin1<url_aggregator>(
+    std::string_view input, const url_aggregator* base_url = nullptr);
+
+size_t to_utf16(std::string_view input, char16_t* output) noexcept {
+  return unicode::utf8_to_utf16(input, output);
+}
+
 std::string href_from_file(std::string_view input) {
   // This is going to be much faster than constructing a URL.
   std::string tmp_buffer;
@@ -0,0 +1,158 @@
+#include "ada.h"
+#include "ada/origin.h"
+#include "ada/origin-inl.h"
+
+#include <string>
+#include <string_view>
+
+namespace ada {
+
+origin::origin(ada::scheme::type scheme_type, std::string_view host_view,
+               uint32_t port_value) noexcept
+    : host(host_view), port(port_value), type(scheme_type), opaque(false) {
+  // FNV-1a over the host, the scheme and the port.
+  uint64_t h = 14695981039346656037ULL;
+  for (const char c : host_view) {
+    h = (h ^ uint8_t(c)) * 1099511628211ULL;
+  }
+  h = (h ^ ((uint64_t(scheme_type) << 32) | port_value)) * 1099511628211ULL;
+  hash_value = size_t(h ^ (h >> 32));
+}
+
+origin origin::from(const ada::url_aggregator &url) {
+  ada_log("origin::from ", url.get_href());
+  if (url.is_special()) {
+    // Return a new opaque origin.
+    if (url.type == scheme::FILE) {
+      return origin();
+    }
+    return origin(url.type, url.get_hostname(), url.components.port);
+  }
+  if (url.get_protocol() == "blob:") {
+    return from_blob_path(url.get_pathname());
+  }
+  // Return a new opaque origin.
+  return origin();
+}
+
+origin origin::from(const ada::url &url) {
+  if (url.is_special()) {
+    // Return a new opaque origin.
+    if (url.type == scheme::FILE || !url.host.has_value()) {
+      return origin();
+    }
+    return origin(url.type, *url.host,
+                  url.port.has_value() ? uint32_t(*url.port)
+                                       : url_components::omitted);
+  }
+  if (url.non_special_scheme == "blob") {
+    return from_blob_path(url.path);
+  }
+  // Return a new opaque origin.
+  return origin();
+}
+
+std::optional<origin> origin::from_canonical_blob_path(
+    std::string_view path) noexcept {
+  ada::scheme::type scheme_type;
+  if (checkers::begins_with(path, "https://")) {
+    scheme_type = scheme::HTTPS;
+    path.remove_prefix(8);
+  } else if (checkers::begins_with(path, "http://")) {
+    scheme_type = scheme::HTTP;
+    path.remove_prefix(7);
+  } else {
+    return std::nullopt;
+  }
+  // A lowercase domain, without punycode label (which the parser validates)
+  // and whose last label does not start with a digit (an IPv4 address, in
+  // canonical form or not).
+  size_t host_end = 0;
+  size_t label_start = 0;
+  size_t last_label = 0;
+  for (; host_end < path.size(); host_end++) {
+    const char c = path[host_end];
+    if (c == '.') {
+      label_start = host_end + 1;
+      continue;
+    }
+    if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-')) {
+      break;
+    }
+    if (host_end == label_start) {
+      last_label = label_start;
+      if (path.substr(label_start, 4) == "xn--") {
+        return std::nullopt;
+      }
+    }
+  }
+  if (host_end == 0 || (path[last_label] >= '0' && path[last_label] <= '9')) {
+    return std::nullopt;
+  }
+  const std::string_view host_view = path.substr(0, host_end);
+  path.remove_prefix(host_end);
+  uint32_t port_value = url_components::omitted;
+  if (!path.empty() && path[0] == ':') {
+    // A port without leading zero, which is not the default port.
+    size_t digits = 1;
+    uint32_t value = 0;
+    while (digits < path.size() && digits <= 5 && path[digits] >= '0' &&
+           path[digits] <= '9') {
+      value = value * 10 + uint32_t(path[digits] - '0');
+      digits++;
+    }
+    if (digits == 1 || (path[1] == '0' && digits > 2) || value > 65535 ||
+        value == uint32_t(scheme::get_special_port(scheme_type))) {
+      return std::nullopt;
+    }
+    port_value = value;
+    path.remove_prefix(digits);
+  }
+  if (!path.empty() && path[0] != '/' && path[0] != '?' && path[0] != '#') {
+    return std::nullopt;
+  }
+  return origin(scheme_type, host_view, port_value);
+}
+
+origin origin::from_blob_path(std::string_view path) {
+  if (path.empty()) {
+    return origin();
+  }
+  std::optional<origin> canonical = from_canonical_blob_path(path);
+  if (canonical.has_value()) {
+    return std::move(*canonical);
+  }
+  auto out = ada::parse<ada::url_aggregator>(path);
+  // If pathURL's scheme is not "http" and not "https", then return a new
+  // opaque origin.
+  if (!out || (out->type != scheme::HTTP && out->type != scheme::HTTPS)) {
+    return origin();
+  }
+  // The host usually appears as is in the path: we point at it.
+  std::string_view hostname = out->get_hostname();
+  size_t location = path.find(hostname);
+  if (location != std::string_view::npos) {
+    return origin(out->type, path.substr(location, hostname.size()),
+                  out->components.port);
+  }
+  origin answer(out->type, hostname, out->components.port);
+  answer.owned_host = std::string(hostname);
+  answer.host = std::string_view();
+  return answer;
+}
+
+std::string origin::to_string() const {
+  if (opaque) {
+    return "null";
+  }
+  std::string answer(scheme::details::is_special_list[type]);
+  answer += "://";
+  answer.append(get_host());
+  if (port != url_components::omitted) {
+    answer += ':';
+    answer += std::to_string(port);
+  }
+  return answer;
+}
+
+}  // namespace ada
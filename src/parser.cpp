@@ -31,6 +31,7 @@ result_type parse_url_impl(std::string_view user_input,
           " bytes],", (base_url != nullptr ? base_url->to_string() : "null"),
           ")");
 
+  ada_stats_count(ada::stats::counter::PARSE);
   ada::state state = ada::state::SCHEME_START;
   result_type url{};
 
@@ -43,6 +44,7 @@ result_type parse_url_impl(std::string_view user_input,
   // std::numeric_limits<uint32_t>::max). If we are provided with an invalid
   // base, or the optional_url was invalid, we must return.
   if (base_url != nullptr) {
+    ada_stats_count(ada::stats::counter::BASE_RESOLUTION);
     url.is_valid &= base_url->is_valid;
   }
   if (!url.is_valid) {
@@ -69,6 +71,7 @@ result_type parse_url_impl(std::string_view user_input,
   std::string tmp_buffer;
   std::string_view internal_input;
   if (unicode::has_tabs_or_newline(user_input)) {
+    ada_stats_count(ada::stats::counter::TABS_OR_NEWLINE);
     tmp_buffer = user_input;
     // Optimization opportunity: Instead of copying and then pruning, we could
     // just directly build the string from user_input.
@@ -100,8 +103,8 @@ result_type parse_url_impl(std::string_view user_input,
   // Otherwise, increase pointer by 1 and continue with the state machine.
   // We never decrement input_position.
   while (input_position <= input_size) {
-    ada_log("In parsing at ", input_position, " out of ", input_size,
-            " in state ", ada::to_string(state));
+    ada_trace_state(state, input_position, input_size);
+    ada_stats_count(state);
     switch (state) {
       case ada::state::SCHEME_START: {
         ada_log("SCHEME_START ", helpers::substring(url_data, input_position));
@@ -915,6 +918,7 @@ result_type parse_url_impl(std::string_view user_input,
     if (fragment.has_value()) {
       url.update_unencoded_base_hash(*fragment);
     }
+    ada_trace_result(url, user_input.size());
   }
   return url;
 }
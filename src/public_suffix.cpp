@@ -0,0 +1,147 @@
+#include "ada.h"
+#include "ada/public_suffix.h"
+#include "public_suffix_tables.h"
+
+#include <cstring>
+#include <string_view>
+
+namespace ada::public_suffix {
+
+namespace details {
+
+/**
+ * Finds the child of the node with the given label in the hash table of the
+ * edges: nullptr if there is none.
+ */
+ada_really_inline const node *find_child(size_t parent,
+                                         std::string_view label) noexcept {
+  size_t slot = edge_hash(uint32_t(parent), label.data(), label.size()) &
+                edge_table_mask;
+  // The root (0) is never a child: it marks the empty slots.
+  for (uint16_t index; (index = edge_table[slot]) != 0;
+       slot = (slot + 1) & edge_table_mask) {
+    const node &candidate = nodes[index];
+    if (candidate.parent == parent && candidate.label_length == label.size() &&
+        std::memcmp(label_data + candidate.label_offset, label.data(),
+                    label.size()) == 0) {
+      return &candidate;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Returns the index of the first character of the public suffix of the host,
+ * or std::string_view::npos if there is none.
+ */
+size_t find_public_suffix(std::string_view host, rules options) noexcept {
+  if (host.empty() || host.front() == '[' || checkers::is_ipv4(host)) {
+    return std::string_view::npos;
+  }
+  if (host.back() == '.') {
+    host.remove_suffix(1);
+  }
+  const bool with_private = options == rules::ALL;
+  const node *current = &nodes[0];
+  // The labels are read from right to left: a label is host[start, end).
+  size_t end = host.size();
+  size_t suffix = std::string_view::npos;
+  while (true) {
+    size_t dot = end == 0 ? std::string_view::npos : host.rfind('.', end - 1);
+    size_t start = (dot == std::string_view::npos) ? 0 : dot + 1;
+    if (current == &nodes[0]) {
+      // The default rule "*".
+      suffix = start;
+    } else if ((current->flags & WILDCARD) &&
+               (with_private || !(current->flags & PRIVATE_WILDCARD))) {
+      suffix = start;
+    }
+    const node *child =
+        find_child(size_t(current - nodes), host.substr(start, end - start));
+    if (child == nullptr) {
+      break;
+    }
+    const bool applies = with_private || !(child->flags & PRIVATE_RULE);
+    if ((child->flags & EXCEPTION) && applies) {
+      // An exception rule prevails: the public suffix is the rule without
+      // its leftmost label.
+      return end + 1;
+    }
+    if ((child->flags & RULE) && applies) {
+      suffix = start;
+    }
+    if (dot == std::string_view::npos) {
+      break;
+    }
+    current = child;
+    end = dot;
+  }
+  return suffix;
+}
+
+/**
+ * The hostname of a URL, if it is a domain (and not an IP address).
+ */
+ada_really_inline std::string_view get_domain(
+    const ada::url_aggregator &url) noexcept {
+  if (!url.has_hostname() || url.host_type != url_host_type::DEFAULT) {
+    return {};
+  }
+  return url.get_hostname();
+}
+
+ada_really_inline std::string_view get_domain(const ada::url &url) noexcept {
+  if (!url.host.has_value() || url.host_type != url_host_type::DEFAULT) {
+    return {};
+  }
+  return *url.host;
+}
+
+}  // namespace details
+
+std::string_view get_public_suffix(std::string_view host,
+                                   rules options) noexcept {
+  size_t suffix = details::find_public_suffix(host, options);
+  if (suffix == std::string_view::npos) {
+    return {};
+  }
+  return host.substr(suffix);
+}
+
+std::string_view get_registrable_domain(std::string_view host,
+                                        rules options) noexcept {
+  size_t suffix = details::find_public_suffix(host, options);
+  // The registrable domain is the public suffix with one more label.
+  if (suffix == std::string_view::npos || suffix < 2) {
+    return {};
+  }
+  size_t dot = host.rfind('.', suffix - 2);
+  size_t start = (dot == std::string_view::npos) ? 0 : dot + 1;
+  if (start == suffix - 1) {
+    // The label before the public suffix is empty.
+    return {};
+  }
+  return host.substr(start);
+}
+
+std::string_view get_public_suffix(const ada::url_aggregator &url,
+                                   rules options) noexcept {
+  return get_public_suffix(details::get_domain(url), options);
+}
+
+std::string_view get_public_suffix(const ada::url &url,
+                                   rules options) noexcept {
+  return get_public_suffix(details::get_domain(url), options);
+}
+
+std::string_view get_registrable_domain(const ada::url_aggregator &url,
+                                        rules options) noexcept {
+  return get_registrable_domain(details::get_domain(url), options);
+}
+
+std::string_view get_registrable_domain(const ada::url &url,
+                                        rules options) noexcept {
+  return get_registrable_domain(details::get_domain(url), options);
+}
+
+}  // namespace ada::public_suffix
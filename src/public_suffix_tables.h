@@ -0,0 +1,13937 @@
+// Generated by tools/generate-public-suffix.py from the
+// Public Suffix List (https://publicsuffix.org/).
+// Do not edit!
+// sha256 of the list: 87d2e11f3602b504fc5dbea9218429a4ce3c0f62aa6ce7a1371024add024baed
+// 9506 rules, 9701 nodes, 42487 bytes of labels.
+// clang-format off
+#ifndef ADA_PUBLIC_SUFFIX_TABLES_H
+#define ADA_PUBLIC_SUFFIX_TABLES_H
+#include <cstddef>
+#include <cstdint>
+
+namespace ada::public_suffix::details {
+
+enum node_flags : uint8_t {
+  /** A rule ends at this node, e.g., "co.uk". */
+  RULE = 1,
+  /** An exception rule ends at this node, e.g., "!www.ck". */
+  EXCEPTION = 2,
+  /** A wildcard rule applies to the children of this node, e.g., "*.ck". */
+  WILDCARD = 4,
+  /** The rule (or the exception) of this node is a private domain. */
+  PRIVATE_RULE = 8,
+  /** The wildcard rule of this node is a private domain. */
+  PRIVATE_WILDCARD = 16,
+};
+
+/**
+ * A label of the trie, the labels being read from right to left. The root is
+ * the first node.
+ */
+struct node {
+  uint32_t label_offset;
+  uint16_t parent;
+  uint8_t label_length;
+  uint8_t flags;
+};
+
+/**
+ * The hash of an edge of the trie: must match edge_hash in
+ * tools/generate-public-suffix.py.
+ */
+constexpr uint32_t edge_hash(uint32_t parent, const char *label,
+                             size_t length) noexcept {
+  uint32_t h = 2166136261u ^ (parent * 2654435761u);
+  for (size_t i = 0; i < length; i++) {
+    h = (h ^ uint8_t(label[i])) * 16777619u;
+  }
+  return h ^ (h >> 15);
+}
+
+constexpr char label_data[42487] = {
+	120, 110, 45, 45, 99, 111, 114, 114, 101, 105, 111, 115, 45, 101, 45, 116, 101, 108, 101, 99,
+	111, 109, 117, 110, 105, 99, 97, 101, 115, 45, 103, 104, 99, 50, 57, 97, 99, 104, 105, 114,
+	117, 114, 103, 105, 101, 110, 115, 45, 100, 101, 110, 116, 105, 115, 116, 101, 115, 45, 101, 110,
+	45, 102, 114, 97, 110, 99, 101, 112, 111, 115, 116, 115, 45, 97, 110, 100, 45, 116, 101, 108,
+	101, 99, 111, 109, 109, 117, 110, 105, 99, 97, 116, 105, 111, 110, 115, 101, 110, 118, 105, 114,
+	111, 110, 109, 101, 110, 116, 97, 108, 99, 111, 110, 115, 101, 114, 118, 97, 116, 105, 111, 110,
+	115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 97, 112, 45, 110, 111, 114, 116, 104, 101,
+	97, 115, 116, 45, 49, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 97, 112, 45, 115,
+	111, 117, 116, 104, 101, 97, 115, 116, 45, 49, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101,
+	45, 97, 112, 45, 115, 111, 117, 116, 104, 101, 97, 115, 116, 45, 50, 120, 110, 45, 45, 116,
+	114, 101, 110, 116, 105, 110, 111, 45, 115, 100, 45, 116, 105, 114, 111, 108, 45, 99, 51, 98,
+	112, 114, 105, 118, 97, 116, 105, 122, 101, 104, 101, 97, 108, 116, 104, 105, 110, 115, 117, 114,
+	97, 110, 99, 101, 120, 110, 45, 45, 116, 114, 101, 110, 116, 105, 110, 45, 115, 100, 45, 116,
+	105, 114, 111, 108, 45, 114, 122, 98, 120, 110, 45, 45, 116, 114, 101, 110, 116, 105, 110, 111,
+	45, 115, 100, 116, 105, 114, 111, 108, 45, 115, 122, 98, 120, 110, 45, 45, 116, 114, 101, 110,
+	116, 105, 110, 111, 115, 100, 45, 116, 105, 114, 111, 108, 45, 114, 122, 98, 120, 110, 45, 45,
+	118, 101, 114, 109, 103, 101, 110, 115, 98, 101, 114, 97, 116, 117, 110, 103, 45, 112, 119, 98,
+	120, 110, 45, 45, 103, 110, 115, 116, 105, 103, 98, 101, 115, 116, 101, 108, 108, 101, 110, 45,
+	122, 118, 98, 120, 110, 45, 45, 116, 114, 101, 110, 116, 105, 110, 45, 115, 100, 116, 105, 114,
+	111, 108, 45, 55, 118, 98, 120, 110, 45, 45, 116, 114, 101, 110, 116, 105, 110, 111, 115, 100,
+	116, 105, 114, 111, 108, 45, 55, 118, 98, 120, 110, 45, 45, 116, 114, 101, 110, 116, 105, 110,
+	115, 100, 45, 116, 105, 114, 111, 108, 45, 54, 118, 98, 120, 110, 45, 45, 118, 101, 114, 109,
+	103, 101, 110, 115, 98, 101, 114, 97, 116, 101, 114, 45, 99, 116, 98, 97, 99, 99, 105, 100,
+	101, 110, 116, 45, 105, 110, 118, 101, 115, 116, 105, 103, 97, 116, 105, 111, 110, 105, 110, 100,
+	101, 112, 101, 110, 100, 101, 110, 116, 45, 99, 111, 109, 109, 105, 115, 115, 105, 111, 110, 120,
+	110, 45, 45, 98, 97, 108, 115, 97, 110, 45, 115, 100, 116, 105, 114, 111, 108, 45, 110, 115,
+	98, 120, 110, 45, 45, 98, 117, 108, 115, 97, 110, 45, 115, 100, 116, 105, 114, 111, 108, 45,
+	110, 115, 98, 120, 110, 45, 45, 99, 108, 99, 104, 99, 48, 101, 97, 48, 98, 50, 103, 50,
+	97, 57, 103, 99, 100, 120, 110, 45, 45, 109, 114, 101, 45, 111, 103, 45, 114, 111, 109, 115,
+	100, 97, 108, 45, 113, 113, 98, 120, 110, 45, 45, 115, 116, 106, 114, 100, 97, 108, 115, 104,
+	97, 108, 115, 101, 110, 45, 115, 113, 98, 120, 110, 45, 45, 116, 114, 101, 110, 116, 105, 110,
+	115, 100, 116, 105, 114, 111, 108, 45, 110, 115, 98, 97, 110, 100, 114, 105, 97, 45, 98, 97,
+	114, 108, 101, 116, 116, 97, 45, 116, 114, 97, 110, 105, 97, 110, 100, 114, 105, 97, 45, 116,
+	114, 97, 110, 105, 45, 98, 97, 114, 108, 101, 116, 116, 97, 98, 97, 114, 108, 101, 116, 116,
+	97, 45, 116, 114, 97, 110, 105, 45, 97, 110, 100, 114, 105, 97, 102, 114, 105, 117, 108, 105,
+	45, 118, 101, 110, 101, 122, 105, 97, 45, 103, 105, 117, 108, 105, 97, 105, 115, 45, 97, 45,
+	102, 105, 110, 97, 110, 99, 105, 97, 108, 97, 100, 118, 105, 115, 111, 114, 109, 111, 110, 122,
+	97, 45, 101, 45, 100, 101, 108, 108, 97, 45, 98, 114, 105, 97, 110, 122, 97, 111, 98, 115,
+	101, 114, 118, 97, 98, 108, 101, 117, 115, 101, 114, 99, 111, 110, 116, 101, 110, 116, 112, 97,
+	115, 115, 101, 110, 103, 101, 114, 45, 97, 115, 115, 111, 99, 105, 97, 116, 105, 111, 110, 115,
+	51, 45, 102, 105, 112, 115, 45, 117, 115, 45, 103, 111, 118, 45, 119, 101, 115, 116, 45, 49,
+	116, 114, 97, 110, 105, 45, 97, 110, 100, 114, 105, 97, 45, 98, 97, 114, 108, 101, 116, 116,
+	97, 116, 114, 97, 110, 105, 45, 98, 97, 114, 108, 101, 116, 116, 97, 45, 97, 110, 100, 114,
+	105, 97, 120, 110, 45, 45, 97, 117, 114, 115, 107, 111, 103, 45, 104, 108, 97, 110, 100, 45,
+	106, 110, 98, 120, 110, 45, 45, 98, 111, 122, 101, 110, 45, 115, 100, 116, 105, 114, 111, 108,
+	45, 50, 111, 98, 120, 110, 45, 45, 103, 110, 115, 116, 105, 103, 108, 105, 101, 102, 101, 114,
+	110, 45, 119, 111, 98, 120, 110, 45, 45, 110, 109, 101, 115, 106, 101, 118, 117, 101, 109, 105,
+	101, 45, 116, 99, 98, 97, 120, 110, 45, 45, 118, 97, 108, 108, 101, 45, 100, 45, 97, 111,
+	115, 116, 101, 45, 101, 104, 98, 97, 107, 97, 109, 97, 105, 111, 114, 105, 103, 105, 110, 45,
+	115, 116, 97, 103, 105, 110, 103, 97, 119, 115, 103, 108, 111, 98, 97, 108, 97, 99, 99, 101,
+	108, 101, 114, 97, 116, 111, 114, 98, 97, 114, 114, 101, 108, 108, 45, 111, 102, 45, 107, 110,
+	111, 119, 108, 101, 100, 103, 101, 99, 111, 108, 111, 110, 105, 97, 108, 119, 105, 108, 108, 105,
+	97, 109, 115, 98, 117, 114, 103, 102, 114, 105, 117, 108, 105, 45, 118, 101, 110, 101, 122, 105,
+	97, 103, 105, 117, 108, 105, 97, 102, 114, 105, 117, 108, 105, 118, 101, 110, 101, 122, 105, 97,
+	45, 103, 105, 117, 108, 105, 97, 105, 115, 45, 97, 45, 112, 101, 114, 115, 111, 110, 97, 108,
+	116, 114, 97, 105, 110, 101, 114, 110, 97, 116, 117, 114, 97, 108, 104, 105, 115, 116, 111, 114,
+	121, 109, 117, 115, 101, 117, 109, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 101, 117,
+	45, 119, 101, 115, 116, 45, 49, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 115, 97,
+	45, 101, 97, 115, 116, 45, 49, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 117, 115,
+	45, 101, 97, 115, 116, 45, 49, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 117, 115,
+	45, 119, 101, 115, 116, 45, 49, 115, 51, 45, 119, 101, 98, 115, 105, 116, 101, 45, 117, 115,
+	45, 119, 101, 115, 116, 45, 50, 115, 121, 110, 111, 108, 111, 103, 121, 45, 100, 105, 115, 107,
+	115, 116, 97, 116, 105, 111, 110, 120, 110, 45, 45, 99, 111, 109, 117, 110, 105, 99, 97, 101,
+	115, 45, 118, 54, 97, 50, 111, 120, 110, 45, 45, 109, 116, 116, 97, 45, 118, 114, 106, 106,
+	97, 116, 45, 107, 55, 97, 102, 120, 110, 45, 45, 119, 52, 114, 56, 53, 101, 108, 56, 102,
+	104, 117, 53, 100, 110, 114, 97, 120, 110, 45, 45, 121, 115, 116, 114, 101, 45, 115, 108, 105,
+	100, 114, 101, 45, 117, 106, 98, 97, 99, 99, 105, 100, 101, 110, 116, 45, 112, 114, 101, 118,
+	101, 110, 116, 105, 111, 110, 97, 105, 114, 45, 116, 114, 97, 102, 102, 105, 99, 45, 99, 111,
+	110, 116, 114, 111, 108, 97, 110, 100, 114, 105, 97, 98, 97, 114, 108, 101, 116, 116, 97, 116,
+	114, 97, 110, 105, 97, 110, 100, 114, 105, 97, 116, 114, 97, 110, 105, 98, 97, 114, 108, 101,
+	116, 116, 97, 97, 112, 112, 115, 112, 97, 99, 101, 117, 115, 101, 114, 99, 111, 110, 116, 101,
+	110, 116, 98, 97, 114, 114, 101, 108, 45, 111, 102, 45, 107, 110, 111, 119, 108, 101, 100, 103,
+	101, 102, 114, 105, 117, 108, 105, 118, 101, 110, 101, 122, 105, 97, 103, 105, 117, 108, 105, 97,
+	105, 110, 100, 101, 112, 101, 110, 100, 101, 110, 116, 45, 105, 110, 113, 117, 101, 115, 116, 105,
+	110, 100, 101, 112, 101, 110, 100, 101, 110, 116, 45, 105, 110, 113, 117, 105, 114, 121, 109, 101,
+	100, 105, 122, 105, 110, 104, 105, 115, 116, 111, 114, 105, 115, 99, 104, 101, 115, 110, 97, 116,
+	117, 117, 114, 119, 101, 116, 101, 110, 115, 99, 104, 97, 112, 112, 101, 110, 116, 114, 97, 110,
+	105, 97, 110, 100, 114, 105, 97, 98, 97, 114, 108, 101, 116, 116, 97, 116, 114, 97, 110, 105,
+	98, 97, 114, 108, 101, 116, 116, 97, 97, 110, 100, 114, 105, 97, 116, 114, 101, 110, 116, 105,
+	110, 111, 45, 97, 108, 116, 111, 45, 97, 100, 105, 103, 101, 116, 114, 101, 110, 116, 105, 110,
+	111, 45, 115, 117, 101, 100, 45, 116, 105, 114, 111, 108, 120, 110, 45, 45, 98, 104, 99, 99,
+	97, 118, 117, 111, 116, 110, 97, 45, 107, 55, 97, 120, 110, 45, 45, 99, 101, 115, 101, 110,
+	97, 45, 102, 111, 114, 108, 45, 109, 99, 98, 120, 110, 45, 45, 102, 111, 114, 108, 45, 99,
+	101, 115, 101, 110, 97, 45, 102, 99, 98, 120, 110, 45, 45, 103, 103, 97, 118, 105, 105, 107,
+	97, 45, 56, 121, 97, 52, 55, 104, 120, 110, 45, 45, 104, 99, 101, 115, 117, 111, 108, 111,
+	45, 55, 121, 97, 51, 53, 98, 120, 110, 45, 45, 104, 109, 109, 114, 102, 101, 97, 115, 116,
+	97, 45, 115, 52, 97, 99, 120, 110, 45, 45, 107, 111, 108, 117, 111, 107, 116, 97, 45, 55,
+	121, 97, 53, 55, 104, 120, 110, 45, 45, 107, 114, 106, 111, 104, 107, 97, 45, 104, 119, 97,
+	98, 52, 57, 106, 120, 110, 45, 45, 109, 103, 98, 101, 114, 112, 52, 97, 53, 100, 52, 97,
+	56, 55, 103, 120, 110, 45, 45, 109, 103, 98, 113, 108, 121, 55, 99, 48, 97, 54, 55, 102,
+	98, 99, 120, 110, 45, 45, 115, 97, 110, 100, 110, 101, 115, 115, 106, 101, 110, 45, 111, 103,
+	98, 120, 110, 45, 45, 115, 114, 45, 118, 97, 114, 97, 110, 103, 101, 114, 45, 103, 103, 98,
+	120, 110, 45, 45, 118, 97, 108, 108, 101, 45, 97, 111, 115, 116, 101, 45, 101, 98, 98, 120,
+	110, 45, 45, 118, 97, 108, 108, 101, 100, 97, 111, 115, 116, 101, 45, 101, 98, 98, 97, 107,
+	97, 109, 97, 105, 101, 100, 103, 101, 45, 115, 116, 97, 103, 105, 110, 103, 98, 111, 108, 100,
+	108, 121, 103, 111, 105, 110, 103, 110, 111, 119, 104, 101, 114, 101, 100, 105, 103, 105, 116, 97,
+	108, 111, 99, 101, 97, 110, 115, 112, 97, 99, 101, 115, 100, 105, 115, 107, 117, 115, 115, 105,
+	111, 110, 115, 98, 101, 114, 101, 105, 99, 104, 101, 120, 112, 101, 114, 116, 115, 45, 99, 111,
+	109, 112, 116, 97, 98, 108, 101, 115, 104, 97, 114, 118, 101, 115, 116, 99, 101, 108, 101, 98,
+	114, 97, 116, 105, 111, 110, 104, 111, 115, 116, 101, 100, 45, 98, 121, 45, 112, 114, 101, 118,
+	105, 100, 101, 114, 105, 110, 100, 101, 112, 101, 110, 100, 101, 110, 116, 45, 114, 101, 118, 105,
+	101, 119, 105, 110, 116, 101, 114, 104, 111, 115, 116, 115, 111, 108, 117, 116, 105, 111, 110, 115,
+	105, 115, 45, 97, 45, 99, 117, 98, 105, 99, 108, 101, 45, 115, 108, 97, 118, 101, 109, 111,
+	110, 122, 97, 101, 100, 101, 108, 108, 97, 98, 114, 105, 97, 110, 122, 97, 110, 111, 114, 116,
+	104, 119, 101, 115, 116, 101, 114, 110, 109, 117, 116, 117, 97, 108, 112, 97, 103, 101, 115, 112,
+	101, 101, 100, 109, 111, 98, 105, 108, 105, 122, 101, 114, 115, 99, 105, 101, 110, 99, 101, 97,
+	110, 100, 105, 110, 100, 117, 115, 116, 114, 121, 115, 99, 105, 101, 110, 99, 101, 115, 110, 97,
+	116, 117, 114, 101, 108, 108, 101, 115, 115, 101, 114, 118, 101, 99, 111, 117, 110, 116, 101, 114,
+	115, 116, 114, 105, 107, 101, 116, 114, 97, 118, 101, 108, 101, 114, 115, 105, 110, 115, 117, 114,
+	97, 110, 99, 101, 116, 114, 101, 110, 116, 105, 110, 45, 115, 117, 101, 100, 45, 116, 105, 114,
+	111, 108, 116, 114, 101, 110, 116, 105, 110, 111, 45, 97, 108, 116, 111, 97, 100, 105, 103, 101,
+	116, 114, 101, 110, 116, 105, 110, 111, 45, 115, 117, 100, 45, 116, 105, 114, 111, 108, 116, 114,
+	101, 110, 116, 105, 110, 111, 45, 115, 117, 101, 100, 116, 105, 114, 111, 108, 116, 114, 101, 110,
+	116, 105, 110, 111, 97, 108, 116, 111, 45, 97, 100, 105, 103, 101, 116, 114, 101, 110, 116, 105,
+	110, 111, 115, 117, 101, 100, 45, 116, 105, 114, 111, 108, 120, 110, 45, 45, 98, 101, 97, 114,
+	97, 108, 118, 104, 107, 105, 45, 121, 52, 97, 120, 110, 45, 45, 98, 104, 99, 97, 118, 117,
+	111, 116, 110, 97, 45, 115, 52, 97, 120, 110, 45, 45, 98, 114, 110, 110, 121, 115, 117, 110,
+	100, 45, 109, 56, 97, 99, 120, 110, 45, 45, 99, 101, 115, 101, 110, 97, 102, 111, 114, 108,
+	45, 105, 56, 97, 120, 110, 45, 45, 100, 97, 118, 118, 101, 110, 106, 114, 103, 97, 45, 121,
+	52, 97, 120, 110, 45, 45, 102, 111, 114, 108, 99, 101, 115, 101, 110, 97, 45, 99, 56, 97,
+	120, 110, 45, 45, 108, 101, 97, 103, 97, 118, 105, 105, 107, 97, 45, 53, 50, 98, 120, 110,
+	45, 45, 109, 103, 98, 97, 105, 57, 97, 53, 101, 118, 97, 48, 48, 98, 120, 110, 45, 45,
+	109, 108, 97, 116, 118, 117, 111, 112, 109, 105, 45, 115, 52, 97, 120, 110, 45, 45, 114, 104,
+	107, 107, 101, 114, 118, 106, 117, 45, 48, 49, 97, 102, 120, 110, 45, 45, 115, 110, 100, 114,
+	101, 45, 108, 97, 110, 100, 45, 48, 99, 98, 120, 110, 45, 45, 115, 116, 114, 101, 45, 116,
+	111, 116, 101, 110, 45, 122, 99, 98, 120, 110, 45, 45, 118, 97, 108, 108, 101, 97, 111, 115,
+	116, 101, 45, 101, 55, 97, 97, 107, 97, 109, 97, 105, 122, 101, 100, 45, 115, 116, 97, 103,
+	105, 110, 103, 97, 108, 112, 104, 97, 45, 109, 121, 113, 110, 97, 112, 99, 108, 111, 117, 100,
+	98, 111, 108, 122, 97, 110, 111, 45, 97, 108, 116, 111, 97, 100, 105, 103, 101, 98, 114, 111,
+	119, 115, 101, 114, 115, 97, 102, 101, 116, 121, 109, 97, 114, 107, 99, 97, 114, 98, 111, 110,
+	105, 97, 45, 105, 103, 108, 101, 115, 105, 97, 115, 101, 100, 103, 101, 115, 117, 105, 116, 101,
+	45, 115, 116, 97, 103, 105, 110, 103, 103, 105, 116, 104, 117, 98, 117, 115, 101, 114, 99, 111,
+	110, 116, 101, 110, 116, 104, 101, 97, 108, 116, 104, 45, 99, 97, 114, 101, 114, 101, 102, 111,
+	114, 109, 104, 105, 103, 97, 115, 104, 105, 109, 97, 116, 115, 117, 115, 104, 105, 109, 97, 104,
+	105, 115, 116, 111, 114, 105, 99, 97, 108, 115, 111, 99, 105, 101, 116, 121, 105, 103, 108, 101,
+	115, 105, 97, 115, 45, 99, 97, 114, 98, 111, 110, 105, 97, 105, 110, 100, 101, 112, 101, 110,
+	100, 101, 110, 116, 45, 112, 97, 110, 101, 108, 105, 115, 45, 97, 45, 99, 111, 110, 115, 101,
+	114, 118, 97, 116, 105, 118, 101, 105, 115, 45, 97, 45, 112, 104, 111, 116, 111, 103, 114, 97,
+	112, 104, 101, 114, 105, 115, 45, 97, 110, 45, 101, 110, 116, 101, 114, 116, 97, 105, 110, 101,
+	114, 108, 105, 110, 111, 100, 101, 117, 115, 101, 114, 99, 111, 110, 116, 101, 110, 116, 109, 121,
+	97, 99, 116, 105, 118, 101, 100, 105, 114, 101, 99, 116, 111, 114, 121, 110, 97, 116, 117, 114,
+	104, 105, 115, 116, 111, 114, 105, 115, 99, 104, 101, 115, 112, 108, 97, 121, 115, 116, 97, 116,
+	105, 111, 110, 45, 99, 108, 111, 117, 100, 115, 51, 45, 97, 112, 45, 110, 111, 114, 116, 104,
+	101, 97, 115, 116, 45, 49, 115, 51, 45, 97, 112, 45, 110, 111, 114, 116, 104, 101, 97, 115,
+	116, 45, 50, 115, 51, 45, 97, 112, 45, 115, 111, 117, 116, 104, 101, 97, 115, 116, 45, 49,
+	115, 51, 45, 97, 112, 45, 115, 111, 117, 116, 104, 101, 97, 115, 116, 45, 50, 115, 99, 105,
+	101, 110, 99, 101, 97, 110, 100, 104, 105, 115, 116, 111, 114, 121, 115, 116, 97, 99, 107, 104,
+	101, 114, 111, 45, 110, 101, 116, 119, 111, 114, 107, 116, 101, 108, 101, 107, 111, 109, 109, 117,
+	110, 105, 107, 97, 116, 105, 111, 110, 116, 114, 101, 110, 116, 105, 110, 45, 115, 117, 100, 45,
+	116, 105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110, 45, 115, 117, 101, 100, 116, 105, 114,
+	111, 108, 116, 114, 101, 110, 116, 105, 110, 111, 45, 115, 117, 100, 116, 105, 114, 111, 108, 116,
+	114, 101, 110, 116, 105, 110, 111, 97, 108, 116, 111, 97, 100, 105, 103, 101, 116, 114, 101, 110,
+	116, 105, 110, 111, 115, 117, 100, 45, 116, 105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110,
+	111, 115, 117, 101, 100, 116, 105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110, 115, 117, 101,
+	100, 45, 116, 105, 114, 111, 108, 120, 110, 45, 45, 53, 115, 117, 51, 52, 106, 57, 51, 54,
+	98, 103, 115, 103, 120, 110, 45, 45, 98, 99, 107, 49, 98, 57, 97, 53, 100, 114, 101, 52,
+	99, 120, 110, 45, 45, 101, 118, 101, 110, 105, 45, 48, 113, 97, 48, 49, 103, 97, 120, 110,
+	45, 45, 104, 103, 101, 98, 111, 115, 116, 97, 100, 45, 103, 51, 97, 120, 110, 45, 45, 107,
+	114, 100, 115, 104, 101, 114, 97, 100, 45, 109, 56, 97, 120, 110, 45, 45, 109, 103, 98, 97,
+	104, 49, 97, 51, 104, 106, 107, 114, 100, 120, 110, 45, 45, 109, 103, 98, 97, 105, 57, 97,
+	122, 103, 113, 112, 54, 106, 120, 110, 45, 45, 109, 103, 98, 101, 114, 112, 52, 97, 53, 100,
+	52, 97, 114, 120, 110, 45, 45, 112, 111, 114, 115, 103, 117, 45, 115, 116, 97, 50, 54, 102,
+	120, 110, 45, 45, 115, 114, 45, 97, 117, 114, 100, 97, 108, 45, 108, 56, 97, 120, 110, 45,
+	45, 118, 101, 115, 116, 118, 103, 121, 45, 105, 120, 97, 54, 111, 120, 110, 45, 45, 118, 114,
+	101, 45, 101, 105, 107, 101, 114, 45, 107, 56, 97, 120, 110, 45, 45, 120, 107, 99, 50, 100,
+	108, 51, 97, 53, 101, 101, 48, 104, 97, 105, 114, 45, 115, 117, 114, 118, 101, 105, 108, 108,
+	97, 110, 99, 101, 97, 107, 97, 109, 97, 105, 104, 100, 45, 115, 116, 97, 103, 105, 110, 103,
+	97, 109, 101, 114, 105, 99, 97, 110, 97, 110, 116, 105, 113, 117, 101, 115, 97, 117, 116, 104,
+	103, 101, 97, 114, 45, 115, 116, 97, 103, 105, 110, 103, 98, 97, 108, 115, 97, 110, 45, 115,
+	117, 101, 100, 116, 105, 114, 111, 108, 98, 114, 97, 110, 100, 121, 119, 105, 110, 101, 118, 97,
+	108, 108, 101, 121, 98, 117, 108, 115, 97, 110, 45, 115, 117, 101, 100, 116, 105, 114, 111, 108,
+	99, 97, 114, 98, 111, 110, 105, 97, 105, 103, 108, 101, 115, 105, 97, 115, 99, 111, 117, 99,
+	104, 112, 111, 116, 97, 116, 111, 102, 114, 105, 101, 115, 101, 108, 97, 115, 116, 105, 99, 98,
+	101, 97, 110, 115, 116, 97, 108, 107, 101, 110, 100, 111, 102, 116, 104, 101, 105, 110, 116, 101,
+	114, 110, 101, 116, 101, 115, 116, 45, 109, 111, 110, 45, 98, 108, 111, 103, 117, 101, 117, 114,
+	102, 97, 115, 116, 108, 121, 45, 116, 101, 114, 114, 97, 114, 105, 117, 109, 102, 101, 100, 111,
+	114, 97, 105, 110, 102, 114, 97, 99, 108, 111, 117, 100, 102, 105, 114, 101, 119, 97, 108, 108,
+	45, 103, 97, 116, 101, 119, 97, 121, 102, 105, 114, 101, 119, 97, 108, 108, 101, 100, 114, 101,
+	112, 108, 105, 116, 102, 114, 105, 117, 108, 105, 45, 118, 101, 45, 103, 105, 117, 108, 105, 97,
+	104, 105, 103, 97, 115, 104, 105, 104, 105, 114, 111, 115, 104, 105, 109, 97, 104, 105, 103, 97,
+	115, 104, 105, 109, 97, 116, 115, 117, 121, 97, 109, 97, 104, 105, 103, 97, 115, 104, 105, 115,
+	104, 105, 114, 97, 107, 97, 119, 97, 104, 105, 103, 97, 115, 104, 105, 115, 117, 109, 105, 121,
+	111, 115, 104, 105, 104, 105, 115, 116, 111, 114, 121, 111, 102, 115, 99, 105, 101, 110, 99, 101,
+	104, 117, 105, 115, 115, 105, 101, 114, 45, 106, 117, 115, 116, 105, 99, 101, 105, 103, 108, 101,
+	115, 105, 97, 115, 99, 97, 114, 98, 111, 110, 105, 97, 105, 115, 45, 97, 45, 104, 97, 114,
+	100, 45, 119, 111, 114, 107, 101, 114, 105, 115, 45, 97, 45, 108, 105, 98, 101, 114, 116, 97,
+	114, 105, 97, 110, 105, 115, 45, 97, 110, 45, 97, 99, 99, 111, 117, 110, 116, 97, 110, 116,
+	105, 115, 45, 105, 110, 116, 111, 45, 99, 97, 114, 116, 111, 111, 110, 115, 105, 115, 45, 110,
+	111, 116, 45, 99, 101, 114, 116, 105, 102, 105, 101, 100, 105, 115, 115, 109, 97, 114, 116, 101,
+	114, 116, 104, 97, 110, 121, 111, 117, 109, 117, 115, 101, 117, 109, 118, 101, 114, 101, 110, 105,
+	103, 105, 110, 103, 109, 121, 115, 101, 99, 117, 114, 105, 116, 121, 99, 97, 109, 101, 114, 97,
+	110, 97, 116, 105, 111, 110, 97, 108, 102, 105, 114, 101, 97, 114, 109, 115, 110, 97, 116, 105,
+	111, 110, 97, 108, 104, 101, 114, 105, 116, 97, 103, 101, 110, 111, 114, 116, 104, 45, 107, 97,
+	122, 97, 107, 104, 115, 116, 97, 110, 112, 104, 105, 108, 97, 100, 101, 108, 112, 104, 105, 97,
+	97, 114, 101, 97, 114, 111, 121, 97, 108, 45, 99, 111, 109, 109, 105, 115, 115, 105, 111, 110,
+	115, 51, 45, 117, 115, 45, 103, 111, 118, 45, 119, 101, 115, 116, 45, 49, 115, 97, 118, 101,
+	115, 45, 116, 104, 101, 45, 119, 104, 97, 108, 101, 115, 116, 111, 119, 110, 110, 101, 119, 115,
+	45, 115, 116, 97, 103, 105, 110, 103, 116, 114, 101, 110, 116, 105, 110, 45, 115, 117, 100, 116,
+	105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110, 111, 45, 97, 45, 97, 100, 105, 103, 101,
+	116, 114, 101, 110, 116, 105, 110, 111, 45, 115, 45, 116, 105, 114, 111, 108, 116, 114, 101, 110,
+	116, 105, 110, 111, 115, 117, 100, 116, 105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110, 115,
+	117, 100, 45, 116, 105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110, 115, 117, 101, 100, 116,
+	105, 114, 111, 108, 117, 115, 100, 101, 99, 111, 114, 97, 116, 105, 118, 101, 97, 114, 116, 115,
+	120, 110, 45, 45, 49, 50, 99, 111, 48, 99, 51, 98, 52, 101, 118, 97, 120, 110, 45, 45,
+	98, 116, 115, 102, 106, 111, 114, 100, 45, 57, 122, 97, 120, 110, 45, 45, 102, 122, 121, 115,
+	56, 100, 54, 57, 117, 118, 103, 109, 120, 110, 45, 45, 103, 105, 108, 100, 101, 115, 107, 108,
+	45, 103, 48, 97, 120, 110, 45, 45, 103, 105, 118, 117, 111, 116, 110, 97, 45, 56, 121, 97,
+	120, 110, 45, 45, 104, 121, 108, 97, 110, 100, 101, 116, 45, 53, 52, 97, 120, 110, 45, 45,
+	106, 114, 112, 101, 108, 97, 110, 100, 45, 53, 52, 97, 120, 110, 45, 45, 107, 114, 97, 110,
+	103, 104, 107, 101, 45, 98, 48, 97, 120, 110, 45, 45, 107, 118, 110, 97, 110, 103, 101, 110,
+	45, 107, 48, 97, 120, 110, 45, 45, 108, 97, 104, 101, 97, 100, 106, 117, 45, 55, 121, 97,
+	120, 110, 45, 45, 108, 114, 101, 110, 115, 107, 111, 103, 45, 53, 52, 97, 120, 110, 45, 45,
+	109, 103, 98, 97, 55, 99, 48, 98, 98, 110, 48, 97, 120, 110, 45, 45, 109, 103, 98, 99,
+	112, 113, 54, 103, 112, 97, 49, 97, 120, 110, 45, 45, 109, 103, 98, 113, 108, 121, 55, 99,
+	118, 97, 102, 114, 120, 110, 45, 45, 109, 106, 110, 100, 97, 108, 101, 110, 45, 54, 52, 97,
+	120, 110, 45, 45, 118, 101, 103, 114, 115, 104, 101, 105, 45, 99, 48, 97, 120, 110, 45, 45,
+	120, 107, 99, 50, 97, 108, 51, 104, 121, 101, 50, 97, 97, 102, 102, 105, 110, 105, 116, 121,
+	108, 111, 116, 116, 101, 114, 121, 97, 109, 101, 114, 105, 99, 97, 110, 101, 120, 112, 114, 101,
+	115, 115, 97, 122, 117, 114, 101, 115, 116, 97, 116, 105, 99, 97, 112, 112, 115, 98, 97, 108,
+	115, 97, 110, 45, 115, 117, 100, 116, 105, 114, 111, 108, 98, 111, 116, 97, 110, 105, 99, 97,
+	108, 103, 97, 114, 100, 101, 110, 98, 111, 122, 101, 110, 45, 115, 117, 101, 100, 116, 105, 114,
+	111, 108, 98, 114, 105, 116, 105, 115, 104, 99, 111, 108, 117, 109, 98, 105, 97, 98, 117, 108,
+	115, 97, 110, 45, 115, 117, 100, 116, 105, 114, 111, 108, 99, 97, 109, 112, 105, 100, 97, 110,
+	111, 45, 109, 101, 100, 105, 111, 99, 104, 105, 108, 100, 114, 101, 110, 115, 103, 97, 114, 100,
+	101, 110, 99, 108, 111, 117, 100, 99, 111, 110, 116, 114, 111, 108, 97, 112, 112, 99, 108, 111,
+	117, 100, 99, 111, 110, 116, 114, 111, 108, 108, 101, 100, 99, 108, 111, 117, 100, 102, 108, 97,
+	114, 101, 45, 105, 112, 102, 115, 99, 111, 108, 111, 114, 97, 100, 111, 112, 108, 97, 116, 101,
+	97, 117, 99, 111, 109, 112, 117, 116, 101, 114, 104, 105, 115, 116, 111, 114, 121, 99, 111, 110,
+	116, 101, 109, 112, 111, 114, 97, 114, 121, 97, 114, 116, 100, 101, 118, 45, 109, 121, 113, 110,
+	97, 112, 99, 108, 111, 117, 100, 100, 121, 110, 97, 109, 105, 115, 99, 104, 101, 115, 45, 100,
+	110, 115, 101, 97, 115, 116, 45, 107, 97, 122, 97, 107, 104, 115, 116, 97, 110, 101, 100, 103,
+	101, 107, 101, 121, 45, 115, 116, 97, 103, 105, 110, 103, 101, 110, 116, 101, 114, 112, 114, 105,
+	115, 101, 99, 108, 111, 117, 100, 101, 115, 116, 45, 97, 45, 108, 97, 45, 109, 97, 105, 115,
+	111, 110, 101, 115, 116, 45, 97, 45, 108, 97, 45, 109, 97, 115, 105, 111, 110, 101, 118, 106,
+	101, 45, 111, 103, 45, 104, 111, 114, 110, 110, 101, 115, 102, 114, 105, 117, 108, 105, 45, 118,
+	45, 103, 105, 117, 108, 105, 97, 102, 114, 105, 117, 108, 105, 45, 118, 101, 103, 105, 117, 108,
+	105, 97, 102, 114, 105, 117, 108, 105, 118, 101, 45, 103, 105, 117, 108, 105, 97, 102, 117, 101,
+	116, 116, 101, 114, 116, 100, 97, 115, 110, 101, 116, 122, 102, 117, 106, 105, 107, 97, 119, 97,
+	103, 117, 99, 104, 105, 107, 111, 103, 101, 111, 109, 101, 116, 114, 101, 45, 101, 120, 112, 101,
+	114, 116, 104, 101, 109, 98, 121, 103, 100, 115, 102, 111, 114, 98, 117, 110, 100, 104, 105, 103,
+	97, 115, 104, 105, 97, 103, 97, 116, 115, 117, 109, 97, 104, 105, 103, 97, 115, 104, 105, 99,
+	104, 105, 99, 104, 105, 98, 117, 104, 105, 103, 97, 115, 104, 105, 109, 117, 114, 97, 121, 97,
+	109, 97, 104, 105, 103, 97, 115, 104, 105, 121, 111, 100, 111, 103, 97, 119, 97, 104, 111, 109,
+	101, 115, 101, 99, 117, 114, 105, 116, 121, 109, 97, 99, 104, 111, 115, 116, 105, 110, 103, 45,
+	99, 108, 117, 115, 116, 101, 114, 104, 111, 116, 101, 108, 119, 105, 116, 104, 102, 108, 105, 103,
+	104, 116, 105, 115, 45, 97, 45, 98, 111, 111, 107, 107, 101, 101, 112, 101, 114, 105, 115, 45,
+	97, 45, 99, 101, 108, 116, 105, 99, 115, 102, 97, 110, 105, 115, 45, 97, 45, 108, 97, 110,
+	100, 115, 99, 97, 112, 101, 114, 105, 115, 45, 97, 45, 108, 105, 110, 117, 120, 45, 117, 115,
+	101, 114, 105, 115, 45, 97, 45, 114, 101, 112, 117, 98, 108, 105, 99, 97, 110, 105, 115, 45,
+	97, 110, 45, 97, 110, 97, 114, 99, 104, 105, 115, 116, 105, 115, 45, 119, 105, 116, 104, 45,
+	116, 104, 101, 98, 97, 110, 100, 105, 118, 97, 110, 111, 45, 102, 114, 97, 110, 107, 105, 118,
+	115, 107, 107, 97, 122, 105, 109, 105, 101, 114, 122, 45, 100, 111, 108, 110, 121, 107, 101, 114,
+	114, 121, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 107, 111, 109, 109, 117, 110, 97, 108,
+	102, 111, 114, 98, 117, 110, 100, 109, 101, 100, 105, 111, 45, 99, 97, 109, 112, 105, 100, 97,
+	110, 111, 109, 105, 110, 97, 109, 105, 121, 97, 109, 97, 115, 104, 105, 114, 111, 109, 111, 114,
+	101, 45, 111, 103, 45, 114, 111, 109, 115, 100, 97, 108, 109, 117, 115, 97, 115, 104, 105, 109,
+	117, 114, 97, 121, 97, 109, 97, 110, 97, 116, 117, 114, 97, 108, 115, 99, 105, 101, 110, 99,
+	101, 115, 111, 99, 101, 97, 110, 111, 103, 114, 97, 112, 104, 105, 113, 117, 101, 111, 117, 116,
+	115, 121, 115, 116, 101, 109, 115, 99, 108, 111, 117, 100, 114, 101, 103, 103, 105, 111, 45, 99,
+	97, 108, 97, 98, 114, 105, 97, 115, 51, 45, 99, 97, 45, 99, 101, 110, 116, 114, 97, 108,
+	45, 49, 115, 51, 45, 101, 117, 45, 99, 101, 110, 116, 114, 97, 108, 45, 49, 115, 97, 110,
+	100, 118, 105, 107, 99, 111, 114, 111, 109, 97, 110, 116, 115, 99, 105, 101, 110, 99, 101, 45,
+	102, 105, 99, 116, 105, 111, 110, 115, 101, 99, 117, 114, 105, 116, 121, 116, 97, 99, 116, 105,
+	99, 115, 115, 116, 97, 116, 101, 111, 102, 100, 101, 108, 97, 119, 97, 114, 101, 115, 116, 106,
+	111, 114, 100, 97, 108, 115, 104, 97, 108, 115, 101, 110, 116, 114, 101, 110, 116, 105, 110, 111,
+	45, 97, 97, 100, 105, 103, 101, 116, 114, 101, 110, 116, 105, 110, 111, 45, 115, 116, 105, 114,
+	111, 108, 116, 114, 101, 110, 116, 105, 110, 111, 97, 45, 97, 100, 105, 103, 101, 116, 114, 101,
+	110, 116, 105, 110, 111, 115, 45, 116, 105, 114, 111, 108, 116, 114, 101, 110, 116, 105, 110, 115,
+	117, 100, 116, 105, 114, 111, 108, 116, 117, 108, 101, 97, 112, 45, 112, 97, 114, 116, 110, 101,
+	114, 115, 117, 115, 99, 111, 117, 110, 116, 114, 121, 101, 115, 116, 97, 116, 101, 117, 115, 108,
+	105, 118, 105, 110, 103, 104, 105, 115, 116, 111, 114, 121, 119, 97, 116, 99, 104, 45, 97, 110,
+	100, 45, 99, 108, 111, 99, 107, 119, 112, 101, 110, 103, 105, 110, 101, 112, 111, 119, 101, 114,
+	101, 100, 120, 110, 45, 45, 49, 50, 99, 102, 105, 56, 105, 120, 98, 56, 108, 120, 110, 45,
+	45, 97, 114, 111, 112, 111, 114, 116, 45, 98, 121, 97, 120, 110, 45, 45, 98, 100, 100, 100,
+	106, 45, 109, 114, 97, 98, 100, 120, 110, 45, 45, 98, 101, 114, 108, 101, 118, 103, 45, 106,
+	120, 97, 120, 110, 45, 45, 104, 107, 107, 105, 110, 101, 110, 45, 53, 119, 97, 120, 110, 45,
+	45, 104, 110, 101, 102, 111, 115, 115, 45, 113, 49, 97, 120, 110, 45, 45, 104, 111, 108, 116,
+	108, 101, 110, 45, 104, 120, 97, 120, 110, 45, 45, 104, 121, 97, 110, 103, 101, 114, 45, 113,
+	49, 97, 120, 110, 45, 45, 105, 49, 98, 54, 98, 49, 97, 54, 97, 50, 101, 120, 110, 45,
+	45, 107, 99, 114, 120, 55, 55, 100, 49, 120, 52, 97, 120, 110, 45, 45, 107, 114, 101, 104,
+	97, 109, 110, 45, 100, 120, 97, 120, 110, 45, 45, 107, 118, 102, 106, 111, 114, 100, 45, 110,
+	120, 97, 120, 110, 45, 45, 108, 97, 110, 103, 101, 118, 103, 45, 106, 120, 97, 120, 110, 45,
+	45, 108, 100, 105, 110, 103, 101, 110, 45, 113, 49, 97, 120, 110, 45, 45, 108, 103, 98, 98,
+	97, 116, 49, 97, 100, 56, 106, 120, 110, 45, 45, 109, 103, 98, 97, 51, 97, 52, 102, 49,
+	54, 97, 120, 110, 45, 45, 109, 103, 98, 97, 97, 107, 99, 55, 100, 118, 102, 120, 110, 45,
+	45, 109, 103, 98, 99, 48, 97, 57, 97, 122, 99, 103, 120, 110, 45, 45, 110, 113, 118, 55,
+	102, 115, 48, 48, 101, 109, 97, 120, 110, 45, 45, 110, 116, 116, 101, 114, 121, 45, 98, 121,
+	97, 101, 120, 110, 45, 45, 110, 118, 117, 111, 116, 110, 97, 45, 104, 119, 97, 120, 110, 45,
+	45, 111, 112, 112, 101, 103, 114, 100, 45, 105, 120, 97, 120, 110, 45, 45, 114, 101, 110, 110,
+	101, 115, 121, 45, 118, 49, 97, 120, 110, 45, 45, 114, 108, 105, 110, 103, 101, 110, 45, 109,
+	120, 97, 120, 110, 45, 45, 115, 100, 116, 105, 114, 111, 108, 45, 110, 50, 97, 120, 110, 45,
+	45, 115, 107, 106, 101, 114, 118, 121, 45, 118, 49, 97, 120, 110, 45, 45, 115, 107, 110, 108,
+	97, 110, 100, 45, 102, 120, 97, 120, 110, 45, 45, 115, 114, 45, 102, 114, 111, 110, 45, 113,
+	49, 97, 120, 110, 45, 45, 115, 114, 45, 111, 100, 97, 108, 45, 113, 49, 97, 120, 110, 45,
+	45, 115, 114, 114, 101, 105, 115, 97, 45, 113, 49, 97, 120, 110, 45, 45, 115, 116, 106, 114,
+	100, 97, 108, 45, 115, 49, 97, 120, 110, 45, 45, 116, 110, 115, 98, 101, 114, 103, 45, 113,
+	49, 97, 120, 110, 45, 45, 116, 114, 103, 115, 116, 97, 100, 45, 114, 49, 97, 120, 110, 45,
+	45, 121, 103, 97, 114, 100, 101, 110, 45, 112, 49, 97, 121, 111, 107, 111, 115, 104, 105, 98,
+	97, 104, 105, 107, 97, 114, 105, 97, 100, 111, 98, 101, 105, 111, 45, 115, 116, 97, 116, 105,
+	99, 97, 100, 111, 98, 101, 105, 111, 114, 117, 110, 116, 105, 109, 101, 97, 107, 97, 109, 97,
+	105, 45, 115, 116, 97, 103, 105, 110, 103, 97, 109, 101, 114, 105, 99, 97, 110, 102, 97, 109,
+	105, 108, 121, 97, 112, 45, 110, 111, 114, 116, 104, 101, 97, 115, 116, 45, 51, 97, 112, 112,
+	115, 112, 97, 99, 101, 104, 111, 115, 116, 101, 100, 97, 114, 99, 104, 97, 101, 111, 108, 111,
+	103, 105, 99, 97, 108, 97, 117, 114, 115, 107, 111, 103, 45, 104, 111, 108, 97, 110, 100, 97,
+	122, 117, 114, 101, 99, 111, 110, 116, 97, 105, 110, 101, 114, 98, 97, 108, 101, 110, 97, 45,
+	100, 101, 118, 105, 99, 101, 115, 98, 97, 110, 97, 110, 97, 114, 101, 112, 117, 98, 108, 105,
+	99, 98, 109, 111, 97, 116, 116, 97, 99, 104, 109, 101, 110, 116, 115, 98, 111, 122, 101, 110,
+	45, 115, 117, 100, 116, 105, 114, 111, 108, 99, 97, 109, 112, 105, 100, 97, 110, 111, 109, 101,
+	100, 105, 111, 99, 97, 115, 97, 100, 101, 108, 97, 109, 111, 110, 101, 100, 97, 99, 104, 105,
+	104, 97, 121, 97, 97, 107, 97, 115, 97, 107, 97, 99, 104, 114, 105, 115, 116, 105, 97, 110,
+	115, 98, 117, 114, 103, 99, 108, 111, 117, 100, 102, 117, 110, 99, 116, 105, 111, 110, 115, 99,
+	110, 45, 110, 111, 114, 116, 104, 119, 101, 115, 116, 45, 49, 99, 111, 97, 115, 116, 97, 108,
+	100, 101, 102, 101, 110, 99, 101, 99, 111, 111, 107, 105, 110, 103, 99, 104, 97, 110, 110, 101,
+	108, 99, 117, 108, 116, 117, 114, 97, 108, 99, 101, 110, 116, 101, 114, 100, 101, 108, 108, 45,
+	111, 103, 108, 105, 97, 115, 116, 114, 97, 100, 110, 101, 112, 114, 111, 112, 101, 116, 114, 111,
+	118, 115, 107, 100, 110, 105, 112, 114, 111, 112, 101, 116, 114, 111, 118, 115, 107, 100, 121, 110,
+	100, 110, 115, 45, 97, 116, 45, 104, 111, 109, 101, 100, 121, 110, 100, 110, 115, 45, 97, 116,
+	45, 119, 111, 114, 107, 101, 97, 116, 105, 110, 103, 45, 111, 114, 103, 97, 110, 105, 99, 101,
+	99, 111, 109, 109, 101, 114, 99, 101, 45, 115, 104, 111, 112, 101, 109, 105, 108, 105, 97, 45,
+	114, 111, 109, 97, 103, 110, 97, 102, 97, 115, 116, 118, 112, 115, 45, 115, 101, 114, 118, 101,
+	114, 102, 114, 105, 117, 108, 105, 45, 118, 103, 105, 117, 108, 105, 97, 102, 114, 105, 117, 108,
+	105, 118, 45, 103, 105, 117, 108, 105, 97, 102, 114, 105, 117, 108, 105, 118, 101, 103, 105, 117,
+	108, 105, 97, 103, 114, 111, 117, 110, 100, 104, 97, 110, 100, 108, 105, 110, 103, 104, 101, 105,
+	109, 97, 116, 117, 110, 100, 117, 104, 114, 101, 110, 104, 105, 103, 97, 115, 104, 105, 121, 111,
+	115, 104, 105, 110, 111, 104, 105, 115, 116, 111, 114, 105, 99, 104, 111, 117, 115, 101, 115, 104,
+	111, 109, 101, 45, 119, 101, 98, 115, 101, 114, 118, 101, 114, 104, 111, 109, 101, 115, 101, 99,
+	117, 114, 105, 116, 121, 112, 99, 105, 99, 104, 105, 107, 97, 119, 97, 109, 105, 115, 97, 116,
+	111, 105, 115, 45, 97, 45, 97, 110, 97, 114, 99, 104, 105, 115, 116, 105, 115, 45, 97, 45,
+	98, 114, 117, 105, 110, 115, 102, 97, 110, 105, 115, 45, 97, 45, 98, 117, 108, 108, 115, 45,
+	102, 97, 110, 105, 115, 45, 97, 45, 99, 97, 110, 100, 105, 100, 97, 116, 101, 105, 115, 45,
+	97, 45, 110, 97, 115, 99, 97, 114, 102, 97, 110, 105, 115, 45, 97, 45, 115, 111, 99, 105,
+	97, 108, 105, 115, 116, 105, 115, 45, 97, 45, 116, 104, 101, 114, 97, 112, 105, 115, 116, 105,
+	115, 45, 97, 110, 45, 101, 110, 103, 105, 110, 101, 101, 114, 106, 99, 108, 111, 117, 100, 45,
+	118, 101, 114, 45, 106, 112, 99, 107, 101, 114, 114, 121, 108, 111, 103, 105, 115, 116, 105, 99,
+	115, 107, 105, 116, 97, 110, 97, 107, 97, 103, 117, 115, 117, 107, 117, 107, 117, 110, 115, 116,
+	117, 110, 100, 100, 101, 115, 105, 103, 110, 108, 105, 110, 107, 121, 97, 114, 100, 45, 99, 108,
+	111, 117, 100, 109, 101, 100, 105, 111, 99, 97, 109, 112, 105, 100, 97, 110, 111, 109, 105, 100,
+	116, 114, 101, 45, 103, 97, 117, 108, 100, 97, 108, 109, 105, 110, 97, 109, 105, 97, 115, 104,
+	105, 103, 97, 114, 97, 110, 97, 97, 109, 101, 115, 106, 101, 118, 117, 101, 109, 105, 101, 110,
+	97, 116, 105, 118, 101, 97, 109, 101, 114, 105, 99, 97, 110, 110, 97, 116, 117, 114, 98, 114,
+	117, 107, 115, 103, 121, 109, 110, 111, 110, 100, 105, 103, 105, 116, 97, 108, 111, 99, 101, 97,
+	110, 112, 117, 98, 108, 105, 99, 45, 105, 110, 113, 117, 105, 114, 121, 112, 121, 116, 104, 111,
+	110, 97, 110, 121, 119, 104, 101, 114, 101, 114, 101, 103, 103, 105, 111, 99, 97, 108, 97, 98,
+	114, 105, 97, 114, 101, 115, 101, 114, 118, 101, 45, 111, 110, 108, 105, 110, 101, 115, 99, 104,
+	117, 108, 112, 108, 97, 116, 116, 102, 111, 114, 109, 115, 99, 105, 101, 110, 99, 101, 99, 101,
+	110, 116, 101, 114, 115, 115, 99, 105, 101, 110, 99, 101, 104, 105, 115, 116, 111, 114, 121, 115,
+	101, 108, 108, 115, 45, 102, 111, 114, 45, 108, 101, 115, 115, 115, 101, 114, 118, 101, 109, 105,
+	110, 101, 99, 114, 97, 102, 116, 115, 111, 117, 110, 100, 97, 110, 100, 118, 105, 115, 105, 111,
+	110, 116, 114, 101, 110, 116, 105, 110, 111, 97, 97, 100, 105, 103, 101, 116, 114, 101, 110, 116,
+	105, 110, 111, 115, 116, 105, 114, 111, 108, 118, 97, 108, 108, 101, 101, 45, 100, 45, 97, 111,
+	115, 116, 101, 119, 101, 97, 116, 104, 101, 114, 99, 104, 97, 110, 110, 101, 108, 119, 101, 98,
+	118, 105, 101, 119, 45, 97, 115, 115, 101, 116, 115, 119, 114, 105, 116, 101, 115, 116, 104, 105,
+	115, 98, 108, 111, 103, 120, 110, 45, 45, 53, 52, 98, 55, 102, 116, 97, 48, 99, 99, 120,
+	110, 45, 45, 54, 113, 113, 57, 56, 54, 98, 51, 120, 108, 120, 110, 45, 45, 56, 48, 97,
+	97, 97, 48, 99, 118, 97, 99, 120, 110, 45, 45, 56, 48, 97, 113, 101, 99, 100, 114, 49,
+	97, 120, 110, 45, 45, 57, 100, 98, 104, 98, 108, 103, 54, 100, 105, 120, 110, 45, 45, 98,
+	52, 119, 54, 48, 53, 102, 101, 114, 100, 120, 110, 45, 45, 98, 106, 97, 114, 107, 121, 45,
+	102, 121, 97, 120, 110, 45, 45, 98, 106, 100, 100, 97, 114, 45, 112, 116, 97, 120, 110, 45,
+	45, 98, 114, 110, 110, 121, 45, 119, 117, 97, 99, 120, 110, 45, 45, 100, 53, 113, 118, 55,
+	122, 56, 55, 54, 99, 120, 110, 45, 45, 100, 106, 114, 115, 55, 50, 100, 54, 117, 121, 120,
+	110, 45, 45, 102, 105, 113, 50, 50, 56, 99, 53, 104, 115, 120, 110, 45, 45, 104, 50, 98,
+	114, 101, 103, 51, 101, 118, 101, 120, 110, 45, 45, 105, 110, 100, 101, 114, 121, 45, 102, 121,
+	97, 120, 110, 45, 45, 106, 108, 113, 52, 56, 48, 110, 50, 114, 103, 120, 110, 45, 45, 106,
+	108, 115, 116, 101, 114, 45, 98, 121, 97, 120, 110, 45, 45, 107, 102, 106, 111, 114, 100, 45,
+	105, 117, 97, 120, 110, 45, 45, 107, 114, 97, 103, 101, 114, 45, 103, 121, 97, 120, 110, 45,
+	45, 107, 118, 105, 116, 115, 121, 45, 102, 121, 97, 120, 110, 45, 45, 108, 101, 115, 117, 110,
+	100, 45, 104, 117, 97, 120, 110, 45, 45, 109, 101, 114, 107, 101, 114, 45, 107, 117, 97, 120,
+	110, 45, 45, 109, 103, 98, 97, 51, 97, 51, 101, 106, 116, 120, 110, 45, 45, 109, 103, 98,
+	97, 51, 97, 52, 102, 114, 97, 120, 110, 45, 45, 109, 103, 98, 97, 97, 109, 55, 97, 56,
+	104, 120, 110, 45, 45, 109, 103, 98, 97, 121, 104, 55, 103, 112, 97, 120, 110, 45, 45, 109,
+	103, 98, 98, 104, 49, 97, 55, 49, 101, 120, 110, 45, 45, 109, 103, 98, 99, 97, 55, 100,
+	122, 100, 111, 120, 110, 45, 45, 109, 103, 98, 105, 52, 101, 99, 101, 120, 112, 120, 110, 45,
+	45, 109, 103, 98, 120, 52, 99, 100, 48, 97, 98, 120, 110, 45, 45, 109, 108, 115, 101, 108,
+	118, 45, 105, 117, 97, 120, 110, 45, 45, 109, 111, 114, 101, 107, 101, 45, 106, 117, 97, 120,
+	110, 45, 45, 109, 111, 115, 106, 101, 110, 45, 101, 121, 97, 120, 110, 45, 45, 110, 116, 115,
+	111, 48, 105, 113, 120, 51, 97, 120, 110, 45, 45, 111, 115, 116, 101, 114, 121, 45, 102, 121,
+	97, 120, 110, 45, 45, 114, 109, 115, 107, 111, 103, 45, 98, 121, 97, 120, 110, 45, 45, 114,
+	118, 99, 49, 101, 48, 97, 109, 51, 101, 120, 110, 45, 45, 114, 121, 114, 118, 105, 107, 45,
+	98, 121, 97, 120, 110, 45, 45, 115, 107, 105, 101, 114, 118, 45, 117, 116, 97, 120, 110, 45,
+	45, 115, 114, 102, 111, 108, 100, 45, 98, 121, 97, 120, 110, 45, 45, 115, 116, 102, 111, 108,
+	100, 45, 57, 120, 97, 120, 110, 45, 45, 117, 110, 106, 114, 103, 97, 45, 114, 116, 97, 120,
+	110, 45, 45, 118, 103, 115, 121, 45, 113, 111, 97, 48, 106, 120, 110, 45, 45, 118, 114, 103,
+	103, 116, 45, 120, 113, 97, 100, 121, 97, 109, 97, 116, 111, 107, 111, 114, 105, 121, 97, 109,
+	97, 49, 50, 51, 104, 106, 101, 109, 109, 101, 115, 105, 100, 101, 97, 100, 111, 98, 101, 97,
+	101, 109, 99, 108, 111, 117, 100, 97, 105, 114, 107, 105, 116, 97, 112, 112, 115, 45, 97, 117,
+	97, 105, 122, 117, 119, 97, 107, 97, 109, 97, 116, 115, 117, 97, 114, 116, 115, 97, 110, 100,
+	99, 114, 97, 102, 116, 115, 97, 115, 99, 111, 108, 105, 45, 112, 105, 99, 101, 110, 111, 97,
+	115, 115, 97, 115, 115, 105, 110, 97, 116, 105, 111, 110, 97, 116, 108, 97, 115, 115, 105, 97,
+	110, 45, 100, 101, 118, 97, 122, 117, 114, 101, 119, 101, 98, 115, 105, 116, 101, 115, 98, 101,
+	101, 108, 100, 101, 110, 103, 101, 108, 117, 105, 100, 98, 111, 116, 97, 110, 105, 99, 103, 97,
+	114, 100, 101, 110, 98, 117, 105, 108, 116, 119, 105, 116, 104, 100, 97, 114, 107, 99, 97, 108,
+	116, 97, 110, 105, 115, 115, 101, 116, 116, 97, 99, 97, 109, 112, 105, 110, 97, 103, 114, 97,
+	110, 100, 101, 99, 97, 114, 114, 97, 114, 97, 45, 109, 97, 115, 115, 97, 99, 101, 114, 116,
+	105, 102, 105, 99, 97, 116, 105, 111, 110, 99, 104, 101, 115, 97, 112, 101, 97, 107, 101, 98,
+	97, 121, 99, 105, 118, 105, 108, 97, 118, 105, 97, 116, 105, 111, 110, 99, 108, 111, 117, 100,
+	112, 108, 97, 116, 102, 111, 114, 109, 99, 108, 111, 117, 100, 121, 99, 108, 117, 115, 116, 101,
+	114, 99, 111, 109, 109, 117, 110, 105, 116, 121, 45, 112, 114, 111, 100, 101, 108, 108, 111, 103,
+	108, 105, 97, 115, 116, 114, 97, 100, 101, 118, 99, 100, 110, 97, 99, 99, 101, 115, 115, 111,
+	100, 105, 101, 108, 100, 100, 97, 110, 117, 111, 114, 114, 105, 100, 105, 118, 116, 116, 97, 115,
+	118, 117, 111, 116, 110, 97, 100, 121, 110, 100, 110, 115, 45, 111, 102, 102, 105, 99, 101, 100,
+	121, 110, 100, 110, 115, 45, 114, 101, 109, 111, 116, 101, 100, 121, 110, 100, 110, 115, 45, 115,
+	101, 114, 118, 101, 114, 101, 109, 105, 108, 105, 97, 114, 111, 109, 97, 103, 110, 97, 101, 110,
+	100, 111, 102, 105, 110, 116, 101, 114, 110, 101, 116, 101, 110, 116, 101, 114, 116, 97, 105, 110,
+	109, 101, 110, 116, 101, 115, 116, 45, 108, 101, 45, 112, 97, 116, 114, 111, 110, 102, 97, 110,
+	116, 97, 115, 121, 108, 101, 97, 103, 117, 101, 102, 97, 114, 109, 101, 113, 117, 105, 112, 109,
+	101, 110, 116, 102, 101, 100, 111, 114, 97, 112, 114, 111, 106, 101, 99, 116, 102, 114, 105, 117,
+	108, 105, 118, 103, 105, 117, 108, 105, 97, 102, 117, 116, 117, 114, 101, 104, 111, 115, 116, 105,
+	110, 103, 102, 117, 116, 117, 114, 101, 109, 97, 105, 108, 105, 110, 103, 103, 105, 101, 104, 116,
+	97, 118, 117, 111, 97, 116, 110, 97, 103, 105, 116, 104, 117, 98, 112, 114, 101, 118, 105, 101,
+	119, 103, 117, 111, 118, 100, 97, 103, 101, 97, 105, 100, 110, 117, 104, 101, 114, 101, 45, 102,
+	111, 114, 45, 109, 111, 114, 101, 104, 105, 103, 97, 115, 104, 105, 107, 97, 103, 97, 119, 97,
+	104, 105, 103, 97, 115, 104, 105, 107, 97, 103, 117, 114, 97, 104, 105, 103, 97, 115, 104, 105,
+	107, 117, 114, 117, 109, 101, 104, 105, 103, 97, 115, 104, 105, 110, 97, 114, 117, 115, 101, 104,
+	105, 103, 97, 115, 104, 105, 121, 97, 109, 97, 116, 111, 105, 109, 97, 103, 101, 97, 110, 100,
+	115, 111, 117, 110, 100, 105, 110, 116, 101, 114, 110, 97, 116, 105, 111, 110, 97, 108, 105, 115,
+	45, 97, 45, 100, 101, 109, 111, 99, 114, 97, 116, 105, 115, 45, 97, 45, 100, 101, 115, 105,
+	103, 110, 101, 114, 105, 115, 45, 97, 45, 109, 117, 115, 105, 99, 105, 97, 110, 105, 115, 45,
+	97, 45, 114, 111, 99, 107, 115, 116, 97, 114, 105, 115, 45, 97, 110, 45, 97, 99, 116, 114,
+	101, 115, 115, 105, 115, 45, 105, 110, 116, 111, 45, 97, 110, 105, 109, 101, 105, 115, 45, 105,
+	110, 116, 111, 45, 103, 97, 109, 101, 115, 105, 115, 45, 118, 101, 114, 121, 45, 115, 119, 101,
+	101, 116, 105, 115, 97, 45, 104, 111, 99, 107, 101, 121, 110, 117, 116, 107, 97, 119, 97, 99,
+	104, 105, 110, 97, 103, 97, 110, 111, 107, 105, 115, 111, 102, 117, 107, 117, 115, 104, 105, 109,
+	97, 107, 105, 116, 97, 104, 105, 114, 111, 115, 104, 105, 109, 97, 107, 117, 110, 115, 116, 115,
+	97, 109, 109, 108, 117, 110, 103, 108, 105, 102, 101, 105, 110, 115, 117, 114, 97, 110, 99, 101,
+	108, 105, 110, 111, 100, 101, 111, 98, 106, 101, 99, 116, 115, 108, 112, 117, 115, 101, 114, 99,
+	111, 110, 116, 101, 110, 116, 109, 97, 115, 115, 97, 45, 99, 97, 114, 114, 97, 114, 97, 109,
+	97, 116, 116, 97, 45, 118, 97, 114, 106, 106, 97, 116, 109, 105, 110, 97, 109, 105, 101, 99,
+	104, 105, 122, 101, 110, 109, 105, 110, 97, 109, 105, 115, 97, 110, 114, 105, 107, 117, 109, 111,
+	110, 122, 97, 45, 98, 114, 105, 97, 110, 122, 97, 109, 111, 110, 122, 97, 101, 98, 114, 105,
+	97, 110, 122, 97, 109, 121, 104, 111, 109, 101, 45, 115, 101, 114, 118, 101, 114, 109, 121, 116,
+	104, 105, 99, 45, 98, 101, 97, 115, 116, 115, 110, 97, 99, 104, 105, 107, 97, 116, 115, 117,
+	117, 114, 97, 110, 105, 101, 114, 117, 99, 104, 111, 109, 111, 115, 99, 105, 110, 111, 114, 101,
+	45, 111, 103, 45, 117, 118, 100, 97, 108, 111, 97, 109, 105, 115, 104, 105, 114, 97, 115, 97,
+	116, 111, 111, 99, 101, 97, 110, 111, 103, 114, 97, 112, 104, 105, 99, 111, 102, 102, 105, 99,
+	101, 45, 111, 110, 45, 116, 104, 101, 111, 115, 97, 107, 105, 107, 97, 109, 105, 106, 105, 109,
+	97, 111, 121, 115, 116, 114, 101, 45, 115, 108, 105, 100, 114, 101, 112, 101, 115, 97, 114, 111,
+	45, 117, 114, 98, 105, 110, 111, 112, 108, 117, 114, 105, 110, 97, 99, 105, 111, 110, 97, 108,
+	114, 101, 103, 103, 105, 111, 45, 101, 109, 105, 108, 105, 97, 114, 105, 107, 117, 122, 101, 110,
+	116, 97, 107, 97, 116, 97, 115, 51, 45, 97, 112, 45, 115, 111, 117, 116, 104, 45, 49, 115,
+	51, 45, 101, 120, 116, 101, 114, 110, 97, 108, 45, 49, 115, 97, 116, 115, 117, 109, 97, 115,
+	101, 110, 100, 97, 105, 115, 99, 114, 97, 112, 112, 101, 114, 45, 115, 105, 116, 101, 115, 101,
+	108, 108, 115, 121, 111, 117, 114, 104, 111, 109, 101, 115, 101, 114, 118, 101, 101, 120, 99, 104,
+	97, 110, 103, 101, 115, 101, 114, 118, 101, 104, 97, 108, 102, 108, 105, 102, 101, 115, 104, 105,
+	99, 104, 105, 107, 97, 115, 104, 117, 107, 117, 115, 104, 105, 109, 111, 107, 105, 116, 97, 121,
+	97, 109, 97, 115, 104, 105, 110, 121, 111, 115, 104, 105, 116, 111, 109, 105, 115, 107, 101, 100,
+	115, 109, 111, 107, 111, 114, 115, 101, 116, 115, 109, 97, 114, 116, 108, 97, 98, 101, 108, 105,
+	110, 103, 115, 111, 117, 116, 104, 99, 97, 114, 111, 108, 105, 110, 97, 115, 112, 97, 99, 101,
+	45, 116, 111, 45, 114, 101, 110, 116, 115, 116, 97, 116, 105, 99, 45, 97, 99, 99, 101, 115,
+	115, 116, 104, 105, 110, 103, 100, 117, 115, 116, 100, 97, 116, 97, 116, 114, 97, 101, 117, 109,
+	116, 103, 101, 114, 97, 100, 101, 116, 114, 97, 118, 101, 108, 99, 104, 97, 110, 110, 101, 108,
+	116, 114, 121, 99, 108, 111, 117, 100, 102, 108, 97, 114, 101, 117, 110, 117, 115, 117, 97, 108,
+	112, 101, 114, 115, 111, 110, 117, 114, 98, 105, 110, 111, 45, 112, 101, 115, 97, 114, 111, 118,
+	97, 108, 108, 101, 45, 100, 45, 97, 111, 115, 116, 97, 118, 101, 115, 116, 114, 101, 45, 115,
+	108, 105, 100, 114, 101, 118, 105, 98, 111, 45, 118, 97, 108, 101, 110, 116, 105, 97, 118, 105,
+	114, 116, 117, 97, 108, 115, 101, 114, 118, 101, 114, 119, 97, 116, 99, 104, 97, 110, 100, 99,
+	108, 111, 99, 107, 119, 101, 101, 107, 108, 121, 108, 111, 116, 116, 101, 114, 121, 119, 101, 108,
+	108, 98, 101, 105, 110, 103, 122, 111, 110, 101, 119, 111, 108, 116, 101, 114, 115, 107, 108, 117,
+	119, 101, 114, 120, 110, 45, 45, 48, 116, 114, 113, 55, 112, 55, 110, 110, 120, 110, 45, 45,
+	49, 50, 99, 49, 102, 101, 48, 98, 114, 120, 110, 45, 45, 52, 100, 98, 103, 100, 116, 121,
+	54, 99, 120, 110, 45, 45, 97, 118, 101, 114, 121, 45, 121, 117, 97, 120, 110, 45, 45, 98,
+	105, 100, 114, 45, 53, 110, 97, 99, 120, 110, 45, 45, 98, 105, 101, 118, 116, 45, 48, 113,
+	97, 120, 110, 45, 45, 99, 99, 107, 119, 99, 120, 101, 116, 100, 120, 110, 45, 45, 100, 114,
+	98, 97, 107, 45, 119, 117, 97, 120, 110, 45, 45, 101, 99, 107, 118, 100, 116, 99, 57, 100,
+	120, 110, 45, 45, 102, 105, 110, 110, 121, 45, 121, 117, 97, 120, 110, 45, 45, 102, 106, 111,
+	114, 100, 45, 108, 114, 97, 120, 110, 45, 45, 102, 112, 99, 114, 106, 57, 99, 51, 100, 120,
+	110, 45, 45, 102, 122, 99, 50, 99, 57, 101, 50, 99, 120, 110, 45, 45, 103, 106, 118, 105,
+	107, 45, 119, 117, 97, 120, 110, 45, 45, 104, 50, 98, 114, 106, 57, 99, 56, 99, 120, 110,
+	45, 45, 104, 51, 99, 117, 122, 107, 49, 100, 105, 120, 110, 45, 45, 104, 98, 109, 101, 114,
+	45, 120, 113, 97, 120, 110, 45, 45, 104, 112, 109, 105, 114, 45, 120, 113, 97, 120, 110, 45,
+	45, 107, 97, 114, 109, 121, 45, 121, 117, 97, 120, 110, 45, 45, 107, 115, 110, 101, 115, 45,
+	117, 117, 97, 120, 110, 45, 45, 108, 103, 114, 100, 45, 112, 111, 97, 99, 120, 110, 45, 45,
+	108, 104, 112, 112, 105, 45, 120, 113, 97, 120, 110, 45, 45, 108, 105, 110, 100, 115, 45, 112,
+	114, 97, 120, 110, 45, 45, 108, 111, 97, 98, 116, 45, 48, 113, 97, 120, 110, 45, 45, 108,
+	114, 100, 97, 108, 45, 115, 114, 97, 120, 110, 45, 45, 109, 115, 121, 45, 117, 108, 97, 48,
+	104, 120, 110, 45, 45, 109, 117, 111, 115, 116, 45, 48, 113, 97, 120, 110, 45, 45, 110, 114,
+	121, 45, 121, 108, 97, 53, 103, 120, 110, 45, 45, 111, 115, 121, 114, 111, 45, 119, 117, 97,
+	120, 110, 45, 45, 114, 104, 111, 108, 116, 45, 109, 114, 97, 120, 110, 45, 45, 114, 108, 97,
+	110, 100, 45, 117, 117, 97, 120, 110, 45, 45, 114, 115, 107, 111, 103, 45, 117, 117, 97, 120,
+	110, 45, 45, 114, 121, 107, 101, 110, 45, 118, 117, 97, 120, 110, 45, 45, 115, 97, 110, 100,
+	121, 45, 121, 117, 97, 120, 110, 45, 45, 115, 101, 114, 97, 108, 45, 108, 114, 97, 120, 110,
+	45, 45, 115, 107, 110, 105, 116, 45, 121, 113, 97, 120, 110, 45, 45, 115, 110, 97, 115, 101,
+	45, 110, 114, 97, 120, 110, 45, 45, 116, 105, 113, 52, 57, 120, 113, 121, 106, 120, 110, 45,
+	45, 116, 114, 97, 110, 121, 45, 121, 117, 97, 120, 110, 45, 45, 116, 114, 111, 109, 115, 45,
+	122, 117, 97, 120, 110, 45, 45, 116, 121, 115, 118, 114, 45, 118, 114, 97, 120, 110, 45, 45,
+	118, 114, 121, 45, 121, 108, 97, 53, 103, 120, 110, 45, 45, 121, 102, 114, 111, 52, 105, 54,
+	55, 111, 120, 110, 45, 45, 121, 103, 98, 105, 50, 97, 109, 109, 120, 49, 50, 51, 112, 97,
+	103, 105, 110, 97, 119, 101, 98, 97, 110, 116, 104, 114, 111, 112, 111, 108, 111, 103, 121, 97,
+	111, 115, 116, 97, 45, 118, 97, 108, 108, 101, 121, 97, 114, 99, 104, 105, 116, 101, 99, 116,
+	117, 114, 101, 97, 114, 116, 97, 110, 100, 100, 101, 115, 105, 103, 110, 97, 114, 116, 101, 100,
+	117, 99, 97, 116, 105, 111, 110, 97, 115, 99, 111, 108, 105, 112, 105, 99, 101, 110, 111, 97,
+	116, 45, 98, 97, 110, 100, 45, 99, 97, 109, 112, 97, 117, 116, 104, 103, 101, 97, 114, 97,
+	112, 112, 115, 97, 122, 117, 114, 101, 45, 109, 111, 98, 105, 108, 101, 98, 97, 99, 107, 112,
+	108, 97, 110, 101, 97, 112, 112, 98, 97, 104, 99, 99, 97, 118, 117, 111, 116, 110, 97, 98,
+	108, 97, 99, 107, 98, 97, 117, 100, 99, 100, 110, 99, 97, 114, 114, 97, 114, 97, 109, 97,
+	115, 115, 97, 99, 100, 110, 55, 55, 45, 115, 101, 99, 117, 114, 101, 99, 101, 115, 101, 110,
+	97, 45, 102, 111, 114, 108, 105, 99, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 99,
+	104, 105, 114, 111, 112, 114, 97, 99, 116, 105, 99, 99, 105, 118, 105, 108, 105, 115, 97, 116,
+	105, 111, 110, 99, 105, 118, 105, 108, 105, 122, 97, 116, 105, 111, 110, 99, 108, 105, 99, 107,
+	101, 116, 99, 108, 111, 117, 100, 99, 111, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 99,
+	117, 115, 116, 111, 109, 101, 114, 45, 111, 99, 105, 100, 101, 110, 111, 45, 115, 116, 97, 103,
+	105, 110, 103, 100, 105, 118, 116, 97, 115, 118, 117, 111, 100, 110, 97, 100, 114, 101, 97, 109,
+	104, 111, 115, 116, 101, 114, 115, 101, 110, 99, 121, 99, 108, 111, 112, 101, 100, 105, 99, 102,
+	97, 115, 104, 105, 111, 110, 115, 116, 111, 114, 101, 102, 101, 100, 111, 114, 97, 112, 101, 111,
+	112, 108, 101, 102, 108, 121, 110, 110, 104, 111, 115, 116, 105, 110, 103, 102, 111, 108, 105, 111,
+	110, 101, 116, 119, 111, 114, 107, 102, 111, 114, 108, 105, 45, 99, 101, 115, 101, 110, 97, 102,
+	111, 114, 116, 109, 105, 115, 115, 111, 117, 108, 97, 102, 114, 97, 109, 101, 114, 99, 97, 110,
+	118, 97, 115, 102, 114, 97, 110, 122, 105, 115, 107, 97, 110, 101, 114, 103, 101, 110, 116, 108,
+	101, 110, 116, 97, 112, 105, 115, 104, 97, 109, 45, 114, 97, 100, 105, 111, 45, 111, 112, 104,
+	97, 109, 97, 116, 111, 110, 98, 101, 116, 115, 117, 104, 97, 109, 109, 97, 114, 102, 101, 97,
+	115, 116, 97, 104, 97, 116, 116, 102, 106, 101, 108, 108, 100, 97, 108, 104, 105, 103, 97, 115,
+	104, 105, 105, 122, 117, 109, 111, 104, 105, 103, 97, 115, 104, 105, 111, 115, 97, 107, 97, 104,
+	105, 103, 97, 115, 104, 105, 116, 115, 117, 110, 111, 104, 105, 116, 97, 99, 104, 105, 111, 109,
+	105, 121, 97, 104, 111, 115, 116, 121, 104, 111, 115, 116, 105, 110, 103, 104, 115, 45, 104, 101,
+	105, 108, 98, 114, 111, 110, 110, 105, 108, 108, 117, 115, 116, 114, 97, 116, 105, 111, 110, 105,
+	108, 111, 118, 101, 99, 111, 108, 108, 101, 103, 101, 105, 109, 112, 101, 114, 116, 114, 105, 120,
+	99, 100, 110, 105, 110, 100, 105, 97, 110, 97, 112, 111, 108, 105, 115, 105, 110, 100, 105, 97,
+	110, 109, 97, 114, 107, 101, 116, 105, 110, 115, 116, 97, 110, 116, 99, 108, 111, 117, 100, 105,
+	110, 116, 101, 108, 108, 105, 103, 101, 110, 99, 101, 105, 110, 116, 101, 114, 110, 101, 116, 45,
+	100, 110, 115, 105, 115, 45, 97, 45, 98, 108, 111, 103, 103, 101, 114, 105, 115, 45, 97, 45,
+	99, 97, 116, 101, 114, 101, 114, 105, 115, 45, 97, 45, 108, 105, 98, 101, 114, 97, 108, 105,
+	115, 45, 97, 45, 112, 97, 105, 110, 116, 101, 114, 105, 115, 45, 97, 45, 112, 97, 116, 115,
+	102, 97, 110, 105, 115, 45, 97, 45, 115, 116, 117, 100, 101, 110, 116, 105, 115, 45, 97, 45,
+	116, 101, 97, 99, 104, 101, 114, 105, 115, 45, 97, 110, 45, 97, 114, 116, 105, 115, 116, 105,
+	115, 45, 99, 101, 114, 116, 105, 102, 105, 101, 100, 105, 115, 45, 105, 110, 116, 111, 45, 99,
+	97, 114, 115, 105, 115, 45, 118, 101, 114, 121, 45, 101, 118, 105, 108, 105, 115, 45, 118, 101,
+	114, 121, 45, 103, 111, 111, 100, 105, 115, 45, 118, 101, 114, 121, 45, 110, 105, 99, 101, 105,
+	116, 99, 111, 117, 108, 100, 98, 101, 119, 111, 114, 106, 101, 108, 101, 110, 105, 97, 45, 103,
+	111, 114, 97, 106, 105, 110, 115, 101, 107, 105, 107, 111, 103, 101, 110, 107, 97, 107, 97, 109,
+	105, 103, 97, 104, 97, 114, 97, 107, 97, 109, 105, 107, 105, 116, 97, 121, 97, 109, 97, 107,
+	97, 109, 105, 115, 117, 110, 97, 103, 97, 119, 97, 107, 104, 109, 101, 108, 110, 105, 116, 115,
+	107, 105, 121, 107, 104, 109, 101, 108, 110, 121, 116, 115, 107, 121, 105, 107, 105, 116, 97, 115,
+	104, 105, 111, 98, 97, 114, 97, 107, 111, 109, 97, 116, 115, 117, 115, 104, 105, 109, 97, 107,
+	114, 105, 115, 116, 105, 97, 110, 115, 97, 110, 100, 107, 114, 105, 115, 116, 105, 97, 110, 115,
+	117, 110, 100, 107, 114, 111, 107, 115, 116, 97, 100, 101, 108, 118, 97, 107, 117, 114, 111, 109,
+	97, 116, 115, 117, 110, 97, 105, 108, 97, 97, 107, 101, 115, 118, 117, 101, 109, 105, 101, 108,
+	99, 117, 98, 101, 45, 115, 101, 114, 118, 101, 114, 108, 111, 99, 97, 108, 104, 105, 115, 116,
+	111, 114, 121, 108, 112, 108, 102, 105, 110, 97, 110, 99, 105, 97, 108, 109, 97, 115, 115, 97,
+	99, 97, 114, 114, 97, 114, 97, 109, 105, 110, 97, 109, 105, 102, 117, 114, 97, 110, 111, 109,
+	105, 110, 97, 109, 105, 109, 105, 110, 111, 119, 97, 109, 105, 110, 97, 109, 105, 117, 111, 110,
+	117, 109, 97, 109, 111, 110, 122, 97, 98, 114, 105, 97, 110, 122, 97, 109, 117, 115, 101, 117,
+	109, 99, 101, 110, 116, 101, 114, 109, 121, 115, 104, 111, 112, 98, 108, 111, 99, 107, 115, 109,
+	121, 115, 112, 114, 101, 97, 100, 115, 104, 111, 112, 110, 97, 107, 97, 115, 97, 116, 115, 117,
+	110, 97, 105, 110, 97, 107, 97, 116, 111, 109, 98, 101, 116, 115, 117, 110, 97, 115, 117, 115,
+	104, 105, 111, 98, 97, 114, 97, 110, 101, 115, 111, 100, 100, 116, 97, 110, 103, 101, 110, 110,
+	101, 119, 104, 97, 109, 112, 115, 104, 105, 114, 101, 110, 105, 115, 104, 105, 97, 119, 97, 107,
+	117, 114, 97, 110, 105, 115, 104, 105, 107, 97, 116, 115, 117, 114, 97, 110, 105, 115, 104, 105,
+	110, 111, 111, 109, 111, 116, 101, 110, 105, 115, 104, 105, 110, 111, 115, 104, 105, 109, 97, 110,
+	111, 100, 101, 98, 97, 108, 97, 110, 99, 101, 114, 110, 111, 114, 100, 101, 115, 116, 101, 45,
+	105, 100, 99, 111, 108, 98, 105, 97, 45, 116, 101, 109, 112, 105, 111, 111, 110, 102, 108, 97,
+	115, 104, 100, 114, 105, 118, 101, 112, 97, 103, 101, 102, 114, 111, 110, 116, 97, 112, 112, 112,
+	97, 110, 116, 104, 101, 111, 110, 115, 105, 116, 101, 112, 101, 115, 97, 114, 111, 117, 114, 98,
+	105, 110, 111, 112, 111, 115, 116, 109, 97, 110, 45, 101, 99, 104, 111, 112, 114, 101, 113, 117,
+	97, 108, 105, 102, 121, 109, 101, 112, 114, 101, 115, 101, 114, 118, 97, 116, 105, 111, 110, 112,
+	117, 98, 108, 105, 115, 104, 112, 114, 111, 120, 121, 113, 117, 105, 99, 107, 99, 111, 110, 110,
+	101, 99, 116, 113, 117, 105, 112, 101, 108, 101, 109, 101, 110, 116, 115, 114, 97, 103, 45, 99,
+	108, 111, 117, 100, 45, 99, 104, 114, 101, 103, 103, 105, 111, 101, 109, 105, 108, 105, 97, 114,
+	101, 103, 114, 117, 104, 111, 115, 116, 105, 110, 103, 114, 101, 115, 105, 110, 115, 116, 97, 103,
+	105, 110, 103, 114, 105, 111, 100, 101, 106, 97, 110, 101, 105, 114, 111, 115, 51, 45, 101, 117,
+	45, 119, 101, 115, 116, 45, 49, 115, 51, 45, 101, 117, 45, 119, 101, 115, 116, 45, 50, 115,
+	51, 45, 101, 117, 45, 119, 101, 115, 116, 45, 51, 115, 51, 45, 115, 97, 45, 101, 97, 115,
+	116, 45, 49, 115, 51, 45, 117, 115, 45, 101, 97, 115, 116, 45, 50, 115, 51, 45, 117, 115,
+	45, 119, 101, 115, 116, 45, 49, 115, 51, 45, 117, 115, 45, 119, 101, 115, 116, 45, 50, 115,
+	97, 108, 118, 97, 100, 111, 114, 100, 97, 108, 105, 115, 97, 110, 100, 110, 101, 115, 115, 106,
+	111, 101, 110, 115, 97, 110, 102, 114, 97, 110, 99, 105, 115, 99, 111, 115, 97, 110, 116, 97,
+	98, 97, 114, 98, 97, 114, 97, 115, 97, 115, 107, 97, 116, 99, 104, 101, 119, 97, 110, 115,
+	99, 104, 108, 101, 115, 105, 115, 99, 104, 101, 115, 115, 99, 104, 111, 108, 97, 114, 115, 104,
+	105, 112, 115, 115, 101, 114, 118, 101, 115, 97, 114, 99, 97, 115, 109, 115, 104, 105, 110, 97,
+	110, 111, 109, 97, 99, 104, 105, 115, 104, 105, 110, 107, 97, 109, 105, 103, 111, 116, 111, 115,
+	104, 105, 110, 115, 104, 105, 110, 111, 116, 115, 117, 115, 111, 114, 45, 118, 97, 114, 97, 110,
+	103, 101, 114, 115, 112, 101, 101, 100, 112, 97, 114, 116, 110, 101, 114, 115, 116, 97, 108, 111,
+	119, 97, 45, 119, 111, 108, 97, 115, 116, 97, 114, 97, 99, 104, 111, 119, 105, 99, 101, 115,
+	116, 112, 101, 116, 101, 114, 115, 98, 117, 114, 103, 115, 116, 114, 101, 97, 109, 108, 105, 116,
+	97, 112, 112, 115, 116, 117, 102, 102, 45, 52, 45, 115, 97, 108, 101, 115, 117, 114, 103, 101,
+	111, 110, 115, 104, 97, 108, 108, 116, 101, 97, 99, 104, 101, 115, 45, 121, 111, 103, 97, 116,
+	101, 109, 112, 105, 111, 45, 111, 108, 98, 105, 97, 116, 111, 110, 100, 97, 98, 97, 121, 97,
+	115, 104, 105, 116, 114, 101, 110, 100, 104, 111, 115, 116, 105, 110, 103, 116, 114, 121, 45, 115,
+	110, 111, 119, 112, 108, 111, 119, 116, 115, 117, 114, 117, 103, 97, 115, 104, 105, 109, 97, 117,
+	114, 98, 105, 110, 111, 112, 101, 115, 97, 114, 111, 118, 97, 108, 108, 101, 45, 100, 97, 111,
+	115, 116, 97, 118, 97, 108, 108, 101, 100, 45, 97, 111, 115, 116, 97, 118, 97, 108, 108, 101,
+	101, 45, 97, 111, 115, 116, 101, 118, 97, 108, 108, 101, 101, 100, 97, 111, 115, 116, 101, 118,
+	101, 114, 115, 105, 99, 104, 101, 114, 117, 110, 103, 118, 101, 115, 116, 114, 101, 45, 116, 111,
+	116, 101, 110, 118, 105, 98, 111, 118, 97, 108, 101, 110, 116, 105, 97, 118, 105, 114, 116, 117,
+	97, 108, 45, 117, 115, 101, 114, 118, 105, 114, 116, 117, 97, 108, 99, 108, 111, 117, 100, 118,
+	117, 108, 116, 114, 111, 98, 106, 101, 99, 116, 115, 119, 97, 115, 104, 105, 110, 103, 116, 111,
+	110, 100, 99, 119, 111, 108, 116, 108, 97, 98, 45, 100, 101, 109, 111, 119, 111, 114, 107, 105,
+	110, 103, 103, 114, 111, 117, 112, 119, 111, 114, 107, 105, 115, 98, 111, 114, 105, 110, 103, 119,
+	112, 104, 111, 115, 116, 101, 100, 109, 97, 105, 108, 120, 110, 45, 45, 51, 101, 48, 98, 55,
+	48, 55, 101, 120, 110, 45, 45, 52, 53, 98, 114, 53, 99, 121, 108, 120, 110, 45, 45, 52,
+	100, 98, 114, 107, 48, 99, 101, 120, 110, 45, 45, 55, 116, 48, 97, 50, 54, 52, 99, 120,
+	110, 45, 45, 56, 48, 97, 100, 120, 104, 107, 115, 120, 110, 45, 45, 56, 48, 97, 115, 101,
+	104, 100, 98, 120, 110, 45, 45, 56, 121, 48, 97, 48, 54, 51, 97, 120, 110, 45, 45, 97,
+	110, 100, 121, 45, 105, 114, 97, 120, 110, 45, 45, 97, 115, 107, 121, 45, 105, 114, 97, 120,
+	110, 45, 45, 98, 108, 116, 45, 101, 108, 97, 98, 120, 110, 45, 45, 98, 109, 108, 111, 45,
+	103, 114, 97, 120, 110, 45, 45, 98, 114, 117, 109, 45, 118, 111, 97, 120, 110, 45, 45, 100,
+	110, 110, 97, 45, 103, 114, 97, 120, 110, 45, 45, 100, 121, 114, 121, 45, 105, 114, 97, 120,
+	110, 45, 45, 102, 108, 111, 114, 45, 106, 114, 97, 120, 110, 45, 45, 102, 114, 100, 101, 45,
+	103, 114, 97, 120, 110, 45, 45, 102, 114, 110, 97, 45, 119, 111, 97, 120, 110, 45, 45, 102,
+	114, 121, 97, 45, 104, 114, 97, 120, 110, 45, 45, 103, 99, 107, 114, 51, 102, 48, 102, 120,
+	110, 45, 45, 103, 108, 115, 45, 101, 108, 97, 99, 120, 110, 45, 45, 104, 101, 114, 121, 45,
+	105, 114, 97, 120, 110, 45, 45, 104, 111, 98, 108, 45, 105, 114, 97, 120, 110, 45, 45, 107,
+	108, 98, 117, 45, 119, 111, 97, 120, 110, 45, 45, 108, 116, 101, 110, 45, 103, 114, 97, 120,
+	110, 45, 45, 108, 117, 114, 121, 45, 105, 114, 97, 120, 110, 45, 45, 109, 51, 99, 104, 48,
+	106, 51, 97, 120, 110, 45, 45, 109, 101, 108, 121, 45, 105, 114, 97, 120, 110, 45, 45, 109,
+	103, 98, 50, 100, 100, 101, 115, 120, 110, 45, 45, 109, 103, 98, 57, 97, 119, 98, 102, 120,
+	110, 45, 45, 109, 103, 98, 97, 98, 50, 98, 100, 120, 110, 45, 45, 109, 103, 98, 103, 117,
+	56, 50, 97, 120, 110, 45, 45, 109, 103, 98, 112, 108, 50, 102, 104, 120, 110, 45, 45, 109,
+	103, 98, 116, 51, 100, 104, 100, 120, 110, 45, 45, 109, 103, 98, 116, 102, 56, 102, 108, 120,
+	110, 45, 45, 109, 107, 49, 98, 117, 52, 52, 99, 120, 110, 45, 45, 109, 111, 114, 105, 45,
+	113, 115, 97, 120, 110, 45, 45, 110, 103, 98, 99, 53, 97, 122, 100, 120, 110, 45, 45, 110,
+	103, 98, 101, 57, 101, 48, 97, 120, 110, 45, 45, 111, 103, 98, 112, 102, 56, 102, 108, 120,
+	110, 45, 45, 113, 99, 107, 97, 49, 112, 109, 99, 120, 110, 45, 45, 114, 97, 100, 121, 45,
+	105, 114, 97, 120, 110, 45, 45, 114, 100, 97, 108, 45, 112, 111, 97, 120, 110, 45, 45, 114,
+	100, 121, 45, 48, 110, 97, 98, 120, 110, 45, 45, 114, 105, 115, 97, 45, 53, 110, 97, 120,
+	110, 45, 45, 114, 105, 115, 114, 45, 105, 114, 97, 120, 110, 45, 45, 114, 114, 111, 115, 45,
+	103, 114, 97, 120, 110, 45, 45, 114, 115, 116, 97, 45, 102, 114, 97, 120, 110, 45, 45, 115,
+	103, 110, 101, 45, 103, 114, 97, 120, 110, 45, 45, 115, 107, 106, 107, 45, 115, 111, 97, 120,
+	110, 45, 45, 115, 108, 97, 116, 45, 53, 110, 97, 120, 110, 45, 45, 115, 108, 116, 45, 101,
+	108, 97, 98, 120, 110, 45, 45, 115, 109, 108, 97, 45, 104, 114, 97, 120, 110, 45, 45, 115,
+	109, 110, 97, 45, 103, 114, 97, 120, 110, 45, 45, 115, 110, 101, 115, 45, 112, 111, 97, 120,
+	110, 45, 45, 115, 110, 115, 97, 45, 114, 111, 97, 120, 110, 45, 45, 115, 114, 117, 109, 45,
+	103, 114, 97, 120, 110, 45, 45, 116, 106, 109, 101, 45, 104, 114, 97, 120, 110, 45, 45, 116,
+	114, 110, 97, 45, 119, 111, 97, 120, 110, 45, 45, 118, 97, 100, 115, 45, 106, 114, 97, 120,
+	110, 45, 45, 118, 97, 114, 100, 45, 106, 114, 97, 120, 110, 45, 45, 118, 103, 97, 110, 45,
+	113, 111, 97, 120, 110, 45, 45, 118, 108, 101, 114, 45, 113, 111, 97, 120, 110, 45, 45, 122,
+	102, 48, 97, 111, 54, 52, 97, 121, 97, 109, 97, 116, 111, 116, 97, 107, 97, 100, 97, 122,
+	97, 112, 111, 114, 105, 122, 104, 122, 104, 105, 97, 49, 50, 51, 104, 111, 109, 101, 112, 97,
+	103, 101, 49, 50, 51, 107, 111, 116, 105, 115, 105, 118, 117, 49, 50, 51, 119, 101, 98, 115,
+	101, 105, 116, 101, 97, 99, 99, 111, 117, 110, 116, 97, 110, 116, 115, 97, 99, 116, 105, 118,
+	101, 116, 114, 97, 105, 108, 97, 103, 114, 105, 99, 117, 108, 116, 117, 114, 101, 97, 108, 101,
+	115, 115, 97, 110, 100, 114, 105, 97, 97, 109, 101, 114, 105, 99, 97, 110, 97, 114, 116, 97,
+	111, 115, 116, 97, 118, 97, 108, 108, 101, 121, 97, 114, 99, 104, 97, 101, 111, 108, 111, 103,
+	121, 97, 114, 99, 104, 105, 116, 101, 99, 116, 101, 115, 97, 114, 107, 104, 97, 110, 103, 101,
+	108, 115, 107, 98, 97, 104, 99, 97, 118, 117, 111, 116, 110, 97, 98, 97, 110, 122, 97, 105,
+	99, 108, 111, 117, 100, 98, 97, 114, 99, 108, 97, 121, 99, 97, 114, 100, 98, 97, 114, 115,
+	121, 99, 101, 110, 116, 101, 114, 98, 97, 114, 115, 121, 111, 110, 108, 105, 110, 101, 98, 97,
+	115, 105, 99, 115, 101, 114, 118, 101, 114, 98, 101, 97, 103, 108, 101, 98, 111, 97, 114, 100,
+	98, 101, 97, 114, 97, 108, 118, 97, 104, 107, 105, 98, 101, 116, 116, 101, 114, 45, 116, 104,
+	97, 110, 98, 108, 97, 99, 107, 102, 114, 105, 100, 97, 121, 98, 108, 111, 99, 107, 98, 117,
+	115, 116, 101, 114, 98, 111, 108, 101, 115, 108, 97, 119, 105, 101, 99, 98, 111, 117, 110, 116,
+	121, 45, 102, 117, 108, 108, 98, 114, 105, 100, 103, 101, 115, 116, 111, 110, 101, 98, 114, 111,
+	110, 110, 111, 121, 115, 117, 110, 100, 98, 117, 110, 103, 111, 116, 97, 107, 97, 100, 97, 99,
+	97, 98, 108, 101, 45, 109, 111, 100, 101, 109, 99, 97, 108, 118, 105, 110, 107, 108, 101, 105,
+	110, 99, 101, 115, 101, 110, 97, 102, 111, 114, 108, 105, 99, 104, 97, 110, 110, 101, 108, 115,
+	100, 118, 114, 99, 104, 97, 116, 116, 97, 110, 111, 111, 103, 97, 99, 104, 105, 112, 112, 117,
+	98, 101, 116, 115, 117, 99, 108, 105, 99, 107, 114, 105, 115, 105, 110, 103, 99, 108, 111, 117,
+	100, 97, 99, 99, 101, 115, 115, 99, 111, 110, 116, 114, 97, 99, 116, 111, 114, 115, 99, 111,
+	111, 112, 101, 114, 97, 116, 105, 118, 97, 99, 111, 114, 112, 111, 114, 97, 116, 105, 111, 110,
+	99, 114, 101, 100, 105, 116, 117, 110, 105, 111, 110, 99, 114, 121, 112, 116, 111, 110, 111, 109,
+	105, 99, 100, 97, 118, 118, 101, 110, 106, 97, 114, 103, 97, 100, 101, 108, 109, 101, 110, 104,
+	111, 114, 115, 116, 100, 101, 118, 45, 98, 117, 105, 108, 100, 101, 114, 100, 101, 118, 101, 108,
+	111, 112, 109, 101, 110, 116, 100, 105, 115, 99, 111, 114, 100, 115, 97, 121, 115, 100, 105, 116,
+	99, 104, 121, 111, 117, 114, 105, 112, 100, 111, 101, 115, 110, 116, 101, 120, 105, 115, 116, 100,
+	121, 110, 97, 109, 105, 99, 45, 100, 110, 115, 100, 121, 110, 100, 110, 115, 45, 98, 108, 111,
+	103, 100, 121, 110, 100, 110, 115, 45, 102, 114, 101, 101, 100, 121, 110, 100, 110, 115, 45, 104,
+	111, 109, 101, 100, 121, 110, 100, 110, 115, 45, 109, 97, 105, 108, 100, 121, 110, 100, 110, 115,
+	45, 112, 105, 99, 115, 100, 121, 110, 100, 110, 115, 45, 119, 105, 107, 105, 100, 121, 110, 100,
+	110, 115, 45, 119, 111, 114, 107, 101, 100, 103, 101, 99, 111, 109, 112, 117, 116, 101, 101, 100,
+	117, 99, 97, 116, 105, 111, 110, 97, 108, 101, 110, 103, 105, 110, 101, 101, 114, 105, 110, 103,
+	101, 110, 116, 101, 114, 112, 114, 105, 115, 101, 115, 102, 97, 115, 116, 108, 121, 45, 101, 100,
+	103, 101, 102, 104, 45, 109, 117, 101, 110, 115, 116, 101, 114, 102, 105, 108, 101, 103, 101, 97,
+	114, 45, 97, 117, 102, 105, 108, 101, 103, 101, 97, 114, 45, 100, 101, 102, 105, 108, 101, 103,
+	101, 97, 114, 45, 103, 98, 102, 105, 108, 101, 103, 101, 97, 114, 45, 105, 101, 102, 105, 108,
+	101, 103, 101, 97, 114, 45, 106, 112, 102, 105, 108, 101, 103, 101, 97, 114, 45, 115, 103, 102,
+	105, 114, 101, 98, 97, 115, 101, 97, 112, 112, 102, 108, 101, 107, 107, 101, 102, 106, 111, 114,
+	100, 102, 111, 111, 100, 110, 101, 116, 119, 111, 114, 107, 102, 111, 114, 103, 101, 98, 108, 111,
+	99, 107, 115, 102, 111, 114, 108, 105, 99, 101, 115, 101, 110, 97, 102, 114, 101, 100, 114, 105,
+	107, 115, 116, 97, 100, 102, 114, 101, 101, 100, 101, 115, 107, 116, 111, 112, 102, 114, 101, 101,
+	109, 97, 115, 111, 110, 114, 121, 102, 117, 106, 105, 121, 111, 115, 104, 105, 100, 97, 102, 117,
+	107, 117, 99, 104, 105, 121, 97, 109, 97, 103, 97, 109, 101, 45, 115, 101, 114, 118, 101, 114,
+	103, 101, 109, 111, 108, 111, 103, 105, 99, 97, 108, 103, 111, 116, 112, 97, 110, 116, 104, 101,
+	111, 110, 103, 114, 97, 110, 100, 114, 97, 112, 105, 100, 115, 104, 97, 99, 104, 105, 114, 111,
+	103, 97, 116, 97, 104, 97, 110, 100, 99, 114, 97, 102, 116, 101, 100, 104, 97, 110, 103, 103,
+	108, 105, 100, 105, 110, 103, 104, 97, 116, 115, 117, 107, 97, 105, 99, 104, 105, 104, 105, 103,
+	97, 115, 104, 105, 107, 97, 119, 97, 104, 105, 116, 97, 99, 104, 105, 110, 97, 107, 97, 104,
+	111, 108, 109, 101, 115, 116, 114, 97, 110, 100, 105, 110, 45, 116, 104, 101, 45, 98, 97, 110,
+	100, 105, 110, 116, 101, 114, 97, 99, 116, 105, 118, 101, 105, 110, 118, 101, 115, 116, 109, 101,
+	110, 116, 115, 105, 115, 45, 97, 45, 100, 111, 99, 116, 111, 114, 105, 115, 45, 97, 45, 104,
+	117, 110, 116, 101, 114, 105, 115, 45, 97, 45, 107, 110, 105, 103, 104, 116, 105, 115, 45, 97,
+	45, 108, 97, 119, 121, 101, 114, 105, 115, 45, 97, 45, 112, 108, 97, 121, 101, 114, 105, 115,
+	45, 97, 45, 115, 111, 120, 102, 97, 110, 105, 115, 45, 97, 45, 116, 101, 99, 104, 105, 101,
+	105, 115, 45, 97, 110, 45, 97, 99, 116, 111, 114, 105, 115, 45, 117, 98, 101, 114, 108, 101,
+	101, 116, 105, 115, 45, 118, 101, 114, 121, 45, 98, 97, 100, 105, 115, 101, 114, 118, 115, 99,
+	104, 117, 108, 101, 106, 117, 100, 121, 103, 97, 114, 108, 97, 110, 100, 107, 97, 109, 105, 97,
+	109, 97, 107, 117, 115, 97, 107, 97, 109, 105, 115, 104, 105, 104, 111, 114, 111, 107, 97, 115,
+	104, 105, 119, 97, 122, 97, 107, 105, 107, 97, 115, 117, 109, 105, 103, 97, 117, 114, 97, 107,
+	97, 122, 116, 101, 108, 101, 112, 111, 114, 116, 107, 101, 114, 114, 121, 104, 111, 116, 101, 108,
+	115, 107, 110, 105, 103, 104, 116, 112, 111, 105, 110, 116, 107, 111, 110, 103, 115, 118, 105, 110,
+	103, 101, 114, 108, 97, 109, 98, 111, 114, 103, 104, 105, 110, 105, 108, 97, 110, 100, 45, 52,
+	45, 115, 97, 108, 101, 108, 101, 97, 110, 103, 97, 118, 105, 105, 107, 97, 108, 101, 119, 105,
+	115, 109, 105, 108, 108, 101, 114, 108, 105, 108, 108, 101, 104, 97, 109, 109, 101, 114, 109, 97,
+	103, 101, 110, 116, 111, 115, 105, 116, 101, 109, 97, 105, 110, 116, 101, 110, 97, 110, 99, 101,
+	109, 97, 108, 97, 116, 118, 117, 111, 112, 109, 105, 109, 97, 115, 115, 105, 118, 101, 103, 114,
+	105, 100, 109, 101, 115, 115, 119, 105, 116, 104, 100, 110, 115, 109, 101, 116, 97, 99, 101, 110,
+	116, 114, 117, 109, 109, 105, 100, 97, 116, 108, 97, 110, 116, 105, 99, 109, 105, 110, 97, 109,
+	105, 45, 97, 108, 112, 115, 109, 105, 110, 97, 109, 105, 97, 119, 97, 106, 105, 109, 105, 110,
+	97, 109, 105, 100, 97, 105, 116, 111, 109, 105, 110, 97, 109, 105, 111, 103, 117, 110, 105, 109,
+	105, 115, 99, 111, 110, 102, 117, 115, 101, 100, 109, 111, 116, 111, 114, 99, 121, 99, 108, 101,
+	115, 109, 111, 122, 105, 108, 108, 97, 45, 105, 111, 116, 109, 121, 45, 102, 105, 114, 101, 119,
+	97, 108, 108, 110, 97, 107, 97, 110, 105, 105, 107, 97, 119, 97, 110, 97, 107, 97, 116, 115,
+	117, 103, 97, 119, 97, 110, 101, 100, 114, 101, 45, 101, 105, 107, 101, 114, 110, 105, 115, 104,
+	105, 110, 111, 109, 105, 121, 97, 110, 105, 115, 104, 105, 111, 107, 111, 112, 112, 101, 110, 111,
+	98, 111, 114, 105, 98, 101, 116, 115, 117, 110, 111, 114, 100, 45, 97, 117, 114, 100, 97, 108,
+	110, 111, 114, 100, 114, 101, 45, 108, 97, 110, 100, 110, 111, 115, 112, 97, 109, 112, 114, 111,
+	120, 121, 110, 111, 122, 97, 119, 97, 111, 110, 115, 101, 110, 111, 108, 97, 121, 97, 110, 103,
+	114, 111, 117, 112, 111, 108, 98, 105, 97, 116, 101, 109, 112, 105, 111, 111, 109, 105, 104, 97,
+	99, 104, 105, 109, 97, 110, 111, 114, 97, 110, 103, 101, 99, 108, 111, 117, 100, 111, 114, 101,
+	103, 111, 110, 116, 114, 97, 105, 108, 111, 115, 97, 107, 97, 115, 97, 121, 97, 109, 97, 111,
+	115, 116, 114, 101, 45, 116, 111, 116, 101, 110, 111, 119, 110, 112, 114, 111, 118, 105, 100, 101,
+	114, 112, 97, 108, 109, 115, 112, 114, 105, 110, 103, 115, 112, 97, 114, 97, 99, 104, 117, 116,
+	105, 110, 103, 112, 97, 114, 97, 103, 108, 105, 100, 105, 110, 103, 112, 104, 97, 114, 109, 97,
+	99, 105, 101, 110, 115, 112, 104, 111, 116, 111, 103, 114, 97, 112, 104, 121, 112, 108, 97, 110,
+	101, 116, 97, 114, 105, 117, 109, 112, 108, 97, 116, 116, 101, 114, 45, 97, 112, 112, 112, 114,
+	105, 118, 97, 116, 101, 108, 105, 110, 107, 112, 114, 111, 100, 117, 99, 116, 105, 111, 110, 115,
+	112, 114, 111, 102, 101, 115, 105, 111, 110, 97, 108, 112, 114, 111, 103, 114, 101, 115, 115, 105,
+	118, 101, 113, 117, 97, 108, 105, 102, 105, 111, 97, 112, 112, 114, 97, 102, 102, 108, 101, 101,
+	110, 116, 114, 121, 114, 97, 104, 107, 107, 101, 114, 97, 118, 106, 117, 114, 101, 97, 100, 116,
+	104, 101, 100, 111, 99, 115, 114, 101, 100, 117, 109, 98, 114, 101, 108, 108, 97, 114, 101, 115,
+	105, 110, 100, 101, 118, 105, 99, 101, 114, 105, 115, 104, 105, 114, 105, 102, 117, 106, 105, 115,
+	97, 107, 97, 105, 109, 105, 110, 97, 116, 111, 115, 97, 111, 98, 101, 114, 110, 97, 114, 100,
+	111, 115, 97, 118, 101, 105, 110, 99, 108, 111, 117, 100, 115, 99, 104, 111, 101, 110, 98, 114,
+	117, 110, 110, 115, 99, 104, 111, 107, 111, 108, 97, 100, 101, 110, 115, 99, 104, 117, 108, 115,
+	101, 114, 118, 101, 114, 115, 101, 108, 108, 115, 45, 102, 111, 114, 45, 117, 115, 101, 114, 118,
+	101, 104, 117, 109, 111, 117, 114, 115, 104, 105, 102, 116, 99, 114, 121, 112, 116, 111, 115, 104,
+	105, 106, 111, 110, 97, 119, 97, 116, 101, 115, 104, 105, 107, 111, 107, 117, 99, 104, 117, 111,
+	115, 104, 105, 109, 111, 110, 111, 115, 101, 107, 105, 115, 104, 105, 122, 117, 107, 117, 105, 115,
+	104, 105, 115, 111, 110, 100, 114, 101, 45, 108, 97, 110, 100, 115, 116, 103, 45, 98, 117, 105,
+	108, 100, 101, 114, 115, 116, 111, 114, 45, 101, 108, 118, 100, 97, 108, 115, 116, 117, 102, 102,
+	116, 111, 114, 101, 97, 100, 115, 119, 101, 101, 116, 112, 101, 112, 112, 101, 114, 115, 119, 105,
+	110, 111, 117, 106, 115, 99, 105, 101, 115, 121, 110, 111, 108, 111, 103, 121, 45, 100, 115, 116,
+	97, 109, 97, 116, 115, 117, 107, 117, 114, 105, 116, 97, 116, 101, 98, 97, 121, 97, 115, 104,
+	105, 116, 101, 109, 112, 105, 111, 111, 108, 98, 105, 97, 116, 105, 109, 101, 107, 101, 101, 112,
+	105, 110, 103, 116, 111, 115, 97, 115, 104, 105, 109, 105, 122, 117, 116, 114, 97, 102, 102, 105,
+	99, 112, 108, 101, 120, 116, 115, 101, 108, 105, 110, 111, 103, 114, 97, 100, 116, 118, 101, 100,
+	101, 115, 116, 114, 97, 110, 100, 118, 97, 108, 45, 100, 45, 97, 111, 115, 116, 97, 118, 97,
+	108, 108, 101, 45, 97, 111, 115, 116, 97, 118, 97, 108, 108, 101, 100, 97, 111, 115, 116, 97,
+	118, 97, 108, 108, 101, 101, 97, 111, 115, 116, 101, 118, 101, 116, 101, 114, 105, 110, 97, 105,
+	114, 101, 118, 105, 114, 116, 117, 97, 108, 117, 115, 101, 114, 118, 108, 97, 100, 105, 107, 97,
+	118, 107, 97, 122, 118, 111, 108, 107, 101, 110, 107, 117, 110, 100, 101, 118, 111, 115, 115, 101,
+	118, 97, 110, 103, 101, 110, 119, 101, 98, 114, 101, 100, 105, 114, 101, 99, 116, 119, 105, 108,
+	108, 105, 97, 109, 104, 105, 108, 108, 119, 105, 116, 104, 121, 111, 117, 116, 117, 98, 101, 120,
+	110, 45, 45, 49, 49, 98, 52, 99, 51, 100, 120, 110, 45, 45, 49, 99, 107, 50, 101, 49,
+	98, 120, 110, 45, 45, 49, 108, 113, 115, 48, 51, 110, 120, 110, 45, 45, 49, 108, 113, 115,
+	55, 49, 100, 120, 110, 45, 45, 49, 113, 113, 119, 50, 51, 97, 120, 110, 45, 45, 50, 109,
+	52, 97, 49, 53, 101, 120, 110, 45, 45, 50, 115, 99, 114, 106, 57, 99, 120, 110, 45, 45,
+	51, 50, 118, 112, 51, 48, 104, 120, 110, 45, 45, 51, 98, 115, 116, 48, 48, 109, 120, 110,
+	45, 45, 51, 100, 115, 52, 52, 51, 103, 120, 110, 45, 45, 51, 104, 99, 114, 106, 57, 99,
+	120, 110, 45, 45, 52, 50, 99, 50, 100, 57, 97, 120, 110, 45, 45, 52, 53, 98, 114, 106,
+	57, 99, 120, 110, 45, 45, 52, 105, 116, 49, 54, 56, 100, 120, 110, 45, 45, 52, 105, 116,
+	55, 57, 55, 107, 120, 110, 45, 45, 53, 53, 113, 119, 52, 50, 103, 120, 110, 45, 45, 53,
+	100, 98, 104, 108, 56, 100, 120, 110, 45, 45, 53, 106, 115, 48, 52, 53, 100, 120, 110, 45,
+	45, 53, 114, 116, 112, 52, 57, 99, 120, 110, 45, 45, 53, 114, 116, 113, 51, 52, 107, 120,
+	110, 45, 45, 54, 102, 114, 122, 56, 50, 103, 120, 110, 45, 45, 56, 48, 97, 111, 50, 49,
+	97, 120, 110, 45, 45, 56, 108, 116, 114, 54, 50, 107, 120, 110, 45, 45, 57, 107, 114, 116,
+	48, 48, 97, 120, 110, 45, 45, 98, 111, 100, 45, 50, 110, 97, 120, 110, 45, 45, 99, 99,
+	107, 50, 98, 51, 98, 120, 110, 45, 45, 99, 122, 114, 54, 57, 52, 98, 120, 110, 45, 45,
+	99, 122, 114, 119, 50, 56, 98, 120, 110, 45, 45, 100, 49, 97, 99, 106, 51, 98, 120, 110,
+	45, 45, 101, 102, 118, 121, 56, 56, 104, 120, 110, 45, 45, 101, 104, 113, 122, 53, 54, 110,
+	120, 110, 45, 45, 101, 108, 113, 113, 49, 54, 104, 120, 110, 45, 45, 102, 54, 113, 120, 53,
+	51, 97, 120, 110, 45, 45, 102, 99, 116, 52, 50, 57, 107, 120, 110, 45, 45, 102, 106, 113,
+	55, 50, 48, 97, 120, 110, 45, 45, 102, 108, 119, 51, 53, 49, 101, 120, 110, 45, 45, 103,
+	50, 120, 120, 52, 56, 99, 120, 110, 45, 45, 103, 101, 99, 114, 106, 57, 99, 120, 110, 45,
+	45, 103, 107, 51, 97, 116, 49, 101, 120, 110, 45, 45, 103, 109, 113, 48, 53, 48, 105, 120,
+	110, 45, 45, 104, 101, 98, 100, 97, 56, 98, 120, 110, 45, 45, 104, 120, 116, 56, 49, 52,
+	101, 120, 110, 45, 45, 105, 109, 114, 53, 49, 51, 110, 120, 110, 45, 45, 106, 49, 97, 101,
+	108, 56, 98, 120, 110, 45, 45, 106, 54, 119, 49, 57, 51, 103, 120, 110, 45, 45, 106, 118,
+	114, 49, 56, 57, 109, 120, 110, 45, 45, 107, 55, 121, 110, 57, 53, 101, 120, 110, 45, 45,
+	107, 108, 116, 55, 56, 55, 100, 120, 110, 45, 45, 107, 112, 114, 119, 49, 51, 100, 120, 110,
+	45, 45, 107, 112, 114, 121, 53, 55, 100, 120, 110, 45, 45, 108, 99, 118, 114, 51, 50, 100,
+	120, 110, 45, 45, 108, 110, 115, 45, 113, 108, 97, 120, 110, 45, 45, 108, 116, 45, 108, 105,
+	97, 99, 120, 110, 45, 45, 109, 103, 98, 116, 120, 50, 98, 120, 110, 45, 45, 109, 105, 120,
+	48, 56, 50, 102, 120, 110, 45, 45, 109, 105, 120, 56, 57, 49, 102, 120, 110, 45, 45, 109,
+	107, 114, 117, 52, 53, 105, 120, 110, 45, 45, 109, 108, 105, 45, 116, 108, 97, 120, 110, 45,
+	45, 109, 111, 116, 45, 116, 108, 97, 120, 110, 45, 45, 110, 105, 116, 50, 50, 53, 107, 120,
+	110, 45, 45, 110, 110, 120, 51, 56, 56, 97, 120, 110, 45, 45, 110, 116, 115, 113, 49, 55,
+	103, 120, 110, 45, 45, 110, 121, 113, 121, 50, 54, 97, 120, 110, 45, 45, 111, 51, 99, 121,
+	120, 50, 97, 120, 110, 45, 45, 111, 100, 48, 97, 113, 51, 98, 120, 110, 45, 45, 111, 116,
+	117, 55, 57, 54, 100, 120, 110, 45, 45, 112, 103, 98, 115, 48, 100, 104, 120, 110, 45, 45,
+	112, 115, 115, 117, 51, 51, 108, 120, 110, 45, 45, 113, 57, 106, 121, 98, 52, 99, 120, 110,
+	45, 45, 113, 113, 113, 116, 49, 49, 109, 120, 110, 45, 45, 114, 100, 101, 45, 117, 108, 97,
+	120, 110, 45, 45, 114, 104, 113, 118, 57, 54, 103, 120, 110, 45, 45, 114, 111, 118, 117, 56,
+	56, 98, 120, 110, 45, 45, 114, 115, 116, 45, 48, 110, 97, 120, 110, 45, 45, 115, 57, 98,
+	114, 106, 57, 99, 120, 110, 45, 45, 115, 101, 115, 53, 53, 52, 103, 120, 110, 45, 45, 116,
+	54, 48, 98, 53, 54, 97, 120, 110, 45, 45, 116, 111, 114, 49, 51, 49, 111, 120, 110, 45,
+	45, 117, 99, 48, 97, 121, 52, 97, 120, 110, 45, 45, 117, 105, 115, 116, 50, 50, 104, 120,
+	110, 45, 45, 117, 117, 119, 117, 53, 56, 97, 120, 110, 45, 45, 118, 103, 45, 121, 105, 97,
+	98, 120, 110, 45, 45, 118, 103, 117, 52, 48, 50, 99, 120, 110, 45, 45, 118, 117, 113, 56,
+	54, 49, 98, 120, 110, 45, 45, 119, 52, 114, 115, 52, 48, 108, 120, 110, 45, 45, 119, 99,
+	118, 115, 50, 50, 100, 120, 110, 45, 45, 120, 104, 113, 53, 50, 49, 98, 120, 110, 45, 45,
+	121, 101, 114, 45, 122, 110, 97, 120, 110, 45, 45, 122, 98, 120, 48, 50, 53, 100, 120, 110,
+	45, 45, 122, 102, 114, 49, 54, 52, 98, 121, 97, 110, 100, 101, 120, 99, 108, 111, 117, 100,
+	121, 111, 115, 104, 105, 110, 111, 103, 97, 114, 105, 122, 97, 112, 111, 114, 105, 122, 104, 122,
+	104, 101, 49, 50, 51, 109, 105, 110, 115, 105, 100, 97, 49, 50, 51, 115, 105, 116, 101, 119,
+	101, 98, 49, 50, 51, 119, 101, 98, 115, 105, 116, 101, 51, 117, 116, 105, 108, 105, 116, 105,
+	101, 115, 97, 102, 45, 115, 111, 117, 116, 104, 45, 49, 97, 105, 114, 116, 114, 97, 102, 102,
+	105, 99, 97, 105, 118, 101, 110, 99, 108, 111, 117, 100, 97, 105, 122, 117, 109, 105, 115, 97,
+	116, 111, 97, 107, 110, 111, 108, 117, 111, 107, 116, 97, 97, 107, 116, 121, 117, 98, 105, 110,
+	115, 107, 97, 108, 116, 101, 114, 118, 105, 115, 116, 97, 97, 108, 119, 97, 121, 115, 100, 97,
+	116, 97, 97, 109, 115, 99, 111, 109, 112, 117, 116, 101, 97, 112, 97, 114, 116, 109, 101, 110,
+	116, 115, 97, 114, 116, 103, 97, 108, 108, 101, 114, 121, 97, 115, 115, 111, 99, 105, 97, 116,
+	101, 115, 97, 117, 116, 111, 109, 111, 116, 105, 118, 101, 97, 122, 101, 114, 98, 97, 105, 106,
+	97, 110, 98, 97, 98, 105, 97, 45, 103, 111, 114, 97, 98, 97, 108, 101, 115, 116, 114, 97,
+	110, 100, 98, 97, 108, 108, 111, 111, 110, 105, 110, 103, 98, 97, 115, 105, 108, 105, 99, 97,
+	116, 97, 98, 97, 115, 107, 101, 116, 98, 97, 108, 108, 98, 101, 101, 98, 121, 116, 101, 97,
+	112, 112, 98, 101, 116, 97, 105, 110, 97, 98, 111, 120, 98, 105, 97, 108, 111, 119, 105, 101,
+	122, 97, 98, 105, 101, 115, 122, 99, 122, 97, 100, 121, 98, 105, 114, 116, 104, 112, 108, 97,
+	99, 101, 98, 110, 112, 112, 97, 114, 105, 98, 97, 115, 98, 111, 101, 104, 114, 105, 110, 103,
+	101, 114, 98, 111, 111, 107, 111, 110, 108, 105, 110, 101, 98, 114, 117, 109, 117, 110, 100, 100,
+	97, 108, 98, 117, 121, 115, 104, 111, 117, 115, 101, 115, 99, 97, 104, 99, 101, 115, 117, 111,
+	108, 111, 99, 97, 108, 105, 102, 111, 114, 110, 105, 97, 99, 97, 109, 112, 111, 98, 97, 115,
+	115, 111, 99, 97, 110, 118, 97, 45, 97, 112, 112, 115, 99, 97, 112, 101, 98, 114, 101, 116,
+	111, 110, 99, 97, 112, 105, 116, 97, 108, 111, 110, 101, 99, 97, 114, 116, 111, 111, 110, 97,
+	114, 116, 99, 104, 101, 108, 116, 101, 110, 104, 97, 109, 99, 104, 101, 114, 110, 105, 118, 116,
+	115, 105, 99, 104, 101, 114, 110, 111, 118, 116, 115, 121, 99, 104, 105, 107, 117, 115, 104, 105,
+	110, 111, 99, 105, 110, 99, 105, 110, 110, 97, 116, 105, 99, 105, 115, 99, 111, 102, 114, 101,
+	97, 107, 99, 108, 101, 114, 107, 115, 116, 97, 103, 101, 99, 108, 101, 118, 101, 114, 97, 112,
+	112, 115, 99, 108, 111, 117, 100, 102, 114, 111, 110, 116, 99, 108, 111, 117, 100, 106, 105, 102,
+	102, 121, 99, 110, 45, 110, 111, 114, 116, 104, 45, 49, 99, 111, 108, 108, 101, 99, 116, 105,
+	111, 110, 99, 111, 108, 108, 101, 103, 101, 102, 97, 110, 99, 111, 110, 102, 101, 114, 101, 110,
+	99, 101, 99, 111, 110, 115, 117, 108, 116, 97, 110, 116, 99, 111, 110, 115, 117, 108, 116, 105,
+	110, 103, 99, 111, 112, 101, 110, 104, 97, 103, 101, 110, 99, 114, 101, 100, 105, 116, 99, 97,
+	114, 100, 99, 117, 105, 115, 105, 110, 101, 108, 108, 97, 100, 97, 109, 110, 115, 101, 114, 118,
+	101, 114, 100, 97, 116, 97, 99, 101, 110, 116, 101, 114, 100, 97, 116, 97, 100, 101, 116, 101,
+	99, 116, 100, 97, 116, 116, 111, 108, 111, 99, 97, 108, 100, 97, 116, 116, 111, 114, 101, 108,
+	97, 121, 100, 97, 118, 118, 101, 115, 105, 105, 100, 97, 100, 101, 109, 111, 99, 114, 97, 99,
+	105, 97, 100, 105, 115, 99, 111, 114, 100, 115, 101, 122, 100, 110, 115, 105, 115, 107, 105, 110,
+	107, 121, 100, 110, 115, 117, 112, 100, 97, 116, 101, 114, 100, 121, 110, 45, 98, 101, 114, 108,
+	105, 110, 100, 121, 110, 45, 111, 45, 115, 97, 117, 114, 100, 121, 110, 100, 110, 115, 45, 119,
+	101, 98, 101, 97, 115, 116, 97, 102, 114, 105, 99, 97, 101, 101, 114, 111, 45, 115, 116, 97,
+	103, 101, 101, 108, 118, 101, 110, 100, 114, 101, 108, 108, 101, 109, 98, 114, 111, 105, 100, 101,
+	114, 121, 101, 110, 116, 111, 109, 111, 108, 111, 103, 121, 101, 117, 45, 110, 111, 114, 116, 104,
+	45, 49, 101, 117, 45, 115, 111, 117, 116, 104, 45, 49, 101, 117, 114, 111, 118, 105, 115, 105,
+	111, 110, 101, 120, 104, 105, 98, 105, 116, 105, 111, 110, 101, 120, 116, 114, 97, 115, 112, 97,
+	99, 101, 102, 97, 115, 116, 115, 116, 97, 99, 107, 115, 102, 101, 100, 101, 114, 97, 116, 105,
+	111, 110, 102, 111, 114, 45, 98, 101, 116, 116, 101, 114, 102, 111, 117, 110, 100, 97, 116, 105,
+	111, 110, 102, 114, 101, 101, 98, 111, 120, 45, 111, 115, 102, 114, 101, 110, 99, 104, 107, 105,
+	115, 115, 102, 117, 106, 105, 110, 111, 109, 105, 121, 97, 102, 121, 108, 107, 101, 115, 98, 105,
+	98, 108, 103, 97, 110, 103, 97, 118, 105, 105, 107, 97, 103, 101, 101, 107, 103, 97, 108, 97,
+	120, 121, 103, 105, 114, 108, 102, 114, 105, 101, 110, 100, 103, 111, 111, 103, 108, 101, 97, 112,
+	105, 115, 103, 111, 111, 103, 108, 101, 99, 111, 100, 101, 103, 111, 118, 101, 114, 110, 109, 101,
+	110, 116, 103, 114, 111, 107, 115, 45, 116, 104, 105, 115, 104, 97, 103, 101, 98, 111, 115, 116,
+	97, 100, 104, 97, 108, 108, 111, 102, 102, 97, 109, 101, 104, 97, 109, 109, 101, 114, 102, 101,
+	115, 116, 104, 97, 110, 97, 109, 105, 103, 97, 119, 97, 104, 97, 115, 117, 114, 97, 45, 97,
+	112, 112, 104, 101, 97, 108, 116, 104, 99, 97, 114, 101, 104, 105, 103, 97, 115, 104, 105, 111,
+	109, 105, 104, 105, 103, 97, 115, 104, 105, 117, 114, 97, 104, 105, 116, 97, 99, 104, 105, 111,
+	116, 97, 104, 106, 101, 108, 109, 101, 108, 97, 110, 100, 104, 111, 98, 98, 121, 45, 115, 105,
+	116, 101, 104, 111, 109, 101, 111, 102, 102, 105, 99, 101, 104, 117, 109, 97, 110, 105, 116, 105,
+	101, 115, 105, 99, 104, 105, 110, 111, 109, 105, 121, 97, 105, 99, 104, 105, 110, 111, 115, 101,
+	107, 105, 105, 108, 105, 97, 100, 98, 111, 120, 111, 115, 105, 109, 109, 111, 98, 105, 108, 105,
+	101, 110, 105, 110, 97, 119, 97, 115, 104, 105, 114, 111, 105, 110, 100, 117, 115, 116, 114, 105,
+	101, 115, 105, 115, 45, 97, 45, 103, 114, 101, 101, 110, 105, 115, 45, 97, 45, 108, 108, 97,
+	109, 97, 105, 115, 45, 97, 45, 110, 117, 114, 115, 101, 105, 115, 104, 105, 110, 111, 109, 97,
+	107, 105, 105, 115, 116, 101, 105, 110, 103, 101, 101, 107, 106, 101, 110, 118, 45, 97, 114, 117,
+	98, 97, 106, 111, 117, 114, 110, 97, 108, 105, 115, 109, 106, 111, 117, 114, 110, 97, 108, 105,
+	115, 116, 106, 117, 101, 100, 105, 115, 99, 104, 101, 115, 107, 97, 103, 97, 109, 105, 105, 115,
+	104, 105, 107, 97, 109, 105, 102, 117, 114, 97, 110, 111, 107, 97, 109, 105, 110, 111, 107, 97,
+	119, 97, 107, 97, 109, 105, 110, 111, 121, 97, 109, 97, 107, 97, 110, 101, 103, 97, 115, 97,
+	107, 105, 107, 97, 114, 97, 115, 106, 111, 104, 107, 97, 107, 97, 114, 97, 115, 117, 121, 97,
+	109, 97, 107, 97, 116, 115, 117, 115, 104, 105, 107, 97, 107, 97, 117, 116, 111, 107, 101, 105,
+	110, 111, 107, 97, 119, 97, 105, 105, 115, 104, 111, 112, 107, 97, 119, 97, 109, 105, 110, 97,
+	109, 105, 107, 101, 121, 109, 97, 99, 104, 105, 110, 101, 107, 105, 114, 111, 118, 111, 103, 114,
+	97, 100, 107, 105, 116, 97, 107, 121, 117, 115, 104, 117, 107, 110, 111, 119, 115, 105, 116, 97,
+	108, 108, 107, 110, 120, 45, 115, 101, 114, 118, 101, 114, 107, 111, 98, 105, 101, 114, 122, 121,
+	99, 101, 107, 111, 101, 98, 101, 110, 104, 97, 118, 110, 107, 111, 110, 115, 107, 111, 119, 111,
+	108, 97, 107, 111, 117, 122, 117, 115, 104, 105, 109, 97, 107, 114, 111, 100, 115, 104, 101, 114,
+	97, 100, 107, 117, 99, 104, 105, 110, 111, 116, 115, 117, 107, 118, 105, 110, 110, 104, 101, 114,
+	97, 100, 108, 97, 110, 99, 97, 115, 104, 105, 114, 101, 108, 97, 121, 101, 114, 115, 104, 105,
+	102, 116, 108, 101, 98, 116, 105, 109, 110, 101, 116, 122, 108, 101, 105, 116, 117, 110, 103, 115,
+	101, 110, 108, 105, 107, 101, 115, 99, 97, 110, 100, 121, 108, 105, 116, 116, 108, 101, 115, 116,
+	97, 114, 108, 111, 108, 105, 116, 97, 112, 117, 110, 107, 108, 111, 115, 97, 110, 103, 101, 108,
+	101, 115, 108, 111, 115, 101, 121, 111, 117, 114, 105, 112, 108, 117, 120, 101, 109, 98, 111, 117,
+	114, 103, 109, 97, 107, 105, 110, 111, 104, 97, 114, 97, 109, 97, 107, 117, 114, 97, 122, 97,
+	107, 105, 109, 97, 108, 111, 112, 111, 108, 115, 107, 97, 109, 97, 109, 117, 114, 111, 103, 97,
+	119, 97, 109, 97, 110, 97, 103, 101, 109, 101, 110, 116, 109, 97, 110, 99, 104, 101, 115, 116,
+	101, 114, 109, 97, 110, 103, 121, 115, 104, 108, 97, 107, 109, 97, 114, 121, 108, 104, 117, 114,
+	115, 116, 109, 97, 115, 102, 106, 111, 114, 100, 101, 110, 109, 97, 116, 115, 117, 98, 117, 115,
+	104, 105, 109, 97, 116, 115, 117, 115, 104, 105, 103, 101, 109, 101, 45, 115, 111, 117, 116, 104,
+	45, 49, 109, 101, 105, 110, 45, 105, 115, 101, 114, 118, 109, 101, 105, 110, 45, 118, 105, 103,
+	111, 114, 109, 105, 99, 114, 111, 108, 105, 103, 104, 116, 109, 105, 110, 97, 109, 105, 97, 105,
+	107, 105, 109, 105, 110, 97, 109, 105, 98, 111, 115, 111, 109, 105, 110, 97, 109, 105, 109, 97,
+	107, 105, 109, 105, 110, 97, 109, 105, 116, 97, 110, 101, 109, 105, 110, 105, 115, 101, 114, 118,
+	101, 114, 109, 105, 116, 115, 117, 98, 105, 115, 104, 105, 109, 105, 121, 97, 107, 111, 110, 111,
+	106, 111, 109, 111, 45, 115, 105, 101, 109, 101, 110, 115, 109, 111, 110, 116, 105, 99, 101, 108,
+	108, 111, 109, 111, 118, 105, 109, 105, 101, 110, 116, 111, 109, 121, 45, 103, 97, 116, 101, 119,
+	97, 121, 109, 121, 102, 105, 114, 101, 119, 97, 108, 108, 110, 97, 103, 97, 110, 111, 104, 97,
+	114, 97, 110, 97, 103, 97, 111, 107, 97, 107, 121, 111, 110, 97, 103, 97, 114, 101, 121, 97,
+	109, 97, 110, 97, 107, 97, 100, 111, 109, 97, 114, 105, 110, 97, 109, 100, 97, 108, 115, 101,
+	105, 100, 110, 97, 109, 101, 114, 105, 107, 97, 119, 97, 110, 97, 109, 115, 115, 107, 111, 103,
+	97, 110, 110, 97, 118, 105, 103, 97, 116, 105, 111, 110, 110, 101, 116, 45, 102, 114, 101, 97,
+	107, 115, 110, 101, 120, 116, 100, 105, 114, 101, 99, 116, 110, 105, 115, 104, 105, 97, 114, 105,
+	116, 97, 110, 105, 121, 111, 100, 111, 103, 97, 119, 97, 110, 111, 114, 116, 104, 102, 108, 97,
+	110, 107, 110, 111, 116, 105, 99, 101, 97, 98, 108, 101, 111, 107, 105, 110, 111, 115, 104, 105,
+	109, 97, 111, 109, 97, 115, 118, 117, 111, 116, 110, 97, 111, 110, 45, 97, 112, 116, 105, 98,
+	108, 101, 111, 110, 45, 114, 97, 110, 99, 104, 101, 114, 111, 110, 45, 116, 104, 101, 45, 119,
+	101, 98, 111, 112, 101, 110, 115, 111, 99, 105, 97, 108, 111, 112, 101, 114, 97, 117, 110, 105,
+	116, 101, 111, 115, 116, 114, 111, 119, 119, 108, 107, 112, 111, 118, 114, 101, 45, 101, 105, 107,
+	101, 114, 111, 119, 97, 114, 105, 97, 115, 97, 104, 105, 112, 97, 114, 108, 105, 97, 109, 101,
+	110, 116, 112, 105, 116, 116, 115, 98, 117, 114, 103, 104, 112, 108, 97, 110, 116, 97, 116, 105,
+	111, 110, 112, 108, 97, 116, 102, 111, 114, 109, 115, 104, 112, 111, 105, 110, 116, 50, 116, 104,
+	105, 115, 112, 111, 114, 116, 108, 108, 105, 103, 97, 116, 112, 114, 111, 99, 104, 111, 119, 105,
+	99, 101, 112, 114, 111, 116, 101, 99, 116, 105, 111, 110, 112, 114, 117, 100, 101, 110, 116, 105,
+	97, 108, 112, 121, 97, 116, 105, 103, 111, 114, 115, 107, 113, 117, 105, 99, 107, 115, 121, 116,
+	101, 115, 114, 101, 97, 100, 45, 98, 111, 111, 107, 115, 114, 101, 97, 100, 109, 121, 98, 108,
+	111, 103, 114, 101, 97, 108, 101, 115, 116, 97, 116, 101, 114, 101, 99, 114, 101, 97, 116, 105,
+	111, 110, 114, 101, 100, 105, 114, 101, 99, 116, 109, 101, 114, 101, 115, 105, 115, 116, 97, 110,
+	99, 101, 114, 101, 115, 116, 97, 117, 114, 97, 110, 116, 114, 111, 116, 111, 114, 99, 114, 97,
+	102, 116, 115, 97, 103, 97, 109, 105, 104, 97, 114, 97, 115, 97, 105, 110, 116, 108, 111, 117,
+	105, 115, 115, 97, 107, 117, 114, 97, 103, 97, 119, 97, 115, 97, 110, 100, 101, 102, 106, 111,
+	114, 100, 115, 97, 110, 116, 97, 109, 97, 114, 105, 97, 115, 97, 110, 116, 111, 97, 110, 100,
+	114, 101, 115, 97, 118, 97, 110, 110, 97, 104, 103, 97, 115, 99, 97, 108, 101, 102, 111, 114,
+	99, 101, 115, 99, 104, 97, 101, 102, 102, 108, 101, 114, 115, 99, 104, 111, 107, 111, 107, 101,
+	107, 115, 115, 101, 98, 97, 115, 116, 111, 112, 111, 108, 115, 101, 107, 105, 103, 97, 104, 97,
+	114, 97, 115, 101, 110, 115, 101, 101, 114, 105, 110, 103, 115, 101, 110, 115, 105, 111, 115, 105,
+	116, 101, 115, 101, 114, 118, 101, 113, 117, 97, 107, 101, 115, 101, 116, 116, 108, 101, 109, 101,
+	110, 116, 115, 101, 118, 97, 115, 116, 111, 112, 111, 108, 115, 104, 101, 114, 98, 114, 111, 111,
+	107, 101, 115, 104, 105, 99, 104, 105, 110, 111, 104, 101, 115, 104, 105, 109, 111, 116, 115, 117,
+	107, 101, 115, 104, 105, 109, 111, 116, 115, 117, 109, 97, 115, 104, 111, 112, 105, 116, 115, 105,
+	116, 101, 115, 104, 111, 112, 115, 101, 108, 101, 99, 116, 115, 105, 109, 112, 108, 101, 45, 117,
+	114, 108, 115, 105, 109, 112, 108, 101, 115, 105, 116, 101, 115, 107, 121, 103, 101, 97, 114, 97,
+	112, 112, 115, 110, 105, 108, 108, 102, 106, 111, 114, 100, 115, 111, 114, 45, 97, 117, 114, 100,
+	97, 108, 115, 112, 106, 101, 108, 107, 97, 118, 105, 107, 115, 116, 101, 105, 101, 114, 109, 97,
+	114, 107, 115, 119, 105, 101, 98, 111, 100, 122, 105, 110, 116, 97, 98, 105, 116, 111, 114, 100,
+	101, 114, 116, 97, 105, 102, 117, 110, 45, 100, 110, 115, 116, 97, 107, 97, 110, 101, 122, 97,
+	119, 97, 116, 97, 107, 97, 114, 97, 122, 117, 107, 97, 116, 97, 114, 110, 111, 98, 114, 122,
+	101, 103, 116, 97, 116, 97, 109, 111, 116, 111, 114, 115, 116, 97, 119, 97, 114, 97, 109, 111,
+	116, 111, 116, 98, 45, 104, 111, 115, 116, 105, 110, 103, 116, 101, 99, 104, 110, 111, 108, 111,
+	103, 121, 116, 101, 99, 110, 111, 108, 111, 103, 105, 97, 116, 101, 108, 101, 118, 105, 115, 105,
+	111, 110, 116, 101, 115, 116, 45, 105, 115, 101, 114, 118, 116, 111, 107, 111, 114, 111, 122, 97,
+	119, 97, 116, 111, 109, 105, 103, 117, 115, 117, 107, 117, 116, 111, 114, 112, 114, 111, 106, 101,
+	99, 116, 116, 114, 97, 110, 115, 108, 97, 116, 101, 100, 116, 114, 97, 110, 115, 112, 111, 114,
+	116, 101, 117, 108, 108, 101, 110, 115, 97, 107, 101, 114, 117, 108, 108, 101, 110, 115, 118, 97,
+	110, 103, 117, 110, 105, 118, 101, 114, 115, 105, 116, 121, 117, 115, 97, 110, 116, 105, 113, 117,
+	101, 115, 117, 116, 115, 117, 110, 111, 109, 105, 121, 97, 118, 97, 108, 45, 100, 97, 111, 115,
+	116, 97, 118, 97, 108, 100, 45, 97, 111, 115, 116, 97, 118, 97, 108, 108, 101, 97, 111, 115,
+	116, 97, 118, 97, 112, 111, 114, 99, 108, 111, 117, 100, 118, 101, 114, 115, 97, 105, 108, 108,
+	101, 115, 118, 105, 110, 100, 97, 102, 106, 111, 114, 100, 118, 105, 112, 115, 105, 110, 97, 97,
+	112, 112, 118, 108, 97, 97, 110, 100, 101, 114, 101, 110, 118, 111, 108, 107, 115, 119, 97, 103,
+	101, 110, 119, 97, 102, 97, 105, 99, 108, 111, 117, 100, 119, 97, 102, 102, 108, 101, 99, 101,
+	108, 108, 119, 101, 98, 104, 111, 115, 116, 105, 110, 103, 119, 101, 115, 116, 101, 117, 114, 111,
+	112, 101, 119, 105, 116, 104, 103, 111, 111, 103, 108, 101, 119, 111, 114, 115, 101, 45, 116, 104,
+	97, 110, 119, 112, 100, 101, 118, 99, 108, 111, 117, 100, 120, 110, 45, 45, 51, 48, 114, 114,
+	55, 121, 120, 110, 45, 45, 51, 112, 120, 117, 56, 107, 120, 110, 45, 45, 52, 53, 113, 49,
+	49, 99, 120, 110, 45, 45, 52, 103, 98, 114, 105, 109, 120, 110, 45, 45, 53, 53, 113, 120,
+	53, 100, 120, 110, 45, 45, 53, 116, 122, 109, 53, 103, 120, 110, 45, 45, 54, 98, 116, 119,
+	53, 97, 120, 110, 45, 45, 54, 111, 114, 120, 50, 114, 120, 110, 45, 45, 56, 48, 97, 115,
+	119, 103, 120, 110, 45, 45, 56, 100, 98, 113, 50, 97, 120, 110, 45, 45, 56, 112, 118, 114,
+	52, 117, 120, 110, 45, 45, 57, 48, 97, 49, 97, 102, 120, 110, 45, 45, 57, 48, 97, 51,
+	97, 99, 120, 110, 45, 45, 57, 100, 98, 113, 50, 97, 120, 110, 45, 45, 57, 101, 116, 53,
+	50, 117, 120, 110, 45, 45, 99, 50, 98, 114, 55, 103, 120, 110, 45, 45, 99, 51, 115, 49,
+	52, 109, 120, 110, 45, 45, 99, 103, 52, 98, 107, 105, 120, 110, 45, 45, 99, 122, 114, 115,
+	48, 116, 120, 110, 45, 45, 99, 122, 114, 117, 50, 100, 120, 110, 45, 45, 100, 106, 116, 121,
+	52, 107, 120, 110, 45, 45, 101, 102, 118, 110, 57, 115, 120, 110, 45, 45, 102, 105, 113, 54,
+	52, 98, 120, 110, 45, 45, 102, 105, 113, 115, 56, 115, 120, 110, 45, 45, 102, 105, 113, 122,
+	57, 115, 120, 110, 45, 45, 102, 108, 45, 122, 105, 97, 120, 110, 45, 45, 103, 109, 113, 119,
+	53, 97, 120, 110, 45, 45, 104, 49, 97, 101, 103, 104, 120, 110, 45, 45, 104, 49, 97, 108,
+	105, 122, 120, 110, 45, 45, 105, 111, 48, 97, 55, 105, 120, 110, 45, 45, 107, 98, 114, 113,
+	55, 111, 120, 110, 45, 45, 107, 108, 116, 112, 55, 100, 120, 110, 45, 45, 107, 108, 116, 120,
+	57, 97, 120, 110, 45, 45, 107, 108, 116, 121, 53, 120, 120, 110, 45, 45, 107, 112, 117, 116,
+	51, 105, 120, 110, 45, 45, 109, 107, 48, 97, 120, 105, 120, 110, 45, 45, 109, 120, 116, 113,
+	49, 109, 120, 110, 45, 45, 111, 51, 99, 119, 52, 104, 120, 110, 45, 45, 111, 100, 48, 97,
+	108, 103, 120, 110, 45, 45, 112, 115, 115, 121, 50, 117, 120, 110, 45, 45, 113, 55, 99, 101,
+	54, 97, 120, 110, 45, 45, 114, 104, 116, 50, 55, 122, 120, 110, 45, 45, 114, 104, 116, 54,
+	49, 101, 120, 110, 45, 45, 114, 110, 121, 51, 49, 104, 120, 110, 45, 45, 117, 99, 48, 97,
+	116, 118, 120, 110, 45, 45, 117, 105, 115, 122, 51, 103, 120, 110, 45, 45, 117, 110, 117, 112,
+	52, 121, 120, 110, 45, 45, 119, 103, 98, 104, 49, 99, 120, 110, 45, 45, 119, 103, 98, 108,
+	54, 97, 120, 110, 45, 45, 121, 57, 97, 51, 97, 113, 120, 110, 45, 45, 122, 102, 48, 97,
+	118, 120, 121, 97, 109, 97, 110, 97, 107, 97, 107, 111, 121, 97, 109, 97, 110, 111, 117, 99,
+	104, 105, 121, 97, 116, 115, 117, 115, 104, 105, 114, 111, 121, 97, 119, 97, 116, 97, 104, 97,
+	109, 97, 121, 111, 107, 97, 105, 99, 104, 105, 98, 97, 121, 111, 116, 115, 117, 107, 97, 105,
+	100, 111, 122, 111, 111, 108, 111, 103, 105, 99, 97, 108, 97, 99, 99, 101, 110, 116, 117, 114,
+	101, 97, 99, 99, 101, 115, 115, 99, 97, 109, 97, 101, 114, 111, 98, 97, 116, 105, 99, 97,
+	101, 114, 111, 100, 114, 111, 109, 101, 97, 103, 114, 105, 103, 101, 110, 116, 111, 97, 105, 122,
+	117, 98, 97, 110, 103, 101, 97, 108, 97, 104, 101, 97, 100, 106, 117, 97, 108, 102, 97, 114,
+	111, 109, 101, 111, 97, 108, 108, 102, 105, 110, 97, 110, 122, 97, 108, 115, 116, 97, 104, 97,
+	117, 103, 97, 109, 97, 103, 97, 115, 97, 107, 105, 97, 109, 97, 122, 111, 110, 97, 119, 115,
+	97, 109, 98, 117, 108, 97, 110, 99, 101, 97, 109, 115, 116, 101, 114, 100, 97, 109, 97, 109,
+	117, 115, 101, 109, 101, 110, 116, 97, 110, 97, 108, 121, 116, 105, 99, 115, 97, 110, 100, 97,
+	115, 117, 111, 108, 111, 97, 110, 110, 45, 97, 114, 98, 111, 114, 97, 110, 110, 101, 102, 114,
+	97, 110, 107, 97, 111, 103, 97, 115, 104, 105, 109, 97, 97, 112, 45, 101, 97, 115, 116, 45,
+	49, 97, 112, 97, 114, 101, 99, 105, 100, 97, 97, 112, 112, 101, 110, 103, 105, 110, 101, 97,
+	113, 117, 97, 114, 101, 108, 108, 101, 97, 114, 98, 111, 114, 101, 116, 117, 109, 97, 114, 105,
+	100, 97, 103, 97, 119, 97, 97, 114, 116, 99, 101, 110, 116, 101, 114, 97, 115, 97, 104, 105,
+	107, 97, 119, 97, 97, 115, 97, 109, 105, 110, 97, 109, 105, 97, 115, 104, 105, 98, 101, 116,
+	115, 117, 97, 115, 116, 114, 111, 110, 111, 109, 121, 97, 117, 100, 110, 101, 100, 97, 108, 110,
+	97, 117, 115, 116, 101, 118, 111, 108, 108, 97, 117, 115, 116, 114, 97, 108, 105, 97, 97, 117,
+	115, 116, 114, 104, 101, 105, 109, 98, 97, 99, 107, 121, 97, 114, 100, 115, 98, 97, 108, 108,
+	97, 110, 103, 101, 110, 98, 97, 108, 115, 102, 106, 111, 114, 100, 98, 97, 108, 116, 105, 109,
+	111, 114, 101, 98, 97, 114, 99, 101, 108, 111, 110, 97, 98, 97, 114, 101, 109, 101, 116, 97,
+	108, 98, 97, 115, 104, 107, 105, 114, 105, 97, 98, 97, 116, 115, 102, 106, 111, 114, 100, 98,
+	101, 97, 117, 120, 97, 114, 116, 115, 98, 101, 110, 101, 118, 101, 110, 116, 111, 98, 105, 97,
+	108, 121, 115, 116, 111, 107, 98, 105, 116, 98, 114, 105, 100, 103, 101, 98, 105, 116, 98, 117,
+	99, 107, 101, 116, 98, 106, 101, 114, 107, 114, 101, 105, 109, 98, 108, 111, 111, 109, 98, 101,
+	114, 103, 98, 111, 121, 102, 114, 105, 101, 110, 100, 98, 114, 101, 109, 97, 110, 103, 101, 114,
+	98, 114, 111, 97, 100, 99, 97, 115, 116, 98, 114, 117, 120, 101, 108, 108, 101, 115, 98, 121,
+	100, 103, 111, 115, 122, 99, 122, 99, 97, 109, 98, 114, 105, 100, 103, 101, 99, 97, 116, 97,
+	110, 122, 97, 114, 111, 99, 100, 110, 45, 101, 100, 103, 101, 115, 99, 100, 110, 55, 55, 45,
+	115, 115, 108, 99, 101, 110, 116, 114, 97, 108, 117, 115, 99, 104, 97, 109, 98, 97, 103, 114,
+	105, 99, 104, 101, 114, 107, 97, 115, 115, 121, 99, 104, 101, 114, 110, 105, 103, 111, 118, 99,
+	104, 101, 114, 110, 105, 104, 105, 118, 99, 104, 105, 103, 97, 115, 97, 107, 105, 99, 104, 105,
+	107, 117, 104, 111, 107, 117, 99, 104, 111, 99, 111, 108, 97, 116, 101, 99, 104, 114, 105, 115,
+	116, 109, 97, 115, 99, 108, 111, 117, 100, 45, 102, 114, 49, 99, 108, 111, 117, 100, 97, 112,
+	112, 115, 99, 108, 111, 117, 100, 108, 101, 116, 115, 99, 108, 111, 117, 100, 115, 105, 116, 101,
+	99, 111, 109, 112, 117, 116, 101, 45, 49, 99, 111, 110, 115, 117, 108, 97, 100, 111, 99, 114,
+	97, 110, 98, 114, 111, 111, 107, 100, 101, 118, 101, 108, 111, 112, 101, 114, 100, 105, 115, 99,
+	111, 117, 114, 115, 101, 100, 105, 115, 99, 111, 118, 101, 114, 121, 100, 108, 117, 103, 111, 108,
+	101, 107, 97, 100, 111, 110, 116, 101, 120, 105, 115, 116, 100, 114, 97, 110, 103, 101, 100, 97,
+	108, 100, 117, 97, 108, 115, 116, 97, 99, 107, 100, 121, 110, 97, 116, 104, 111, 109, 101, 100,
+	121, 110, 100, 110, 115, 45, 105, 112, 101, 97, 115, 116, 99, 111, 97, 115, 116, 101, 97, 115,
+	121, 112, 97, 110, 101, 108, 101, 100, 103, 101, 115, 116, 97, 99, 107, 101, 105, 103, 101, 114,
+	115, 117, 110, 100, 101, 105, 115, 101, 110, 98, 97, 104, 110, 101, 108, 101, 109, 101, 110, 116,
+	111, 114, 101, 109, 98, 97, 105, 120, 97, 100, 97, 101, 109, 101, 114, 103, 101, 110, 99, 121,
+	101, 110, 99, 111, 114, 101, 97, 112, 105, 101, 116, 104, 110, 111, 108, 111, 103, 121, 102, 97,
+	105, 114, 119, 105, 110, 100, 115, 102, 97, 114, 109, 115, 116, 101, 97, 100, 102, 105, 108, 97,
+	116, 101, 108, 105, 97, 102, 105, 114, 101, 115, 116, 111, 110, 101, 102, 108, 97, 116, 97, 110,
+	103, 101, 114, 102, 111, 108, 107, 101, 98, 105, 98, 108, 102, 111, 114, 103, 101, 114, 111, 99,
+	107, 102, 111, 114, 116, 119, 111, 114, 116, 104, 102, 114, 97, 110, 99, 97, 105, 115, 101, 102,
+	114, 97, 110, 107, 102, 117, 114, 116, 102, 114, 101, 101, 98, 111, 120, 111, 115, 102, 114, 101,
+	115, 101, 110, 105, 117, 115, 102, 114, 111, 110, 116, 100, 111, 111, 114, 102, 114, 111, 115, 105,
+	110, 111, 110, 101, 102, 116, 112, 97, 99, 99, 101, 115, 115, 102, 117, 106, 105, 105, 100, 101,
+	114, 97, 102, 117, 106, 105, 115, 104, 105, 114, 111, 102, 117, 107, 117, 109, 105, 116, 115, 117,
+	102, 117, 110, 97, 98, 97, 115, 104, 105, 102, 117, 110, 97, 104, 97, 115, 104, 105, 102, 117,
+	110, 107, 102, 101, 117, 101, 114, 102, 117, 114, 110, 105, 116, 117, 114, 101, 102, 117, 116, 117,
+	114, 101, 99, 109, 115, 103, 97, 105, 118, 117, 111, 116, 110, 97, 103, 97, 109, 101, 45, 104,
+	111, 115, 116, 103, 101, 101, 108, 118, 105, 110, 99, 107, 103, 105, 108, 100, 101, 115, 107, 97,
+	108, 103, 105, 116, 45, 112, 97, 103, 101, 115, 103, 105, 116, 45, 114, 101, 112, 111, 115, 103,
+	111, 108, 100, 112, 111, 105, 110, 116, 103, 114, 97, 116, 97, 110, 103, 101, 110, 103, 114, 111,
+	107, 115, 45, 116, 104, 101, 103, 117, 115, 104, 105, 107, 97, 109, 105, 103, 121, 101, 111, 110,
+	103, 98, 117, 107, 103, 121, 101, 111, 110, 103, 110, 97, 109, 104, 97, 99, 104, 105, 110, 111,
+	104, 101, 104, 97, 109, 97, 109, 97, 116, 115, 117, 104, 97, 115, 104, 105, 107, 97, 109, 105,
+	104, 97, 115, 104, 105, 109, 111, 116, 111, 104, 97, 117, 103, 101, 115, 117, 110, 100, 104, 97,
+	121, 97, 115, 104, 105, 109, 97, 104, 101, 114, 111, 107, 117, 97, 112, 112, 104, 101, 114, 111,
+	107, 117, 115, 115, 108, 104, 105, 103, 97, 115, 104, 105, 110, 101, 104, 105, 109, 101, 115, 104,
+	105, 109, 97, 104, 105, 114, 97, 105, 122, 117, 109, 105, 104, 105, 114, 97, 116, 115, 117, 107,
+	97, 104, 105, 115, 97, 109, 105, 116, 115, 117, 104, 111, 109, 101, 98, 117, 105, 108, 116, 104,
+	111, 109, 101, 100, 101, 112, 111, 116, 104, 111, 109, 101, 103, 111, 111, 100, 115, 104, 111, 109,
+	101, 108, 105, 110, 117, 120, 104, 111, 109, 101, 115, 101, 110, 115, 101, 104, 111, 109, 101, 115,
+	107, 108, 101, 112, 104, 111, 114, 100, 97, 108, 97, 110, 100, 104, 111, 114, 110, 105, 110, 100,
+	97, 108, 104, 111, 114, 111, 107, 97, 110, 97, 105, 104, 111, 121, 108, 97, 110, 100, 101, 116,
+	104, 121, 108, 108, 101, 115, 116, 97, 100, 105, 97, 109, 97, 108, 108, 97, 109, 97, 105, 107,
+	45, 115, 101, 114, 118, 101, 114, 105, 110, 45, 98, 101, 114, 108, 105, 110, 105, 110, 45, 98,
+	117, 116, 116, 101, 114, 105, 110, 100, 117, 115, 116, 114, 105, 97, 105, 110, 115, 116, 97, 110,
+	99, 101, 115, 105, 110, 115, 116, 105, 116, 117, 116, 101, 105, 115, 45, 97, 45, 99, 104, 101,
+	102, 105, 115, 45, 97, 45, 103, 101, 101, 107, 105, 115, 45, 97, 45, 103, 117, 114, 117, 105,
+	115, 108, 101, 111, 102, 109, 97, 110, 105, 116, 97, 121, 97, 110, 97, 103, 105, 105, 119, 97,
+	109, 105, 122, 97, 119, 97, 105, 122, 117, 109, 105, 111, 116, 115, 117, 105, 122, 117, 109, 105,
+	115, 97, 110, 111, 105, 122, 117, 109, 105, 122, 97, 107, 105, 105, 122, 117, 109, 111, 122, 97,
+	107, 105, 105, 122, 117, 110, 111, 107, 117, 110, 105, 106, 97, 110, 45, 109, 97, 121, 101, 110,
+	106, 100, 101, 118, 99, 108, 111, 117, 100, 106, 101, 102, 102, 101, 114, 115, 111, 110, 106, 101,
+	108, 108, 121, 98, 101, 97, 110, 106, 101, 114, 117, 115, 97, 108, 101, 109, 106, 101, 119, 105,
+	115, 104, 97, 114, 116, 106, 111, 105, 110, 118, 105, 108, 108, 101, 106, 111, 114, 112, 101, 108,
+	97, 110, 100, 107, 97, 103, 111, 115, 104, 105, 109, 97, 107, 97, 109, 105, 105, 122, 117, 109,
+	105, 107, 97, 109, 105, 107, 111, 97, 110, 105, 107, 97, 109, 105, 116, 111, 110, 100, 97, 107,
+	97, 114, 97, 103, 97, 110, 100, 97, 107, 97, 114, 105, 107, 97, 116, 117, 114, 107, 97, 114,
+	117, 105, 122, 97, 119, 97, 107, 97, 115, 97, 109, 97, 116, 115, 117, 107, 97, 115, 104, 105,
+	104, 97, 114, 97, 107, 97, 115, 104, 105, 119, 97, 114, 97, 107, 97, 115, 115, 101, 114, 118,
+	101, 114, 107, 97, 116, 97, 115, 104, 105, 110, 97, 107, 97, 116, 115, 117, 114, 97, 103, 105,
+	107, 97, 116, 115, 117, 121, 97, 109, 97, 107, 97, 119, 97, 110, 101, 104, 111, 110, 107, 97,
+	119, 97, 110, 105, 115, 104, 105, 107, 104, 97, 107, 97, 115, 115, 105, 97, 107, 105, 99, 107,
+	115, 45, 97, 115, 115, 107, 105, 108, 97, 116, 105, 114, 111, 110, 107, 105, 109, 111, 98, 101,
+	116, 115, 117, 107, 105, 115, 104, 105, 119, 97, 100, 97, 107, 105, 116, 97, 97, 107, 105, 116,
+	97, 107, 105, 116, 97, 100, 97, 105, 116, 111, 107, 111, 98, 97, 121, 97, 115, 104, 105, 107,
+	111, 107, 117, 98, 117, 110, 106, 105, 107, 111, 108, 111, 98, 114, 122, 101, 103, 107, 111, 110,
+	103, 115, 98, 101, 114, 103, 107, 111, 115, 104, 105, 103, 97, 121, 97, 107, 111, 115, 104, 105,
+	109, 105, 122, 117, 107, 114, 97, 97, 110, 103, 104, 107, 101, 107, 114, 97, 115, 110, 111, 100,
+	97, 114, 107, 117, 100, 97, 109, 97, 116, 115, 117, 107, 117, 109, 97, 107, 111, 103, 101, 110,
+	107, 117, 110, 105, 116, 97, 99, 104, 105, 107, 117, 111, 107, 103, 114, 111, 117, 112, 107, 117,
+	114, 97, 115, 104, 105, 107, 105, 107, 117, 115, 104, 105, 109, 111, 116, 111, 107, 118, 97, 110,
+	97, 110, 103, 101, 110, 107, 118, 105, 110, 101, 115, 100, 97, 108, 107, 118, 105, 116, 101, 115,
+	101, 105, 100, 107, 121, 111, 116, 97, 110, 97, 98, 101, 108, 45, 111, 45, 103, 45, 105, 45,
+	110, 108, 97, 45, 115, 112, 101, 122, 105, 97, 108, 97, 110, 99, 97, 115, 116, 101, 114, 108,
+	97, 110, 100, 114, 111, 118, 101, 114, 108, 101, 97, 100, 112, 97, 103, 101, 115, 108, 101, 105,
+	107, 97, 110, 103, 101, 114, 108, 101, 105, 114, 102, 106, 111, 114, 100, 108, 105, 102, 101, 115,
+	116, 121, 108, 101, 108, 105, 107, 101, 115, 45, 112, 105, 101, 108, 105, 108, 108, 101, 115, 97,
+	110, 100, 108, 105, 109, 97, 45, 99, 105, 116, 121, 108, 105, 110, 100, 101, 115, 110, 101, 115,
+	108, 111, 99, 97, 108, 99, 101, 114, 116, 108, 111, 99, 97, 108, 104, 111, 115, 116, 108, 111,
+	99, 97, 108, 122, 111, 110, 101, 108, 111, 103, 105, 110, 108, 105, 110, 101, 108, 111, 108, 105,
+	112, 111, 112, 109, 99, 108, 111, 109, 98, 97, 114, 100, 105, 97, 108, 111, 114, 101, 110, 115,
+	107, 111, 103, 109, 97, 114, 107, 101, 116, 105, 110, 103, 109, 97, 114, 110, 97, 114, 100, 97,
+	108, 109, 97, 114, 115, 104, 97, 108, 108, 115, 109, 97, 116, 115, 117, 98, 97, 114, 97, 109,
+	97, 116, 115, 117, 107, 97, 119, 97, 109, 97, 116, 115, 117, 109, 111, 116, 111, 109, 97, 116,
+	115, 117, 115, 97, 107, 97, 109, 97, 116, 115, 117, 122, 97, 107, 105, 109, 101, 100, 105, 97,
+	116, 101, 99, 104, 109, 101, 105, 110, 102, 111, 114, 117, 109, 109, 101, 108, 98, 111, 117, 114,
+	110, 101, 109, 101, 115, 97, 118, 101, 114, 100, 101, 109, 101, 116, 101, 111, 114, 97, 112, 112,
+	109, 105, 99, 114, 111, 115, 111, 102, 116, 109, 105, 103, 114, 97, 116, 105, 111, 110, 109, 105,
+	110, 97, 109, 105, 105, 115, 101, 109, 105, 110, 97, 109, 105, 105, 122, 117, 109, 105, 110, 110,
+	101, 115, 111, 116, 97, 109, 105, 121, 97, 115, 104, 105, 114, 111, 109, 106, 111, 110, 100, 97,
+	108, 101, 110, 109, 111, 45, 105, 45, 114, 97, 110, 97, 109, 111, 99, 104, 105, 122, 117, 107,
+	105, 109, 111, 100, 101, 108, 108, 105, 110, 103, 109, 111, 110, 103, 111, 108, 105, 97, 110, 109,
+	111, 111, 110, 115, 99, 97, 108, 101, 109, 111, 114, 105, 103, 117, 99, 104, 105, 109, 111, 114,
+	105, 109, 97, 99, 104, 105, 109, 111, 114, 105, 121, 111, 115, 104, 105, 109, 111, 114, 111, 116,
+	115, 117, 107, 97, 109, 117, 115, 97, 115, 104, 105, 110, 111, 109, 117, 116, 115, 117, 122, 97,
+	119, 97, 109, 121, 45, 114, 111, 117, 116, 101, 114, 109, 121, 97, 115, 117, 115, 116, 111, 114,
+	109, 121, 100, 105, 115, 115, 101, 110, 116, 109, 121, 109, 101, 100, 105, 97, 112, 99, 109, 121,
+	115, 104, 111, 112, 105, 102, 121, 110, 97, 107, 97, 109, 105, 99, 104, 105, 110, 97, 110, 110,
+	101, 115, 116, 97, 100, 110, 97, 114, 97, 115, 104, 105, 110, 111, 110, 101, 119, 106, 101, 114,
+	115, 101, 121, 110, 101, 119, 109, 101, 120, 105, 99, 111, 110, 101, 119, 115, 112, 97, 112, 101,
+	114, 110, 105, 115, 104, 105, 97, 105, 122, 117, 110, 105, 115, 104, 105, 97, 122, 97, 105, 110,
+	105, 115, 104, 105, 104, 97, 114, 97, 110, 105, 115, 104, 105, 107, 97, 116, 97, 110, 105, 115,
+	104, 105, 107, 97, 119, 97, 110, 105, 115, 104, 105, 109, 101, 114, 97, 110, 105, 115, 104, 105,
+	116, 111, 115, 97, 110, 105, 115, 104, 105, 119, 97, 107, 105, 110, 111, 114, 100, 45, 102, 114,
+	111, 110, 110, 111, 114, 100, 45, 111, 100, 97, 108, 110, 111, 114, 100, 114, 101, 105, 115, 97,
+	111, 98, 97, 110, 97, 122, 97, 119, 97, 111, 103, 97, 115, 97, 119, 97, 114, 97, 111, 110,
+	97, 118, 115, 116, 97, 99, 107, 111, 110, 102, 97, 98, 114, 105, 99, 97, 111, 110, 116, 104,
+	101, 119, 105, 102, 105, 111, 112, 101, 110, 99, 114, 97, 102, 116, 111, 115, 116, 114, 111, 108,
+	101, 107, 97, 111, 115, 116, 114, 111, 119, 105, 101, 99, 111, 116, 111, 105, 110, 101, 112, 112,
+	117, 111, 118, 101, 114, 104, 97, 108, 108, 97, 111, 121, 97, 109, 97, 122, 97, 107, 105, 112,
+	97, 100, 101, 114, 98, 111, 114, 110, 112, 97, 110, 97, 115, 111, 110, 105, 99, 112, 97, 115,
+	115, 97, 103, 101, 110, 115, 112, 101, 114, 115, 112, 101, 99, 116, 97, 112, 104, 105, 108, 97,
+	116, 101, 108, 121, 112, 108, 97, 116, 102, 111, 114, 109, 48, 112, 111, 108, 107, 111, 119, 105,
+	99, 101, 112, 111, 109, 111, 114, 115, 107, 105, 101, 112, 111, 110, 105, 97, 116, 111, 119, 97,
+	112, 111, 114, 100, 101, 110, 111, 110, 101, 112, 111, 114, 115, 97, 110, 103, 101, 114, 112, 111,
+	114, 115, 103, 114, 117, 110, 110, 112, 114, 97, 109, 101, 114, 105, 99, 97, 112, 114, 122, 101,
+	119, 111, 114, 115, 107, 114, 97, 107, 107, 101, 115, 116, 97, 100, 114, 97, 110, 100, 97, 98,
+	101, 114, 103, 114, 101, 97, 100, 121, 109, 97, 100, 101, 114, 101, 116, 114, 111, 115, 110, 117,
+	98, 114, 105, 99, 104, 97, 114, 100, 108, 105, 114, 105, 107, 117, 98, 101, 116, 115, 117, 114,
+	105, 110, 103, 101, 114, 105, 107, 101, 114, 105, 110, 103, 115, 97, 107, 101, 114, 114, 105, 111,
+	98, 114, 97, 110, 99, 111, 114, 111, 99, 104, 101, 115, 116, 101, 114, 114, 121, 117, 103, 97,
+	115, 97, 107, 105, 115, 97, 109, 110, 97, 110, 103, 101, 114, 115, 97, 110, 97, 103, 111, 99,
+	104, 105, 115, 97, 110, 116, 97, 99, 114, 117, 122, 115, 97, 114, 112, 115, 98, 111, 114, 103,
+	115, 97, 114, 117, 102, 117, 116, 115, 117, 115, 99, 97, 108, 101, 98, 111, 111, 107, 115, 99,
+	104, 111, 111, 108, 98, 117, 115, 115, 99, 105, 101, 110, 116, 105, 115, 116, 115, 99, 114, 97,
+	112, 112, 105, 110, 103, 115, 101, 114, 97, 110, 105, 115, 104, 105, 115, 101, 114, 118, 101, 98,
+	101, 101, 114, 115, 101, 114, 118, 101, 98, 108, 111, 103, 115, 101, 114, 118, 101, 103, 97, 109,
+	101, 115, 101, 114, 118, 101, 104, 116, 116, 112, 115, 101, 114, 118, 101, 112, 105, 99, 115, 115,
+	104, 97, 110, 103, 114, 105, 108, 97, 115, 104, 105, 98, 117, 107, 97, 119, 97, 115, 104, 105,
+	102, 116, 101, 100, 105, 116, 115, 104, 105, 109, 97, 98, 97, 114, 97, 115, 104, 105, 109, 97,
+	109, 97, 107, 105, 115, 104, 105, 109, 97, 109, 111, 116, 111, 115, 104, 105, 109, 111, 100, 97,
+	116, 101, 115, 104, 105, 109, 111, 102, 117, 115, 97, 115, 104, 105, 109, 111, 105, 99, 104, 105,
+	115, 104, 105, 109, 111, 107, 97, 119, 97, 115, 104, 105, 109, 111, 110, 105, 116, 97, 115, 104,
+	105, 109, 111, 115, 117, 119, 97, 115, 104, 105, 110, 97, 103, 97, 119, 97, 115, 104, 105, 110,
+	111, 110, 115, 101, 110, 115, 104, 105, 110, 115, 104, 105, 114, 111, 115, 104, 105, 114, 97, 104,
+	97, 109, 97, 115, 104, 105, 114, 97, 110, 117, 107, 97, 115, 104, 105, 114, 97, 116, 97, 107,
+	97, 115, 104, 105, 114, 105, 117, 99, 104, 105, 115, 104, 105, 114, 111, 105, 115, 104, 105, 115,
+	104, 105, 114, 111, 115, 97, 116, 111, 115, 104, 105, 115, 104, 105, 107, 117, 105, 115, 104, 111,
+	112, 97, 114, 101, 110, 97, 115, 107, 121, 100, 105, 118, 105, 110, 103, 115, 109, 97, 108, 108,
+	45, 119, 101, 98, 115, 110, 111, 119, 102, 108, 97, 107, 101, 115, 111, 100, 101, 103, 97, 117,
+	114, 97, 115, 111, 110, 103, 100, 97, 108, 101, 110, 115, 111, 115, 110, 111, 119, 105, 101, 99,
+	115, 111, 117, 110, 100, 99, 97, 115, 116, 115, 111, 117, 116, 104, 119, 101, 115, 116, 115, 112,
+	121, 100, 101, 98, 101, 114, 103, 115, 116, 97, 114, 110, 98, 101, 114, 103, 115, 116, 97, 114,
+	111, 115, 116, 119, 111, 115, 116, 97, 116, 101, 98, 97, 110, 107, 115, 116, 97, 116, 101, 102,
+	97, 114, 109, 115, 116, 97, 116, 104, 101, 108, 108, 101, 115, 116, 97, 118, 97, 110, 103, 101,
+	114, 115, 116, 101, 105, 110, 107, 106, 101, 114, 115, 116, 111, 99, 107, 104, 111, 108, 109, 115,
+	116, 111, 114, 101, 98, 97, 115, 101, 115, 116, 111, 114, 102, 106, 111, 114, 100, 115, 116, 117,
+	116, 116, 103, 97, 114, 116, 115, 117, 112, 101, 114, 115, 97, 108, 101, 115, 118, 110, 45, 114,
+	101, 112, 111, 115, 115, 121, 107, 107, 121, 108, 118, 101, 110, 116, 97, 99, 104, 105, 97, 114,
+	97, 105, 116, 97, 99, 104, 105, 107, 97, 119, 97, 116, 97, 105, 108, 115, 99, 97, 108, 101,
+	116, 97, 107, 97, 104, 97, 115, 104, 105, 116, 97, 107, 97, 109, 97, 116, 115, 117, 116, 97,
+	107, 97, 115, 104, 105, 109, 97, 116, 97, 107, 97, 116, 115, 117, 107, 105, 116, 97, 116, 101,
+	115, 104, 105, 110, 97, 116, 101, 115, 104, 105, 107, 97, 103, 97, 116, 104, 101, 119, 111, 114,
+	107, 112, 99, 116, 106, 101, 108, 100, 115, 117, 110, 100, 116, 111, 98, 105, 115, 104, 105, 109,
+	97, 116, 111, 103, 97, 107, 117, 115, 104, 105, 116, 111, 103, 108, 105, 97, 116, 116, 105, 116,
+	111, 107, 97, 109, 97, 99, 104, 105, 116, 111, 107, 97, 115, 104, 105, 107, 105, 116, 111, 107,
+	117, 115, 104, 105, 109, 97, 116, 111, 109, 97, 107, 111, 109, 97, 105, 116, 111, 111, 108, 102,
+	111, 114, 103, 101, 116, 111, 121, 111, 104, 97, 115, 104, 105, 116, 114, 111, 110, 100, 104, 101,
+	105, 109, 116, 115, 117, 99, 104, 105, 117, 114, 97, 116, 115, 117, 107, 105, 103, 97, 116, 97,
+	116, 115, 117, 107, 105, 121, 111, 110, 111, 116, 117, 114, 121, 115, 116, 121, 107, 97, 116, 117,
+	120, 102, 97, 109, 105, 108, 121, 116, 121, 112, 101, 100, 114, 101, 97, 109, 117, 98, 101, 114,
+	115, 112, 97, 99, 101, 117, 106, 105, 116, 97, 119, 97, 114, 97, 117, 115, 99, 117, 108, 116,
+	117, 114, 101, 117, 115, 104, 105, 115, 116, 111, 114, 121, 117, 116, 97, 115, 104, 105, 110, 97,
+	105, 118, 97, 99, 97, 116, 105, 111, 110, 115, 118, 97, 108, 100, 97, 111, 115, 116, 97, 118,
+	101, 103, 97, 114, 115, 104, 101, 105, 118, 101, 115, 116, 118, 97, 103, 111, 121, 118, 101, 118,
+	101, 108, 115, 116, 97, 100, 118, 105, 110, 110, 121, 116, 115, 105, 97, 118, 111, 111, 114, 108,
+	111, 112, 101, 114, 119, 97, 108, 98, 114, 122, 121, 99, 104, 119, 97, 115, 104, 116, 101, 110,
+	97, 119, 119, 101, 98, 116, 104, 105, 110, 103, 115, 119, 101, 115, 116, 102, 97, 108, 101, 110,
+	119, 104, 105, 116, 101, 115, 110, 111, 119, 119, 108, 111, 99, 108, 97, 119, 101, 107, 119, 111,
+	100, 122, 105, 115, 108, 97, 119, 120, 110, 45, 45, 49, 99, 116, 119, 111, 120, 110, 45, 45,
+	52, 112, 118, 120, 115, 120, 110, 45, 45, 57, 48, 97, 105, 115, 120, 110, 45, 45, 57, 48,
+	97, 109, 99, 120, 110, 45, 45, 57, 48, 97, 122, 104, 120, 110, 45, 45, 98, 45, 53, 103,
+	97, 120, 110, 45, 45, 99, 49, 97, 118, 103, 120, 110, 45, 45, 99, 105, 113, 112, 110, 120,
+	110, 45, 45, 100, 49, 97, 108, 102, 120, 110, 45, 45, 101, 49, 97, 52, 99, 120, 110, 45,
+	45, 102, 104, 98, 101, 105, 120, 110, 45, 45, 104, 45, 50, 102, 97, 120, 110, 45, 45, 104,
+	49, 97, 104, 110, 120, 110, 45, 45, 106, 49, 97, 100, 112, 120, 110, 45, 45, 106, 49, 97,
+	101, 102, 120, 110, 45, 45, 106, 49, 97, 109, 104, 120, 110, 45, 45, 108, 45, 49, 102, 97,
+	120, 110, 45, 45, 108, 49, 97, 99, 99, 120, 110, 45, 45, 110, 103, 98, 114, 120, 120, 110,
+	45, 45, 111, 49, 97, 99, 104, 120, 110, 45, 45, 112, 49, 97, 99, 102, 120, 110, 45, 45,
+	113, 120, 97, 54, 97, 120, 110, 45, 45, 114, 104, 116, 51, 100, 120, 110, 45, 45, 115, 45,
+	49, 102, 97, 120, 110, 45, 45, 116, 99, 107, 119, 101, 120, 110, 45, 45, 116, 110, 48, 97,
+	103, 120, 110, 45, 45, 118, 104, 113, 117, 118, 121, 97, 99, 104, 105, 109, 97, 116, 97, 121,
+	97, 109, 97, 103, 117, 99, 104, 105, 121, 97, 109, 97, 110, 97, 115, 104, 105, 121, 97, 109,
+	97, 115, 104, 105, 110, 97, 121, 97, 109, 97, 116, 115, 117, 114, 105, 121, 111, 100, 111, 98,
+	97, 115, 104, 105, 121, 111, 107, 107, 97, 105, 99, 104, 105, 121, 111, 114, 107, 115, 104, 105,
+	114, 101, 121, 111, 115, 104, 105, 107, 97, 119, 97, 121, 117, 107, 117, 104, 97, 115, 104, 105,
+	121, 117, 114, 105, 104, 111, 110, 106, 111, 122, 97, 99, 104, 112, 111, 109, 111, 114, 122, 103,
+	111, 114, 122, 101, 108, 101, 99, 49, 50, 51, 109, 105, 119, 101, 98, 97, 97, 114, 98, 111,
+	114, 116, 101, 97, 98, 97, 115, 104, 105, 114, 105, 97, 98, 107, 104, 97, 122, 105, 97, 97,
+	98, 117, 100, 104, 97, 98, 105, 97, 99, 97, 100, 101, 109, 105, 97, 97, 101, 114, 111, 99,
+	108, 117, 98, 97, 101, 114, 111, 112, 111, 114, 116, 97, 103, 101, 109, 97, 116, 115, 117, 97,
+	105, 114, 99, 114, 97, 102, 116, 97, 105, 114, 102, 111, 114, 99, 101, 97, 105, 114, 103, 117,
+	97, 114, 100, 97, 107, 101, 114, 115, 104, 117, 115, 97, 107, 114, 101, 104, 97, 109, 110, 97,
+	108, 108, 115, 116, 97, 116, 101, 97, 112, 112, 99, 104, 105, 122, 105, 97, 112, 112, 108, 105,
+	110, 122, 105, 97, 113, 117, 97, 114, 105, 117, 109, 97, 115, 97, 107, 117, 99, 104, 105, 97,
+	115, 104, 103, 97, 98, 97, 100, 97, 115, 109, 97, 116, 97, 114, 116, 97, 116, 116, 111, 114,
+	110, 101, 121, 97, 117, 103, 117, 115, 116, 111, 119, 97, 117, 116, 111, 99, 111, 100, 101, 97,
+	118, 101, 108, 108, 105, 110, 111, 98, 97, 98, 121, 98, 108, 117, 101, 98, 97, 98, 121, 109,
+	105, 108, 107, 98, 97, 99, 107, 100, 114, 111, 112, 98, 97, 100, 97, 100, 100, 106, 97, 98,
+	97, 108, 97, 115, 104, 111, 118, 98, 97, 114, 99, 108, 97, 121, 115, 98, 97, 114, 101, 102,
+	111, 111, 116, 98, 97, 114, 103, 97, 105, 110, 115, 98, 97, 115, 101, 98, 97, 108, 108, 98,
+	101, 108, 108, 101, 118, 117, 101, 98, 101, 114, 107, 101, 108, 101, 121, 98, 101, 114, 108, 101,
+	118, 97, 103, 98, 105, 114, 97, 116, 111, 114, 105, 98, 105, 114, 107, 101, 110, 101, 115, 98,
+	108, 111, 103, 115, 105, 116, 101, 98, 108, 111, 103, 115, 112, 111, 116, 98, 108, 111, 103, 115,
+	121, 116, 101, 98, 108, 117, 101, 98, 105, 116, 101, 98, 111, 97, 118, 105, 115, 116, 97, 98,
+	111, 117, 110, 99, 101, 109, 101, 98, 111, 117, 116, 105, 113, 117, 101, 98, 114, 97, 100, 101,
+	115, 99, 111, 98, 114, 97, 115, 105, 108, 105, 97, 98, 114, 105, 110, 100, 105, 115, 105, 98,
+	114, 111, 97, 100, 119, 97, 121, 98, 114, 111, 107, 101, 45, 105, 116, 98, 114, 117, 115, 115,
+	101, 108, 115, 98, 117, 105, 108, 100, 105, 110, 103, 98, 117, 110, 103, 111, 111, 110, 111, 98,
+	117, 115, 105, 110, 101, 115, 115, 98, 117, 115, 107, 101, 114, 117, 100, 98, 121, 116, 101, 109,
+	97, 114, 107, 99, 97, 100, 97, 113, 117, 101, 115, 99, 97, 103, 108, 105, 97, 114, 105, 99,
+	97, 109, 112, 97, 105, 103, 110, 99, 97, 109, 112, 97, 110, 105, 97, 99, 97, 109, 112, 105,
+	110, 97, 115, 99, 97, 110, 100, 121, 112, 111, 112, 99, 97, 112, 101, 116, 111, 119, 110, 99,
+	97, 116, 101, 114, 105, 110, 103, 99, 97, 116, 104, 111, 108, 105, 99, 99, 104, 101, 114, 107,
+	97, 115, 121, 99, 104, 105, 99, 97, 112, 112, 97, 99, 104, 105, 107, 117, 115, 101, 105, 99,
+	104, 105, 107, 117, 122, 101, 110, 99, 104, 105, 108, 108, 111, 117, 116, 99, 104, 105, 109, 107,
+	101, 110, 116, 99, 104, 117, 110, 103, 98, 117, 107, 99, 104, 117, 110, 103, 110, 97, 109, 99,
+	105, 112, 114, 105, 97, 110, 105, 99, 105, 116, 121, 101, 97, 116, 115, 99, 105, 118, 105, 108,
+	119, 97, 114, 99, 108, 101, 97, 110, 105, 110, 103, 99, 108, 105, 110, 105, 113, 117, 101, 99,
+	108, 111, 116, 104, 105, 110, 103, 99, 108, 111, 117, 100, 101, 114, 97, 99, 111, 100, 101, 98,
+	101, 114, 103, 99, 111, 100, 101, 115, 112, 111, 116, 99, 111, 108, 117, 109, 98, 117, 115, 99,
+	111, 109, 109, 98, 97, 110, 107, 99, 111, 110, 116, 97, 103, 101, 109, 99, 111, 111, 108, 98,
+	108, 111, 103, 99, 111, 114, 118, 101, 116, 116, 101, 99, 114, 97, 102, 116, 105, 110, 103, 99,
+	117, 114, 105, 116, 105, 98, 97, 99, 117, 116, 101, 103, 105, 114, 108, 100, 97, 103, 101, 115,
+	116, 97, 110, 100, 97, 112, 112, 110, 111, 100, 101, 100, 97, 116, 97, 98, 97, 115, 101, 100,
+	97, 116, 116, 111, 119, 101, 98, 100, 100, 110, 115, 102, 114, 101, 101, 100, 100, 110, 115, 103,
+	101, 101, 107, 100, 100, 110, 115, 107, 105, 110, 103, 100, 100, 110, 115, 108, 105, 118, 101, 100,
+	101, 102, 105, 110, 105, 109, 97, 100, 101, 108, 105, 118, 101, 114, 121, 100, 101, 108, 111, 105,
+	116, 116, 101, 100, 105, 97, 109, 111, 110, 100, 115, 100, 105, 110, 111, 115, 97, 117, 114, 100,
+	105, 115, 99, 111, 117, 110, 116, 100, 110, 115, 97, 108, 105, 97, 115, 100, 110, 115, 116, 114,
+	97, 99, 101, 100, 111, 110, 111, 115, 116, 105, 97, 100, 111, 119, 110, 108, 111, 97, 100, 100,
+	114, 97, 121, 45, 100, 110, 115, 100, 114, 97, 121, 100, 100, 110, 115, 100, 121, 110, 45, 105,
+	112, 50, 52, 100, 121, 110, 97, 108, 105, 97, 115, 101, 97, 115, 116, 97, 115, 105, 97, 101,
+	99, 111, 108, 111, 103, 105, 97, 101, 99, 111, 110, 111, 109, 105, 97, 101, 100, 117, 99, 97,
+	116, 111, 114, 101, 103, 101, 114, 115, 117, 110, 100, 101, 103, 121, 112, 116, 105, 97, 110, 101,
+	105, 100, 102, 106, 111, 114, 100, 101, 105, 100, 115, 98, 101, 114, 103, 101, 105, 100, 115, 118,
+	111, 108, 108, 101, 110, 103, 101, 114, 100, 97, 108, 101, 110, 115, 99, 97, 108, 101, 100, 101,
+	112, 105, 108, 101, 112, 115, 121, 101, 114, 105, 99, 115, 115, 111, 110, 101, 116, 105, 115, 97,
+	108, 97, 116, 101, 118, 101, 110, 97, 115, 115, 105, 101, 118, 101, 110, 110, 111, 100, 101, 102,
+	97, 109, 105, 108, 121, 100, 115, 102, 97, 115, 116, 108, 121, 108, 98, 102, 101, 101, 100, 98,
+	97, 99, 107, 102, 101, 110, 116, 105, 103, 101, 114, 102, 101, 115, 116, 101, 45, 105, 112, 102,
+	105, 100, 101, 108, 105, 116, 121, 102, 105, 103, 117, 101, 114, 101, 115, 102, 105, 110, 101, 97,
+	114, 116, 115, 102, 105, 114, 109, 100, 97, 108, 101, 102, 108, 97, 107, 115, 116, 97, 100, 102,
+	108, 97, 110, 100, 101, 114, 115, 102, 108, 101, 115, 98, 101, 114, 103, 102, 108, 111, 114, 101,
+	110, 99, 101, 102, 111, 111, 116, 98, 97, 108, 108, 102, 111, 114, 45, 115, 111, 109, 101, 102,
+	114, 45, 112, 97, 114, 45, 49, 102, 114, 45, 112, 97, 114, 45, 50, 102, 114, 101, 101, 109,
+	121, 105, 112, 102, 114, 101, 101, 115, 105, 116, 101, 102, 114, 101, 105, 98, 117, 114, 103, 102,
+	114, 105, 98, 111, 117, 114, 103, 102, 114, 111, 110, 116, 105, 101, 114, 102, 117, 106, 105, 109,
+	105, 110, 111, 102, 117, 106, 105, 115, 97, 116, 111, 102, 117, 106, 105, 115, 97, 119, 97, 102,
+	117, 107, 97, 103, 97, 119, 97, 102, 117, 107, 117, 100, 111, 109, 105, 102, 117, 107, 117, 115,
+	97, 107, 105, 102, 117, 107, 117, 121, 97, 109, 97, 102, 117, 110, 97, 103, 97, 116, 97, 102,
+	117, 110, 100, 97, 99, 105, 111, 102, 117, 114, 117, 98, 105, 114, 97, 102, 117, 114, 117, 100,
+	111, 110, 111, 102, 117, 114, 117, 107, 97, 119, 97, 102, 121, 114, 101, 115, 100, 97, 108, 103,
+	97, 109, 97, 103, 111, 114, 105, 103, 101, 110, 116, 97, 112, 112, 115, 103, 106, 101, 114, 100,
+	114, 117, 109, 103, 106, 101, 114, 115, 116, 97, 100, 103, 111, 111, 100, 121, 101, 97, 114, 103,
+	114, 97, 105, 110, 103, 101, 114, 103, 114, 97, 112, 104, 105, 99, 115, 103, 114, 105, 109, 115,
+	116, 97, 100, 103, 114, 111, 115, 115, 101, 116, 111, 103, 117, 97, 114, 100, 105, 97, 110, 103,
+	117, 101, 114, 110, 115, 101, 121, 103, 121, 101, 111, 110, 103, 103, 105, 104, 97, 98, 105, 107,
+	105, 110, 111, 104, 97, 99, 104, 105, 111, 106, 105, 104, 97, 107, 111, 100, 97, 116, 101, 104,
+	97, 109, 97, 116, 97, 109, 97, 104, 97, 110, 97, 109, 97, 107, 105, 104, 97, 115, 104, 98,
+	97, 110, 103, 104, 97, 116, 111, 103, 97, 121, 97, 104, 97, 116, 111, 121, 97, 109, 97, 104,
+	97, 121, 97, 107, 97, 119, 97, 104, 100, 102, 99, 98, 97, 110, 107, 104, 101, 108, 115, 105,
+	110, 107, 105, 104, 101, 109, 115, 101, 100, 97, 108, 104, 101, 112, 102, 111, 114, 103, 101, 104,
+	105, 110, 111, 104, 97, 114, 97, 104, 105, 114, 97, 107, 97, 116, 97, 104, 105, 114, 111, 103,
+	97, 119, 97, 104, 105, 114, 111, 107, 97, 119, 97, 104, 105, 114, 111, 115, 97, 107, 105, 104,
+	105, 115, 97, 121, 97, 109, 97, 104, 105, 115, 116, 111, 105, 114, 101, 104, 106, 97, 114, 116,
+	100, 97, 108, 104, 111, 107, 107, 97, 105, 100, 111, 104, 111, 107, 107, 115, 117, 110, 100, 104,
+	111, 108, 100, 105, 110, 103, 115, 104, 111, 108, 116, 97, 108, 101, 110, 104, 111, 109, 101, 108,
+	105, 110, 107, 104, 111, 109, 101, 117, 110, 105, 120, 104, 111, 110, 98, 101, 116, 115, 117, 104,
+	111, 110, 101, 102, 111, 115, 115, 104, 111, 114, 111, 108, 111, 103, 121, 104, 111, 114, 111, 110,
+	111, 98, 101, 104, 111, 115, 112, 105, 116, 97, 108, 104, 111, 115, 116, 101, 100, 112, 105, 104,
+	111, 121, 97, 110, 103, 101, 114, 105, 99, 104, 105, 104, 97, 114, 97, 105, 110, 97, 115, 104,
+	105, 107, 105, 105, 110, 97, 116, 115, 117, 107, 105, 105, 110, 100, 105, 103, 101, 110, 97, 105,
+	110, 102, 105, 110, 105, 116, 105, 105, 110, 103, 97, 116, 108, 97, 110, 105, 112, 105, 114, 97,
+	110, 103, 97, 105, 115, 45, 97, 45, 99, 112, 97, 105, 115, 45, 102, 111, 117, 110, 100, 105,
+	115, 45, 115, 97, 118, 101, 100, 105, 115, 45, 115, 108, 105, 99, 107, 105, 115, 97, 45, 103,
+	101, 101, 107, 105, 115, 104, 105, 103, 97, 107, 105, 105, 115, 104, 105, 107, 97, 114, 105, 105,
+	115, 116, 97, 110, 98, 117, 108, 105, 116, 97, 98, 97, 115, 104, 105, 105, 116, 111, 105, 103,
+	97, 119, 97, 105, 119, 97, 105, 122, 117, 109, 105, 105, 119, 97, 116, 115, 117, 107, 105, 106,
+	97, 119, 111, 114, 122, 110, 111, 106, 101, 108, 97, 115, 116, 105, 99, 106, 101, 115, 115, 104,
+	101, 105, 109, 106, 101, 118, 110, 97, 107, 101, 114, 106, 108, 115, 45, 115, 116, 111, 49, 106,
+	108, 115, 45, 115, 116, 111, 50, 106, 108, 115, 45, 115, 116, 111, 51, 106, 111, 116, 101, 108,
+	117, 108, 117, 106, 112, 109, 111, 114, 103, 97, 110, 107, 97, 100, 111, 103, 97, 119, 97, 107,
+	97, 103, 97, 109, 105, 110, 111, 107, 97, 107, 101, 103, 97, 119, 97, 107, 97, 107, 105, 110,
+	111, 107, 105, 107, 97, 107, 111, 103, 97, 119, 97, 107, 97, 108, 109, 121, 107, 105, 97, 107,
+	97, 109, 97, 103, 97, 121, 97, 107, 97, 109, 97, 105, 115, 104, 105, 107, 97, 109, 97, 107,
+	117, 114, 97, 107, 97, 109, 101, 121, 97, 109, 97, 107, 97, 109, 105, 103, 111, 114, 105, 107,
+	97, 109, 105, 105, 99, 104, 105, 107, 97, 109, 105, 107, 97, 119, 97, 107, 97, 109, 105, 109,
+	105, 110, 101, 107, 97, 109, 105, 115, 97, 116, 111, 107, 97, 109, 105, 116, 115, 117, 101, 107,
+	97, 109, 111, 101, 110, 97, 105, 107, 97, 109, 111, 103, 97, 119, 97, 107, 97, 110, 97, 103,
+	97, 119, 97, 107, 97, 110, 97, 122, 97, 119, 97, 107, 97, 110, 101, 121, 97, 109, 97, 107,
+	97, 114, 97, 115, 106, 111, 107, 107, 97, 115, 97, 104, 97, 114, 97, 107, 97, 115, 117, 107,
+	97, 98, 101, 107, 97, 116, 97, 103, 97, 109, 105, 107, 97, 116, 111, 119, 105, 99, 101, 107,
+	97, 119, 97, 104, 97, 114, 97, 107, 97, 119, 97, 106, 105, 109, 97, 107, 97, 119, 97, 107,
+	105, 116, 97, 107, 97, 119, 97, 109, 97, 116, 97, 107, 97, 119, 97, 110, 97, 98, 101, 107,
+	97, 119, 97, 115, 97, 107, 105, 107, 97, 119, 97, 116, 97, 110, 97, 107, 101, 109, 98, 117,
+	99, 104, 105, 107, 105, 98, 105, 99, 104, 117, 111, 107, 105, 107, 105, 114, 97, 114, 97, 107,
+	105, 107, 117, 103, 97, 119, 97, 107, 105, 110, 103, 104, 111, 115, 116, 107, 105, 110, 111, 107,
+	97, 119, 97, 107, 105, 114, 107, 101, 110, 101, 115, 107, 105, 115, 97, 114, 97, 122, 117, 107,
+	105, 115, 111, 115, 97, 107, 105, 107, 105, 116, 97, 97, 105, 107, 105, 107, 105, 116, 97, 103,
+	97, 116, 97, 107, 105, 116, 97, 103, 97, 119, 97, 107, 105, 116, 97, 104, 97, 116, 97, 107,
+	105, 116, 97, 107, 97, 109, 105, 107, 105, 116, 97, 107, 97, 116, 97, 107, 105, 116, 97, 109,
+	111, 116, 111, 107, 105, 121, 111, 107, 97, 119, 97, 107, 105, 121, 111, 115, 97, 116, 111, 107,
+	111, 109, 97, 103, 97, 110, 101, 107, 111, 110, 115, 117, 108, 97, 116, 107, 111, 110, 121, 118,
+	101, 108, 111, 107, 111, 112, 101, 114, 118, 105, 107, 107, 111, 116, 111, 104, 105, 114, 97, 107,
+	111, 122, 97, 103, 97, 119, 97, 107, 114, 101, 108, 108, 105, 97, 110, 107, 116, 105, 115, 116,
+	111, 114, 121, 107, 117, 100, 111, 121, 97, 109, 97, 107, 117, 106, 117, 107, 117, 114, 105, 107,
+	117, 108, 101, 117, 118, 101, 110, 107, 117, 109, 97, 103, 97, 121, 97, 107, 117, 109, 97, 109,
+	111, 116, 111, 107, 117, 109, 97, 116, 111, 114, 105, 107, 117, 109, 101, 106, 105, 109, 97, 107,
+	117, 109, 105, 121, 97, 109, 97, 107, 117, 110, 105, 103, 97, 109, 105, 107, 117, 110, 105, 115,
+	97, 107, 105, 107, 117, 110, 105, 116, 111, 109, 105, 107, 117, 110, 110, 101, 112, 112, 117, 107,
+	117, 114, 105, 121, 97, 109, 97, 107, 117, 114, 111, 105, 115, 104, 105, 107, 117, 114, 111, 116,
+	97, 107, 105, 107, 117, 115, 116, 97, 110, 97, 105, 107, 117, 122, 117, 109, 97, 107, 105, 107,
+	118, 97, 102, 106, 111, 114, 100, 107, 118, 97, 108, 115, 117, 110, 100, 107, 121, 111, 116, 97,
+	109, 98, 97, 107, 121, 111, 116, 97, 110, 103, 111, 108, 97, 110, 103, 101, 118, 97, 103, 108,
+	97, 115, 112, 101, 122, 105, 97, 108, 97, 118, 97, 110, 103, 101, 110, 108, 99, 108, 115, 116,
+	97, 103, 101, 108, 101, 118, 97, 110, 103, 101, 114, 108, 105, 103, 104, 116, 105, 110, 103, 108,
+	105, 109, 97, 110, 111, 119, 97, 108, 111, 100, 105, 110, 103, 101, 110, 108, 111, 109, 98, 97,
+	114, 100, 121, 108, 111, 110, 100, 114, 105, 110, 97, 108, 111, 118, 101, 115, 105, 99, 107, 108,
+	111, 121, 97, 108, 105, 115, 116, 108, 117, 98, 97, 114, 116, 111, 119, 108, 117, 110, 100, 98,
+	101, 99, 107, 109, 97, 99, 101, 114, 97, 116, 97, 109, 97, 101, 98, 97, 115, 104, 105, 109,
+	97, 103, 97, 122, 105, 110, 101, 109, 97, 108, 108, 111, 114, 99, 97, 109, 97, 110, 115, 105,
+	111, 110, 115, 109, 97, 114, 105, 116, 105, 109, 101, 109, 97, 114, 105, 116, 105, 109, 111, 109,
+	97, 114, 114, 105, 111, 116, 116, 109, 97, 114, 117, 103, 97, 109, 101, 109, 97, 114, 117, 109,
+	111, 114, 105, 109, 97, 114, 121, 108, 97, 110, 100, 109, 97, 115, 101, 114, 97, 116, 105, 109,
+	97, 116, 115, 117, 109, 97, 101, 109, 97, 116, 115, 117, 117, 114, 97, 109, 97, 121, 102, 105,
+	114, 115, 116, 109, 97, 122, 101, 112, 108, 97, 121, 109, 97, 122, 111, 119, 115, 122, 101, 109,
+	99, 107, 105, 110, 115, 101, 121, 109, 101, 100, 105, 99, 105, 110, 97, 109, 101, 109, 111, 114,
+	105, 97, 108, 109, 101, 114, 99, 107, 109, 115, 100, 109, 101, 114, 115, 101, 105, 110, 101, 109,
+	101, 115, 115, 101, 114, 108, 105, 109, 105, 99, 104, 105, 103, 97, 110, 109, 105, 108, 105, 116,
+	97, 114, 121, 109, 105, 110, 97, 107, 97, 109, 105, 109, 105, 110, 97, 109, 97, 116, 97, 109,
+	105, 110, 105, 115, 105, 116, 101, 109, 105, 110, 111, 107, 97, 109, 111, 109, 105, 114, 99, 108,
+	111, 117, 100, 109, 105, 121, 97, 119, 97, 107, 97, 109, 105, 121, 97, 122, 97, 107, 105, 109,
+	105, 122, 117, 109, 97, 107, 105, 109, 105, 122, 117, 110, 97, 109, 105, 109, 105, 122, 117, 115,
+	97, 119, 97, 109, 111, 109, 98, 101, 116, 115, 117, 109, 111, 110, 109, 111, 117, 116, 104, 109,
+	111, 110, 116, 114, 101, 97, 108, 109, 111, 114, 100, 111, 118, 105, 97, 109, 111, 114, 105, 121,
+	97, 109, 97, 109, 111, 114, 111, 121, 97, 109, 97, 109, 111, 114, 116, 103, 97, 103, 101, 109,
+	111, 115, 101, 117, 115, 104, 105, 109, 111, 115, 107, 101, 110, 101, 115, 109, 111, 116, 111, 121,
+	97, 109, 97, 109, 117, 101, 110, 99, 104, 101, 110, 109, 117, 108, 104, 111, 117, 115, 101, 109,
+	117, 110, 97, 107, 97, 116, 97, 109, 117, 114, 97, 107, 97, 109, 105, 109, 117, 114, 109, 97,
+	110, 115, 107, 109, 121, 45, 118, 105, 103, 111, 114, 109, 121, 100, 111, 98, 105, 115, 115, 109,
+	121, 101, 102, 102, 101, 99, 116, 109, 121, 105, 112, 104, 111, 115, 116, 109, 121, 107, 111, 108,
+	97, 105, 118, 109, 121, 109, 97, 105, 108, 101, 114, 109, 121, 112, 104, 111, 116, 111, 115, 109,
+	121, 116, 117, 108, 101, 97, 112, 110, 97, 103, 97, 104, 97, 109, 97, 110, 97, 103, 97, 115,
+	97, 107, 105, 110, 97, 103, 97, 116, 111, 114, 111, 110, 97, 107, 97, 103, 97, 119, 97, 110,
+	97, 107, 97, 109, 117, 114, 97, 110, 97, 107, 97, 110, 111, 106, 111, 110, 97, 107, 97, 110,
+	111, 116, 111, 110, 97, 107, 97, 116, 97, 110, 101, 110, 97, 107, 97, 121, 97, 109, 97, 110,
+	97, 109, 101, 103, 97, 116, 97, 110, 97, 109, 101, 103, 97, 119, 97, 110, 97, 109, 105, 107,
+	97, 116, 97, 110, 97, 111, 115, 104, 105, 109, 97, 110, 97, 114, 117, 115, 97, 119, 97, 110,
+	97, 114, 118, 105, 105, 107, 97, 110, 97, 117, 109, 98, 117, 114, 103, 110, 97, 117, 115, 116,
+	100, 97, 108, 110, 97, 118, 117, 111, 116, 110, 97, 110, 101, 97, 116, 45, 117, 114, 108, 110,
+	101, 98, 114, 97, 115, 107, 97, 110, 101, 115, 111, 100, 100, 101, 110, 110, 101, 121, 97, 103,
+	97, 119, 97, 110, 105, 99, 104, 105, 110, 97, 110, 110, 105, 105, 107, 97, 112, 112, 117, 110,
+	105, 107, 111, 108, 97, 101, 118, 110, 105, 110, 111, 109, 105, 121, 97, 110, 105, 114, 97, 115,
+	97, 107, 105, 110, 105, 115, 104, 105, 105, 122, 117, 110, 105, 115, 115, 101, 100, 97, 108, 110,
+	105, 116, 116, 101, 100, 97, 108, 110, 108, 45, 97, 109, 115, 45, 49, 110, 111, 110, 111, 105,
+	99, 104, 105, 110, 111, 114, 100, 107, 97, 112, 112, 110, 111, 114, 100, 108, 97, 110, 100, 110,
+	111, 115, 101, 103, 97, 119, 97, 110, 111, 116, 97, 105, 114, 101, 115, 110, 111, 116, 105, 99,
+	105, 97, 115, 110, 111, 116, 111, 100, 100, 101, 110, 110, 111, 116, 111, 103, 97, 119, 97, 110,
+	111, 116, 116, 101, 114, 111, 121, 110, 111, 118, 101, 99, 111, 114, 101, 110, 111, 119, 97, 114,
+	117, 100, 97, 111, 98, 115, 101, 114, 118, 101, 114, 111, 102, 102, 105, 99, 105, 97, 108, 111,
+	104, 116, 97, 119, 97, 114, 97, 111, 107, 117, 105, 122, 117, 109, 111, 111, 109, 97, 101, 122,
+	97, 107, 105, 111, 110, 45, 97, 99, 111, 114, 110, 111, 110, 111, 109, 105, 99, 104, 105, 111,
+	110, 112, 111, 114, 116, 101, 114, 111, 110, 114, 101, 110, 100, 101, 114, 111, 112, 112, 101, 103,
+	97, 114, 100, 111, 114, 105, 115, 116, 97, 110, 111, 111, 114, 107, 97, 110, 103, 101, 114, 111,
+	114, 116, 115, 105, 110, 102, 111, 111, 121, 103, 97, 114, 100, 101, 110, 112, 97, 114, 97, 108,
+	108, 101, 108, 112, 97, 114, 97, 115, 105, 116, 101, 112, 97, 115, 97, 100, 101, 110, 97, 112,
+	97, 121, 119, 104, 105, 114, 108, 112, 104, 97, 114, 109, 97, 99, 121, 112, 105, 97, 99, 101,
+	110, 122, 97, 112, 105, 99, 116, 117, 114, 101, 115, 112, 105, 101, 100, 109, 111, 110, 116, 112,
+	105, 101, 109, 111, 110, 116, 101, 112, 105, 109, 105, 101, 110, 116, 97, 112, 105, 120, 111, 108,
+	105, 110, 111, 112, 108, 97, 116, 116, 101, 114, 112, 112, 108, 117, 109, 98, 105, 110, 103, 112,
+	111, 100, 108, 97, 115, 105, 101, 112, 111, 107, 114, 111, 118, 115, 107, 112, 111, 108, 105, 116,
+	105, 99, 97, 112, 111, 114, 115, 97, 110, 103, 117, 112, 111, 114, 116, 108, 97, 110, 100, 112,
+	114, 101, 115, 105, 100, 105, 111, 112, 114, 105, 109, 101, 116, 101, 108, 112, 114, 105, 110, 99,
+	105, 112, 101, 112, 114, 111, 112, 101, 114, 116, 121, 112, 114, 111, 116, 111, 110, 101, 116, 112,
+	114, 117, 115, 122, 107, 111, 119, 112, 117, 115, 115, 121, 99, 97, 116, 114, 97, 99, 107, 109,
+	97, 122, 101, 114, 97, 105, 108, 114, 111, 97, 100, 114, 97, 105, 110, 100, 114, 111, 112, 114,
+	97, 108, 105, 110, 103, 101, 110, 114, 97, 110, 107, 111, 115, 104, 105, 114, 97, 119, 97, 45,
+	109, 97, 122, 114, 101, 100, 115, 116, 111, 110, 101, 114, 101, 108, 105, 97, 110, 99, 101, 114,
+	101, 109, 111, 116, 101, 119, 100, 114, 101, 110, 100, 97, 108, 101, 110, 114, 101, 110, 110, 101,
+	115, 111, 121, 114, 101, 115, 101, 97, 114, 99, 104, 114, 105, 98, 101, 105, 114, 97, 111, 114,
+	105, 111, 112, 114, 101, 116, 111, 114, 111, 107, 117, 110, 111, 104, 101, 115, 97, 97, 114, 108,
+	97, 110, 100, 115, 97, 107, 97, 104, 111, 103, 105, 115, 97, 107, 101, 103, 97, 119, 97, 115,
+	97, 108, 97, 110, 103, 101, 110, 115, 97, 108, 122, 98, 117, 114, 103, 115, 97, 109, 101, 103,
+	97, 119, 97, 115, 97, 109, 115, 99, 108, 117, 98, 115, 97, 109, 117, 107, 97, 119, 97, 115,
+	97, 110, 100, 99, 97, 116, 115, 115, 97, 110, 100, 105, 101, 103, 111, 115, 97, 111, 103, 111,
+	110, 99, 97, 115, 97, 114, 100, 101, 103, 110, 97, 115, 97, 114, 100, 105, 110, 105, 97, 115,
+	97, 115, 97, 103, 117, 114, 105, 115, 97, 115, 97, 121, 97, 109, 97, 115, 97, 117, 104, 101,
+	114, 97, 100, 115, 99, 111, 116, 108, 97, 110, 100, 115, 100, 115, 99, 108, 111, 117, 100, 115,
+	101, 107, 105, 107, 97, 119, 97, 115, 101, 108, 108, 115, 45, 105, 116, 115, 101, 114, 118, 101,
+	98, 98, 115, 115, 101, 114, 118, 101, 102, 116, 112, 115, 101, 114, 118, 101, 105, 114, 99, 115,
+	101, 114, 118, 101, 109, 112, 51, 115, 101, 114, 118, 101, 112, 50, 112, 115, 101, 114, 118, 105,
+	99, 101, 115, 115, 101, 116, 97, 103, 97, 121, 97, 115, 101, 116, 111, 117, 99, 104, 105, 115,
+	101, 116, 116, 108, 101, 114, 115, 115, 104, 97, 99, 107, 110, 101, 116, 115, 104, 97, 107, 111,
+	116, 97, 110, 115, 104, 105, 98, 101, 99, 104, 97, 115, 104, 105, 110, 105, 99, 104, 105, 115,
+	104, 105, 110, 106, 117, 107, 117, 115, 104, 105, 110, 116, 111, 107, 117, 115, 104, 105, 110, 116,
+	111, 109, 105, 115, 104, 105, 111, 103, 97, 109, 97, 115, 104, 105, 111, 106, 105, 114, 105, 115,
+	104, 105, 114, 97, 111, 107, 97, 115, 104, 105, 122, 117, 111, 107, 97, 115, 104, 111, 112, 112,
+	105, 110, 103, 115, 104, 111, 112, 119, 97, 114, 101, 115, 104, 111, 119, 116, 105, 109, 101, 115,
+	105, 114, 97, 99, 117, 115, 97, 115, 105, 116, 101, 108, 101, 97, 102, 115, 107, 97, 110, 108,
+	97, 110, 100, 115, 107, 105, 112, 116, 118, 101, 116, 115, 107, 106, 101, 114, 118, 111, 121, 115,
+	109, 117, 115, 104, 99, 100, 110, 115, 111, 102, 116, 98, 97, 110, 107, 115, 111, 102, 116, 119,
+	97, 114, 101, 115, 111, 114, 45, 102, 114, 111, 110, 115, 111, 114, 45, 111, 100, 97, 108, 115,
+	111, 114, 111, 99, 97, 98, 97, 115, 111, 114, 114, 101, 105, 115, 97, 115, 111, 114, 116, 108,
+	97, 110, 100, 115, 112, 97, 99, 101, 107, 105, 116, 115, 112, 101, 99, 116, 114, 117, 109, 115,
+	116, 97, 108, 98, 97, 110, 115, 115, 116, 97, 114, 103, 97, 114, 100, 115, 116, 99, 103, 114,
+	111, 117, 112, 115, 116, 103, 115, 116, 97, 103, 101, 115, 116, 114, 105, 112, 112, 101, 114, 115,
+	117, 103, 105, 110, 97, 109, 105, 115, 117, 107, 97, 103, 97, 119, 97, 115, 117, 110, 110, 121,
+	100, 97, 121, 115, 117, 112, 97, 98, 97, 115, 101, 115, 117, 112, 112, 108, 105, 101, 115, 115,
+	117, 114, 110, 97, 100, 97, 108, 115, 118, 97, 108, 98, 97, 114, 100, 115, 118, 105, 122, 122,
+	101, 114, 97, 115, 119, 105, 100, 110, 105, 99, 97, 115, 121, 110, 99, 108, 111, 117, 100, 115,
+	122, 99, 122, 101, 99, 105, 110, 115, 122, 99, 122, 121, 116, 110, 111, 116, 51, 108, 51, 112,
+	48, 114, 116, 116, 97, 98, 97, 121, 97, 109, 97, 116, 97, 107, 97, 104, 97, 103, 105, 116,
+	97, 107, 97, 104, 97, 109, 97, 116, 97, 107, 97, 104, 97, 114, 117, 116, 97, 107, 97, 104,
+	97, 116, 97, 116, 97, 107, 97, 105, 115, 104, 105, 116, 97, 107, 97, 109, 111, 114, 105, 116,
+	97, 107, 97, 110, 97, 98, 101, 116, 97, 107, 97, 115, 97, 103, 111, 116, 97, 107, 97, 115,
+	97, 107, 105, 116, 97, 107, 97, 116, 111, 114, 105, 116, 97, 107, 97, 121, 97, 109, 97, 116,
+	97, 107, 97, 122, 97, 107, 105, 116, 97, 107, 101, 104, 97, 114, 97, 116, 97, 107, 101, 116,
+	111, 109, 105, 116, 97, 107, 105, 107, 97, 119, 97, 116, 97, 107, 105, 110, 111, 117, 101, 116,
+	97, 109, 97, 107, 97, 119, 97, 116, 97, 109, 97, 109, 117, 114, 97, 116, 97, 110, 97, 103,
+	117, 114, 97, 116, 97, 110, 97, 110, 103, 101, 114, 116, 97, 110, 111, 104, 97, 116, 97, 116,
+	97, 114, 117, 109, 105, 122, 117, 116, 97, 115, 104, 107, 101, 110, 116, 116, 97, 116, 101, 121,
+	97, 109, 97, 116, 101, 108, 101, 109, 97, 114, 107, 116, 101, 109, 112, 45, 100, 110, 115, 116,
+	101, 114, 110, 111, 112, 105, 108, 116, 104, 114, 117, 104, 101, 114, 101, 116, 105, 110, 103, 118,
+	111, 108, 108, 116, 111, 104, 110, 111, 115, 104, 111, 116, 111, 107, 105, 103, 97, 119, 97, 116,
+	111, 107, 111, 110, 97, 109, 101, 116, 111, 107, 117, 121, 97, 109, 97, 116, 111, 109, 105, 115,
+	97, 116, 111, 116, 111, 110, 107, 111, 116, 115, 117, 116, 111, 110, 115, 98, 101, 114, 103, 116,
+	111, 112, 111, 108, 111, 103, 121, 116, 111, 114, 97, 104, 105, 109, 101, 116, 111, 121, 111, 107,
+	97, 119, 97, 116, 111, 121, 111, 110, 97, 107, 97, 116, 111, 121, 111, 115, 97, 116, 111, 116,
+	111, 121, 111, 116, 111, 109, 105, 116, 114, 97, 105, 110, 105, 110, 103, 116, 114, 97, 110, 115,
+	117, 114, 108, 116, 114, 111, 97, 110, 100, 105, 110, 116, 114, 111, 103, 115, 116, 97, 100, 116,
+	115, 117, 98, 101, 116, 115, 117, 116, 115, 117, 107, 97, 101, 114, 117, 116, 115, 117, 109, 97,
+	103, 111, 105, 116, 115, 117, 114, 117, 111, 107, 97, 116, 121, 112, 101, 102, 111, 114, 109, 116,
+	121, 115, 102, 106, 111, 114, 100, 117, 50, 45, 108, 111, 99, 97, 108, 117, 99, 104, 105, 104,
+	97, 114, 97, 117, 99, 104, 105, 110, 97, 100, 97, 117, 99, 104, 105, 110, 111, 109, 105, 117,
+	101, 110, 111, 104, 97, 114, 97, 117, 110, 100, 101, 114, 115, 101, 97, 117, 110, 105, 99, 108,
+	111, 117, 100, 117, 110, 105, 115, 112, 97, 99, 101, 117, 114, 101, 115, 104, 105, 110, 111, 117,
+	115, 103, 97, 114, 100, 101, 110, 117, 122, 104, 103, 111, 114, 111, 100, 118, 97, 110, 103, 117,
+	97, 114, 100, 118, 97, 110, 121, 108, 118, 101, 110, 118, 98, 114, 112, 108, 115, 98, 120, 118,
+	101, 110, 110, 101, 115, 108, 97, 118, 101, 110, 116, 117, 114, 101, 115, 118, 101, 114, 98, 97,
+	110, 105, 97, 118, 101, 114, 99, 101, 108, 108, 105, 118, 101, 114, 105, 115, 105, 103, 110, 118,
+	101, 115, 116, 102, 111, 108, 100, 118, 105, 114, 103, 105, 110, 105, 97, 118, 108, 97, 100, 105,
+	109, 105, 114, 118, 112, 115, 45, 104, 111, 115, 116, 119, 97, 107, 97, 121, 97, 109, 97, 119,
+	97, 107, 107, 97, 110, 97, 105, 119, 97, 108, 108, 111, 110, 105, 101, 119, 97, 110, 111, 117,
+	99, 104, 105, 119, 97, 114, 115, 122, 97, 119, 97, 119, 101, 98, 115, 112, 97, 99, 101, 119,
+	101, 100, 101, 112, 108, 111, 121, 119, 101, 115, 116, 49, 45, 117, 115, 119, 105, 97, 114, 100,
+	119, 101, 98, 119, 105, 108, 100, 108, 105, 102, 101, 119, 105, 110, 100, 109, 105, 108, 108, 119,
+	111, 111, 100, 115, 105, 100, 101, 119, 111, 114, 107, 115, 104, 111, 112, 120, 110, 45, 45, 56,
+	48, 97, 117, 120, 110, 45, 45, 57, 48, 97, 101, 120, 110, 45, 45, 100, 49, 97, 116, 120,
+	110, 45, 45, 110, 111, 100, 101, 120, 110, 45, 45, 112, 49, 97, 105, 120, 110, 45, 45, 113,
+	120, 97, 109, 121, 97, 109, 97, 103, 97, 116, 97, 121, 97, 109, 97, 107, 105, 116, 97, 121,
+	97, 109, 97, 109, 111, 116, 111, 121, 97, 109, 97, 110, 111, 98, 101, 121, 97, 110, 97, 103,
+	97, 119, 97, 121, 111, 107, 111, 104, 97, 109, 97, 121, 111, 107, 111, 115, 117, 107, 97, 121,
+	111, 108, 97, 115, 105, 116, 101, 121, 111, 110, 97, 98, 97, 114, 117, 121, 111, 110, 97, 103,
+	117, 110, 105, 121, 111, 110, 101, 122, 97, 119, 97, 121, 111, 115, 101, 109, 105, 116, 101, 121,
+	111, 115, 104, 105, 111, 107, 97, 121, 117, 103, 97, 119, 97, 114, 97, 121, 117, 115, 117, 104,
+	97, 114, 97, 122, 97, 107, 111, 112, 97, 110, 101, 122, 101, 110, 116, 115, 117, 106, 105, 122,
+	104, 105, 116, 111, 109, 105, 114, 122, 104, 121, 116, 111, 109, 121, 114, 49, 50, 51, 115, 97,
+	105, 116, 97, 98, 111, 103, 97, 100, 111, 97, 98, 114, 117, 122, 122, 111, 97, 99, 97, 100,
+	101, 109, 121, 97, 100, 121, 103, 101, 121, 97, 97, 103, 97, 107, 104, 97, 110, 97, 103, 100,
+	101, 110, 101, 115, 97, 105, 98, 101, 116, 115, 117, 97, 105, 114, 108, 105, 110, 101, 97, 105,
+	114, 112, 111, 114, 116, 97, 107, 97, 98, 105, 114, 97, 97, 107, 105, 114, 117, 110, 111, 97,
+	107, 107, 101, 115, 104, 105, 97, 108, 97, 98, 97, 109, 97, 97, 108, 101, 115, 117, 110, 100,
+	97, 108, 105, 98, 97, 98, 97, 97, 110, 97, 109, 105, 122, 117, 97, 110, 100, 114, 111, 105,
+	100, 97, 110, 112, 97, 99, 104, 105, 97, 112, 112, 115, 112, 111, 116, 97, 114, 101, 109, 97,
+	114, 107, 97, 114, 101, 110, 100, 97, 108, 97, 114, 109, 101, 110, 105, 97, 97, 114, 116, 100,
+	101, 99, 111, 97, 115, 97, 107, 97, 119, 97, 97, 115, 101, 105, 110, 101, 116, 97, 115, 107,
+	118, 111, 108, 108, 97, 116, 104, 108, 101, 116, 97, 97, 116, 108, 97, 110, 116, 97, 97, 117,
+	99, 116, 105, 111, 110, 97, 117, 100, 105, 98, 108, 101, 97, 117, 114, 108, 97, 110, 100, 97,
+	117, 115, 112, 111, 115, 116, 97, 118, 105, 97, 110, 99, 97, 97, 118, 111, 99, 97, 116, 115,
+	97, 119, 115, 109, 112, 112, 108, 97, 120, 97, 114, 110, 101, 116, 97, 121, 97, 103, 97, 119,
+	97, 97, 122, 105, 109, 117, 116, 104, 97, 122, 117, 109, 105, 110, 111, 98, 97, 100, 97, 106,
+	111, 122, 98, 97, 103, 104, 100, 97, 100, 98, 97, 106, 100, 100, 97, 114, 98, 97, 109, 98,
+	105, 110, 97, 98, 97, 110, 97, 109, 101, 120, 98, 97, 114, 117, 101, 114, 105, 98, 97, 117,
+	104, 97, 117, 115, 98, 101, 108, 108, 117, 110, 111, 98, 101, 110, 116, 108, 101, 121, 98, 101,
+	114, 103, 97, 109, 111, 98, 101, 114, 103, 98, 97, 117, 98, 101, 115, 107, 105, 100, 121, 98,
+	101, 115, 116, 98, 117, 121, 98, 105, 101, 108, 97, 119, 97, 98, 105, 114, 100, 97, 114, 116,
+	98, 106, 97, 114, 107, 111, 121, 98, 108, 111, 103, 100, 110, 115, 98, 108, 111, 120, 99, 109,
+	115, 98, 111, 108, 105, 118, 105, 97, 98, 111, 108, 111, 103, 110, 97, 98, 111, 111, 107, 105,
+	110, 103, 98, 111, 120, 102, 117, 115, 101, 98, 112, 108, 97, 99, 101, 100, 98, 114, 101, 110,
+	100, 108, 121, 98, 114, 101, 115, 99, 105, 97, 98, 114, 105, 115, 116, 111, 108, 98, 114, 111,
+	116, 104, 101, 114, 98, 114, 121, 97, 110, 115, 107, 98, 117, 100, 101, 106, 106, 117, 98, 117,
+	107, 104, 97, 114, 97, 98, 117, 114, 103, 104, 111, 102, 98, 117, 121, 115, 104, 111, 112, 98,
+	121, 103, 108, 97, 110, 100, 99, 97, 114, 97, 99, 97, 108, 99, 97, 114, 97, 118, 97, 110,
+	99, 97, 114, 101, 101, 114, 115, 99, 97, 114, 114, 105, 101, 114, 99, 97, 115, 97, 99, 97,
+	109, 99, 97, 115, 101, 114, 116, 97, 99, 97, 115, 116, 114, 101, 115, 99, 97, 116, 97, 110,
+	105, 97, 99, 97, 116, 102, 111, 111, 100, 99, 101, 99, 104, 105, 114, 101, 99, 101, 114, 116,
+	109, 103, 114, 99, 102, 45, 105, 112, 102, 115, 99, 104, 97, 114, 105, 116, 121, 99, 104, 97,
+	114, 116, 101, 114, 99, 104, 105, 99, 97, 103, 111, 99, 104, 105, 106, 105, 119, 97, 99, 104,
+	105, 107, 117, 103, 111, 99, 104, 105, 107, 117, 106, 111, 99, 104, 105, 107, 117, 109, 97, 99,
+	104, 105, 110, 116, 97, 105, 99, 104, 105, 116, 111, 115, 101, 99, 104, 105, 121, 111, 100, 97,
+	99, 104, 111, 119, 100, 101, 114, 99, 105, 101, 110, 99, 105, 97, 99, 105, 101, 115, 122, 121,
+	110, 99, 105, 115, 116, 114, 111, 110, 99, 105, 116, 97, 100, 101, 108, 99, 108, 100, 109, 97,
+	105, 108, 99, 108, 105, 110, 116, 111, 110, 99, 108, 111, 117, 100, 54, 54, 99, 108, 111, 117,
+	100, 110, 115, 99, 108, 117, 98, 109, 101, 100, 99, 111, 99, 111, 116, 116, 101, 99, 111, 108,
+	100, 119, 97, 114, 99, 111, 108, 111, 103, 110, 101, 99, 111, 109, 99, 97, 115, 116, 99, 111,
+	109, 109, 117, 110, 101, 99, 111, 109, 112, 97, 110, 121, 99, 111, 109, 112, 97, 114, 101, 99,
+	111, 110, 116, 97, 99, 116, 99, 111, 110, 118, 101, 110, 116, 99, 111, 114, 115, 105, 99, 97,
+	99, 111, 115, 101, 110, 122, 97, 99, 111, 115, 105, 100, 110, 115, 99, 111, 115, 116, 117, 109,
+	101, 99, 111, 117, 110, 99, 105, 108, 99, 111, 117, 112, 111, 110, 115, 99, 111, 117, 114, 115,
+	101, 115, 99, 114, 101, 109, 111, 110, 97, 99, 114, 105, 99, 107, 101, 116, 99, 114, 111, 116,
+	111, 110, 101, 99, 114, 117, 105, 115, 101, 115, 99, 117, 112, 99, 97, 107, 101, 99, 122, 101,
+	108, 97, 100, 122, 100, 97, 101, 106, 101, 111, 110, 100, 97, 122, 97, 105, 102, 117, 100, 101,
+	100, 105, 98, 111, 120, 100, 101, 110, 109, 97, 114, 107, 100, 101, 112, 111, 114, 116, 101, 100,
+	101, 116, 114, 111, 105, 116, 100, 110, 115, 100, 111, 106, 111, 100, 110, 115, 104, 111, 109, 101,
+	100, 111, 101, 115, 45, 105, 116, 100, 111, 109, 97, 105, 110, 115, 100, 111, 110, 101, 116, 115,
+	107, 100, 111, 111, 109, 100, 110, 115, 100, 114, 97, 109, 109, 101, 110, 100, 114, 97, 121, 100,
+	110, 115, 100, 115, 109, 121, 110, 97, 115, 100, 117, 99, 107, 100, 110, 115, 100, 121, 110, 45,
+	118, 112, 110, 100, 121, 110, 100, 110, 115, 49, 100, 121, 110, 115, 101, 114, 118, 101, 97, 115,
+	116, 117, 115, 50, 101, 100, 103, 101, 97, 112, 112, 101, 100, 105, 116, 111, 114, 120, 101, 100,
+	111, 103, 97, 119, 97, 101, 105, 100, 115, 107, 111, 103, 101, 105, 104, 101, 105, 106, 105, 101,
+	107, 108, 111, 103, 101, 115, 101, 108, 118, 101, 114, 117, 109, 101, 109, 98, 101, 116, 115, 117,
+	101, 109, 112, 114, 101, 115, 97, 101, 110, 45, 114, 111, 111, 116, 101, 110, 99, 111, 119, 97,
+	121, 101, 110, 101, 98, 97, 107, 107, 101, 110, 103, 108, 97, 110, 100, 101, 114, 111, 116, 105,
+	99, 97, 101, 114, 111, 116, 105, 107, 97, 101, 116, 97, 106, 105, 109, 97, 101, 116, 110, 101,
+	100, 97, 108, 101, 117, 114, 111, 100, 105, 114, 101, 120, 112, 111, 115, 101, 100, 101, 122, 112,
+	114, 111, 120, 121, 102, 97, 107, 101, 102, 117, 114, 102, 97, 114, 109, 101, 114, 115, 102, 97,
+	114, 115, 117, 110, 100, 102, 101, 114, 114, 97, 114, 97, 102, 101, 114, 114, 97, 114, 105, 102,
+	101, 114, 114, 101, 114, 111, 102, 101, 116, 115, 117, 110, 100, 102, 105, 110, 97, 110, 99, 101,
+	102, 105, 110, 108, 97, 110, 100, 102, 105, 114, 101, 110, 101, 116, 102, 105, 114, 101, 110, 122,
+	101, 102, 105, 114, 101, 119, 101, 98, 102, 105, 115, 104, 105, 110, 103, 102, 105, 116, 110, 101,
+	115, 115, 102, 108, 105, 103, 104, 116, 115, 102, 108, 111, 114, 105, 100, 97, 102, 108, 111, 114,
+	105, 112, 97, 102, 108, 111, 114, 105, 115, 116, 102, 108, 111, 119, 101, 114, 115, 102, 111, 108,
+	108, 100, 97, 108, 102, 111, 114, 45, 111, 117, 114, 102, 111, 114, 45, 116, 104, 101, 102, 111,
+	114, 115, 97, 108, 101, 102, 111, 114, 115, 97, 110, 100, 102, 114, 97, 49, 45, 100, 101, 102,
+	114, 101, 101, 116, 108, 115, 102, 114, 111, 103, 97, 110, 115, 102, 114, 111, 108, 97, 110, 100,
+	102, 114, 111, 109, 45, 97, 107, 102, 114, 111, 109, 45, 97, 108, 102, 114, 111, 109, 45, 97,
+	114, 102, 114, 111, 109, 45, 97, 122, 102, 114, 111, 109, 45, 99, 97, 102, 114, 111, 109, 45,
+	99, 111, 102, 114, 111, 109, 45, 99, 116, 102, 114, 111, 109, 45, 100, 99, 102, 114, 111, 109,
+	45, 100, 101, 102, 114, 111, 109, 45, 102, 108, 102, 114, 111, 109, 45, 103, 97, 102, 114, 111,
+	109, 45, 104, 105, 102, 114, 111, 109, 45, 105, 97, 102, 114, 111, 109, 45, 105, 100, 102, 114,
+	111, 109, 45, 105, 108, 102, 114, 111, 109, 45, 105, 110, 102, 114, 111, 109, 45, 107, 115, 102,
+	114, 111, 109, 45, 107, 121, 102, 114, 111, 109, 45, 108, 97, 102, 114, 111, 109, 45, 109, 97,
+	102, 114, 111, 109, 45, 109, 100, 102, 114, 111, 109, 45, 109, 101, 102, 114, 111, 109, 45, 109,
+	105, 102, 114, 111, 109, 45, 109, 110, 102, 114, 111, 109, 45, 109, 111, 102, 114, 111, 109, 45,
+	109, 115, 102, 114, 111, 109, 45, 109, 116, 102, 114, 111, 109, 45, 110, 99, 102, 114, 111, 109,
+	45, 110, 100, 102, 114, 111, 109, 45, 110, 101, 102, 114, 111, 109, 45, 110, 104, 102, 114, 111,
+	109, 45, 110, 106, 102, 114, 111, 109, 45, 110, 109, 102, 114, 111, 109, 45, 110, 118, 102, 114,
+	111, 109, 45, 110, 121, 102, 114, 111, 109, 45, 111, 104, 102, 114, 111, 109, 45, 111, 107, 102,
+	114, 111, 109, 45, 111, 114, 102, 114, 111, 109, 45, 112, 97, 102, 114, 111, 109, 45, 112, 114,
+	102, 114, 111, 109, 45, 114, 105, 102, 114, 111, 109, 45, 115, 99, 102, 114, 111, 109, 45, 115,
+	100, 102, 114, 111, 109, 45, 116, 110, 102, 114, 111, 109, 45, 116, 120, 102, 114, 111, 109, 45,
+	117, 116, 102, 114, 111, 109, 45, 118, 97, 102, 114, 111, 109, 45, 118, 116, 102, 114, 111, 109,
+	45, 119, 97, 102, 114, 111, 109, 45, 119, 105, 102, 114, 111, 109, 45, 119, 118, 102, 114, 111,
+	109, 45, 119, 121, 102, 117, 101, 102, 117, 107, 105, 102, 117, 106, 105, 101, 100, 97, 102, 117,
+	106, 105, 111, 107, 97, 102, 117, 106, 105, 116, 115, 117, 102, 117, 107, 117, 111, 107, 97, 102,
+	117, 107, 117, 114, 111, 105, 102, 117, 111, 105, 115, 107, 117, 102, 117, 111, 115, 115, 107, 111,
+	103, 97, 110, 103, 119, 111, 110, 103, 97, 117, 115, 100, 97, 108, 103, 101, 110, 116, 105, 110,
+	103, 103, 101, 111, 108, 111, 103, 121, 103, 101, 111, 114, 103, 105, 97, 103, 101, 116, 109, 121,
+	105, 112, 103, 101, 116, 115, 45, 105, 116, 103, 105, 101, 115, 115, 101, 110, 103, 105, 110, 111,
+	119, 97, 110, 103, 105, 116, 112, 97, 103, 101, 103, 106, 101, 109, 110, 101, 115, 103, 106, 101,
+	115, 100, 97, 108, 103, 108, 105, 119, 105, 99, 101, 103, 108, 111, 112, 112, 101, 110, 103, 110,
+	105, 101, 122, 110, 111, 103, 111, 100, 97, 100, 100, 121, 103, 111, 105, 97, 110, 105, 97, 103,
+	111, 108, 102, 102, 97, 110, 103, 111, 114, 105, 122, 105, 97, 103, 111, 114, 108, 105, 99, 101,
+	103, 111, 115, 104, 105, 107, 105, 103, 111, 116, 101, 109, 98, 97, 103, 111, 117, 112, 105, 108,
+	101, 103, 114, 97, 106, 101, 119, 111, 103, 114, 97, 110, 118, 105, 110, 103, 114, 97, 112, 104,
+	111, 120, 103, 114, 101, 97, 116, 101, 114, 103, 114, 111, 99, 101, 114, 121, 103, 114, 111, 110,
+	100, 97, 114, 103, 117, 105, 116, 97, 114, 115, 103, 117, 106, 97, 114, 97, 116, 103, 119, 97,
+	110, 103, 106, 117, 103, 121, 111, 107, 117, 116, 111, 104, 97, 99, 104, 105, 106, 111, 104, 97,
+	101, 98, 97, 114, 117, 104, 97, 105, 98, 97, 114, 97, 104, 97, 107, 117, 115, 97, 110, 104,
+	97, 109, 97, 114, 111, 121, 104, 97, 109, 98, 117, 114, 103, 104, 97, 110, 100, 115, 111, 110,
+	104, 97, 110, 103, 111, 117, 116, 104, 97, 114, 115, 116, 97, 100, 104, 97, 115, 104, 105, 109,
+	97, 104, 101, 100, 109, 97, 114, 107, 104, 101, 107, 105, 110, 97, 110, 104, 105, 99, 104, 105,
+	115, 111, 104, 105, 114, 97, 110, 97, 105, 104, 111, 107, 117, 114, 121, 117, 104, 111, 108, 105,
+	100, 97, 121, 104, 111, 109, 101, 100, 110, 115, 104, 111, 109, 101, 102, 116, 112, 104, 111, 115,
+	116, 101, 117, 114, 104, 111, 116, 101, 108, 101, 115, 104, 111, 116, 109, 97, 105, 108, 104, 116,
+	116, 112, 98, 105, 110, 104, 121, 117, 110, 100, 97, 105, 105, 98, 97, 114, 97, 107, 105, 105,
+	98, 101, 115, 116, 97, 100, 105, 98, 105, 103, 97, 119, 97, 105, 99, 104, 105, 107, 97, 105,
+	105, 107, 97, 114, 117, 103, 97, 105, 107, 117, 115, 97, 107, 97, 105, 109, 97, 98, 97, 114,
+	105, 105, 109, 97, 107, 97, 110, 101, 105, 109, 112, 101, 114, 105, 97, 105, 110, 45, 97, 100,
+	100, 114, 105, 110, 97, 122, 97, 119, 97, 105, 110, 99, 104, 101, 111, 110, 105, 110, 100, 101,
+	114, 111, 121, 105, 110, 117, 121, 97, 109, 97, 105, 112, 105, 102, 111, 110, 121, 105, 115, 45,
+	103, 111, 110, 101, 105, 115, 45, 108, 101, 101, 116, 105, 115, 45, 108, 111, 115, 116, 105, 115,
+	97, 104, 97, 121, 97, 105, 115, 101, 104, 97, 114, 97, 105, 115, 101, 114, 110, 105, 97, 105,
+	115, 101, 115, 97, 107, 105, 105, 115, 109, 97, 105, 108, 105, 105, 115, 115, 104, 105, 107, 105,
+	105, 115, 116, 109, 101, 105, 110, 105, 116, 97, 107, 117, 114, 97, 105, 118, 97, 110, 111, 118,
+	111, 105, 118, 101, 108, 97, 110, 100, 105, 119, 97, 102, 117, 110, 101, 105, 119, 97, 107, 117,
+	110, 105, 105, 119, 97, 107, 117, 114, 97, 105, 119, 97, 110, 117, 109, 97, 106, 97, 109, 105,
+	115, 111, 110, 106, 101, 111, 110, 98, 117, 107, 106, 101, 111, 110, 110, 97, 109, 106, 101, 119,
+	101, 108, 114, 121, 106, 111, 108, 115, 116, 101, 114, 106, 117, 100, 97, 105, 99, 97, 106, 117,
+	110, 105, 112, 101, 114, 107, 97, 102, 106, 111, 114, 100, 107, 97, 105, 122, 117, 107, 97, 107,
+	97, 109, 101, 111, 107, 97, 107, 97, 109, 105, 111, 107, 97, 107, 97, 110, 109, 97, 107, 105,
+	107, 97, 110, 110, 97, 109, 105, 107, 97, 110, 111, 110, 106, 105, 107, 97, 110, 122, 97, 107,
+	105, 107, 97, 114, 97, 99, 111, 108, 107, 97, 114, 97, 116, 115, 117, 107, 97, 114, 101, 108,
+	105, 97, 107, 97, 114, 108, 115, 111, 121, 107, 97, 114, 112, 97, 99, 122, 107, 97, 114, 116,
+	117, 122, 121, 107, 97, 114, 117, 109, 97, 105, 107, 97, 115, 97, 111, 107, 97, 107, 97, 115,
+	104, 105, 98, 97, 107, 97, 115, 117, 103, 97, 105, 107, 97, 115, 122, 117, 98, 121, 107, 97,
+	119, 97, 103, 111, 101, 107, 101, 108, 105, 119, 101, 98, 107, 101, 116, 114, 122, 121, 110, 107,
+	104, 97, 114, 107, 105, 118, 107, 104, 97, 114, 107, 111, 118, 107, 104, 101, 114, 115, 111, 110,
+	107, 105, 107, 111, 110, 97, 105, 107, 105, 107, 117, 99, 104, 105, 107, 105, 109, 105, 116, 115,
+	117, 107, 105, 116, 97, 117, 114, 97, 107, 105, 116, 99, 104, 101, 110, 107, 108, 111, 100, 122,
+	107, 111, 107, 111, 100, 97, 105, 114, 97, 107, 111, 103, 97, 110, 101, 105, 107, 111, 107, 111,
+	110, 111, 101, 107, 111, 109, 102, 111, 114, 98, 107, 111, 109, 109, 117, 110, 101, 107, 111, 116,
+	111, 117, 114, 97, 107, 111, 117, 104, 111, 107, 117, 107, 111, 117, 110, 111, 115, 117, 107, 111,
+	117, 121, 97, 109, 97, 107, 114, 97, 103, 101, 114, 111, 107, 114, 97, 115, 110, 105, 107, 107,
+	117, 109, 101, 110, 97, 110, 107, 117, 114, 111, 105, 115, 111, 107, 117, 115, 97, 116, 115, 117,
+	107, 117, 115, 104, 105, 114, 111, 107, 117, 116, 99, 104, 97, 110, 107, 118, 105, 116, 115, 111,
+	121, 107, 121, 117, 114, 97, 103, 105, 108, 97, 99, 97, 105, 120, 97, 108, 97, 106, 111, 108,
+	108, 97, 108, 97, 110, 100, 105, 110, 103, 108, 97, 110, 120, 101, 115, 115, 108, 97, 113, 117,
+	105, 108, 97, 108, 97, 114, 115, 115, 111, 110, 108, 97, 115, 97, 108, 108, 101, 108, 97, 116,
+	114, 111, 98, 101, 108, 97, 118, 97, 103, 105, 115, 108, 101, 97, 115, 105, 110, 103, 108, 101,
+	98, 101, 115, 98, 121, 108, 101, 99, 108, 101, 114, 99, 108, 101, 103, 110, 105, 99, 97, 108,
+	101, 105, 114, 118, 105, 107, 108, 101, 107, 115, 118, 105, 107, 108, 101, 122, 97, 106, 115, 107,
+	108, 105, 103, 117, 114, 105, 97, 108, 105, 109, 105, 116, 101, 100, 108, 105, 110, 99, 111, 108,
+	110, 108, 105, 118, 111, 114, 110, 111, 108, 111, 103, 105, 110, 116, 111, 108, 111, 105, 115, 105,
+	114, 115, 108, 111, 118, 101, 112, 111, 112, 108, 117, 99, 97, 110, 105, 97, 108, 117, 99, 101,
+	114, 110, 101, 108, 117, 103, 97, 110, 115, 107, 108, 121, 110, 103, 100, 97, 108, 109, 97, 99,
+	104, 105, 100, 97, 109, 97, 105, 98, 97, 114, 97, 109, 97, 105, 122, 117, 114, 117, 109, 97,
+	108, 98, 111, 114, 107, 109, 97, 108, 115, 101, 108, 118, 109, 97, 110, 116, 111, 118, 97, 109,
+	97, 114, 98, 117, 114, 103, 109, 97, 114, 105, 110, 103, 97, 109, 97, 114, 107, 101, 116, 115,
+	109, 97, 115, 104, 105, 107, 101, 109, 97, 115, 104, 105, 107, 105, 109, 97, 115, 104, 105, 107,
+	111, 109, 97, 116, 115, 117, 100, 97, 109, 97, 116, 115, 117, 100, 111, 109, 97, 116, 115, 117,
+	110, 111, 109, 101, 100, 101, 99, 105, 110, 109, 101, 100, 105, 99, 97, 108, 109, 101, 109, 98,
+	101, 114, 115, 109, 101, 114, 97, 107, 101, 114, 109, 101, 115, 115, 105, 110, 97, 109, 105, 100,
+	115, 117, 110, 100, 109, 105, 110, 116, 101, 114, 101, 109, 105, 115, 104, 105, 109, 97, 109, 105,
+	115, 115, 105, 108, 101, 109, 105, 116, 115, 117, 107, 101, 109, 111, 97, 114, 101, 107, 101, 109,
+	111, 100, 97, 108, 101, 110, 109, 111, 110, 115, 116, 101, 114, 109, 111, 114, 105, 111, 107, 97,
+	109, 111, 115, 106, 111, 101, 110, 109, 114, 97, 103, 111, 119, 111, 109, 117, 114, 111, 114, 97,
+	110, 109, 121, 97, 109, 97, 122, 101, 109, 121, 99, 108, 111, 117, 100, 109, 121, 100, 97, 116,
+	116, 111, 109, 121, 100, 114, 111, 98, 111, 109, 121, 102, 111, 114, 117, 109, 109, 121, 102, 114,
+	105, 116, 122, 109, 121, 116, 97, 98, 105, 116, 110, 97, 107, 97, 103, 121, 111, 110, 97, 107,
+	105, 106, 105, 110, 110, 97, 108, 99, 104, 105, 107, 110, 97, 109, 97, 115, 116, 101, 110, 97,
+	110, 107, 111, 107, 117, 110, 97, 110, 109, 111, 107, 117, 110, 97, 110, 112, 111, 114, 111, 110,
+	101, 114, 100, 112, 111, 108, 110, 101, 115, 115, 101, 98, 121, 110, 101, 116, 98, 97, 110, 107,
+	110, 101, 116, 102, 108, 105, 120, 110, 101, 116, 108, 105, 102, 121, 110, 101, 117, 115, 116, 97,
+	114, 110, 101, 119, 112, 111, 114, 116, 110, 101, 119, 121, 111, 114, 107, 110, 102, 115, 104, 111,
+	115, 116, 110, 104, 45, 115, 101, 114, 118, 110, 105, 105, 103, 97, 116, 97, 110, 105, 105, 104,
+	97, 109, 97, 110, 105, 115, 104, 105, 103, 111, 110, 105, 115, 115, 104, 105, 110, 110, 105, 116,
+	101, 114, 111, 105, 110, 111, 98, 101, 111, 107, 97, 110, 111, 98, 117, 115, 104, 105, 110, 111,
+	100, 101, 97, 114, 116, 110, 111, 114, 100, 100, 97, 108, 110, 111, 114, 102, 111, 108, 107, 110,
+	111, 115, 104, 105, 114, 111, 110, 111, 119, 45, 100, 110, 115, 111, 98, 105, 104, 105, 114, 111,
+	111, 98, 110, 105, 110, 115, 107, 111, 100, 97, 119, 97, 114, 97, 111, 102, 117, 110, 97, 116,
+	111, 111, 103, 97, 119, 97, 114, 97, 111, 105, 115, 104, 105, 100, 97, 111, 107, 97, 103, 97,
+	107, 105, 111, 107, 97, 121, 97, 109, 97, 111, 107, 97, 122, 97, 107, 105, 111, 107, 101, 103,
+	97, 119, 97, 111, 107, 105, 110, 97, 119, 97, 111, 107, 117, 116, 97, 109, 97, 111, 108, 100,
+	110, 97, 118, 121, 111, 108, 115, 122, 116, 121, 110, 111, 109, 105, 103, 97, 119, 97, 111, 109,
+	105, 116, 97, 109, 97, 111, 109, 111, 116, 101, 103, 111, 111, 110, 97, 103, 97, 119, 97, 111,
+	110, 99, 105, 108, 108, 97, 111, 110, 116, 97, 114, 105, 111, 111, 111, 115, 104, 105, 107, 97,
+	111, 112, 101, 110, 97, 105, 114, 111, 112, 111, 99, 122, 110, 111, 111, 114, 105, 103, 105, 110,
+	115, 111, 114, 115, 105, 116, 101, 115, 111, 115, 116, 101, 114, 111, 121, 111, 115, 116, 102, 111,
+	108, 100, 111, 115, 116, 114, 111, 100, 97, 111, 116, 111, 102, 117, 107, 101, 111, 116, 115, 117,
+	99, 104, 105, 112, 97, 99, 105, 102, 105, 99, 112, 97, 108, 101, 114, 109, 111, 112, 101, 114,
+	117, 103, 105, 97, 112, 101, 115, 99, 97, 114, 97, 112, 104, 105, 108, 105, 112, 115, 112, 104,
+	111, 101, 110, 105, 120, 112, 105, 103, 98, 111, 97, 116, 112, 105, 111, 110, 101, 101, 114, 112,
+	105, 115, 116, 111, 105, 97, 112, 108, 101, 115, 107, 110, 115, 112, 111, 100, 104, 97, 108, 101,
+	112, 111, 100, 122, 111, 110, 101, 112, 111, 105, 110, 116, 116, 111, 112, 111, 105, 118, 114, 111,
+	110, 112, 111, 108, 105, 116, 105, 101, 112, 111, 108, 116, 97, 118, 97, 112, 111, 109, 111, 114,
+	122, 101, 112, 111, 116, 97, 103, 101, 114, 112, 111, 116, 101, 110, 122, 97, 114, 97, 105, 108,
+	119, 97, 121, 114, 97, 118, 101, 110, 100, 98, 114, 97, 118, 101, 110, 110, 97, 114, 97, 118,
+	112, 97, 103, 101, 114, 101, 97, 108, 116, 111, 114, 114, 101, 99, 105, 112, 101, 115, 114, 101,
+	99, 108, 97, 105, 109, 114, 101, 110, 110, 101, 98, 117, 114, 101, 110, 116, 97, 108, 115, 114,
+	101, 112, 98, 111, 100, 121, 114, 101, 115, 101, 114, 118, 100, 114, 101, 118, 105, 101, 119, 115,
+	114, 101, 118, 105, 115, 116, 97, 114, 101, 120, 114, 111, 116, 104, 114, 104, 99, 108, 111, 117,
+	100, 114, 105, 110, 103, 101, 98, 117, 114, 111, 99, 107, 97, 114, 116, 114, 111, 109, 115, 107,
+	111, 103, 114, 111, 121, 114, 118, 105, 107, 114, 121, 111, 107, 97, 109, 105, 114, 122, 101, 115,
+	122, 111, 119, 115, 97, 105, 103, 97, 119, 97, 115, 97, 105, 116, 97, 109, 97, 115, 97, 107,
+	117, 114, 97, 105, 115, 97, 108, 101, 114, 110, 111, 115, 97, 108, 116, 100, 97, 108, 115, 97,
+	109, 115, 117, 110, 103, 115, 97, 110, 110, 111, 104, 101, 115, 97, 110, 116, 97, 102, 101, 115,
+	97, 111, 116, 111, 109, 101, 115, 97, 112, 112, 111, 114, 111, 115, 97, 115, 115, 97, 114, 105,
+	115, 97, 116, 111, 115, 104, 111, 115, 99, 104, 109, 105, 100, 116, 115, 99, 104, 111, 111, 108,
+	115, 115, 99, 104, 119, 97, 114, 122, 115, 99, 104, 119, 101, 105, 122, 115, 99, 114, 121, 115,
+	101, 99, 115, 101, 97, 112, 111, 114, 116, 115, 101, 108, 106, 111, 114, 100, 115, 101, 109, 98,
+	111, 107, 117, 115, 104, 105, 98, 97, 116, 97, 115, 104, 105, 98, 117, 121, 97, 115, 104, 105,
+	107, 97, 98, 101, 115, 104, 105, 107, 97, 111, 105, 115, 104, 105, 107, 115, 104, 97, 115, 104,
+	105, 109, 97, 100, 97, 115, 104, 105, 109, 97, 110, 101, 115, 104, 105, 109, 111, 103, 111, 115,
+	104, 105, 109, 111, 106, 105, 115, 104, 105, 114, 97, 107, 111, 115, 104, 105, 114, 97, 111, 105,
+	115, 104, 105, 116, 97, 114, 97, 115, 104, 111, 98, 97, 114, 97, 115, 105, 98, 101, 110, 105,
+	107, 115, 105, 99, 105, 108, 105, 97, 115, 105, 101, 108, 108, 97, 107, 115, 105, 105, 105, 116,
+	101, 115, 115, 105, 110, 103, 108, 101, 115, 115, 107, 105, 101, 114, 118, 97, 115, 107, 111, 99,
+	122, 111, 119, 115, 108, 97, 116, 116, 117, 109, 115, 111, 98, 101, 116, 115, 117, 115, 111, 103,
+	110, 100, 97, 108, 115, 111, 107, 110, 100, 97, 108, 115, 111, 108, 111, 103, 110, 101, 115, 111,
+	110, 100, 114, 105, 111, 115, 111, 114, 102, 111, 108, 100, 115, 113, 117, 97, 114, 101, 55, 115,
+	116, 97, 112, 108, 101, 115, 115, 116, 97, 116, 105, 99, 115, 115, 116, 97, 118, 101, 114, 110,
+	115, 116, 101, 105, 103, 101, 110, 115, 116, 111, 114, 97, 103, 101, 115, 116, 111, 114, 100, 97,
+	108, 115, 116, 114, 97, 110, 100, 97, 115, 117, 110, 110, 100, 97, 108, 115, 117, 112, 112, 111,
+	114, 116, 115, 117, 114, 103, 101, 114, 121, 115, 117, 119, 97, 108, 107, 105, 115, 118, 101, 108,
+	118, 105, 107, 115, 119, 105, 100, 110, 105, 107, 115, 121, 110, 111, 45, 100, 115, 116, 97, 100,
+	97, 111, 107, 97, 116, 97, 100, 111, 116, 115, 117, 116, 97, 105, 115, 104, 105, 110, 116, 97,
+	107, 97, 111, 107, 97, 116, 97, 114, 97, 110, 116, 111, 116, 97, 116, 115, 117, 110, 111, 116,
+	101, 99, 107, 105, 100, 115, 116, 101, 108, 101, 98, 105, 116, 116, 101, 109, 97, 115, 101, 107,
+	116, 101, 109, 112, 117, 114, 108, 116, 101, 110, 107, 97, 119, 97, 116, 101, 115, 116, 105, 110,
+	103, 116, 101, 120, 116, 105, 108, 101, 116, 104, 101, 97, 116, 101, 114, 116, 104, 101, 97, 116,
+	114, 101, 116, 104, 101, 115, 104, 111, 112, 116, 105, 99, 107, 101, 116, 115, 116, 105, 102, 102,
+	97, 110, 121, 116, 111, 98, 101, 116, 115, 117, 116, 111, 99, 104, 105, 103, 105, 116, 111, 103,
+	105, 116, 115, 117, 116, 111, 109, 105, 111, 107, 97, 116, 111, 110, 111, 115, 104, 111, 116, 111,
+	114, 115, 107, 101, 110, 116, 111, 115, 99, 97, 110, 97, 116, 111, 115, 104, 105, 98, 97, 116,
+	111, 115, 104, 105, 109, 97, 116, 111, 116, 116, 111, 114, 105, 116, 111, 117, 114, 105, 115, 109,
+	116, 111, 121, 111, 97, 107, 101, 116, 111, 121, 111, 111, 107, 97, 116, 111, 121, 111, 116, 115,
+	117, 116, 111, 121, 111, 117, 114, 97, 116, 114, 97, 100, 105, 110, 103, 116, 114, 97, 110, 115,
+	105, 112, 116, 114, 97, 112, 97, 110, 105, 116, 114, 101, 118, 105, 115, 111, 116, 114, 105, 101,
+	115, 116, 101, 116, 114, 111, 105, 116, 115, 107, 116, 114, 111, 108, 108, 101, 121, 116, 114, 117,
+	115, 116, 101, 101, 116, 115, 117, 98, 97, 109, 101, 116, 115, 117, 98, 97, 116, 97, 116, 115,
+	117, 103, 97, 114, 117, 116, 115, 117, 107, 117, 98, 97, 116, 115, 117, 107, 117, 109, 105, 116,
+	115, 117, 114, 117, 103, 105, 116, 115, 117, 114, 117, 116, 97, 116, 115, 117, 119, 97, 110, 111,
+	116, 117, 115, 99, 97, 110, 121, 117, 110, 97, 122, 117, 107, 105, 117, 110, 106, 97, 114, 103,
+	97, 117, 114, 97, 107, 97, 119, 97, 117, 114, 97, 121, 97, 115, 117, 117, 115, 104, 117, 97,
+	105, 97, 117, 116, 119, 101, 110, 116, 101, 117, 119, 97, 106, 105, 109, 97, 118, 97, 97, 112,
+	115, 116, 101, 118, 97, 107, 115, 100, 97, 108, 118, 97, 114, 103, 103, 97, 116, 118, 101, 115,
+	116, 110, 101, 115, 118, 105, 99, 101, 110, 122, 97, 118, 105, 108, 108, 97, 103, 101, 118, 105,
+	110, 110, 105, 99, 97, 118, 105, 114, 116, 117, 101, 108, 118, 105, 116, 101, 114, 98, 111, 118,
+	111, 108, 111, 103, 100, 97, 118, 112, 110, 112, 108, 117, 115, 119, 97, 108, 109, 97, 114, 116,
+	119, 97, 110, 103, 103, 111, 117, 119, 97, 115, 115, 97, 109, 117, 119, 97, 116, 97, 114, 97,
+	105, 119, 97, 116, 99, 104, 101, 115, 119, 101, 98, 104, 97, 114, 101, 119, 101, 98, 108, 105,
+	107, 101, 119, 101, 98, 112, 97, 97, 115, 119, 101, 100, 100, 105, 110, 103, 119, 101, 115, 116,
+	117, 115, 50, 119, 104, 97, 108, 105, 110, 103, 119, 104, 111, 115, 119, 104, 111, 119, 105, 110,
+	100, 111, 119, 115, 119, 105, 110, 110, 101, 114, 115, 119, 105, 120, 115, 105, 116, 101, 119, 109,
+	99, 108, 111, 117, 100, 119, 109, 102, 108, 97, 98, 115, 119, 111, 108, 111, 109, 105, 110, 119,
+	111, 114, 107, 101, 114, 115, 119, 112, 109, 117, 99, 100, 110, 119, 112, 109, 117, 100, 101, 118,
+	119, 114, 111, 99, 108, 97, 119, 120, 102, 105, 110, 105, 116, 121, 120, 110, 45, 45, 52, 49,
+	97, 121, 97, 99, 104, 105, 121, 111, 121, 97, 109, 97, 120, 117, 110, 121, 97, 109, 97, 122,
+	111, 101, 121, 97, 110, 97, 105, 122, 117, 121, 97, 115, 117, 111, 107, 97, 121, 97, 116, 115,
+	117, 107, 97, 121, 111, 109, 105, 116, 97, 110, 121, 111, 115, 104, 105, 109, 105, 122, 111, 111,
+	108, 111, 103, 121, 122, 117, 101, 114, 105, 99, 104, 48, 48, 49, 119, 119, 119, 57, 103, 117,
+	97, 99, 117, 97, 98, 97, 114, 116, 104, 97, 98, 98, 111, 116, 116, 97, 98, 98, 118, 105,
+	101, 97, 100, 97, 99, 104, 105, 97, 101, 106, 114, 105, 101, 97, 103, 101, 110, 99, 121, 97,
+	103, 101, 110, 116, 115, 97, 105, 107, 97, 119, 97, 97, 105, 114, 98, 117, 115, 97, 105, 114,
+	116, 101, 108, 97, 107, 97, 100, 110, 115, 97, 107, 97, 105, 119, 97, 97, 108, 97, 115, 107,
+	97, 97, 108, 105, 112, 97, 121, 97, 108, 115, 97, 99, 101, 97, 108, 115, 116, 111, 109, 97,
+	108, 118, 100, 97, 108, 97, 110, 99, 111, 110, 97, 97, 110, 100, 101, 98, 117, 97, 110, 110,
+	97, 107, 97, 97, 110, 113, 117, 97, 110, 97, 111, 103, 97, 107, 105, 97, 111, 109, 111, 114,
+	105, 97, 112, 105, 103, 101, 101, 97, 112, 112, 117, 100, 111, 97, 114, 97, 109, 99, 111, 97,
+	114, 101, 122, 122, 111, 97, 114, 105, 97, 107, 101, 97, 115, 101, 114, 97, 108, 97, 115, 104,
+	111, 114, 111, 97, 115, 115, 97, 98, 117, 97, 115, 115, 105, 115, 105, 97, 116, 115, 117, 103,
+	105, 97, 117, 115, 116, 105, 110, 97, 117, 116, 104, 111, 114, 97, 118, 101, 114, 111, 121, 97,
+	118, 111, 117, 101, 115, 98, 45, 100, 97, 116, 97, 98, 97, 105, 100, 97, 114, 98, 97, 109,
+	98, 108, 101, 98, 97, 110, 100, 97, 105, 98, 97, 117, 101, 114, 110, 98, 97, 121, 101, 114,
+	110, 98, 101, 97, 114, 100, 117, 98, 101, 97, 117, 116, 121, 98, 101, 100, 122, 105, 110, 98,
+	101, 105, 97, 114, 110, 98, 101, 114, 103, 101, 110, 98, 104, 97, 114, 116, 105, 98, 105, 101,
+	108, 108, 97, 98, 105, 101, 118, 97, 116, 98, 105, 102, 117, 107, 97, 98, 105, 104, 111, 114,
+	111, 98, 105, 108, 98, 97, 111, 98, 105, 110, 100, 97, 108, 98, 105, 116, 116, 101, 114, 98,
+	111, 111, 109, 108, 97, 98, 111, 115, 116, 105, 107, 98, 111, 115, 116, 111, 110, 98, 111, 116,
+	97, 110, 121, 98, 111, 117, 116, 105, 114, 98, 114, 111, 107, 101, 114, 98, 114, 117, 110, 101,
+	108, 98, 117, 110, 107, 121, 111, 98, 117, 115, 104, 101, 121, 99, 97, 109, 100, 118, 114, 99,
+	97, 110, 97, 100, 97, 99, 97, 115, 105, 110, 111, 99, 97, 115, 116, 108, 101, 99, 97, 120,
+	105, 97, 115, 99, 104, 97, 110, 101, 108, 99, 104, 105, 101, 116, 105, 99, 104, 105, 114, 121,
+	117, 99, 104, 111, 110, 97, 110, 99, 104, 111, 115, 101, 105, 99, 104, 111, 115, 104, 105, 99,
+	104, 114, 111, 109, 101, 99, 104, 117, 114, 99, 104, 99, 105, 110, 101, 109, 97, 99, 105, 114,
+	99, 108, 101, 99, 105, 114, 99, 117, 115, 99, 108, 97, 105, 109, 115, 99, 108, 105, 110, 105,
+	99, 99, 108, 111, 117, 100, 57, 99, 111, 102, 102, 101, 101, 99, 111, 109, 115, 101, 99, 99,
+	111, 110, 100, 111, 115, 99, 111, 117, 110, 116, 121, 99, 114, 97, 110, 107, 121, 99, 114, 105,
+	109, 101, 97, 99, 117, 105, 97, 98, 97, 100, 97, 101, 109, 111, 110, 100, 97, 105, 115, 101,
+	110, 100, 97, 108, 108, 97, 115, 100, 97, 112, 108, 105, 101, 100, 97, 116, 105, 110, 103, 100,
+	97, 116, 115, 117, 110, 100, 100, 45, 100, 110, 115, 100, 101, 97, 108, 101, 114, 100, 101, 97,
+	116, 110, 117, 100, 101, 98, 105, 97, 110, 100, 101, 103, 114, 101, 101, 100, 101, 110, 116, 97,
+	108, 100, 105, 97, 100, 101, 109, 100, 105, 103, 105, 99, 107, 100, 105, 115, 114, 101, 99, 100,
+	110, 115, 102, 111, 114, 100, 111, 103, 97, 100, 111, 100, 111, 112, 97, 97, 115, 100, 114, 111,
+	98, 97, 107, 100, 117, 110, 108, 111, 112, 100, 117, 112, 111, 110, 116, 100, 117, 114, 98, 97,
+	110, 100, 117, 114, 104, 97, 109, 100, 118, 114, 99, 97, 109, 100, 118, 114, 100, 110, 115, 100,
+	121, 110, 118, 112, 110, 101, 98, 101, 116, 115, 117, 101, 100, 117, 103, 105, 116, 101, 103, 111,
+	105, 115, 109, 101, 108, 97, 115, 116, 120, 101, 108, 98, 108, 97, 103, 101, 108, 98, 117, 114,
+	103, 101, 109, 101, 114, 99, 107, 101, 110, 101, 114, 103, 121, 101, 115, 97, 115, 104, 105, 101,
+	118, 101, 110, 101, 115, 101, 118, 101, 110, 116, 115, 101, 120, 101, 116, 101, 114, 102, 97, 117,
+	115, 107, 101, 102, 98, 120, 45, 111, 115, 102, 105, 110, 110, 111, 121, 102, 105, 116, 106, 97,
+	114, 102, 106, 97, 108, 101, 114, 102, 108, 105, 99, 107, 114, 102, 108, 111, 112, 112, 121, 102,
+	111, 103, 103, 105, 97, 102, 111, 114, 103, 111, 116, 102, 111, 114, 116, 97, 108, 102, 111, 114,
+	117, 109, 122, 102, 111, 115, 110, 101, 115, 102, 114, 111, 115, 116, 97, 102, 114, 117, 115, 107,
+	121, 102, 117, 107, 97, 121, 97, 102, 117, 116, 97, 98, 97, 102, 117, 116, 98, 111, 108, 102,
+	117, 116, 116, 115, 117, 103, 97, 108, 108, 117, 112, 103, 97, 109, 118, 105, 107, 103, 97, 117,
+	108, 97, 114, 103, 100, 97, 110, 115, 107, 103, 100, 121, 110, 105, 97, 103, 101, 104, 105, 114,
+	110, 103, 101, 105, 115, 101, 105, 103, 101, 110, 107, 97, 105, 103, 101, 110, 111, 118, 97, 103,
+	101, 111, 114, 103, 101, 103, 105, 110, 111, 122, 97, 103, 105, 116, 97, 112, 112, 103, 105, 116,
+	108, 97, 98, 103, 105, 118, 105, 110, 103, 103, 106, 111, 118, 105, 107, 103, 108, 101, 101, 122,
+	101, 103, 108, 105, 116, 99, 104, 103, 108, 111, 103, 111, 119, 103, 108, 111, 111, 109, 121, 103,
+	111, 106, 111, 109, 101, 103, 111, 107, 97, 115, 101, 103, 111, 110, 111, 104, 101, 103, 111, 116,
+	100, 110, 115, 103, 114, 97, 116, 105, 115, 103, 114, 111, 122, 110, 121, 104, 97, 98, 109, 101,
+	114, 104, 97, 98, 111, 114, 111, 104, 97, 100, 97, 110, 111, 104, 97, 100, 115, 101, 108, 104,
+	97, 107, 97, 116, 97, 104, 97, 107, 111, 110, 101, 104, 97, 107, 117, 98, 97, 104, 97, 108,
+	100, 101, 110, 104, 97, 109, 97, 100, 97, 104, 97, 109, 117, 114, 97, 104, 97, 110, 97, 119,
+	97, 104, 97, 110, 110, 97, 110, 104, 97, 112, 109, 105, 114, 104, 97, 112, 112, 111, 117, 104,
+	97, 114, 101, 105, 100, 104, 97, 114, 105, 109, 97, 104, 97, 115, 97, 109, 97, 104, 97, 115,
+	97, 109, 105, 104, 97, 115, 117, 100, 97, 104, 97, 115, 118, 105, 107, 104, 97, 119, 97, 105,
+	105, 104, 101, 103, 117, 114, 105, 104, 101, 108, 108, 97, 115, 104, 101, 109, 110, 101, 115, 104,
+	101, 114, 109, 101, 115, 104, 101, 116, 101, 109, 108, 104, 105, 100, 97, 107, 97, 104, 105, 100,
+	111, 114, 97, 104, 105, 107, 111, 110, 101, 104, 105, 109, 101, 106, 105, 104, 105, 112, 104, 111,
+	112, 104, 105, 114, 97, 100, 111, 104, 105, 114, 97, 114, 97, 104, 105, 114, 97, 121, 97, 104,
+	111, 107, 117, 116, 111, 104, 111, 109, 101, 105, 112, 104, 111, 110, 106, 121, 111, 104, 111, 112,
+	108, 105, 120, 104, 111, 114, 116, 101, 110, 104, 117, 103, 104, 101, 115, 104, 117, 110, 103, 114,
+	121, 104, 117, 114, 100, 97, 108, 104, 118, 97, 108, 101, 114, 105, 99, 117, 114, 117, 115, 105,
+	100, 114, 101, 116, 116, 105, 105, 106, 105, 109, 97, 105, 105, 116, 97, 116, 101, 105, 105, 121,
+	97, 109, 97, 105, 105, 122, 117, 107, 97, 105, 105, 122, 117, 110, 97, 105, 109, 97, 109, 97,
+	116, 105, 110, 45, 98, 114, 98, 105, 110, 45, 100, 115, 108, 105, 110, 45, 118, 112, 110, 105,
+	110, 115, 117, 114, 101, 105, 110, 116, 117, 105, 116, 105, 111, 112, 115, 121, 115, 105, 116, 111,
+	109, 97, 110, 105, 119, 97, 110, 97, 105, 106, 97, 103, 117, 97, 114, 106, 97, 109, 98, 121,
+	108, 106, 111, 98, 111, 106, 105, 106, 111, 98, 117, 114, 103, 106, 111, 101, 116, 115, 117, 106,
+	111, 103, 97, 115, 122, 106, 111, 104, 97, 110, 97, 106, 111, 121, 101, 110, 116, 106, 117, 101,
+	103, 111, 115, 107, 97, 100, 101, 110, 97, 107, 97, 104, 111, 107, 117, 107, 97, 105, 110, 97,
+	110, 107, 97, 105, 115, 101, 105, 107, 97, 107, 117, 100, 97, 107, 97, 108, 105, 115, 122, 107,
+	97, 108, 117, 103, 97, 107, 97, 110, 111, 121, 97, 107, 97, 110, 117, 109, 97, 107, 97, 114,
+	97, 116, 101, 107, 97, 114, 105, 119, 97, 107, 97, 114, 105, 121, 97, 107, 97, 114, 109, 111,
+	121, 107, 97, 115, 117, 121, 97, 107, 97, 116, 97, 110, 111, 107, 97, 117, 102, 101, 110, 107,
+	97, 119, 97, 98, 97, 107, 97, 119, 97, 114, 97, 107, 97, 119, 97, 117, 101, 107, 97, 119,
+	97, 122, 117, 107, 97, 121, 97, 98, 101, 107, 97, 122, 117, 110, 111, 107, 101, 105, 115, 101,
+	110, 107, 104, 112, 108, 97, 121, 107, 105, 104, 111, 107, 117, 107, 105, 109, 105, 110, 111, 107,
+	105, 110, 100, 101, 114, 107, 105, 110, 100, 108, 101, 107, 105, 116, 97, 109, 105, 107, 105, 121,
+	97, 109, 97, 107, 105, 121, 111, 115, 101, 107, 105, 121, 111, 115, 117, 107, 111, 109, 97, 107,
+	105, 107, 111, 109, 111, 110, 111, 107, 111, 109, 111, 114, 111, 107, 111, 109, 118, 117, 120, 107,
+	111, 111, 98, 105, 110, 107, 111, 115, 97, 107, 97, 107, 111, 115, 104, 101, 114, 107, 111, 115,
+	117, 103, 101, 107, 111, 122, 97, 107, 105, 107, 114, 97, 107, 111, 119, 107, 117, 109, 97, 110,
+	111, 107, 117, 110, 100, 101, 110, 107, 117, 110, 105, 109, 105, 107, 117, 114, 97, 116, 101, 107,
+	117, 114, 103, 97, 110, 107, 117, 114, 111, 98, 101, 107, 117, 114, 111, 103, 105, 107, 117, 119,
+	97, 110, 97, 107, 121, 111, 110, 97, 110, 108, 97, 98, 111, 117, 114, 108, 97, 104, 112, 112,
+	105, 108, 97, 110, 98, 105, 98, 108, 97, 110, 99, 105, 97, 108, 97, 110, 100, 101, 115, 108,
+	97, 114, 100, 97, 108, 108, 97, 114, 118, 105, 107, 108, 97, 116, 105, 110, 97, 108, 97, 116,
+	105, 110, 111, 108, 101, 98, 111, 114, 107, 108, 101, 99, 122, 110, 97, 108, 101, 102, 114, 97,
+	107, 108, 101, 110, 118, 105, 107, 108, 101, 114, 100, 97, 108, 108, 105, 101, 114, 110, 101, 108,
+	105, 110, 100, 97, 115, 108, 111, 97, 98, 97, 116, 108, 111, 99, 107, 101, 114, 108, 111, 103,
+	111, 105, 112, 108, 111, 104, 109, 117, 115, 108, 111, 110, 100, 111, 110, 108, 111, 117, 118, 114,
+	101, 108, 111, 119, 105, 99, 122, 108, 117, 98, 108, 105, 110, 108, 117, 110, 110, 101, 114, 108,
+	117, 120, 117, 114, 121, 108, 117, 122, 101, 114, 110, 108, 121, 110, 103, 101, 110, 109, 97, 99,
+	97, 112, 97, 109, 97, 99, 101, 105, 111, 109, 97, 100, 114, 105, 100, 109, 97, 103, 110, 101,
+	116, 109, 97, 107, 101, 117, 112, 109, 97, 108, 118, 105, 107, 109, 97, 110, 97, 117, 115, 109,
+	97, 110, 100, 97, 108, 109, 97, 114, 99, 104, 101, 109, 97, 114, 105, 110, 101, 109, 97, 114,
+	107, 101, 114, 109, 97, 115, 97, 107, 105, 109, 97, 115, 117, 100, 97, 109, 97, 116, 101, 114,
+	97, 109, 97, 116, 115, 117, 101, 109, 97, 116, 116, 101, 108, 109, 97, 122, 117, 114, 121, 109,
+	101, 101, 114, 101, 115, 109, 101, 103, 117, 114, 111, 109, 101, 108, 100, 97, 108, 109, 101, 108,
+	104, 117, 115, 109, 101, 109, 115, 101, 116, 109, 105, 97, 115, 116, 97, 109, 105, 100, 111, 114,
+	105, 109, 105, 101, 108, 101, 99, 109, 105, 101, 108, 110, 111, 109, 105, 102, 117, 110, 101, 109,
+	105, 104, 97, 109, 97, 109, 105, 104, 97, 114, 117, 109, 105, 107, 97, 115, 97, 109, 105, 108,
+	97, 110, 111, 109, 105, 109, 97, 116, 97, 109, 105, 110, 97, 110, 111, 109, 105, 110, 99, 111,
+	109, 109, 105, 110, 101, 114, 115, 109, 105, 110, 105, 110, 103, 109, 105, 110, 111, 98, 117, 109,
+	105, 115, 97, 107, 105, 109, 105, 115, 97, 115, 97, 109, 105, 115, 97, 119, 97, 109, 105, 115,
+	117, 103, 105, 109, 105, 116, 97, 107, 97, 109, 105, 116, 97, 107, 101, 109, 105, 116, 111, 121,
+	111, 109, 105, 121, 97, 100, 97, 109, 105, 121, 97, 103, 105, 109, 105, 121, 97, 107, 101, 109,
+	105, 121, 97, 122, 117, 109, 105, 121, 111, 116, 97, 109, 105, 122, 117, 104, 111, 109, 108, 98,
+	102, 97, 110, 109, 109, 97, 102, 97, 110, 109, 111, 98, 97, 114, 97, 109, 111, 100, 101, 110,
+	97, 109, 111, 100, 101, 114, 110, 109, 111, 108, 105, 115, 101, 109, 111, 110, 97, 115, 104, 109,
+	111, 114, 101, 110, 97, 109, 111, 114, 109, 111, 110, 109, 111, 115, 99, 111, 119, 109, 111, 115,
+	118, 105, 107, 109, 111, 116, 101, 103, 105, 109, 111, 116, 111, 98, 117, 109, 111, 116, 111, 115,
+	117, 109, 117, 110, 99, 105, 101, 109, 117, 111, 115, 97, 116, 109, 117, 114, 111, 116, 111, 109,
+	117, 115, 101, 101, 116, 109, 117, 115, 105, 99, 97, 109, 121, 45, 119, 97, 110, 109, 121, 100,
+	100, 110, 115, 109, 121, 102, 97, 115, 116, 109, 121, 106, 105, 110, 111, 109, 121, 112, 101, 116,
+	115, 109, 121, 119, 105, 114, 101, 110, 97, 98, 97, 114, 105, 110, 97, 103, 97, 114, 97, 110,
+	97, 103, 97, 115, 117, 110, 97, 103, 105, 115, 111, 110, 97, 103, 111, 121, 97, 110, 97, 104,
+	97, 114, 105, 110, 97, 107, 97, 109, 97, 110, 97, 109, 115, 111, 115, 110, 97, 110, 116, 97,
+	110, 110, 97, 112, 108, 101, 115, 110, 97, 114, 105, 116, 97, 110, 97, 114, 117, 116, 111, 110,
+	97, 114, 118, 105, 107, 110, 97, 116, 111, 114, 105, 110, 97, 121, 111, 114, 111, 110, 101, 109,
+	117, 114, 111, 110, 101, 114, 105, 109, 97, 110, 101, 115, 115, 101, 116, 110, 102, 108, 102, 97,
+	110, 110, 104, 108, 102, 97, 110, 110, 105, 101, 112, 99, 101, 110, 105, 107, 97, 104, 111, 110,
+	105, 107, 105, 116, 97, 110, 105, 110, 111, 104, 101, 110, 105, 115, 115, 97, 110, 110, 105, 115,
+	115, 97, 121, 110, 111, 103, 97, 116, 97, 110, 111, 104, 101, 106, 105, 110, 111, 104, 111, 115,
+	116, 110, 111, 109, 98, 114, 101, 110, 111, 114, 116, 111, 110, 110, 111, 118, 97, 114, 97, 110,
+	111, 119, 114, 117, 122, 110, 117, 109, 97, 116, 97, 110, 117, 109, 97, 122, 117, 110, 121, 117,
+	122, 101, 110, 111, 99, 101, 108, 111, 116, 111, 100, 101, 115, 115, 97, 111, 103, 117, 99, 104,
+	105, 111, 104, 107, 117, 114, 97, 111, 105, 114, 97, 115, 101, 111, 107, 115, 110, 101, 115, 111,
+	108, 101, 99, 107, 111, 111, 108, 107, 117, 115, 122, 111, 109, 110, 105, 119, 101, 111, 110, 45,
+	107, 51, 115, 111, 110, 45, 114, 105, 111, 111, 110, 45, 119, 101, 98, 111, 110, 106, 117, 107,
+	117, 111, 111, 107, 117, 119, 97, 111, 112, 112, 100, 97, 108, 111, 114, 97, 99, 108, 101, 111,
+	114, 107, 100, 97, 108, 111, 114, 108, 97, 110, 100, 111, 114, 115, 107, 111, 103, 111, 115, 97,
+	115, 99, 111, 111, 115, 111, 121, 114, 111, 111, 116, 115, 117, 107, 105, 111, 120, 102, 111, 114,
+	100, 112, 97, 100, 111, 118, 97, 112, 97, 103, 101, 120, 108, 112, 97, 108, 97, 99, 101, 112,
+	97, 108, 109, 97, 115, 112, 97, 110, 97, 109, 97, 112, 97, 114, 111, 99, 104, 112, 97, 116,
+	114, 105, 97, 112, 101, 99, 111, 114, 105, 112, 101, 101, 119, 101, 101, 112, 102, 105, 122, 101,
+	114, 112, 103, 97, 102, 97, 110, 112, 104, 121, 115, 105, 111, 112, 105, 99, 116, 101, 116, 112,
+	105, 108, 111, 116, 115, 112, 105, 110, 111, 107, 111, 112, 108, 45, 119, 97, 119, 112, 108, 97,
+	110, 116, 115, 112, 111, 108, 105, 99, 101, 112, 111, 110, 112, 101, 115, 112, 111, 114, 116, 97,
+	108, 112, 111, 119, 105, 97, 116, 112, 111, 122, 110, 97, 110, 112, 114, 101, 115, 115, 101, 112,
+	117, 98, 116, 108, 115, 112, 117, 101, 98, 108, 111, 112, 117, 103, 108, 105, 97, 112, 117, 108,
+	97, 119, 121, 113, 98, 117, 115, 101, 114, 113, 117, 101, 98, 101, 99, 114, 97, 99, 105, 110,
+	103, 114, 97, 103, 117, 115, 97, 114, 97, 104, 111, 108, 116, 114, 97, 110, 122, 97, 110, 114,
+	101, 97, 108, 116, 121, 114, 101, 99, 105, 102, 101, 114, 101, 105, 115, 101, 110, 114, 101, 107,
+	108, 97, 109, 114, 101, 112, 97, 105, 114, 114, 101, 112, 111, 114, 116, 114, 105, 109, 105, 110,
+	105, 114, 105, 110, 100, 97, 108, 114, 111, 99, 104, 101, 114, 114, 111, 103, 101, 114, 115, 114,
+	111, 108, 108, 97, 103, 114, 111, 118, 105, 103, 111, 114, 111, 121, 107, 101, 110, 114, 117, 111,
+	118, 97, 116, 114, 117, 115, 115, 105, 97, 114, 121, 98, 110, 105, 107, 114, 121, 117, 107, 121,
+	117, 115, 97, 100, 105, 115, 116, 115, 97, 105, 107, 97, 105, 115, 97, 107, 97, 100, 111, 115,
+	97, 107, 97, 107, 105, 115, 97, 107, 97, 116, 97, 115, 97, 107, 117, 104, 111, 115, 97, 110,
+	100, 111, 121, 115, 97, 110, 110, 97, 110, 115, 97, 110, 111, 102, 105, 115, 97, 110, 117, 107,
+	105, 115, 97, 114, 111, 109, 97, 115, 97, 115, 101, 98, 111, 115, 97, 118, 111, 110, 97, 115,
+	101, 99, 97, 97, 115, 115, 101, 99, 114, 101, 116, 115, 101, 105, 100, 97, 116, 115, 101, 105,
+	114, 111, 117, 115, 101, 108, 102, 105, 112, 115, 101, 108, 108, 102, 121, 115, 101, 109, 105, 110,
+	101, 115, 101, 110, 97, 115, 97, 115, 101, 110, 110, 97, 110, 115, 101, 116, 116, 115, 117, 115,
+	104, 105, 105, 98, 97, 115, 104, 105, 110, 103, 111, 115, 104, 105, 110, 103, 117, 115, 104, 105,
+	110, 106, 111, 115, 104, 105, 111, 121, 97, 115, 104, 105, 115, 117, 105, 115, 104, 111, 110, 97,
+	105, 115, 104, 111, 117, 106, 105, 115, 104, 117, 110, 97, 110, 115, 105, 99, 105, 108, 121, 115,
+	105, 103, 100, 97, 108, 115, 105, 108, 106, 97, 110, 115, 105, 114, 100, 97, 108, 115, 107, 97,
+	110, 105, 116, 115, 107, 111, 100, 106, 101, 115, 108, 117, 112, 115, 107, 115, 110, 97, 97, 115,
+	101, 115, 110, 111, 97, 115, 97, 115, 111, 99, 99, 101, 114, 115, 111, 108, 117, 110, 100, 115,
+	112, 104, 105, 110, 120, 115, 116, 97, 110, 103, 101, 115, 116, 100, 108, 105, 98, 115, 116, 106,
+	111, 104, 110, 115, 116, 111, 107, 107, 101, 115, 116, 111, 108, 111, 115, 115, 116, 117, 100, 105,
+	111, 115, 117, 103, 105, 116, 111, 115, 117, 105, 115, 115, 101, 115, 117, 107, 117, 109, 111, 115,
+	117, 108, 100, 97, 108, 115, 117, 109, 105, 100, 97, 115, 117, 109, 105, 116, 97, 115, 117, 112,
+	112, 108, 121, 115, 117, 114, 114, 101, 121, 115, 117, 115, 97, 107, 105, 115, 117, 115, 111, 110,
+	111, 115, 117, 122, 97, 107, 97, 115, 117, 122, 117, 107, 97, 115, 117, 122, 117, 107, 105, 115,
+	119, 97, 116, 99, 104, 115, 119, 101, 100, 101, 110, 115, 121, 100, 110, 101, 121, 115, 122, 107,
+	111, 108, 97, 116, 97, 98, 117, 115, 101, 116, 97, 103, 97, 106, 111, 116, 97, 104, 97, 114,
+	97, 116, 97, 105, 110, 97, 105, 116, 97, 105, 112, 101, 105, 116, 97, 106, 105, 109, 105, 116,
+	97, 106, 105, 114, 105, 116, 97, 107, 97, 103, 105, 116, 97, 107, 97, 115, 117, 116, 97, 107,
+	101, 116, 97, 116, 97, 109, 97, 107, 105, 116, 97, 109, 97, 110, 111, 116, 97, 109, 97, 121,
+	117, 116, 97, 111, 98, 97, 111, 116, 97, 114, 97, 109, 97, 116, 97, 114, 103, 101, 116, 116,
+	97, 116, 116, 111, 111, 116, 101, 110, 110, 105, 115, 116, 101, 114, 97, 109, 111, 116, 101, 114,
+	109, 101, 122, 116, 105, 101, 110, 100, 97, 116, 106, 109, 97, 120, 120, 116, 107, 109, 97, 120,
+	120, 116, 111, 99, 104, 105, 111, 116, 111, 103, 97, 110, 101, 116, 111, 103, 117, 114, 97, 116,
+	111, 109, 97, 114, 105, 116, 111, 109, 105, 107, 97, 116, 111, 109, 105, 121, 97, 116, 111, 109,
+	111, 98, 101, 116, 111, 110, 97, 107, 105, 116, 111, 110, 97, 109, 105, 116, 111, 114, 105, 100,
+	101, 116, 111, 114, 105, 110, 111, 116, 111, 119, 97, 100, 97, 116, 111, 121, 97, 107, 111, 116,
+	111, 121, 111, 110, 101, 116, 111, 121, 111, 110, 111, 116, 111, 121, 111, 116, 97, 116, 111, 122,
+	97, 119, 97, 116, 111, 122, 115, 100, 101, 116, 114, 97, 100, 101, 114, 116, 114, 97, 110, 98,
+	121, 116, 114, 97, 110, 111, 121, 116, 114, 101, 110, 116, 111, 116, 114, 105, 116, 111, 110, 116,
+	114, 111, 109, 115, 97, 116, 114, 111, 109, 115, 111, 116, 114, 121, 115, 105, 108, 116, 115, 117,
+	105, 107, 105, 116, 115, 117, 107, 117, 105, 116, 115, 117, 110, 97, 110, 116, 119, 109, 97, 105,
+	108, 116, 121, 110, 115, 101, 116, 116, 121, 115, 110, 101, 115, 116, 121, 115, 118, 97, 114, 117,
+	102, 99, 102, 97, 110, 117, 109, 98, 114, 105, 97, 117, 110, 105, 99, 111, 109, 117, 114, 97,
+	115, 111, 101, 117, 114, 97, 117, 115, 117, 117, 115, 97, 114, 116, 115, 117, 115, 104, 105, 107,
+	117, 117, 116, 97, 122, 97, 115, 117, 116, 115, 105, 114, 97, 118, 45, 105, 110, 102, 111, 118,
+	97, 103, 115, 111, 121, 118, 97, 110, 116, 97, 97, 118, 97, 114, 101, 115, 101, 118, 101, 108,
+	118, 101, 116, 118, 101, 110, 101, 116, 111, 118, 101, 110, 105, 99, 101, 118, 101, 114, 100, 97,
+	108, 118, 101, 114, 111, 110, 97, 118, 101, 114, 114, 97, 110, 118, 101, 114, 115, 117, 115, 118,
+	101, 115, 116, 98, 121, 118, 105, 97, 106, 101, 115, 118, 105, 107, 105, 110, 103, 118, 105, 108,
+	108, 97, 115, 118, 105, 118, 105, 97, 110, 118, 111, 97, 103, 97, 116, 118, 111, 116, 105, 110,
+	103, 118, 111, 121, 97, 103, 101, 118, 112, 110, 100, 110, 115, 118, 117, 101, 108, 111, 115, 119,
+	97, 106, 105, 107, 105, 119, 97, 107, 117, 121, 97, 119, 97, 108, 116, 101, 114, 119, 97, 114,
+	97, 98, 105, 119, 97, 114, 109, 105, 97, 119, 97, 116, 97, 114, 105, 119, 97, 116, 115, 111,
+	110, 119, 101, 98, 99, 97, 109, 119, 101, 98, 104, 111, 112, 119, 101, 103, 114, 111, 119, 119,
+	105, 101, 108, 117, 110, 119, 122, 109, 105, 117, 119, 120, 105, 104, 117, 97, 110, 120, 115, 52,
+	97, 108, 108, 121, 97, 98, 117, 107, 105, 121, 97, 99, 104, 116, 115, 121, 97, 104, 97, 98,
+	97, 121, 97, 104, 105, 107, 111, 121, 97, 107, 97, 103, 101, 121, 97, 107, 117, 109, 111, 121,
+	97, 109, 97, 100, 97, 121, 97, 111, 116, 115, 117, 121, 97, 115, 97, 107, 97, 121, 97, 115,
+	104, 105, 111, 121, 97, 115, 117, 100, 97, 121, 97, 115, 117, 103, 105, 121, 97, 116, 111, 109,
+	105, 121, 97, 119, 97, 114, 97, 121, 111, 105, 99, 104, 105, 121, 111, 107, 111, 116, 101, 121,
+	111, 107, 111, 122, 101, 121, 111, 110, 97, 103, 111, 121, 117, 122, 97, 119, 97, 122, 97, 109,
+	97, 109, 105, 122, 97, 112, 112, 111, 115, 122, 111, 109, 98, 105, 101, 49, 107, 97, 112, 112,
+	52, 108, 105, 109, 97, 97, 98, 101, 110, 111, 97, 98, 105, 107, 111, 97, 100, 105, 109, 111,
+	97, 100, 117, 108, 116, 97, 101, 116, 110, 97, 97, 103, 114, 97, 114, 97, 105, 115, 97, 105,
+	97, 107, 117, 110, 101, 97, 108, 99, 101, 115, 97, 109, 98, 101, 114, 97, 109, 102, 97, 109,
+	97, 109, 105, 99, 97, 97, 109, 117, 110, 101, 97, 110, 97, 110, 105, 97, 110, 103, 114, 121,
+	97, 112, 112, 108, 101, 97, 115, 107, 101, 114, 97, 115, 107, 105, 109, 97, 115, 107, 111, 121,
+	97, 115, 110, 101, 115, 97, 115, 115, 117, 114, 97, 115, 117, 107, 101, 97, 117, 100, 105, 111,
+	97, 117, 107, 114, 97, 97, 117, 116, 111, 115, 97, 119, 100, 101, 118, 98, 97, 105, 100, 117,
+	98, 97, 108, 97, 116, 98, 97, 110, 100, 111, 98, 97, 114, 100, 117, 98, 97, 114, 117, 109,
+	98, 97, 115, 101, 108, 98, 97, 116, 104, 115, 98, 101, 97, 116, 115, 98, 101, 103, 101, 116,
+	98, 101, 108, 97, 117, 98, 101, 108, 101, 109, 98, 101, 112, 112, 117, 98, 105, 98, 97, 105,
+	98, 105, 98, 108, 101, 98, 105, 104, 97, 114, 98, 105, 110, 103, 111, 98, 105, 122, 101, 110,
+	98, 106, 117, 103, 110, 98, 108, 117, 115, 104, 98, 111, 97, 116, 115, 98, 111, 109, 108, 111,
+	98, 111, 115, 99, 104, 98, 114, 121, 110, 101, 98, 117, 115, 97, 110, 98, 117, 122, 101, 110,
+	98, 121, 107, 108, 101, 98, 121, 116, 111, 109, 99, 97, 102, 106, 115, 99, 97, 110, 111, 110,
+	99, 97, 112, 111, 111, 99, 97, 114, 100, 115, 99, 97, 114, 103, 111, 99, 97, 114, 114, 100,
+	99, 104, 97, 115, 101, 99, 104, 101, 97, 112, 99, 104, 105, 112, 115, 99, 104, 105, 116, 97,
+	99, 104, 111, 102, 117, 99, 104, 111, 121, 111, 99, 105, 116, 105, 99, 99, 111, 97, 99, 104,
+	99, 111, 112, 114, 111, 99, 114, 111, 119, 110, 99, 117, 110, 101, 111, 99, 121, 98, 101, 114,
+	99, 121, 109, 114, 117, 99, 122, 101, 115, 116, 100, 97, 98, 117, 114, 100, 97, 101, 103, 117,
+	100, 97, 105, 103, 111, 100, 97, 105, 119, 97, 100, 97, 110, 99, 101, 100, 100, 110, 115, 53,
+	100, 100, 110, 115, 115, 100, 101, 97, 108, 115, 100, 101, 100, 121, 110, 100, 101, 108, 104, 105,
+	100, 101, 108, 116, 97, 100, 101, 109, 111, 110, 100, 105, 104, 101, 114, 100, 111, 108, 108, 115,
+	100, 111, 110, 110, 97, 100, 111, 115, 104, 105, 100, 111, 118, 114, 101, 100, 117, 98, 97, 105,
+	100, 121, 110, 53, 51, 100, 121, 110, 110, 115, 100, 121, 110, 118, 54, 100, 121, 114, 111, 121,
+	101, 97, 114, 116, 104, 101, 97, 116, 111, 110, 101, 98, 105, 110, 97, 101, 98, 105, 110, 111,
+	101, 100, 101, 107, 97, 101, 110, 105, 119, 97, 101, 112, 115, 111, 110, 101, 114, 105, 109, 111,
+	101, 115, 115, 101, 120, 101, 120, 110, 101, 116, 102, 97, 105, 116, 104, 102, 98, 115, 98, 120,
+	102, 98, 120, 111, 115, 102, 101, 100, 101, 120, 102, 101, 100, 106, 101, 102, 101, 105, 114, 97,
+	102, 101, 114, 109, 111, 102, 105, 101, 108, 100, 102, 105, 110, 97, 108, 102, 108, 100, 114, 118,
+	102, 108, 105, 101, 114, 102, 108, 111, 114, 97, 102, 108, 111, 114, 111, 102, 111, 114, 100, 101,
+	102, 111, 114, 101, 120, 102, 111, 114, 116, 101, 102, 114, 97, 110, 97, 102, 114, 111, 103, 110,
+	102, 114, 111, 121, 97, 102, 117, 99, 104, 117, 102, 117, 100, 97, 105, 102, 117, 107, 117, 105,
+	102, 117, 115, 115, 97, 103, 97, 108, 108, 111, 103, 97, 108, 115, 97, 103, 101, 110, 111, 97,
+	103, 105, 102, 116, 115, 103, 105, 105, 122, 101, 103, 105, 110, 97, 110, 103, 105, 114, 108, 121,
+	103, 105, 115, 107, 101, 103, 105, 118, 101, 115, 103, 108, 97, 115, 115, 103, 108, 111, 98, 111,
+	103, 109, 97, 105, 108, 103, 109, 105, 110, 97, 103, 111, 110, 110, 97, 103, 111, 114, 103, 101,
+	103, 111, 115, 101, 110, 103, 111, 116, 115, 117, 103, 114, 97, 110, 101, 103, 114, 101, 116, 97,
+	103, 114, 105, 112, 101, 103, 114, 111, 110, 103, 103, 117, 99, 99, 105, 103, 117, 105, 100, 101,
+	103, 117, 108, 101, 110, 103, 117, 110, 109, 97, 104, 97, 99, 99, 97, 104, 97, 107, 117, 105,
+	104, 97, 108, 115, 97, 104, 97, 110, 100, 97, 104, 97, 110, 110, 111, 104, 97, 110, 121, 117,
+	104, 101, 97, 118, 121, 104, 101, 114, 111, 121, 104, 105, 99, 97, 109, 104, 105, 111, 107, 105,
+	104, 105, 112, 112, 121, 104, 105, 116, 114, 97, 104, 111, 98, 111, 108, 104, 111, 110, 100, 97,
+	104, 111, 110, 103, 111, 104, 111, 112, 116, 111, 104, 111, 114, 115, 101, 104, 117, 114, 117, 109,
+	104, 121, 97, 116, 116, 104, 121, 111, 103, 111, 104, 121, 117, 103, 97, 105, 98, 120, 111, 115,
+	105, 104, 101, 121, 97, 105, 107, 101, 100, 97, 105, 108, 97, 119, 97, 105, 109, 97, 114, 105,
+	105, 110, 97, 98, 101, 105, 110, 97, 103, 105, 105, 110, 100, 105, 101, 105, 110, 122, 97, 105,
+	105, 114, 117, 109, 97, 105, 115, 45, 98, 121, 105, 116, 97, 107, 111, 105, 116, 97, 110, 111,
+	105, 116, 105, 103, 111, 105, 119, 97, 100, 101, 105, 119, 97, 109, 97, 105, 119, 97, 116, 97,
+	105, 119, 97, 116, 101, 105, 122, 101, 110, 97, 106, 97, 109, 112, 97, 106, 101, 116, 122, 116,
+	106, 103, 111, 114, 97, 107, 97, 105, 116, 97, 107, 97, 110, 97, 110, 107, 97, 110, 105, 101,
+	107, 97, 110, 114, 97, 107, 97, 112, 115, 105, 107, 97, 115, 97, 105, 107, 101, 112, 110, 111,
+	107, 105, 110, 107, 111, 107, 105, 114, 121, 117, 107, 108, 97, 98, 117, 107, 108, 101, 112, 112,
+	107, 109, 112, 115, 112, 107, 111, 99, 104, 105, 107, 111, 101, 108, 110, 107, 111, 109, 97, 101,
+	107, 111, 110, 97, 110, 107, 111, 110, 105, 110, 107, 111, 111, 114, 105, 107, 111, 114, 121, 111,
+	107, 111, 115, 97, 105, 107, 111, 115, 101, 105, 107, 111, 115, 104, 117, 107, 111, 122, 111, 119,
+	107, 112, 112, 115, 112, 107, 117, 114, 111, 110, 107, 117, 116, 110, 111, 107, 119, 112, 115, 112,
+	107, 121, 111, 116, 111, 107, 121, 111, 119, 97, 108, 97, 98, 111, 114, 108, 97, 107, 97, 115,
+	108, 97, 109, 101, 114, 108, 97, 122, 105, 111, 108, 101, 97, 115, 101, 108, 101, 99, 99, 101,
+	108, 101, 99, 99, 111, 108, 101, 103, 97, 108, 108, 101, 108, 117, 120, 108, 101, 110, 117, 103,
+	108, 101, 115, 106, 97, 108, 101, 120, 117, 115, 108, 105, 108, 108, 121, 108, 105, 112, 115, 121,
+	108, 111, 97, 110, 115, 108, 111, 99, 117, 115, 108, 111, 109, 122, 97, 108, 111, 110, 45, 49,
+	108, 111, 110, 45, 50, 108, 111, 112, 112, 97, 108, 111, 116, 101, 110, 108, 111, 116, 116, 111,
+	108, 117, 98, 105, 110, 108, 117, 99, 99, 97, 108, 117, 107, 111, 119, 108, 117, 114, 111, 121,
+	108, 117, 116, 115, 107, 109, 97, 99, 121, 115, 109, 97, 110, 103, 111, 109, 97, 110, 110, 111,
+	109, 97, 111, 114, 105, 109, 97, 115, 111, 121, 109, 99, 100, 105, 114, 109, 99, 112, 114, 101,
+	109, 101, 105, 119, 97, 109, 101, 108, 111, 121, 109, 105, 97, 109, 105, 109, 105, 97, 115, 97,
+	109, 105, 110, 111, 104, 109, 105, 116, 111, 117, 109, 105, 117, 114, 97, 109, 111, 100, 117, 109,
+	109, 111, 108, 100, 101, 109, 111, 110, 101, 121, 109, 111, 118, 105, 101, 109, 117, 105, 107, 97,
+	109, 121, 102, 116, 112, 109, 121, 111, 107, 111, 109, 121, 112, 101, 112, 109, 121, 112, 115, 120,
+	109, 121, 116, 105, 115, 109, 121, 118, 110, 99, 110, 97, 103, 97, 105, 110, 97, 107, 97, 105,
+	110, 97, 107, 108, 111, 110, 97, 110, 97, 101, 110, 97, 110, 97, 111, 110, 97, 110, 98, 117,
+	110, 97, 110, 103, 111, 110, 97, 110, 106, 111, 110, 97, 110, 116, 111, 110, 97, 110, 121, 111,
+	110, 97, 114, 111, 121, 110, 97, 116, 97, 108, 110, 97, 118, 97, 108, 110, 97, 118, 111, 105,
+	110, 101, 115, 110, 97, 110, 101, 117, 101, 115, 110, 101, 120, 117, 115, 110, 105, 105, 109, 105,
+	110, 105, 105, 122, 97, 110, 105, 107, 107, 111, 110, 105, 107, 111, 110, 110, 105, 110, 106, 97,
+	110, 111, 45, 105, 112, 110, 111, 100, 101, 115, 110, 111, 107, 105, 97, 110, 111, 119, 116, 118,
+	110, 116, 100, 108, 108, 110, 117, 111, 114, 111, 111, 97, 114, 97, 105, 111, 98, 97, 109, 97,
+	111, 98, 105, 114, 97, 111, 98, 117, 115, 101, 111, 100, 101, 115, 97, 111, 103, 97, 110, 111,
+	111, 103, 105, 109, 105, 111, 103, 111, 114, 105, 111, 103, 111, 115, 101, 111, 104, 97, 114, 117,
+	111, 106, 105, 121, 97, 111, 107, 101, 116, 111, 111, 108, 97, 119, 97, 111, 109, 97, 104, 97,
+	111, 109, 101, 103, 97, 111, 109, 117, 116, 97, 111, 110, 105, 111, 110, 111, 111, 103, 117, 121,
+	111, 112, 111, 108, 101, 111, 115, 101, 116, 111, 111, 116, 97, 103, 111, 111, 116, 97, 107, 101,
+	111, 116, 97, 114, 105, 111, 116, 97, 114, 117, 111, 116, 111, 98, 101, 111, 119, 97, 110, 105,
+	111, 119, 110, 105, 112, 111, 121, 97, 98, 101, 111, 121, 111, 100, 111, 111, 122, 111, 114, 97,
+	112, 97, 100, 117, 97, 112, 97, 108, 101, 111, 112, 97, 114, 105, 115, 112, 97, 114, 109, 97,
+	112, 97, 114, 116, 105, 112, 97, 114, 116, 115, 112, 97, 114, 116, 121, 112, 97, 118, 105, 97,
+	112, 101, 110, 110, 101, 112, 101, 110, 122, 97, 112, 101, 114, 109, 97, 112, 103, 102, 111, 103,
+	112, 104, 111, 110, 101, 112, 105, 112, 112, 117, 112, 105, 122, 122, 97, 112, 108, 97, 122, 97,
+	112, 111, 107, 101, 114, 112, 114, 97, 116, 111, 112, 114, 97, 120, 105, 112, 114, 103, 109, 114,
+	112, 114, 111, 109, 111, 112, 114, 118, 99, 121, 112, 115, 116, 109, 110, 112, 117, 98, 111, 108,
+	112, 117, 110, 121, 117, 112, 121, 109, 110, 116, 114, 97, 100, 111, 109, 114, 97, 100, 111, 121,
+	114, 97, 117, 109, 97, 114, 101, 98, 117, 110, 114, 101, 99, 104, 116, 114, 101, 104, 97, 98,
+	114, 105, 99, 111, 104, 114, 105, 101, 116, 105, 114, 105, 115, 111, 114, 114, 105, 115, 115, 97,
+	114, 105, 116, 116, 111, 114, 105, 118, 110, 101, 114, 111, 99, 107, 121, 114, 111, 100, 101, 111,
+	114, 111, 100, 111, 121, 114, 111, 114, 111, 115, 114, 111, 118, 110, 111, 114, 117, 103, 98, 121,
+	114, 121, 103, 103, 101, 114, 121, 117, 111, 104, 115, 97, 98, 97, 101, 115, 97, 103, 97, 101,
+	115, 97, 105, 106, 111, 115, 97, 105, 107, 105, 115, 97, 105, 116, 111, 115, 97, 107, 97, 101,
+	115, 97, 107, 121, 111, 115, 97, 108, 111, 110, 115, 97, 108, 117, 100, 115, 97, 109, 112, 97,
+	115, 97, 110, 103, 111, 115, 97, 110, 106, 111, 115, 97, 110, 111, 107, 115, 97, 116, 116, 101,
+	115, 97, 117, 100, 97, 115, 101, 105, 104, 105, 115, 101, 105, 121, 111, 115, 101, 106, 110, 121,
+	115, 101, 107, 100, 49, 115, 101, 108, 98, 117, 115, 101, 108, 106, 101, 115, 101, 110, 101, 114,
+	115, 101, 111, 117, 108, 115, 104, 97, 114, 105, 115, 104, 97, 114, 112, 115, 104, 101, 108, 108,
+	115, 104, 111, 101, 115, 115, 104, 111, 119, 97, 115, 105, 101, 110, 97, 115, 107, 97, 117, 110,
+	115, 107, 105, 101, 110, 115, 107, 106, 97, 107, 115, 107, 111, 108, 101, 115, 107, 121, 112, 101,
+	115, 108, 97, 115, 107, 115, 108, 105, 110, 103, 115, 109, 105, 108, 101, 115, 109, 111, 108, 97,
+	115, 110, 97, 115, 97, 115, 111, 99, 104, 105, 115, 111, 101, 100, 97, 115, 111, 103, 110, 101,
+	115, 111, 108, 97, 114, 115, 111, 109, 110, 97, 115, 111, 112, 111, 116, 115, 111, 114, 117, 109,
+	115, 112, 97, 119, 110, 115, 112, 100, 110, 115, 115, 116, 97, 98, 97, 115, 116, 101, 97, 109,
+	115, 116, 111, 114, 106, 115, 116, 114, 121, 110, 115, 116, 117, 100, 121, 115, 117, 99, 107, 115,
+	115, 117, 105, 102, 117, 115, 117, 105, 116, 97, 115, 118, 101, 105, 111, 115, 119, 105, 115, 115,
+	116, 97, 105, 106, 105, 116, 97, 105, 107, 105, 116, 97, 105, 114, 97, 116, 97, 105, 116, 111,
+	116, 97, 107, 107, 111, 116, 97, 114, 103, 105, 116, 97, 114, 117, 105, 116, 101, 110, 100, 111,
+	116, 101, 110, 101, 105, 116, 101, 110, 114, 105, 116, 101, 114, 110, 105, 116, 101, 120, 97, 115,
+	116, 103, 111, 114, 121, 116, 104, 105, 99, 107, 116, 105, 114, 101, 115, 116, 106, 111, 109, 101,
+	116, 107, 115, 97, 116, 116, 109, 97, 108, 108, 116, 111, 100, 97, 121, 116, 111, 104, 109, 97,
+	116, 111, 107, 97, 105, 116, 111, 108, 103, 97, 116, 111, 111, 108, 115, 116, 111, 114, 97, 121,
+	116, 111, 116, 97, 108, 116, 111, 117, 114, 115, 116, 114, 97, 110, 97, 116, 117, 110, 101, 115,
+	116, 117, 114, 101, 107, 116, 117, 114, 105, 110, 116, 117, 115, 104, 117, 116, 121, 99, 104, 121,
+	116, 121, 100, 97, 108, 117, 98, 97, 110, 107, 117, 100, 105, 110, 101, 117, 106, 105, 105, 101,
+	117, 107, 105, 104, 97, 117, 108, 118, 105, 107, 117, 109, 97, 106, 105, 117, 110, 110, 97, 110,
+	117, 110, 122, 101, 110, 117, 112, 97, 97, 115, 117, 112, 112, 101, 114, 117, 114, 97, 119, 97,
+	117, 114, 111, 119, 110, 117, 115, 101, 114, 115, 117, 115, 116, 107, 97, 117, 115, 117, 107, 105,
+	117, 116, 97, 122, 117, 118, 97, 100, 115, 111, 118, 97, 103, 97, 110, 118, 97, 114, 100, 111,
+	118, 97, 114, 111, 121, 118, 101, 102, 115, 110, 118, 101, 103, 97, 115, 118, 105, 100, 101, 111,
+	118, 111, 100, 107, 97, 118, 111, 108, 100, 97, 118, 111, 108, 118, 111, 118, 111, 108, 121, 110,
+	119, 97, 108, 101, 115, 119, 101, 98, 101, 114, 119, 101, 105, 98, 111, 119, 110, 101, 120, 116,
+	119, 111, 114, 108, 100, 120, 101, 114, 111, 120, 120, 110, 98, 97, 121, 121, 97, 101, 115, 101,
+	121, 97, 104, 111, 111, 121, 97, 105, 116, 97, 121, 97, 105, 122, 117, 121, 97, 108, 116, 97,
+	121, 111, 105, 116, 97, 121, 111, 109, 98, 111, 121, 111, 114, 105, 105, 121, 111, 117, 116, 104,
+	121, 117, 97, 115, 97, 121, 117, 115, 117, 105, 122, 97, 103, 97, 110, 122, 97, 112, 116, 111,
+	122, 97, 114, 111, 119, 122, 103, 111, 114, 97, 48, 101, 109, 109, 49, 50, 104, 112, 49, 51,
+	51, 55, 49, 54, 45, 98, 50, 48, 48, 48, 50, 48, 51, 56, 51, 50, 45, 98, 54, 52,
+	45, 98, 97, 97, 114, 112, 97, 99, 99, 116, 97, 105, 111, 105, 97, 107, 100, 110, 97, 108,
+	112, 49, 97, 114, 118, 111, 97, 115, 115, 110, 97, 117, 114, 101, 97, 120, 105, 115, 98, 97,
+	114, 48, 98, 97, 114, 49, 98, 97, 114, 50, 98, 98, 118, 97, 98, 101, 101, 112, 98, 105,
+	101, 105, 98, 105, 103, 118, 98, 105, 107, 101, 98, 105, 108, 108, 98, 111, 100, 111, 98, 111,
+	102, 97, 98, 111, 107, 110, 98, 111, 108, 116, 98, 111, 110, 100, 98, 111, 110, 110, 98, 117,
+	122, 122, 98, 121, 101, 110, 99, 97, 102, 101, 99, 97, 108, 108, 99, 98, 114, 101, 99, 105,
+	97, 111, 99, 108, 97, 110, 99, 110, 112, 121, 99, 111, 97, 108, 99, 111, 100, 121, 99, 111,
+	109, 111, 99, 114, 101, 119, 99, 117, 114, 118, 99, 121, 111, 110, 99, 121, 111, 117, 100, 99,
+	108, 107, 100, 101, 116, 97, 100, 103, 99, 97, 100, 105, 101, 116, 100, 105, 115, 104, 100, 114,
+	117, 100, 100, 118, 97, 103, 100, 121, 110, 117, 101, 49, 54, 52, 101, 98, 105, 122, 101, 115,
+	45, 49, 101, 117, 45, 49, 101, 117, 45, 50, 101, 117, 45, 51, 101, 117, 45, 52, 102, 97,
+	103, 101, 102, 97, 105, 108, 102, 97, 110, 115, 102, 104, 115, 107, 102, 105, 97, 116, 102, 105,
+	100, 111, 102, 105, 108, 109, 102, 108, 97, 112, 102, 108, 105, 114, 102, 108, 111, 103, 102, 110,
+	119, 107, 102, 111, 111, 108, 102, 114, 45, 49, 102, 117, 101, 108, 102, 117, 115, 111, 103, 98,
+	105, 122, 103, 103, 101, 101, 103, 105, 102, 117, 103, 108, 117, 103, 103, 109, 98, 104, 103, 111,
+	98, 111, 103, 111, 100, 111, 103, 111, 117, 118, 103, 111, 118, 116, 103, 114, 97, 122, 103, 114,
+	105, 119, 103, 114, 117, 101, 103, 117, 97, 109, 103, 117, 103, 101, 103, 117, 106, 111, 104, 97,
+	103, 97, 104, 101, 108, 112, 104, 103, 116, 118, 104, 108, 120, 51, 104, 111, 108, 101, 104, 111,
+	108, 121, 104, 115, 98, 99, 105, 50, 51, 52, 105, 99, 98, 99, 105, 101, 101, 101, 105, 109,
+	100, 98, 105, 111, 98, 98, 105, 114, 97, 113, 105, 118, 103, 117, 106, 97, 118, 97, 106, 101,
+	101, 112, 106, 101, 106, 117, 106, 111, 98, 115, 106, 111, 115, 111, 106, 111, 121, 111, 106, 111,
+	122, 105, 106, 112, 114, 115, 106, 117, 105, 102, 107, 97, 97, 115, 107, 97, 122, 111, 107, 100,
+	100, 105, 107, 105, 101, 118, 107, 105, 106, 111, 107, 105, 108, 108, 107, 105, 108, 111, 107, 105,
+	119, 105, 107, 105, 122, 117, 107, 111, 98, 101, 107, 111, 102, 117, 107, 111, 107, 97, 107, 112,
+	109, 103, 107, 114, 101, 100, 107, 114, 121, 109, 107, 117, 106, 105, 107, 117, 114, 101, 107, 117,
+	115, 117, 107, 118, 97, 109, 107, 121, 105, 118, 108, 97, 105, 114, 108, 97, 110, 115, 108, 97,
+	112, 121, 108, 101, 103, 111, 108, 103, 98, 116, 108, 105, 100, 108, 108, 105, 109, 111, 108, 109,
+	112, 109, 108, 117, 103, 115, 108, 118, 105, 118, 108, 121, 110, 120, 109, 97, 105, 102, 109, 97,
+	110, 120, 109, 99, 112, 101, 109, 101, 101, 116, 109, 101, 109, 101, 109, 101, 110, 117, 109, 105,
+	98, 117, 109, 105, 104, 111, 109, 111, 99, 107, 109, 111, 100, 115, 109, 111, 115, 115, 109, 117,
+	103, 105, 109, 117, 107, 111, 109, 121, 99, 100, 109, 121, 100, 115, 109, 121, 112, 105, 110, 97,
+	52, 117, 110, 97, 98, 117, 110, 97, 105, 101, 110, 101, 101, 110, 110, 105, 107, 101, 110, 111,
+	103, 105, 110, 111, 105, 112, 110, 111, 111, 112, 110, 121, 45, 49, 110, 121, 45, 50, 110, 121,
+	97, 97, 110, 121, 97, 110, 110, 121, 110, 121, 110, 121, 115, 97, 111, 100, 100, 97, 111, 104,
+	100, 97, 111, 105, 114, 109, 111, 108, 108, 111, 111, 111, 112, 115, 111, 115, 108, 111, 111, 116,
+	97, 112, 111, 121, 101, 114, 112, 97, 114, 115, 112, 99, 99, 119, 112, 105, 110, 98, 112, 105,
+	110, 107, 112, 105, 115, 97, 112, 105, 115, 122, 112, 111, 104, 108, 112, 111, 114, 110, 112, 117,
+	112, 117, 113, 111, 116, 111, 113, 112, 111, 110, 114, 101, 105, 116, 114, 105, 105, 107, 114, 111,
+	111, 109, 114, 115, 118, 112, 114, 117, 104, 114, 114, 122, 103, 119, 115, 97, 100, 111, 115, 97,
+	114, 108, 115, 97, 116, 120, 115, 97, 120, 111, 115, 97, 121, 111, 115, 101, 97, 116, 115, 101,
+	101, 107, 115, 101, 120, 121, 115, 103, 45, 49, 115, 104, 97, 119, 115, 104, 111, 111, 115, 105,
+	108, 107, 115, 110, 99, 102, 115, 111, 104, 117, 115, 111, 106, 97, 115, 111, 107, 97, 115, 111,
+	109, 97, 115, 111, 110, 121, 115, 111, 119, 97, 115, 114, 99, 102, 115, 114, 104, 116, 115, 117,
+	108, 105, 115, 117, 109, 121, 115, 117, 114, 102, 115, 122, 101, 120, 116, 97, 110, 107, 116, 97,
+	120, 105, 116, 99, 112, 52, 116, 105, 97, 97, 116, 105, 110, 110, 116, 105, 112, 115, 116, 108,
+	111, 110, 116, 111, 98, 97, 116, 111, 101, 105, 116, 111, 103, 111, 116, 111, 121, 115, 116, 114,
+	101, 101, 116, 117, 108, 97, 116, 117, 110, 107, 116, 117, 118, 97, 117, 101, 100, 97, 117, 110,
+	105, 53, 117, 111, 122, 117, 117, 112, 108, 105, 117, 112, 111, 119, 117, 115, 45, 49, 117, 115,
+	45, 50, 117, 115, 45, 51, 117, 115, 45, 52, 117, 116, 97, 104, 117, 118, 105, 99, 118, 105,
+	115, 97, 118, 105, 118, 97, 118, 105, 118, 111, 118, 108, 111, 103, 118, 111, 116, 101, 118, 111,
+	116, 111, 119, 97, 107, 101, 119, 101, 105, 114, 119, 105, 101, 110, 119, 105, 105, 104, 119, 105,
+	110, 98, 119, 105, 111, 115, 119, 105, 116, 100, 119, 115, 107, 114, 119, 117, 111, 122, 120, 52,
+	52, 51, 120, 98, 111, 120, 121, 117, 102, 117, 121, 117, 107, 105, 122, 101, 114, 111, 50, 105,
+	120, 54, 49, 49, 97, 98, 99, 97, 114, 113, 98, 98, 99, 98, 98, 116, 98, 99, 103, 98,
+	99, 110, 98, 104, 122, 98, 105, 112, 98, 109, 100, 98, 109, 115, 98, 109, 119, 98, 110, 114,
+	98, 122, 104, 98, 122, 122, 99, 54, 54, 99, 98, 103, 99, 98, 110, 99, 98, 115, 99, 101,
+	111, 99, 102, 100, 99, 105, 109, 99, 110, 103, 99, 110, 115, 99, 110, 116, 99, 111, 103, 99,
+	111, 122, 99, 114, 100, 99, 114, 115, 99, 115, 120, 100, 100, 115, 100, 104, 108, 100, 105, 121,
+	100, 110, 112, 100, 114, 114, 101, 109, 114, 101, 110, 102, 101, 115, 113, 102, 101, 109, 102, 104,
+	118, 102, 108, 116, 102, 110, 99, 102, 110, 100, 102, 111, 116, 102, 111, 120, 102, 111, 122, 102,
+	114, 108, 102, 115, 116, 102, 116, 114, 102, 118, 103, 102, 121, 105, 103, 49, 50, 103, 97, 112,
+	103, 103, 102, 103, 111, 112, 103, 114, 112, 103, 115, 106, 103, 117, 98, 104, 107, 116, 104, 122,
+	99, 105, 98, 109, 105, 100, 118, 105, 112, 54, 105, 116, 118, 106, 99, 98, 106, 100, 102, 106,
+	101, 100, 106, 102, 107, 106, 108, 108, 106, 109, 112, 106, 110, 106, 106, 112, 110, 107, 49, 50,
+	107, 56, 115, 107, 102, 104, 107, 112, 110, 108, 107, 51, 108, 108, 112, 109, 116, 110, 109, 116,
+	114, 109, 117, 112, 110, 52, 116, 110, 104, 107, 110, 104, 115, 110, 105, 100, 110, 106, 115, 110,
+	114, 119, 110, 115, 110, 110, 115, 119, 111, 99, 112, 111, 109, 103, 111, 118, 104, 111, 120, 97,
+	112, 104, 100, 112, 104, 120, 112, 105, 119, 112, 108, 99, 112, 109, 110, 112, 110, 99, 112, 114,
+	100, 112, 118, 104, 112, 118, 116, 112, 119, 99, 113, 45, 97, 113, 97, 50, 113, 99, 120, 113,
+	108, 100, 113, 115, 108, 115, 53, 121, 115, 98, 115, 115, 99, 98, 115, 99, 119, 115, 101, 119,
+	115, 104, 119, 115, 106, 99, 115, 108, 100, 115, 108, 103, 115, 108, 122, 115, 111, 111, 115, 112,
+	98, 115, 114, 108, 115, 114, 118, 115, 118, 99, 116, 99, 105, 116, 99, 109, 116, 100, 107, 116,
+	106, 120, 116, 109, 112, 116, 114, 100, 116, 114, 118, 116, 118, 115, 117, 107, 48, 117, 108, 109,
+	117, 115, 114, 118, 97, 111, 118, 102, 115, 118, 105, 120, 118, 112, 52, 118, 120, 108, 119, 104,
+	109, 119, 105, 119, 119, 111, 119, 119, 116, 99, 119, 116, 102, 120, 101, 110, 120, 105, 110, 120,
+	120, 120, 120, 121, 122, 121, 110, 104, 121, 117, 117, 122, 105, 112, 122, 108, 103, 107, 122, 113,
+	104, 120, 106, 120, 122, 122, 119,
+};
+
+constexpr node nodes[9701] = {
+	{0, 0, 0, 0},
+	{7079, 0, 3, 1},
+	{40962, 0, 4, 1},
+	{34163, 0, 6, 1},
+	{34169, 0, 3, 1},
+	{34169, 0, 6, 1},
+	{34175, 0, 6, 1},
+	{42024, 0, 3, 1},
+	{763, 0, 4, 1},
+	{29062, 0, 7, 1},
+	{23679, 0, 8, 1},
+	{35, 0, 2, 1},
+	{29076, 0, 7, 1},
+	{19372, 0, 9, 1},
+	{3730, 0, 10, 1},
+	{12544, 0, 11, 1},
+	{12928, 0, 3, 1},
+	{12912, 0, 5, 1},
+	{729, 0, 2, 1},
+	{10825, 0, 3, 1},
+	{38340, 0, 5, 1},
+	{26, 0, 2, 1},
+	{19068, 0, 3, 1},
+	{19390, 0, 4, 1},
+	{38345, 0, 5, 1},
+	{693, 0, 2, 1},
+	{30335, 0, 3, 1},
+	{16546, 0, 6, 1},
+	{982, 0, 2, 1},
+	{29090, 0, 7, 1},
+	{34193, 0, 6, 1},
+	{714, 0, 2, 1},
+	{3427, 0, 3, 1},
+	{34211, 0, 6, 1},
+	{23727, 0, 8, 1},
+	{34217, 0, 6, 1},
+	{40974, 0, 4, 1},
+	{106, 0, 2, 1},
+	{19435, 0, 9, 1},
+	{29160, 0, 7, 1},
+	{34241, 0, 6, 1},
+	{19444, 0, 9, 1},
+	{23759, 0, 8, 1},
+	{38180, 0, 4, 1},
+	{34247, 0, 6, 1},
+	{34253, 0, 6, 1},
+	{969, 0, 2, 1},
+	{19471, 0, 6, 1},
+	{4347, 0, 15, 1},
+	{6009, 0, 14, 1},
+	{29366, 0, 4, 1},
+	{38375, 0, 5, 1},
+	{38380, 0, 5, 1},
+	{19489, 0, 9, 1},
+	{19507, 0, 9, 1},
+	{29174, 0, 7, 1},
+	{34283, 0, 6, 1},
+	{753, 0, 3, 1},
+	{756, 0, 2, 1},
+	{32596, 0, 3, 1},
+	{15952, 0, 10, 1},
+	{1403, 0, 3, 1},
+	{38400, 0, 5, 1},
+	{7093, 0, 2, 1},
+	{19579, 0, 9, 1},
+	{639, 0, 2, 1},
+	{29542, 0, 4, 1},
+	{34313, 0, 6, 1},
+	{4985, 0, 5, 1},
+	{9382, 0, 4, 1},
+	{31590, 0, 4, 1},
+	{3749, 0, 3, 1},
+	{3776, 0, 4, 1},
+	{140, 0, 2, 1},
+	{34725, 0, 4, 1},
+	{24555, 0, 4, 1},
+	{15972, 0, 10, 1},
+	{89, 0, 2, 1},
+	{29244, 0, 7, 1},
+	{23815, 0, 8, 1},
+	{866, 0, 2, 1},
+	{29258, 0, 7, 1},
+	{29265, 0, 4, 1},
+	{29265, 0, 7, 1},
+	{38435, 0, 5, 1},
+	{29279, 0, 7, 1},
+	{34367, 0, 6, 1},
+	{15982, 0, 4, 1},
+	{38445, 0, 5, 1},
+	{29286, 0, 7, 1},
+	{987, 0, 2, 1},
+	{987, 0, 3, 1},
+	{861, 0, 2, 1},
+	{29307, 0, 3, 1},
+	{3199, 0, 2, 1},
+	{4362, 0, 5, 1},
+	{454, 0, 2, 1},
+	{23847, 0, 4, 1},
+	{38455, 0, 5, 1},
+	{29363, 0, 7, 1},
+	{6107, 0, 14, 1},
+	{630, 0, 4, 1},
+	{22770, 0, 4, 1},
+	{638, 0, 3, 1},
+	{19723, 0, 9, 1},
+	{12665, 0, 11, 1},
+	{23887, 0, 8, 1},
+	{23895, 0, 8, 1},
+	{23903, 0, 8, 1},
+	{23911, 0, 8, 1},
+	{16042, 0, 10, 1},
+	{29377, 0, 7, 1},
+	{34415, 0, 6, 1},
+	{1857, 0, 2, 1},
+	{42030, 0, 3, 1},
+	{42033, 0, 3, 1},
+	{41010, 0, 4, 1},
+	{42036, 0, 3, 1},
+	{42039, 0, 3, 1},
+	{5476, 0, 2, 4},
+	{328, 0, 2, 1},
+	{38490, 0, 5, 1},
+	{34427, 0, 6, 1},
+	{22419, 0, 4, 1},
+	{29391, 0, 7, 1},
+	{16516, 0, 6, 1},
+	{350, 0, 4, 1},
+	{29419, 0, 7, 1},
+	{10166, 0, 3, 1},
+	{12077, 0, 2, 1},
+	{3100, 0, 2, 1},
+	{1616, 0, 2, 1},
+	{34451, 0, 6, 1},
+	{2047, 0, 2, 1},
+	{38520, 0, 5, 1},
+	{9199, 0, 3, 1},
+	{41026, 0, 4, 1},
+	{27315, 0, 4, 1},
+	{38530, 0, 5, 1},
+	{41341, 0, 3, 1},
+	{38535, 0, 3, 1},
+	{7133, 0, 2, 1},
+	{9859, 0, 5, 1},
+	{12742, 0, 11, 1},
+	{12753, 0, 11, 1},
+	{3492, 0, 4, 1},
+	{19813, 0, 9, 1},
+	{23851, 0, 4, 1},
+	{6121, 0, 2, 1},
+	{42051, 0, 3, 1},
+	{42054, 0, 3, 1},
+	{4248, 0, 2, 1},
+	{16102, 0, 10, 1},
+	{887, 0, 2, 1},
+	{38550, 0, 5, 1},
+	{16112, 0, 10, 1},
+	{41038, 0, 4, 1},
+	{32287, 0, 3, 1},
+	{41050, 0, 4, 1},
+	{4907, 0, 3, 1},
+	{4907, 0, 4, 1},
+	{29475, 0, 7, 1},
+	{38560, 0, 5, 1},
+	{34505, 0, 6, 1},
+	{34511, 0, 6, 1},
+	{4392, 0, 3, 1},
+	{24007, 0, 8, 1},
+	{16069, 0, 3, 1},
+	{750, 0, 2, 1},
+	{24015, 0, 8, 1},
+	{12786, 0, 11, 1},
+	{24039, 0, 8, 1},
+	{34529, 0, 6, 1},
+	{29517, 0, 7, 1},
+	{24055, 0, 8, 1},
+	{125, 0, 2, 1},
+	{4080, 0, 2, 1},
+	{12988, 0, 5, 1},
+	{14517, 0, 8, 1},
+	{24079, 0, 8, 1},
+	{16142, 0, 3, 1},
+	{41058, 0, 4, 1},
+	{7019, 0, 2, 1},
+	{28822, 0, 2, 1},
+	{1993, 0, 2, 1},
+	{42060, 0, 2, 1},
+	{42060, 0, 3, 1},
+	{25, 0, 2, 1},
+	{12819, 0, 3, 1},
+	{41066, 0, 4, 1},
+	{2686, 0, 3, 1},
+	{41070, 0, 4, 1},
+	{12830, 0, 11, 1},
+	{3814, 0, 3, 1},
+	{3814, 0, 6, 1},
+	{4452, 0, 4, 1},
+	{38595, 0, 5, 1},
+	{24151, 0, 8, 1},
+	{16202, 0, 7, 1},
+	{16202, 0, 10, 1},
+	{2594, 0, 3, 1},
+	{29573, 0, 7, 1},
+	{38605, 0, 5, 1},
+	{2652, 0, 4, 1},
+	{29580, 0, 6, 1},
+	{29580, 0, 7, 1},
+	{10479, 0, 4, 1},
+	{6163, 0, 4, 1},
+	{29601, 0, 4, 1},
+	{17305, 0, 4, 1},
+	{34565, 0, 6, 1},
+	{88, 0, 3, 1},
+	{24159, 0, 8, 1},
+	{24167, 0, 8, 1},
+	{943, 0, 3, 1},
+	{42072, 0, 3, 1},
+	{41074, 0, 4, 1},
+	{42075, 0, 3, 1},
+	{456, 0, 2, 1},
+	{563, 0, 2, 1},
+	{6269, 0, 6, 1},
+	{42078, 0, 3, 1},
+	{10948, 0, 4, 1},
+	{5448, 0, 2, 1},
+	{10038, 0, 3, 1},
+	{42081, 0, 3, 1},
+	{5710, 0, 2, 1},
+	{36, 0, 2, 1},
+	{34583, 0, 6, 1},
+	{6254, 0, 7, 1},
+	{29650, 0, 7, 1},
+	{38620, 0, 5, 1},
+	{12863, 0, 4, 1},
+	{38625, 0, 5, 1},
+	{29699, 0, 7, 1},
+	{19975, 0, 9, 1},
+	{34619, 0, 6, 1},
+	{34625, 0, 6, 1},
+	{457, 0, 2, 1},
+	{24239, 0, 8, 1},
+	{34637, 0, 6, 1},
+	{11270, 0, 5, 1},
+	{29748, 0, 7, 1},
+	{38650, 0, 4, 1},
+	{38650, 0, 5, 1},
+	{21447, 0, 4, 1},
+	{24247, 0, 8, 1},
+	{2937, 0, 2, 4},
+	{547, 0, 2, 1},
+	{34649, 0, 6, 1},
+	{24263, 0, 8, 1},
+	{9955, 0, 5, 1},
+	{34655, 0, 6, 1},
+	{24271, 0, 8, 1},
+	{24279, 0, 8, 1},
+	{2555, 0, 5, 1},
+	{23699, 0, 4, 1},
+	{29783, 0, 7, 1},
+	{13874, 0, 2, 1},
+	{6219, 0, 2, 1},
+	{4, 0, 2, 1},
+	{38655, 0, 5, 1},
+	{24303, 0, 5, 1},
+	{34667, 0, 6, 1},
+	{10284, 0, 7, 1},
+	{29804, 0, 7, 1},
+	{19, 0, 3, 1},
+	{29811, 0, 7, 1},
+	{24319, 0, 8, 1},
+	{7921, 0, 9, 1},
+	{29825, 0, 7, 1},
+	{29832, 0, 7, 1},
+	{4542, 0, 8, 1},
+	{34673, 0, 6, 1},
+	{34679, 0, 6, 1},
+	{9967, 0, 12, 1},
+	{16372, 0, 10, 1},
+	{29839, 0, 7, 1},
+	{12907, 0, 11, 1},
+	{6247, 0, 7, 1},
+	{6247, 0, 14, 1},
+	{24335, 0, 4, 1},
+	{12918, 0, 4, 1},
+	{29853, 0, 7, 1},
+	{5384, 0, 7, 1},
+	{29888, 0, 6, 1},
+	{29888, 0, 7, 1},
+	{29895, 0, 7, 1},
+	{22116, 0, 3, 1},
+	{5582, 0, 2, 1},
+	{12940, 0, 6, 1},
+	{16392, 0, 10, 1},
+	{12940, 0, 11, 1},
+	{29909, 0, 7, 1},
+	{38665, 0, 5, 1},
+	{42105, 0, 3, 1},
+	{29923, 0, 6, 1},
+	{29923, 0, 7, 1},
+	{2045, 0, 2, 1},
+	{16402, 0, 10, 1},
+	{4279, 0, 2, 1},
+	{11682, 0, 2, 1},
+	{1725, 0, 2, 1},
+	{10029, 0, 2, 1},
+	{38680, 0, 5, 1},
+	{41114, 0, 4, 1},
+	{15089, 0, 2, 1},
+	{38690, 0, 5, 1},
+	{16470, 0, 3, 1},
+	{38710, 0, 5, 1},
+	{8970, 0, 4, 1},
+	{6593, 0, 4, 1},
+	{34733, 0, 6, 1},
+	{34739, 0, 6, 1},
+	{12750, 0, 3, 1},
+	{41118, 0, 4, 1},
+	{42111, 0, 3, 1},
+	{48, 0, 2, 1},
+	{34751, 0, 4, 1},
+	{34751, 0, 6, 1},
+	{38725, 0, 5, 1},
+	{34769, 0, 6, 1},
+	{24447, 0, 8, 1},
+	{744, 0, 4, 1},
+	{24455, 0, 8, 1},
+	{38740, 0, 5, 1},
+	{8303, 0, 8, 1},
+	{34775, 0, 6, 1},
+	{48, 0, 7, 1},
+	{6703, 0, 4, 1},
+	{6703, 0, 6, 1},
+	{4572, 0, 3, 1},
+	{42114, 0, 3, 1},
+	{24463, 0, 8, 1},
+	{41130, 0, 4, 1},
+	{1914, 0, 7, 1},
+	{2806, 0, 6, 1},
+	{2806, 0, 9, 1},
+	{24479, 0, 8, 1},
+	{20065, 0, 8, 1},
+	{41134, 0, 4, 1},
+	{42117, 0, 3, 1},
+	{4213, 0, 2, 1},
+	{10650, 0, 2, 1},
+	{2102, 0, 2, 1},
+	{42120, 0, 3, 1},
+	{3470, 0, 2, 1},
+	{14322, 0, 4, 1},
+	{13528, 0, 6, 1},
+	{4851, 0, 3, 1},
+	{30007, 0, 7, 1},
+	{33446, 0, 3, 1},
+	{24511, 0, 8, 1},
+	{10982, 0, 5, 1},
+	{14655, 0, 3, 1},
+	{38775, 0, 5, 1},
+	{34823, 0, 6, 1},
+	{34829, 0, 6, 1},
+	{34835, 0, 6, 1},
+	{41142, 0, 4, 1},
+	{12860, 0, 3, 1},
+	{7419, 0, 2, 1},
+	{38800, 0, 5, 1},
+	{6345, 0, 3, 1},
+	{18, 0, 2, 1},
+	{18, 0, 3, 1},
+	{38820, 0, 5, 1},
+	{9778, 0, 3, 1},
+	{9778, 0, 9, 1},
+	{2100, 0, 2, 1},
+	{4305, 0, 2, 1},
+	{8147, 0, 5, 1},
+	{34901, 0, 6, 1},
+	{34907, 0, 6, 1},
+	{6645, 0, 8, 1},
+	{13149, 0, 11, 1},
+	{13160, 0, 11, 1},
+	{38830, 0, 5, 1},
+	{8094, 0, 9, 1},
+	{112, 0, 2, 4},
+	{24647, 0, 8, 1},
+	{13994, 0, 4, 1},
+	{27, 0, 2, 1},
+	{42132, 0, 3, 1},
+	{5391, 0, 6, 1},
+	{642, 0, 2, 1},
+	{24655, 0, 8, 1},
+	{766, 0, 2, 1},
+	{16612, 0, 10, 1},
+	{766, 0, 3, 1},
+	{34925, 0, 6, 1},
+	{8836, 0, 8, 1},
+	{1950, 0, 6, 1},
+	{30210, 0, 7, 1},
+	{4355, 0, 7, 1},
+	{16632, 0, 10, 1},
+	{41178, 0, 4, 1},
+	{41182, 0, 4, 1},
+	{20218, 0, 9, 1},
+	{38850, 0, 5, 1},
+	{6017, 0, 6, 1},
+	{4929, 0, 3, 1},
+	{41186, 0, 4, 1},
+	{8090, 0, 4, 1},
+	{30231, 0, 7, 1},
+	{10039, 0, 7, 1},
+	{3500, 0, 4, 1},
+	{38865, 0, 5, 1},
+	{24695, 0, 8, 1},
+	{30252, 0, 7, 1},
+	{30259, 0, 7, 1},
+	{720, 0, 2, 1},
+	{41194, 0, 4, 1},
+	{24719, 0, 8, 1},
+	{41198, 0, 4, 1},
+	{41202, 0, 4, 1},
+	{38890, 0, 5, 1},
+	{30273, 0, 7, 1},
+	{720, 0, 9, 1},
+	{3532, 0, 4, 1},
+	{20245, 0, 9, 1},
+	{24743, 0, 8, 1},
+	{30308, 0, 4, 1},
+	{30308, 0, 7, 1},
+	{30315, 0, 3, 1},
+	{30315, 0, 7, 1},
+	{4083, 0, 2, 1},
+	{41389, 0, 2, 4},
+	{34967, 0, 6, 1},
+	{30322, 0, 7, 1},
+	{41210, 0, 4, 1},
+	{30343, 0, 7, 1},
+	{30350, 0, 7, 1},
+	{10063, 0, 3, 1},
+	{20844, 0, 2, 1},
+	{1642, 0, 2, 1},
+	{13281, 0, 3, 1},
+	{13281, 0, 4, 1},
+	{13281, 0, 11, 1},
+	{24783, 0, 8, 1},
+	{34802, 0, 4, 1},
+	{38920, 0, 5, 1},
+	{30378, 0, 7, 1},
+	{21608, 0, 5, 1},
+	{16672, 0, 10, 1},
+	{42153, 0, 3, 1},
+	{61, 0, 2, 1},
+	{13068, 0, 4, 1},
+	{20317, 0, 9, 1},
+	{42159, 0, 3, 1},
+	{30406, 0, 7, 1},
+	{20326, 0, 9, 1},
+	{24847, 0, 8, 1},
+	{42165, 0, 3, 1},
+	{30805, 0, 7, 1},
+	{6210, 0, 3, 1},
+	{24919, 0, 4, 1},
+	{20407, 0, 9, 1},
+	{35033, 0, 6, 1},
+	{42171, 0, 3, 1},
+	{471, 0, 2, 1},
+	{2542, 0, 3, 1},
+	{15965, 0, 7, 1},
+	{38965, 0, 5, 1},
+	{35045, 0, 6, 1},
+	{3339, 0, 4, 1},
+	{8384, 0, 5, 1},
+	{42177, 0, 3, 1},
+	{4401, 0, 6, 1},
+	{21231, 0, 3, 1},
+	{349, 0, 2, 1},
+	{41238, 0, 4, 1},
+	{4787, 0, 2, 1},
+	{29450, 0, 3, 1},
+	{324, 0, 2, 1},
+	{3360, 0, 3, 1},
+	{4631, 0, 4, 1},
+	{30854, 0, 7, 1},
+	{35099, 0, 6, 1},
+	{1046, 0, 2, 1},
+	{1673, 0, 2, 1},
+	{41242, 0, 4, 1},
+	{30, 0, 2, 1},
+	{42, 0, 2, 1},
+	{38980, 0, 4, 1},
+	{38980, 0, 5, 1},
+	{39005, 0, 5, 1},
+	{35123, 0, 6, 1},
+	{913, 0, 2, 1},
+	{39010, 0, 5, 1},
+	{2604, 0, 3, 1},
+	{990, 0, 6, 1},
+	{39015, 0, 5, 1},
+	{3803, 0, 2, 1},
+	{39020, 0, 5, 1},
+	{41254, 0, 4, 1},
+	{21729, 0, 3, 1},
+	{4106, 0, 3, 1},
+	{344, 0, 2, 1},
+	{30945, 0, 7, 1},
+	{20479, 0, 4, 1},
+	{20479, 0, 9, 1},
+	{30959, 0, 4, 1},
+	{10503, 0, 3, 1},
+	{24991, 0, 8, 1},
+	{16752, 0, 4, 1},
+	{16752, 0, 6, 1},
+	{42183, 0, 3, 1},
+	{11355, 0, 3, 1},
+	{810, 0, 3, 1},
+	{4263, 0, 2, 1},
+	{3201, 0, 2, 1},
+	{2757, 0, 2, 1},
+	{24999, 0, 8, 1},
+	{25007, 0, 8, 1},
+	{35183, 0, 6, 1},
+	{16987, 0, 5, 1},
+	{39060, 0, 5, 1},
+	{31029, 0, 7, 1},
+	{11702, 0, 5, 1},
+	{3101, 0, 2, 1},
+	{3947, 0, 2, 1},
+	{3231, 0, 2, 1},
+	{25031, 0, 8, 1},
+	{39070, 0, 5, 1},
+	{41290, 0, 4, 1},
+	{39075, 0, 5, 1},
+	{31043, 0, 7, 1},
+	{20835, 0, 4, 1},
+	{11718, 0, 2, 1},
+	{1233, 0, 2, 1},
+	{3307, 0, 4, 1},
+	{31106, 0, 7, 1},
+	{31120, 0, 7, 1},
+	{29380, 0, 4, 1},
+	{38549, 0, 3, 1},
+	{25127, 0, 4, 1},
+	{25127, 0, 8, 1},
+	{229, 0, 6, 1},
+	{16842, 0, 10, 1},
+	{41302, 0, 4, 1},
+	{25135, 0, 8, 1},
+	{1910, 0, 4, 1},
+	{35339, 0, 6, 1},
+	{41306, 0, 4, 1},
+	{35375, 0, 6, 1},
+	{20641, 0, 9, 1},
+	{10231, 0, 7, 1},
+	{19945, 0, 3, 1},
+	{1753, 0, 2, 1},
+	{42195, 0, 3, 1},
+	{1711, 0, 2, 1},
+	{5521, 0, 2, 1},
+	{8406, 0, 6, 1},
+	{25239, 0, 8, 1},
+	{31176, 0, 7, 1},
+	{20659, 0, 9, 1},
+	{20668, 0, 9, 1},
+	{4857, 0, 5, 1},
+	{20686, 0, 9, 1},
+	{39155, 0, 5, 1},
+	{39170, 0, 5, 1},
+	{25303, 0, 8, 1},
+	{1986, 0, 4, 1},
+	{4872, 0, 7, 1},
+	{2753, 0, 3, 1},
+	{31204, 0, 7, 1},
+	{13715, 0, 6, 1},
+	{31211, 0, 7, 1},
+	{6493, 0, 5, 1},
+	{11413, 0, 3, 1},
+	{6192, 0, 2, 1},
+	{41322, 0, 4, 1},
+	{4900, 0, 2, 1},
+	{1300, 0, 2, 1},
+	{35429, 0, 6, 1},
+	{39180, 0, 5, 1},
+	{31225, 0, 7, 1},
+	{42201, 0, 3, 1},
+	{41330, 0, 4, 1},
+	{3673, 0, 3, 1},
+	{12569, 0, 3, 1},
+	{458, 0, 2, 1},
+	{43, 0, 2, 1},
+	{41334, 0, 4, 1},
+	{41516, 0, 3, 1},
+	{31546, 0, 5, 1},
+	{1036, 0, 2, 1},
+	{2668, 0, 2, 1},
+	{35495, 0, 6, 1},
+	{41338, 0, 4, 1},
+	{16952, 0, 4, 1},
+	{16952, 0, 10, 1},
+	{204, 0, 2, 1},
+	{12839, 0, 3, 1},
+	{16972, 0, 10, 1},
+	{25359, 0, 8, 1},
+	{21606, 0, 4, 1},
+	{984, 0, 3, 1},
+	{6710, 0, 3, 1},
+	{20803, 0, 9, 1},
+	{235, 0, 9, 1},
+	{35519, 0, 6, 1},
+	{2022, 0, 3, 1},
+	{8285, 0, 13, 1},
+	{35525, 0, 6, 1},
+	{13512, 0, 11, 1},
+	{9, 0, 2, 1},
+	{25375, 0, 8, 1},
+	{3351, 0, 2, 1},
+	{38, 0, 2, 1},
+	{27836, 0, 5, 1},
+	{52, 0, 2, 1},
+	{31386, 0, 7, 1},
+	{52, 0, 3, 1},
+	{25439, 0, 8, 1},
+	{127, 0, 2, 1},
+	{31702, 0, 4, 1},
+	{42210, 0, 3, 1},
+	{35549, 0, 6, 1},
+	{41354, 0, 4, 1},
+	{42213, 0, 3, 1},
+	{933, 0, 2, 1},
+	{41358, 0, 4, 1},
+	{39295, 0, 5, 1},
+	{31477, 0, 7, 1},
+	{30800, 0, 3, 1},
+	{42225, 0, 3, 1},
+	{12408, 0, 2, 4},
+	{42228, 0, 3, 1},
+	{42231, 0, 3, 1},
+	{1751, 0, 2, 1},
+	{41366, 0, 4, 1},
+	{35567, 0, 6, 1},
+	{25535, 0, 3, 1},
+	{35591, 0, 3, 1},
+	{6664, 0, 2, 1},
+	{25543, 0, 8, 1},
+	{41382, 0, 4, 1},
+	{35597, 0, 6, 1},
+	{31498, 0, 7, 1},
+	{35693, 0, 6, 1},
+	{41398, 0, 4, 1},
+	{2164, 0, 2, 1},
+	{13710, 0, 11, 1},
+	{6667, 0, 14, 1},
+	{5037, 0, 15, 1},
+	{42243, 0, 3, 1},
+	{16735, 0, 2, 1},
+	{2938, 0, 2, 4},
+	{2304, 0, 2, 1},
+	{19469, 0, 3, 1},
+	{33482, 0, 4, 1},
+	{17420, 0, 3, 1},
+	{35759, 0, 6, 1},
+	{35765, 0, 6, 1},
+	{31708, 0, 7, 1},
+	{41418, 0, 4, 1},
+	{17471, 0, 2, 1},
+	{1018, 0, 2, 1},
+	{39370, 0, 5, 1},
+	{10627, 0, 7, 1},
+	{35831, 0, 6, 1},
+	{9838, 0, 2, 1},
+	{41438, 0, 4, 1},
+	{42246, 0, 3, 1},
+	{1749, 0, 2, 1},
+	{3159, 0, 3, 1},
+	{41442, 0, 4, 1},
+	{21289, 0, 9, 1},
+	{5426, 0, 2, 1},
+	{6712, 0, 2, 1},
+	{39440, 0, 5, 1},
+	{42477, 0, 2, 1},
+	{728, 0, 2, 1},
+	{31848, 0, 7, 1},
+	{13743, 0, 11, 1},
+	{39460, 0, 5, 1},
+	{21370, 0, 9, 1},
+	{35927, 0, 6, 1},
+	{875, 0, 4, 1},
+	{21379, 0, 9, 1},
+	{31869, 0, 7, 1},
+	{31890, 0, 7, 1},
+	{2441, 0, 3, 1},
+	{35957, 0, 6, 1},
+	{31897, 0, 7, 1},
+	{5271, 0, 3, 1},
+	{13561, 0, 6, 1},
+	{3387, 0, 2, 1},
+	{107, 0, 2, 1},
+	{22966, 0, 3, 1},
+	{39470, 0, 5, 1},
+	{31925, 0, 7, 1},
+	{35975, 0, 6, 1},
+	{39485, 0, 5, 1},
+	{41482, 0, 4, 1},
+	{39505, 0, 5, 1},
+	{41486, 0, 4, 1},
+	{698, 0, 2, 1},
+	{41490, 0, 4, 1},
+	{8467, 0, 4, 1},
+	{8467, 0, 13, 1},
+	{21415, 0, 9, 1},
+	{26231, 0, 8, 1},
+	{17342, 0, 4, 1},
+	{39510, 0, 5, 1},
+	{31967, 0, 7, 1},
+	{41494, 0, 4, 1},
+	{31974, 0, 7, 1},
+	{21451, 0, 5, 1},
+	{6709, 0, 4, 1},
+	{39515, 0, 5, 1},
+	{1071, 0, 4, 1},
+	{5399, 0, 6, 1},
+	{3466, 0, 2, 1},
+	{41072, 0, 3, 1},
+	{42252, 0, 3, 1},
+	{19523, 0, 4, 1},
+	{39520, 0, 5, 1},
+	{36011, 0, 6, 1},
+	{39525, 0, 5, 1},
+	{17362, 0, 3, 1},
+	{36029, 0, 6, 1},
+	{4340, 0, 5, 1},
+	{39555, 0, 5, 1},
+	{10280, 0, 4, 1},
+	{6881, 0, 3, 1},
+	{10723, 0, 12, 1},
+	{4224, 0, 2, 1},
+	{505, 0, 2, 1},
+	{232, 0, 2, 1},
+	{33033, 0, 3, 1},
+	{33033, 0, 4, 1},
+	{1732, 0, 2, 1},
+	{26295, 0, 8, 1},
+	{17392, 0, 4, 1},
+	{36059, 0, 6, 1},
+	{2301, 0, 2, 1},
+	{1791, 0, 2, 1},
+	{970, 0, 2, 1},
+	{39585, 0, 5, 1},
+	{36089, 0, 6, 1},
+	{41514, 0, 4, 1},
+	{4656, 0, 6, 1},
+	{36101, 0, 6, 1},
+	{5125, 0, 3, 1},
+	{17442, 0, 10, 1},
+	{39590, 0, 5, 1},
+	{36909, 0, 3, 1},
+	{10321, 0, 6, 1},
+	{21523, 0, 9, 1},
+	{32093, 0, 7, 1},
+	{26359, 0, 8, 1},
+	{21541, 0, 9, 1},
+	{26391, 0, 8, 1},
+	{36167, 0, 6, 1},
+	{19686, 0, 3, 1},
+	{1647, 0, 2, 1},
+	{26439, 0, 8, 1},
+	{17714, 0, 2, 1},
+	{102, 0, 2, 1},
+	{1498, 0, 3, 1},
+	{21595, 0, 5, 1},
+	{41526, 0, 4, 1},
+	{21613, 0, 9, 1},
+	{41530, 0, 4, 1},
+	{26455, 0, 8, 1},
+	{102, 0, 3, 1},
+	{41534, 0, 4, 1},
+	{26463, 0, 8, 1},
+	{323, 0, 2, 1},
+	{2661, 0, 2, 1},
+	{39630, 0, 5, 1},
+	{21640, 0, 9, 1},
+	{6019, 0, 3, 1},
+	{17592, 0, 4, 1},
+	{32184, 0, 4, 1},
+	{17586, 0, 3, 1},
+	{17602, 0, 10, 1},
+	{12143, 0, 2, 1},
+	{2440, 0, 2, 1},
+	{36377, 0, 3, 1},
+	{7455, 0, 3, 1},
+	{83, 0, 2, 4},
+	{10173, 0, 3, 1},
+	{5601, 0, 2, 1},
+	{736, 0, 2, 1},
+	{2103, 0, 4, 1},
+	{9829, 0, 6, 1},
+	{22516, 0, 4, 1},
+	{25681, 0, 3, 1},
+	{22534, 0, 3, 1},
+	{26357, 0, 3, 1},
+	{36413, 0, 6, 1},
+	{39665, 0, 5, 1},
+	{32226, 0, 7, 1},
+	{36425, 0, 6, 1},
+	{26631, 0, 8, 1},
+	{36431, 0, 6, 1},
+	{13930, 0, 4, 1},
+	{13930, 0, 11, 1},
+	{17642, 0, 3, 1},
+	{39670, 0, 5, 1},
+	{1960, 0, 2, 1},
+	{15233, 0, 2, 1},
+	{569, 0, 2, 1},
+	{578, 0, 2, 1},
+	{578, 0, 3, 1},
+	{1271, 0, 2, 1},
+	{42255, 0, 3, 1},
+	{42258, 0, 3, 1},
+	{21, 0, 2, 1},
+	{1121, 0, 6, 1},
+	{8329, 0, 5, 1},
+	{2088, 0, 6, 1},
+	{3793, 0, 2, 1},
+	{38146, 0, 2, 1},
+	{4107, 0, 2, 1},
+	{2549, 0, 2, 1},
+	{35001, 0, 2, 1},
+	{722, 0, 2, 1},
+	{9857, 0, 3, 1},
+	{36551, 0, 6, 1},
+	{17722, 0, 4, 1},
+	{1107, 0, 6, 1},
+	{32600, 0, 4, 1},
+	{16001, 0, 3, 1},
+	{64, 0, 2, 1},
+	{703, 0, 2, 1},
+	{6940, 0, 3, 1},
+	{2944, 0, 3, 1},
+	{32373, 0, 7, 1},
+	{32380, 0, 7, 1},
+	{2944, 0, 7, 1},
+	{32394, 0, 7, 1},
+	{3936, 0, 3, 1},
+	{3936, 0, 4, 1},
+	{16631, 0, 4, 1},
+	{17762, 0, 10, 1},
+	{39790, 0, 5, 1},
+	{3523, 0, 2, 1},
+	{10976, 0, 3, 1},
+	{334, 0, 2, 1},
+	{12810, 0, 3, 1},
+	{42267, 0, 3, 1},
+	{23, 0, 2, 1},
+	{37932, 0, 4, 1},
+	{41594, 0, 4, 1},
+	{39810, 0, 5, 1},
+	{39815, 0, 5, 1},
+	{36671, 0, 6, 1},
+	{36677, 0, 6, 1},
+	{5838, 0, 2, 1},
+	{134, 0, 2, 1},
+	{39830, 0, 5, 1},
+	{2076, 0, 18, 1},
+	{36707, 0, 6, 1},
+	{1019, 0, 3, 1},
+	{36719, 0, 6, 1},
+	{39835, 0, 5, 1},
+	{3867, 0, 2, 4},
+	{1304, 0, 2, 1},
+	{1304, 0, 3, 1},
+	{42279, 0, 3, 1},
+	{5731, 0, 3, 1},
+	{4954, 0, 2, 1},
+	{29830, 0, 3, 1},
+	{738, 0, 2, 1},
+	{2104, 0, 3, 1},
+	{27103, 0, 8, 1},
+	{7993, 0, 6, 1},
+	{32583, 0, 7, 1},
+	{14073, 0, 6, 1},
+	{14073, 0, 11, 1},
+	{32597, 0, 7, 1},
+	{41646, 0, 4, 1},
+	{20, 0, 2, 1},
+	{39920, 0, 5, 1},
+	{4660, 0, 3, 1},
+	{13400, 0, 3, 1},
+	{39930, 0, 5, 1},
+	{6871, 0, 3, 1},
+	{6871, 0, 6, 1},
+	{32652, 0, 3, 1},
+	{16383, 0, 4, 1},
+	{36833, 0, 6, 1},
+	{14106, 0, 6, 1},
+	{6352, 0, 3, 1},
+	{6352, 0, 7, 1},
+	{32674, 0, 7, 1},
+	{10214, 0, 5, 1},
+	{19353, 0, 6, 1},
+	{4341, 0, 3, 1},
+	{42294, 0, 3, 1},
+	{778, 0, 2, 1},
+	{2094, 0, 4, 1},
+	{22108, 0, 9, 1},
+	{40010, 0, 5, 1},
+	{41666, 0, 4, 1},
+	{5374, 0, 8, 1},
+	{40025, 0, 5, 1},
+	{40030, 0, 5, 1},
+	{22117, 0, 9, 1},
+	{27239, 0, 3, 1},
+	{41670, 0, 4, 1},
+	{481, 0, 2, 1},
+	{6295, 0, 3, 1},
+	{4524, 0, 2, 1},
+	{36935, 0, 6, 1},
+	{15529, 0, 2, 4},
+	{2545, 0, 2, 1},
+	{27247, 0, 8, 1},
+	{42300, 0, 3, 1},
+	{32751, 0, 7, 1},
+	{40060, 0, 5, 1},
+	{2752, 0, 5, 1},
+	{14205, 0, 11, 1},
+	{26753, 0, 6, 1},
+	{36947, 0, 6, 1},
+	{13101, 0, 4, 1},
+	{36953, 0, 6, 1},
+	{27263, 0, 8, 1},
+	{4455, 0, 3, 1},
+	{7833, 0, 3, 1},
+	{14619, 0, 4, 1},
+	{41678, 0, 4, 1},
+	{32772, 0, 7, 1},
+	{40070, 0, 5, 1},
+	{17171, 0, 2, 1},
+	{2832, 0, 2, 1},
+	{16097, 0, 5, 1},
+	{2832, 0, 4, 1},
+	{2832, 0, 11, 1},
+	{27311, 0, 8, 1},
+	{33909, 0, 4, 1},
+	{2447, 0, 2, 1},
+	{10830, 0, 2, 1},
+	{42315, 0, 3, 1},
+	{41690, 0, 4, 1},
+	{40080, 0, 5, 1},
+	{32821, 0, 7, 1},
+	{41694, 0, 4, 1},
+	{67, 0, 4, 1},
+	{220, 0, 2, 1},
+	{22207, 0, 9, 1},
+	{40090, 0, 5, 1},
+	{4357, 0, 5, 1},
+	{27367, 0, 5, 1},
+	{5042, 0, 3, 1},
+	{7931, 0, 4, 1},
+	{14249, 0, 11, 1},
+	{14260, 0, 4, 1},
+	{14271, 0, 11, 1},
+	{40100, 0, 5, 1},
+	{5042, 0, 10, 1},
+	{27383, 0, 8, 1},
+	{17982, 0, 10, 1},
+	{17992, 0, 3, 1},
+	{17992, 0, 10, 1},
+	{804, 0, 2, 1},
+	{1961, 0, 2, 1},
+	{4969, 0, 3, 1},
+	{337, 0, 2, 1},
+	{42327, 0, 3, 1},
+	{6835, 0, 2, 1},
+	{3132, 0, 2, 1},
+	{41706, 0, 4, 1},
+	{37049, 0, 6, 1},
+	{1474, 0, 5, 1},
+	{37055, 0, 6, 1},
+	{10151, 0, 5, 1},
+	{7, 0, 2, 1},
+	{10823, 0, 4, 1},
+	{18042, 0, 10, 1},
+	{32884, 0, 7, 1},
+	{37079, 0, 6, 1},
+	{32891, 0, 7, 1},
+	{1912, 0, 3, 1},
+	{27463, 0, 8, 1},
+	{14326, 0, 11, 1},
+	{40155, 0, 5, 1},
+	{37091, 0, 5, 1},
+	{37091, 0, 6, 1},
+	{41710, 0, 4, 1},
+	{27471, 0, 8, 1},
+	{200, 0, 3, 1},
+	{200, 0, 4, 1},
+	{32912, 0, 7, 1},
+	{37103, 0, 6, 1},
+	{37109, 0, 6, 1},
+	{4967, 0, 10, 1},
+	{4365, 0, 4, 1},
+	{18082, 0, 10, 1},
+	{2016, 0, 6, 1},
+	{32933, 0, 7, 1},
+	{32947, 0, 7, 1},
+	{6490, 0, 4, 1},
+	{22261, 0, 9, 1},
+	{40160, 0, 5, 1},
+	{22464, 0, 3, 1},
+	{11143, 0, 3, 1},
+	{13025, 0, 3, 1},
+	{99, 0, 2, 1},
+	{37127, 0, 6, 1},
+	{8342, 0, 5, 1},
+	{40195, 0, 5, 1},
+	{37133, 0, 6, 1},
+	{41718, 0, 4, 1},
+	{868, 0, 2, 1},
+	{41722, 0, 4, 1},
+	{39, 0, 2, 1},
+	{40215, 0, 5, 1},
+	{41726, 0, 4, 1},
+	{5988, 0, 3, 1},
+	{1522, 0, 2, 1},
+	{1522, 0, 3, 1},
+	{37175, 0, 6, 1},
+	{506, 0, 2, 1},
+	{27535, 0, 8, 1},
+	{2584, 0, 4, 1},
+	{2584, 0, 6, 1},
+	{18122, 0, 6, 1},
+	{11451, 0, 4, 1},
+	{40265, 0, 5, 1},
+	{27583, 0, 8, 1},
+	{33038, 0, 7, 1},
+	{5217, 0, 7, 1},
+	{5217, 0, 15, 1},
+	{37229, 0, 6, 1},
+	{7872, 0, 3, 1},
+	{41738, 0, 4, 1},
+	{5114, 0, 3, 1},
+	{3916, 0, 4, 1},
+	{41746, 0, 4, 1},
+	{327, 0, 2, 1},
+	{16717, 0, 3, 1},
+	{42348, 0, 3, 1},
+	{1512, 0, 2, 1},
+	{3683, 0, 3, 1},
+	{42351, 0, 3, 1},
+	{18182, 0, 10, 1},
+	{33087, 0, 7, 1},
+	{11311, 0, 12, 1},
+	{22378, 0, 6, 1},
+	{13638, 0, 6, 1},
+	{33101, 0, 7, 1},
+	{2112, 0, 7, 1},
+	{27663, 0, 4, 1},
+	{208, 0, 2, 1},
+	{94, 0, 2, 1},
+	{27505, 0, 6, 1},
+	{41754, 0, 4, 1},
+	{9889, 0, 6, 1},
+	{3806, 0, 8, 1},
+	{41758, 0, 4, 1},
+	{18326, 0, 6, 1},
+	{40335, 0, 5, 1},
+	{27735, 0, 8, 1},
+	{34924, 0, 5, 1},
+	{42357, 0, 3, 1},
+	{34930, 0, 3, 1},
+	{41762, 0, 4, 1},
+	{4691, 0, 3, 1},
+	{989, 0, 2, 1},
+	{598, 0, 2, 1},
+	{22459, 0, 9, 1},
+	{40350, 0, 5, 1},
+	{41770, 0, 4, 1},
+	{40355, 0, 5, 1},
+	{4801, 0, 4, 1},
+	{33171, 0, 7, 1},
+	{40360, 0, 5, 1},
+	{6369, 0, 4, 1},
+	{27855, 0, 8, 1},
+	{37361, 0, 6, 1},
+	{27871, 0, 4, 1},
+	{27871, 0, 8, 1},
+	{126, 0, 2, 1},
+	{41778, 0, 4, 1},
+	{7744, 0, 4, 1},
+	{33262, 0, 7, 1},
+	{126, 0, 4, 1},
+	{932, 0, 2, 1},
+	{869, 0, 2, 1},
+	{6680, 0, 3, 1},
+	{16496, 0, 4, 1},
+	{10611, 0, 3, 1},
+	{40395, 0, 5, 1},
+	{1317, 0, 2, 1},
+	{40405, 0, 5, 1},
+	{3774, 0, 2, 1},
+	{3774, 0, 5, 1},
+	{40410, 0, 5, 1},
+	{1516, 0, 2, 1},
+	{41782, 0, 4, 1},
+	{159, 0, 2, 1},
+	{37427, 0, 6, 1},
+	{6616, 0, 6, 1},
+	{27927, 0, 8, 1},
+	{27935, 0, 8, 1},
+	{41786, 0, 4, 1},
+	{40440, 0, 5, 1},
+	{2031, 0, 9, 1},
+	{22702, 0, 4, 1},
+	{41802, 0, 4, 1},
+	{27500, 0, 3, 1},
+	{1406, 0, 3, 1},
+	{1406, 0, 5, 1},
+	{17961, 0, 5, 1},
+	{23971, 0, 4, 1},
+	{1825, 0, 2, 1},
+	{42381, 0, 3, 1},
+	{494, 0, 2, 1},
+	{53, 0, 2, 1},
+	{33436, 0, 5, 1},
+	{33339, 0, 7, 1},
+	{8346, 0, 4, 1},
+	{22765, 0, 9, 1},
+	{22774, 0, 9, 1},
+	{1973, 0, 3, 1},
+	{28015, 0, 8, 1},
+	{22810, 0, 9, 1},
+	{33367, 0, 7, 1},
+	{10046, 0, 5, 1},
+	{11431, 0, 6, 1},
+	{37475, 0, 6, 1},
+	{40490, 0, 5, 1},
+	{21419, 0, 5, 1},
+	{237, 0, 2, 1},
+	{40495, 0, 5, 1},
+	{28071, 0, 8, 1},
+	{37517, 0, 6, 1},
+	{33395, 0, 7, 1},
+	{41826, 0, 4, 1},
+	{33402, 0, 7, 1},
+	{37553, 0, 6, 1},
+	{7979, 0, 2, 1},
+	{37559, 0, 6, 1},
+	{40515, 0, 5, 1},
+	{4059, 0, 2, 1},
+	{1227, 0, 2, 1},
+	{37571, 0, 6, 1},
+	{5160, 0, 7, 1},
+	{289, 0, 2, 1},
+	{671, 0, 3, 1},
+	{37607, 0, 6, 1},
+	{3464, 0, 4, 1},
+	{37661, 0, 6, 1},
+	{37673, 0, 6, 1},
+	{18462, 0, 10, 1},
+	{28317, 0, 5, 1},
+	{37679, 0, 6, 1},
+	{7155, 0, 3, 1},
+	{41838, 0, 4, 1},
+	{942, 0, 2, 1},
+	{42390, 0, 3, 1},
+	{4571, 0, 2, 1},
+	{42396, 0, 3, 1},
+	{40476, 0, 4, 1},
+	{13594, 0, 4, 1},
+	{18492, 0, 10, 1},
+	{15, 0, 3, 1},
+	{33493, 0, 7, 1},
+	{37685, 0, 6, 1},
+	{11585, 0, 4, 1},
+	{3563, 0, 2, 1},
+	{8980, 0, 2, 1},
+	{137, 0, 2, 1},
+	{7811, 0, 3, 1},
+	{33528, 0, 7, 1},
+	{33535, 0, 7, 1},
+	{41846, 0, 4, 1},
+	{33549, 0, 7, 1},
+	{37703, 0, 6, 1},
+	{33556, 0, 7, 1},
+	{41854, 0, 4, 1},
+	{40590, 0, 5, 1},
+	{211, 0, 5, 1},
+	{592, 0, 2, 1},
+	{37709, 0, 6, 1},
+	{42399, 0, 3, 1},
+	{8414, 0, 2, 1},
+	{37715, 0, 6, 1},
+	{3503, 0, 2, 1},
+	{2797, 0, 2, 1},
+	{40605, 0, 5, 1},
+	{1624, 0, 2, 1},
+	{1004, 0, 2, 1},
+	{40610, 0, 5, 1},
+	{39443, 0, 5, 1},
+	{40630, 0, 5, 1},
+	{13333, 0, 3, 1},
+	{40635, 0, 5, 1},
+	{33612, 0, 7, 1},
+	{40640, 0, 5, 1},
+	{40645, 0, 5, 1},
+	{3932, 0, 4, 1},
+	{37811, 0, 6, 1},
+	{41874, 0, 4, 1},
+	{199, 0, 2, 1},
+	{7944, 0, 5, 1},
+	{33668, 0, 7, 1},
+	{28487, 0, 8, 1},
+	{2166, 0, 6, 1},
+	{8987, 0, 13, 1},
+	{2166, 0, 9, 1},
+	{2166, 0, 18, 1},
+	{33717, 0, 5, 1},
+	{42408, 0, 3, 1},
+	{643, 0, 2, 1},
+	{14795, 0, 4, 1},
+	{35527, 0, 3, 1},
+	{40655, 0, 5, 1},
+	{40670, 0, 5, 1},
+	{2443, 0, 2, 1},
+	{42411, 0, 3, 1},
+	{2946, 0, 2, 1},
+	{4750, 0, 2, 1},
+	{2091, 0, 2, 1},
+	{40685, 0, 5, 1},
+	{27589, 0, 3, 1},
+	{11531, 0, 2, 1},
+	{6692, 0, 2, 1},
+	{37931, 0, 6, 1},
+	{18602, 0, 10, 1},
+	{10228, 0, 3, 1},
+	{1696, 0, 3, 1},
+	{28021, 0, 3, 1},
+	{767, 0, 2, 1},
+	{3607, 0, 2, 1},
+	{8756, 0, 2, 1},
+	{114, 0, 2, 1},
+	{23161, 0, 9, 1},
+	{21317, 0, 4, 1},
+	{28655, 0, 8, 1},
+	{7540, 0, 2, 1},
+	{320, 0, 2, 1},
+	{40790, 0, 5, 1},
+	{28687, 0, 8, 1},
+	{28711, 0, 8, 1},
+	{11599, 0, 12, 1},
+	{12559, 0, 3, 1},
+	{3265, 0, 2, 1},
+	{97, 0, 2, 1},
+	{38045, 0, 6, 1},
+	{40795, 0, 5, 1},
+	{17537, 0, 3, 1},
+	{38051, 0, 6, 1},
+	{38057, 0, 6, 1},
+	{5401, 0, 3, 1},
+	{18692, 0, 3, 1},
+	{28727, 0, 6, 1},
+	{41938, 0, 4, 1},
+	{6955, 0, 6, 1},
+	{41942, 0, 4, 1},
+	{41946, 0, 4, 1},
+	{18702, 0, 10, 1},
+	{4193, 0, 2, 1},
+	{40800, 0, 5, 1},
+	{18712, 0, 10, 1},
+	{40810, 0, 5, 1},
+	{41954, 0, 4, 1},
+	{38075, 0, 6, 1},
+	{41958, 0, 4, 1},
+	{38081, 0, 6, 1},
+	{935, 0, 2, 1},
+	{38093, 0, 6, 1},
+	{40820, 0, 5, 1},
+	{33913, 0, 7, 1},
+	{38111, 0, 6, 1},
+	{30900, 0, 4, 1},
+	{33920, 0, 7, 1},
+	{5412, 0, 5, 1},
+	{33941, 0, 7, 1},
+	{7003, 0, 7, 1},
+	{7003, 0, 14, 1},
+	{38141, 0, 6, 1},
+	{40825, 0, 5, 1},
+	{123, 0, 7, 1},
+	{33969, 0, 7, 1},
+	{40830, 0, 5, 1},
+	{41966, 0, 4, 1},
+	{22687, 0, 2, 1},
+	{33990, 0, 7, 1},
+	{41970, 0, 4, 1},
+	{13112, 0, 4, 1},
+	{14777, 0, 11, 1},
+	{2021, 0, 3, 1},
+	{33997, 0, 7, 1},
+	{3394, 0, 4, 1},
+	{34004, 0, 7, 1},
+	{21885, 0, 3, 1},
+	{9130, 0, 13, 1},
+	{28839, 0, 8, 1},
+	{2947, 0, 4, 1},
+	{28847, 0, 5, 1},
+	{40840, 0, 5, 1},
+	{42444, 0, 3, 1},
+	{988, 0, 2, 1},
+	{42447, 0, 3, 1},
+	{42450, 0, 3, 1},
+	{42002, 0, 4, 1},
+	{40845, 0, 5, 1},
+	{34067, 0, 7, 1},
+	{38171, 0, 6, 1},
+	{42456, 0, 3, 1},
+	{14799, 0, 11, 1},
+	{14810, 0, 11, 1},
+	{14843, 0, 11, 1},
+	{14865, 0, 11, 1},
+	{18792, 0, 10, 1},
+	{14887, 0, 11, 1},
+	{14898, 0, 11, 1},
+	{11731, 0, 12, 1},
+	{14909, 0, 11, 1},
+	{18802, 0, 10, 1},
+	{14920, 0, 11, 1},
+	{11743, 0, 12, 1},
+	{14931, 0, 11, 1},
+	{18812, 0, 10, 1},
+	{11755, 0, 12, 1},
+	{18822, 0, 10, 1},
+	{7045, 0, 14, 1},
+	{14964, 0, 11, 1},
+	{18832, 0, 10, 1},
+	{3087, 0, 17, 1},
+	{18842, 0, 10, 1},
+	{15019, 0, 11, 1},
+	{7059, 0, 14, 1},
+	{11779, 0, 12, 1},
+	{15030, 0, 11, 1},
+	{7087, 0, 14, 1},
+	{11791, 0, 12, 1},
+	{18872, 0, 10, 1},
+	{11803, 0, 12, 1},
+	{18912, 0, 10, 1},
+	{28863, 0, 8, 1},
+	{23305, 0, 9, 1},
+	{18922, 0, 10, 1},
+	{18932, 0, 10, 1},
+	{15052, 0, 11, 1},
+	{7115, 0, 14, 1},
+	{3104, 0, 17, 1},
+	{23341, 0, 9, 1},
+	{18942, 0, 10, 1},
+	{15074, 0, 11, 1},
+	{9221, 0, 13, 1},
+	{18962, 0, 10, 1},
+	{543, 0, 22, 1},
+	{15085, 0, 11, 1},
+	{18972, 0, 10, 1},
+	{18982, 0, 10, 1},
+	{15107, 0, 11, 1},
+	{23359, 0, 9, 1},
+	{23368, 0, 9, 1},
+	{9247, 0, 13, 1},
+	{15118, 0, 11, 1},
+	{15162, 0, 11, 1},
+	{23377, 0, 9, 1},
+	{7199, 0, 14, 1},
+	{19012, 0, 10, 1},
+	{19022, 0, 10, 1},
+	{19032, 0, 10, 1},
+	{15173, 0, 11, 1},
+	{15184, 0, 11, 1},
+	{9286, 0, 13, 1},
+	{9299, 0, 13, 1},
+	{4092, 0, 16, 1},
+	{15195, 0, 11, 1},
+	{11947, 0, 12, 1},
+	{15206, 0, 11, 1},
+	{15217, 0, 11, 1},
+	{7213, 0, 14, 1},
+	{9325, 0, 11, 1},
+	{9325, 0, 13, 1},
+	{15250, 0, 11, 1},
+	{5562, 0, 15, 1},
+	{15261, 0, 11, 1},
+	{19082, 0, 10, 1},
+	{23413, 0, 9, 1},
+	{23422, 0, 9, 1},
+	{15283, 0, 11, 1},
+	{7241, 0, 14, 1},
+	{15294, 0, 11, 1},
+	{5577, 0, 15, 1},
+	{15327, 0, 11, 1},
+	{15338, 0, 11, 1},
+	{19132, 0, 10, 1},
+	{23440, 0, 9, 1},
+	{5652, 0, 15, 1},
+	{12055, 0, 12, 1},
+	{12067, 0, 12, 1},
+	{7339, 0, 14, 1},
+	{5667, 0, 15, 1},
+	{7353, 0, 14, 1},
+	{4236, 0, 16, 1},
+	{5682, 0, 15, 1},
+	{7367, 0, 14, 1},
+	{12079, 0, 12, 1},
+	{3172, 0, 17, 1},
+	{2418, 0, 18, 1},
+	{3189, 0, 17, 1},
+	{7381, 0, 14, 1},
+	{7395, 0, 11, 1},
+	{7395, 0, 14, 1},
+	{5697, 0, 15, 1},
+	{7409, 0, 14, 1},
+	{4252, 0, 16, 1},
+	{1764, 0, 19, 1},
+	{3206, 0, 17, 1},
+	{12091, 0, 12, 1},
+	{7423, 0, 14, 1},
+	{12103, 0, 12, 1},
+	{1783, 0, 19, 1},
+	{4268, 0, 16, 1},
+	{12115, 0, 12, 1},
+	{12127, 0, 12, 1},
+	{15382, 0, 11, 1},
+	{7437, 0, 14, 1},
+	{15393, 0, 11, 1},
+	{15404, 0, 11, 1},
+	{12139, 0, 12, 1},
+	{19152, 0, 10, 1},
+	{12163, 0, 12, 1},
+	{12175, 0, 12, 1},
+	{23449, 0, 9, 1},
+	{15459, 0, 11, 1},
+	{28879, 0, 8, 1},
+	{5712, 0, 9, 1},
+	{5712, 0, 15, 1},
+	{15481, 0, 11, 1},
+	{19162, 0, 10, 1},
+	{12187, 0, 12, 1},
+	{15514, 0, 11, 1},
+	{23467, 0, 9, 1},
+	{28887, 0, 8, 1},
+	{15525, 0, 11, 1},
+	{19182, 0, 10, 1},
+	{19192, 0, 10, 1},
+	{15547, 0, 11, 1},
+	{12199, 0, 12, 1},
+	{23476, 0, 9, 1},
+	{28895, 0, 8, 1},
+	{15580, 0, 11, 1},
+	{15591, 0, 11, 1},
+	{7535, 0, 14, 1},
+	{15613, 0, 11, 1},
+	{15624, 0, 11, 1},
+	{15635, 0, 11, 1},
+	{23503, 0, 9, 1},
+	{9624, 0, 13, 1},
+	{19252, 0, 10, 1},
+	{432, 0, 23, 1},
+	{316, 0, 24, 1},
+	{23521, 0, 9, 1},
+	{15712, 0, 11, 1},
+	{1287, 0, 20, 1},
+	{15723, 0, 11, 1},
+	{19262, 0, 10, 1},
+	{19272, 0, 10, 1},
+	{15745, 0, 11, 1},
+	{4316, 0, 16, 1},
+	{3291, 0, 17, 1},
+	{19282, 0, 10, 1},
+	{9689, 0, 13, 1},
+	{9702, 0, 13, 1},
+	{15778, 0, 11, 1},
+	{42459, 0, 3, 1},
+	{42462, 0, 3, 1},
+	{38189, 0, 6, 1},
+	{40860, 0, 5, 1},
+	{34088, 0, 7, 1},
+	{15789, 0, 6, 1},
+	{4328, 0, 2, 1},
+	{23575, 0, 9, 1},
+	{11475, 0, 4, 1},
+	{28943, 0, 8, 1},
+	{3785, 0, 3, 1},
+	{14792, 0, 7, 1},
+	{5254, 0, 2, 1},
+	{31226, 0, 3, 1},
+	{739, 0, 2, 0},
+	{38303, 0, 6, 1},
+	{32854, 0, 4, 1},
+	{42014, 0, 4, 1},
+	{42471, 0, 3, 1},
+	{18848, 0, 2, 1},
+	{9126, 0, 4, 1},
+	{34144, 0, 7, 1},
+	{42485, 0, 2, 1},
+	{19, 11, 3, 1},
+	{42123, 11, 3, 9},
+	{9778, 11, 3, 1},
+	{810, 11, 3, 1},
+	{6019, 11, 3, 1},
+	{2944, 11, 3, 1},
+	{6352, 11, 3, 1},
+	{27111, 12, 8, 9},
+	{5080, 18, 3, 1},
+	{35, 21, 2, 1},
+	{23967, 21, 8, 9},
+	{4, 21, 2, 1},
+	{810, 21, 3, 1},
+	{6019, 21, 3, 1},
+	{2944, 21, 3, 1},
+	{6352, 21, 3, 1},
+	{1512, 21, 3, 1},
+	{455, 23, 22, 1},
+	{1327, 23, 19, 1},
+	{19390, 23, 9, 1},
+	{23695, 23, 8, 1},
+	{19399, 23, 9, 1},
+	{34199, 23, 6, 1},
+	{3308, 23, 16, 1},
+	{1346, 23, 19, 1},
+	{23719, 23, 8, 1},
+	{29111, 23, 7, 1},
+	{29118, 23, 7, 1},
+	{15872, 23, 10, 1},
+	{19480, 23, 9, 1},
+	{19498, 23, 9, 1},
+	{788, 23, 11, 1},
+	{34367, 23, 6, 1},
+	{16022, 23, 10, 1},
+	{34529, 23, 6, 1},
+	{29291, 23, 3, 1},
+	{38610, 23, 5, 1},
+	{24159, 23, 8, 1},
+	{7856, 23, 13, 1},
+	{9907, 23, 12, 1},
+	{29657, 23, 7, 1},
+	{7882, 23, 13, 1},
+	{23699, 23, 4, 1},
+	{16352, 23, 10, 1},
+	{16362, 23, 10, 1},
+	{16372, 23, 10, 1},
+	{1358, 23, 7, 1},
+	{29881, 23, 7, 1},
+	{41102, 23, 4, 1},
+	{6703, 23, 6, 1},
+	{41126, 23, 4, 1},
+	{24575, 23, 8, 1},
+	{20191, 23, 9, 1},
+	{5429, 23, 6, 1},
+	{6645, 23, 8, 1},
+	{8051, 23, 13, 1},
+	{8094, 23, 9, 1},
+	{8836, 23, 8, 1},
+	{4355, 23, 7, 1},
+	{16652, 23, 10, 1},
+	{4896, 23, 6, 1},
+	{41230, 23, 4, 1},
+	{13439, 23, 7, 1},
+	{16772, 23, 10, 1},
+	{6443, 23, 14, 1},
+	{11702, 23, 5, 1},
+	{13435, 23, 11, 1},
+	{20650, 23, 9, 1},
+	{235, 23, 9, 1},
+	{17042, 23, 7, 1},
+	{17052, 23, 10, 1},
+	{31911, 23, 7, 1},
+	{6672, 23, 9, 1},
+	{26319, 23, 8, 1},
+	{13809, 23, 11, 1},
+	{21595, 23, 5, 1},
+	{17542, 23, 10, 1},
+	{21721, 23, 9, 1},
+	{17742, 23, 10, 1},
+	{14172, 23, 11, 1},
+	{14183, 23, 11, 1},
+	{778, 23, 21, 1},
+	{36959, 23, 5, 1},
+	{4357, 23, 5, 1},
+	{14249, 23, 10, 1},
+	{18052, 23, 10, 1},
+	{32919, 23, 7, 1},
+	{4358, 23, 3, 1},
+	{27503, 23, 8, 1},
+	{18092, 23, 10, 1},
+	{2584, 23, 6, 1},
+	{22387, 23, 9, 1},
+	{27735, 23, 8, 1},
+	{27871, 23, 4, 1},
+	{22666, 23, 9, 1},
+	{27935, 23, 8, 1},
+	{10428, 23, 7, 1},
+	{37829, 23, 6, 1},
+	{33668, 23, 7, 1},
+	{1100, 23, 7, 1},
+	{12946, 23, 5, 1},
+	{11695, 23, 12, 1},
+	{28847, 23, 5, 1},
+	{19, 25, 3, 1},
+	{9778, 25, 3, 1},
+	{810, 25, 3, 1},
+	{2944, 25, 3, 1},
+	{6352, 25, 3, 1},
+	{4, 28, 2, 1},
+	{19, 28, 3, 1},
+	{2944, 28, 3, 1},
+	{5080, 28, 3, 1},
+	{6352, 28, 3, 1},
+	{19, 31, 3, 1},
+	{2944, 31, 3, 1},
+	{7993, 31, 3, 1},
+	{6352, 31, 3, 1},
+	{15684, 31, 3, 9},
+	{23967, 37, 8, 9},
+	{19, 37, 3, 1},
+	{9778, 37, 3, 1},
+	{810, 37, 3, 1},
+	{6019, 37, 3, 1},
+	{2944, 37, 3, 1},
+	{6352, 37, 3, 1},
+	{23967, 46, 8, 9},
+	{4, 46, 2, 1},
+	{19, 46, 3, 1},
+	{29818, 46, 7, 1},
+	{25965, 46, 4, 9},
+	{2944, 46, 3, 1},
+	{41618, 46, 4, 9},
+	{6352, 46, 3, 1},
+	{10151, 46, 5, 9},
+	{4, 58, 2, 1},
+	{1023, 58, 2, 1},
+	{11610, 58, 2, 1},
+	{127, 58, 2, 1},
+	{573, 58, 2, 1},
+	{9846, 58, 2, 1},
+	{38495, 61, 5, 20},
+	{16122, 61, 10, 9},
+	{16282, 61, 5, 9},
+	{16282, 61, 10, 9},
+	{41122, 61, 4, 9},
+	{20047, 61, 9, 20},
+	{20137, 61, 9, 9},
+	{13127, 61, 11, 9},
+	{16390, 61, 4, 9},
+	{30301, 61, 7, 9},
+	{10111, 61, 6, 9},
+	{16832, 61, 6, 9},
+	{21487, 61, 9, 9},
+	{26479, 61, 8, 9},
+	{32387, 61, 7, 9},
+	{41606, 61, 4, 9},
+	{17792, 61, 10, 20},
+	{6807, 61, 14, 9},
+	{10975, 61, 12, 9},
+	{22144, 61, 9, 9},
+	{5988, 61, 3, 9},
+	{22684, 61, 9, 9},
+	{11431, 61, 9, 9},
+	{33486, 61, 7, 9},
+	{23107, 61, 9, 9},
+	{28703, 61, 6, 9},
+	{123, 61, 3, 9},
+	{40835, 61, 5, 9},
+	{10166, 65, 3, 1},
+	{19, 65, 3, 1},
+	{12918, 65, 4, 1},
+	{9778, 65, 3, 1},
+	{38533, 65, 3, 1},
+	{810, 65, 3, 1},
+	{2022, 65, 3, 1},
+	{6019, 65, 3, 1},
+	{36485, 65, 6, 1},
+	{2088, 65, 6, 1},
+	{2944, 65, 3, 1},
+	{6352, 65, 3, 1},
+	{37301, 65, 6, 1},
+	{1109, 65, 3, 1},
+	{41150, 70, 4, 1},
+	{31295, 70, 7, 1},
+	{42207, 70, 3, 1},
+	{27836, 70, 4, 1},
+	{3809, 70, 3, 1},
+	{17044, 70, 3, 1},
+	{810, 73, 3, 1},
+	{29776, 75, 7, 9},
+	{12533, 77, 11, 9},
+	{40934, 77, 4, 9},
+	{42018, 77, 3, 9},
+	{38320, 77, 5, 9},
+	{35, 77, 2, 1},
+	{38535, 77, 3, 9},
+	{4, 77, 2, 1},
+	{20398, 77, 9, 0},
+	{20416, 77, 9, 20},
+	{8129, 77, 13, 9},
+	{8142, 77, 13, 9},
+	{11610, 77, 2, 1},
+	{21606, 77, 4, 9},
+	{21442, 77, 9, 9},
+	{10819, 77, 12, 9},
+	{5, 77, 2, 1},
+	{27199, 77, 8, 0},
+	{220, 77, 4, 9},
+	{2800, 80, 3, 1},
+	{4746, 80, 3, 1},
+	{19, 80, 3, 1},
+	{13922, 80, 4, 1},
+	{9778, 80, 3, 1},
+	{810, 80, 3, 1},
+	{458, 80, 2, 1},
+	{21606, 80, 4, 1},
+	{2944, 80, 3, 1},
+	{42285, 80, 3, 1},
+	{50, 80, 2, 1},
+	{6352, 80, 3, 1},
+	{888, 80, 2, 1},
+	{42339, 80, 3, 1},
+	{506, 80, 2, 1},
+	{7977, 80, 3, 1},
+	{6102, 80, 3, 1},
+	{1758, 80, 2, 1},
+	{19, 90, 3, 1},
+	{328, 92, 2, 9},
+	{88, 92, 3, 9},
+	{27, 92, 2, 9},
+	{766, 92, 2, 9},
+	{1673, 92, 2, 9},
+	{1647, 92, 2, 9},
+	{767, 92, 2, 9},
+	{11069, 92, 2, 9},
+	{38535, 94, 3, 1},
+	{19, 94, 3, 1},
+	{9778, 94, 3, 1},
+	{810, 94, 3, 1},
+	{21606, 94, 4, 1},
+	{2022, 94, 3, 1},
+	{6019, 94, 3, 1},
+	{17722, 94, 4, 1},
+	{2944, 94, 3, 1},
+	{6352, 94, 3, 1},
+	{1404, 94, 2, 1},
+	{5042, 94, 3, 1},
+	{23967, 96, 8, 9},
+	{19, 96, 3, 1},
+	{9778, 96, 3, 1},
+	{810, 96, 3, 1},
+	{6019, 96, 3, 1},
+	{2944, 96, 3, 1},
+	{6352, 96, 3, 1},
+	{868, 96, 2, 9},
+	{19660, 110, 3, 9},
+	{738, 110, 2, 9},
+	{38535, 113, 3, 1},
+	{4, 113, 2, 1},
+	{19, 113, 3, 1},
+	{9778, 113, 3, 1},
+	{810, 113, 3, 1},
+	{21606, 113, 4, 1},
+	{2944, 113, 3, 1},
+	{6352, 113, 3, 1},
+	{10046, 113, 5, 1},
+	{2443, 113, 2, 1},
+	{15842, 120, 10, 9},
+	{35, 120, 2, 1},
+	{23967, 120, 8, 9},
+	{2022, 120, 18, 0},
+	{26039, 120, 8, 0},
+	{10819, 120, 12, 9},
+	{28495, 120, 8, 20},
+	{18742, 120, 10, 9},
+	{810, 129, 3, 1},
+	{552, 130, 1, 1},
+	{144, 130, 1, 1},
+	{33, 130, 1, 1},
+	{121, 130, 1, 1},
+	{1292, 130, 1, 1},
+	{1295, 130, 1, 1},
+	{429, 130, 1, 1},
+	{383, 130, 1, 1},
+	{1294, 130, 1, 1},
+	{34, 130, 1, 1},
+	{26, 130, 1, 1},
+	{125, 130, 1, 1},
+	{12676, 130, 5, 9},
+	{23967, 130, 8, 9},
+	{4, 130, 1, 1},
+	{48, 130, 1, 1},
+	{8, 130, 1, 1},
+	{61, 130, 1, 1},
+	{30, 130, 1, 1},
+	{31, 130, 1, 1},
+	{9, 130, 1, 1},
+	{593, 130, 1, 1},
+	{870, 130, 1, 1},
+	{17, 130, 1, 1},
+	{21, 130, 1, 1},
+	{1, 130, 1, 1},
+	{5, 130, 1, 1},
+	{67, 130, 1, 1},
+	{584, 130, 1, 1},
+	{6, 130, 1, 1},
+	{11, 130, 1, 1},
+	{15, 130, 1, 1},
+	{22, 130, 1, 1},
+	{97, 130, 1, 1},
+	{123, 130, 1, 1},
+	{0, 130, 1, 1},
+	{1120, 130, 1, 1},
+	{227, 130, 1, 1},
+	{19, 131, 3, 1},
+	{9778, 131, 3, 1},
+	{810, 131, 3, 1},
+	{2944, 131, 3, 1},
+	{6352, 131, 3, 1},
+	{4, 133, 2, 1},
+	{19, 133, 3, 1},
+	{9778, 133, 3, 1},
+	{5, 133, 2, 1},
+	{6352, 133, 3, 1},
+	{12555, 140, 11, 9},
+	{29776, 140, 7, 9},
+	{27672, 140, 7, 9},
+	{6317, 140, 6, 9},
+	{16662, 140, 10, 9},
+	{8199, 140, 8, 9},
+	{24791, 140, 8, 9},
+	{30371, 140, 7, 9},
+	{41378, 140, 4, 9},
+	{36383, 140, 6, 9},
+	{39680, 140, 5, 9},
+	{39820, 140, 5, 9},
+	{18867, 140, 3, 9},
+	{37283, 140, 6, 9},
+	{38147, 140, 6, 9},
+	{16546, 141, 6, 1},
+	{6442, 141, 4, 1},
+	{12621, 141, 11, 1},
+	{38425, 141, 5, 1},
+	{29293, 141, 7, 1},
+	{23967, 141, 8, 9},
+	{4, 141, 2, 1},
+	{19, 141, 3, 1},
+	{18, 141, 3, 1},
+	{24567, 141, 5, 1},
+	{9778, 141, 3, 1},
+	{21606, 141, 4, 1},
+	{31995, 141, 7, 1},
+	{39665, 141, 5, 1},
+	{2944, 141, 3, 1},
+	{6352, 141, 3, 1},
+	{2500, 141, 3, 1},
+	{18082, 141, 10, 1},
+	{20247, 141, 5, 1},
+	{33633, 141, 7, 1},
+	{18602, 141, 4, 1},
+	{19, 148, 3, 1},
+	{9778, 148, 3, 1},
+	{810, 148, 3, 1},
+	{2944, 148, 3, 1},
+	{6352, 148, 3, 1},
+	{4, 151, 2, 9},
+	{19, 151, 3, 1},
+	{9778, 151, 3, 1},
+	{810, 151, 3, 1},
+	{2944, 151, 3, 1},
+	{6352, 151, 3, 1},
+	{23687, 153, 8, 1},
+	{6442, 153, 4, 1},
+	{3776, 153, 4, 1},
+	{3492, 153, 4, 1},
+	{29461, 153, 7, 1},
+	{29727, 153, 7, 1},
+	{19, 153, 3, 1},
+	{12918, 153, 11, 1},
+	{16472, 153, 10, 1},
+	{29972, 153, 7, 1},
+	{24559, 153, 8, 1},
+	{24567, 153, 8, 1},
+	{9778, 153, 3, 1},
+	{30140, 153, 7, 1},
+	{38533, 153, 3, 1},
+	{25351, 153, 8, 1},
+	{20785, 153, 9, 1},
+	{21606, 153, 4, 1},
+	{2022, 153, 3, 1},
+	{26447, 153, 8, 1},
+	{6019, 153, 3, 1},
+	{17642, 153, 10, 1},
+	{36485, 153, 6, 1},
+	{1107, 153, 7, 1},
+	{2944, 153, 3, 1},
+	{36701, 153, 6, 1},
+	{27055, 153, 8, 1},
+	{6352, 153, 3, 1},
+	{36917, 153, 6, 1},
+	{8727, 153, 13, 1},
+	{27335, 153, 8, 1},
+	{14260, 153, 11, 1},
+	{37025, 153, 6, 1},
+	{32940, 153, 7, 1},
+	{40270, 153, 5, 1},
+	{18502, 153, 10, 1},
+	{40600, 153, 5, 1},
+	{18572, 153, 10, 1},
+	{2443, 153, 2, 1},
+	{123, 153, 3, 1},
+	{13112, 153, 4, 1},
+	{34157, 168, 6, 1},
+	{42024, 168, 3, 1},
+	{18034, 168, 3, 1},
+	{729, 168, 3, 1},
+	{6442, 168, 3, 1},
+	{31497, 168, 3, 1},
+	{969, 168, 2, 1},
+	{38390, 168, 5, 1},
+	{19561, 168, 9, 1},
+	{1403, 168, 3, 1},
+	{42027, 168, 3, 1},
+	{3749, 168, 3, 1},
+	{1003, 168, 3, 1},
+	{125, 168, 1, 1},
+	{29370, 168, 7, 1},
+	{38505, 168, 5, 1},
+	{42042, 168, 3, 1},
+	{16718, 168, 3, 1},
+	{41341, 168, 3, 1},
+	{3492, 168, 4, 1},
+	{42048, 168, 3, 1},
+	{23991, 168, 8, 1},
+	{38856, 168, 3, 1},
+	{7830, 168, 13, 1},
+	{24135, 168, 8, 1},
+	{34577, 168, 6, 1},
+	{42084, 168, 3, 1},
+	{42087, 168, 3, 1},
+	{42093, 168, 3, 1},
+	{19, 168, 3, 1},
+	{24327, 168, 8, 1},
+	{12918, 168, 4, 1},
+	{42099, 168, 3, 1},
+	{29909, 168, 3, 1},
+	{34703, 168, 6, 1},
+	{24359, 168, 8, 1},
+	{6240, 168, 3, 1},
+	{4115, 168, 3, 1},
+	{4149, 168, 3, 1},
+	{4572, 168, 3, 1},
+	{18503, 168, 3, 1},
+	{18, 168, 3, 1},
+	{9778, 168, 3, 1},
+	{4561, 168, 3, 1},
+	{42129, 168, 3, 1},
+	{782, 168, 3, 1},
+	{2097, 168, 3, 1},
+	{9960, 168, 3, 1},
+	{8400, 168, 3, 1},
+	{8090, 168, 3, 1},
+	{38875, 168, 5, 1},
+	{41214, 168, 4, 1},
+	{30336, 168, 7, 1},
+	{20844, 168, 2, 1},
+	{42147, 168, 3, 1},
+	{34991, 168, 6, 1},
+	{42150, 168, 3, 1},
+	{42156, 168, 3, 1},
+	{42162, 168, 3, 1},
+	{42174, 168, 3, 1},
+	{4767, 168, 3, 1},
+	{42180, 168, 3, 1},
+	{30952, 168, 7, 1},
+	{810, 168, 3, 1},
+	{11121, 168, 3, 1},
+	{19685, 168, 3, 1},
+	{477, 168, 3, 1},
+	{3522, 168, 3, 1},
+	{23877, 168, 3, 1},
+	{39290, 168, 5, 1},
+	{42216, 168, 3, 1},
+	{20965, 168, 9, 1},
+	{4084, 168, 3, 1},
+	{3669, 168, 3, 1},
+	{10287, 168, 3, 1},
+	{13763, 168, 3, 1},
+	{1231, 168, 3, 1},
+	{26263, 168, 8, 1},
+	{36077, 168, 6, 1},
+	{36083, 168, 6, 1},
+	{36113, 168, 6, 1},
+	{32086, 168, 7, 1},
+	{2669, 168, 3, 1},
+	{1498, 168, 3, 1},
+	{6019, 168, 3, 1},
+	{36419, 168, 6, 1},
+	{1960, 168, 2, 1},
+	{1121, 168, 3, 1},
+	{39765, 168, 5, 1},
+	{2944, 168, 3, 1},
+	{32457, 168, 7, 1},
+	{5080, 168, 3, 4},
+	{3759, 168, 3, 1},
+	{1360, 168, 3, 1},
+	{4850, 168, 3, 1},
+	{13400, 168, 3, 1},
+	{6352, 168, 3, 1},
+	{36857, 168, 6, 1},
+	{36899, 168, 6, 1},
+	{9412, 168, 3, 1},
+	{35115, 168, 3, 1},
+	{5042, 168, 3, 1},
+	{16190, 168, 3, 1},
+	{18694, 168, 3, 1},
+	{42321, 168, 3, 1},
+	{42342, 168, 3, 1},
+	{10151, 168, 5, 1},
+	{2808, 168, 3, 1},
+	{37085, 168, 6, 1},
+	{3558, 168, 3, 1},
+	{27511, 168, 8, 1},
+	{11143, 168, 3, 1},
+	{22297, 168, 9, 1},
+	{27519, 168, 8, 1},
+	{11239, 168, 8, 1},
+	{40275, 168, 5, 1},
+	{18142, 168, 10, 1},
+	{18152, 168, 10, 1},
+	{14370, 168, 11, 1},
+	{27615, 168, 8, 1},
+	{27041, 168, 3, 1},
+	{42363, 168, 3, 1},
+	{42369, 168, 3, 1},
+	{42372, 168, 3, 1},
+	{27959, 168, 8, 1},
+	{42384, 168, 3, 1},
+	{41838, 168, 4, 1},
+	{942, 168, 2, 1},
+	{9756, 168, 3, 1},
+	{5265, 168, 3, 1},
+	{137, 168, 3, 1},
+	{42402, 168, 3, 1},
+	{42405, 168, 3, 1},
+	{1109, 168, 3, 1},
+	{2443, 168, 2, 1},
+	{10337, 168, 3, 1},
+	{12559, 168, 3, 1},
+	{42429, 168, 3, 1},
+	{41950, 168, 4, 1},
+	{13112, 168, 4, 1},
+	{42474, 168, 3, 1},
+	{19, 175, 3, 1},
+	{9778, 175, 3, 1},
+	{810, 175, 3, 1},
+	{2944, 175, 3, 1},
+	{6352, 175, 3, 1},
+	{123, 175, 2, 9},
+	{19, 176, 3, 1},
+	{9778, 176, 3, 1},
+	{810, 176, 3, 1},
+	{2944, 176, 3, 1},
+	{6352, 176, 3, 1},
+	{20011, 178, 9, 9},
+	{4, 179, 2, 9},
+	{4, 183, 2, 1},
+	{6352, 183, 3, 1},
+	{19, 184, 3, 1},
+	{810, 184, 3, 1},
+	{21595, 184, 9, 9},
+	{6019, 184, 3, 1},
+	{32268, 184, 7, 9},
+	{1015, 184, 2, 1},
+	{19, 185, 3, 1},
+	{9778, 185, 3, 1},
+	{810, 185, 3, 1},
+	{42189, 185, 3, 9},
+	{2944, 185, 3, 1},
+	{6352, 185, 3, 1},
+	{739, 185, 2, 9},
+	{672, 187, 2, 1},
+	{38450, 187, 5, 20},
+	{12676, 187, 5, 9},
+	{1800, 187, 2, 1},
+	{23967, 187, 8, 9},
+	{4, 187, 2, 9},
+	{562, 187, 2, 1},
+	{4433, 187, 2, 1},
+	{10819, 187, 12, 9},
+	{881, 187, 2, 1},
+	{3523, 187, 2, 1},
+	{5838, 187, 2, 1},
+	{39820, 187, 5, 9},
+	{45, 187, 2, 1},
+	{50, 187, 2, 1},
+	{4954, 187, 2, 1},
+	{92, 187, 2, 1},
+	{481, 187, 2, 1},
+	{12203, 187, 2, 1},
+	{869, 187, 2, 1},
+	{5036, 187, 2, 1},
+	{41582, 207, 4, 0},
+	{29776, 218, 7, 9},
+	{42108, 218, 3, 9},
+	{8077, 218, 13, 9},
+	{20344, 218, 9, 9},
+	{13369, 218, 11, 9},
+	{26751, 218, 8, 9},
+	{22396, 218, 9, 9},
+	{40460, 218, 5, 0},
+	{37895, 218, 6, 9},
+	{810, 219, 3, 1},
+	{23967, 223, 8, 9},
+	{15842, 227, 10, 9},
+	{40934, 227, 4, 9},
+	{42018, 227, 3, 9},
+	{38320, 227, 5, 9},
+	{23967, 227, 8, 9},
+	{24424, 227, 7, 9},
+	{30287, 227, 7, 20},
+	{30350, 227, 4, 0},
+	{35177, 227, 6, 9},
+	{21442, 227, 9, 9},
+	{6709, 227, 14, 9},
+	{10819, 227, 12, 9},
+	{33332, 227, 7, 9},
+	{35, 238, 2, 1},
+	{788, 238, 4, 1},
+	{4, 238, 2, 1},
+	{19, 238, 3, 1},
+	{1023, 238, 2, 1},
+	{9778, 238, 3, 1},
+	{720, 238, 3, 9},
+	{810, 238, 2, 1},
+	{41266, 238, 4, 1},
+	{2022, 238, 3, 1},
+	{17714, 238, 2, 1},
+	{2944, 238, 3, 1},
+	{5838, 238, 2, 9},
+	{5, 238, 2, 1},
+	{6352, 238, 3, 1},
+	{37013, 238, 6, 1},
+	{5457, 238, 15, 1},
+	{34154, 247, 3, 2},
+	{23967, 248, 8, 9},
+	{4, 248, 2, 1},
+	{38533, 248, 3, 1},
+	{810, 248, 3, 1},
+	{6019, 248, 3, 1},
+	{29307, 255, 7, 0},
+	{12654, 255, 6, 20},
+	{34781, 255, 6, 9},
+	{20173, 255, 9, 9},
+	{30154, 255, 7, 0},
+	{25487, 255, 8, 0},
+	{10531, 255, 4, 9},
+	{17032, 255, 10, 0},
+	{25535, 255, 8, 9},
+	{31645, 255, 7, 9},
+	{26039, 255, 8, 9},
+	{6709, 255, 8, 9},
+	{13798, 255, 11, 20},
+	{17842, 255, 10, 20},
+	{42297, 255, 3, 9},
+	{22126, 255, 9, 9},
+	{27367, 255, 8, 9},
+	{32863, 255, 7, 9},
+	{32898, 255, 7, 0},
+	{42354, 255, 3, 0},
+	{18232, 255, 10, 20},
+	{33346, 255, 7, 20},
+	{14634, 255, 11, 9},
+	{11503, 255, 12, 0},
+	{40740, 255, 5, 9},
+	{18662, 255, 5, 9},
+	{23215, 255, 9, 9},
+	{12676, 256, 5, 9},
+	{29776, 256, 7, 9},
+	{10531, 256, 4, 9},
+	{4, 258, 2, 1},
+	{19, 258, 3, 1},
+	{810, 258, 3, 1},
+	{2944, 258, 3, 1},
+	{35, 259, 2, 1},
+	{2678, 259, 2, 1},
+	{7133, 259, 2, 1},
+	{16182, 259, 10, 9},
+	{19, 259, 3, 1},
+	{42329, 259, 2, 1},
+	{9778, 259, 3, 1},
+	{4083, 259, 2, 1},
+	{4787, 259, 2, 1},
+	{810, 259, 3, 1},
+	{3101, 259, 2, 1},
+	{1782, 259, 2, 1},
+	{9125, 259, 2, 1},
+	{599, 259, 2, 1},
+	{965, 259, 2, 1},
+	{138, 259, 2, 1},
+	{37, 259, 2, 1},
+	{1753, 259, 2, 1},
+	{874, 259, 2, 1},
+	{5521, 259, 2, 1},
+	{10327, 259, 12, 9},
+	{7245, 259, 2, 1},
+	{14563, 259, 2, 1},
+	{1763, 259, 2, 1},
+	{5034, 259, 2, 1},
+	{6019, 259, 3, 1},
+	{736, 259, 2, 1},
+	{2944, 259, 3, 1},
+	{101, 259, 2, 1},
+	{498, 259, 2, 1},
+	{6352, 259, 3, 1},
+	{42479, 259, 2, 1},
+	{11071, 259, 12, 0},
+	{1512, 259, 2, 1},
+	{208, 259, 2, 1},
+	{598, 259, 2, 1},
+	{1516, 259, 2, 1},
+	{4059, 259, 2, 1},
+	{592, 259, 2, 1},
+	{2946, 259, 2, 1},
+	{42481, 259, 2, 1},
+	{18832, 259, 10, 1},
+	{19082, 259, 10, 1},
+	{19172, 259, 10, 1},
+	{42483, 259, 2, 1},
+	{1228, 259, 2, 1},
+	{35584, 259, 2, 1},
+	{4056, 260, 4, 1},
+	{38615, 260, 5, 9},
+	{19, 260, 3, 1},
+	{42102, 260, 3, 9},
+	{9778, 260, 3, 1},
+	{3548, 260, 16, 9},
+	{24743, 260, 4, 1},
+	{810, 260, 3, 1},
+	{21606, 260, 4, 1},
+	{2022, 260, 3, 1},
+	{21388, 260, 9, 9},
+	{2093, 260, 6, 9},
+	{6019, 260, 3, 1},
+	{41574, 260, 4, 9},
+	{42264, 260, 3, 9},
+	{2944, 260, 3, 1},
+	{5080, 260, 3, 1},
+	{6352, 260, 3, 1},
+	{41658, 260, 4, 20},
+	{2808, 260, 3, 1},
+	{3558, 260, 4, 9},
+	{28063, 260, 8, 9},
+	{123, 260, 3, 1},
+	{11694, 262, 3, 20},
+	{34151, 266, 6, 9},
+	{40930, 266, 4, 20},
+	{38315, 266, 5, 9},
+	{15852, 266, 10, 9},
+	{18900, 266, 2, 9},
+	{7674, 266, 13, 9},
+	{16546, 266, 6, 9},
+	{7687, 266, 10, 9},
+	{7687, 266, 13, 9},
+	{15882, 266, 10, 9},
+	{2543, 266, 17, 9},
+	{19471, 266, 9, 0},
+	{15942, 266, 10, 9},
+	{23767, 266, 8, 9},
+	{23775, 266, 8, 9},
+	{6037, 266, 14, 9},
+	{1403, 266, 19, 9},
+	{29188, 266, 7, 9},
+	{639, 266, 2, 9},
+	{3356, 266, 16, 9},
+	{9811, 266, 12, 9},
+	{987, 266, 20, 9},
+	{29300, 266, 7, 9},
+	{6093, 266, 14, 9},
+	{12676, 266, 11, 9},
+	{12687, 266, 11, 9},
+	{16062, 266, 10, 9},
+	{29447, 266, 7, 9},
+	{23967, 266, 8, 9},
+	{23975, 266, 8, 9},
+	{29454, 266, 7, 9},
+	{12775, 266, 11, 9},
+	{34523, 266, 6, 9},
+	{29489, 266, 7, 9},
+	{750, 266, 2, 9},
+	{7804, 266, 13, 9},
+	{38590, 266, 5, 9},
+	{16182, 266, 10, 9},
+	{29629, 266, 7, 9},
+	{29643, 266, 7, 9},
+	{16272, 266, 10, 9},
+	{9955, 266, 12, 9},
+	{4482, 266, 15, 9},
+	{4497, 266, 15, 9},
+	{4512, 266, 15, 9},
+	{6219, 266, 2, 9},
+	{4, 266, 2, 9},
+	{16768, 266, 4, 0},
+	{24303, 266, 8, 9},
+	{9979, 266, 12, 20},
+	{16412, 266, 10, 9},
+	{16432, 266, 10, 0},
+	{16442, 266, 10, 9},
+	{16452, 266, 10, 9},
+	{24399, 266, 8, 9},
+	{38715, 266, 5, 9},
+	{24407, 266, 8, 9},
+	{24415, 266, 8, 9},
+	{24423, 266, 8, 9},
+	{24431, 266, 8, 9},
+	{48, 266, 2, 9},
+	{4572, 266, 15, 9},
+	{7947, 266, 13, 20},
+	{1914, 266, 18, 20},
+	{13006, 266, 11, 9},
+	{16482, 266, 10, 9},
+	{13017, 266, 11, 9},
+	{24487, 266, 8, 9},
+	{29986, 266, 7, 9},
+	{16492, 266, 10, 9},
+	{13028, 266, 11, 9},
+	{20083, 266, 9, 9},
+	{30021, 266, 7, 9},
+	{34811, 266, 6, 9},
+	{24527, 266, 8, 9},
+	{10015, 266, 12, 9},
+	{30042, 266, 7, 9},
+	{16522, 266, 10, 9},
+	{24543, 266, 8, 9},
+	{6317, 266, 14, 9},
+	{6331, 266, 14, 9},
+	{13050, 266, 11, 9},
+	{13061, 266, 11, 9},
+	{13072, 266, 11, 9},
+	{20119, 266, 9, 9},
+	{13083, 266, 11, 9},
+	{7986, 266, 13, 9},
+	{13094, 266, 11, 9},
+	{7999, 266, 13, 9},
+	{8012, 266, 13, 9},
+	{16532, 266, 10, 9},
+	{13105, 266, 11, 9},
+	{13116, 266, 11, 9},
+	{38785, 266, 5, 9},
+	{3452, 266, 16, 9},
+	{20200, 266, 9, 9},
+	{4647, 266, 15, 9},
+	{4662, 266, 15, 9},
+	{8064, 266, 13, 9},
+	{3484, 266, 16, 9},
+	{766, 266, 2, 9},
+	{24671, 266, 8, 0},
+	{24679, 266, 8, 9},
+	{13171, 266, 11, 9},
+	{3500, 266, 16, 9},
+	{6387, 266, 14, 9},
+	{38855, 266, 5, 0},
+	{13259, 266, 11, 9},
+	{3532, 266, 16, 9},
+	{38895, 266, 5, 9},
+	{13292, 266, 11, 9},
+	{10111, 266, 12, 9},
+	{16682, 266, 10, 9},
+	{20308, 266, 9, 9},
+	{24815, 266, 8, 9},
+	{30420, 266, 7, 9},
+	{30427, 266, 7, 9},
+	{30434, 266, 7, 9},
+	{30448, 266, 7, 9},
+	{30462, 266, 7, 9},
+	{30469, 266, 7, 9},
+	{30476, 266, 7, 9},
+	{30483, 266, 7, 9},
+	{30490, 266, 7, 9},
+	{30497, 266, 7, 9},
+	{30504, 266, 7, 9},
+	{30511, 266, 7, 9},
+	{30518, 266, 7, 9},
+	{30525, 266, 7, 9},
+	{30532, 266, 7, 9},
+	{30539, 266, 7, 9},
+	{30553, 266, 7, 9},
+	{30560, 266, 7, 9},
+	{30574, 266, 7, 9},
+	{30581, 266, 7, 9},
+	{30588, 266, 7, 9},
+	{30595, 266, 7, 9},
+	{30602, 266, 7, 9},
+	{30609, 266, 7, 9},
+	{30616, 266, 7, 9},
+	{30623, 266, 7, 9},
+	{30630, 266, 7, 9},
+	{30637, 266, 7, 9},
+	{30644, 266, 7, 9},
+	{30651, 266, 7, 9},
+	{30665, 266, 7, 9},
+	{30672, 266, 7, 9},
+	{30679, 266, 7, 9},
+	{30686, 266, 7, 9},
+	{30693, 266, 7, 9},
+	{30700, 266, 7, 9},
+	{30707, 266, 7, 9},
+	{30714, 266, 7, 9},
+	{30721, 266, 7, 9},
+	{30728, 266, 7, 9},
+	{30735, 266, 7, 9},
+	{30742, 266, 7, 9},
+	{30749, 266, 7, 9},
+	{30756, 266, 7, 9},
+	{30763, 266, 7, 9},
+	{30770, 266, 7, 9},
+	{30777, 266, 7, 9},
+	{16732, 266, 10, 9},
+	{24967, 266, 8, 9},
+	{10135, 266, 12, 9},
+	{30875, 266, 7, 9},
+	{38985, 266, 5, 9},
+	{2628, 266, 17, 9},
+	{35135, 266, 6, 9},
+	{16752, 266, 10, 9},
+	{16762, 266, 10, 9},
+	{35177, 266, 6, 9},
+	{13391, 266, 11, 9},
+	{2757, 266, 2, 9},
+	{2645, 266, 17, 9},
+	{20587, 266, 9, 9},
+	{20596, 266, 9, 9},
+	{35357, 266, 6, 9},
+	{1753, 266, 2, 9},
+	{16892, 266, 10, 9},
+	{20677, 266, 9, 9},
+	{4857, 266, 15, 9},
+	{6513, 266, 14, 9},
+	{25263, 266, 8, 9},
+	{1986, 266, 18, 0},
+	{25311, 266, 8, 9},
+	{31197, 266, 7, 0},
+	{4887, 266, 15, 9},
+	{1300, 266, 2, 9},
+	{20749, 266, 9, 9},
+	{20758, 266, 9, 0},
+	{10291, 266, 9, 9},
+	{10291, 266, 12, 9},
+	{6541, 266, 14, 9},
+	{10363, 266, 12, 9},
+	{4902, 266, 15, 9},
+	{6569, 266, 14, 9},
+	{10375, 266, 12, 9},
+	{20812, 266, 9, 9},
+	{2730, 266, 17, 9},
+	{25383, 266, 8, 9},
+	{2040, 266, 18, 9},
+	{8298, 266, 13, 9},
+	{8311, 266, 13, 9},
+	{13523, 266, 11, 9},
+	{715, 266, 21, 9},
+	{20821, 266, 9, 9},
+	{16982, 266, 10, 9},
+	{20830, 266, 9, 9},
+	{3692, 266, 16, 9},
+	{13534, 266, 11, 9},
+	{4932, 266, 15, 9},
+	{13556, 266, 11, 9},
+	{10387, 266, 12, 9},
+	{3708, 266, 16, 9},
+	{16992, 266, 10, 9},
+	{8324, 266, 13, 9},
+	{6597, 266, 14, 9},
+	{17002, 266, 10, 9},
+	{10399, 266, 12, 9},
+	{1087, 266, 20, 9},
+	{2747, 266, 17, 9},
+	{13567, 266, 11, 9},
+	{4962, 266, 15, 9},
+	{8337, 266, 13, 9},
+	{6611, 266, 14, 9},
+	{10423, 266, 12, 9},
+	{10435, 266, 12, 9},
+	{13589, 266, 11, 9},
+	{6625, 266, 14, 9},
+	{3724, 266, 16, 9},
+	{13600, 266, 11, 9},
+	{8350, 266, 13, 9},
+	{4977, 266, 15, 9},
+	{10447, 266, 12, 9},
+	{6639, 266, 14, 9},
+	{2764, 266, 17, 9},
+	{10459, 266, 12, 9},
+	{31337, 266, 7, 9},
+	{8363, 266, 13, 9},
+	{10471, 266, 12, 9},
+	{3740, 266, 16, 9},
+	{8376, 266, 13, 9},
+	{31344, 266, 7, 9},
+	{3756, 266, 16, 9},
+	{25407, 266, 8, 9},
+	{13611, 266, 11, 9},
+	{4992, 266, 15, 9},
+	{25415, 266, 8, 9},
+	{8402, 266, 13, 9},
+	{3772, 266, 16, 9},
+	{127, 266, 2, 9},
+	{20920, 266, 9, 9},
+	{25487, 266, 8, 0},
+	{35591, 266, 6, 0},
+	{42234, 266, 3, 9},
+	{21073, 266, 9, 9},
+	{21145, 266, 9, 9},
+	{39415, 266, 5, 9},
+	{1749, 266, 2, 9},
+	{26015, 266, 8, 9},
+	{21424, 266, 9, 9},
+	{17342, 266, 10, 9},
+	{2781, 266, 6, 0},
+	{8480, 266, 13, 20},
+	{2781, 266, 17, 0},
+	{41498, 266, 4, 0},
+	{36017, 266, 6, 9},
+	{17382, 266, 10, 9},
+	{8493, 266, 13, 9},
+	{13831, 266, 11, 0},
+	{26423, 266, 8, 9},
+	{13842, 266, 11, 9},
+	{21631, 266, 9, 9},
+	{21886, 266, 3, 9},
+	{17592, 266, 10, 9},
+	{2798, 266, 17, 9},
+	{21811, 266, 9, 9},
+	{32275, 266, 7, 9},
+	{26711, 266, 8, 9},
+	{32282, 266, 7, 9},
+	{26727, 266, 8, 9},
+	{2549, 266, 11, 9},
+	{3804, 266, 16, 9},
+	{10807, 266, 12, 9},
+	{21838, 266, 9, 9},
+	{10819, 266, 12, 9},
+	{32303, 266, 7, 9},
+	{8597, 266, 13, 0},
+	{26759, 266, 8, 9},
+	{39705, 266, 5, 9},
+	{26911, 266, 8, 9},
+	{17752, 266, 10, 9},
+	{32415, 266, 7, 9},
+	{134, 266, 2, 9},
+	{14051, 266, 11, 0},
+	{757, 266, 21, 0},
+	{17832, 266, 10, 9},
+	{22027, 266, 9, 9},
+	{27167, 266, 8, 9},
+	{22036, 266, 9, 9},
+	{39935, 266, 5, 9},
+	{17872, 266, 10, 9},
+	{32681, 266, 7, 9},
+	{5157, 266, 15, 9},
+	{14150, 266, 11, 9},
+	{10987, 266, 12, 9},
+	{2094, 266, 18, 9},
+	{36887, 266, 6, 9},
+	{27239, 266, 8, 20},
+	{40055, 266, 5, 9},
+	{27295, 266, 8, 9},
+	{14227, 266, 11, 9},
+	{2832, 266, 17, 9},
+	{32786, 266, 7, 9},
+	{17952, 266, 10, 9},
+	{11023, 266, 12, 9},
+	{40095, 266, 5, 0},
+	{11059, 266, 12, 9},
+	{6835, 266, 14, 9},
+	{42333, 266, 3, 9},
+	{37043, 266, 6, 9},
+	{12203, 266, 2, 9},
+	{14282, 266, 11, 9},
+	{18012, 266, 10, 9},
+	{11083, 266, 12, 20},
+	{27415, 266, 8, 9},
+	{27479, 266, 8, 9},
+	{27169, 266, 6, 0},
+	{32926, 266, 7, 9},
+	{6863, 266, 14, 9},
+	{32954, 266, 7, 9},
+	{39, 266, 2, 9},
+	{506, 266, 2, 9},
+	{3916, 266, 16, 9},
+	{33115, 266, 7, 9},
+	{5247, 266, 15, 9},
+	{37283, 266, 6, 9},
+	{6919, 266, 14, 9},
+	{14425, 266, 11, 9},
+	{27695, 266, 8, 9},
+	{22414, 266, 9, 9},
+	{2148, 266, 18, 9},
+	{8831, 266, 13, 9},
+	{27703, 266, 8, 9},
+	{22432, 266, 9, 9},
+	{8844, 266, 13, 9},
+	{22441, 266, 9, 9},
+	{14436, 266, 11, 9},
+	{27711, 266, 8, 9},
+	{27719, 266, 8, 9},
+	{27727, 266, 8, 9},
+	{22450, 266, 9, 9},
+	{18242, 266, 10, 9},
+	{11323, 266, 12, 9},
+	{18312, 266, 10, 9},
+	{33255, 266, 7, 9},
+	{18332, 266, 10, 9},
+	{18342, 266, 10, 9},
+	{18695, 266, 7, 9},
+	{18352, 266, 10, 9},
+	{27919, 266, 8, 9},
+	{8935, 266, 13, 9},
+	{2934, 266, 17, 9},
+	{37451, 266, 6, 0},
+	{11431, 266, 12, 9},
+	{14535, 266, 11, 9},
+	{18482, 266, 10, 0},
+	{11467, 266, 12, 9},
+	{28351, 266, 8, 9},
+	{22954, 266, 9, 9},
+	{8961, 266, 13, 9},
+	{3932, 266, 16, 9},
+	{11515, 266, 12, 9},
+	{9000, 266, 13, 9},
+	{5367, 266, 15, 9},
+	{28551, 266, 8, 0},
+	{6692, 266, 2, 9},
+	{9013, 266, 13, 9},
+	{767, 266, 2, 9},
+	{3607, 266, 2, 9},
+	{18692, 266, 10, 9},
+	{11659, 266, 12, 20},
+	{18722, 266, 10, 0},
+	{18732, 266, 10, 9},
+	{28815, 266, 8, 0},
+	{18762, 266, 10, 9},
+	{14788, 266, 11, 9},
+	{34011, 266, 7, 9},
+	{11683, 266, 12, 9},
+	{11707, 266, 12, 9},
+	{18782, 266, 10, 9},
+	{5427, 266, 15, 9},
+	{11719, 266, 12, 9},
+	{34046, 266, 7, 9},
+	{7031, 266, 14, 9},
+	{40850, 266, 5, 9},
+	{28959, 266, 8, 9},
+	{739, 266, 2, 9},
+	{32289, 269, 7, 9},
+	{5146, 269, 3, 9},
+	{32863, 269, 7, 9},
+	{48, 281, 2, 9},
+	{20173, 281, 9, 9},
+	{35, 289, 2, 1},
+	{4, 289, 2, 1},
+	{1023, 289, 2, 1},
+	{720, 289, 2, 1},
+	{810, 289, 2, 1},
+	{5, 289, 2, 1},
+	{506, 289, 2, 1},
+	{19, 298, 3, 1},
+	{9778, 298, 3, 1},
+	{810, 298, 3, 1},
+	{3522, 298, 3, 1},
+	{2944, 298, 3, 1},
+	{6352, 298, 3, 1},
+	{23967, 300, 8, 9},
+	{19, 300, 3, 1},
+	{9778, 300, 3, 1},
+	{2022, 300, 3, 1},
+	{6156, 300, 4, 1},
+	{6352, 300, 3, 1},
+	{19, 301, 3, 1},
+	{9778, 301, 3, 1},
+	{2944, 301, 3, 1},
+	{6352, 301, 3, 1},
+	{7005, 302, 3, 9},
+	{810, 302, 3, 1},
+	{21606, 302, 4, 9},
+	{35, 303, 2, 1},
+	{38535, 303, 3, 1},
+	{19, 303, 3, 1},
+	{30119, 303, 7, 1},
+	{810, 303, 3, 1},
+	{33033, 303, 3, 1},
+	{6019, 303, 3, 1},
+	{2944, 303, 3, 1},
+	{6352, 303, 3, 1},
+	{4357, 303, 5, 1},
+	{5042, 303, 3, 1},
+	{2797, 303, 2, 1},
+	{23967, 306, 8, 9},
+	{4, 306, 2, 9},
+	{3118, 306, 2, 9},
+	{13853, 306, 11, 0},
+	{21, 306, 4, 0},
+	{26603, 306, 5, 9},
+	{12533, 317, 11, 9},
+	{40934, 317, 4, 9},
+	{42018, 317, 3, 9},
+	{38320, 317, 5, 9},
+	{12676, 317, 5, 9},
+	{23967, 317, 8, 9},
+	{29489, 317, 7, 9},
+	{19, 317, 3, 9},
+	{7921, 317, 13, 9},
+	{29867, 317, 7, 0},
+	{34745, 317, 6, 9},
+	{38720, 317, 5, 9},
+	{1932, 317, 18, 9},
+	{29993, 317, 7, 9},
+	{16502, 317, 10, 9},
+	{24519, 317, 8, 9},
+	{30035, 317, 7, 9},
+	{16512, 317, 10, 9},
+	{24535, 317, 8, 9},
+	{30056, 317, 7, 9},
+	{4587, 317, 15, 9},
+	{30063, 317, 7, 9},
+	{34859, 317, 6, 9},
+	{3532, 317, 16, 9},
+	{35015, 317, 6, 20},
+	{4737, 317, 15, 9},
+	{20470, 317, 9, 9},
+	{36019, 317, 4, 9},
+	{6499, 317, 14, 9},
+	{10255, 317, 12, 0},
+	{20767, 317, 9, 9},
+	{35501, 317, 6, 9},
+	{20776, 317, 9, 9},
+	{35507, 317, 6, 9},
+	{35513, 317, 6, 9},
+	{10351, 317, 12, 9},
+	{13633, 317, 11, 9},
+	{17022, 317, 10, 9},
+	{31400, 317, 7, 9},
+	{17182, 317, 10, 9},
+	{21352, 317, 9, 9},
+	{10699, 317, 12, 9},
+	{17322, 317, 10, 9},
+	{17332, 317, 10, 9},
+	{21442, 317, 9, 9},
+	{36017, 317, 6, 9},
+	{17522, 317, 10, 9},
+	{17532, 317, 10, 9},
+	{17652, 317, 10, 9},
+	{21802, 317, 9, 9},
+	{26703, 317, 8, 9},
+	{36491, 317, 6, 9},
+	{8584, 317, 13, 9},
+	{10819, 317, 12, 9},
+	{6877, 317, 14, 9},
+	{14414, 317, 11, 9},
+	{40465, 317, 5, 9},
+	{11383, 317, 12, 0},
+	{33332, 317, 7, 9},
+	{22855, 317, 9, 9},
+	{33430, 317, 7, 9},
+	{1227, 317, 20, 9},
+	{14568, 317, 11, 9},
+	{18422, 317, 10, 9},
+	{18522, 317, 10, 9},
+	{8974, 317, 13, 9},
+	{23116, 317, 9, 20},
+	{11635, 317, 12, 9},
+	{14722, 317, 11, 9},
+	{340, 317, 23, 9},
+	{904, 317, 21, 9},
+	{27701, 330, 3, 9},
+	{23831, 331, 8, 9},
+	{41106, 331, 4, 9},
+	{9991, 331, 4, 9},
+	{9991, 331, 12, 9},
+	{41122, 331, 4, 9},
+	{10063, 331, 3, 9},
+	{3541, 331, 7, 20},
+	{8168, 331, 13, 9},
+	{13633, 331, 5, 9},
+	{11653, 331, 3, 20},
+	{26215, 331, 8, 20},
+	{21460, 331, 9, 0},
+	{21487, 331, 9, 9},
+	{21595, 331, 9, 9},
+	{2094, 331, 5, 9},
+	{14227, 331, 11, 9},
+	{41008, 331, 2, 9},
+	{14447, 331, 11, 9},
+	{14513, 331, 3, 20},
+	{28023, 331, 8, 20},
+	{28703, 331, 6, 9},
+	{33948, 331, 7, 20},
+	{34039, 331, 7, 9},
+	{19993, 335, 9, 9},
+	{7661, 343, 13, 9},
+	{38535, 343, 3, 9},
+	{23967, 343, 8, 9},
+	{4, 343, 2, 9},
+	{24743, 343, 4, 9},
+	{10819, 343, 12, 9},
+	{5172, 343, 3, 9},
+	{10046, 343, 5, 9},
+	{19, 344, 3, 1},
+	{9778, 344, 3, 1},
+	{810, 344, 3, 1},
+	{2944, 344, 3, 1},
+	{6352, 344, 3, 1},
+	{3749, 346, 3, 1},
+	{19, 346, 3, 1},
+	{9778, 346, 3, 1},
+	{38533, 346, 3, 1},
+	{810, 346, 3, 1},
+	{6019, 346, 3, 1},
+	{2944, 346, 3, 1},
+	{6352, 346, 3, 1},
+	{42366, 346, 3, 1},
+	{123, 346, 3, 1},
+	{3749, 361, 3, 1},
+	{788, 361, 4, 1},
+	{19, 361, 3, 1},
+	{9778, 361, 3, 1},
+	{810, 361, 3, 1},
+	{2944, 361, 3, 1},
+	{6352, 361, 3, 1},
+	{9733, 361, 3, 1},
+	{790, 361, 3, 1},
+	{2797, 361, 2, 1},
+	{19997, 362, 5, 20},
+	{13263, 364, 4, 9},
+	{19, 364, 3, 1},
+	{9778, 364, 3, 1},
+	{720, 364, 3, 1},
+	{38533, 364, 3, 1},
+	{810, 364, 3, 1},
+	{21606, 364, 4, 1},
+	{42237, 364, 3, 1},
+	{1498, 364, 3, 1},
+	{6019, 364, 3, 1},
+	{2944, 364, 3, 1},
+	{27111, 364, 8, 9},
+	{6352, 364, 3, 1},
+	{5042, 364, 3, 1},
+	{3810, 367, 3, 0},
+	{4, 368, 2, 9},
+	{31329, 369, 3, 1},
+	{19, 369, 3, 1},
+	{9778, 369, 3, 1},
+	{3768, 369, 3, 1},
+	{810, 369, 3, 1},
+	{3713, 369, 3, 1},
+	{1498, 369, 3, 1},
+	{6352, 369, 3, 1},
+	{220, 369, 3, 1},
+	{41714, 369, 4, 1},
+	{19, 370, 3, 1},
+	{9778, 370, 3, 1},
+	{9012, 370, 3, 1},
+	{810, 370, 3, 1},
+	{6019, 370, 3, 1},
+	{17722, 370, 4, 1},
+	{2944, 370, 3, 1},
+	{6352, 370, 3, 1},
+	{2112, 370, 3, 1},
+	{23647, 382, 8, 9},
+	{19, 382, 3, 1},
+	{9778, 382, 3, 1},
+	{38533, 382, 3, 1},
+	{10819, 382, 12, 9},
+	{5080, 382, 3, 1},
+	{6352, 382, 3, 1},
+	{4542, 384, 7, 20},
+	{38535, 385, 3, 1},
+	{19, 385, 3, 1},
+	{9778, 385, 3, 1},
+	{810, 385, 3, 1},
+	{21606, 385, 4, 1},
+	{17722, 385, 4, 1},
+	{2944, 385, 3, 1},
+	{6352, 385, 3, 1},
+	{7687, 387, 10, 9},
+	{12676, 387, 5, 9},
+	{29776, 387, 7, 9},
+	{1236, 387, 11, 9},
+	{34805, 387, 6, 0},
+	{41566, 387, 4, 9},
+	{40465, 387, 5, 9},
+	{28495, 387, 8, 20},
+	{9117, 387, 13, 9},
+	{40030, 389, 5, 0},
+	{4, 390, 2, 9},
+	{35819, 390, 6, 9},
+	{34522, 399, 3, 9},
+	{40480, 403, 5, 9},
+	{12522, 411, 11, 9},
+	{20708, 411, 5, 1},
+	{23967, 411, 8, 9},
+	{7895, 411, 13, 0},
+	{16422, 411, 10, 0},
+	{3392, 411, 2, 9},
+	{10570, 411, 3, 9},
+	{39325, 411, 5, 9},
+	{10819, 411, 12, 9},
+	{5502, 411, 15, 9},
+	{4, 418, 2, 9},
+	{35, 426, 2, 1},
+	{38535, 426, 3, 1},
+	{19, 426, 3, 1},
+	{810, 426, 3, 1},
+	{21606, 426, 4, 1},
+	{6019, 426, 3, 1},
+	{17722, 426, 4, 1},
+	{2944, 426, 3, 1},
+	{6352, 426, 3, 1},
+	{5042, 426, 3, 1},
+	{19, 434, 3, 1},
+	{9778, 434, 3, 1},
+	{2944, 434, 3, 1},
+	{6352, 434, 3, 1},
+	{10151, 434, 5, 9},
+	{767, 434, 4, 20},
+	{15832, 446, 10, 9},
+	{23703, 446, 8, 1},
+	{788, 446, 4, 1},
+	{29293, 446, 6, 1},
+	{34379, 446, 6, 1},
+	{23967, 446, 8, 9},
+	{456, 446, 3, 1},
+	{19912, 446, 9, 1},
+	{36, 446, 21, 1},
+	{36, 446, 31, 9},
+	{19, 446, 3, 1},
+	{29958, 446, 7, 9},
+	{30147, 446, 7, 9},
+	{1950, 446, 18, 1},
+	{34943, 446, 6, 9},
+	{38860, 446, 5, 9},
+	{16682, 446, 10, 9},
+	{20308, 446, 9, 9},
+	{4767, 446, 15, 1},
+	{30994, 446, 7, 9},
+	{41266, 446, 4, 1},
+	{39055, 446, 5, 1},
+	{3660, 446, 16, 1},
+	{32142, 446, 7, 1},
+	{10819, 446, 12, 9},
+	{5080, 446, 3, 1},
+	{27047, 446, 8, 1},
+	{36809, 446, 6, 9},
+	{14194, 446, 10, 1},
+	{5464, 446, 4, 1},
+	{42318, 446, 3, 1},
+	{2797, 446, 2, 1},
+	{14711, 446, 11, 1},
+	{42465, 446, 3, 9},
+	{9778, 472, 3, 1},
+	{810, 472, 3, 1},
+	{41086, 473, 4, 9},
+	{19, 474, 3, 1},
+	{9778, 474, 3, 1},
+	{810, 474, 3, 1},
+	{6019, 474, 3, 1},
+	{2944, 474, 3, 1},
+	{6352, 474, 3, 1},
+	{42324, 474, 3, 1},
+	{4, 480, 2, 1},
+	{34197, 480, 3, 9},
+	{41390, 480, 4, 9},
+	{2944, 480, 3, 1},
+	{6352, 480, 3, 1},
+	{2725, 480, 5, 9},
+	{19, 482, 3, 1},
+	{9778, 482, 3, 1},
+	{810, 482, 3, 1},
+	{6019, 482, 3, 1},
+	{6352, 482, 3, 1},
+	{19, 483, 3, 1},
+	{9778, 483, 3, 1},
+	{810, 483, 3, 1},
+	{33033, 483, 3, 1},
+	{12825, 483, 3, 1},
+	{6352, 483, 3, 1},
+	{38535, 488, 3, 9},
+	{4, 488, 2, 1},
+	{19, 488, 3, 1},
+	{9778, 488, 3, 1},
+	{2944, 488, 3, 1},
+	{6352, 488, 3, 1},
+	{15201, 488, 2, 9},
+	{35, 498, 2, 1},
+	{19, 498, 3, 1},
+	{9778, 498, 3, 1},
+	{810, 498, 3, 1},
+	{2944, 498, 3, 1},
+	{6352, 498, 3, 1},
+	{2555, 505, 5, 9},
+	{18562, 505, 9, 9},
+	{767, 505, 11, 20},
+	{1403, 510, 3, 9},
+	{788, 510, 4, 1},
+	{19, 510, 3, 1},
+	{9778, 510, 3, 1},
+	{2103, 510, 4, 1},
+	{2944, 510, 3, 1},
+	{6352, 510, 3, 1},
+	{23967, 512, 8, 9},
+	{19, 512, 3, 1},
+	{9778, 512, 3, 1},
+	{810, 512, 3, 1},
+	{2944, 512, 3, 1},
+	{6352, 512, 3, 1},
+	{18342, 512, 10, 9},
+	{20056, 519, 9, 9},
+	{3492, 521, 4, 9},
+	{19, 521, 3, 1},
+	{48, 521, 2, 9},
+	{9778, 521, 3, 1},
+	{38533, 521, 3, 1},
+	{477, 521, 3, 1},
+	{6019, 521, 3, 1},
+	{2944, 521, 3, 1},
+	{6352, 521, 3, 1},
+	{1004, 521, 2, 9},
+	{19, 522, 3, 1},
+	{9778, 522, 3, 1},
+	{810, 522, 3, 1},
+	{41286, 522, 4, 1},
+	{21606, 522, 4, 1},
+	{2944, 522, 3, 1},
+	{6352, 522, 3, 1},
+	{123, 522, 3, 1},
+	{328, 530, 2, 9},
+	{4, 530, 2, 1},
+	{19, 530, 3, 1},
+	{9778, 530, 3, 1},
+	{810, 530, 3, 1},
+	{2944, 530, 3, 1},
+	{6352, 530, 3, 1},
+	{11944, 538, 3, 9},
+	{23967, 549, 8, 9},
+	{19, 549, 3, 1},
+	{9778, 549, 3, 1},
+	{810, 549, 3, 1},
+	{42204, 549, 3, 1},
+	{12839, 549, 3, 9},
+	{33033, 549, 3, 9},
+	{2944, 549, 3, 1},
+	{6352, 549, 3, 1},
+	{37259, 549, 6, 9},
+	{18832, 549, 10, 1},
+	{23350, 549, 9, 1},
+	{15228, 549, 11, 1},
+	{19052, 549, 10, 1},
+	{19082, 549, 10, 1},
+	{15349, 549, 11, 1},
+	{19142, 549, 10, 1},
+	{19152, 549, 10, 1},
+	{19172, 549, 10, 1},
+	{15503, 549, 11, 1},
+	{23512, 549, 9, 1},
+	{19232, 549, 10, 1},
+	{15657, 549, 11, 1},
+	{15734, 549, 11, 1},
+	{19292, 549, 10, 1},
+	{456, 552, 2, 9},
+	{19, 552, 3, 1},
+	{9778, 552, 3, 1},
+	{38533, 552, 3, 1},
+	{6019, 552, 3, 1},
+	{2944, 552, 3, 1},
+	{6352, 552, 3, 1},
+	{12896, 563, 11, 9},
+	{20137, 563, 9, 9},
+	{6387, 563, 7, 9},
+	{24823, 563, 8, 9},
+	{8849, 563, 4, 9},
+	{10531, 563, 4, 9},
+	{26535, 563, 8, 9},
+	{36503, 563, 6, 9},
+	{2554, 563, 6, 9},
+	{33500, 563, 7, 9},
+	{34053, 563, 7, 9},
+	{22045, 564, 9, 9},
+	{23967, 571, 8, 9},
+	{19, 571, 3, 1},
+	{13068, 571, 4, 9},
+	{30420, 571, 4, 1},
+	{226, 571, 2, 1},
+	{17722, 571, 4, 1},
+	{38340, 573, 5, 1},
+	{3749, 573, 3, 1},
+	{788, 573, 4, 1},
+	{19, 573, 3, 1},
+	{12918, 573, 4, 1},
+	{9778, 573, 3, 1},
+	{24743, 573, 4, 1},
+	{41266, 573, 4, 1},
+	{21606, 573, 4, 1},
+	{1498, 573, 3, 1},
+	{2944, 573, 3, 1},
+	{6352, 573, 3, 1},
+	{1092, 573, 5, 1},
+	{9733, 573, 3, 1},
+	{5042, 573, 3, 1},
+	{1010, 573, 3, 1},
+	{6369, 573, 4, 1},
+	{40946, 574, 4, 1},
+	{38350, 574, 5, 1},
+	{23967, 574, 8, 9},
+	{41046, 574, 4, 1},
+	{34565, 574, 6, 1},
+	{21447, 574, 4, 1},
+	{4, 574, 2, 1},
+	{30175, 574, 7, 1},
+	{30182, 574, 7, 1},
+	{41202, 574, 4, 1},
+	{21608, 574, 5, 1},
+	{8384, 574, 5, 1},
+	{4887, 574, 5, 1},
+	{21606, 574, 4, 1},
+	{25367, 574, 8, 1},
+	{35579, 574, 6, 1},
+	{25975, 574, 8, 1},
+	{39455, 574, 5, 1},
+	{21595, 574, 5, 1},
+	{3936, 574, 4, 1},
+	{6352, 574, 3, 1},
+	{220, 574, 4, 1},
+	{37097, 574, 6, 1},
+	{34930, 574, 3, 1},
+	{6369, 574, 4, 1},
+	{17961, 574, 5, 1},
+	{41818, 574, 4, 1},
+	{41830, 574, 4, 1},
+	{2797, 574, 2, 1},
+	{37823, 574, 6, 1},
+	{37961, 574, 6, 1},
+	{40795, 574, 5, 1},
+	{35, 582, 2, 1},
+	{38535, 582, 3, 1},
+	{4, 582, 2, 1},
+	{39871, 582, 4, 1},
+	{41206, 582, 4, 9},
+	{38925, 582, 5, 9},
+	{810, 582, 2, 1},
+	{6019, 582, 3, 1},
+	{2549, 582, 2, 1},
+	{2944, 582, 3, 1},
+	{5, 582, 2, 1},
+	{36989, 582, 6, 1},
+	{1512, 582, 3, 1},
+	{123, 582, 3, 1},
+	{23967, 583, 8, 9},
+	{810, 583, 3, 1},
+	{10819, 583, 12, 9},
+	{35, 587, 2, 1},
+	{4, 587, 2, 1},
+	{810, 587, 3, 1},
+	{24600, 587, 3, 1},
+	{42237, 587, 3, 1},
+	{21, 587, 4, 1},
+	{2944, 587, 3, 1},
+	{6352, 587, 3, 1},
+	{35, 588, 2, 1},
+	{4, 588, 2, 1},
+	{19, 588, 3, 1},
+	{2944, 588, 3, 1},
+	{6352, 588, 3, 1},
+	{99, 588, 2, 9},
+	{643, 588, 2, 1},
+	{2443, 588, 2, 1},
+	{9505, 593, 2, 1},
+	{4262, 593, 2, 1},
+	{35, 593, 2, 1},
+	{714, 593, 2, 1},
+	{969, 593, 2, 1},
+	{12676, 593, 5, 9},
+	{38525, 593, 5, 1},
+	{38535, 593, 3, 1},
+	{23967, 593, 8, 9},
+	{24079, 593, 8, 1},
+	{25, 593, 2, 1},
+	{29776, 593, 7, 9},
+	{6219, 593, 2, 1},
+	{4, 593, 2, 1},
+	{19, 593, 3, 1},
+	{12918, 593, 4, 1},
+	{4927, 593, 2, 1},
+	{38735, 593, 5, 1},
+	{633, 593, 2, 1},
+	{9778, 593, 3, 1},
+	{112, 593, 2, 1},
+	{24743, 593, 4, 1},
+	{324, 593, 3, 1},
+	{810, 593, 3, 1},
+	{31050, 593, 7, 1},
+	{477, 593, 3, 1},
+	{21606, 593, 4, 1},
+	{2022, 593, 3, 1},
+	{3476, 593, 8, 1},
+	{9, 593, 2, 1},
+	{102, 593, 2, 1},
+	{6019, 593, 3, 1},
+	{2944, 593, 3, 1},
+	{23, 593, 3, 1},
+	{6352, 593, 3, 1},
+	{15529, 593, 2, 1},
+	{67, 593, 4, 1},
+	{5042, 593, 3, 1},
+	{4358, 593, 3, 1},
+	{28063, 593, 8, 9},
+	{2166, 593, 6, 1},
+	{2443, 593, 2, 1},
+	{6692, 593, 2, 1},
+	{11705, 593, 2, 1},
+	{767, 593, 2, 1},
+	{123, 593, 3, 9},
+	{1422, 597, 19, 9},
+	{1007, 597, 20, 9},
+	{12676, 597, 5, 9},
+	{29776, 597, 7, 9},
+	{16502, 597, 9, 9},
+	{34847, 597, 6, 9},
+	{13039, 597, 11, 9},
+	{6317, 597, 6, 9},
+	{30364, 597, 7, 9},
+	{34997, 597, 6, 9},
+	{20497, 597, 9, 9},
+	{16782, 597, 10, 9},
+	{8194, 597, 13, 9},
+	{10279, 597, 12, 9},
+	{17212, 597, 10, 9},
+	{26415, 597, 8, 9},
+	{39820, 597, 5, 9},
+	{16503, 597, 8, 9},
+	{37283, 597, 6, 9},
+	{37973, 597, 6, 9},
+	{38147, 597, 6, 9},
+	{766, 603, 2, 1},
+	{40950, 607, 4, 9},
+	{34301, 607, 6, 9},
+	{6079, 607, 14, 20},
+	{34385, 607, 6, 9},
+	{9835, 607, 12, 9},
+	{12654, 607, 11, 0},
+	{12676, 607, 5, 9},
+	{12698, 607, 11, 9},
+	{12709, 607, 11, 9},
+	{16052, 607, 7, 0},
+	{16052, 607, 10, 0},
+	{41022, 607, 4, 0},
+	{19795, 607, 9, 9},
+	{23983, 607, 8, 9},
+	{29482, 607, 7, 9},
+	{2577, 607, 17, 9},
+	{16292, 607, 10, 9},
+	{19, 607, 3, 1},
+	{24383, 607, 8, 0},
+	{38730, 607, 5, 9},
+	{24439, 607, 8, 9},
+	{41138, 607, 4, 9},
+	{38780, 607, 5, 9},
+	{30091, 607, 7, 9},
+	{34871, 607, 6, 9},
+	{13182, 607, 11, 9},
+	{20272, 607, 9, 0},
+	{25850, 607, 5, 9},
+	{2628, 607, 6, 9},
+	{35117, 607, 6, 9},
+	{16832, 607, 10, 9},
+	{10243, 607, 12, 9},
+	{42198, 607, 3, 9},
+	{10531, 607, 4, 9},
+	{41470, 607, 4, 0},
+	{21487, 607, 9, 9},
+	{21496, 607, 7, 9},
+	{17622, 607, 10, 9},
+	{21739, 607, 9, 20},
+	{8329, 607, 8, 9},
+	{20496, 607, 5, 9},
+	{42273, 607, 3, 9},
+	{32478, 607, 7, 0},
+	{27143, 607, 8, 20},
+	{36797, 607, 6, 20},
+	{36803, 607, 6, 20},
+	{10999, 607, 12, 9},
+	{27391, 607, 8, 9},
+	{40110, 607, 5, 9},
+	{42336, 607, 3, 9},
+	{41702, 607, 4, 9},
+	{14315, 607, 11, 9},
+	{14337, 607, 11, 9},
+	{11131, 607, 12, 0},
+	{42345, 607, 3, 20},
+	{27599, 607, 8, 9},
+	{14447, 607, 11, 9},
+	{22477, 607, 9, 9},
+	{42360, 607, 3, 9},
+	{27983, 607, 8, 9},
+	{37469, 607, 6, 20},
+	{33486, 607, 7, 9},
+	{8961, 607, 9, 0},
+	{33549, 607, 7, 9},
+	{28623, 607, 8, 0},
+	{41906, 607, 4, 9},
+	{33822, 607, 7, 9},
+	{18662, 607, 10, 9},
+	{28671, 607, 8, 0},
+	{9078, 607, 13, 9},
+	{23242, 607, 9, 9},
+	{28799, 607, 8, 9},
+	{19, 609, 3, 1},
+	{9778, 609, 3, 1},
+	{810, 609, 3, 1},
+	{6019, 609, 3, 1},
+	{2944, 609, 3, 1},
+	{6352, 609, 3, 1},
+	{35, 610, 2, 1},
+	{4, 610, 2, 1},
+	{810, 610, 3, 1},
+	{458, 610, 2, 1},
+	{2944, 610, 3, 1},
+	{6352, 610, 3, 1},
+	{1512, 610, 3, 1},
+	{5667, 610, 15, 1},
+	{7353, 610, 14, 1},
+	{23967, 612, 8, 9},
+	{19, 612, 3, 1},
+	{29930, 612, 7, 9},
+	{9778, 612, 3, 1},
+	{810, 612, 3, 1},
+	{2022, 612, 3, 1},
+	{2944, 612, 3, 1},
+	{6352, 612, 3, 1},
+	{12511, 616, 11, 9},
+	{40942, 616, 4, 9},
+	{40954, 616, 4, 9},
+	{40958, 616, 4, 9},
+	{2068, 616, 3, 1},
+	{29069, 616, 7, 1},
+	{982, 616, 2, 1},
+	{19408, 616, 9, 1},
+	{106, 616, 2, 1},
+	{12577, 616, 11, 1},
+	{1583, 616, 10, 1},
+	{2211, 616, 9, 1},
+	{63, 616, 2, 1},
+	{34265, 616, 6, 1},
+	{631, 616, 21, 1},
+	{652, 616, 21, 1},
+	{1365, 616, 19, 1},
+	{1384, 616, 19, 1},
+	{756, 616, 2, 1},
+	{9047, 616, 5, 1},
+	{9739, 616, 12, 1},
+	{12599, 616, 11, 1},
+	{958, 616, 5, 1},
+	{131, 616, 2, 1},
+	{7093, 616, 2, 1},
+	{31877, 616, 6, 1},
+	{639, 616, 2, 1},
+	{34319, 616, 6, 1},
+	{7726, 616, 13, 1},
+	{9787, 616, 12, 1},
+	{3454, 616, 4, 1},
+	{89, 616, 2, 1},
+	{1620, 616, 2, 1},
+	{23839, 616, 8, 1},
+	{454, 616, 2, 1},
+	{503, 616, 6, 1},
+	{4377, 616, 15, 1},
+	{3372, 616, 16, 1},
+	{31277, 616, 4, 1},
+	{673, 616, 21, 1},
+	{1371, 616, 19, 1},
+	{12698, 616, 3, 1},
+	{16032, 616, 10, 1},
+	{29384, 616, 7, 1},
+	{19768, 616, 9, 1},
+	{29398, 616, 7, 1},
+	{3100, 616, 2, 1},
+	{2047, 616, 2, 1},
+	{34457, 616, 6, 1},
+	{764, 616, 2, 1},
+	{23967, 616, 8, 9},
+	{4248, 616, 2, 1},
+	{887, 616, 2, 1},
+	{29468, 616, 7, 1},
+	{2560, 616, 7, 1},
+	{2560, 616, 17, 1},
+	{887, 616, 5, 1},
+	{6135, 616, 14, 1},
+	{4407, 616, 15, 1},
+	{750, 616, 2, 1},
+	{29503, 616, 7, 1},
+	{24031, 616, 8, 1},
+	{125, 616, 2, 1},
+	{4080, 616, 2, 1},
+	{525, 616, 6, 1},
+	{4437, 616, 15, 1},
+	{3404, 616, 16, 1},
+	{42060, 616, 2, 1},
+	{25, 616, 2, 1},
+	{24111, 616, 8, 1},
+	{2686, 616, 3, 1},
+	{5179, 616, 8, 1},
+	{7817, 616, 13, 1},
+	{3814, 616, 3, 1},
+	{24127, 616, 8, 1},
+	{4452, 616, 15, 1},
+	{6149, 616, 14, 1},
+	{16172, 616, 10, 1},
+	{2594, 616, 17, 1},
+	{3420, 616, 16, 1},
+	{7843, 616, 13, 1},
+	{9871, 616, 12, 1},
+	{29601, 616, 7, 1},
+	{29615, 616, 7, 1},
+	{19876, 616, 9, 1},
+	{943, 616, 2, 1},
+	{65, 616, 2, 1},
+	{9895, 616, 12, 1},
+	{12841, 616, 11, 1},
+	{36, 616, 2, 1},
+	{34589, 616, 6, 1},
+	{457, 616, 2, 1},
+	{547, 616, 2, 1},
+	{6219, 616, 2, 1},
+	{4, 616, 2, 1},
+	{41098, 616, 4, 1},
+	{29860, 616, 7, 1},
+	{5582, 616, 2, 1},
+	{29902, 616, 7, 1},
+	{29916, 616, 7, 1},
+	{4927, 616, 2, 1},
+	{452, 616, 2, 1},
+	{38670, 616, 5, 1},
+	{15089, 616, 2, 1},
+	{6275, 616, 14, 1},
+	{7934, 616, 13, 1},
+	{9778, 616, 3, 1},
+	{6373, 616, 14, 1},
+	{8025, 616, 13, 1},
+	{42126, 616, 3, 1},
+	{44, 616, 2, 1},
+	{32873, 616, 4, 1},
+	{1666, 616, 2, 1},
+	{917, 616, 2, 1},
+	{38880, 616, 5, 1},
+	{30245, 616, 7, 1},
+	{42182, 616, 2, 1},
+	{720, 616, 2, 1},
+	{30294, 616, 7, 1},
+	{24775, 616, 8, 1},
+	{20844, 616, 2, 1},
+	{34979, 616, 6, 1},
+	{10087, 616, 12, 1},
+	{13303, 616, 11, 1},
+	{61, 616, 2, 1},
+	{4692, 616, 15, 1},
+	{3564, 616, 16, 1},
+	{4707, 616, 15, 1},
+	{694, 616, 21, 1},
+	{1047, 616, 20, 1},
+	{6401, 616, 14, 1},
+	{6415, 616, 14, 1},
+	{4722, 616, 15, 1},
+	{6429, 616, 14, 1},
+	{1067, 616, 20, 1},
+	{1441, 616, 19, 1},
+	{8116, 616, 13, 1},
+	{20335, 616, 9, 1},
+	{42168, 616, 3, 1},
+	{324, 616, 2, 1},
+	{38975, 616, 5, 1},
+	{35093, 616, 6, 1},
+	{810, 616, 2, 1},
+	{30966, 616, 7, 1},
+	{810, 616, 3, 1},
+	{2757, 616, 2, 1},
+	{25023, 616, 8, 1},
+	{39195, 616, 5, 9},
+	{2696, 616, 17, 1},
+	{3676, 616, 16, 1},
+	{16942, 616, 10, 9},
+	{2668, 616, 2, 1},
+	{31288, 616, 7, 1},
+	{52, 616, 2, 1},
+	{31372, 616, 7, 1},
+	{1749, 616, 2, 1},
+	{21361, 616, 9, 1},
+	{31876, 616, 7, 1},
+	{26199, 616, 8, 1},
+	{35951, 616, 6, 1},
+	{39465, 616, 3, 1},
+	{39465, 616, 5, 1},
+	{107, 616, 2, 1},
+	{17, 616, 2, 1},
+	{39475, 616, 5, 1},
+	{39480, 616, 5, 1},
+	{698, 616, 2, 1},
+	{4897, 616, 3, 1},
+	{31960, 616, 7, 1},
+	{31981, 616, 7, 1},
+	{991, 616, 2, 1},
+	{26247, 616, 4, 1},
+	{17640, 616, 3, 1},
+	{21505, 616, 9, 1},
+	{26255, 616, 8, 1},
+	{232, 616, 2, 1},
+	{1732, 616, 2, 1},
+	{32009, 616, 7, 1},
+	{39565, 616, 5, 1},
+	{26303, 616, 8, 1},
+	{32072, 616, 7, 1},
+	{2590, 616, 3, 1},
+	{36125, 616, 6, 1},
+	{8506, 616, 13, 1},
+	{10735, 616, 12, 1},
+	{36155, 616, 6, 1},
+	{4433, 616, 2, 1},
+	{1647, 616, 2, 1},
+	{102, 616, 2, 1},
+	{5067, 616, 15, 1},
+	{6723, 616, 14, 1},
+	{32170, 616, 7, 1},
+	{492, 616, 2, 1},
+	{36257, 616, 5, 1},
+	{36257, 616, 6, 1},
+	{5601, 616, 2, 1},
+	{736, 616, 2, 1},
+	{36395, 616, 6, 1},
+	{13382, 616, 3, 1},
+	{36407, 616, 6, 1},
+	{736, 616, 5, 1},
+	{8558, 616, 13, 1},
+	{736, 616, 21, 1},
+	{10783, 616, 12, 1},
+	{8571, 616, 13, 1},
+	{2058, 616, 18, 1},
+	{578, 616, 2, 1},
+	{1271, 616, 2, 1},
+	{10819, 616, 12, 9},
+	{722, 616, 2, 1},
+	{36581, 616, 6, 1},
+	{10308, 616, 6, 1},
+	{41590, 616, 4, 0},
+	{134, 616, 2, 1},
+	{36713, 616, 6, 1},
+	{4954, 616, 2, 1},
+	{39845, 616, 5, 1},
+	{573, 616, 2, 1},
+	{6280, 616, 9, 1},
+	{10963, 616, 12, 1},
+	{14084, 616, 11, 1},
+	{5, 616, 2, 1},
+	{27183, 616, 8, 1},
+	{1623, 616, 2, 1},
+	{778, 616, 2, 1},
+	{36881, 616, 6, 1},
+	{40000, 616, 5, 1},
+	{32730, 616, 7, 1},
+	{40015, 616, 5, 1},
+	{40035, 616, 5, 1},
+	{2554, 616, 2, 1},
+	{13027, 616, 2, 1},
+	{481, 616, 2, 1},
+	{32737, 616, 7, 1},
+	{8714, 616, 13, 1},
+	{11011, 616, 12, 1},
+	{32744, 616, 7, 1},
+	{15529, 616, 2, 1},
+	{4455, 616, 2, 1},
+	{27255, 616, 8, 1},
+	{27271, 616, 8, 1},
+	{27279, 616, 8, 1},
+	{41682, 616, 4, 1},
+	{32779, 616, 7, 1},
+	{42312, 616, 3, 1},
+	{10830, 616, 2, 1},
+	{67, 616, 2, 1},
+	{22180, 616, 9, 1},
+	{32849, 616, 7, 1},
+	{220, 616, 2, 1},
+	{40085, 616, 5, 1},
+	{1961, 616, 2, 1},
+	{4545, 616, 2, 1},
+	{37031, 616, 3, 1},
+	{37031, 616, 6, 1},
+	{18701, 616, 2, 1},
+	{42473, 616, 2, 1},
+	{62, 616, 2, 1},
+	{37061, 616, 6, 1},
+	{32870, 616, 7, 1},
+	{770, 616, 2, 1},
+	{7, 616, 2, 1},
+	{5172, 616, 15, 1},
+	{8740, 616, 13, 1},
+	{6849, 616, 14, 1},
+	{11107, 616, 12, 1},
+	{41, 616, 2, 1},
+	{221, 616, 2, 1},
+	{40165, 616, 5, 1},
+	{37115, 616, 6, 1},
+	{322, 616, 2, 1},
+	{919, 616, 2, 1},
+	{99, 616, 2, 1},
+	{5226, 616, 4, 1},
+	{19404, 616, 4, 1},
+	{37145, 616, 6, 1},
+	{506, 616, 2, 1},
+	{33024, 616, 7, 1},
+	{8716, 616, 3, 1},
+	{27623, 616, 8, 1},
+	{27631, 616, 8, 1},
+	{33073, 616, 7, 1},
+	{37253, 616, 6, 1},
+	{126, 616, 2, 1},
+	{8331, 616, 3, 1},
+	{33241, 616, 7, 1},
+	{37373, 616, 6, 1},
+	{40370, 616, 5, 1},
+	{27879, 616, 8, 1},
+	{159, 616, 2, 1},
+	{33318, 616, 7, 1},
+	{1406, 616, 2, 1},
+	{1825, 616, 2, 1},
+	{494, 616, 2, 1},
+	{2247, 616, 9, 1},
+	{7979, 616, 2, 1},
+	{28111, 616, 8, 9},
+	{105, 616, 2, 1},
+	{1401, 616, 3, 1},
+	{33465, 616, 7, 1},
+	{15, 616, 2, 1},
+	{11479, 616, 12, 1},
+	{14601, 616, 11, 1},
+	{37691, 616, 6, 1},
+	{40570, 616, 5, 1},
+	{5991, 616, 3, 0},
+	{1624, 616, 2, 1},
+	{1004, 616, 2, 1},
+	{37781, 616, 6, 1},
+	{11357, 616, 3, 1},
+	{33605, 616, 7, 1},
+	{777, 616, 2, 1},
+	{199, 616, 2, 1},
+	{820, 616, 21, 1},
+	{841, 616, 21, 1},
+	{1536, 616, 19, 1},
+	{1555, 616, 19, 1},
+	{33682, 616, 7, 1},
+	{2968, 616, 17, 1},
+	{3948, 616, 16, 1},
+	{2184, 616, 18, 1},
+	{2985, 616, 17, 1},
+	{199, 616, 8, 1},
+	{3964, 616, 16, 1},
+	{5292, 616, 15, 1},
+	{1574, 616, 19, 1},
+	{2202, 616, 18, 1},
+	{3980, 616, 16, 1},
+	{5307, 616, 15, 1},
+	{2220, 616, 18, 1},
+	{3002, 616, 17, 1},
+	{1593, 616, 19, 1},
+	{2238, 616, 18, 1},
+	{5322, 616, 15, 1},
+	{6961, 616, 14, 1},
+	{2256, 616, 18, 1},
+	{3019, 616, 17, 1},
+	{5337, 616, 15, 1},
+	{6975, 616, 14, 1},
+	{3036, 616, 17, 1},
+	{3996, 616, 16, 1},
+	{2274, 616, 18, 1},
+	{3053, 616, 17, 1},
+	{4012, 616, 16, 1},
+	{5352, 616, 15, 1},
+	{3070, 616, 17, 1},
+	{4028, 616, 16, 1},
+	{37847, 616, 6, 1},
+	{33689, 616, 7, 1},
+	{33696, 616, 7, 1},
+	{70, 616, 2, 1},
+	{40665, 616, 5, 1},
+	{33780, 616, 7, 1},
+	{2443, 616, 2, 1},
+	{2230, 616, 2, 1},
+	{40690, 616, 5, 1},
+	{4432, 616, 3, 1},
+	{37925, 616, 6, 1},
+	{9026, 616, 13, 1},
+	{11539, 616, 12, 1},
+	{114, 616, 2, 1},
+	{14667, 616, 11, 1},
+	{18632, 616, 10, 1},
+	{18642, 616, 10, 1},
+	{23170, 616, 9, 1},
+	{14678, 616, 11, 1},
+	{9039, 616, 13, 1},
+	{11551, 616, 12, 1},
+	{18652, 616, 10, 1},
+	{11563, 616, 12, 1},
+	{14689, 616, 11, 1},
+	{11575, 616, 12, 1},
+	{6989, 616, 14, 1},
+	{14700, 616, 11, 1},
+	{11587, 616, 12, 1},
+	{42423, 616, 3, 1},
+	{37991, 616, 6, 1},
+	{361, 616, 2, 1},
+	{7540, 616, 2, 1},
+	{8184, 616, 3, 1},
+	{320, 616, 2, 1},
+	{701, 616, 3, 1},
+	{38003, 616, 6, 1},
+	{701, 616, 7, 1},
+	{38009, 616, 6, 1},
+	{28695, 616, 8, 1},
+	{28703, 616, 8, 1},
+	{38021, 616, 6, 1},
+	{97, 616, 2, 1},
+	{9065, 616, 13, 1},
+	{11623, 616, 12, 1},
+	{33864, 616, 7, 1},
+	{33892, 616, 7, 1},
+	{1276, 616, 2, 1},
+	{5019, 616, 2, 1},
+	{7975, 616, 2, 1},
+	{2370, 616, 2, 1},
+	{499, 616, 22, 1},
+	{883, 616, 21, 1},
+	{521, 616, 22, 1},
+	{1631, 616, 19, 1},
+	{2346, 616, 18, 1},
+	{1650, 616, 19, 1},
+	{2382, 616, 18, 1},
+	{5802, 616, 15, 1},
+	{244, 616, 24, 1},
+	{363, 616, 23, 1},
+	{195, 616, 25, 1},
+	{268, 616, 24, 1},
+	{292, 616, 24, 1},
+	{386, 616, 23, 1},
+	{409, 616, 23, 1},
+	{609, 616, 22, 1},
+	{1840, 616, 19, 1},
+	{946, 616, 21, 1},
+	{2508, 616, 18, 1},
+	{1859, 616, 19, 1},
+	{4, 622, 2, 1},
+	{2944, 622, 3, 1},
+	{1015, 622, 2, 9},
+	{6352, 622, 3, 1},
+	{19, 631, 3, 1},
+	{9778, 631, 3, 1},
+	{810, 631, 3, 1},
+	{6019, 631, 3, 1},
+	{17722, 631, 4, 1},
+	{2944, 631, 3, 1},
+	{6352, 631, 3, 1},
+	{1512, 631, 3, 1},
+	{35, 636, 2, 1},
+	{729, 636, 2, 1},
+	{13452, 636, 5, 1},
+	{8440, 636, 5, 1},
+	{38395, 636, 5, 9},
+	{34295, 636, 6, 1},
+	{23847, 636, 8, 9},
+	{23855, 636, 8, 9},
+	{23863, 636, 8, 9},
+	{29356, 636, 7, 9},
+	{34493, 636, 6, 9},
+	{23967, 636, 8, 9},
+	{38545, 636, 5, 9},
+	{4907, 636, 3, 9},
+	{19822, 636, 3, 9},
+	{19822, 636, 9, 9},
+	{20779, 636, 3, 9},
+	{29552, 636, 7, 9},
+	{24143, 636, 8, 9},
+	{38600, 636, 5, 9},
+	{29622, 636, 7, 9},
+	{38625, 636, 5, 9},
+	{19347, 636, 5, 1},
+	{24183, 636, 8, 9},
+	{24207, 636, 8, 9},
+	{38630, 636, 5, 9},
+	{29720, 636, 7, 9},
+	{6878, 636, 3, 9},
+	{41078, 636, 4, 9},
+	{4, 636, 2, 1},
+	{29790, 636, 7, 9},
+	{24335, 636, 8, 9},
+	{34691, 636, 6, 9},
+	{24367, 636, 8, 9},
+	{19568, 636, 3, 9},
+	{7841, 636, 4, 9},
+	{32144, 636, 4, 9},
+	{34787, 636, 6, 9},
+	{1023, 636, 2, 1},
+	{34877, 636, 6, 9},
+	{20613, 636, 5, 1},
+	{30224, 636, 7, 9},
+	{10039, 636, 12, 9},
+	{42135, 636, 3, 9},
+	{38900, 636, 5, 9},
+	{34973, 636, 6, 9},
+	{41222, 636, 4, 9},
+	{16692, 636, 10, 9},
+	{38955, 636, 5, 1},
+	{30812, 636, 7, 1},
+	{8432, 636, 9, 1},
+	{41246, 636, 4, 1},
+	{16742, 636, 10, 9},
+	{38995, 636, 5, 9},
+	{35153, 636, 6, 9},
+	{810, 636, 2, 1},
+	{39030, 636, 5, 9},
+	{2757, 636, 2, 1},
+	{31022, 636, 7, 9},
+	{39085, 636, 5, 1},
+	{39090, 636, 5, 9},
+	{13424, 636, 11, 9},
+	{39120, 636, 5, 9},
+	{1910, 636, 3, 9},
+	{13671, 636, 4, 9},
+	{39140, 636, 5, 9},
+	{3587, 636, 9, 1},
+	{25223, 636, 8, 1},
+	{41318, 636, 4, 9},
+	{35435, 636, 6, 9},
+	{39185, 636, 5, 1},
+	{31232, 636, 7, 1},
+	{35453, 636, 6, 9},
+	{21938, 636, 8, 1},
+	{39260, 636, 5, 9},
+	{39280, 636, 5, 1},
+	{20938, 636, 9, 9},
+	{8214, 636, 6, 1},
+	{20983, 636, 9, 1},
+	{25695, 636, 8, 1},
+	{17162, 636, 10, 9},
+	{25799, 636, 8, 4},
+	{25831, 636, 8, 9},
+	{41410, 636, 4, 9},
+	{41414, 636, 4, 9},
+	{17202, 636, 10, 4},
+	{41426, 636, 4, 4},
+	{39365, 636, 5, 1},
+	{26055, 636, 8, 1},
+	{39425, 636, 5, 9},
+	{39440, 636, 5, 1},
+	{4400, 636, 2, 1},
+	{17352, 636, 10, 9},
+	{21496, 636, 9, 9},
+	{17362, 636, 10, 9},
+	{17640, 636, 4, 9},
+	{32002, 636, 7, 9},
+	{26271, 636, 8, 9},
+	{13809, 636, 4, 9},
+	{938, 636, 3, 1},
+	{36347, 636, 6, 1},
+	{26551, 636, 8, 1},
+	{41550, 636, 4, 9},
+	{24466, 636, 4, 9},
+	{21730, 636, 9, 9},
+	{21739, 636, 3, 9},
+	{8422, 636, 6, 1},
+	{26775, 636, 8, 1},
+	{36551, 636, 6, 4},
+	{32331, 636, 7, 9},
+	{21865, 636, 4, 1},
+	{703, 636, 2, 1},
+	{32429, 636, 7, 1},
+	{36659, 636, 6, 9},
+	{32471, 636, 7, 9},
+	{27189, 636, 4, 9},
+	{39254, 636, 4, 1},
+	{32562, 636, 7, 1},
+	{32583, 636, 7, 1},
+	{41650, 636, 4, 9},
+	{5, 636, 2, 1},
+	{10214, 636, 5, 1},
+	{27215, 636, 8, 9},
+	{27223, 636, 8, 9},
+	{36923, 636, 6, 9},
+	{36929, 636, 6, 9},
+	{40040, 636, 5, 9},
+	{14551, 636, 6, 9},
+	{40050, 636, 5, 9},
+	{32765, 636, 7, 9},
+	{36965, 636, 6, 9},
+	{40120, 636, 5, 9},
+	{41698, 636, 4, 9},
+	{27407, 636, 8, 9},
+	{18002, 636, 3, 9},
+	{27431, 636, 8, 9},
+	{22243, 636, 9, 9},
+	{37181, 636, 6, 9},
+	{18102, 636, 4, 1},
+	{33010, 636, 7, 1},
+	{33066, 636, 7, 4},
+	{22378, 636, 9, 9},
+	{37265, 636, 6, 9},
+	{8799, 636, 6, 4},
+	{6758, 636, 5, 1},
+	{33185, 636, 7, 1},
+	{27847, 636, 8, 1},
+	{40470, 636, 5, 9},
+	{28031, 636, 8, 9},
+	{17495, 636, 3, 9},
+	{28055, 636, 8, 9},
+	{22846, 636, 9, 9},
+	{33542, 636, 7, 9},
+	{40585, 636, 5, 9},
+	{33570, 636, 7, 1},
+	{23017, 636, 9, 1},
+	{39443, 636, 5, 1},
+	{28423, 636, 8, 9},
+	{33626, 636, 7, 1},
+	{25113, 636, 6, 1},
+	{28607, 636, 5, 9},
+	{40730, 636, 5, 9},
+	{767, 636, 11, 9},
+	{37997, 636, 6, 9},
+	{14422, 636, 5, 9},
+	{38033, 636, 6, 9},
+	{38063, 636, 6, 9},
+	{28751, 636, 8, 1},
+	{38135, 636, 6, 9},
+	{33955, 636, 7, 9},
+	{23260, 636, 9, 9},
+	{9143, 636, 13, 1},
+	{23287, 636, 9, 1},
+	{14821, 636, 11, 1},
+	{14832, 636, 11, 1},
+	{14854, 636, 11, 1},
+	{14876, 636, 11, 1},
+	{14942, 636, 11, 1},
+	{14953, 636, 11, 1},
+	{23296, 636, 9, 1},
+	{14986, 636, 11, 1},
+	{14997, 636, 11, 1},
+	{15008, 636, 11, 1},
+	{18852, 636, 10, 1},
+	{18862, 636, 10, 1},
+	{11767, 636, 12, 1},
+	{15041, 636, 11, 1},
+	{18892, 636, 10, 1},
+	{18952, 636, 10, 1},
+	{7171, 636, 14, 1},
+	{7185, 636, 14, 1},
+	{18992, 636, 10, 1},
+	{19002, 636, 10, 1},
+	{15129, 636, 11, 1},
+	{15140, 636, 11, 1},
+	{15151, 636, 11, 1},
+	{15305, 636, 11, 1},
+	{19092, 636, 10, 1},
+	{15316, 636, 11, 1},
+	{19102, 636, 10, 1},
+	{19112, 636, 10, 1},
+	{19122, 636, 10, 1},
+	{15415, 636, 11, 1},
+	{15448, 636, 11, 1},
+	{7493, 636, 14, 1},
+	{15470, 636, 11, 1},
+	{15536, 636, 11, 1},
+	{15558, 636, 11, 1},
+	{19202, 636, 10, 1},
+	{23485, 636, 9, 1},
+	{19212, 636, 10, 1},
+	{19222, 636, 10, 1},
+	{15646, 636, 11, 1},
+	{15668, 636, 11, 1},
+	{19242, 636, 10, 1},
+	{15679, 636, 11, 1},
+	{15701, 636, 11, 1},
+	{15767, 636, 11, 1},
+	{28903, 636, 8, 1},
+	{23539, 636, 9, 1},
+	{23548, 636, 9, 1},
+	{28943, 636, 8, 4},
+	{38309, 636, 6, 9},
+	{35, 643, 2, 1},
+	{4, 643, 2, 1},
+	{810, 643, 2, 1},
+	{21606, 643, 4, 1},
+	{102, 643, 2, 1},
+	{2103, 643, 4, 1},
+	{703, 643, 2, 1},
+	{5, 643, 2, 1},
+	{1512, 643, 2, 1},
+	{3492, 648, 4, 9},
+	{19, 648, 3, 1},
+	{9778, 648, 3, 1},
+	{810, 648, 3, 1},
+	{9, 648, 2, 9},
+	{6664, 648, 2, 9},
+	{6019, 648, 3, 1},
+	{2944, 648, 3, 1},
+	{6352, 648, 3, 1},
+	{2443, 648, 2, 9},
+	{6692, 648, 2, 9},
+	{767, 648, 2, 9},
+	{38535, 650, 3, 1},
+	{19, 650, 3, 1},
+	{9778, 650, 3, 1},
+	{810, 650, 3, 1},
+	{21606, 650, 4, 1},
+	{2944, 650, 3, 1},
+	{6352, 650, 3, 1},
+	{779, 658, 3, 1},
+	{788, 658, 4, 1},
+	{19, 658, 3, 1},
+	{12918, 658, 4, 1},
+	{9778, 658, 3, 1},
+	{41266, 658, 4, 1},
+	{810, 658, 3, 1},
+	{32142, 658, 7, 1},
+	{6019, 658, 3, 1},
+	{5080, 658, 3, 1},
+	{27047, 658, 8, 1},
+	{6352, 658, 3, 1},
+	{14194, 658, 11, 1},
+	{42318, 658, 3, 1},
+	{37013, 658, 6, 1},
+	{2797, 658, 2, 1},
+	{14711, 658, 11, 1},
+	{9778, 659, 3, 1},
+	{810, 659, 3, 1},
+	{2944, 659, 3, 1},
+	{6352, 659, 3, 1},
+	{19, 663, 3, 1},
+	{9778, 663, 3, 1},
+	{810, 663, 3, 1},
+	{6352, 663, 3, 1},
+	{3558, 663, 3, 1},
+	{647, 663, 3, 1},
+	{35, 666, 2, 1},
+	{23967, 666, 8, 9},
+	{38570, 666, 5, 1},
+	{24223, 666, 8, 1},
+	{24231, 666, 8, 1},
+	{4, 666, 2, 1},
+	{38695, 666, 5, 1},
+	{29944, 666, 7, 1},
+	{27, 666, 2, 1},
+	{30840, 666, 7, 1},
+	{810, 666, 2, 1},
+	{31057, 666, 7, 1},
+	{20515, 666, 9, 1},
+	{25047, 666, 8, 1},
+	{20524, 666, 9, 1},
+	{3863, 666, 2, 1},
+	{31309, 666, 7, 1},
+	{41362, 666, 4, 1},
+	{31463, 666, 7, 1},
+	{31470, 666, 7, 1},
+	{16735, 666, 2, 1},
+	{6019, 666, 3, 1},
+	{578, 666, 2, 1},
+	{703, 666, 2, 1},
+	{5, 666, 2, 1},
+	{481, 666, 2, 1},
+	{7, 666, 2, 1},
+	{1512, 666, 2, 1},
+	{40340, 666, 5, 1},
+	{526, 666, 5, 1},
+	{4, 667, 2, 9},
+	{9778, 667, 3, 9},
+	{19, 670, 3, 1},
+	{9778, 670, 3, 1},
+	{4783, 670, 3, 1},
+	{810, 670, 3, 1},
+	{477, 670, 3, 1},
+	{2944, 670, 3, 1},
+	{6352, 670, 3, 1},
+	{19, 671, 3, 1},
+	{9778, 671, 3, 1},
+	{2944, 671, 3, 1},
+	{6352, 671, 3, 1},
+	{19, 673, 3, 1},
+	{9778, 673, 3, 1},
+	{810, 673, 3, 1},
+	{6653, 673, 6, 9},
+	{13699, 673, 11, 0},
+	{6019, 673, 3, 1},
+	{2944, 673, 3, 1},
+	{6352, 673, 3, 1},
+	{42057, 674, 3, 9},
+	{4, 674, 1, 9},
+	{19, 674, 3, 1},
+	{9778, 674, 3, 1},
+	{810, 674, 3, 1},
+	{21606, 674, 4, 1},
+	{2022, 674, 3, 1},
+	{2944, 674, 3, 1},
+	{6352, 674, 3, 1},
+	{1092, 674, 3, 1},
+	{4367, 680, 6, 9},
+	{19, 689, 3, 1},
+	{9778, 689, 3, 1},
+	{810, 689, 3, 1},
+	{2944, 689, 3, 1},
+	{6352, 689, 3, 1},
+	{4, 690, 2, 1},
+	{19, 690, 3, 1},
+	{9778, 690, 3, 1},
+	{810, 690, 3, 1},
+	{2944, 690, 3, 1},
+	{6352, 690, 3, 1},
+	{3885, 690, 2, 9},
+	{23967, 699, 8, 9},
+	{29291, 699, 3, 9},
+	{41110, 711, 4, 9},
+	{28819, 711, 4, 20},
+	{39690, 711, 5, 9},
+	{41310, 713, 3, 9},
+	{35, 715, 2, 1},
+	{40986, 715, 4, 1},
+	{19, 715, 3, 1},
+	{9778, 715, 3, 1},
+	{810, 715, 3, 1},
+	{42186, 715, 3, 1},
+	{4887, 715, 5, 1},
+	{2022, 715, 3, 1},
+	{33033, 715, 3, 1},
+	{2944, 715, 3, 1},
+	{12810, 715, 3, 1},
+	{6352, 715, 3, 1},
+	{1512, 715, 3, 1},
+	{790, 715, 3, 1},
+	{123, 715, 3, 1},
+	{42291, 722, 3, 9},
+	{19, 729, 3, 1},
+	{9778, 729, 3, 1},
+	{810, 729, 3, 1},
+	{2944, 729, 3, 1},
+	{6352, 729, 3, 1},
+	{35, 730, 2, 1},
+	{38535, 730, 3, 1},
+	{4, 730, 2, 1},
+	{48, 730, 2, 9},
+	{9778, 730, 3, 1},
+	{810, 730, 3, 1},
+	{21606, 730, 4, 1},
+	{2944, 730, 3, 1},
+	{6352, 730, 3, 1},
+	{1512, 730, 2, 1},
+	{23967, 731, 8, 9},
+	{810, 731, 3, 1},
+	{15842, 734, 10, 9},
+	{23967, 734, 8, 9},
+	{4746, 738, 3, 1},
+	{19, 738, 3, 1},
+	{13922, 738, 4, 1},
+	{9778, 738, 3, 1},
+	{810, 738, 3, 1},
+	{458, 738, 2, 1},
+	{6019, 738, 3, 1},
+	{2944, 738, 3, 1},
+	{6352, 738, 3, 1},
+	{19, 739, 3, 1},
+	{9778, 739, 3, 1},
+	{810, 739, 3, 1},
+	{458, 739, 2, 1},
+	{1498, 739, 3, 1},
+	{2944, 739, 3, 1},
+	{6352, 739, 3, 1},
+	{42309, 739, 3, 1},
+	{1512, 739, 3, 1},
+	{35, 740, 2, 1},
+	{4, 740, 2, 1},
+	{810, 740, 3, 1},
+	{2944, 740, 3, 1},
+	{6352, 740, 3, 1},
+	{4357, 740, 5, 1},
+	{21805, 747, 6, 9},
+	{788, 758, 4, 1},
+	{2797, 758, 2, 1},
+	{89, 760, 2, 9},
+	{23967, 760, 8, 9},
+	{48, 760, 2, 9},
+	{6664, 760, 2, 9},
+	{1004, 760, 2, 9},
+	{35, 761, 2, 1},
+	{12676, 761, 5, 9},
+	{24023, 761, 8, 9},
+	{42066, 761, 3, 9},
+	{4, 761, 2, 1},
+	{34727, 761, 6, 9},
+	{24407, 761, 4, 9},
+	{1236, 761, 11, 9},
+	{34799, 761, 6, 9},
+	{27672, 761, 7, 9},
+	{20146, 761, 9, 9},
+	{9778, 761, 3, 1},
+	{13193, 761, 8, 9},
+	{13193, 761, 11, 9},
+	{13204, 761, 11, 9},
+	{13215, 761, 11, 9},
+	{13226, 761, 11, 9},
+	{13237, 761, 11, 9},
+	{13248, 761, 11, 9},
+	{35141, 761, 6, 9},
+	{810, 761, 3, 1},
+	{39165, 761, 5, 9},
+	{41326, 761, 4, 9},
+	{7303, 761, 3, 1},
+	{31988, 761, 7, 9},
+	{36023, 761, 6, 9},
+	{39610, 761, 5, 9},
+	{41522, 761, 4, 9},
+	{41570, 761, 4, 9},
+	{2944, 761, 3, 1},
+	{36695, 761, 6, 9},
+	{41602, 761, 4, 9},
+	{6352, 761, 3, 1},
+	{220, 761, 4, 1},
+	{32863, 761, 7, 9},
+	{22720, 761, 9, 9},
+	{1227, 761, 8, 9},
+	{41842, 761, 4, 9},
+	{33675, 761, 7, 0},
+	{42432, 761, 3, 9},
+	{38147, 761, 6, 9},
+	{28799, 761, 8, 9},
+	{40885, 761, 5, 9},
+	{10111, 763, 6, 9},
+	{12676, 769, 5, 9},
+	{4, 771, 2, 1},
+	{19, 771, 3, 1},
+	{9778, 771, 3, 1},
+	{810, 771, 3, 1},
+	{6019, 771, 3, 1},
+	{5080, 771, 3, 1},
+	{6352, 771, 3, 1},
+	{42318, 771, 3, 1},
+	{2797, 771, 2, 1},
+	{23967, 780, 8, 9},
+	{19, 780, 3, 1},
+	{9778, 780, 3, 1},
+	{810, 780, 3, 1},
+	{3522, 780, 3, 1},
+	{17722, 780, 4, 1},
+	{2944, 780, 3, 1},
+	{6352, 780, 3, 1},
+	{19, 781, 3, 1},
+	{9778, 781, 3, 1},
+	{41266, 781, 4, 1},
+	{810, 781, 3, 1},
+	{2944, 781, 3, 1},
+	{6352, 781, 3, 1},
+	{37013, 781, 6, 1},
+	{9778, 786, 3, 1},
+	{810, 786, 3, 1},
+	{29830, 786, 3, 9},
+	{6352, 786, 3, 1},
+	{19, 787, 3, 1},
+	{9778, 787, 3, 1},
+	{810, 787, 3, 1},
+	{2944, 787, 3, 1},
+	{6352, 787, 3, 1},
+	{12676, 788, 5, 9},
+	{27672, 788, 7, 9},
+	{2465, 804, 2, 9},
+	{23967, 806, 8, 9},
+	{810, 806, 3, 1},
+	{19, 807, 3, 1},
+	{9778, 807, 3, 1},
+	{810, 807, 3, 1},
+	{2067, 807, 3, 9},
+	{26519, 807, 8, 9},
+	{2944, 807, 3, 1},
+	{6352, 807, 3, 1},
+	{19, 809, 3, 1},
+	{9778, 809, 3, 1},
+	{2944, 809, 3, 1},
+	{6352, 809, 3, 1},
+	{35, 812, 2, 1},
+	{4, 812, 2, 1},
+	{19, 812, 3, 1},
+	{810, 812, 3, 1},
+	{2944, 812, 3, 1},
+	{5, 812, 2, 1},
+	{6352, 812, 3, 1},
+	{29076, 813, 7, 1},
+	{12566, 813, 11, 1},
+	{1346, 813, 3, 1},
+	{23735, 813, 8, 1},
+	{29146, 813, 7, 1},
+	{34235, 813, 6, 1},
+	{38370, 813, 5, 1},
+	{19480, 813, 9, 1},
+	{3340, 813, 8, 1},
+	{3340, 813, 9, 1},
+	{3340, 813, 16, 1},
+	{12588, 813, 11, 1},
+	{19489, 813, 9, 1},
+	{73, 813, 3, 1},
+	{19534, 813, 9, 1},
+	{9727, 813, 6, 1},
+	{9727, 813, 12, 1},
+	{3348, 813, 8, 1},
+	{23783, 813, 8, 1},
+	{19588, 813, 9, 1},
+	{6051, 813, 14, 1},
+	{12610, 813, 11, 1},
+	{9751, 813, 12, 1},
+	{3749, 813, 3, 1},
+	{9763, 813, 12, 1},
+	{19606, 813, 9, 1},
+	{29216, 813, 7, 1},
+	{9775, 813, 12, 1},
+	{15962, 813, 10, 1},
+	{4056, 813, 4, 1},
+	{7713, 813, 13, 1},
+	{23807, 813, 8, 1},
+	{7739, 813, 13, 1},
+	{34349, 813, 6, 1},
+	{788, 813, 11, 1},
+	{19642, 813, 9, 1},
+	{29251, 813, 7, 1},
+	{34361, 813, 6, 1},
+	{19669, 813, 9, 1},
+	{15982, 813, 10, 1},
+	{7887, 813, 8, 1},
+	{40994, 813, 4, 1},
+	{29335, 813, 7, 1},
+	{29342, 813, 7, 1},
+	{20169, 813, 4, 1},
+	{6093, 813, 4, 1},
+	{19714, 813, 9, 1},
+	{19723, 813, 9, 1},
+	{23911, 813, 8, 1},
+	{38480, 813, 5, 1},
+	{38485, 813, 5, 1},
+	{34409, 813, 6, 1},
+	{19759, 813, 9, 1},
+	{7778, 813, 13, 1},
+	{23919, 813, 8, 1},
+	{29405, 813, 7, 1},
+	{23927, 813, 8, 1},
+	{16516, 813, 6, 1},
+	{14373, 813, 4, 1},
+	{38520, 813, 5, 1},
+	{34481, 813, 6, 1},
+	{41030, 813, 4, 1},
+	{29433, 813, 7, 1},
+	{16092, 813, 10, 1},
+	{41054, 813, 4, 1},
+	{34511, 813, 6, 1},
+	{4392, 813, 9, 1},
+	{4392, 813, 15, 1},
+	{7791, 813, 13, 1},
+	{34517, 813, 6, 1},
+	{3388, 813, 16, 1},
+	{24023, 813, 6, 1},
+	{29510, 813, 7, 1},
+	{4422, 813, 7, 1},
+	{4422, 813, 15, 1},
+	{19840, 813, 9, 1},
+	{34535, 813, 6, 1},
+	{24055, 813, 7, 1},
+	{24055, 813, 8, 1},
+	{19849, 813, 9, 1},
+	{24063, 813, 8, 1},
+	{29545, 813, 7, 1},
+	{2633, 813, 3, 1},
+	{34547, 813, 6, 1},
+	{24103, 813, 8, 1},
+	{16162, 813, 10, 1},
+	{19867, 813, 9, 1},
+	{3345, 813, 3, 1},
+	{34559, 813, 6, 1},
+	{16192, 813, 10, 1},
+	{29587, 813, 7, 1},
+	{16212, 813, 10, 1},
+	{6163, 813, 14, 1},
+	{34571, 813, 6, 1},
+	{29608, 813, 7, 1},
+	{4922, 813, 6, 1},
+	{6269, 813, 6, 1},
+	{12863, 813, 11, 1},
+	{16222, 813, 10, 1},
+	{7869, 813, 13, 1},
+	{29664, 813, 7, 1},
+	{4467, 813, 8, 1},
+	{4467, 813, 9, 1},
+	{4467, 813, 15, 1},
+	{9919, 813, 12, 1},
+	{19966, 813, 9, 1},
+	{6191, 813, 14, 1},
+	{16262, 813, 10, 1},
+	{34631, 813, 6, 1},
+	{34643, 813, 6, 1},
+	{9931, 813, 12, 1},
+	{9943, 813, 12, 1},
+	{24255, 813, 8, 1},
+	{29762, 813, 7, 1},
+	{5422, 813, 5, 1},
+	{41090, 813, 4, 1},
+	{6233, 813, 14, 1},
+	{41094, 813, 4, 1},
+	{29797, 813, 7, 1},
+	{16332, 813, 10, 1},
+	{1027, 813, 20, 1},
+	{4527, 813, 15, 1},
+	{4429, 813, 8, 1},
+	{24311, 813, 8, 1},
+	{81, 813, 13, 1},
+	{81, 813, 14, 1},
+	{7921, 813, 9, 1},
+	{4542, 813, 8, 1},
+	{4542, 813, 15, 1},
+	{4557, 813, 12, 1},
+	{4557, 813, 15, 1},
+	{29846, 813, 7, 1},
+	{16382, 813, 10, 1},
+	{12929, 813, 11, 1},
+	{24343, 813, 8, 1},
+	{29874, 813, 7, 1},
+	{5384, 813, 13, 1},
+	{34685, 813, 6, 1},
+	{6942, 813, 6, 1},
+	{20038, 813, 9, 1},
+	{18054, 813, 8, 1},
+	{6261, 813, 8, 1},
+	{6261, 813, 14, 1},
+	{12570, 813, 7, 1},
+	{38675, 813, 5, 1},
+	{38680, 813, 5, 1},
+	{11247, 813, 4, 1},
+	{34721, 813, 6, 1},
+	{24391, 813, 8, 1},
+	{24518, 813, 3, 1},
+	{4046, 813, 14, 1},
+	{5269, 813, 8, 1},
+	{12973, 813, 11, 1},
+	{29965, 813, 7, 1},
+	{20663, 813, 5, 1},
+	{6703, 813, 6, 1},
+	{29979, 813, 7, 1},
+	{24471, 813, 8, 1},
+	{20065, 813, 9, 1},
+	{38755, 813, 5, 1},
+	{24503, 813, 8, 1},
+	{34841, 813, 6, 1},
+	{16542, 813, 10, 1},
+	{20128, 813, 9, 1},
+	{9778, 813, 9, 1},
+	{13138, 813, 11, 1},
+	{24591, 813, 8, 1},
+	{20164, 813, 9, 1},
+	{34895, 813, 6, 1},
+	{16562, 813, 10, 1},
+	{16572, 813, 10, 1},
+	{10027, 813, 12, 1},
+	{30168, 813, 7, 1},
+	{16582, 813, 10, 1},
+	{95, 813, 11, 1},
+	{95, 813, 25, 1},
+	{24639, 813, 8, 1},
+	{38840, 813, 5, 1},
+	{5391, 813, 6, 1},
+	{20209, 813, 9, 1},
+	{34931, 813, 6, 1},
+	{16622, 813, 10, 1},
+	{6017, 813, 6, 1},
+	{8090, 813, 4, 1},
+	{8090, 813, 13, 1},
+	{30231, 813, 7, 1},
+	{20227, 813, 9, 1},
+	{38885, 813, 5, 1},
+	{24727, 813, 8, 1},
+	{20236, 813, 9, 1},
+	{41202, 813, 4, 1},
+	{24735, 813, 7, 1},
+	{24735, 813, 8, 1},
+	{30280, 813, 7, 1},
+	{24759, 813, 8, 1},
+	{30329, 813, 7, 1},
+	{18177, 813, 5, 1},
+	{10099, 813, 12, 1},
+	{20281, 813, 9, 1},
+	{16672, 813, 10, 1},
+	{20290, 813, 9, 1},
+	{20299, 813, 9, 1},
+	{10123, 813, 12, 1},
+	{13336, 813, 11, 1},
+	{24831, 813, 8, 1},
+	{24839, 813, 8, 1},
+	{30406, 813, 4, 1},
+	{24919, 813, 8, 1},
+	{20407, 813, 9, 1},
+	{15965, 813, 7, 1},
+	{4401, 813, 6, 1},
+	{3541, 813, 7, 1},
+	{20443, 813, 9, 1},
+	{13380, 813, 11, 1},
+	{30861, 813, 7, 1},
+	{30868, 813, 7, 1},
+	{30889, 813, 7, 1},
+	{26198, 813, 4, 1},
+	{39010, 813, 5, 1},
+	{39035, 813, 5, 1},
+	{13402, 813, 11, 1},
+	{41274, 813, 4, 1},
+	{25039, 813, 8, 1},
+	{16802, 813, 10, 1},
+	{31106, 813, 7, 1},
+	{31113, 813, 7, 1},
+	{1968, 813, 18, 1},
+	{35315, 813, 6, 1},
+	{229, 813, 6, 1},
+	{6457, 813, 14, 1},
+	{35327, 813, 6, 1},
+	{25135, 813, 8, 1},
+	{4782, 813, 15, 1},
+	{3844, 813, 8, 1},
+	{25207, 813, 8, 1},
+	{2679, 813, 10, 1},
+	{2679, 813, 17, 1},
+	{6485, 813, 14, 1},
+	{1505, 813, 10, 1},
+	{1505, 813, 12, 1},
+	{1114, 813, 7, 1},
+	{3644, 813, 16, 1},
+	{25287, 813, 8, 1},
+	{6493, 813, 5, 1},
+	{16912, 813, 10, 1},
+	{10267, 813, 12, 1},
+	{8272, 813, 13, 1},
+	{10303, 813, 6, 1},
+	{10303, 813, 7, 1},
+	{10303, 813, 12, 1},
+	{10315, 813, 12, 1},
+	{10339, 813, 12, 1},
+	{13501, 813, 11, 1},
+	{41346, 813, 4, 1},
+	{98, 813, 4, 1},
+	{20839, 813, 9, 1},
+	{31456, 813, 7, 1},
+	{20929, 813, 9, 1},
+	{20947, 813, 9, 1},
+	{31477, 813, 7, 1},
+	{20956, 813, 6, 1},
+	{20956, 813, 9, 1},
+	{42222, 813, 3, 1},
+	{17042, 813, 10, 1},
+	{31491, 813, 7, 1},
+	{13644, 813, 11, 1},
+	{17062, 813, 10, 1},
+	{41386, 813, 4, 1},
+	{35657, 813, 6, 1},
+	{21028, 813, 9, 1},
+	{33482, 813, 4, 1},
+	{17242, 813, 10, 1},
+	{39370, 813, 5, 1},
+	{6695, 813, 5, 1},
+	{8454, 813, 13, 1},
+	{6695, 813, 14, 1},
+	{39450, 813, 5, 1},
+	{35909, 813, 6, 1},
+	{31855, 813, 7, 1},
+	{17302, 813, 10, 1},
+	{35933, 813, 6, 1},
+	{41474, 813, 4, 1},
+	{31883, 813, 7, 1},
+	{13776, 813, 11, 1},
+	{31974, 813, 7, 1},
+	{23778, 813, 4, 1},
+	{5399, 813, 6, 1},
+	{5399, 813, 13, 1},
+	{10711, 813, 12, 1},
+	{36029, 813, 6, 1},
+	{17372, 813, 10, 1},
+	{36035, 813, 6, 1},
+	{26279, 813, 8, 1},
+	{32016, 813, 7, 1},
+	{17392, 813, 10, 1},
+	{36065, 813, 6, 1},
+	{22248, 813, 3, 1},
+	{36089, 813, 6, 1},
+	{26327, 813, 8, 1},
+	{17452, 813, 10, 1},
+	{26335, 813, 7, 1},
+	{26335, 813, 8, 1},
+	{41518, 813, 4, 1},
+	{32079, 813, 7, 1},
+	{26343, 813, 8, 1},
+	{26351, 813, 8, 1},
+	{26383, 813, 8, 1},
+	{17472, 813, 10, 1},
+	{21595, 813, 5, 1},
+	{32149, 813, 7, 1},
+	{1498, 813, 19, 1},
+	{36179, 813, 6, 1},
+	{26455, 813, 8, 1},
+	{21622, 813, 9, 1},
+	{26487, 813, 8, 1},
+	{13864, 813, 11, 1},
+	{26495, 813, 8, 1},
+	{13781, 813, 4, 1},
+	{36281, 813, 6, 1},
+	{36287, 813, 6, 1},
+	{21676, 813, 9, 1},
+	{32198, 813, 7, 1},
+	{10103, 813, 8, 1},
+	{36401, 813, 6, 1},
+	{26357, 813, 4, 1},
+	{39665, 813, 5, 1},
+	{26591, 813, 8, 1},
+	{17632, 813, 10, 1},
+	{26599, 813, 8, 1},
+	{36431, 813, 6, 1},
+	{13930, 813, 10, 1},
+	{26663, 813, 8, 1},
+	{13185, 813, 8, 1},
+	{26671, 813, 8, 1},
+	{36461, 813, 6, 1},
+	{36479, 813, 6, 1},
+	{10795, 813, 12, 1},
+	{3788, 813, 16, 1},
+	{8329, 813, 5, 1},
+	{3820, 813, 8, 1},
+	{3820, 813, 16, 1},
+	{3836, 813, 16, 1},
+	{6779, 813, 14, 1},
+	{1107, 813, 14, 1},
+	{1107, 813, 20, 1},
+	{5127, 813, 15, 1},
+	{2138, 813, 6, 1},
+	{2815, 813, 17, 1},
+	{1517, 813, 19, 1},
+	{26887, 813, 8, 1},
+	{39770, 813, 5, 1},
+	{26919, 813, 8, 1},
+	{39785, 813, 5, 1},
+	{10879, 813, 12, 1},
+	{21874, 813, 9, 1},
+	{21883, 813, 9, 1},
+	{32401, 813, 7, 1},
+	{21892, 813, 9, 1},
+	{32408, 813, 7, 1},
+	{36647, 813, 6, 1},
+	{32492, 813, 7, 1},
+	{134, 813, 5, 1},
+	{42279, 813, 3, 1},
+	{29830, 813, 3, 1},
+	{41626, 813, 4, 1},
+	{8662, 813, 13, 1},
+	{5142, 813, 15, 1},
+	{39915, 813, 5, 1},
+	{6871, 813, 6, 1},
+	{32646, 813, 7, 1},
+	{32660, 813, 7, 1},
+	{14117, 813, 6, 1},
+	{14117, 813, 11, 1},
+	{39950, 813, 5, 1},
+	{36875, 813, 6, 1},
+	{32723, 813, 7, 1},
+	{22099, 813, 9, 1},
+	{36893, 813, 6, 1},
+	{40005, 813, 5, 1},
+	{14161, 813, 11, 1},
+	{36905, 813, 6, 1},
+	{40010, 813, 5, 1},
+	{27231, 813, 8, 1},
+	{27247, 813, 8, 1},
+	{3868, 813, 12, 1},
+	{3868, 813, 16, 1},
+	{22135, 813, 9, 1},
+	{32758, 813, 7, 1},
+	{14205, 813, 11, 1},
+	{36959, 813, 6, 1},
+	{17922, 813, 10, 1},
+	{14216, 813, 11, 1},
+	{17932, 813, 10, 1},
+	{36977, 813, 6, 1},
+	{40075, 813, 5, 1},
+	{36995, 813, 6, 1},
+	{27351, 813, 8, 1},
+	{17962, 813, 10, 1},
+	{67, 813, 28, 1},
+	{11047, 813, 12, 1},
+	{27359, 813, 8, 1},
+	{4357, 813, 5, 1},
+	{8109, 813, 7, 1},
+	{4969, 813, 6, 1},
+	{40115, 813, 5, 1},
+	{37049, 813, 6, 1},
+	{27423, 813, 8, 1},
+	{32856, 813, 7, 1},
+	{27503, 813, 8, 1},
+	{18072, 813, 10, 1},
+	{11143, 813, 12, 1},
+	{22306, 813, 9, 1},
+	{32968, 813, 7, 1},
+	{5226, 813, 4, 1},
+	{37163, 813, 6, 1},
+	{18112, 813, 10, 1},
+	{20951, 813, 5, 1},
+	{11239, 813, 12, 1},
+	{27567, 813, 8, 1},
+	{27607, 813, 8, 1},
+	{11263, 813, 12, 1},
+	{11275, 813, 12, 1},
+	{22342, 813, 9, 1},
+	{33052, 813, 7, 1},
+	{11287, 813, 12, 1},
+	{41742, 813, 4, 1},
+	{18162, 813, 10, 1},
+	{11299, 813, 12, 1},
+	{14392, 813, 11, 1},
+	{14403, 813, 11, 1},
+	{22378, 813, 6, 1},
+	{33108, 813, 7, 1},
+	{2112, 813, 7, 1},
+	{5232, 813, 15, 1},
+	{2917, 813, 17, 1},
+	{2112, 813, 18, 1},
+	{6891, 813, 13, 1},
+	{6891, 813, 14, 1},
+	{6905, 813, 14, 1},
+	{2130, 813, 8, 1},
+	{2130, 813, 18, 1},
+	{27663, 813, 8, 1},
+	{33122, 813, 7, 1},
+	{18252, 813, 10, 1},
+	{27759, 813, 8, 1},
+	{40355, 813, 5, 1},
+	{18272, 813, 10, 1},
+	{33234, 813, 7, 1},
+	{41778, 813, 4, 1},
+	{6680, 813, 3, 1},
+	{40390, 813, 5, 1},
+	{2689, 813, 7, 1},
+	{33311, 813, 7, 1},
+	{6947, 813, 14, 1},
+	{8922, 813, 13, 1},
+	{22729, 813, 9, 1},
+	{1406, 813, 5, 1},
+	{22738, 813, 3, 1},
+	{33332, 813, 6, 1},
+	{28515, 813, 5, 1},
+	{27999, 813, 8, 1},
+	{22747, 813, 9, 1},
+	{5262, 813, 5, 1},
+	{5262, 813, 15, 1},
+	{1240, 813, 7, 1},
+	{40475, 813, 5, 1},
+	{18392, 813, 10, 1},
+	{37457, 813, 6, 1},
+	{22810, 813, 9, 1},
+	{11419, 813, 12, 1},
+	{22837, 813, 9, 1},
+	{37487, 813, 6, 1},
+	{11455, 813, 12, 1},
+	{37523, 813, 6, 1},
+	{28095, 813, 8, 1},
+	{37565, 813, 6, 1},
+	{37571, 813, 6, 1},
+	{41834, 813, 4, 1},
+	{42393, 813, 3, 1},
+	{18492, 813, 10, 1},
+	{2951, 813, 17, 1},
+	{18512, 813, 10, 1},
+	{40575, 813, 5, 1},
+	{33521, 813, 7, 1},
+	{33528, 813, 7, 1},
+	{5991, 813, 4, 1},
+	{14612, 813, 11, 1},
+	{28439, 813, 8, 1},
+	{37781, 813, 6, 1},
+	{27753, 813, 5, 1},
+	{3932, 813, 4, 1},
+	{18572, 813, 9, 1},
+	{41878, 813, 4, 1},
+	{33710, 813, 7, 1},
+	{33717, 813, 5, 1},
+	{33717, 813, 7, 1},
+	{6466, 813, 5, 1},
+	{42417, 813, 3, 1},
+	{28607, 813, 8, 1},
+	{18602, 813, 10, 1},
+	{5113, 813, 3, 1},
+	{18612, 813, 10, 1},
+	{37949, 813, 6, 1},
+	{5382, 813, 15, 1},
+	{23134, 813, 9, 1},
+	{4044, 813, 16, 1},
+	{28639, 813, 8, 1},
+	{23143, 813, 9, 1},
+	{33815, 813, 7, 1},
+	{5397, 813, 15, 1},
+	{41930, 813, 4, 1},
+	{41934, 813, 4, 1},
+	{3398, 813, 6, 1},
+	{37985, 813, 6, 1},
+	{18672, 813, 10, 1},
+	{38051, 813, 6, 1},
+	{33871, 813, 7, 1},
+	{28727, 813, 8, 1},
+	{9078, 813, 7, 1},
+	{33885, 813, 7, 1},
+	{18702, 813, 10, 1},
+	{14744, 813, 11, 1},
+	{40820, 813, 5, 1},
+	{28767, 813, 8, 1},
+	{5273, 813, 3, 1},
+	{11671, 813, 12, 1},
+	{5412, 813, 15, 1},
+	{9091, 813, 13, 1},
+	{2081, 813, 7, 1},
+	{23251, 813, 9, 1},
+	{33983, 813, 7, 1},
+	{28823, 813, 8, 1},
+	{1035, 813, 12, 1},
+	{28831, 813, 8, 1},
+	{28847, 813, 8, 1},
+	{7101, 813, 14, 1},
+	{1247, 813, 20, 1},
+	{0, 813, 36, 1},
+	{19062, 813, 10, 1},
+	{15360, 813, 11, 1},
+	{23593, 813, 4, 1},
+	{23593, 813, 9, 1},
+	{28991, 813, 8, 1},
+	{40895, 813, 5, 1},
+	{19362, 813, 10, 1},
+	{34137, 813, 7, 1},
+	{19390, 816, 4, 1},
+	{38535, 816, 3, 1},
+	{19, 816, 3, 1},
+	{12918, 816, 4, 1},
+	{9778, 816, 3, 1},
+	{810, 816, 3, 1},
+	{21606, 816, 4, 1},
+	{2022, 816, 3, 1},
+	{6019, 816, 3, 1},
+	{1121, 816, 6, 1},
+	{17722, 816, 4, 1},
+	{2944, 816, 3, 1},
+	{6352, 816, 3, 1},
+	{5042, 816, 3, 1},
+	{35, 817, 2, 1},
+	{38535, 817, 3, 1},
+	{4, 817, 2, 1},
+	{19, 817, 3, 1},
+	{12918, 817, 4, 1},
+	{9778, 817, 3, 1},
+	{810, 817, 3, 1},
+	{2022, 817, 3, 1},
+	{1121, 817, 6, 1},
+	{2944, 817, 3, 1},
+	{6352, 817, 3, 1},
+	{23967, 818, 8, 9},
+	{19, 818, 3, 1},
+	{9778, 818, 3, 1},
+	{38533, 818, 3, 1},
+	{2944, 818, 3, 1},
+	{6352, 818, 3, 1},
+	{38535, 819, 3, 1},
+	{23967, 819, 8, 9},
+	{19, 819, 3, 1},
+	{9778, 819, 3, 1},
+	{810, 819, 3, 1},
+	{6019, 819, 3, 1},
+	{17722, 819, 4, 1},
+	{2944, 819, 3, 1},
+	{6352, 819, 3, 1},
+	{35, 820, 2, 1},
+	{729, 820, 3, 1},
+	{4, 820, 2, 1},
+	{9778, 820, 3, 1},
+	{810, 820, 3, 1},
+	{6019, 820, 3, 1},
+	{2944, 820, 3, 1},
+	{6352, 820, 3, 1},
+	{25, 821, 2, 1},
+	{456, 821, 2, 1},
+	{4, 821, 2, 1},
+	{19, 821, 3, 1},
+	{633, 821, 2, 1},
+	{204, 821, 2, 1},
+	{21606, 821, 4, 1},
+	{2103, 821, 4, 1},
+	{4107, 821, 2, 1},
+	{17722, 821, 4, 1},
+	{5, 821, 2, 1},
+	{6352, 821, 3, 1},
+	{5042, 821, 3, 1},
+	{22378, 821, 6, 1},
+	{2443, 821, 2, 1},
+	{767, 821, 2, 1},
+	{988, 821, 2, 1},
+	{1910, 824, 3, 0},
+	{1114, 824, 3, 0},
+	{788, 828, 4, 1},
+	{5080, 828, 3, 1},
+	{7674, 831, 13, 9},
+	{5967, 831, 14, 9},
+	{5981, 831, 14, 9},
+	{34223, 831, 6, 9},
+	{967, 831, 6, 9},
+	{5995, 831, 14, 9},
+	{1878, 831, 10, 9},
+	{1878, 831, 18, 9},
+	{3324, 831, 8, 9},
+	{3324, 831, 16, 9},
+	{967, 831, 12, 9},
+	{967, 831, 20, 9},
+	{2526, 831, 9, 9},
+	{2526, 831, 17, 9},
+	{15932, 831, 10, 9},
+	{34307, 831, 6, 9},
+	{9799, 831, 12, 9},
+	{7752, 831, 13, 0},
+	{9823, 831, 12, 9},
+	{4362, 831, 15, 9},
+	{7765, 831, 13, 9},
+	{40998, 831, 4, 9},
+	{41002, 831, 4, 9},
+	{41006, 831, 4, 9},
+	{12676, 831, 5, 9},
+	{19786, 831, 9, 9},
+	{9859, 831, 12, 9},
+	{29447, 831, 7, 9},
+	{34499, 831, 6, 9},
+	{23999, 831, 8, 9},
+	{29489, 831, 7, 9},
+	{24047, 831, 8, 9},
+	{16142, 831, 10, 9},
+	{29594, 831, 7, 9},
+	{19885, 831, 9, 9},
+	{9883, 831, 5, 0},
+	{19894, 831, 9, 9},
+	{12852, 831, 11, 9},
+	{12885, 831, 11, 9},
+	{12896, 831, 11, 9},
+	{19993, 831, 8, 9},
+	{16302, 831, 10, 9},
+	{6205, 831, 14, 9},
+	{16312, 831, 10, 9},
+	{7908, 831, 13, 9},
+	{7921, 831, 13, 9},
+	{12951, 831, 11, 20},
+	{16442, 831, 10, 9},
+	{24407, 831, 4, 9},
+	{34763, 831, 6, 9},
+	{24439, 831, 8, 9},
+	{24487, 831, 8, 9},
+	{29986, 831, 7, 9},
+	{16502, 831, 5, 9},
+	{30000, 831, 7, 9},
+	{20083, 831, 9, 9},
+	{30042, 831, 7, 9},
+	{24543, 831, 8, 9},
+	{20110, 831, 9, 9},
+	{41146, 831, 4, 9},
+	{38790, 831, 5, 9},
+	{6345, 831, 14, 9},
+	{30084, 831, 7, 9},
+	{4617, 831, 7, 9},
+	{4617, 831, 15, 9},
+	{2611, 831, 9, 9},
+	{2611, 831, 17, 9},
+	{34883, 831, 6, 0},
+	{8038, 831, 13, 9},
+	{24679, 831, 8, 9},
+	{3500, 831, 6, 0},
+	{24687, 831, 8, 9},
+	{16642, 831, 10, 9},
+	{24711, 831, 8, 9},
+	{3532, 831, 16, 9},
+	{10063, 831, 12, 9},
+	{30441, 831, 7, 9},
+	{30455, 831, 7, 9},
+	{30546, 831, 7, 9},
+	{30658, 831, 7, 9},
+	{349, 831, 2, 9},
+	{30882, 831, 7, 9},
+	{10147, 831, 12, 9},
+	{35345, 831, 6, 9},
+	{39130, 831, 5, 9},
+	{31190, 831, 7, 9},
+	{35405, 831, 6, 9},
+	{20677, 831, 9, 9},
+	{25263, 831, 8, 9},
+	{1300, 831, 2, 9},
+	{204, 831, 2, 9},
+	{35507, 831, 6, 9},
+	{13490, 831, 11, 9},
+	{35513, 831, 6, 9},
+	{41342, 831, 4, 9},
+	{31330, 831, 7, 9},
+	{20812, 831, 9, 9},
+	{20821, 831, 9, 9},
+	{25415, 831, 8, 9},
+	{6664, 831, 2, 9},
+	{21136, 831, 9, 9},
+	{25847, 831, 8, 9},
+	{17222, 831, 10, 9},
+	{26007, 831, 8, 9},
+	{13831, 831, 11, 0},
+	{21604, 831, 9, 9},
+	{36203, 831, 6, 9},
+	{21739, 831, 9, 9},
+	{32261, 831, 7, 9},
+	{32275, 831, 7, 9},
+	{21820, 831, 9, 9},
+	{26719, 831, 8, 9},
+	{32296, 831, 7, 9},
+	{21829, 831, 9, 9},
+	{39695, 831, 5, 9},
+	{3804, 831, 16, 9},
+	{10819, 831, 12, 9},
+	{36641, 831, 6, 9},
+	{39820, 831, 5, 9},
+	{32506, 831, 7, 9},
+	{8675, 831, 13, 9},
+	{22018, 831, 9, 9},
+	{42294, 831, 3, 0},
+	{39980, 831, 5, 9},
+	{36941, 831, 6, 9},
+	{32800, 831, 7, 9},
+	{220, 831, 24, 9},
+	{27415, 831, 8, 9},
+	{18062, 831, 10, 9},
+	{6863, 831, 14, 9},
+	{39, 831, 2, 9},
+	{14381, 831, 11, 0},
+	{18172, 831, 10, 0},
+	{18192, 831, 10, 9},
+	{8805, 831, 13, 9},
+	{94, 831, 2, 9},
+	{37271, 831, 6, 9},
+	{37283, 831, 6, 9},
+	{27687, 831, 8, 9},
+	{18222, 831, 10, 9},
+	{27695, 831, 8, 9},
+	{22423, 831, 9, 9},
+	{27703, 831, 8, 9},
+	{6933, 831, 14, 9},
+	{18322, 831, 10, 9},
+	{27887, 831, 8, 9},
+	{33332, 831, 7, 9},
+	{41810, 831, 4, 0},
+	{8948, 831, 13, 9},
+	{28063, 831, 8, 9},
+	{18017, 831, 5, 9},
+	{28135, 831, 8, 9},
+	{22891, 831, 9, 0},
+	{28367, 831, 8, 9},
+	{18552, 831, 10, 9},
+	{70, 831, 2, 9},
+	{28527, 831, 8, 0},
+	{37895, 831, 6, 9},
+	{6692, 831, 2, 9},
+	{41898, 831, 4, 9},
+	{38087, 831, 6, 9},
+	{28743, 831, 8, 9},
+	{38147, 831, 6, 9},
+	{15789, 831, 11, 9},
+	{739, 831, 2, 9},
+	{38365, 834, 5, 20},
+	{40982, 834, 4, 9},
+	{29321, 834, 7, 9},
+	{4, 834, 2, 9},
+	{41858, 834, 4, 9},
+	{17802, 837, 10, 9},
+	{4056, 841, 4, 1},
+	{19, 841, 3, 1},
+	{24743, 841, 4, 1},
+	{21606, 841, 4, 1},
+	{2944, 841, 3, 1},
+	{29519, 841, 5, 1},
+	{1092, 841, 3, 1},
+	{2808, 841, 3, 1},
+	{10046, 841, 5, 1},
+	{123, 841, 3, 1},
+	{1027, 843, 3, 9},
+	{19, 843, 3, 1},
+	{9778, 843, 3, 1},
+	{24743, 843, 4, 9},
+	{324, 843, 3, 9},
+	{810, 843, 3, 1},
+	{9, 843, 1, 1},
+	{33033, 843, 3, 9},
+	{6019, 843, 3, 1},
+	{2103, 843, 4, 1},
+	{17722, 843, 4, 1},
+	{2944, 843, 3, 1},
+	{12810, 843, 3, 9},
+	{6352, 843, 3, 1},
+	{1512, 843, 3, 1},
+	{35, 846, 2, 1},
+	{38535, 846, 3, 1},
+	{4, 846, 2, 1},
+	{19, 846, 3, 1},
+	{9778, 846, 3, 1},
+	{38533, 846, 3, 1},
+	{204, 846, 2, 1},
+	{21606, 846, 4, 1},
+	{2022, 846, 3, 1},
+	{6019, 846, 3, 1},
+	{2944, 846, 3, 1},
+	{5080, 846, 3, 1},
+	{6352, 846, 3, 1},
+	{123, 846, 3, 1},
+	{15842, 853, 10, 9},
+	{23967, 853, 8, 9},
+	{29741, 853, 7, 9},
+	{4, 853, 2, 9},
+	{38745, 853, 5, 9},
+	{810, 853, 3, 9},
+	{4872, 853, 15, 9},
+	{35741, 853, 6, 9},
+	{10819, 853, 12, 9},
+	{28495, 853, 8, 20},
+	{7661, 854, 13, 9},
+	{1402, 854, 2, 1},
+	{23655, 854, 8, 1},
+	{34187, 854, 6, 1},
+	{18686, 854, 6, 1},
+	{29097, 854, 7, 1},
+	{2678, 854, 2, 1},
+	{23743, 854, 8, 0},
+	{15902, 854, 10, 1},
+	{23751, 854, 8, 1},
+	{106, 854, 2, 1},
+	{19426, 854, 9, 1},
+	{29153, 854, 7, 1},
+	{4399, 854, 6, 1},
+	{19453, 854, 9, 1},
+	{7818, 854, 4, 1},
+	{34259, 854, 6, 1},
+	{11435, 854, 4, 1},
+	{18465, 854, 4, 1},
+	{19516, 854, 9, 1},
+	{34271, 854, 6, 1},
+	{37218, 854, 5, 1},
+	{21536, 854, 5, 1},
+	{29195, 854, 7, 1},
+	{29202, 854, 7, 1},
+	{21533, 854, 4, 1},
+	{34331, 854, 6, 1},
+	{38405, 854, 5, 1},
+	{38410, 854, 5, 1},
+	{38415, 854, 5, 1},
+	{29237, 854, 7, 1},
+	{38420, 854, 5, 1},
+	{19651, 854, 9, 1},
+	{38440, 854, 5, 1},
+	{40990, 854, 4, 1},
+	{29272, 854, 7, 1},
+	{6065, 854, 14, 1},
+	{19660, 854, 9, 1},
+	{19678, 854, 9, 1},
+	{34373, 854, 6, 1},
+	{23871, 854, 8, 1},
+	{12643, 854, 11, 1},
+	{9847, 854, 12, 1},
+	{34391, 854, 6, 1},
+	{29349, 854, 7, 1},
+	{38460, 854, 5, 1},
+	{16012, 854, 10, 1},
+	{19696, 854, 9, 1},
+	{19705, 854, 9, 1},
+	{34397, 854, 6, 1},
+	{38470, 854, 5, 1},
+	{38475, 854, 5, 1},
+	{19750, 854, 9, 1},
+	{12720, 854, 11, 1},
+	{34421, 854, 6, 1},
+	{34439, 854, 6, 1},
+	{5914, 854, 4, 1},
+	{34445, 854, 6, 1},
+	{23935, 854, 8, 1},
+	{34463, 854, 6, 1},
+	{34487, 854, 6, 1},
+	{23951, 854, 8, 1},
+	{29440, 854, 7, 1},
+	{19804, 854, 9, 1},
+	{38540, 854, 5, 1},
+	{23967, 854, 8, 9},
+	{41034, 854, 4, 1},
+	{41042, 854, 4, 1},
+	{38555, 854, 5, 1},
+	{19831, 854, 9, 1},
+	{12797, 854, 7, 1},
+	{12797, 854, 11, 1},
+	{16132, 854, 10, 1},
+	{38565, 854, 5, 1},
+	{525, 854, 2, 1},
+	{29531, 854, 7, 1},
+	{24087, 854, 8, 0},
+	{29559, 854, 7, 1},
+	{38580, 854, 5, 1},
+	{16152, 854, 10, 1},
+	{4, 854, 2, 9},
+	{12962, 854, 11, 1},
+	{16462, 854, 10, 1},
+	{34757, 854, 6, 1},
+	{479, 854, 3, 1},
+	{7960, 854, 13, 1},
+	{10003, 854, 12, 1},
+	{7973, 854, 13, 1},
+	{38760, 854, 5, 1},
+	{38770, 854, 5, 1},
+	{30028, 854, 7, 1},
+	{20092, 854, 9, 1},
+	{34817, 854, 6, 1},
+	{38795, 854, 5, 1},
+	{24583, 854, 8, 1},
+	{17719, 854, 3, 1},
+	{24599, 854, 8, 1},
+	{24607, 854, 8, 1},
+	{30105, 854, 7, 1},
+	{24615, 854, 8, 1},
+	{20155, 854, 9, 1},
+	{30126, 854, 7, 1},
+	{30161, 854, 7, 1},
+	{24623, 854, 8, 1},
+	{30196, 854, 4, 1},
+	{30196, 854, 7, 1},
+	{24663, 854, 8, 1},
+	{34919, 854, 6, 1},
+	{4677, 854, 15, 1},
+	{30238, 854, 7, 1},
+	{34937, 854, 6, 1},
+	{38870, 854, 5, 1},
+	{2586, 854, 3, 1},
+	{30266, 854, 7, 1},
+	{41190, 854, 3, 1},
+	{34949, 854, 6, 1},
+	{34955, 854, 6, 1},
+	{34961, 854, 6, 1},
+	{10187, 854, 5, 1},
+	{4517, 854, 3, 1},
+	{24751, 854, 8, 1},
+	{20254, 854, 9, 1},
+	{13270, 854, 11, 1},
+	{24767, 854, 8, 1},
+	{38905, 854, 5, 1},
+	{38910, 854, 5, 1},
+	{20844, 854, 2, 1},
+	{20263, 854, 9, 1},
+	{30357, 854, 7, 1},
+	{38915, 854, 5, 1},
+	{30385, 854, 7, 1},
+	{35003, 854, 6, 1},
+	{38930, 854, 5, 1},
+	{13314, 854, 11, 1},
+	{24831, 854, 4, 1},
+	{38935, 854, 5, 1},
+	{30413, 854, 7, 1},
+	{35009, 854, 6, 1},
+	{38940, 854, 5, 1},
+	{30826, 854, 7, 1},
+	{30833, 854, 7, 1},
+	{22527, 854, 4, 1},
+	{16712, 854, 10, 1},
+	{24951, 854, 8, 1},
+	{20425, 854, 9, 1},
+	{38970, 854, 5, 1},
+	{35051, 854, 6, 1},
+	{16722, 854, 10, 1},
+	{35057, 854, 6, 1},
+	{30847, 854, 7, 1},
+	{8155, 854, 13, 1},
+	{20452, 854, 9, 1},
+	{39000, 854, 5, 1},
+	{30910, 854, 7, 1},
+	{24975, 854, 8, 1},
+	{24983, 854, 8, 1},
+	{30917, 854, 7, 1},
+	{35129, 854, 6, 1},
+	{30931, 854, 7, 1},
+	{20077, 854, 3, 1},
+	{7837, 854, 4, 1},
+	{39050, 854, 5, 1},
+	{31008, 854, 7, 1},
+	{20488, 854, 9, 1},
+	{25015, 854, 8, 1},
+	{39065, 854, 5, 1},
+	{41282, 854, 4, 1},
+	{39080, 854, 5, 1},
+	{8181, 854, 13, 1},
+	{599, 854, 2, 1},
+	{35195, 854, 6, 1},
+	{35213, 854, 6, 1},
+	{16792, 854, 10, 1},
+	{35237, 854, 6, 1},
+	{39100, 854, 5, 1},
+	{31099, 854, 5, 1},
+	{31099, 854, 7, 1},
+	{10171, 854, 12, 1},
+	{16812, 854, 10, 1},
+	{35267, 854, 6, 1},
+	{17408, 854, 5, 1},
+	{35279, 854, 6, 1},
+	{31127, 854, 7, 1},
+	{35309, 854, 6, 1},
+	{10183, 854, 12, 1},
+	{20569, 854, 9, 1},
+	{31141, 854, 7, 0},
+	{35333, 854, 5, 1},
+	{35333, 854, 6, 1},
+	{25143, 854, 8, 1},
+	{3163, 854, 5, 1},
+	{39145, 854, 5, 1},
+	{25215, 854, 8, 1},
+	{16882, 854, 10, 1},
+	{874, 854, 2, 1},
+	{1711, 854, 2, 1},
+	{39150, 854, 5, 1},
+	{29549, 854, 3, 1},
+	{25231, 854, 8, 1},
+	{5536, 854, 3, 1},
+	{41314, 854, 4, 1},
+	{13479, 854, 11, 1},
+	{25247, 854, 8, 1},
+	{25279, 854, 8, 1},
+	{20704, 854, 9, 0},
+	{20713, 854, 9, 1},
+	{35423, 854, 6, 1},
+	{25319, 854, 8, 1},
+	{20731, 854, 9, 1},
+	{35441, 854, 6, 1},
+	{39175, 854, 5, 1},
+	{35447, 854, 6, 1},
+	{20740, 854, 9, 1},
+	{31239, 854, 7, 1},
+	{35459, 854, 6, 1},
+	{31316, 854, 7, 1},
+	{31421, 854, 7, 1},
+	{41350, 854, 4, 1},
+	{20911, 854, 9, 1},
+	{25495, 854, 8, 1},
+	{25503, 854, 8, 1},
+	{31484, 854, 7, 1},
+	{21695, 854, 6, 1},
+	{20974, 854, 9, 1},
+	{31505, 854, 7, 1},
+	{17122, 854, 10, 1},
+	{25719, 854, 8, 1},
+	{31582, 854, 7, 1},
+	{35675, 854, 6, 1},
+	{17152, 854, 10, 1},
+	{25863, 854, 8, 1},
+	{39350, 854, 5, 1},
+	{39355, 854, 5, 1},
+	{31750, 854, 7, 1},
+	{21217, 854, 9, 1},
+	{13732, 854, 11, 1},
+	{25983, 854, 8, 1},
+	{21244, 854, 9, 1},
+	{31785, 854, 7, 1},
+	{10639, 854, 12, 1},
+	{10651, 854, 12, 1},
+	{17272, 854, 10, 1},
+	{10663, 854, 12, 1},
+	{26159, 854, 8, 1},
+	{26167, 854, 8, 1},
+	{41462, 854, 4, 1},
+	{21316, 854, 9, 1},
+	{21325, 854, 9, 1},
+	{17292, 854, 10, 1},
+	{21334, 854, 9, 1},
+	{31834, 854, 7, 1},
+	{10687, 854, 12, 1},
+	{35915, 854, 6, 1},
+	{26191, 854, 8, 1},
+	{35939, 854, 6, 1},
+	{35945, 854, 6, 1},
+	{31904, 854, 7, 1},
+	{26207, 854, 8, 1},
+	{13765, 854, 11, 1},
+	{31918, 854, 7, 1},
+	{21397, 854, 9, 1},
+	{21406, 854, 9, 1},
+	{31939, 854, 7, 1},
+	{20079, 854, 4, 1},
+	{31946, 854, 7, 1},
+	{35981, 854, 6, 1},
+	{35987, 854, 6, 1},
+	{39500, 854, 5, 1},
+	{26223, 854, 8, 1},
+	{35993, 854, 4, 1},
+	{35993, 854, 6, 1},
+	{13787, 854, 11, 1},
+	{21433, 854, 9, 1},
+	{35999, 854, 6, 1},
+	{21451, 854, 9, 1},
+	{36005, 854, 6, 1},
+	{26247, 854, 8, 1},
+	{17640, 854, 3, 1},
+	{39545, 854, 5, 1},
+	{21514, 854, 9, 1},
+	{39550, 854, 5, 1},
+	{26295, 854, 4, 1},
+	{36053, 854, 6, 1},
+	{39575, 854, 5, 1},
+	{4881, 854, 6, 1},
+	{32030, 854, 7, 1},
+	{36071, 854, 6, 1},
+	{13820, 854, 11, 1},
+	{32065, 854, 7, 1},
+	{36107, 854, 6, 1},
+	{36119, 854, 6, 1},
+	{36137, 854, 6, 1},
+	{21532, 854, 9, 1},
+	{17482, 854, 10, 1},
+	{39605, 854, 5, 1},
+	{8519, 854, 13, 1},
+	{16886, 854, 6, 1},
+	{36191, 854, 6, 1},
+	{36197, 854, 6, 1},
+	{39625, 854, 5, 1},
+	{32163, 854, 7, 1},
+	{32177, 854, 7, 1},
+	{6737, 854, 14, 1},
+	{6019, 854, 3, 1},
+	{21694, 854, 9, 1},
+	{21703, 854, 9, 1},
+	{32212, 854, 7, 1},
+	{32219, 854, 7, 1},
+	{39655, 854, 5, 1},
+	{39660, 854, 5, 1},
+	{5097, 854, 15, 0},
+	{32240, 854, 7, 1},
+	{26647, 854, 8, 1},
+	{41554, 854, 4, 1},
+	{36437, 854, 6, 1},
+	{569, 854, 2, 1},
+	{36467, 854, 6, 1},
+	{1121, 854, 6, 1},
+	{10819, 854, 12, 9},
+	{6765, 854, 14, 1},
+	{17712, 854, 10, 1},
+	{36569, 854, 6, 1},
+	{17732, 854, 10, 1},
+	{21856, 854, 9, 1},
+	{39760, 854, 5, 1},
+	{26879, 854, 8, 1},
+	{36599, 854, 6, 1},
+	{26895, 854, 8, 1},
+	{26903, 854, 8, 1},
+	{13985, 854, 11, 1},
+	{39780, 854, 5, 1},
+	{26927, 854, 8, 1},
+	{10867, 854, 12, 1},
+	{32366, 854, 7, 1},
+	{36629, 854, 6, 1},
+	{26991, 854, 8, 1},
+	{26999, 854, 8, 1},
+	{5838, 854, 2, 1},
+	{14029, 854, 11, 1},
+	{21973, 854, 9, 1},
+	{21982, 854, 9, 1},
+	{32485, 854, 7, 1},
+	{27023, 854, 8, 1},
+	{27031, 854, 8, 0},
+	{14040, 854, 11, 1},
+	{21991, 854, 9, 1},
+	{8636, 854, 13, 1},
+	{27063, 854, 8, 1},
+	{27079, 854, 8, 1},
+	{50, 854, 2, 1},
+	{41634, 854, 4, 1},
+	{1015, 854, 2, 1},
+	{36773, 854, 6, 1},
+	{214, 854, 2, 1},
+	{17822, 854, 10, 1},
+	{36827, 854, 6, 1},
+	{27175, 854, 8, 1},
+	{27191, 854, 8, 1},
+	{36839, 854, 6, 1},
+	{36845, 854, 6, 1},
+	{36851, 854, 6, 1},
+	{18469, 854, 5, 1},
+	{29861, 854, 4, 1},
+	{41654, 854, 4, 1},
+	{36863, 854, 6, 1},
+	{32688, 854, 7, 1},
+	{32695, 854, 7, 0},
+	{14139, 854, 11, 1},
+	{22081, 854, 9, 1},
+	{17892, 854, 10, 1},
+	{41662, 854, 4, 1},
+	{27207, 854, 8, 1},
+	{8701, 854, 13, 1},
+	{22189, 854, 9, 1},
+	{27343, 854, 8, 1},
+	{22198, 854, 9, 1},
+	{220, 854, 4, 1},
+	{7945, 854, 4, 1},
+	{40135, 854, 5, 1},
+	{14304, 854, 11, 1},
+	{37067, 854, 6, 1},
+	{33021, 854, 5, 1},
+	{22225, 854, 9, 1},
+	{27439, 854, 8, 1},
+	{3818, 854, 4, 1},
+	{22234, 854, 9, 1},
+	{40140, 854, 5, 1},
+	{27487, 854, 8, 1},
+	{32905, 854, 7, 1},
+	{27495, 854, 8, 1},
+	{37121, 854, 6, 1},
+	{32961, 854, 7, 1},
+	{22279, 854, 9, 1},
+	{22288, 854, 9, 1},
+	{40170, 854, 5, 1},
+	{40175, 854, 5, 1},
+	{640, 854, 2, 1},
+	{28504, 854, 4, 1},
+	{40200, 854, 5, 1},
+	{37139, 854, 6, 1},
+	{37860, 854, 5, 1},
+	{32975, 854, 7, 1},
+	{40205, 854, 5, 1},
+	{22759, 854, 4, 1},
+	{37151, 854, 6, 1},
+	{32982, 854, 7, 1},
+	{37157, 854, 6, 1},
+	{40220, 854, 5, 1},
+	{27559, 854, 8, 1},
+	{24658, 854, 5, 1},
+	{33031, 854, 7, 1},
+	{22324, 854, 9, 1},
+	{18132, 854, 10, 1},
+	{1806, 854, 7, 1},
+	{11251, 854, 12, 1},
+	{37217, 854, 6, 1},
+	{22351, 854, 9, 1},
+	{40300, 854, 5, 1},
+	{27655, 854, 8, 1},
+	{3451, 854, 3, 1},
+	{40325, 854, 5, 1},
+	{40330, 854, 5, 1},
+	{33129, 854, 7, 1},
+	{4082, 854, 2, 1},
+	{33248, 854, 7, 1},
+	{37379, 854, 6, 1},
+	{37385, 854, 6, 1},
+	{37391, 854, 6, 1},
+	{37397, 854, 6, 1},
+	{27895, 854, 8, 1},
+	{40375, 854, 5, 1},
+	{8896, 854, 7, 1},
+	{8896, 854, 13, 1},
+	{6680, 854, 3, 1},
+	{40380, 854, 5, 1},
+	{33269, 854, 7, 1},
+	{27903, 854, 8, 1},
+	{40385, 854, 5, 1},
+	{27911, 854, 8, 1},
+	{37403, 854, 6, 1},
+	{33283, 854, 7, 1},
+	{40415, 854, 5, 1},
+	{37415, 854, 6, 1},
+	{40420, 854, 5, 1},
+	{18362, 854, 10, 1},
+	{37421, 854, 6, 1},
+	{33297, 854, 7, 1},
+	{40435, 854, 5, 1},
+	{33304, 854, 7, 1},
+	{40440, 854, 4, 1},
+	{37433, 854, 6, 1},
+	{40445, 854, 5, 1},
+	{14502, 854, 11, 1},
+	{22702, 854, 9, 1},
+	{18372, 854, 10, 1},
+	{27943, 854, 8, 1},
+	{27951, 854, 8, 1},
+	{11371, 854, 12, 1},
+	{33325, 854, 7, 1},
+	{27967, 854, 8, 1},
+	{27975, 854, 8, 1},
+	{40455, 854, 5, 1},
+	{18382, 854, 10, 1},
+	{22738, 854, 9, 1},
+	{53, 854, 2, 1},
+	{37445, 854, 6, 1},
+	{1240, 854, 4, 1},
+	{22783, 854, 9, 1},
+	{22792, 854, 9, 1},
+	{33353, 854, 7, 1},
+	{33360, 854, 7, 1},
+	{22801, 854, 9, 1},
+	{5277, 854, 8, 1},
+	{5277, 854, 15, 1},
+	{37463, 854, 6, 1},
+	{14524, 854, 11, 1},
+	{33374, 854, 5, 1},
+	{33374, 854, 7, 1},
+	{22828, 854, 9, 1},
+	{13484, 854, 6, 1},
+	{33381, 854, 7, 1},
+	{40485, 854, 5, 1},
+	{20032, 854, 4, 1},
+	{37499, 854, 6, 1},
+	{2337, 854, 4, 1},
+	{33388, 854, 7, 1},
+	{28079, 854, 8, 1},
+	{28087, 854, 8, 1},
+	{40510, 854, 5, 1},
+	{33416, 854, 7, 1},
+	{22864, 854, 9, 1},
+	{6683, 854, 4, 1},
+	{28303, 854, 8, 1},
+	{28343, 854, 8, 0},
+	{5991, 854, 4, 1},
+	{28375, 854, 8, 1},
+	{41850, 854, 4, 1},
+	{22963, 854, 9, 1},
+	{40595, 854, 5, 1},
+	{2797, 854, 2, 1},
+	{37464, 854, 5, 1},
+	{40625, 854, 5, 1},
+	{28431, 854, 8, 1},
+	{33598, 854, 7, 1},
+	{199, 854, 2, 1},
+	{40650, 854, 5, 1},
+	{37835, 854, 6, 1},
+	{37841, 854, 6, 1},
+	{28503, 854, 8, 1},
+	{28511, 854, 8, 1},
+	{37859, 854, 6, 1},
+	{37865, 854, 6, 1},
+	{23053, 854, 9, 1},
+	{37871, 854, 6, 1},
+	{14656, 854, 11, 1},
+	{40680, 854, 5, 1},
+	{37901, 854, 6, 1},
+	{28559, 854, 8, 1},
+	{37907, 854, 6, 1},
+	{37913, 854, 6, 1},
+	{18582, 854, 10, 1},
+	{18592, 854, 10, 1},
+	{40705, 854, 5, 1},
+	{33794, 854, 7, 1},
+	{37967, 854, 6, 1},
+	{114, 854, 2, 1},
+	{33836, 854, 7, 1},
+	{40765, 854, 5, 1},
+	{40770, 854, 4, 1},
+	{40770, 854, 5, 1},
+	{37979, 854, 6, 1},
+	{33843, 854, 7, 1},
+	{950, 854, 5, 1},
+	{14760, 854, 4, 1},
+	{28663, 854, 8, 1},
+	{40775, 854, 5, 1},
+	{33850, 854, 7, 1},
+	{40780, 854, 5, 1},
+	{40785, 854, 5, 1},
+	{22435, 854, 4, 1},
+	{23179, 854, 9, 1},
+	{28679, 854, 8, 1},
+	{38015, 854, 6, 1},
+	{38027, 854, 6, 1},
+	{38039, 854, 6, 1},
+	{28719, 854, 8, 0},
+	{33857, 854, 7, 1},
+	{9052, 854, 13, 1},
+	{11611, 854, 12, 1},
+	{23188, 854, 9, 1},
+	{23197, 854, 9, 1},
+	{5612, 854, 2, 1},
+	{7623, 854, 3, 1},
+	{5221, 854, 3, 1},
+	{36602, 854, 5, 1},
+	{18682, 854, 10, 1},
+	{38069, 854, 6, 1},
+	{40805, 854, 5, 1},
+	{14755, 854, 4, 1},
+	{14755, 854, 11, 1},
+	{11815, 854, 12, 1},
+	{11827, 854, 12, 1},
+	{862, 854, 21, 1},
+	{9182, 854, 13, 1},
+	{5472, 854, 15, 1},
+	{2292, 854, 18, 1},
+	{5487, 854, 15, 1},
+	{2310, 854, 18, 1},
+	{1612, 854, 19, 1},
+	{9195, 854, 13, 1},
+	{9208, 854, 13, 1},
+	{7129, 854, 14, 1},
+	{7143, 854, 14, 1},
+	{11839, 854, 12, 1},
+	{11851, 854, 12, 1},
+	{15063, 854, 11, 1},
+	{7157, 854, 14, 1},
+	{2328, 854, 18, 1},
+	{11863, 854, 12, 1},
+	{4076, 854, 16, 1},
+	{2364, 854, 18, 1},
+	{11875, 854, 12, 1},
+	{9234, 854, 13, 1},
+	{11887, 854, 12, 1},
+	{3121, 854, 17, 1},
+	{9260, 854, 13, 1},
+	{9273, 854, 13, 1},
+	{19042, 854, 10, 1},
+	{11899, 854, 12, 1},
+	{11911, 854, 12, 1},
+	{11923, 854, 12, 1},
+	{11935, 854, 12, 1},
+	{1669, 854, 19, 1},
+	{4108, 854, 16, 1},
+	{4124, 854, 16, 1},
+	{9312, 854, 13, 1},
+	{11959, 854, 12, 1},
+	{23386, 854, 9, 1},
+	{9351, 854, 13, 1},
+	{1688, 854, 19, 1},
+	{3138, 854, 17, 1},
+	{1707, 854, 19, 1},
+	{5517, 854, 15, 1},
+	{11983, 854, 12, 1},
+	{5532, 854, 15, 1},
+	{9364, 854, 13, 1},
+	{5547, 854, 15, 1},
+	{4140, 854, 16, 1},
+	{7227, 854, 14, 1},
+	{7255, 854, 14, 1},
+	{4156, 854, 16, 1},
+	{9377, 854, 13, 1},
+	{7269, 854, 14, 1},
+	{11995, 854, 12, 1},
+	{1726, 854, 19, 1},
+	{7283, 854, 14, 1},
+	{4172, 854, 16, 1},
+	{3155, 854, 17, 1},
+	{5592, 854, 15, 1},
+	{1745, 854, 19, 1},
+	{9390, 854, 13, 1},
+	{5607, 854, 15, 1},
+	{7297, 854, 14, 1},
+	{4188, 854, 16, 1},
+	{23431, 854, 9, 1},
+	{4204, 854, 16, 1},
+	{5622, 854, 15, 1},
+	{5637, 854, 15, 1},
+	{2400, 854, 18, 1},
+	{7311, 854, 14, 1},
+	{9403, 854, 13, 1},
+	{9416, 854, 13, 1},
+	{9429, 854, 13, 1},
+	{9442, 854, 13, 1},
+	{9455, 854, 13, 1},
+	{4220, 854, 16, 1},
+	{15371, 854, 11, 1},
+	{12007, 854, 12, 1},
+	{12019, 854, 12, 1},
+	{12043, 854, 12, 1},
+	{7325, 854, 14, 1},
+	{4284, 854, 16, 1},
+	{2436, 854, 18, 1},
+	{15426, 854, 11, 1},
+	{7451, 854, 14, 1},
+	{7465, 854, 14, 1},
+	{7479, 854, 14, 1},
+	{15437, 854, 11, 1},
+	{565, 854, 22, 0},
+	{9468, 854, 13, 1},
+	{1267, 854, 20, 1},
+	{9481, 854, 13, 1},
+	{925, 854, 21, 1},
+	{9494, 854, 13, 1},
+	{5727, 854, 15, 1},
+	{5742, 854, 15, 1},
+	{5757, 854, 15, 1},
+	{7507, 854, 14, 1},
+	{9507, 854, 13, 1},
+	{3223, 854, 17, 1},
+	{12211, 854, 12, 1},
+	{12223, 854, 12, 1},
+	{15569, 854, 11, 1},
+	{12235, 854, 12, 1},
+	{5772, 854, 15, 1},
+	{2454, 854, 18, 1},
+	{9520, 854, 13, 1},
+	{12247, 854, 12, 1},
+	{12259, 854, 12, 1},
+	{9533, 854, 13, 1},
+	{5787, 854, 15, 1},
+	{7521, 854, 14, 1},
+	{12271, 854, 12, 1},
+	{9546, 854, 13, 1},
+	{15602, 854, 11, 1},
+	{12283, 854, 12, 1},
+	{9559, 854, 13, 1},
+	{7549, 854, 14, 1},
+	{23494, 854, 9, 1},
+	{1802, 854, 19, 1},
+	{9572, 854, 13, 1},
+	{9585, 854, 13, 1},
+	{12295, 854, 12, 1},
+	{7563, 854, 14, 1},
+	{5817, 854, 15, 1},
+	{12307, 854, 12, 1},
+	{9598, 854, 13, 1},
+	{5832, 854, 15, 1},
+	{12319, 854, 12, 1},
+	{12331, 854, 12, 1},
+	{12343, 854, 12, 1},
+	{12355, 854, 12, 1},
+	{9611, 854, 13, 1},
+	{2472, 854, 18, 1},
+	{12367, 854, 12, 1},
+	{12379, 854, 12, 1},
+	{3240, 854, 17, 1},
+	{5847, 854, 15, 1},
+	{5862, 854, 15, 1},
+	{1821, 854, 19, 1},
+	{7577, 854, 14, 1},
+	{5877, 854, 15, 1},
+	{12391, 854, 12, 1},
+	{7591, 854, 14, 0},
+	{5892, 854, 15, 1},
+	{587, 854, 22, 1},
+	{2490, 854, 18, 1},
+	{12403, 854, 12, 1},
+	{5907, 854, 15, 1},
+	{9637, 854, 13, 1},
+	{5922, 854, 15, 1},
+	{12415, 854, 12, 1},
+	{9650, 854, 13, 1},
+	{9663, 854, 13, 1},
+	{7605, 854, 14, 1},
+	{12427, 854, 12, 1},
+	{12439, 854, 12, 1},
+	{4300, 854, 16, 1},
+	{3257, 854, 17, 1},
+	{15690, 854, 11, 1},
+	{12451, 854, 12, 1},
+	{7619, 854, 14, 1},
+	{3274, 854, 17, 1},
+	{7633, 854, 14, 1},
+	{9676, 854, 13, 1},
+	{15756, 854, 11, 1},
+	{5937, 854, 15, 1},
+	{1307, 854, 20, 1},
+	{38535, 862, 3, 1},
+	{19, 862, 3, 1},
+	{9778, 862, 3, 1},
+	{810, 862, 3, 1},
+	{21606, 862, 4, 1},
+	{2944, 862, 3, 1},
+	{6352, 862, 3, 1},
+	{4632, 866, 15, 9},
+	{26471, 866, 8, 9},
+	{6938, 866, 4, 9},
+	{27767, 866, 8, 9},
+	{35, 868, 2, 1},
+	{4, 868, 2, 1},
+	{29909, 868, 3, 1},
+	{16732, 868, 4, 1},
+	{324, 868, 3, 1},
+	{41270, 868, 4, 1},
+	{229, 868, 6, 1},
+	{30926, 868, 3, 1},
+	{41418, 868, 4, 1},
+	{39600, 868, 5, 1},
+	{6019, 868, 3, 1},
+	{2944, 868, 3, 1},
+	{6352, 868, 3, 1},
+	{17912, 868, 10, 1},
+	{22378, 868, 6, 1},
+	{12151, 868, 12, 1},
+	{4, 877, 2, 1},
+	{19, 877, 3, 1},
+	{9778, 877, 3, 1},
+	{810, 877, 3, 1},
+	{1498, 877, 3, 1},
+	{1121, 877, 6, 1},
+	{2944, 877, 3, 1},
+	{6352, 877, 3, 1},
+	{5042, 877, 3, 1},
+	{25255, 879, 8, 9},
+	{18060, 879, 5, 9},
+	{27735, 879, 7, 9},
+	{12676, 883, 5, 9},
+	{16552, 883, 4, 9},
+	{16552, 883, 10, 9},
+	{13594, 887, 4, 9},
+	{19381, 888, 9, 9},
+	{26, 888, 2, 9},
+	{15922, 888, 10, 9},
+	{38385, 888, 5, 0},
+	{12676, 888, 5, 9},
+	{29447, 888, 7, 9},
+	{23959, 888, 8, 9},
+	{6121, 888, 14, 9},
+	{1896, 888, 18, 9},
+	{12819, 888, 11, 9},
+	{34553, 888, 6, 9},
+	{9883, 888, 5, 0},
+	{9883, 888, 12, 0},
+	{29636, 888, 7, 9},
+	{29776, 888, 7, 9},
+	{16342, 888, 10, 9},
+	{3436, 888, 16, 9},
+	{38720, 888, 5, 9},
+	{1236, 888, 11, 9},
+	{24487, 888, 8, 9},
+	{29986, 888, 7, 9},
+	{13028, 888, 11, 9},
+	{20083, 888, 9, 9},
+	{30021, 888, 7, 9},
+	{30042, 888, 7, 9},
+	{30049, 888, 7, 9},
+	{34853, 888, 6, 9},
+	{24543, 888, 8, 9},
+	{6317, 888, 6, 9},
+	{30070, 888, 7, 9},
+	{8038, 888, 13, 9},
+	{3468, 888, 16, 9},
+	{766, 888, 2, 9},
+	{24679, 888, 8, 9},
+	{3516, 888, 16, 9},
+	{10051, 888, 12, 9},
+	{8103, 888, 13, 0},
+	{24411, 888, 8, 9},
+	{13325, 888, 11, 9},
+	{30567, 888, 7, 9},
+	{20434, 888, 9, 9},
+	{35177, 888, 6, 9},
+	{25151, 888, 8, 9},
+	{1753, 888, 2, 9},
+	{16892, 888, 10, 9},
+	{31183, 888, 7, 9},
+	{31190, 888, 7, 9},
+	{20677, 888, 9, 9},
+	{25263, 888, 8, 9},
+	{39165, 888, 5, 9},
+	{31218, 888, 7, 9},
+	{35507, 888, 6, 9},
+	{35513, 888, 6, 9},
+	{6555, 888, 14, 9},
+	{6583, 888, 14, 9},
+	{4917, 888, 15, 9},
+	{20812, 888, 9, 9},
+	{20821, 888, 9, 9},
+	{13545, 888, 11, 9},
+	{4947, 888, 15, 9},
+	{10411, 888, 12, 9},
+	{13578, 888, 11, 9},
+	{25391, 888, 8, 9},
+	{31351, 888, 7, 9},
+	{25399, 888, 8, 9},
+	{13622, 888, 11, 9},
+	{10483, 888, 12, 9},
+	{10495, 888, 12, 9},
+	{10507, 888, 12, 9},
+	{8389, 888, 13, 9},
+	{25415, 888, 8, 9},
+	{14563, 888, 2, 9},
+	{21136, 888, 9, 9},
+	{26415, 888, 8, 9},
+	{13919, 888, 11, 9},
+	{36377, 888, 6, 9},
+	{13941, 888, 11, 9},
+	{13952, 888, 11, 9},
+	{17662, 888, 10, 9},
+	{39680, 888, 5, 9},
+	{3804, 888, 16, 9},
+	{36521, 888, 6, 9},
+	{36635, 888, 6, 9},
+	{39820, 888, 5, 9},
+	{32506, 888, 7, 9},
+	{27287, 888, 8, 9},
+	{32800, 888, 7, 9},
+	{32814, 888, 7, 9},
+	{32842, 888, 7, 9},
+	{37019, 888, 6, 9},
+	{18022, 888, 10, 9},
+	{18032, 888, 10, 9},
+	{37283, 888, 6, 9},
+	{8818, 888, 13, 9},
+	{27695, 888, 8, 9},
+	{27703, 888, 8, 9},
+	{22432, 888, 9, 9},
+	{22675, 888, 9, 9},
+	{40465, 888, 5, 9},
+	{11443, 888, 12, 9},
+	{14546, 888, 11, 9},
+	{33479, 888, 7, 0},
+	{23035, 888, 9, 9},
+	{41886, 888, 4, 9},
+	{23098, 888, 9, 9},
+	{37895, 888, 6, 9},
+	{37919, 888, 6, 9},
+	{767, 888, 2, 9},
+	{38147, 888, 6, 9},
+	{14766, 888, 11, 9},
+	{34018, 888, 7, 9},
+	{34025, 888, 7, 9},
+	{739, 888, 2, 9},
+	{40915, 888, 5, 9},
+	{32359, 894, 7, 9},
+	{16068, 895, 3, 1},
+	{35, 895, 2, 1},
+	{19, 895, 3, 1},
+	{9778, 895, 3, 1},
+	{38533, 895, 3, 1},
+	{984, 895, 3, 1},
+	{1498, 895, 3, 1},
+	{2944, 895, 3, 1},
+	{5080, 895, 3, 1},
+	{6352, 895, 3, 1},
+	{42366, 895, 3, 1},
+	{24295, 896, 8, 9},
+	{41310, 896, 3, 9},
+	{41310, 896, 4, 9},
+	{36095, 896, 6, 9},
+	{40466, 896, 4, 9},
+	{32786, 896, 5, 9},
+	{40105, 896, 5, 9},
+	{40190, 896, 5, 9},
+	{18562, 896, 10, 9},
+	{34522, 902, 3, 9},
+	{23967, 906, 8, 9},
+	{19, 906, 3, 1},
+	{9778, 906, 3, 1},
+	{38533, 906, 3, 1},
+	{6019, 906, 3, 1},
+	{2944, 906, 3, 1},
+	{5080, 906, 3, 1},
+	{6352, 906, 3, 1},
+	{19, 908, 3, 1},
+	{9778, 908, 3, 1},
+	{6352, 908, 3, 1},
+	{19, 911, 3, 1},
+	{9778, 911, 3, 1},
+	{810, 911, 3, 1},
+	{9, 911, 1, 1},
+	{6019, 911, 3, 1},
+	{2944, 911, 3, 1},
+	{12810, 911, 3, 1},
+	{6352, 911, 3, 1},
+	{10111, 918, 6, 9},
+	{40938, 922, 4, 9},
+	{38535, 929, 3, 1},
+	{19, 929, 3, 1},
+	{9778, 929, 3, 1},
+	{6017, 929, 3, 1},
+	{38533, 929, 3, 1},
+	{35165, 929, 3, 1},
+	{14120, 929, 3, 1},
+	{42183, 929, 3, 1},
+	{19861, 929, 3, 1},
+	{810, 929, 3, 1},
+	{21606, 929, 4, 1},
+	{2944, 929, 3, 1},
+	{6352, 929, 3, 1},
+	{123, 929, 3, 1},
+	{6442, 930, 4, 1},
+	{8189, 930, 3, 1},
+	{3749, 930, 3, 9},
+	{8530, 930, 3, 1},
+	{23823, 930, 8, 1},
+	{15982, 930, 4, 1},
+	{16002, 930, 10, 1},
+	{34433, 930, 6, 1},
+	{41014, 930, 4, 9},
+	{29412, 930, 7, 1},
+	{16072, 930, 10, 1},
+	{19777, 930, 9, 1},
+	{29426, 930, 7, 1},
+	{16082, 930, 10, 1},
+	{38535, 930, 3, 1},
+	{12764, 930, 11, 1},
+	{19858, 930, 9, 1},
+	{38585, 930, 5, 1},
+	{29734, 930, 7, 1},
+	{4, 930, 2, 9},
+	{19, 930, 3, 1},
+	{29937, 930, 7, 1},
+	{38685, 930, 5, 1},
+	{20074, 930, 9, 1},
+	{6359, 930, 14, 9},
+	{9778, 930, 3, 1},
+	{34889, 930, 6, 1},
+	{18385, 930, 3, 1},
+	{22705, 930, 3, 9},
+	{35063, 930, 6, 9},
+	{35069, 930, 6, 9},
+	{30924, 930, 7, 9},
+	{35147, 930, 6, 1},
+	{39025, 930, 5, 1},
+	{30938, 930, 7, 1},
+	{30973, 930, 7, 1},
+	{810, 930, 3, 1},
+	{31001, 930, 7, 1},
+	{22674, 930, 3, 1},
+	{20695, 930, 9, 9},
+	{39210, 930, 5, 1},
+	{21606, 930, 4, 1},
+	{25479, 930, 8, 1},
+	{10531, 930, 12, 1},
+	{39300, 930, 5, 1},
+	{35633, 930, 6, 1},
+	{31589, 930, 7, 1},
+	{31596, 930, 7, 1},
+	{31631, 930, 7, 1},
+	{25751, 930, 8, 1},
+	{5022, 930, 15, 1},
+	{39335, 930, 5, 1},
+	{31652, 930, 7, 1},
+	{31715, 930, 7, 1},
+	{17232, 930, 10, 1},
+	{21208, 930, 9, 1},
+	{39385, 930, 5, 1},
+	{17252, 930, 10, 1},
+	{35849, 930, 6, 9},
+	{31792, 930, 7, 9},
+	{39430, 930, 5, 1},
+	{41478, 930, 4, 1},
+	{35963, 930, 6, 1},
+	{35969, 930, 6, 9},
+	{31932, 930, 7, 1},
+	{31953, 930, 7, 1},
+	{26239, 930, 8, 1},
+	{39530, 930, 5, 1},
+	{36041, 930, 6, 1},
+	{26287, 930, 8, 9},
+	{39560, 930, 5, 1},
+	{36047, 930, 6, 9},
+	{39570, 930, 5, 1},
+	{8148, 930, 4, 1},
+	{32058, 930, 7, 1},
+	{17422, 930, 10, 1},
+	{26431, 930, 8, 1},
+	{36173, 930, 6, 1},
+	{1498, 930, 3, 9},
+	{21595, 930, 5, 1},
+	{36209, 930, 6, 1},
+	{36221, 930, 6, 1},
+	{36227, 930, 6, 1},
+	{6019, 930, 3, 1},
+	{32247, 930, 7, 1},
+	{10819, 930, 12, 9},
+	{39720, 930, 5, 1},
+	{2944, 930, 3, 1},
+	{8623, 930, 13, 1},
+	{5080, 930, 3, 1},
+	{27095, 930, 8, 1},
+	{41630, 930, 4, 1},
+	{39910, 930, 5, 1},
+	{36779, 930, 6, 1},
+	{36785, 930, 6, 1},
+	{32604, 930, 7, 1},
+	{32667, 930, 7, 1},
+	{39940, 930, 5, 1},
+	{6352, 930, 3, 1},
+	{32702, 930, 7, 1},
+	{22054, 930, 9, 1},
+	{22063, 930, 9, 1},
+	{17882, 930, 10, 1},
+	{2554, 930, 2, 1},
+	{35919, 930, 4, 1},
+	{41686, 930, 4, 1},
+	{32793, 930, 7, 1},
+	{27319, 930, 8, 1},
+	{22153, 930, 9, 1},
+	{22162, 930, 9, 1},
+	{32835, 930, 7, 1},
+	{22171, 930, 9, 9},
+	{37001, 930, 6, 1},
+	{37007, 930, 6, 9},
+	{220, 930, 4, 1},
+	{17972, 930, 10, 1},
+	{27399, 930, 8, 1},
+	{22216, 930, 9, 1},
+	{37037, 930, 6, 1},
+	{40130, 930, 5, 1},
+	{27455, 930, 8, 1},
+	{18042, 930, 10, 1},
+	{1010, 930, 3, 1},
+	{37169, 930, 6, 1},
+	{32996, 930, 7, 1},
+	{40290, 930, 5, 1},
+	{27671, 930, 8, 9},
+	{40315, 930, 5, 1},
+	{34930, 930, 3, 1},
+	{6369, 930, 4, 1},
+	{22657, 930, 9, 9},
+	{18342, 930, 10, 9},
+	{20699, 930, 5, 1},
+	{33276, 930, 7, 1},
+	{40400, 930, 5, 1},
+	{37409, 930, 6, 1},
+	{40450, 930, 5, 9},
+	{22711, 930, 3, 1},
+	{22711, 930, 9, 1},
+	{11395, 930, 12, 1},
+	{11407, 930, 12, 1},
+	{28007, 930, 8, 1},
+	{33409, 930, 7, 1},
+	{28103, 930, 8, 1},
+	{33423, 930, 7, 9},
+	{18402, 930, 10, 1},
+	{14557, 930, 11, 1},
+	{28119, 930, 8, 1},
+	{28127, 930, 8, 1},
+	{37577, 930, 6, 1},
+	{40545, 930, 5, 1},
+	{18452, 930, 10, 1},
+	{40580, 930, 5, 1},
+	{2797, 930, 2, 1},
+	{33633, 930, 7, 1},
+	{2166, 930, 6, 1},
+	{40660, 930, 5, 1},
+	{23089, 930, 9, 1},
+	{40675, 930, 5, 1},
+	{28615, 930, 8, 9},
+	{40750, 930, 5, 1},
+	{23224, 930, 9, 1},
+	{38123, 930, 6, 1},
+	{28783, 930, 8, 1},
+	{28789, 930, 3, 1},
+	{38153, 930, 6, 1},
+	{38159, 930, 6, 1},
+	{23269, 930, 5, 1},
+	{23269, 930, 9, 1},
+	{23278, 930, 9, 1},
+	{34032, 930, 7, 1},
+	{34060, 930, 4, 9},
+	{34060, 930, 7, 1},
+	{23629, 930, 9, 1},
+	{40910, 930, 5, 1},
+	{29023, 930, 8, 9},
+	{40920, 930, 5, 1},
+	{40925, 930, 5, 1},
+	{23638, 930, 9, 1},
+	{4, 931, 2, 9},
+	{17722, 936, 4, 9},
+	{3933, 936, 3, 9},
+	{4, 937, 2, 1},
+	{9778, 937, 3, 1},
+	{810, 937, 3, 1},
+	{2944, 937, 3, 1},
+	{6352, 937, 3, 1},
+	{39230, 942, 5, 9},
+	{35, 944, 2, 1},
+	{38535, 944, 3, 1},
+	{19, 944, 3, 1},
+	{9778, 944, 3, 1},
+	{351, 944, 3, 1},
+	{810, 944, 3, 1},
+	{21606, 944, 4, 1},
+	{23282, 944, 4, 1},
+	{17722, 944, 4, 1},
+	{2944, 944, 3, 1},
+	{6352, 944, 3, 1},
+	{5042, 944, 3, 1},
+	{14260, 944, 4, 1},
+	{7079, 949, 3, 1},
+	{7829, 949, 3, 1},
+	{40966, 949, 4, 1},
+	{29293, 949, 6, 1},
+	{638, 949, 3, 1},
+	{12676, 949, 5, 9},
+	{29776, 949, 7, 9},
+	{22116, 949, 3, 1},
+	{24495, 949, 8, 0},
+	{782, 949, 3, 1},
+	{14313, 949, 3, 1},
+	{5271, 949, 3, 1},
+	{1498, 949, 3, 1},
+	{40150, 949, 5, 1},
+	{19, 960, 3, 1},
+	{9778, 960, 3, 1},
+	{810, 960, 3, 1},
+	{2944, 960, 3, 1},
+	{6352, 960, 3, 1},
+	{11523, 960, 3, 1},
+	{3806, 960, 3, 1},
+	{9715, 961, 12, 9},
+	{23967, 961, 8, 9},
+	{19, 961, 3, 1},
+	{9778, 961, 3, 1},
+	{810, 961, 3, 1},
+	{2022, 961, 3, 1},
+	{2944, 961, 3, 1},
+	{6156, 961, 4, 1},
+	{6352, 961, 3, 1},
+	{4969, 961, 4, 1},
+	{12676, 962, 5, 9},
+	{38500, 963, 5, 1},
+	{29776, 963, 7, 9},
+	{4, 963, 2, 1},
+	{1023, 963, 2, 1},
+	{810, 963, 2, 1},
+	{703, 963, 2, 1},
+	{5, 963, 2, 1},
+	{41998, 963, 4, 9},
+	{19, 965, 3, 1},
+	{12918, 965, 4, 1},
+	{9778, 965, 3, 1},
+	{810, 965, 3, 1},
+	{6019, 965, 3, 1},
+	{2944, 965, 3, 1},
+	{6352, 965, 3, 1},
+	{23967, 966, 8, 9},
+	{19, 966, 3, 1},
+	{9778, 966, 3, 1},
+	{810, 966, 3, 1},
+	{6019, 966, 3, 1},
+	{17722, 966, 4, 1},
+	{2944, 966, 3, 1},
+	{6352, 966, 3, 1},
+	{1512, 966, 3, 1},
+	{788, 972, 4, 1},
+	{23967, 972, 8, 9},
+	{19, 972, 3, 1},
+	{5080, 972, 3, 1},
+	{34522, 994, 3, 9},
+	{41082, 1002, 4, 9},
+	{4056, 1003, 4, 1},
+	{12676, 1003, 5, 9},
+	{23967, 1003, 8, 9},
+	{4, 1003, 2, 9},
+	{19, 1003, 3, 1},
+	{24743, 1003, 4, 1},
+	{21606, 1003, 4, 1},
+	{5080, 1003, 3, 1},
+	{50, 1003, 2, 1},
+	{6352, 1003, 3, 1},
+	{2808, 1003, 3, 1},
+	{6369, 1003, 4, 9},
+	{10046, 1003, 5, 1},
+	{2797, 1003, 2, 1},
+	{34154, 1003, 3, 1},
+	{21442, 1005, 9, 9},
+	{36497, 1005, 6, 9},
+	{28791, 1005, 8, 9},
+	{35, 1009, 2, 1},
+	{23967, 1009, 8, 9},
+	{29496, 1009, 7, 0},
+	{4, 1009, 2, 1},
+	{9778, 1009, 3, 1},
+	{810, 1009, 3, 1},
+	{204, 1009, 2, 1},
+	{6352, 1009, 3, 1},
+	{1266, 1009, 2, 9},
+	{2091, 1009, 2, 9},
+	{29055, 1011, 7, 9},
+	{35, 1011, 2, 9},
+	{29083, 1011, 7, 9},
+	{19741, 1011, 9, 9},
+	{16092, 1011, 3, 9},
+	{23967, 1011, 8, 9},
+	{42069, 1011, 3, 9},
+	{29755, 1011, 7, 0},
+	{19, 1011, 3, 9},
+	{24375, 1011, 8, 9},
+	{9778, 1011, 3, 9},
+	{30203, 1011, 7, 9},
+	{810, 1011, 3, 9},
+	{35189, 1011, 6, 9},
+	{2022, 1011, 3, 9},
+	{25591, 1011, 8, 9},
+	{26143, 1011, 8, 9},
+	{42249, 1011, 3, 9},
+	{36131, 1011, 6, 9},
+	{39610, 1011, 5, 9},
+	{39615, 1011, 5, 9},
+	{6019, 1011, 3, 9},
+	{26535, 1011, 8, 9},
+	{26607, 1011, 8, 9},
+	{7526, 1011, 3, 9},
+	{36509, 1011, 6, 9},
+	{39700, 1011, 5, 9},
+	{41578, 1011, 4, 9},
+	{32324, 1011, 7, 9},
+	{2944, 1011, 3, 9},
+	{16246, 1011, 3, 9},
+	{6352, 1011, 3, 9},
+	{1404, 1011, 2, 9},
+	{18002, 1011, 10, 9},
+	{8656, 1011, 3, 9},
+	{11119, 1011, 12, 0},
+	{42378, 1011, 3, 9},
+	{3483, 1011, 4, 9},
+	{14733, 1011, 11, 9},
+	{28735, 1011, 8, 9},
+	{12988, 1014, 5, 20},
+	{16768, 1014, 4, 20},
+	{24391, 1014, 8, 20},
+	{12995, 1014, 11, 9},
+	{3863, 1014, 2, 9},
+	{21649, 1014, 9, 20},
+	{27159, 1014, 8, 9},
+	{32863, 1014, 7, 9},
+	{3558, 1014, 4, 9},
+	{14419, 1014, 7, 9},
+	{35, 1015, 2, 1},
+	{4, 1015, 2, 1},
+	{12918, 1015, 4, 1},
+	{810, 1015, 3, 1},
+	{6019, 1015, 3, 1},
+	{2944, 1015, 3, 1},
+	{6352, 1015, 3, 1},
+	{19, 1018, 3, 1},
+	{9778, 1018, 3, 1},
+	{810, 1018, 3, 1},
+	{1498, 1018, 3, 1},
+	{2944, 1018, 3, 1},
+	{6352, 1018, 3, 1},
+	{4969, 1018, 3, 1},
+	{1512, 1018, 3, 1},
+	{19, 1035, 3, 1},
+	{9778, 1035, 3, 1},
+	{810, 1035, 3, 1},
+	{2944, 1035, 3, 1},
+	{6352, 1035, 3, 1},
+	{19, 1038, 3, 1},
+	{9778, 1038, 3, 1},
+	{810, 1038, 3, 1},
+	{2944, 1038, 3, 1},
+	{6352, 1038, 3, 1},
+	{34522, 1047, 3, 9},
+	{9778, 1048, 3, 9},
+	{810, 1048, 3, 9},
+	{19, 1049, 3, 1},
+	{9778, 1049, 3, 1},
+	{810, 1049, 3, 1},
+	{21606, 1049, 4, 1},
+	{1498, 1049, 3, 1},
+	{2944, 1049, 3, 1},
+	{6352, 1049, 3, 1},
+	{2443, 1049, 2, 1},
+	{15822, 1050, 10, 9},
+	{26, 1050, 1, 1},
+	{35, 1050, 2, 1},
+	{125, 1050, 1, 1},
+	{5476, 1050, 2, 1},
+	{23967, 1050, 8, 9},
+	{3388, 1050, 5, 1},
+	{4, 1050, 1, 1},
+	{19, 1050, 3, 9},
+	{13922, 1050, 4, 9},
+	{48, 1050, 1, 1},
+	{8, 1050, 1, 1},
+	{61, 1050, 1, 1},
+	{1299, 1050, 2, 1},
+	{41190, 1050, 4, 1},
+	{42138, 1050, 3, 1},
+	{30, 1050, 1, 1},
+	{31, 1050, 1, 1},
+	{9, 1050, 1, 1},
+	{35531, 1050, 6, 9},
+	{10519, 1050, 12, 9},
+	{870, 1050, 1, 1},
+	{31743, 1050, 7, 1},
+	{5052, 1050, 15, 1},
+	{35813, 1050, 6, 1},
+	{17, 1050, 1, 1},
+	{35921, 1050, 6, 1},
+	{21, 1050, 1, 1},
+	{10819, 1050, 12, 9},
+	{1, 1050, 1, 1},
+	{6793, 1050, 14, 1},
+	{5, 1050, 1, 1},
+	{6352, 1050, 3, 1},
+	{67, 1050, 1, 1},
+	{28065, 1050, 4, 0},
+	{40020, 1050, 5, 1},
+	{1404, 1050, 2, 1},
+	{4357, 1050, 5, 1},
+	{6, 1050, 1, 1},
+	{11, 1050, 1, 1},
+	{15, 1050, 1, 1},
+	{2797, 1050, 2, 1},
+	{22, 1050, 1, 1},
+	{123, 1050, 1, 1},
+	{0, 1050, 1, 1},
+	{1120, 1050, 1, 1},
+	{227, 1050, 1, 1},
+	{21487, 1058, 9, 9},
+	{23967, 1064, 8, 9},
+	{19, 1064, 3, 1},
+	{9778, 1064, 3, 1},
+	{24631, 1064, 8, 9},
+	{810, 1064, 3, 1},
+	{2944, 1064, 3, 1},
+	{6352, 1064, 3, 1},
+	{1092, 1064, 3, 1},
+	{42045, 1065, 3, 9},
+	{19, 1065, 3, 1},
+	{810, 1065, 3, 1},
+	{25095, 1065, 8, 9},
+	{6019, 1065, 3, 1},
+	{2944, 1065, 3, 1},
+	{1019, 1065, 3, 9},
+	{6352, 1065, 3, 1},
+	{7900, 1065, 8, 0},
+	{42435, 1065, 3, 9},
+	{28799, 1065, 8, 9},
+	{12676, 1073, 5, 9},
+	{13263, 1073, 4, 9},
+	{35417, 1073, 6, 9},
+	{23967, 1078, 8, 9},
+	{35111, 1078, 6, 9},
+	{30903, 1078, 7, 9},
+	{12676, 1082, 5, 9},
+	{41062, 1082, 4, 9},
+	{24287, 1082, 8, 20},
+	{41110, 1082, 4, 9},
+	{6387, 1082, 7, 9},
+	{41218, 1082, 4, 9},
+	{10075, 1082, 12, 9},
+	{10531, 1082, 4, 9},
+	{39490, 1082, 5, 9},
+	{21487, 1082, 9, 9},
+	{32184, 1082, 7, 9},
+	{27087, 1082, 8, 9},
+	{36791, 1082, 6, 9},
+	{17862, 1082, 10, 9},
+	{17942, 1082, 10, 20},
+	{41814, 1082, 4, 9},
+	{8947, 1082, 3, 20},
+	{23967, 1084, 8, 9},
+	{19, 1089, 3, 1},
+	{9778, 1089, 3, 1},
+	{810, 1089, 3, 1},
+	{2944, 1089, 3, 1},
+	{6352, 1089, 3, 1},
+	{3749, 1094, 3, 1},
+	{23967, 1094, 8, 9},
+	{19, 1094, 3, 1},
+	{9778, 1094, 3, 1},
+	{41266, 1094, 4, 1},
+	{6352, 1094, 3, 1},
+	{1092, 1094, 5, 1},
+	{18602, 1094, 4, 1},
+	{19, 1096, 3, 1},
+	{9778, 1096, 3, 1},
+	{810, 1096, 3, 1},
+	{102, 1096, 2, 1},
+	{2944, 1096, 3, 1},
+	{6352, 1096, 3, 1},
+	{1512, 1096, 3, 9},
+	{38750, 1103, 5, 20},
+	{36503, 1108, 6, 9},
+	{13614, 1108, 4, 9},
+	{38177, 1108, 6, 9},
+	{38535, 1113, 3, 1},
+	{19, 1113, 3, 1},
+	{9778, 1113, 3, 1},
+	{810, 1113, 3, 1},
+	{102, 1113, 2, 1},
+	{2944, 1113, 3, 1},
+	{6352, 1113, 3, 1},
+	{1512, 1113, 3, 1},
+	{4, 1114, 2, 1},
+	{19, 1114, 3, 1},
+	{20029, 1114, 9, 1},
+	{9778, 1114, 3, 1},
+	{20182, 1114, 9, 1},
+	{6019, 1114, 3, 1},
+	{2944, 1114, 3, 1},
+	{36695, 1114, 4, 9},
+	{6352, 1114, 3, 1},
+	{27375, 1114, 8, 1},
+	{33059, 1114, 7, 1},
+	{10046, 1114, 5, 1},
+	{37289, 1124, 6, 9},
+	{27863, 1124, 8, 9},
+	{22819, 1124, 9, 9},
+	{23671, 1129, 8, 9},
+	{29083, 1129, 7, 9},
+	{15912, 1129, 10, 9},
+	{12632, 1129, 11, 9},
+	{29209, 1129, 7, 9},
+	{23799, 1129, 8, 9},
+	{15992, 1129, 10, 9},
+	{23879, 1129, 8, 9},
+	{19741, 1129, 9, 9},
+	{29524, 1129, 7, 9},
+	{29538, 1129, 7, 9},
+	{24215, 1129, 8, 9},
+	{24375, 1129, 8, 9},
+	{4602, 1129, 15, 9},
+	{38845, 1129, 5, 9},
+	{30868, 1129, 7, 9},
+	{35189, 1129, 6, 9},
+	{31414, 1129, 7, 9},
+	{35555, 1129, 6, 9},
+	{25591, 1129, 8, 9},
+	{35639, 1129, 6, 9},
+	{31561, 1129, 7, 9},
+	{21019, 1129, 9, 9},
+	{31575, 1129, 7, 9},
+	{21127, 1129, 9, 9},
+	{21253, 1129, 9, 9},
+	{35879, 1129, 6, 9},
+	{26143, 1129, 8, 9},
+	{39495, 1129, 5, 9},
+	{17462, 1129, 10, 9},
+	{26607, 1129, 8, 9},
+	{7526, 1129, 3, 9},
+	{26695, 1129, 8, 9},
+	{32324, 1129, 7, 9},
+	{39775, 1129, 5, 9},
+	{3852, 1129, 16, 9},
+	{16246, 1129, 3, 9},
+	{32520, 1129, 7, 9},
+	{40045, 1129, 5, 9},
+	{27327, 1129, 8, 9},
+	{40425, 1129, 5, 9},
+	{42378, 1129, 3, 9},
+	{28327, 1129, 8, 9},
+	{37697, 1129, 6, 9},
+	{22990, 1129, 9, 9},
+	{33703, 1129, 7, 9},
+	{14645, 1129, 11, 9},
+	{41882, 1129, 4, 9},
+	{41890, 1129, 4, 9},
+	{14733, 1129, 11, 9},
+	{28735, 1129, 8, 9},
+	{33899, 1129, 7, 9},
+	{12676, 1133, 5, 9},
+	{19, 1137, 3, 1},
+	{9778, 1137, 3, 1},
+	{38533, 1137, 3, 1},
+	{6352, 1137, 3, 1},
+	{1912, 1137, 3, 1},
+	{810, 1140, 3, 1},
+	{19, 1141, 3, 1},
+	{9778, 1141, 3, 1},
+	{810, 1141, 3, 1},
+	{6019, 1141, 3, 1},
+	{2944, 1141, 3, 1},
+	{6352, 1141, 3, 1},
+	{13721, 1143, 11, 9},
+	{35, 1144, 2, 1},
+	{4, 1144, 2, 1},
+	{6352, 1144, 3, 1},
+	{36, 1155, 2, 9},
+	{102, 1155, 2, 9},
+	{123, 1155, 2, 9},
+	{23967, 1157, 8, 9},
+	{20056, 1159, 9, 9},
+	{25487, 1159, 8, 9},
+	{4, 1161, 2, 9},
+	{1512, 1166, 3, 9},
+	{35, 1168, 2, 1},
+	{4, 1168, 2, 1},
+	{810, 1168, 2, 1},
+	{204, 1168, 2, 1},
+	{492, 1168, 2, 1},
+	{2944, 1168, 3, 1},
+	{6871, 1168, 6, 9},
+	{5, 1168, 2, 1},
+	{6369, 1168, 4, 9},
+	{35, 1179, 2, 1},
+	{38535, 1179, 3, 1},
+	{4, 1179, 2, 1},
+	{19, 1179, 3, 1},
+	{9778, 1179, 3, 1},
+	{810, 1179, 2, 1},
+	{810, 1179, 3, 1},
+	{2022, 1179, 3, 1},
+	{6019, 1179, 3, 1},
+	{17722, 1179, 4, 1},
+	{2944, 1179, 3, 1},
+	{23, 1179, 3, 1},
+	{6352, 1179, 3, 1},
+	{3483, 1179, 4, 1},
+	{123, 1179, 3, 1},
+	{810, 1184, 3, 1},
+	{4, 1185, 2, 1},
+	{19, 1185, 3, 1},
+	{9778, 1185, 3, 1},
+	{810, 1185, 3, 1},
+	{6019, 1185, 3, 1},
+	{2944, 1185, 3, 1},
+	{5080, 1185, 3, 1},
+	{6352, 1185, 3, 1},
+	{19, 1187, 3, 1},
+	{44, 1187, 3, 1},
+	{720, 1187, 3, 1},
+	{810, 1187, 3, 1},
+	{477, 1187, 3, 1},
+	{21606, 1187, 4, 1},
+	{18114, 1187, 4, 1},
+	{36275, 1187, 6, 1},
+	{1107, 1187, 3, 1},
+	{2944, 1187, 3, 1},
+	{14106, 1187, 11, 9},
+	{6352, 1187, 3, 1},
+	{1092, 1187, 5, 1},
+	{33633, 1187, 7, 1},
+	{42021, 1188, 3, 9},
+	{19, 1188, 3, 1},
+	{9778, 1188, 3, 1},
+	{810, 1188, 3, 1},
+	{6019, 1188, 3, 1},
+	{2944, 1188, 3, 1},
+	{41622, 1188, 4, 9},
+	{6352, 1188, 3, 1},
+	{3885, 1188, 3, 9},
+	{11071, 1188, 12, 0},
+	{18690, 1188, 3, 9},
+	{33906, 1188, 7, 9},
+	{11035, 1189, 12, 9},
+	{32506, 1192, 7, 9},
+	{39840, 1192, 5, 9},
+	{1620, 1200, 2, 1},
+	{27700, 1200, 3, 1},
+	{8916, 1200, 3, 1},
+	{38535, 1200, 3, 1},
+	{19, 1200, 3, 1},
+	{633, 1200, 2, 1},
+	{9778, 1200, 3, 1},
+	{324, 1200, 3, 1},
+	{810, 1200, 3, 1},
+	{21606, 1200, 4, 1},
+	{42237, 1200, 3, 1},
+	{39335, 1200, 3, 1},
+	{6019, 1200, 3, 1},
+	{17722, 1200, 4, 1},
+	{64, 1200, 2, 1},
+	{2944, 1200, 3, 1},
+	{6352, 1200, 3, 1},
+	{9733, 1200, 3, 1},
+	{15, 1200, 3, 1},
+	{10598, 1200, 3, 1},
+	{2443, 1200, 2, 1},
+	{123, 1200, 3, 1},
+	{34522, 1201, 3, 9},
+	{19390, 1210, 4, 1},
+	{38535, 1210, 3, 1},
+	{4, 1210, 2, 1},
+	{19, 1210, 3, 1},
+	{12918, 1210, 4, 1},
+	{9778, 1210, 3, 1},
+	{810, 1210, 3, 1},
+	{21606, 1210, 4, 1},
+	{2022, 1210, 3, 1},
+	{41366, 1210, 4, 1},
+	{2103, 1210, 4, 1},
+	{1121, 1210, 6, 1},
+	{17722, 1210, 4, 1},
+	{2944, 1210, 3, 1},
+	{6352, 1210, 3, 1},
+	{5042, 1210, 3, 1},
+	{2166, 1210, 6, 1},
+	{12731, 1215, 11, 9},
+	{6317, 1215, 6, 9},
+	{17852, 1215, 10, 9},
+	{18772, 1215, 10, 9},
+	{23967, 1217, 8, 9},
+	{23699, 1217, 4, 1},
+	{19, 1217, 3, 1},
+	{41154, 1217, 4, 1},
+	{9778, 1217, 3, 1},
+	{3339, 1217, 4, 1},
+	{810, 1217, 3, 1},
+	{42204, 1217, 3, 1},
+	{6019, 1217, 3, 1},
+	{2944, 1217, 3, 1},
+	{6352, 1217, 3, 1},
+	{18339, 1217, 3, 9},
+	{15096, 1217, 11, 1},
+	{19232, 1217, 10, 1},
+	{12475, 1217, 12, 1},
+	{35, 1218, 2, 1},
+	{4, 1218, 2, 1},
+	{810, 1218, 2, 1},
+	{4887, 1218, 5, 1},
+	{21606, 1218, 4, 1},
+	{102, 1218, 2, 1},
+	{6019, 1218, 3, 1},
+	{2103, 1218, 4, 1},
+	{703, 1218, 2, 1},
+	{5, 1218, 2, 1},
+	{1512, 1218, 2, 1},
+	{2443, 1218, 2, 1},
+	{38535, 1219, 3, 9},
+	{456, 1219, 2, 9},
+	{19921, 1219, 9, 1},
+	{24175, 1219, 8, 1},
+	{19930, 1219, 9, 1},
+	{19939, 1219, 9, 1},
+	{16232, 1219, 10, 1},
+	{16242, 1219, 10, 1},
+	{2937, 1219, 2, 1},
+	{6219, 1219, 2, 1},
+	{4, 1219, 2, 9},
+	{19, 1219, 3, 1},
+	{5582, 1219, 2, 1},
+	{34697, 1219, 6, 1},
+	{4279, 1219, 2, 1},
+	{1725, 1219, 2, 9},
+	{1303, 1219, 2, 1},
+	{6289, 1219, 14, 1},
+	{6303, 1219, 14, 1},
+	{30014, 1219, 7, 1},
+	{7899, 1219, 2, 1},
+	{9778, 1219, 3, 1},
+	{810, 1219, 3, 1},
+	{3767, 1219, 2, 1},
+	{204, 1219, 2, 1},
+	{3522, 1219, 3, 9},
+	{5007, 1219, 15, 1},
+	{2938, 1219, 2, 1},
+	{31659, 1219, 7, 1},
+	{31666, 1219, 7, 1},
+	{31673, 1219, 7, 1},
+	{10591, 1219, 12, 1},
+	{10603, 1219, 12, 1},
+	{41402, 1219, 4, 1},
+	{17192, 1219, 10, 1},
+	{17471, 1219, 2, 1},
+	{1749, 1219, 2, 1},
+	{41446, 1219, 4, 1},
+	{1239, 1219, 2, 1},
+	{4192, 1219, 2, 1},
+	{41466, 1219, 4, 1},
+	{4400, 1219, 2, 1},
+	{232, 1219, 2, 1},
+	{33033, 1219, 3, 9},
+	{32023, 1219, 7, 1},
+	{39580, 1219, 5, 1},
+	{2301, 1219, 2, 1},
+	{41506, 1219, 4, 1},
+	{12143, 1219, 2, 1},
+	{26735, 1219, 8, 1},
+	{2944, 1219, 3, 1},
+	{26959, 1219, 8, 1},
+	{2784, 1219, 2, 1},
+	{39870, 1219, 5, 1},
+	{36749, 1219, 6, 1},
+	{6352, 1219, 3, 1},
+	{2832, 1219, 2, 1},
+	{32828, 1219, 7, 1},
+	{1404, 1219, 2, 9},
+	{40185, 1219, 5, 1},
+	{40210, 1219, 5, 1},
+	{113, 1219, 2, 1},
+	{327, 1219, 2, 1},
+	{18202, 1219, 10, 1},
+	{18262, 1219, 10, 1},
+	{3774, 1219, 2, 1},
+	{41822, 1219, 4, 1},
+	{15, 1219, 2, 1},
+	{28359, 1219, 8, 1},
+	{8756, 1219, 2, 1},
+	{28647, 1219, 8, 1},
+	{97, 1219, 1, 9},
+	{33878, 1219, 7, 1},
+	{23206, 1219, 9, 1},
+	{4193, 1219, 2, 1},
+	{40815, 1219, 5, 1},
+	{40875, 1219, 5, 1},
+	{15811, 1219, 11, 1},
+	{12499, 1219, 12, 1},
+	{29039, 1219, 8, 1},
+	{29047, 1219, 8, 1},
+	{30218, 1219, 2, 1},
+	{13701, 1219, 2, 1},
+	{35, 1222, 2, 1},
+	{23967, 1222, 8, 9},
+	{4, 1222, 2, 1},
+	{19, 1222, 3, 1},
+	{810, 1222, 2, 1},
+	{703, 1222, 2, 1},
+	{5, 1222, 2, 1},
+	{6352, 1222, 3, 1},
+	{1512, 1222, 2, 1},
+	{35, 1223, 2, 1},
+	{12676, 1223, 5, 9},
+	{4, 1223, 2, 1},
+	{11076, 1223, 4, 9},
+	{38660, 1223, 5, 9},
+	{810, 1223, 3, 1},
+	{25303, 1223, 4, 9},
+	{477, 1223, 22, 9},
+	{1460, 1223, 19, 9},
+	{1479, 1223, 19, 9},
+	{2713, 1223, 17, 9},
+	{2004, 1223, 18, 9},
+	{33033, 1223, 3, 1},
+	{102, 1223, 2, 1},
+	{2944, 1223, 3, 1},
+	{42270, 1223, 3, 1},
+	{6352, 1223, 3, 1},
+	{42309, 1223, 3, 1},
+	{36983, 1223, 6, 1},
+	{6821, 1223, 14, 9},
+	{40125, 1223, 5, 9},
+	{3884, 1223, 16, 9},
+	{1512, 1223, 3, 4},
+	{967, 1229, 2, 1},
+	{106, 1229, 2, 1},
+	{639, 1229, 2, 1},
+	{140, 1229, 2, 1},
+	{3199, 1229, 2, 1},
+	{25, 1229, 2, 1},
+	{29776, 1229, 7, 9},
+	{4, 1229, 2, 1},
+	{452, 1229, 2, 1},
+	{4486, 1229, 2, 1},
+	{48, 1229, 2, 1},
+	{6303, 1229, 3, 1},
+	{41138, 1229, 4, 9},
+	{24631, 1229, 8, 0},
+	{3516, 1229, 3, 1},
+	{4517, 1229, 2, 1},
+	{24411, 1229, 8, 9},
+	{471, 1229, 2, 1},
+	{30959, 1229, 7, 9},
+	{31015, 1229, 7, 9},
+	{3231, 1229, 2, 1},
+	{37, 1229, 2, 1},
+	{635, 1229, 2, 1},
+	{458, 1229, 2, 1},
+	{1036, 1229, 2, 1},
+	{204, 1229, 2, 1},
+	{39245, 1229, 5, 9},
+	{5885, 1229, 3, 1},
+	{33482, 1229, 4, 1},
+	{1239, 1229, 2, 1},
+	{6712, 1229, 2, 1},
+	{728, 1229, 2, 1},
+	{13754, 1229, 11, 9},
+	{970, 1229, 2, 1},
+	{17714, 1229, 2, 1},
+	{102, 1229, 2, 1},
+	{492, 1229, 2, 1},
+	{26535, 1229, 8, 9},
+	{5601, 1229, 2, 1},
+	{736, 1229, 2, 1},
+	{578, 1229, 2, 1},
+	{1271, 1229, 2, 1},
+	{64, 1229, 2, 1},
+	{74, 1229, 2, 1},
+	{703, 1229, 2, 1},
+	{1504, 1229, 2, 1},
+	{2373, 1229, 2, 1},
+	{101, 1229, 2, 1},
+	{41602, 1229, 4, 9},
+	{42282, 1229, 3, 1},
+	{96, 1229, 2, 1},
+	{2335, 1229, 2, 1},
+	{1752, 1229, 2, 1},
+	{1734, 1229, 2, 1},
+	{5, 1229, 2, 1},
+	{778, 1229, 2, 1},
+	{27303, 1229, 8, 9},
+	{32807, 1229, 7, 9},
+	{220, 1229, 2, 1},
+	{221, 1229, 2, 1},
+	{1512, 1229, 2, 1},
+	{208, 1229, 2, 1},
+	{11443, 1229, 12, 9},
+	{1624, 1229, 2, 1},
+	{7352, 1229, 2, 1},
+	{161, 1229, 2, 1},
+	{114, 1229, 2, 1},
+	{97, 1229, 2, 1},
+	{7975, 1229, 2, 1},
+	{1758, 1229, 2, 1},
+	{1035, 1229, 2, 1},
+	{30775, 1229, 2, 1},
+	{13563, 1229, 2, 1},
+	{19, 1230, 3, 1},
+	{9778, 1230, 3, 1},
+	{42192, 1230, 3, 1},
+	{6019, 1230, 3, 1},
+	{2944, 1230, 3, 1},
+	{6352, 1230, 3, 1},
+	{4, 1231, 2, 1},
+	{19, 1231, 3, 1},
+	{2944, 1231, 3, 1},
+	{6352, 1231, 3, 1},
+	{552, 1236, 2, 9},
+	{19, 1236, 3, 1},
+	{9778, 1236, 3, 1},
+	{810, 1236, 3, 1},
+	{11610, 1236, 2, 9},
+	{6019, 1236, 3, 1},
+	{2944, 1236, 3, 1},
+	{6352, 1236, 3, 1},
+	{4056, 1237, 4, 1},
+	{16718, 1237, 3, 1},
+	{4, 1237, 2, 1},
+	{19, 1237, 3, 1},
+	{12521, 1237, 3, 1},
+	{9778, 1237, 3, 1},
+	{24743, 1237, 4, 1},
+	{38533, 1237, 3, 1},
+	{810, 1237, 3, 1},
+	{21606, 1237, 4, 1},
+	{2022, 1237, 3, 1},
+	{6019, 1237, 3, 1},
+	{2944, 1237, 3, 1},
+	{5080, 1237, 3, 1},
+	{6352, 1237, 3, 1},
+	{3510, 1237, 3, 1},
+	{2808, 1237, 3, 1},
+	{10046, 1237, 5, 1},
+	{9756, 1237, 3, 1},
+	{123, 1237, 3, 1},
+	{89, 1243, 2, 9},
+	{4, 1244, 2, 1},
+	{19, 1244, 3, 1},
+	{42237, 1244, 3, 1},
+	{2944, 1244, 3, 1},
+	{6352, 1244, 3, 1},
+	{35, 1258, 2, 1},
+	{38535, 1258, 3, 1},
+	{23967, 1258, 8, 9},
+	{19, 1258, 3, 1},
+	{9778, 1258, 3, 1},
+	{810, 1258, 3, 1},
+	{229, 1258, 6, 1},
+	{21606, 1258, 4, 1},
+	{2022, 1258, 3, 1},
+	{17722, 1258, 4, 1},
+	{2944, 1258, 3, 1},
+	{6352, 1258, 3, 1},
+	{5042, 1258, 3, 1},
+	{3492, 1266, 4, 9},
+	{6219, 1266, 2, 9},
+	{19, 1266, 3, 1},
+	{4572, 1266, 3, 9},
+	{9778, 1266, 3, 1},
+	{102, 1266, 2, 9},
+	{2944, 1266, 3, 1},
+	{6352, 1266, 3, 1},
+	{10111, 1279, 6, 9},
+	{38535, 1283, 3, 9},
+	{1512, 1283, 3, 9},
+	{10111, 1286, 6, 9},
+	{729, 1299, 7, 20},
+	{29769, 1299, 7, 9},
+	{19, 1299, 3, 1},
+	{6317, 1299, 6, 9},
+	{9778, 1299, 3, 1},
+	{810, 1299, 3, 1},
+	{36515, 1299, 6, 9},
+	{2944, 1299, 3, 1},
+	{6352, 1299, 3, 1},
+	{9169, 1321, 13, 1},
+	{14975, 1321, 11, 1},
+	{18882, 1321, 10, 1},
+	{15239, 1321, 11, 1},
+	{28855, 1336, 8, 1},
+	{23323, 1336, 9, 1},
+	{23341, 1336, 9, 1},
+	{28871, 1336, 8, 1},
+	{23458, 1336, 8, 1},
+	{23458, 1336, 9, 1},
+	{18832, 1382, 10, 1},
+	{19052, 1382, 10, 1},
+	{19152, 1382, 10, 1},
+	{19172, 1382, 10, 1},
+	{19232, 1382, 10, 1},
+	{15734, 1382, 11, 1},
+	{9156, 1432, 13, 1},
+	{5442, 1432, 15, 1},
+	{4060, 1432, 16, 1},
+	{9338, 1432, 13, 1},
+	{12031, 1432, 12, 1},
+	{15492, 1432, 11, 1},
+	{34074, 1435, 7, 9},
+	{7073, 1435, 14, 9},
+	{18902, 1435, 10, 9},
+	{23314, 1435, 9, 9},
+	{23341, 1435, 9, 9},
+	{23395, 1435, 9, 9},
+	{19072, 1435, 10, 9},
+	{23404, 1435, 9, 9},
+	{23413, 1435, 9, 9},
+	{15272, 1435, 11, 9},
+	{23959, 1469, 8, 9},
+	{24351, 1469, 8, 9},
+	{21478, 1469, 9, 9},
+	{33486, 1469, 7, 20},
+	{40915, 1469, 5, 9},
+	{19, 1474, 3, 1},
+	{9778, 1474, 3, 1},
+	{810, 1474, 3, 1},
+	{6019, 1474, 3, 1},
+	{2944, 1474, 3, 1},
+	{6352, 1474, 3, 1},
+	{6352, 1480, 3, 9},
+	{35, 1482, 2, 1},
+	{12566, 1482, 5, 1},
+	{231, 1482, 3, 1},
+	{4, 1482, 2, 1},
+	{9778, 1482, 3, 1},
+	{810, 1482, 3, 1},
+	{31036, 1482, 7, 1},
+	{5271, 1482, 3, 1},
+	{6019, 1482, 3, 1},
+	{2944, 1482, 3, 1},
+	{12810, 1482, 3, 1},
+	{23, 1482, 3, 1},
+	{3723, 1482, 3, 1},
+	{5080, 1482, 3, 1},
+	{6352, 1482, 3, 1},
+	{22378, 1482, 6, 1},
+	{2797, 1482, 2, 1},
+	{123, 1482, 3, 1},
+	{35, 1487, 2, 1},
+	{38535, 1487, 3, 1},
+	{4, 1487, 2, 1},
+	{19, 1487, 3, 1},
+	{9778, 1487, 3, 1},
+	{810, 1487, 3, 1},
+	{21606, 1487, 4, 1},
+	{6019, 1487, 3, 1},
+	{2944, 1487, 3, 1},
+	{6352, 1487, 3, 1},
+	{1512, 1487, 3, 1},
+	{29769, 1488, 7, 9},
+	{3863, 1488, 2, 9},
+	{21442, 1488, 4, 9},
+	{37853, 1488, 6, 20},
+	{35, 1490, 2, 1},
+	{4, 1490, 2, 1},
+	{810, 1490, 3, 1},
+	{6019, 1490, 3, 1},
+	{6352, 1490, 3, 1},
+	{26, 1651, 1, 9},
+	{14238, 1652, 11, 9},
+	{23967, 1660, 8, 9},
+	{7036, 1685, 3, 1},
+	{23967, 1687, 8, 9},
+	{41970, 1688, 4, 9},
+	{243, 1689, 2, 20},
+	{204, 1689, 2, 20},
+	{243, 1697, 2, 20},
+	{35861, 1697, 6, 20},
+	{23967, 1701, 8, 9},
+	{20002, 1701, 9, 0},
+	{10819, 1701, 12, 9},
+	{2800, 1703, 3, 1},
+	{24167, 1703, 8, 1},
+	{42285, 1703, 3, 1},
+	{50, 1703, 2, 1},
+	{42339, 1703, 3, 1},
+	{506, 1703, 2, 1},
+	{7977, 1703, 3, 1},
+	{6102, 1703, 3, 1},
+	{1758, 1703, 2, 1},
+	{42339, 1704, 3, 1},
+	{506, 1704, 2, 1},
+	{7977, 1704, 3, 1},
+	{6102, 1704, 3, 1},
+	{1758, 1704, 2, 1},
+	{2555, 1761, 5, 9},
+	{30217, 1762, 7, 9},
+	{23967, 1932, 8, 9},
+	{18342, 1932, 10, 9},
+	{11647, 1932, 12, 0},
+	{35, 1966, 2, 1},
+	{106, 1966, 2, 1},
+	{969, 1966, 2, 1},
+	{131, 1966, 2, 1},
+	{454, 1966, 2, 1},
+	{65, 1966, 2, 1},
+	{3531, 1966, 2, 1},
+	{27, 1966, 2, 1},
+	{810, 1966, 2, 1},
+	{970, 1966, 2, 1},
+	{323, 1966, 2, 1},
+	{578, 1966, 2, 1},
+	{1271, 1966, 2, 1},
+	{778, 1966, 2, 1},
+	{9846, 1966, 2, 1},
+	{481, 1966, 2, 1},
+	{4455, 1966, 2, 1},
+	{220, 1966, 2, 1},
+	{1277, 1966, 2, 1},
+	{919, 1966, 2, 1},
+	{99, 1966, 2, 1},
+	{6, 1966, 2, 1},
+	{868, 1966, 2, 1},
+	{1512, 1966, 2, 1},
+	{94, 1966, 2, 1},
+	{1406, 1966, 2, 1},
+	{1004, 1966, 2, 1},
+	{35, 1977, 2, 9},
+	{106, 1977, 2, 9},
+	{969, 1977, 2, 9},
+	{131, 1977, 2, 9},
+	{454, 1977, 2, 9},
+	{65, 1977, 2, 9},
+	{3531, 1977, 2, 9},
+	{27, 1977, 2, 9},
+	{810, 1977, 2, 9},
+	{970, 1977, 2, 9},
+	{323, 1977, 2, 9},
+	{578, 1977, 2, 9},
+	{1271, 1977, 2, 9},
+	{778, 1977, 2, 9},
+	{9846, 1977, 2, 9},
+	{481, 1977, 2, 9},
+	{4455, 1977, 2, 9},
+	{220, 1977, 2, 9},
+	{1277, 1977, 2, 9},
+	{919, 1977, 2, 9},
+	{99, 1977, 2, 9},
+	{6, 1977, 2, 9},
+	{868, 1977, 2, 9},
+	{1512, 1977, 2, 9},
+	{94, 1977, 2, 9},
+	{1406, 1977, 2, 9},
+	{1004, 1977, 2, 9},
+	{23967, 2059, 8, 9},
+	{1494, 2093, 2, 9},
+	{20794, 2101, 9, 9},
+	{42387, 2111, 3, 20},
+	{26, 2112, 2, 0},
+	{19570, 2112, 9, 9},
+	{41158, 2141, 4, 9},
+	{766, 2145, 2, 9},
+	{18692, 2146, 3, 9},
+	{17037, 2148, 5, 0},
+	{14947, 2148, 3, 9},
+	{4927, 2150, 2, 9},
+	{1624, 2155, 2, 9},
+	{6692, 2155, 2, 9},
+	{6692, 2157, 2, 9},
+	{25, 2159, 2, 9},
+	{6692, 2159, 2, 9},
+	{767, 2159, 2, 9},
+	{19732, 2160, 9, 0},
+	{24799, 2160, 6, 0},
+	{20794, 2160, 9, 0},
+	{42240, 2160, 3, 9},
+	{27007, 2160, 6, 0},
+	{36971, 2160, 6, 0},
+	{22369, 2160, 9, 9},
+	{8909, 2160, 13, 9},
+	{36, 2164, 2, 9},
+	{48, 2164, 2, 9},
+	{19471, 2179, 9, 0},
+	{2806, 2207, 6, 9},
+	{23967, 2224, 8, 9},
+	{458, 2227, 2, 9},
+	{458, 2242, 2, 9},
+	{4572, 2251, 3, 20},
+	{15862, 2257, 10, 0},
+	{19552, 2257, 9, 0},
+	{131, 2257, 14, 0},
+	{2869, 2257, 14, 0},
+	{6023, 2257, 14, 0},
+	{8769, 2257, 10, 0},
+	{156, 2257, 14, 0},
+	{181, 2257, 14, 0},
+	{5190, 2257, 12, 0},
+	{4542, 2257, 7, 20},
+	{20020, 2257, 9, 20},
+	{21614, 2257, 3, 20},
+	{5205, 2257, 12, 0},
+	{16592, 2257, 10, 0},
+	{16602, 2257, 10, 0},
+	{1138, 2257, 9, 0},
+	{11170, 2257, 9, 0},
+	{11182, 2257, 9, 0},
+	{17512, 2257, 10, 0},
+	{120, 2257, 2, 9},
+	{2849, 2257, 17, 9},
+	{2866, 2257, 17, 9},
+	{8766, 2257, 13, 9},
+	{2883, 2257, 17, 9},
+	{2900, 2257, 17, 9},
+	{5187, 2257, 15, 9},
+	{5202, 2257, 15, 9},
+	{11155, 2257, 12, 9},
+	{11167, 2257, 12, 9},
+	{11179, 2257, 12, 9},
+	{8779, 2257, 13, 9},
+	{799, 2257, 21, 9},
+	{11191, 2257, 12, 9},
+	{11203, 2257, 12, 9},
+	{3900, 2257, 16, 9},
+	{11215, 2257, 12, 9},
+	{11227, 2257, 12, 9},
+	{120, 2257, 25, 9},
+	{145, 2257, 25, 9},
+	{170, 2257, 25, 9},
+	{1127, 2257, 20, 9},
+	{1147, 2257, 20, 9},
+	{1167, 2257, 20, 9},
+	{1187, 2257, 20, 9},
+	{1207, 2257, 20, 9},
+	{1158, 2257, 9, 0},
+	{1178, 2257, 9, 9},
+	{11206, 2257, 9, 0},
+	{1198, 2257, 9, 0},
+	{1218, 2257, 9, 0},
+	{6, 2263, 1, 20},
+	{2543, 2277, 5, 9},
+	{16062, 2277, 4, 9},
+	{12988, 2293, 7, 20},
+	{12984, 2293, 11, 20},
+	{14513, 2293, 11, 20},
+	{791, 2295, 3, 20},
+	{42288, 2295, 3, 20},
+	{14323, 2295, 3, 20},
+	{8303, 2297, 4, 9},
+	{20794, 2297, 8, 9},
+	{131, 2340, 14, 9},
+	{2869, 2340, 14, 9},
+	{6023, 2340, 14, 9},
+	{8769, 2340, 10, 9},
+	{156, 2340, 14, 9},
+	{181, 2340, 14, 9},
+	{5190, 2340, 12, 9},
+	{5205, 2340, 12, 9},
+	{1138, 2340, 9, 9},
+	{11170, 2340, 9, 9},
+	{11182, 2340, 9, 9},
+	{1158, 2340, 9, 9},
+	{1178, 2340, 9, 9},
+	{11206, 2340, 9, 9},
+	{807, 2340, 13, 9},
+	{1198, 2340, 9, 9},
+	{1218, 2340, 9, 9},
+	{41162, 2347, 4, 9},
+	{41166, 2347, 4, 9},
+	{41170, 2347, 4, 9},
+	{41174, 2347, 4, 9},
+	{41914, 2347, 4, 9},
+	{41918, 2347, 4, 9},
+	{41922, 2347, 4, 9},
+	{41926, 2347, 4, 9},
+	{1403, 2352, 4, 9},
+	{33965, 2430, 4, 9},
+	{11095, 2432, 9, 9},
+	{11095, 2432, 12, 9},
+	{6653, 2436, 6, 9},
+	{6653, 2436, 14, 9},
+	{8303, 2499, 4, 9},
+	{42090, 2500, 3, 20},
+	{32156, 2509, 7, 9},
+	{10939, 2509, 12, 20},
+	{803, 2511, 2, 9},
+	{1403, 2512, 3, 9},
+	{33965, 2516, 4, 9},
+	{766, 2519, 2, 9},
+	{29566, 2534, 7, 9},
+	{9979, 2534, 8, 9},
+	{24703, 2534, 8, 9},
+	{41510, 2534, 4, 9},
+	{36743, 2534, 6, 9},
+	{32639, 2534, 7, 9},
+	{737, 2534, 4, 9},
+	{37439, 2534, 6, 9},
+	{5019, 2534, 2, 9},
+	{0, 2534, 1, 9},
+	{26281, 2534, 4, 9},
+	{2555, 2541, 5, 9},
+	{4367, 2542, 6, 9},
+	{42453, 2563, 3, 9},
+	{766, 2565, 2, 9},
+	{1403, 2574, 3, 9},
+	{6634, 2610, 3, 9},
+	{126, 2613, 4, 9},
+	{5042, 2622, 3, 9},
+	{42219, 2629, 3, 9},
+	{1029, 2629, 3, 9},
+	{20072, 2629, 3, 9},
+	{2094, 2631, 5, 9},
+	{14563, 2638, 2, 9},
+	{18989, 2642, 2, 9},
+	{28567, 2642, 8, 9},
+	{23967, 2678, 8, 9},
+	{18172, 2678, 10, 0},
+	{2555, 2691, 5, 20},
+	{9979, 2691, 6, 9},
+	{2555, 2692, 5, 0},
+	{4587, 2703, 3, 9},
+	{4587, 2705, 3, 9},
+	{6317, 2705, 6, 9},
+	{4587, 2722, 3, 9},
+	{127, 2723, 2, 0},
+	{9979, 2751, 8, 9},
+	{767, 2777, 4, 20},
+	{36029, 2789, 6, 9},
+	{42063, 2823, 3, 20},
+	{20461, 2838, 9, 9},
+	{23967, 2841, 8, 9},
+	{23967, 2850, 8, 9},
+	{23967, 2860, 8, 9},
+	{25487, 2879, 8, 9},
+	{767, 2884, 4, 9},
+	{720, 2892, 2, 9},
+	{8303, 2893, 4, 9},
+	{33965, 2893, 4, 9},
+	{34709, 2965, 6, 9},
+	{23967, 3135, 8, 9},
+	{6903, 3141, 3, 20},
+	{23967, 3151, 8, 9},
+	{32303, 3151, 7, 9},
+	{32877, 3151, 7, 9},
+	{18412, 3151, 10, 9},
+	{33033, 3159, 3, 1},
+	{42309, 3159, 3, 1},
+	{1403, 3239, 3, 9},
+	{19687, 3239, 9, 20},
+	{33965, 3243, 4, 9},
+	{40320, 3244, 5, 9},
+	{42414, 3245, 3, 9},
+	{6317, 3252, 6, 9},
+	{458, 3260, 2, 9},
+	{1403, 3268, 4, 9},
+	{16287, 3276, 5, 9},
+	{41546, 3282, 4, 9},
+	{5160, 3283, 3, 20},
+	{6100, 3287, 7, 9},
+	{4572, 3296, 3, 0},
+	{34793, 3296, 6, 0},
+	{7931, 3296, 4, 0},
+	{33514, 3296, 7, 0},
+	{19984, 3298, 9, 9},
+	{30, 3302, 1, 9},
+	{6653, 3541, 2, 9},
+	{16383, 3634, 4, 0},
+	{38355, 3760, 5, 1},
+	{969, 3760, 3, 1},
+	{39746, 3760, 4, 1},
+	{38430, 3760, 5, 1},
+	{34595, 3760, 6, 1},
+	{38635, 3760, 5, 1},
+	{41234, 3760, 4, 1},
+	{24959, 3760, 8, 1},
+	{39105, 3760, 5, 1},
+	{29327, 3760, 4, 1},
+	{31148, 3760, 7, 1},
+	{16862, 3760, 10, 1},
+	{16922, 3760, 10, 1},
+	{31302, 3760, 7, 1},
+	{31323, 3760, 7, 1},
+	{31393, 3760, 7, 1},
+	{31442, 3760, 7, 1},
+	{39315, 3760, 5, 1},
+	{35669, 3760, 6, 1},
+	{31624, 3760, 7, 1},
+	{25833, 3760, 4, 1},
+	{35789, 3760, 6, 1},
+	{35795, 3760, 6, 1},
+	{39380, 3760, 5, 1},
+	{27778, 3760, 4, 1},
+	{36239, 3760, 6, 1},
+	{3637, 3760, 7, 1},
+	{14007, 3760, 6, 1},
+	{32450, 3760, 7, 1},
+	{24078, 3760, 3, 1},
+	{36755, 3760, 6, 1},
+	{39895, 3760, 5, 1},
+	{32569, 3760, 7, 1},
+	{17902, 3760, 10, 1},
+	{25027, 3760, 4, 1},
+	{10905, 3760, 8, 1},
+	{22585, 3760, 9, 1},
+	{33220, 3760, 7, 1},
+	{37595, 3760, 6, 1},
+	{28159, 3760, 8, 1},
+	{22972, 3760, 9, 1},
+	{41866, 3760, 4, 1},
+	{41870, 3760, 4, 1},
+	{40620, 3760, 5, 1},
+	{28399, 3760, 8, 1},
+	{33640, 3760, 7, 1},
+	{23044, 3760, 9, 1},
+	{28455, 3760, 8, 1},
+	{37799, 3760, 6, 1},
+	{37811, 3760, 6, 1},
+	{2671, 3760, 8, 1},
+	{38255, 3760, 6, 1},
+	{8440, 3761, 5, 1},
+	{34715, 3761, 6, 1},
+	{24863, 3761, 8, 1},
+	{35159, 3761, 6, 1},
+	{13413, 3761, 11, 1},
+	{35273, 3761, 6, 1},
+	{8246, 3761, 13, 1},
+	{23624, 3761, 5, 1},
+	{35411, 3761, 6, 1},
+	{4755, 3761, 5, 1},
+	{21001, 3761, 9, 1},
+	{31526, 3761, 7, 1},
+	{25743, 3761, 8, 1},
+	{35729, 3761, 6, 1},
+	{21172, 3761, 9, 1},
+	{35825, 3761, 6, 1},
+	{39445, 3761, 5, 1},
+	{6535, 3761, 6, 1},
+	{17586, 3761, 6, 1},
+	{21766, 3761, 9, 1},
+	{36653, 3761, 6, 1},
+	{32499, 3761, 7, 1},
+	{22517, 3761, 5, 1},
+	{4852, 3761, 3, 1},
+	{13419, 3761, 5, 1},
+	{33136, 3761, 7, 1},
+	{38273, 3761, 6, 1},
+	{23620, 3761, 9, 1},
+	{34295, 3763, 6, 1},
+	{35171, 3763, 6, 1},
+	{20533, 3763, 9, 1},
+	{20551, 3763, 9, 1},
+	{31162, 3763, 7, 1},
+	{25191, 3763, 8, 1},
+	{20848, 3763, 9, 1},
+	{26127, 3763, 8, 1},
+	{36311, 3763, 6, 1},
+	{21793, 3763, 5, 1},
+	{17702, 3763, 10, 1},
+	{36689, 3763, 6, 1},
+	{36767, 3763, 6, 1},
+	{39975, 3763, 5, 1},
+	{27527, 3763, 8, 1},
+	{33045, 3763, 7, 1},
+	{18282, 3763, 10, 1},
+	{37325, 3763, 6, 1},
+	{40540, 3763, 5, 1},
+	{37787, 3763, 6, 1},
+	{33738, 3763, 7, 1},
+	{33766, 3763, 7, 1},
+	{38330, 3780, 5, 1},
+	{17907, 3780, 5, 1},
+	{34601, 3780, 6, 1},
+	{34607, 3780, 6, 1},
+	{34613, 3780, 6, 1},
+	{14476, 3780, 4, 1},
+	{20380, 3780, 9, 1},
+	{35039, 3780, 6, 1},
+	{16822, 3780, 10, 1},
+	{25327, 3780, 8, 1},
+	{6527, 3780, 8, 1},
+	{16922, 3780, 10, 1},
+	{39235, 3780, 5, 1},
+	{3634, 3780, 5, 1},
+	{25599, 3780, 8, 1},
+	{25687, 3780, 8, 1},
+	{13677, 3780, 7, 1},
+	{28225, 3780, 6, 1},
+	{8615, 3780, 8, 1},
+	{31694, 3780, 7, 1},
+	{25871, 3780, 8, 1},
+	{35843, 3780, 6, 1},
+	{26031, 3780, 8, 1},
+	{35903, 3780, 6, 1},
+	{32128, 3780, 7, 1},
+	{36215, 3780, 6, 1},
+	{36239, 3780, 6, 1},
+	{17562, 3780, 10, 1},
+	{36389, 3780, 6, 1},
+	{21793, 3780, 9, 1},
+	{36533, 3780, 6, 1},
+	{17692, 3780, 10, 1},
+	{21865, 3780, 9, 1},
+	{36587, 3780, 6, 1},
+	{21257, 3780, 4, 1},
+	{8649, 3780, 13, 1},
+	{32611, 3780, 7, 1},
+	{36815, 3780, 6, 1},
+	{26138, 3780, 5, 1},
+	{40255, 3780, 5, 1},
+	{18122, 3780, 6, 1},
+	{22522, 3780, 9, 1},
+	{33206, 3780, 7, 1},
+	{16967, 3780, 6, 1},
+	{37349, 3780, 6, 1},
+	{22693, 3780, 9, 1},
+	{25881, 3780, 4, 1},
+	{39251, 3780, 4, 1},
+	{28335, 3780, 8, 1},
+	{37727, 3780, 6, 1},
+	{28383, 3780, 8, 1},
+	{28415, 3780, 8, 1},
+	{33808, 3780, 7, 1},
+	{23530, 3780, 9, 1},
+	{34081, 3780, 7, 1},
+	{19342, 3780, 10, 1},
+	{5952, 3780, 15, 1},
+	{19352, 3780, 10, 1},
+	{35616, 3798, 5, 1},
+	{37356, 3798, 5, 1},
+	{21932, 3798, 5, 1},
+	{31274, 3798, 7, 1},
+	{3638, 3798, 3, 1},
+	{8693, 3798, 8, 1},
+	{35747, 3798, 6, 1},
+	{21271, 3798, 9, 1},
+	{36143, 3798, 6, 1},
+	{32135, 3798, 7, 1},
+	{3603, 3798, 9, 1},
+	{26855, 3798, 8, 1},
+	{32436, 3798, 7, 1},
+	{41903, 3798, 3, 1},
+	{40240, 3798, 5, 1},
+	{40310, 3798, 5, 1},
+	{14469, 3798, 11, 1},
+	{33563, 3798, 4, 1},
+	{3751, 3798, 4, 1},
+	{4761, 3798, 6, 1},
+	{33829, 3798, 7, 1},
+	{19332, 3798, 10, 1},
+	{8538, 3806, 7, 1},
+	{30112, 3806, 7, 1},
+	{38955, 3806, 5, 1},
+	{39205, 3806, 5, 1},
+	{21100, 3806, 9, 1},
+	{36239, 3806, 6, 1},
+	{8532, 3806, 13, 1},
+	{39855, 3806, 5, 1},
+	{6484, 3806, 3, 1},
+	{12956, 3806, 3, 1},
+	{40230, 3806, 5, 1},
+	{14359, 3806, 5, 1},
+	{28159, 3806, 8, 1},
+	{11527, 3806, 7, 1},
+	{21044, 3806, 6, 1},
+	{8262, 3807, 6, 1},
+	{38575, 3807, 5, 1},
+	{29678, 3807, 7, 1},
+	{19957, 3807, 7, 1},
+	{29685, 3807, 7, 1},
+	{16252, 3807, 10, 1},
+	{24199, 3807, 8, 1},
+	{14476, 3807, 4, 1},
+	{29951, 3807, 7, 1},
+	{13358, 3807, 7, 1},
+	{35219, 3807, 6, 1},
+	{2662, 3807, 7, 1},
+	{25183, 3807, 8, 1},
+	{25199, 3807, 8, 1},
+	{35483, 3807, 6, 1},
+	{25343, 3807, 8, 1},
+	{13477, 3807, 4, 1},
+	{31624, 3807, 6, 1},
+	{35681, 3807, 6, 1},
+	{35705, 3807, 6, 1},
+	{35735, 3807, 6, 1},
+	{17737, 3807, 4, 1},
+	{35873, 3807, 6, 1},
+	{35891, 3807, 6, 1},
+	{8240, 3807, 6, 1},
+	{5082, 3807, 6, 1},
+	{17612, 3807, 6, 1},
+	{5086, 3807, 6, 1},
+	{26543, 3807, 8, 1},
+	{26559, 3807, 8, 1},
+	{26679, 3807, 8, 1},
+	{26791, 3807, 8, 1},
+	{36563, 3807, 6, 1},
+	{10891, 3807, 5, 1},
+	{36683, 3807, 6, 1},
+	{39885, 3807, 5, 1},
+	{32555, 3807, 7, 1},
+	{17097, 3807, 5, 1},
+	{6249, 3807, 3, 1},
+	{39925, 3807, 5, 1},
+	{30845, 3807, 4, 1},
+	{17617, 3807, 5, 1},
+	{2754, 3807, 3, 1},
+	{33003, 3807, 7, 1},
+	{27639, 3807, 8, 1},
+	{37331, 3807, 6, 1},
+	{8883, 3807, 13, 1},
+	{37355, 3807, 6, 1},
+	{40430, 3807, 5, 1},
+	{1602, 3807, 3, 1},
+	{22873, 3807, 9, 1},
+	{25905, 3807, 6, 1},
+	{8760, 3807, 6, 1},
+	{35403, 3807, 4, 1},
+	{33654, 3807, 7, 1},
+	{37877, 3807, 6, 1},
+	{40700, 3807, 5, 1},
+	{3636, 3807, 3, 1},
+	{40504, 3807, 4, 1},
+	{38219, 3807, 6, 1},
+	{4346, 3807, 4, 1},
+	{28935, 3807, 8, 1},
+	{23611, 3807, 9, 1},
+	{19417, 3808, 9, 1},
+	{15892, 3808, 10, 1},
+	{7700, 3808, 13, 1},
+	{29223, 3808, 7, 1},
+	{34403, 3808, 6, 1},
+	{6593, 3808, 4, 1},
+	{8432, 3808, 9, 1},
+	{24935, 3808, 8, 1},
+	{35027, 3808, 6, 1},
+	{35255, 3808, 6, 1},
+	{2662, 3808, 7, 1},
+	{22613, 3808, 6, 1},
+	{32502, 3808, 6, 1},
+	{35471, 3808, 6, 1},
+	{16962, 3808, 10, 1},
+	{21938, 3808, 8, 1},
+	{21968, 3808, 5, 1},
+	{20884, 3808, 9, 1},
+	{17072, 3808, 10, 1},
+	{25711, 3808, 8, 1},
+	{25783, 3808, 8, 1},
+	{25927, 3808, 8, 1},
+	{10615, 3808, 12, 1},
+	{39390, 3808, 5, 1},
+	{7653, 3808, 8, 1},
+	{35867, 3808, 6, 1},
+	{36245, 3808, 6, 1},
+	{32191, 3808, 7, 1},
+	{8534, 3808, 5, 1},
+	{39740, 3808, 5, 1},
+	{21901, 3808, 9, 1},
+	{32443, 3808, 7, 1},
+	{26062, 3808, 5, 1},
+	{32625, 3808, 7, 1},
+	{12956, 3808, 3, 1},
+	{37654, 3808, 5, 1},
+	{27575, 3808, 8, 1},
+	{33192, 3808, 7, 1},
+	{3619, 3808, 9, 1},
+	{40365, 3808, 5, 1},
+	{41798, 3808, 4, 1},
+	{28047, 3808, 8, 1},
+	{33451, 3808, 7, 1},
+	{28279, 3808, 8, 1},
+	{28295, 3808, 8, 1},
+	{40560, 3808, 5, 1},
+	{38183, 3808, 6, 1},
+	{7647, 3808, 6, 1},
+	{23566, 3808, 9, 1},
+	{34102, 3808, 7, 1},
+	{29007, 3808, 6, 1},
+	{29181, 3809, 7, 1},
+	{1638, 3809, 3, 1},
+	{41246, 3809, 4, 1},
+	{38990, 3809, 5, 1},
+	{41262, 3809, 4, 1},
+	{41294, 3809, 4, 1},
+	{31134, 3809, 7, 1},
+	{31155, 3809, 7, 1},
+	{13354, 3809, 4, 1},
+	{3612, 3809, 16, 1},
+	{31246, 3809, 7, 1},
+	{39205, 3809, 5, 1},
+	{10555, 3809, 12, 1},
+	{13965, 3809, 4, 1},
+	{25727, 3809, 8, 1},
+	{21046, 3809, 9, 1},
+	{35711, 3809, 6, 1},
+	{25895, 3809, 8, 1},
+	{10765, 3809, 4, 1},
+	{26527, 3809, 8, 1},
+	{36329, 3809, 6, 1},
+	{26567, 3809, 8, 1},
+	{36455, 3809, 6, 1},
+	{13974, 3809, 11, 1},
+	{34290, 3809, 5, 1},
+	{27543, 3809, 8, 1},
+	{10546, 3809, 4, 1},
+	{18212, 3809, 10, 1},
+	{3619, 3809, 9, 1},
+	{37613, 3809, 6, 1},
+	{28231, 3809, 8, 1},
+	{40550, 3809, 5, 1},
+	{25941, 3809, 4, 1},
+	{37745, 3809, 6, 1},
+	{28775, 3809, 8, 1},
+	{28903, 3809, 8, 1},
+	{38225, 3809, 6, 1},
+	{36613, 3809, 4, 1},
+	{34277, 3817, 6, 1},
+	{29713, 3817, 7, 1},
+	{30798, 3817, 7, 1},
+	{4797, 3817, 15, 1},
+	{31379, 3817, 7, 1},
+	{31407, 3817, 7, 1},
+	{31540, 3817, 5, 1},
+	{39320, 3817, 5, 1},
+	{21082, 3817, 9, 1},
+	{35699, 3817, 6, 1},
+	{39345, 3817, 5, 1},
+	{31813, 3817, 7, 1},
+	{26311, 3817, 8, 1},
+	{39620, 3817, 5, 1},
+	{36215, 3817, 6, 1},
+	{26503, 3817, 8, 1},
+	{17672, 3817, 10, 1},
+	{26807, 3817, 8, 1},
+	{32345, 3817, 7, 1},
+	{36725, 3817, 6, 1},
+	{20883, 3817, 6, 1},
+	{3519, 3817, 3, 1},
+	{3442, 3817, 3, 1},
+	{22468, 3817, 9, 1},
+	{22549, 3817, 9, 1},
+	{27807, 3817, 6, 1},
+	{40365, 3817, 5, 1},
+	{28215, 3817, 8, 1},
+	{28231, 3817, 8, 1},
+	{28287, 3817, 8, 1},
+	{14590, 3817, 11, 1},
+	{33584, 3817, 7, 1},
+	{23080, 3817, 9, 1},
+	{28535, 3817, 8, 1},
+	{28599, 3817, 4, 1},
+	{28999, 3817, 8, 1},
+	{19624, 3824, 9, 1},
+	{38705, 3824, 5, 1},
+	{30189, 3824, 7, 1},
+	{38945, 3824, 5, 1},
+	{24903, 3824, 8, 1},
+	{13446, 3824, 11, 1},
+	{3580, 3824, 16, 1},
+	{39160, 3824, 5, 1},
+	{10543, 3824, 12, 1},
+	{39305, 3824, 5, 1},
+	{14496, 3824, 3, 1},
+	{35855, 3824, 6, 1},
+	{41454, 3824, 4, 1},
+	{18106, 3824, 6, 1},
+	{3637, 3824, 7, 1},
+	{6685, 3824, 4, 1},
+	{27151, 3824, 8, 1},
+	{8688, 3824, 13, 1},
+	{39955, 3824, 5, 1},
+	{6187, 3824, 4, 1},
+	{9589, 3824, 4, 1},
+	{22405, 3824, 9, 1},
+	{27791, 3824, 8, 1},
+	{33227, 3824, 7, 1},
+	{28247, 3824, 8, 1},
+	{23663, 3825, 8, 1},
+	{29127, 3825, 5, 1},
+	{29104, 3825, 7, 1},
+	{29125, 3825, 7, 1},
+	{29139, 3825, 7, 1},
+	{19615, 3825, 9, 1},
+	{19633, 3825, 9, 1},
+	{34337, 3825, 6, 1},
+	{34343, 3825, 6, 1},
+	{4806, 3825, 6, 1},
+	{38515, 3825, 5, 1},
+	{41018, 3825, 4, 1},
+	{34469, 3825, 6, 1},
+	{34475, 3825, 6, 1},
+	{23943, 3825, 8, 1},
+	{12874, 3825, 11, 1},
+	{29706, 3825, 7, 1},
+	{6593, 3825, 4, 1},
+	{34865, 3825, 6, 1},
+	{30133, 3825, 7, 1},
+	{38825, 3825, 5, 1},
+	{38835, 3825, 5, 1},
+	{21437, 3825, 4, 1},
+	{34913, 3825, 6, 1},
+	{24879, 3825, 8, 1},
+	{8432, 3825, 9, 1},
+	{10753, 3825, 6, 1},
+	{24927, 3825, 8, 1},
+	{35201, 3825, 6, 1},
+	{25071, 3825, 8, 1},
+	{10159, 3825, 12, 1},
+	{35351, 3825, 6, 1},
+	{8220, 3825, 13, 1},
+	{13457, 3825, 11, 1},
+	{32516, 3825, 5, 1},
+	{31169, 3825, 7, 1},
+	{35399, 3825, 6, 1},
+	{25271, 3825, 8, 1},
+	{20722, 3825, 9, 1},
+	{25295, 3825, 8, 1},
+	{39205, 3825, 5, 1},
+	{31281, 3825, 7, 1},
+	{25431, 3825, 8, 1},
+	{20857, 3825, 9, 1},
+	{35543, 3825, 6, 1},
+	{17082, 3825, 10, 1},
+	{25647, 3825, 8, 1},
+	{13666, 3825, 11, 1},
+	{10579, 3825, 12, 1},
+	{25679, 3825, 8, 1},
+	{35723, 3825, 6, 1},
+	{25815, 3825, 8, 1},
+	{31680, 3825, 7, 1},
+	{21154, 3825, 9, 1},
+	{8441, 3825, 13, 1},
+	{35771, 3825, 6, 1},
+	{25951, 3825, 8, 1},
+	{21235, 3825, 9, 1},
+	{26111, 3825, 8, 1},
+	{26119, 3825, 8, 1},
+	{10675, 3825, 12, 1},
+	{31820, 3825, 7, 1},
+	{31827, 3825, 7, 1},
+	{39445, 3825, 5, 1},
+	{32100, 3825, 7, 1},
+	{26399, 3825, 8, 1},
+	{36251, 3825, 6, 1},
+	{10747, 3825, 12, 1},
+	{26583, 3825, 8, 1},
+	{26639, 3825, 8, 1},
+	{27593, 3825, 6, 1},
+	{32254, 3825, 7, 1},
+	{41586, 3825, 4, 1},
+	{26791, 3825, 8, 1},
+	{10831, 3825, 12, 1},
+	{10843, 3825, 12, 1},
+	{39725, 3825, 5, 1},
+	{32352, 3825, 7, 1},
+	{36611, 3825, 6, 1},
+	{36617, 3825, 6, 1},
+	{26951, 3825, 8, 1},
+	{36659, 3825, 4, 1},
+	{14007, 3825, 11, 1},
+	{14018, 3825, 11, 1},
+	{36725, 3825, 6, 1},
+	{32513, 3825, 7, 1},
+	{39860, 3825, 5, 1},
+	{39905, 3825, 5, 1},
+	{14012, 3825, 6, 1},
+	{39965, 3825, 5, 1},
+	{39970, 3825, 5, 1},
+	{32709, 3825, 7, 1},
+	{22072, 3825, 9, 1},
+	{3786, 3825, 4, 1},
+	{39995, 3825, 5, 1},
+	{40065, 3825, 5, 1},
+	{27447, 3825, 8, 1},
+	{40145, 3825, 5, 1},
+	{22270, 3825, 9, 1},
+	{14348, 3825, 7, 1},
+	{14348, 3825, 11, 1},
+	{37241, 3825, 6, 1},
+	{22360, 3825, 9, 1},
+	{27775, 3825, 8, 1},
+	{40345, 3825, 5, 1},
+	{27783, 3825, 8, 1},
+	{19634, 3825, 8, 1},
+	{33157, 3825, 7, 1},
+	{33164, 3825, 7, 1},
+	{22495, 3825, 9, 1},
+	{14627, 3825, 7, 1},
+	{22540, 3825, 9, 1},
+	{11359, 3825, 12, 1},
+	{27807, 3825, 8, 1},
+	{22603, 3825, 9, 1},
+	{33213, 3825, 7, 1},
+	{22621, 3825, 9, 1},
+	{33290, 3825, 7, 1},
+	{10583, 3825, 8, 1},
+	{40525, 3825, 5, 1},
+	{37631, 3825, 6, 1},
+	{28263, 3825, 8, 1},
+	{28271, 3825, 8, 1},
+	{22945, 3825, 9, 1},
+	{33563, 3825, 7, 1},
+	{40615, 3825, 5, 1},
+	{23026, 3825, 9, 1},
+	{37739, 3825, 6, 1},
+	{25113, 3825, 4, 1},
+	{37793, 3825, 6, 1},
+	{28479, 3825, 8, 1},
+	{33661, 3825, 7, 1},
+	{28519, 3825, 8, 1},
+	{23071, 3825, 9, 1},
+	{33801, 3825, 7, 1},
+	{37943, 3825, 6, 1},
+	{31172, 3825, 4, 1},
+	{23152, 3825, 9, 1},
+	{28759, 3825, 8, 1},
+	{33927, 3825, 7, 1},
+	{38213, 3825, 6, 1},
+	{38267, 3825, 6, 1},
+	{40970, 3828, 4, 1},
+	{21063, 3828, 6, 1},
+	{10626, 3828, 3, 1},
+	{19462, 3828, 9, 1},
+	{34289, 3828, 6, 1},
+	{28210, 3828, 5, 1},
+	{8262, 3828, 6, 1},
+	{13892, 3828, 5, 1},
+	{24895, 3828, 8, 1},
+	{30980, 3828, 7, 1},
+	{35285, 3828, 6, 1},
+	{35369, 3828, 6, 1},
+	{6527, 3828, 8, 1},
+	{22569, 3828, 7, 1},
+	{35772, 3828, 5, 1},
+	{25583, 3828, 8, 1},
+	{25631, 3828, 8, 1},
+	{25647, 3828, 8, 1},
+	{39330, 3828, 5, 1},
+	{31624, 3828, 6, 1},
+	{21118, 3828, 9, 1},
+	{10569, 3828, 4, 1},
+	{13886, 3828, 11, 1},
+	{13996, 3828, 11, 1},
+	{21964, 3828, 9, 1},
+	{12956, 3828, 3, 1},
+	{19515, 3828, 5, 1},
+	{37223, 3828, 6, 1},
+	{27647, 3828, 8, 1},
+	{41750, 3828, 4, 1},
+	{37331, 3828, 6, 1},
+	{22576, 3828, 9, 1},
+	{14499, 3828, 5, 1},
+	{21571, 3828, 6, 1},
+	{33451, 3828, 6, 1},
+	{8760, 3828, 4, 1},
+	{18442, 3828, 10, 1},
+	{28207, 3828, 8, 1},
+	{28271, 3828, 6, 1},
+	{26178, 3828, 5, 1},
+	{33472, 3828, 7, 1},
+	{33647, 3828, 7, 1},
+	{38183, 3828, 4, 1},
+	{21687, 3828, 7, 1},
+	{19342, 3828, 4, 1},
+	{25945, 3828, 6, 1},
+	{4590, 3829, 3, 1},
+	{17907, 3829, 5, 1},
+	{38465, 3829, 5, 1},
+	{24191, 3829, 8, 1},
+	{38700, 3829, 5, 1},
+	{20362, 3829, 9, 1},
+	{10231, 3829, 7, 1},
+	{13468, 3829, 11, 1},
+	{10231, 3829, 12, 1},
+	{16872, 3829, 10, 1},
+	{31232, 3829, 7, 1},
+	{721, 3829, 3, 1},
+	{25335, 3829, 8, 1},
+	{39250, 3829, 5, 1},
+	{39270, 3829, 5, 1},
+	{41370, 3829, 4, 1},
+	{10579, 3829, 6, 1},
+	{21046, 3829, 6, 1},
+	{22920, 3829, 7, 1},
+	{13688, 3829, 11, 1},
+	{17737, 3829, 4, 1},
+	{41542, 3829, 4, 1},
+	{21012, 3829, 4, 1},
+	{26615, 3829, 6, 1},
+	{6685, 3829, 4, 1},
+	{26839, 3829, 8, 1},
+	{39850, 3829, 5, 1},
+	{4852, 3829, 5, 1},
+	{32618, 3829, 7, 1},
+	{22315, 3829, 9, 1},
+	{14359, 3829, 5, 1},
+	{18122, 3829, 10, 1},
+	{22513, 3829, 9, 1},
+	{18302, 3829, 10, 1},
+	{22639, 3829, 9, 1},
+	{41806, 3829, 4, 1},
+	{40500, 3829, 5, 1},
+	{28151, 3829, 8, 1},
+	{14579, 3829, 11, 1},
+	{40620, 3829, 5, 1},
+	{37757, 3829, 6, 1},
+	{12793, 3829, 4, 1},
+	{37775, 3829, 6, 1},
+	{23062, 3829, 9, 1},
+	{33745, 3829, 7, 1},
+	{28575, 3829, 8, 1},
+	{37955, 3829, 6, 1},
+	{34081, 3829, 7, 1},
+	{28903, 3829, 8, 1},
+	{38261, 3829, 6, 1},
+	{42010, 3829, 4, 1},
+	{29167, 3831, 7, 1},
+	{39095, 3831, 5, 1},
+	{31092, 3831, 7, 1},
+	{8214, 3831, 4, 1},
+	{35609, 3831, 6, 1},
+	{25703, 3831, 8, 1},
+	{25775, 3831, 8, 1},
+	{10627, 3831, 7, 1},
+	{26815, 3831, 8, 1},
+	{39730, 3831, 5, 1},
+	{5080, 3831, 4, 1},
+	{27015, 3831, 8, 1},
+	{26819, 3831, 4, 1},
+	{8211, 3831, 5, 1},
+	{37547, 3831, 4, 1},
+	{33731, 3831, 7, 1},
+	{33759, 3831, 7, 1},
+	{28583, 3831, 8, 1},
+	{25769, 3831, 6, 1},
+	{38950, 3833, 5, 1},
+	{24871, 3833, 8, 1},
+	{25087, 3833, 8, 1},
+	{20623, 3833, 9, 1},
+	{32502, 3833, 6, 1},
+	{18284, 3833, 8, 1},
+	{16932, 3833, 10, 1},
+	{25463, 3833, 8, 1},
+	{39280, 3833, 5, 1},
+	{35561, 3833, 6, 1},
+	{25607, 3833, 8, 1},
+	{17112, 3833, 10, 1},
+	{31603, 3833, 7, 1},
+	{17162, 3833, 5, 1},
+	{25919, 3833, 8, 1},
+	{41450, 3833, 4, 1},
+	{27529, 3833, 6, 1},
+	{26151, 3833, 8, 1},
+	{17612, 3833, 6, 1},
+	{26575, 3833, 8, 1},
+	{32233, 3833, 7, 1},
+	{36665, 3833, 6, 1},
+	{21257, 3833, 4, 1},
+	{32534, 3833, 7, 1},
+	{39411, 3833, 4, 1},
+	{32716, 3833, 7, 1},
+	{8753, 3833, 13, 1},
+	{13679, 3833, 5, 1},
+	{14491, 3833, 11, 1},
+	{37511, 3833, 6, 1},
+	{28311, 3833, 8, 1},
+	{12955, 3833, 4, 1},
+	{38195, 3833, 6, 1},
+	{38219, 3833, 6, 1},
+	{29314, 3835, 7, 1},
+	{8207, 3835, 13, 1},
+	{31547, 3835, 7, 1},
+	{25991, 3835, 8, 1},
+	{39595, 3835, 5, 1},
+	{26367, 3835, 8, 1},
+	{36335, 3835, 6, 1},
+	{26863, 3835, 8, 1},
+	{37235, 3835, 6, 1},
+	{33444, 3835, 7, 1},
+	{22909, 3835, 9, 1},
+	{33591, 3835, 7, 1},
+	{28591, 3835, 8, 1},
+	{40760, 3835, 5, 1},
+	{29031, 3835, 8, 1},
+	{38360, 3836, 5, 1},
+	{36242, 3836, 5, 1},
+	{39135, 3836, 5, 1},
+	{5885, 3836, 3, 1},
+	{20165, 3836, 4, 1},
+	{15893, 3836, 5, 1},
+	{20983, 3836, 9, 1},
+	{35645, 3836, 6, 1},
+	{25791, 3836, 8, 1},
+	{39340, 3836, 5, 1},
+	{31778, 3836, 7, 1},
+	{17412, 3836, 10, 1},
+	{21568, 3836, 9, 1},
+	{17582, 3836, 10, 1},
+	{26823, 3836, 8, 1},
+	{10915, 3836, 12, 1},
+	{8792, 3836, 13, 1},
+	{42375, 3836, 3, 1},
+	{28319, 3836, 8, 1},
+	{40905, 3836, 5, 1},
+	{34205, 3837, 6, 1},
+	{34355, 3837, 6, 1},
+	{27748, 3837, 5, 1},
+	{19948, 3837, 9, 1},
+	{38810, 3837, 5, 1},
+	{24871, 3837, 8, 1},
+	{35207, 3837, 6, 1},
+	{35225, 3837, 6, 1},
+	{20632, 3837, 9, 1},
+	{31365, 3837, 7, 1},
+	{35621, 3837, 6, 1},
+	{25615, 3837, 8, 1},
+	{25943, 3837, 8, 1},
+	{32121, 3837, 7, 1},
+	{6751, 3837, 14, 1},
+	{39650, 3837, 5, 1},
+	{39715, 3837, 5, 1},
+	{26967, 3837, 8, 1},
+	{32527, 3837, 7, 1},
+	{1903, 3837, 2, 1},
+	{31809, 3837, 4, 1},
+	{18102, 3837, 10, 1},
+	{27591, 3837, 8, 1},
+	{37883, 3837, 6, 1},
+	{28911, 3837, 8, 1},
+	{7647, 3837, 6, 1},
+	{28951, 3837, 8, 1},
+	{29007, 3837, 8, 1},
+	{38297, 3837, 4, 1},
+	{17265, 3837, 5, 1},
+	{21447, 3839, 4, 2},
+	{21447, 3843, 4, 2},
+	{21447, 3844, 4, 2},
+	{8440, 3845, 3, 1},
+	{35081, 3845, 6, 1},
+	{35351, 3845, 6, 1},
+	{10219, 3845, 12, 1},
+	{204, 3845, 3, 1},
+	{17072, 3845, 6, 1},
+	{8693, 3845, 4, 1},
+	{25903, 3845, 8, 1},
+	{39365, 3845, 5, 1},
+	{18106, 3845, 6, 1},
+	{26655, 3845, 8, 1},
+	{36473, 3845, 6, 1},
+	{36557, 3845, 6, 1},
+	{26799, 3845, 8, 1},
+	{32338, 3845, 7, 1},
+	{21955, 3845, 9, 1},
+	{17782, 3845, 10, 1},
+	{4466, 3845, 4, 1},
+	{17097, 3845, 5, 1},
+	{28478, 3845, 5, 1},
+	{36869, 3845, 6, 1},
+	{29224, 3845, 6, 1},
+	{37493, 3845, 6, 1},
+	{37529, 3845, 6, 1},
+	{14368, 3845, 4, 1},
+	{14623, 3845, 11, 1},
+	{23044, 3845, 4, 1},
+	{10226, 3845, 5, 1},
+	{40710, 3845, 5, 1},
+	{38243, 3845, 6, 1},
+	{29015, 3845, 8, 1},
+	{13659, 3846, 7, 1},
+	{22015, 3846, 4, 1},
+	{13341, 3846, 3, 1},
+	{38645, 3846, 5, 1},
+	{31064, 3846, 7, 1},
+	{13655, 3846, 11, 1},
+	{31687, 3846, 7, 1},
+	{26055, 3846, 8, 1},
+	{32107, 3846, 7, 1},
+	{36233, 3846, 6, 1},
+	{26511, 3846, 8, 1},
+	{13908, 3846, 11, 1},
+	{36539, 3846, 6, 1},
+	{21919, 3846, 9, 1},
+	{13914, 3846, 5, 1},
+	{41903, 3846, 3, 1},
+	{21571, 3846, 6, 1},
+	{28191, 3846, 8, 1},
+	{21162, 3846, 3, 1},
+	{15983, 3846, 3, 1},
+	{13365, 3846, 6, 1},
+	{7647, 3846, 6, 1},
+	{19322, 3846, 10, 1},
+	{35724, 3848, 5, 1},
+	{13358, 3848, 11, 1},
+	{8259, 3848, 11, 1},
+	{458, 3848, 3, 1},
+	{1103, 3848, 3, 1},
+	{41374, 3848, 4, 1},
+	{31519, 3848, 7, 1},
+	{25679, 3848, 4, 1},
+	{6681, 3848, 4, 1},
+	{41422, 3848, 4, 1},
+	{26079, 3848, 8, 1},
+	{26175, 3848, 8, 1},
+	{21343, 3848, 9, 1},
+	{26183, 3848, 8, 1},
+	{32051, 3848, 7, 1},
+	{5082, 3848, 6, 1},
+	{5082, 3848, 15, 1},
+	{36359, 3848, 6, 1},
+	{41562, 3848, 4, 1},
+	{17682, 3848, 10, 1},
+	{32310, 3848, 7, 1},
+	{36575, 3848, 6, 1},
+	{22090, 3848, 9, 1},
+	{40260, 3848, 5, 1},
+	{35624, 3848, 5, 1},
+	{21346, 3848, 6, 1},
+	{4753, 3848, 3, 1},
+	{23125, 3848, 9, 1},
+	{35719, 3848, 6, 1},
+	{23557, 3848, 9, 1},
+	{19332, 3848, 6, 1},
+	{17907, 3857, 5, 1},
+	{39220, 3857, 5, 1},
+	{4639, 3857, 3, 1},
+	{25623, 3857, 8, 1},
+	{31638, 3857, 7, 1},
+	{35747, 3857, 4, 1},
+	{25879, 3857, 8, 1},
+	{38103, 3857, 4, 1},
+	{35801, 3857, 6, 1},
+	{35855, 3857, 6, 1},
+	{35897, 3857, 6, 1},
+	{21577, 3857, 9, 1},
+	{39620, 3857, 5, 1},
+	{36239, 3857, 6, 1},
+	{21658, 3857, 9, 1},
+	{36317, 3857, 6, 1},
+	{5086, 3857, 6, 1},
+	{36527, 3857, 6, 1},
+	{2666, 3857, 5, 1},
+	{37547, 3857, 6, 1},
+	{33444, 3857, 4, 1},
+	{40525, 3857, 5, 1},
+	{21179, 3857, 4, 1},
+	{37643, 3857, 6, 1},
+	{41862, 3857, 4, 1},
+	{2671, 3857, 3, 1},
+	{24938, 3857, 5, 1},
+	{28631, 3857, 8, 1},
+	{33934, 3857, 7, 1},
+	{23584, 3857, 9, 1},
+	{24943, 3858, 8, 1},
+	{2662, 3858, 17, 1},
+	{17012, 3858, 10, 1},
+	{31449, 3858, 7, 1},
+	{35627, 3858, 6, 1},
+	{8693, 3858, 4, 1},
+	{25799, 3858, 8, 1},
+	{26375, 3858, 8, 1},
+	{2669, 3858, 10, 1},
+	{8545, 3858, 13, 1},
+	{6535, 3858, 6, 1},
+	{28291, 3858, 6, 1},
+	{36605, 3858, 6, 1},
+	{32541, 3858, 7, 1},
+	{25994, 3858, 5, 1},
+	{32632, 3858, 7, 1},
+	{8688, 3858, 5, 1},
+	{14353, 3858, 4, 1},
+	{37295, 3858, 6, 1},
+	{33143, 3858, 7, 1},
+	{8857, 3858, 13, 1},
+	{25612, 3858, 7, 1},
+	{27823, 3858, 8, 1},
+	{22630, 3858, 9, 1},
+	{37589, 3858, 6, 1},
+	{39278, 3858, 5, 1},
+	{9982, 3858, 4, 1},
+	{37751, 3858, 6, 1},
+	{38105, 3858, 6, 1},
+	{38129, 3858, 6, 1},
+	{28919, 3858, 8, 1},
+	{755, 3858, 3, 1},
+	{4837, 3859, 3, 1},
+	{38815, 3859, 5, 1},
+	{35165, 3859, 6, 1},
+	{39190, 3859, 5, 1},
+	{25551, 3859, 8, 1},
+	{17172, 3859, 10, 1},
+	{41406, 3859, 4, 1},
+	{25903, 3859, 8, 1},
+	{25927, 3859, 8, 1},
+	{31701, 3859, 7, 1},
+	{21190, 3859, 9, 1},
+	{26103, 3859, 8, 1},
+	{8434, 3859, 7, 1},
+	{36263, 3859, 6, 1},
+	{17612, 3859, 10, 1},
+	{26551, 3859, 8, 1},
+	{21775, 3859, 9, 1},
+	{26943, 3859, 8, 1},
+	{21946, 3859, 9, 1},
+	{32464, 3859, 7, 1},
+	{40250, 3859, 5, 1},
+	{37319, 3859, 6, 1},
+	{27815, 3859, 8, 1},
+	{28167, 3859, 8, 1},
+	{28199, 3859, 8, 1},
+	{28239, 3859, 8, 1},
+	{10226, 3859, 5, 1},
+	{35, 3864, 4, 1},
+	{23711, 3864, 8, 1},
+	{3346, 3864, 4, 1},
+	{32582, 3864, 4, 1},
+	{17907, 3864, 5, 1},
+	{29328, 3864, 7, 1},
+	{19957, 3864, 9, 1},
+	{29692, 3864, 7, 1},
+	{16923, 3864, 5, 1},
+	{24855, 3864, 6, 1},
+	{35231, 3864, 6, 1},
+	{10563, 3864, 4, 1},
+	{35393, 3864, 6, 1},
+	{16468, 3864, 4, 1},
+	{35465, 3864, 6, 1},
+	{35477, 3864, 6, 1},
+	{35489, 3864, 6, 1},
+	{39205, 3864, 5, 1},
+	{31267, 3864, 7, 1},
+	{721, 3864, 3, 1},
+	{21037, 3864, 9, 1},
+	{17098, 3864, 8, 1},
+	{8428, 3864, 4, 1},
+	{8428, 3864, 13, 1},
+	{25887, 3864, 8, 1},
+	{25959, 3864, 8, 1},
+	{35807, 3864, 6, 1},
+	{21559, 3864, 9, 1},
+	{21568, 3864, 9, 1},
+	{39635, 3864, 5, 1},
+	{17552, 3864, 10, 1},
+	{17572, 3864, 10, 1},
+	{10759, 3864, 12, 1},
+	{10765, 3864, 6, 1},
+	{36341, 3864, 6, 1},
+	{36365, 3864, 6, 1},
+	{21712, 3864, 9, 1},
+	{8422, 3864, 6, 1},
+	{10585, 3864, 6, 1},
+	{36545, 3864, 6, 1},
+	{26791, 3864, 8, 1},
+	{26807, 3864, 6, 1},
+	{14062, 3864, 11, 1},
+	{39865, 3864, 5, 1},
+	{4852, 3864, 5, 1},
+	{32562, 3864, 5, 1},
+	{11341, 3864, 6, 1},
+	{5081, 3864, 3, 1},
+	{36821, 3864, 6, 1},
+	{32653, 3864, 7, 1},
+	{26138, 3864, 5, 1},
+	{39960, 3864, 5, 1},
+	{40255, 3864, 5, 1},
+	{37199, 3864, 6, 1},
+	{18122, 3864, 4, 1},
+	{37211, 3864, 6, 1},
+	{22558, 3864, 9, 1},
+	{11335, 3864, 12, 1},
+	{27831, 3864, 8, 1},
+	{22563, 3864, 4, 1},
+	{37541, 3864, 6, 1},
+	{37625, 3864, 6, 1},
+	{28191, 3864, 8, 1},
+	{28231, 3864, 8, 1},
+	{22936, 3864, 9, 1},
+	{33472, 3864, 7, 1},
+	{22981, 3864, 9, 1},
+	{37733, 3864, 6, 1},
+	{8892, 3864, 4, 1},
+	{41894, 3864, 4, 1},
+	{21168, 3864, 4, 1},
+	{28903, 3864, 8, 1},
+	{19312, 3864, 10, 1},
+	{38231, 3864, 6, 1},
+	{34109, 3864, 7, 1},
+	{29671, 3865, 7, 1},
+	{22364, 3865, 5, 1},
+	{11355, 3865, 4, 1},
+	{35297, 3865, 6, 1},
+	{35381, 3865, 6, 1},
+	{10570, 3865, 3, 1},
+	{31358, 3865, 7, 1},
+	{25807, 3865, 8, 1},
+	{17282, 3865, 10, 1},
+	{26407, 3865, 8, 1},
+	{26775, 3865, 8, 1},
+	{39855, 3865, 5, 1},
+	{37935, 3865, 5, 1},
+	{39945, 3865, 5, 1},
+	{37187, 3865, 6, 1},
+	{37247, 3865, 6, 1},
+	{40305, 3865, 5, 1},
+	{22486, 3865, 9, 1},
+	{11347, 3865, 12, 1},
+	{33577, 3865, 7, 1},
+	{2671, 3865, 8, 1},
+	{40720, 3865, 5, 1},
+	{21447, 3866, 4, 2},
+	{36848, 3868, 4, 1},
+	{39040, 3868, 4, 1},
+	{35321, 3868, 6, 1},
+	{6471, 3868, 14, 1},
+	{31260, 3868, 7, 1},
+	{32118, 3868, 5, 1},
+	{10567, 3868, 12, 1},
+	{31533, 3868, 7, 1},
+	{31617, 3868, 7, 1},
+	{21055, 3868, 9, 1},
+	{21091, 3868, 9, 1},
+	{17162, 3868, 5, 1},
+	{17098, 3868, 8, 1},
+	{21118, 3868, 9, 1},
+	{39395, 3868, 5, 1},
+	{26135, 3868, 8, 1},
+	{25673, 3868, 6, 1},
+	{36353, 3868, 6, 1},
+	{21865, 3868, 4, 1},
+	{27039, 3868, 8, 1},
+	{25068, 3868, 3, 1},
+	{7684, 3868, 4, 1},
+	{39990, 3868, 5, 1},
+	{33017, 3868, 7, 1},
+	{40280, 3868, 5, 1},
+	{22531, 3868, 9, 1},
+	{8870, 3868, 13, 1},
+	{37337, 3868, 6, 1},
+	{22112, 3868, 4, 1},
+	{28223, 3868, 8, 1},
+	{18472, 3868, 10, 1},
+	{33507, 3868, 7, 1},
+	{40565, 3868, 5, 1},
+	{7685, 3868, 3, 1},
+	{7647, 3868, 14, 1},
+	{12487, 3868, 12, 1},
+	{34095, 3868, 7, 1},
+	{6478, 3868, 7, 1},
+	{29230, 3869, 7, 0},
+	{35075, 3869, 6, 9},
+	{2406, 3870, 3, 1},
+	{8423, 3870, 5, 1},
+	{39040, 3870, 5, 1},
+	{25455, 3870, 8, 1},
+	{20893, 3870, 9, 1},
+	{35573, 3870, 6, 1},
+	{25679, 3870, 4, 1},
+	{35663, 3870, 6, 1},
+	{13677, 3870, 11, 1},
+	{10771, 3870, 12, 1},
+	{32205, 3870, 7, 1},
+	{39675, 3870, 5, 1},
+	{26687, 3870, 8, 1},
+	{39685, 3870, 5, 1},
+	{17682, 3870, 7, 1},
+	{32429, 3870, 7, 1},
+	{39900, 3870, 5, 1},
+	{5081, 3870, 3, 1},
+	{41734, 3870, 4, 1},
+	{40285, 3870, 5, 1},
+	{37277, 3870, 5, 1},
+	{37277, 3870, 6, 1},
+	{27679, 3870, 8, 1},
+	{33143, 3870, 7, 1},
+	{25745, 3870, 6, 1},
+	{37601, 3870, 6, 1},
+	{37721, 3870, 6, 1},
+	{22999, 3870, 9, 1},
+	{33724, 3870, 7, 1},
+	{37889, 3870, 6, 1},
+	{10777, 3870, 6, 1},
+	{38201, 3870, 6, 1},
+	{40880, 3870, 5, 1},
+	{38291, 3870, 6, 1},
+	{38510, 3874, 5, 1},
+	{24071, 3874, 8, 1},
+	{12808, 3874, 11, 1},
+	{35291, 3874, 6, 1},
+	{29672, 3874, 4, 1},
+	{20614, 3874, 9, 1},
+	{10231, 3874, 4, 1},
+	{25671, 3874, 8, 1},
+	{31736, 3874, 7, 1},
+	{26031, 3874, 4, 1},
+	{26095, 3874, 8, 1},
+	{41458, 3874, 4, 1},
+	{39254, 3874, 4, 1},
+	{40245, 3874, 5, 1},
+	{37637, 3874, 6, 1},
+	{33752, 3874, 7, 1},
+	{5113, 3874, 3, 1},
+	{40755, 3874, 5, 1},
+	{42006, 3874, 4, 1},
+	{34229, 3875, 6, 1},
+	{23791, 3875, 8, 1},
+	{38535, 3875, 5, 1},
+	{20578, 3875, 9, 1},
+	{31087, 3875, 5, 1},
+	{25559, 3875, 8, 1},
+	{31610, 3875, 7, 1},
+	{25823, 3875, 8, 1},
+	{31799, 3875, 7, 1},
+	{21298, 3875, 9, 1},
+	{35540, 3875, 6, 1},
+	{36299, 3875, 6, 1},
+	{8166, 3875, 4, 1},
+	{39795, 3875, 5, 1},
+	{10891, 3875, 12, 1},
+	{32562, 3875, 7, 1},
+	{33080, 3875, 7, 1},
+	{27751, 3875, 8, 1},
+	{37337, 3875, 6, 1},
+	{41774, 3875, 4, 1},
+	{41790, 3875, 4, 1},
+	{22900, 3875, 9, 1},
+	{37649, 3875, 6, 1},
+	{3605, 3875, 7, 1},
+	{41962, 3875, 4, 1},
+	{38207, 3875, 6, 1},
+	{28978, 3876, 5, 1},
+	{30896, 3876, 7, 1},
+	{35105, 3876, 6, 1},
+	{20506, 3876, 9, 1},
+	{31078, 3876, 7, 1},
+	{2662, 3876, 7, 1},
+	{35387, 3876, 6, 1},
+	{39200, 3876, 5, 1},
+	{25423, 3876, 8, 1},
+	{21938, 3876, 8, 1},
+	{35537, 3876, 6, 1},
+	{39285, 3876, 5, 1},
+	{35603, 3876, 6, 1},
+	{5508, 3876, 3, 1},
+	{21181, 3876, 9, 1},
+	{6681, 3876, 14, 1},
+	{26071, 3876, 8, 1},
+	{26087, 3876, 8, 1},
+	{13897, 3876, 11, 1},
+	{36449, 3876, 6, 1},
+	{22335, 3876, 4, 1},
+	{20391, 3876, 4, 1},
+	{6685, 3876, 10, 1},
+	{32317, 3876, 7, 1},
+	{39745, 3876, 5, 1},
+	{21919, 3876, 9, 1},
+	{39880, 3876, 5, 1},
+	{32583, 3876, 7, 1},
+	{31472, 3876, 4, 1},
+	{33199, 3876, 7, 1},
+	{28255, 3876, 8, 1},
+	{37667, 3876, 6, 1},
+	{23008, 3876, 9, 1},
+	{18542, 3876, 10, 1},
+	{37763, 3876, 6, 1},
+	{37937, 3876, 6, 1},
+	{32055, 3876, 5, 1},
+	{40855, 3876, 5, 1},
+	{34123, 3876, 7, 1},
+	{28967, 3876, 8, 1},
+	{28975, 3876, 8, 1},
+	{38297, 3876, 6, 1},
+	{38325, 3879, 5, 1},
+	{6177, 3879, 14, 1},
+	{14476, 3879, 4, 1},
+	{13903, 3879, 5, 1},
+	{20353, 3879, 9, 1},
+	{25055, 3879, 8, 1},
+	{35261, 3879, 6, 1},
+	{10207, 3879, 12, 1},
+	{3628, 3879, 16, 1},
+	{4842, 3879, 15, 1},
+	{25167, 3879, 8, 1},
+	{31232, 3879, 7, 1},
+	{39205, 3879, 5, 1},
+	{15893, 3879, 5, 1},
+	{20866, 3879, 9, 1},
+	{20875, 3879, 9, 1},
+	{17704, 3879, 6, 1},
+	{31512, 3879, 7, 1},
+	{39310, 3879, 5, 1},
+	{21064, 3879, 9, 1},
+	{35687, 3879, 6, 1},
+	{8415, 3879, 13, 1},
+	{21163, 3879, 9, 1},
+	{6681, 3879, 4, 1},
+	{26063, 3879, 8, 1},
+	{21550, 3879, 9, 1},
+	{14364, 3879, 6, 1},
+	{39640, 3879, 5, 1},
+	{36299, 3879, 6, 1},
+	{21748, 3879, 9, 1},
+	{26935, 3879, 8, 1},
+	{10891, 3879, 5, 1},
+	{14485, 3879, 4, 1},
+	{14128, 3879, 11, 1},
+	{14359, 3879, 5, 1},
+	{14133, 3879, 6, 1},
+	{37307, 3879, 6, 1},
+	{37313, 3879, 6, 1},
+	{14458, 3879, 11, 1},
+	{22504, 3879, 9, 1},
+	{40505, 3879, 5, 1},
+	{33437, 3879, 7, 1},
+	{33451, 3879, 6, 1},
+	{37619, 3879, 6, 1},
+	{28183, 3879, 8, 1},
+	{22927, 3879, 9, 1},
+	{11491, 3879, 12, 1},
+	{28463, 3879, 8, 1},
+	{37805, 3879, 6, 1},
+	{9738, 3879, 3, 1},
+	{34325, 3896, 6, 1},
+	{17777, 3896, 5, 1},
+	{24887, 3896, 8, 1},
+	{35087, 3896, 6, 1},
+	{25079, 3896, 8, 1},
+	{8540, 3896, 5, 1},
+	{39215, 3896, 5, 1},
+	{25655, 3896, 8, 1},
+	{31554, 3896, 7, 1},
+	{31568, 3896, 7, 1},
+	{22920, 3896, 7, 1},
+	{25895, 3896, 8, 1},
+	{25911, 3896, 8, 1},
+	{35777, 3896, 6, 1},
+	{31764, 3896, 7, 1},
+	{31841, 3896, 7, 1},
+	{17772, 3896, 10, 1},
+	{6059, 3896, 3, 1},
+	{11341, 3896, 6, 1},
+	{19317, 3896, 5, 1},
+	{18102, 3896, 4, 1},
+	{22630, 3896, 9, 1},
+	{31408, 3896, 4, 1},
+	{11408, 3896, 4, 1},
+	{36457, 3896, 4, 1},
+	{15800, 3896, 11, 1},
+	{25764, 3897, 7, 1},
+	{6186, 3897, 5, 1},
+	{4819, 3897, 8, 1},
+	{24855, 3897, 6, 1},
+	{24855, 3897, 8, 1},
+	{35021, 3897, 6, 1},
+	{39110, 3897, 5, 1},
+	{39115, 3897, 5, 1},
+	{35303, 3897, 6, 1},
+	{25103, 3897, 8, 1},
+	{25111, 3897, 8, 1},
+	{35351, 3897, 6, 1},
+	{4812, 3897, 15, 1},
+	{3596, 3897, 16, 1},
+	{23624, 3897, 5, 1},
+	{721, 3897, 3, 1},
+	{39240, 3897, 5, 1},
+	{25471, 3897, 8, 1},
+	{20992, 3897, 9, 1},
+	{25647, 3897, 8, 1},
+	{25663, 3897, 8, 1},
+	{25735, 3897, 8, 1},
+	{31638, 3897, 7, 1},
+	{4756, 3897, 9, 1},
+	{25767, 3897, 8, 1},
+	{41394, 3897, 4, 1},
+	{25935, 3897, 8, 1},
+	{21226, 3897, 9, 1},
+	{31771, 3897, 7, 1},
+	{35751, 3897, 4, 1},
+	{26047, 3897, 8, 1},
+	{17492, 3897, 10, 1},
+	{36269, 3897, 6, 1},
+	{6535, 3897, 6, 1},
+	{21685, 3897, 9, 1},
+	{3637, 3897, 7, 1},
+	{26623, 3897, 8, 1},
+	{26783, 3897, 8, 1},
+	{26847, 3897, 8, 1},
+	{39800, 3897, 5, 1},
+	{39875, 3897, 5, 1},
+	{4852, 3897, 5, 1},
+	{39890, 3897, 5, 1},
+	{32576, 3897, 7, 1},
+	{10238, 3897, 5, 1},
+	{26138, 3897, 5, 1},
+	{37073, 3897, 6, 1},
+	{32989, 3897, 7, 1},
+	{33010, 3897, 7, 1},
+	{37193, 3897, 6, 1},
+	{40295, 3897, 5, 1},
+	{14133, 3897, 6, 1},
+	{21302, 3897, 5, 1},
+	{27839, 3897, 8, 1},
+	{41794, 3897, 4, 1},
+	{37481, 3897, 6, 1},
+	{40610, 3897, 4, 1},
+	{28391, 3897, 8, 1},
+	{18532, 3897, 10, 1},
+	{11527, 3897, 12, 1},
+	{40735, 3897, 5, 1},
+	{38117, 3897, 6, 1},
+	{38237, 3897, 6, 1},
+	{38279, 3897, 6, 1},
+	{23085, 3897, 4, 1},
+	{40890, 3897, 5, 1},
+	{13351, 3897, 7, 1},
+	{23602, 3897, 9, 1},
+	{34130, 3897, 7, 1},
+	{21447, 3898, 4, 2},
+	{21447, 3901, 4, 2},
+	{37359, 3902, 5, 1},
+	{29401, 3902, 4, 1},
+	{16852, 3902, 10, 1},
+	{35363, 3902, 6, 1},
+	{41434, 3902, 4, 1},
+	{39380, 3902, 5, 1},
+	{39405, 3902, 5, 1},
+	{25991, 3902, 4, 1},
+	{31813, 3902, 7, 1},
+	{32044, 3902, 7, 1},
+	{26615, 3902, 8, 1},
+	{26767, 3902, 8, 1},
+	{21910, 3902, 9, 1},
+	{27071, 3902, 8, 1},
+	{14095, 3902, 11, 1},
+	{11367, 3902, 4, 1},
+	{40180, 3902, 5, 1},
+	{40225, 3902, 5, 1},
+	{22918, 3902, 9, 1},
+	{22927, 3902, 9, 1},
+	{28447, 3902, 8, 1},
+	{28471, 3902, 8, 1},
+	{21812, 3902, 4, 1},
+	{37626, 3903, 5, 1},
+	{969, 3903, 3, 1},
+	{39045, 3903, 5, 1},
+	{35243, 3903, 6, 1},
+	{10195, 3903, 12, 1},
+	{6529, 3903, 6, 1},
+	{31692, 3903, 6, 1},
+	{10202, 3903, 5, 1},
+	{25575, 3903, 8, 1},
+	{36149, 3903, 6, 1},
+	{36161, 3903, 6, 1},
+	{6535, 3903, 6, 1},
+	{10927, 3903, 12, 1},
+	{41638, 3903, 4, 1},
+	{17812, 3903, 10, 1},
+	{27127, 3903, 8, 1},
+	{33185, 3903, 7, 1},
+	{37655, 3903, 6, 1},
+	{33773, 3903, 7, 1},
+	{40715, 3903, 5, 1},
+	{38213, 3903, 6, 1},
+	{38249, 3903, 6, 1},
+	{34116, 3903, 7, 1},
+	{22878, 3904, 4, 1},
+	{26516, 3904, 5, 1},
+	{4752, 3904, 4, 1},
+	{30791, 3904, 7, 1},
+	{4752, 3904, 8, 1},
+	{16702, 3904, 10, 1},
+	{30819, 3904, 7, 1},
+	{30987, 3904, 7, 1},
+	{31085, 3904, 7, 1},
+	{20542, 3904, 9, 1},
+	{10195, 3904, 10, 1},
+	{8891, 3904, 3, 1},
+	{39275, 3904, 5, 1},
+	{7701, 3904, 3, 1},
+	{20902, 3904, 9, 1},
+	{25567, 3904, 8, 1},
+	{31540, 3904, 7, 1},
+	{21109, 3904, 9, 1},
+	{35717, 3904, 6, 1},
+	{25839, 3904, 8, 1},
+	{39400, 3904, 5, 1},
+	{17402, 3904, 10, 1},
+	{21586, 3904, 9, 1},
+	{21667, 3904, 9, 1},
+	{32191, 3904, 7, 1},
+	{21757, 3904, 9, 1},
+	{26983, 3904, 8, 1},
+	{36731, 3904, 6, 1},
+	{27135, 3904, 8, 1},
+	{33178, 3904, 7, 1},
+	{14627, 3904, 7, 1},
+	{22513, 3904, 7, 1},
+	{27847, 3904, 8, 1},
+	{37535, 3904, 6, 1},
+	{40870, 3904, 5, 1},
+	{13351, 3904, 7, 1},
+	{8210, 3912, 8, 1},
+	{33617, 3912, 4, 1},
+	{41298, 3912, 4, 1},
+	{31253, 3912, 7, 1},
+	{31428, 3912, 7, 1},
+	{17092, 3912, 10, 1},
+	{35651, 3912, 6, 1},
+	{17132, 3912, 10, 1},
+	{31806, 3912, 7, 1},
+	{32114, 3912, 7, 1},
+	{41538, 3912, 4, 1},
+	{22543, 3912, 4, 1},
+	{36443, 3912, 6, 1},
+	{10855, 3912, 4, 1},
+	{10855, 3912, 12, 1},
+	{39805, 3912, 5, 1},
+	{21928, 3912, 9, 1},
+	{41598, 3912, 4, 1},
+	{25994, 3912, 5, 1},
+	{27119, 3912, 8, 1},
+	{17107, 3912, 5, 1},
+	{18122, 3912, 6, 1},
+	{20880, 3912, 4, 1},
+	{18292, 3912, 10, 1},
+	{37343, 3912, 6, 1},
+	{18432, 3912, 10, 1},
+	{33570, 3912, 7, 1},
+	{13978, 3912, 5, 1},
+	{40695, 3912, 5, 1},
+	{18622, 3912, 10, 1},
+	{40865, 3912, 5, 1},
+	{15892, 3913, 6, 1},
+	{3346, 3913, 4, 1},
+	{19346, 3913, 6, 1},
+	{39255, 3913, 5, 1},
+	{35615, 3913, 6, 1},
+	{10627, 3913, 12, 1},
+	{17502, 3913, 10, 1},
+	{13829, 3913, 4, 1},
+	{5082, 3913, 6, 1},
+	{3637, 3913, 7, 1},
+	{41558, 3913, 4, 1},
+	{26791, 3913, 8, 1},
+	{36593, 3913, 6, 1},
+	{22333, 3913, 9, 1},
+	{22648, 3913, 9, 1},
+	{23017, 3913, 9, 1},
+	{38099, 3913, 6, 1},
+	{34181, 3914, 6, 1},
+	{29132, 3914, 7, 1},
+	{22501, 3914, 8, 1},
+	{19543, 3914, 9, 1},
+	{25764, 3914, 7, 1},
+	{34541, 3914, 6, 1},
+	{29713, 3914, 7, 1},
+	{38640, 3914, 5, 1},
+	{14476, 3914, 4, 1},
+	{30098, 3914, 7, 1},
+	{38945, 3914, 5, 1},
+	{38960, 3914, 5, 1},
+	{31071, 3914, 7, 1},
+	{25063, 3914, 8, 1},
+	{35249, 3914, 6, 1},
+	{8233, 3914, 13, 1},
+	{4827, 3914, 15, 1},
+	{8259, 3914, 13, 1},
+	{6481, 3914, 4, 1},
+	{32476, 3914, 6, 1},
+	{25159, 3914, 8, 1},
+	{39225, 3914, 5, 1},
+	{25447, 3914, 8, 1},
+	{17142, 3914, 10, 1},
+	{6681, 3914, 4, 1},
+	{35783, 3914, 6, 1},
+	{31722, 3914, 7, 1},
+	{31729, 3914, 7, 1},
+	{21199, 3914, 9, 1},
+	{39375, 3914, 5, 1},
+	{25991, 3914, 4, 1},
+	{17262, 3914, 10, 1},
+	{21280, 3914, 9, 1},
+	{32037, 3914, 7, 1},
+	{36185, 3914, 6, 1},
+	{14364, 3914, 6, 1},
+	{36323, 3914, 6, 1},
+	{36371, 3914, 6, 1},
+	{5112, 3914, 15, 1},
+	{21784, 3914, 9, 1},
+	{26807, 3914, 6, 1},
+	{36623, 3914, 6, 1},
+	{22009, 3914, 9, 1},
+	{32590, 3914, 7, 1},
+	{4769, 3914, 3, 1},
+	{3590, 3914, 6, 1},
+	{3442, 3914, 3, 1},
+	{27743, 3914, 8, 1},
+	{33150, 3914, 7, 1},
+	{22567, 3914, 9, 1},
+	{27799, 3914, 8, 1},
+	{28039, 3914, 8, 1},
+	{37505, 3914, 6, 1},
+	{22882, 3914, 9, 1},
+	{40535, 3914, 5, 1},
+	{14579, 3914, 4, 1},
+	{33619, 3914, 7, 1},
+	{21714, 3916, 5, 1},
+	{6481, 3916, 4, 1},
+	{25759, 3916, 8, 1},
+	{4765, 3916, 4, 1},
+	{31757, 3916, 7, 1},
+	{36305, 3916, 6, 1},
+	{39735, 3916, 5, 1},
+	{26943, 3916, 8, 1},
+	{14359, 3916, 11, 1},
+	{33626, 3916, 7, 1},
+	{21044, 3916, 6, 1},
+	{36361, 3916, 4, 1},
+	{38285, 3916, 6, 1},
+	{17907, 3917, 5, 1},
+	{38945, 3917, 5, 1},
+	{20371, 3917, 9, 1},
+	{20389, 3917, 9, 1},
+	{14628, 3917, 4, 1},
+	{14629, 3917, 5, 1},
+	{5083, 3917, 5, 1},
+	{35585, 3917, 6, 1},
+	{25639, 3917, 8, 1},
+	{35885, 3917, 6, 1},
+	{13963, 3917, 11, 1},
+	{17722, 3917, 10, 1},
+	{39750, 3917, 5, 1},
+	{36737, 3917, 6, 1},
+	{39985, 3917, 5, 1},
+	{40530, 3917, 5, 1},
+	{33458, 3917, 7, 1},
+	{28335, 3917, 8, 1},
+	{22981, 3917, 4, 1},
+	{37769, 3917, 6, 1},
+	{25113, 3917, 6, 1},
+	{33787, 3917, 7, 1},
+	{41902, 3917, 4, 1},
+	{38219, 3917, 6, 1},
+	{19597, 3925, 5, 1},
+	{19597, 3925, 9, 1},
+	{41258, 3925, 4, 1},
+	{20560, 3925, 9, 1},
+	{35351, 3925, 6, 1},
+	{25175, 3925, 8, 1},
+	{5083, 3925, 5, 1},
+	{39265, 3925, 5, 1},
+	{35615, 3925, 6, 1},
+	{21010, 3925, 9, 1},
+	{21091, 3925, 9, 1},
+	{35753, 3925, 6, 1},
+	{25855, 3925, 8, 1},
+	{8875, 3925, 8, 1},
+	{19310, 3925, 4, 1},
+	{25999, 3925, 4, 1},
+	{25999, 3925, 8, 1},
+	{26023, 3925, 8, 1},
+	{21307, 3925, 9, 1},
+	{36239, 3925, 6, 1},
+	{6535, 3925, 6, 1},
+	{8610, 3925, 13, 1},
+	{37331, 3925, 6, 1},
+	{22594, 3925, 9, 1},
+	{40520, 3925, 5, 1},
+	{21346, 3925, 6, 1},
+	{28751, 3925, 8, 1},
+	{40900, 3925, 5, 1},
+	{31842, 3925, 4, 1},
+	{17907, 3976, 5, 1},
+	{24911, 3976, 8, 1},
+	{20605, 3976, 9, 1},
+	{20356, 3976, 4, 1},
+	{35609, 3976, 6, 1},
+	{17102, 3976, 10, 1},
+	{25711, 3976, 8, 1},
+	{21118, 3976, 9, 1},
+	{17432, 3976, 10, 1},
+	{25649, 3976, 6, 1},
+	{4834, 3976, 8, 1},
+	{39710, 3976, 5, 1},
+	{26831, 3976, 8, 1},
+	{39755, 3976, 5, 1},
+	{21937, 3976, 9, 1},
+	{22000, 3976, 9, 1},
+	{11112, 3976, 2, 1},
+	{13914, 3976, 5, 1},
+	{36761, 3976, 6, 1},
+	{32548, 3976, 7, 1},
+	{40235, 3976, 5, 1},
+	{37205, 3976, 6, 1},
+	{27551, 3976, 8, 1},
+	{37337, 3976, 6, 1},
+	{22612, 3976, 9, 1},
+	{37355, 3976, 6, 1},
+	{28175, 3976, 8, 1},
+	{40555, 3976, 5, 1},
+	{37817, 3976, 6, 1},
+	{28543, 3976, 8, 1},
+	{28903, 3976, 8, 1},
+	{28927, 3976, 8, 1},
+	{28983, 3976, 8, 1},
+	{38291, 3976, 4, 1},
+	{4436, 3977, 3, 1},
+	{28155, 3977, 4, 1},
+	{5961, 3977, 6, 1},
+	{38641, 3977, 4, 1},
+	{31435, 3977, 7, 1},
+	{21262, 3977, 9, 1},
+	{39645, 3977, 5, 1},
+	{26783, 3977, 6, 1},
+	{3590, 3977, 6, 1},
+	{14480, 3977, 11, 1},
+	{37367, 3977, 6, 1},
+	{37583, 3977, 6, 1},
+	{28407, 3977, 8, 1},
+	{37811, 3977, 6, 1},
+	{10701, 3977, 3, 1},
+	{42468, 3977, 3, 1},
+	{14476, 3978, 4, 1},
+	{38765, 3978, 5, 1},
+	{30784, 3978, 7, 1},
+	{4752, 3978, 8, 1},
+	{4752, 3978, 15, 1},
+	{13347, 3978, 11, 1},
+	{25119, 3978, 8, 1},
+	{35399, 3978, 6, 1},
+	{6527, 3978, 14, 1},
+	{13451, 3978, 3, 1},
+	{41430, 3978, 4, 1},
+	{39410, 3978, 5, 1},
+	{35837, 3978, 6, 1},
+	{13875, 3978, 11, 1},
+	{36293, 3978, 6, 1},
+	{21847, 3978, 9, 1},
+	{39735, 3978, 5, 1},
+	{26871, 3978, 8, 1},
+	{26975, 3978, 8, 1},
+	{10903, 3978, 12, 1},
+	{6479, 3978, 6, 1},
+	{36869, 3978, 6, 1},
+	{40365, 3978, 5, 1},
+	{28143, 3978, 8, 1},
+	{11527, 3978, 5, 1},
+	{28599, 3978, 8, 1},
+	{19302, 3978, 10, 1},
+	{23548, 3978, 9, 1},
+	{21447, 3979, 4, 2},
+	{23967, 3982, 8, 9},
+	{40725, 4083, 5, 9},
+	{4572, 4097, 3, 9},
+	{7773, 4097, 5, 9},
+	{21469, 4188, 9, 9},
+	{126, 4221, 4, 9},
+	{23967, 4273, 8, 9},
+	{34985, 4895, 6, 9},
+	{34985, 4896, 6, 9},
+	{7931, 4916, 4, 0},
+	{144, 4918, 1, 9},
+	{33, 4918, 1, 9},
+	{19903, 4918, 9, 9},
+	{24551, 4918, 8, 9},
+	{30077, 4918, 7, 9},
+	{18752, 4918, 10, 9},
+	{33976, 4918, 7, 9},
+	{6, 4934, 1, 9},
+	{22, 4936, 1, 9},
+	{30392, 4942, 7, 9},
+	{28807, 4942, 8, 9},
+	{25511, 4966, 8, 9},
+	{25519, 4966, 8, 9},
+	{25527, 4966, 8, 9},
+	{30399, 4969, 7, 9},
+	{36909, 4969, 3, 9},
+	{7931, 4969, 4, 0},
+	{19900, 4969, 3, 0},
+	{36909, 4970, 3, 9},
+	{33965, 5003, 4, 0},
+	{4872, 5021, 7, 20},
+	{33962, 5021, 7, 20},
+	{25487, 5030, 8, 9},
+	{10951, 5030, 12, 9},
+	{593, 5031, 1, 9},
+	{790, 5046, 3, 9},
+	{767, 5046, 4, 9},
+	{16062, 5051, 4, 9},
+	{2094, 5053, 5, 9},
+	{25487, 5055, 8, 9},
+	{25487, 5060, 8, 0},
+	{33367, 5062, 7, 9},
+	{123, 5062, 7, 9},
+	{23967, 5081, 8, 9},
+	{3101, 5120, 2, 1},
+	{3101, 5125, 2, 1},
+	{1810, 5126, 3, 1},
+	{3101, 5193, 2, 1},
+	{1810, 5195, 3, 1},
+	{3101, 5245, 2, 1},
+	{10, 5305, 2, 1},
+	{35448, 5305, 5, 1},
+	{12463, 5305, 12, 1},
+	{3101, 5313, 2, 1},
+	{3101, 5314, 2, 1},
+	{10, 5323, 2, 1},
+	{3101, 5337, 2, 1},
+	{39125, 5429, 5, 1},
+	{18132, 5429, 5, 1},
+	{3101, 5434, 2, 1},
+	{3101, 5456, 2, 1},
+	{887, 5462, 2, 1},
+	{39125, 5462, 5, 1},
+	{23332, 5462, 9, 1},
+	{11971, 5462, 12, 1},
+	{3101, 5468, 2, 1},
+	{3101, 5470, 2, 1},
+	{3101, 5472, 2, 1},
+	{3101, 5482, 2, 1},
+	{35448, 5485, 5, 1},
+	{3101, 5515, 2, 1},
+	{3101, 5542, 2, 1},
+	{3101, 5583, 2, 1},
+	{3101, 5606, 2, 1},
+	{887, 5612, 2, 1},
+	{23332, 5612, 9, 1},
+	{3101, 5618, 2, 1},
+	{3101, 5623, 2, 1},
+	{3101, 5644, 2, 1},
+	{18132, 5664, 5, 1},
+	{3101, 5670, 2, 1},
+	{18132, 5767, 5, 1},
+	{11971, 5767, 12, 1},
+	{12463, 5822, 12, 1},
+	{23967, 5859, 8, 9},
+	{980, 5884, 7, 9},
+	{15, 5893, 4, 9},
+	{4, 5901, 1, 9},
+	{2111, 5901, 3, 9},
+	{973, 5902, 6, 0},
+	{810, 5918, 2, 9},
+	{4857, 5918, 4, 9},
+	{106, 5922, 2, 9},
+	{788, 5922, 4, 9},
+	{89, 5922, 2, 9},
+	{866, 5922, 2, 9},
+	{328, 5922, 2, 9},
+	{3100, 5922, 2, 9},
+	{25, 5922, 2, 9},
+	{563, 5922, 2, 9},
+	{36, 5922, 2, 9},
+	{6219, 5922, 2, 9},
+	{10029, 5922, 2, 9},
+	{15089, 5922, 2, 9},
+	{48, 5922, 2, 9},
+	{10650, 5922, 2, 9},
+	{9778, 5922, 3, 9},
+	{2100, 5922, 2, 9},
+	{27, 5922, 2, 9},
+	{720, 5922, 2, 9},
+	{61, 5922, 2, 9},
+	{2757, 5922, 2, 9},
+	{6192, 5922, 2, 9},
+	{1300, 5922, 2, 9},
+	{43, 5922, 2, 9},
+	{1036, 5922, 2, 9},
+	{204, 5922, 2, 9},
+	{2022, 5922, 3, 9},
+	{52, 5922, 2, 9},
+	{127, 5922, 2, 9},
+	{6664, 5922, 2, 9},
+	{1749, 5922, 2, 9},
+	{232, 5922, 2, 9},
+	{1732, 5922, 2, 9},
+	{2301, 5922, 2, 9},
+	{1647, 5922, 2, 9},
+	{102, 5922, 2, 9},
+	{12143, 5922, 2, 9},
+	{1271, 5922, 2, 9},
+	{2549, 5922, 2, 9},
+	{2944, 5922, 3, 9},
+	{334, 5922, 2, 9},
+	{5838, 5922, 2, 9},
+	{134, 5922, 2, 9},
+	{738, 5922, 2, 9},
+	{40010, 5922, 5, 9},
+	{2832, 5922, 2, 9},
+	{1961, 5922, 2, 9},
+	{42330, 5922, 3, 9},
+	{99, 5922, 2, 9},
+	{39, 5922, 2, 9},
+	{94, 5922, 2, 9},
+	{126, 5922, 2, 9},
+	{869, 5922, 2, 9},
+	{199, 5922, 2, 9},
+	{6692, 5922, 2, 9},
+	{767, 5922, 2, 9},
+	{2555, 5926, 5, 9},
+	{10, 5926, 2, 0},
+	{14513, 5926, 3, 0},
+	{120, 5991, 2, 9},
+	{131, 6097, 2, 1},
+	{41278, 6097, 4, 1},
+	{24, 6097, 2, 1},
+	{52, 6097, 2, 1},
+	{39360, 6097, 5, 1},
+	{25967, 6097, 8, 1},
+	{39420, 6097, 5, 1},
+	{5426, 6097, 3, 1},
+	{39435, 6097, 5, 1},
+	{42261, 6097, 3, 1},
+	{38146, 6097, 2, 1},
+	{41642, 6097, 4, 1},
+	{3786, 6097, 3, 1},
+	{778, 6097, 2, 1},
+	{41674, 6097, 4, 1},
+	{42306, 6097, 3, 1},
+	{67, 6097, 2, 1},
+	{1405, 6097, 3, 1},
+	{11321, 6097, 4, 1},
+	{40068, 6097, 3, 1},
+	{41730, 6097, 4, 1},
+	{506, 6097, 2, 1},
+	{24494, 6097, 3, 1},
+	{869, 6097, 3, 1},
+	{159, 6097, 2, 1},
+	{1825, 6097, 2, 1},
+	{22756, 6097, 9, 1},
+	{11531, 6097, 2, 1},
+	{36320, 6097, 4, 1},
+	{1125, 6097, 2, 1},
+	{13691, 6097, 4, 1},
+	{41910, 6097, 4, 1},
+	{33396, 6097, 4, 1},
+	{767, 6097, 2, 1},
+	{7703, 6097, 2, 1},
+	{22349, 6097, 3, 1},
+	{22041, 6097, 3, 1},
+	{41974, 6097, 4, 1},
+	{41978, 6097, 4, 1},
+	{41982, 6097, 4, 1},
+	{41986, 6097, 4, 1},
+	{42441, 6097, 3, 1},
+	{19478, 6097, 3, 1},
+	{41990, 6097, 4, 1},
+	{41994, 6097, 4, 1},
+	{38165, 6097, 6, 1},
+	{30218, 6097, 2, 1},
+	{41324, 6270, 3, 9},
+	{6369, 6344, 4, 9},
+	{965, 6359, 2, 9},
+	{6391, 6371, 3, 9},
+	{4872, 6377, 7, 20},
+	{31862, 6377, 7, 20},
+	{27991, 6377, 8, 20},
+	{6391, 6377, 3, 20},
+	{25487, 6387, 8, 9},
+	{27735, 6429, 7, 9},
+	{237, 6472, 2, 9},
+	{1800, 6502, 2, 9},
+	{49, 6502, 3, 9},
+	{766, 6502, 2, 9},
+	{767, 6502, 2, 9},
+	{2806, 6709, 6, 9},
+	{23967, 6719, 8, 9},
+	{810, 6729, 3, 1},
+	{26743, 6761, 8, 9},
+	{38335, 6880, 5, 9},
+	{12676, 6880, 5, 9},
+	{12687, 6880, 11, 9},
+	{23967, 6880, 8, 9},
+	{24095, 6880, 8, 0},
+	{17312, 6880, 10, 0},
+	{10819, 6880, 12, 9},
+	{32422, 6880, 7, 9},
+	{39820, 6880, 5, 9},
+	{22252, 6880, 9, 0},
+	{9117, 6880, 13, 9},
+	{6634, 6883, 3, 9},
+	{24119, 6883, 8, 9},
+	{16902, 6883, 10, 9},
+	{27735, 6883, 7, 9},
+	{4332, 6894, 15, 9},
+	{41250, 6894, 4, 9},
+	{20075, 6894, 3, 9},
+	{41502, 6894, 4, 9},
+	{14293, 6894, 11, 9},
+	{9104, 6894, 13, 9},
+	{456, 6901, 2, 1},
+	{42237, 6901, 3, 1},
+	{3713, 6901, 3, 1},
+	{456, 6902, 2, 1},
+	{42237, 6902, 3, 1},
+	{3713, 6902, 3, 1},
+	{456, 6903, 2, 1},
+	{42237, 6903, 3, 1},
+	{3713, 6903, 3, 1},
+	{456, 6904, 2, 1},
+	{42237, 6904, 3, 1},
+	{3713, 6904, 3, 1},
+	{456, 6905, 2, 1},
+	{42237, 6905, 3, 1},
+	{3713, 6905, 3, 1},
+	{456, 6906, 2, 1},
+	{42237, 6906, 3, 1},
+	{3713, 6906, 3, 1},
+	{456, 6908, 2, 1},
+	{42237, 6908, 3, 1},
+	{3713, 6908, 3, 1},
+	{456, 6909, 2, 1},
+	{42237, 6909, 3, 1},
+	{3713, 6909, 3, 1},
+	{456, 6910, 2, 1},
+	{42237, 6910, 3, 1},
+	{3713, 6910, 3, 1},
+	{456, 6911, 2, 1},
+	{42237, 6911, 3, 1},
+	{3713, 6911, 3, 9},
+	{42303, 6914, 3, 9},
+	{456, 6916, 2, 1},
+	{42237, 6916, 3, 1},
+	{3713, 6916, 3, 1},
+	{456, 6918, 2, 1},
+	{42237, 6918, 3, 1},
+	{3713, 6918, 3, 1},
+	{456, 6921, 2, 1},
+	{42237, 6921, 3, 1},
+	{3713, 6921, 3, 1},
+	{456, 6922, 2, 1},
+	{3713, 6922, 3, 1},
+	{456, 6923, 2, 1},
+	{42237, 6923, 3, 1},
+	{3713, 6923, 3, 1},
+	{456, 6924, 2, 1},
+	{42237, 6924, 3, 1},
+	{3713, 6924, 3, 1},
+	{456, 6925, 2, 1},
+	{42237, 6925, 3, 1},
+	{3713, 6925, 3, 1},
+	{456, 6926, 2, 1},
+	{42237, 6926, 3, 1},
+	{3713, 6926, 3, 1},
+	{456, 6930, 2, 1},
+	{42237, 6930, 3, 1},
+	{3713, 6930, 3, 1},
+	{456, 6931, 2, 1},
+	{42237, 6931, 3, 1},
+	{3713, 6931, 3, 1},
+	{456, 6932, 2, 1},
+	{42237, 6932, 3, 1},
+	{3713, 6932, 3, 1},
+	{456, 6934, 2, 1},
+	{42237, 6934, 3, 1},
+	{3713, 6934, 3, 1},
+	{456, 6935, 2, 1},
+	{42237, 6935, 3, 1},
+	{3713, 6935, 3, 1},
+	{456, 6936, 2, 1},
+	{42237, 6936, 3, 1},
+	{3713, 6936, 3, 1},
+	{19525, 6937, 9, 1},
+	{456, 6937, 2, 1},
+	{42096, 6937, 3, 1},
+	{14512, 6937, 3, 1},
+	{38805, 6937, 5, 1},
+	{324, 6937, 3, 1},
+	{42237, 6937, 3, 1},
+	{3713, 6937, 3, 1},
+	{1121, 6937, 3, 1},
+	{9756, 6937, 3, 1},
+	{23233, 6937, 9, 1},
+	{456, 6939, 2, 1},
+	{42237, 6939, 3, 1},
+	{3713, 6939, 3, 1},
+	{456, 6940, 2, 1},
+	{42237, 6940, 3, 1},
+	{3713, 6940, 3, 1},
+	{456, 6941, 2, 1},
+	{42237, 6941, 3, 1},
+	{3713, 6941, 3, 1},
+	{456, 6942, 2, 1},
+	{42237, 6942, 3, 1},
+	{3713, 6942, 3, 1},
+	{456, 6943, 2, 1},
+	{42237, 6943, 3, 1},
+	{3713, 6943, 3, 1},
+	{456, 6944, 2, 1},
+	{3713, 6944, 3, 1},
+	{456, 6945, 2, 1},
+	{42237, 6945, 3, 1},
+	{3713, 6945, 3, 1},
+	{456, 6946, 2, 1},
+	{42237, 6946, 3, 1},
+	{3713, 6946, 3, 1},
+	{456, 6947, 2, 1},
+	{42237, 6947, 3, 1},
+	{3713, 6947, 3, 1},
+	{456, 6948, 2, 1},
+	{42237, 6948, 3, 1},
+	{3713, 6948, 3, 1},
+	{456, 6951, 2, 1},
+	{42237, 6951, 3, 1},
+	{3713, 6951, 3, 1},
+	{456, 6952, 2, 1},
+	{42237, 6952, 3, 1},
+	{3713, 6952, 3, 1},
+	{456, 6953, 2, 1},
+	{42237, 6953, 3, 1},
+	{3713, 6953, 3, 1},
+	{456, 6954, 2, 1},
+	{42237, 6954, 3, 1},
+	{3713, 6954, 3, 1},
+	{456, 6955, 2, 1},
+	{42237, 6955, 3, 1},
+	{3713, 6955, 3, 1},
+	{456, 6956, 2, 1},
+	{42237, 6956, 3, 1},
+	{3713, 6956, 3, 1},
+	{456, 6959, 2, 1},
+	{42237, 6959, 3, 1},
+	{3713, 6959, 3, 1},
+	{456, 6960, 2, 1},
+	{3713, 6960, 3, 1},
+	{456, 6961, 2, 1},
+	{42237, 6961, 3, 1},
+	{3713, 6961, 3, 1},
+	{456, 6962, 2, 1},
+	{3713, 6962, 3, 1},
+	{456, 6964, 2, 1},
+	{42237, 6964, 3, 1},
+	{3713, 6964, 3, 1},
+	{456, 6965, 2, 1},
+	{42237, 6965, 3, 1},
+	{3713, 6965, 3, 1},
+	{456, 6966, 2, 1},
+	{42237, 6966, 3, 1},
+	{3713, 6966, 3, 1},
+	{456, 6967, 2, 1},
+	{42237, 6967, 3, 1},
+	{3713, 6967, 3, 1},
+	{456, 6968, 2, 1},
+	{42237, 6968, 3, 1},
+	{3713, 6968, 3, 1},
+	{456, 6969, 2, 1},
+	{42237, 6969, 3, 1},
+	{3713, 6969, 3, 1},
+	{456, 6970, 2, 1},
+	{42237, 6970, 3, 1},
+	{3713, 6970, 3, 1},
+	{456, 6971, 2, 1},
+	{42237, 6971, 3, 1},
+	{3713, 6971, 3, 1},
+	{456, 6972, 2, 1},
+	{456, 6973, 2, 1},
+	{42237, 6973, 3, 1},
+	{3713, 6973, 3, 1},
+	{23967, 6974, 8, 9},
+	{48, 6988, 1, 9},
+	{23967, 7099, 8, 9},
+	{10593, 7145, 3, 9},
+	{33094, 7149, 7, 1},
+	{18172, 7165, 5, 0},
+	{40978, 7224, 4, 9},
+	{3497, 7229, 3, 0},
+	{24799, 7238, 8, 9},
+	{24807, 7238, 8, 9},
+	{27007, 7238, 8, 9},
+	{42144, 7239, 3, 9},
+	{42240, 7239, 3, 9},
+	{120, 7239, 2, 9},
+	{120, 7239, 10, 9},
+	{42438, 7239, 3, 9},
+	{220, 7240, 4, 9},
+	{4969, 7240, 3, 9},
+	{42240, 7242, 3, 9},
+	{120, 7242, 2, 9},
+	{120, 7242, 10, 9},
+	{42438, 7242, 3, 9},
+	{42240, 7243, 3, 9},
+	{120, 7243, 2, 9},
+	{120, 7243, 10, 9},
+	{16322, 7248, 10, 0},
+	{4542, 7248, 7, 20},
+	{124, 7248, 2, 0},
+	{21614, 7248, 3, 20},
+	{34661, 7254, 6, 0},
+	{34661, 7255, 6, 0},
+	{34661, 7256, 6, 0},
+	{20101, 7256, 9, 0},
+	{34661, 7257, 6, 0},
+	{20101, 7257, 9, 0},
+	{120, 7257, 2, 9},
+	{120, 7257, 10, 9},
+	{34661, 7258, 6, 0},
+	{34661, 7259, 6, 0},
+	{20101, 7259, 9, 0},
+	{120, 7259, 2, 9},
+	{120, 7259, 10, 9},
+	{34661, 7260, 6, 0},
+	{20101, 7260, 9, 0},
+	{34661, 7261, 6, 0},
+	{20101, 7261, 9, 0},
+	{34661, 7262, 6, 0},
+	{20101, 7262, 9, 0},
+	{120, 7262, 2, 9},
+	{120, 7262, 10, 9},
+	{34661, 7266, 6, 0},
+	{20101, 7266, 9, 0},
+	{120, 7266, 2, 9},
+	{120, 7266, 10, 9},
+	{34661, 7267, 6, 0},
+	{34661, 7268, 6, 0},
+	{34661, 7269, 6, 0},
+	{20101, 7269, 9, 0},
+	{34661, 7270, 6, 0},
+	{20101, 7270, 9, 0},
+	{120, 7270, 2, 9},
+	{120, 7270, 10, 9},
+	{34661, 7271, 6, 0},
+	{20101, 7271, 9, 0},
+	{120, 7271, 2, 9},
+	{120, 7271, 10, 9},
+	{34661, 7272, 6, 0},
+	{34661, 7299, 6, 0},
+	{20101, 7299, 9, 0},
+	{34661, 7300, 6, 0},
+	{20101, 7300, 9, 0},
+	{34661, 7301, 6, 0},
+	{20101, 7301, 9, 0},
+	{120, 7301, 2, 9},
+	{120, 7301, 10, 9},
+	{34661, 7302, 6, 0},
+	{34661, 7303, 6, 0},
+	{593, 7381, 1, 9},
+	{42141, 7384, 3, 9},
+	{42420, 7384, 3, 9},
+	{2094, 7389, 5, 9},
+	{9979, 7424, 4, 9},
+	{32926, 7424, 7, 9},
+	{9979, 7425, 4, 9},
+	{32926, 7425, 7, 9},
+	{9979, 7426, 4, 9},
+	{9979, 7427, 4, 9},
+	{32926, 7427, 7, 9},
+	{25487, 7431, 8, 0},
+	{767, 8512, 4, 9},
+	{7950, 9123, 3, 9},
+	{26, 9140, 1, 9},
+	{990, 9140, 6, 9},
+	{26, 9141, 1, 9},
+	{125, 9141, 1, 9},
+	{990, 9141, 6, 9},
+	{41226, 9143, 4, 9},
+	{39535, 9143, 5, 9},
+	{39540, 9143, 5, 9},
+	{41610, 9143, 4, 9},
+	{41614, 9143, 4, 9},
+	{41766, 9143, 4, 9},
+	{7752, 9154, 3, 9},
+	{42276, 9154, 3, 9},
+	{2684, 9154, 3, 9},
+	{19900, 9203, 3, 9},
+	{1403, 9262, 3, 9},
+	{10, 9263, 2, 0},
+	{2926, 9335, 2, 9},
+	{17531, 9335, 2, 9},
+	{593, 9336, 1, 9},
+	{9979, 9340, 4, 9},
+	{40152, 9416, 4, 1},
+	{36911, 9416, 6, 1},
+	{42324, 9416, 3, 1},
+	{40745, 9525, 5, 9},
+	{14947, 9527, 3, 9},
+	{6210, 9531, 9, 9},
+	{39825, 9532, 5, 9},
+	{39825, 9538, 5, 9},
+	{39825, 9542, 5, 9},
+	{120, 9545, 2, 9},
+	{16322, 9547, 10, 9},
+	{6219, 9547, 14, 9},
+	{42426, 9549, 3, 9},
+	{7017, 9549, 14, 9},
+	{42426, 9550, 3, 9},
+	{7017, 9550, 14, 9},
+	{42426, 9551, 3, 9},
+	{7017, 9551, 14, 9},
+	{120, 9552, 2, 9},
+	{42426, 9553, 3, 9},
+	{7017, 9553, 14, 9},
+	{120, 9554, 2, 9},
+	{42426, 9557, 3, 9},
+	{7017, 9557, 14, 9},
+	{42426, 9558, 3, 9},
+	{7017, 9558, 14, 9},
+	{120, 9559, 2, 9},
+	{42426, 9562, 3, 9},
+	{7017, 9562, 14, 9},
+	{120, 9563, 2, 9},
+	{42426, 9564, 3, 9},
+	{7017, 9564, 14, 9},
+	{120, 9565, 2, 9},
+	{42426, 9566, 3, 9},
+	{7017, 9566, 14, 9},
+	{120, 9567, 2, 9},
+	{42426, 9570, 3, 9},
+	{7017, 9570, 14, 9},
+	{120, 9571, 2, 9},
+	{42426, 9574, 3, 9},
+	{7017, 9574, 14, 9},
+	{42426, 9575, 3, 9},
+	{7017, 9575, 14, 9},
+	{42426, 9576, 3, 9},
+	{7017, 9576, 14, 9},
+	{120, 9577, 2, 9},
+	{42426, 9578, 3, 9},
+	{7017, 9578, 14, 9},
+	{120, 9579, 2, 9},
+	{42426, 9582, 3, 9},
+	{7017, 9582, 14, 9},
+	{120, 9583, 2, 9},
+	{42426, 9586, 3, 9},
+	{7017, 9586, 14, 9},
+	{42426, 9587, 3, 9},
+	{7017, 9587, 14, 9},
+	{120, 9588, 2, 9},
+	{42426, 9589, 3, 9},
+	{7017, 9589, 14, 9},
+	{120, 9590, 2, 9},
+	{42426, 9591, 3, 9},
+	{7017, 9591, 14, 9},
+	{120, 9592, 2, 9},
+	{42426, 9595, 3, 9},
+	{7017, 9595, 14, 9},
+	{42426, 9596, 3, 9},
+	{7017, 9596, 14, 9},
+	{2555, 9608, 5, 9},
+	{1403, 9627, 3, 9},
+};
+
+constexpr size_t edge_table_mask = 32767;
+
+constexpr uint16_t edge_table[32768] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6939, 0, 0, 0,
+	0, 0, 0, 0, 8300, 0, 0, 0, 1603, 2736, 0, 4333, 0, 5291, 7108, 0,
+	0, 0, 0, 0, 0, 0, 5649, 0, 0, 0, 0, 0, 0, 0, 0, 7235,
+	0, 0, 4930, 0, 0, 0, 0, 0, 3404, 8674, 8764, 984, 1199, 4651, 4857, 9406,
+	0, 0, 6464, 0, 1109, 0, 39, 8316, 3627, 4622, 8394, 0, 0, 0, 1198, 0,
+	0, 0, 0, 0, 0, 1196, 1197, 0, 1231, 0, 0, 0, 0, 0, 0, 7707,
+	0, 0, 0, 0, 0, 0, 0, 0, 4479, 0, 0, 0, 2913, 0, 1156, 0,
+	0, 0, 4448, 6708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9031, 9328, 0, 1378, 0,
+	0, 0, 0, 0, 0, 0, 3080, 0, 0, 0, 0, 6110, 7322, 0, 0, 0,
+	0, 3919, 1431, 3702, 2655, 0, 5849, 0, 0, 0, 0, 8170, 0, 0, 7978, 0,
+	0, 1742, 0, 0, 0, 0, 0, 207, 3650, 3736, 0, 8684, 0, 0, 0, 0,
+	0, 0, 0, 0, 9200, 0, 2189, 1381, 0, 0, 7553, 186, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4099, 0, 0, 0, 0, 3818,
+	4571, 0, 0, 0, 6009, 0, 0, 1477, 0, 0, 0, 0, 0, 0, 523, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1280, 0, 0, 5252, 0, 0, 6109, 5512, 0, 5303, 5852, 0, 0, 8249, 4366, 0,
+	0, 0, 4545, 9324, 0, 0, 0, 2145, 3, 0, 265, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5934, 213, 4148, 0, 0, 0, 6918, 0, 897, 3406, 8746,
+	8848, 0, 0, 0, 0, 978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2623, 0, 0, 0, 0, 0, 0, 0, 2450, 0, 7733, 0, 0, 0, 0, 8910,
+	0, 0, 0, 0, 0, 0, 2535, 6208, 0, 3184, 7606, 0, 0, 0, 0, 0,
+	0, 0, 0, 6807, 0, 0, 2301, 0, 0, 0, 1234, 0, 0, 1082, 0, 8533,
+	0, 7637, 0, 0, 0, 0, 2258, 0, 0, 3229, 0, 7651, 7729, 0, 2859, 2204,
+	0, 0, 0, 0, 0, 3088, 4282, 0, 0, 0, 8162, 0, 0, 0, 6712, 9396,
+	0, 0, 0, 8637, 0, 3835, 2067, 6647, 0, 0, 0, 0, 0, 0, 0, 6940,
+	8085, 3458, 8204, 0, 5677, 0, 0, 6745, 0, 0, 2378, 7114, 3067, 0, 0, 0,
+	4691, 2455, 0, 8054, 0, 0, 0, 0, 8911, 0, 0, 0, 0, 5505, 0, 0,
+	0, 0, 0, 7203, 700, 1271, 1830, 1336, 2701, 2293, 0, 4200, 4729, 1230, 0, 0,
+	0, 0, 0, 4118, 0, 5126, 0, 0, 0, 0, 0, 0, 5097, 0, 0, 0,
+	2012, 0, 0, 0, 0, 0, 0, 6155, 0, 0, 0, 0, 2193, 4235, 0, 0,
+	0, 7648, 9087, 0, 0, 0, 4907, 0, 4524, 0, 0, 0, 0, 0, 0, 5744,
+	0, 4317, 0, 6826, 0, 0, 7400, 9501, 0, 0, 0, 0, 0, 0, 0, 0,
+	7062, 0, 52, 0, 0, 0, 0, 0, 3771, 0, 0, 2341, 4661, 0, 8027, 0,
+	0, 0, 0, 0, 8463, 2026, 9114, 5365, 6676, 0, 0, 0, 0, 0, 0, 0,
+	0, 290, 737, 0, 0, 0, 2648, 2945, 7726, 0, 6181, 6314, 0, 0, 8460, 0,
+	0, 0, 0, 0, 0, 4684, 752, 0, 2773, 8838, 0, 0, 5010, 2690, 6221, 439,
+	1651, 7752, 0, 5254, 7485, 0, 0, 5571, 0, 2463, 0, 0, 0, 0, 0, 0,
+	0, 0, 2722, 0, 0, 0, 9024, 1566, 5733, 0, 0, 4380, 0, 3664, 0, 0,
+	0, 0, 0, 0, 0, 0, 6326, 6027, 0, 0, 0, 4083, 6699, 0, 0, 0,
+	0, 1345, 0, 0, 0, 0, 3048, 0, 0, 0, 0, 2812, 0, 0, 0, 3941,
+	5877, 4618, 0, 0, 6242, 0, 0, 0, 0, 0, 5728, 0, 0, 0, 0, 3654,
+	7072, 0, 2051, 0, 0, 0, 0, 0, 3831, 7202, 0, 0, 0, 0, 0, 0,
+	0, 0, 2194, 0, 0, 0, 0, 1568, 0, 0, 0, 0, 0, 0, 0, 5673,
+	0, 0, 1847, 0, 3382, 0, 1226, 4253, 0, 0, 0, 0, 0, 4546, 6611, 8985,
+	0, 0, 0, 0, 0, 393, 9331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4419, 0, 7433, 9344, 0, 2311, 0, 0, 7695, 0, 0, 0, 0, 6433, 0,
+	0, 0, 4080, 0, 0, 0, 0, 3754, 2199, 6417, 0, 0, 0, 0, 5864, 7820,
+	0, 1203, 0, 0, 0, 0, 0, 2130, 7887, 0, 0, 0, 0, 373, 0, 3946,
+	0, 8262, 0, 0, 0, 0, 855, 0, 0, 0, 0, 0, 0, 0, 3043, 0,
+	0, 0, 0, 0, 0, 0, 9574, 0, 0, 0, 0, 0, 0, 0, 0, 7953,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 2181, 0, 0, 2276,
+	6241, 0, 0, 2975, 0, 0, 1106, 0, 2243, 2707, 7639, 0, 3281, 0, 6523, 8919,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1229,
+	0, 0, 0, 0, 0, 0, 0, 8844, 5961, 0, 0, 0, 0, 0, 1086, 0,
+	0, 2684, 0, 0, 2352, 9377, 0, 7304, 0, 0, 3330, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6291, 8016, 2188,
+	0, 3857, 0, 0, 1981, 0, 0, 0, 0, 4584, 7237, 842, 694, 4244, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5616, 0, 6741, 0, 0, 0, 0, 0, 8513,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9252, 0, 0, 1130,
+	9279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 299, 2974, 0, 0, 0,
+	0, 0, 3960, 0, 0, 0, 0, 2620, 0, 0, 0, 1506, 0, 6080, 0, 6116,
+	0, 0, 0, 0, 0, 0, 8303, 0, 5418, 6061, 8388, 7363, 8680, 0, 0, 5550,
+	0, 7789, 0, 0, 0, 0, 5230, 0, 4322, 2994, 0, 0, 0, 0, 0, 0,
+	528, 0, 0, 0, 0, 4037, 0, 0, 0, 0, 0, 0, 1823, 4954, 9699, 0,
+	0, 0, 1866, 0, 0, 0, 1420, 0, 0, 2004, 4050, 0, 0, 0, 0, 7661,
+	0, 6766, 0, 0, 1029, 0, 1322, 0, 0, 8824, 7943, 3548, 0, 0, 634, 0,
+	0, 0, 0, 3197, 0, 0, 0, 0, 0, 0, 6072, 3038, 1457, 0, 0, 0,
+	6864, 0, 0, 4068, 0, 2819, 2719, 0, 0, 0, 0, 0, 0, 3065, 1898, 0,
+	0, 0, 0, 0, 2799, 0, 0, 0, 0, 8355, 3034, 4839, 1737, 8130, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6018, 8392, 0, 0, 0, 0, 0, 0, 5548,
+	0, 0, 0, 0, 0, 0, 0, 2629, 0, 0, 3164, 0, 0, 0, 0, 0,
+	7007, 0, 0, 0, 1240, 0, 0, 0, 0, 0, 0, 0, 0, 3095, 0, 0,
+	582, 0, 0, 0, 0, 0, 0, 0, 532, 6033, 0, 0, 0, 0, 2795, 0,
+	8589, 3323, 0, 0, 0, 0, 0, 3683, 0, 0, 0, 0, 5909, 7778, 0, 4828,
+	0, 8619, 0, 4149, 8453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9521, 0, 0, 0, 0, 1533, 2841, 4529, 0, 0, 2904, 0, 0, 0,
+	7416, 6182, 8087, 7069, 8337, 0, 0, 0, 0, 0, 0, 1522, 0, 0, 0, 0,
+	0, 0, 0, 5503, 0, 0, 0, 3339, 4613, 0, 0, 5054, 0, 3715, 0, 3827,
+	6543, 0, 8634, 0, 0, 2993, 0, 0, 0, 5600, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5167, 0, 0, 7749, 0,
+	1299, 6200, 0, 0, 0, 8357, 0, 0, 8822, 0, 0, 0, 0, 5148, 0, 4399,
+	0, 0, 0, 0, 3742, 1370, 7046, 5960, 0, 0, 4061, 0, 0, 0, 0, 6331,
+	0, 1696, 0, 2709, 5101, 0, 0, 1481, 0, 0, 0, 7432, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1986, 0, 6720, 0, 0, 0, 0, 0, 0, 0, 0,
+	2038, 0, 0, 0, 0, 0, 0, 0, 0, 3029, 0, 0, 0, 0, 2931, 0,
+	1678, 0, 8363, 0, 6357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1614, 0, 986, 0, 8677, 0, 0, 2290, 7122, 0, 0, 0, 0, 0, 4580,
+	0, 0, 0, 1174, 0, 0, 0, 2381, 7058, 0, 0, 0, 0, 0, 0, 0,
+	0, 7353, 0, 0, 0, 0, 0, 2529, 0, 3372, 0, 0, 0, 2356, 3656, 0,
+	7709, 0, 7145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4444, 0, 0, 7071,
+	0, 0, 2547, 3262, 0, 0, 0, 0, 0, 8581, 0, 0, 0, 0, 0, 0,
+	0, 0, 7853, 2190, 0, 5592, 0, 0, 0, 0, 0, 0, 0, 8658, 0, 9347,
+	0, 0, 633, 376, 0, 5745, 0, 5722, 0, 0, 0, 8629, 0, 0, 0, 0,
+	6511, 0, 0, 0, 0, 6039, 0, 0, 2380, 3226, 6402, 9097, 7497, 0, 5141, 0,
+	5669, 0, 9314, 1327, 0, 0, 0, 4891, 0, 0, 0, 0, 0, 7028, 0, 0,
+	9571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8665, 0, 0, 0, 0, 415,
+	7619, 0, 0, 2695, 0, 6271, 0, 3995, 0, 4343, 0, 5628, 0, 0, 0, 6823,
+	0, 7520, 0, 0, 0, 9697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5865, 4642, 8916, 0, 7816, 0, 0, 8220, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9623, 4610, 0, 2272, 0, 3836, 0, 6371, 0, 0, 0, 4194, 0, 0,
+	6414, 0, 5276, 9351, 0, 1263, 0, 0, 6755, 0, 0, 0, 0, 0, 0, 0,
+	4110, 0, 0, 0, 0, 0, 0, 0, 8932, 0, 486, 0, 0, 0, 0, 0,
+	0, 0, 0, 6383, 502, 9044, 1450, 1359, 0, 0, 0, 450, 6138, 0, 7428, 0,
+	0, 4028, 0, 0, 0, 0, 0, 4004, 0, 0, 0, 1446, 0, 0, 0, 0,
+	0, 0, 0, 4876, 0, 0, 8994, 0, 0, 0, 1471, 5815, 0, 0, 6850, 0,
+	3977, 6762, 9254, 0, 0, 0, 7523, 0, 0, 0, 0, 0, 0, 0, 0, 1764,
+	0, 475, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8103, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5005, 1320, 0, 0, 0,
+	0, 0, 0, 7038, 7762, 0, 0, 5432, 1060, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3364, 3284, 0, 5813, 8024, 0, 0, 0, 0, 3761, 0,
+	4305, 4665, 0, 0, 0, 407, 0, 0, 3593, 7299, 0, 0, 7374, 0, 0, 0,
+	0, 0, 2891, 0, 0, 0, 0, 0, 0, 0, 2788, 0, 0, 0, 0, 0,
+	7390, 7662, 2050, 8517, 0, 7052, 0, 5345, 0, 3680, 0, 0, 1718, 0, 0, 0,
+	0, 6447, 1504, 0, 0, 8291, 0, 0, 4191, 0, 2933, 3358, 9226, 7014, 0, 0,
+	0, 0, 2481, 0, 0, 0, 0, 0, 0, 0, 0, 8086, 0, 0, 0, 0,
+	0, 0, 0, 6166, 0, 9444, 0, 0, 5357, 0, 0, 8123, 3675, 0, 0, 0,
+	9315, 0, 8286, 4258, 0, 0, 0, 0, 0, 0, 0, 6842, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 605, 0, 0, 0, 1392, 0, 0, 0, 496, 0, 0, 0, 2425, 4556,
+	6156, 0, 0, 0, 0, 0, 0, 406, 0, 0, 0, 0, 0, 0, 0, 0,
+	5108, 8293, 0, 0, 2645, 0, 7996, 0, 0, 0, 0, 7955, 0, 990, 0, 4418,
+	4877, 9568, 2772, 3173, 0, 0, 0, 0, 0, 4476, 3231, 5051, 0, 7675, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6876, 0,
+	0, 0, 0, 5290, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2192, 9234, 0,
+	0, 0, 8100, 0, 1297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6257, 0,
+	0, 567, 7649, 0, 0, 0, 7801, 4238, 0, 87, 9409, 4033, 8135, 0, 4267, 0,
+	0, 3008, 5180, 8488, 0, 0, 0, 0, 0, 0, 6567, 1540, 3681, 0, 4850, 9530,
+	0, 0, 0, 0, 0, 4084, 0, 0, 1664, 0, 0, 5461, 0, 0, 0, 0,
+	2575, 0, 0, 0, 1850, 0, 0, 0, 0, 0, 508, 0, 0, 0, 0, 6277,
+	0, 0, 1108, 241, 8860, 0, 0, 0, 0, 5533, 0, 2588, 0, 5615, 3772, 0,
+	9413, 0, 0, 0, 0, 0, 2595, 0, 0, 2342, 0, 0, 0, 3241, 0, 1194,
+	1364, 2597, 0, 0, 0, 0, 0, 0, 7973, 0, 4009, 8630, 0, 0, 0, 6403,
+	6133, 0, 0, 5221, 8623, 6613, 1575, 1727, 4744, 9181, 9332, 0, 0, 0, 0, 0,
+	4042, 0, 0, 0, 0, 0, 91, 0, 0, 2816, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7569, 0, 0, 0, 0, 0, 0, 0, 0, 3529,
+	0, 0, 0, 0, 7457, 0, 0, 8109, 0, 0, 4568, 2731, 6098, 7884, 8486, 6980,
+	0, 0, 8598, 0, 2666, 0, 0, 5717, 0, 0, 0, 8613, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3299, 1597, 8341, 5617, 0, 0, 6923, 0, 0, 7495,
+	0, 7573, 0, 0, 0, 8031, 0, 0, 0, 0, 0, 0, 0, 0, 2167, 0,
+	0, 0, 0, 0, 0, 4824, 5794, 9109, 9626, 0, 2532, 0, 0, 0, 9667, 0,
+	4609, 0, 0, 0, 8167, 1685, 0, 1605, 0, 0, 4656, 0, 0, 0, 0, 85,
+	0, 0, 1373, 0, 0, 0, 0, 0, 0, 0, 4965, 0, 8144, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1595, 0, 0, 0, 3660, 0, 0, 0, 0, 0,
+	0, 6119, 1861, 5203, 6354, 2523, 0, 0, 587, 7324, 777, 0, 2489, 0, 0, 8434,
+	9015, 160, 5515, 4735, 7616, 2626, 2046, 813, 0, 0, 0, 790, 9077, 0, 2000, 0,
+	0, 0, 6234, 1555, 0, 0, 0, 1223, 0, 0, 0, 1314, 0, 0, 881, 9543,
+	0, 2281, 0, 0, 2433, 0, 6843, 7066, 751, 0, 4705, 0, 0, 0, 2133, 0,
+	0, 9504, 0, 0, 0, 0, 2932, 0, 0, 0, 7692, 3200, 0, 2238, 0, 0,
+	0, 0, 0, 0, 5346, 4205, 0, 5084, 0, 0, 0, 8599, 0, 3781, 0, 0,
+	0, 9369, 0, 0, 0, 0, 7099, 0, 2486, 437, 0, 0, 1424, 7465, 0, 0,
+	0, 6304, 0, 0, 6530, 0, 0, 0, 0, 1162, 0, 0, 7018, 0, 0, 0,
+	0, 4157, 0, 0, 0, 0, 0, 7677, 0, 0, 0, 0, 0, 0, 0, 2230,
+	0, 0, 0, 6664, 0, 0, 0, 4456, 4887, 35, 0, 2510, 6307, 0, 499, 6101,
+	7325, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3789, 0, 5464, 0, 4135, 5695,
+	0, 0, 0, 0, 0, 0, 0, 5689, 0, 0, 0, 0, 0, 0, 2237, 2417,
+	2987, 0, 0, 0, 2970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 66, 8242, 0, 0, 847, 0, 0, 0, 0, 4500, 0,
+	3856, 6725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5413, 8451, 0, 4461, 0, 0, 0, 7696, 0, 2010, 0, 3106, 7238, 0, 0, 0,
+	981, 0, 0, 7131, 0, 0, 0, 2808, 0, 0, 0, 7883, 9600, 0, 7008, 0,
+	0, 0, 5955, 0, 0, 5007, 8470, 8080, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7368, 0, 0, 0, 0, 0, 6187, 2298, 0, 0, 0, 0, 8227, 0, 7296,
+	2560, 0, 0, 0, 7854, 4434, 0, 3989, 0, 7515, 0, 0, 6808, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5440, 0, 0, 0, 0, 2108, 0, 0, 0,
+	0, 0, 9523, 0, 0, 0, 0, 0, 0, 0, 216, 0, 7592, 2379, 0, 0,
+	0, 616, 0, 0, 0, 0, 0, 0, 9146, 0, 224, 1991, 0, 6264, 7730, 2485,
+	5886, 0, 0, 0, 0, 0, 5675, 0, 0, 0, 8241, 0, 0, 0, 0, 7204,
+	0, 8301, 9187, 0, 0, 1141, 0, 0, 2452, 7484, 0, 8147, 8292, 0, 0, 0,
+	0, 0, 0, 0, 6074, 0, 0, 0, 0, 0, 0, 0, 0, 7252, 0, 0,
+	1518, 6426, 0, 0, 9204, 0, 0, 1365, 0, 0, 6275, 0, 3531, 0, 0, 0,
+	0, 0, 4029, 0, 0, 5605, 0, 0, 0, 0, 0, 0, 0, 0, 4081, 0,
+	2768, 0, 7437, 0, 0, 2271, 0, 0, 0, 0, 996, 0, 0, 328, 0, 0,
+	0, 0, 0, 9457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 649,
+	1100, 4742, 0, 0, 0, 591, 0, 0, 0, 0, 4070, 6142, 0, 1858, 0, 5917,
+	3840, 547, 0, 0, 0, 6352, 0, 0, 0, 0, 0, 0, 0, 0, 2873, 6558,
+	0, 4693, 0, 0, 384, 0, 0, 0, 0, 4228, 3087, 9050, 0, 0, 7200, 7995,
+	9090, 0, 0, 0, 4903, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1538, 0, 0, 2982, 5602, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7719, 0, 0, 0, 1287, 6490, 0, 0, 8771,
+	0, 6100, 8660, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3713, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8864, 2324, 0, 0, 1806, 0,
+	4005, 1972, 657, 2917, 2682, 8097, 8869, 0, 0, 0, 0, 0, 5407, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8280, 0, 0, 0, 1692, 7205, 0, 0, 0, 0,
+	0, 0, 0, 0, 6984, 0, 0, 0, 0, 0, 0, 0, 0, 7929, 6269, 419,
+	0, 0, 0, 0, 0, 6934, 3117, 0, 0, 2397, 6847, 0, 0, 0, 3613, 5792,
+	0, 6396, 2228, 2286, 4755, 2275, 8799, 9136, 0, 2165, 9370, 1333, 8625, 8528, 0, 0,
+	6431, 0, 0, 0, 0, 0, 0, 6413, 0, 1344, 0, 0, 0, 0, 0, 0,
+	9366, 0, 5023, 0, 0, 0, 5220, 62, 3954, 0, 4031, 0, 0, 872, 0, 0,
+	0, 0, 0, 0, 0, 5976, 0, 0, 0, 0, 0, 0, 0, 6625, 0, 0,
+	0, 0, 0, 0, 0, 4967, 0, 0, 0, 0, 0, 0, 0, 6407, 795, 7410,
+	5453, 8165, 8906, 0, 0, 0, 0, 0, 0, 9017, 3156, 8602, 0, 0, 0, 0,
+	4426, 0, 0, 0, 4193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9094,
+	0, 6581, 9129, 0, 4478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4535, 0, 0, 0, 0, 0, 0, 0, 1567, 0, 0, 0, 0, 2508, 0, 0,
+	0, 0, 0, 6565, 0, 7406, 8213, 0, 0, 0, 2168, 1548, 0, 0, 0, 0,
+	0, 5807, 1604, 0, 0, 0, 3225, 6921, 0, 0, 0, 0, 6050, 0, 0, 0,
+	1085, 0, 0, 0, 0, 0, 0, 2112, 0, 0, 3624, 0, 0, 0, 0, 8102,
+	0, 0, 3086, 7082, 5780, 0, 0, 4918, 0, 2075, 0, 497, 0, 0, 2109, 0,
+	0, 3050, 0, 0, 0, 0, 0, 0, 4195, 0, 0, 0, 0, 0, 0, 0,
+	0, 7652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3704, 5248,
+	3165, 1368, 941, 8224, 4562, 0, 0, 0, 0, 8271, 3658, 2154, 2398, 0, 0, 0,
+	0, 0, 6532, 1647, 0, 0, 9693, 0, 0, 0, 5340, 0, 0, 0, 3915, 0,
+	0, 0, 5753, 0, 0, 5895, 0, 6263, 0, 0, 8065, 0, 0, 0, 0, 3760,
+	0, 0, 7391, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3250, 0, 0, 0, 0, 0, 7435, 0, 0, 0, 0, 0, 0, 6525, 0, 8036,
+	0, 0, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 4386, 8683, 0, 0,
+	0, 0, 9079, 0, 9658, 0, 1811, 8259, 8537, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1117, 0, 0, 0, 0, 4023, 4300, 0, 0,
+	0, 1443, 0, 0, 0, 0, 6082, 0, 0, 7721, 0, 0, 2014, 3021, 3335, 4405,
+	0, 0, 9269, 0, 0, 0, 0, 0, 4680, 0, 0, 0, 0, 0, 0, 7458,
+	0, 0, 0, 0, 0, 4521, 1769, 6479, 0, 7583, 0, 0, 4640, 0, 0, 0,
+	8398, 0, 201, 0, 0, 1770, 0, 1273, 7105, 0, 0, 0, 0, 0, 4163, 6506,
+	8315, 701, 9439, 0, 0, 2476, 0, 757, 0, 9064, 0, 0, 0, 0, 9452, 0,
+	0, 5586, 0, 0, 6571, 1219, 9624, 0, 7352, 0, 5308, 0, 0, 0, 0, 1523,
+	8060, 6349, 9493, 0, 0, 7595, 0, 0, 0, 0, 0, 0, 0, 0, 3435, 0,
+	0, 0, 5799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5450,
+	6629, 0, 0, 0, 0, 8600, 5495, 0, 0, 5640, 0, 0, 0, 0, 9426, 0,
+	2263, 0, 0, 1208, 0, 0, 8706, 0, 0, 0, 0, 0, 8534, 0, 0, 9327,
+	0, 0, 7678, 4320, 0, 0, 0, 0, 1137, 4972, 9173, 0, 0, 0, 6057, 0,
+	0, 0, 8772, 4983, 1289, 1902, 0, 0, 2622, 7272, 0, 0, 0, 0, 4966, 0,
+	0, 0, 0, 5263, 3365, 0, 0, 0, 0, 0, 0, 7865, 0, 0, 554, 2569,
+	2837, 4411, 0, 0, 0, 9554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7575, 7916, 0, 0, 0, 0, 0, 0, 9581, 0, 0, 7636,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5690, 1202,
+	6058, 0, 0, 3731, 0, 0, 0, 0, 0, 0, 174, 7481, 0, 0, 0, 0,
+	0, 0, 0, 9563, 0, 0, 0, 7921, 0, 4859, 9227, 0, 0, 6937, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8317, 0, 1407, 2138, 0, 0, 0, 0, 0,
+	0, 0, 0, 5916, 0, 0, 0, 0, 9534, 0, 0, 0, 0, 0, 7784, 0,
+	9137, 0, 3969, 0, 0, 0, 0, 0, 2934, 6624, 0, 0, 0, 0, 7872, 629,
+	5918, 0, 0, 0, 6975, 0, 0, 8826, 7975, 5060, 0, 0, 6418, 0, 0, 4437,
+	0, 3538, 0, 0, 8234, 0, 3347, 7989, 0, 0, 0, 0, 0, 8596, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6584, 0, 0, 0, 8305,
+	3472, 5919, 0, 0, 3012, 5518, 0, 0, 2382, 0, 0, 3479, 0, 0, 0, 0,
+	0, 6879, 0, 0, 2197, 1508, 0, 0, 3684, 0, 0, 0, 6168, 0, 171, 642,
+	4241, 0, 0, 0, 7323, 0, 7448, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5562, 0, 0, 0, 0, 0, 0, 4303, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 458, 0, 9515, 0, 0, 3697, 0, 3001, 0, 0,
+	0, 0, 0, 0, 0, 0, 2965, 9082, 0, 9401, 3132, 0, 0, 0, 0, 4021,
+	0, 0, 7450, 0, 2654, 2377, 3609, 4243, 6797, 6858, 8998, 208, 2565, 4101, 9433, 6005,
+	0, 0, 0, 0, 0, 0, 8211, 0, 0, 0, 360, 5383, 0, 0, 0, 0,
+	0, 0, 696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6753, 7461, 0, 0, 0, 3019, 0, 0, 4534, 0, 0, 7666, 3194, 5783, 8015, 0,
+	8719, 0, 0, 1616, 0, 0, 279, 2847, 4794, 7219, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1347, 4242, 0, 0, 0, 0, 0, 0, 8393,
+	9511, 0, 8283, 0, 3775, 0, 0, 0, 7777, 0, 0, 0, 0, 0, 500, 0,
+	0, 0, 3885, 0, 0, 0, 5540, 0, 7926, 0, 0, 0, 7499, 0, 9093, 0,
+	0, 0, 6853, 0, 0, 3625, 2310, 0, 0, 0, 0, 0, 2407, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4138, 0, 0, 0, 0, 0,
+	4222, 7251, 2744, 4951, 6152, 7770, 0, 0, 0, 4623, 3858, 0, 0, 3774, 1341, 3869,
+	4943, 6378, 5421, 8232, 0, 0, 4232, 0, 0, 0, 0, 0, 7031, 0, 0, 7776,
+	518, 5730, 0, 0, 2401, 7690, 0, 0, 0, 0, 1016, 0, 0, 921, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4560, 9305, 0, 4848, 3259, 4049, 0, 321, 0,
+	7395, 8624, 0, 0, 0, 0, 6633, 2059, 5160, 239, 0, 0, 0, 0, 3461, 0,
+	0, 0, 9419, 0, 0, 0, 0, 0, 0, 0, 586, 8032, 0, 6227, 0, 0,
+	5354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3800, 6878, 6926, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9089, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8011, 9184, 1435, 0, 5538, 7377, 0, 1709, 1930, 9201, 9670, 0, 0, 9121, 0,
+	1094, 0, 0, 0, 0, 0, 7668, 0, 1744, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 7226, 0, 0, 0, 7430, 5183, 0, 0, 0, 0, 2561,
+	4733, 0, 0, 0, 4767, 3694, 0, 0, 0, 5427, 0, 0, 0, 0, 3588, 4295,
+	0, 743, 7117, 0, 0, 1078, 0, 0, 0, 7605, 0, 0, 2215, 7154, 0, 0,
+	0, 0, 0, 0, 0, 0, 1632, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5319, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4734, 3655, 0, 0, 0, 6539, 6576, 575, 0, 0, 0, 2292, 1416, 100, 5644, 3084,
+	4425, 7771, 64, 251, 0, 0, 0, 3360, 1502, 796, 0, 0, 0, 0, 0, 4606,
+	8958, 0, 0, 0, 0, 0, 0, 2646, 0, 8922, 0, 0, 4725, 6157, 0, 2944,
+	0, 9149, 0, 1096, 4855, 7911, 3572, 7852, 0, 0, 0, 0, 0, 7965, 5661, 0,
+	0, 0, 0, 0, 8663, 2013, 2287, 2406, 8867, 0, 673, 5123, 8796, 7084, 0, 0,
+	0, 0, 9383, 5434, 889, 47, 6873, 0, 0, 0, 0, 2231, 0, 0, 6882, 0,
+	0, 0, 0, 0, 0, 0, 0, 9060, 3290, 286, 3638, 0, 0, 0, 0, 4250,
+	0, 0, 0, 6389, 0, 0, 0, 0, 2631, 6666, 7603, 0, 483, 0, 0, 0,
+	4928, 0, 0, 0, 0, 0, 0, 0, 6661, 0, 0, 0, 5369, 6988, 0, 0,
+	0, 0, 0, 5630, 8999, 0, 0, 0, 0, 0, 0, 0, 0, 5295, 0, 0,
+	229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 2710, 3289, 0, 0,
+	0, 0, 0, 0, 2250, 5047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6393, 0, 0, 0, 0, 0, 0, 0, 0, 7393, 0,
+	0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 8542, 5845, 6630, 0, 643, 0, 0, 6183, 0, 1895, 0, 0, 4254,
+	6704, 0, 0, 0, 6771, 3630, 0, 3112, 0, 8068, 4797, 5589, 0, 0, 0, 3677,
+	1379, 0, 0, 1562, 0, 0, 0, 0, 0, 37, 9211, 0, 2405, 648, 1827, 3582,
+	4034, 7744, 8997, 2247, 0, 0, 0, 6837, 660, 0, 1335, 2375, 1703, 5469, 7855, 0,
+	0, 0, 7455, 9466, 0, 0, 0, 7300, 7399, 0, 0, 0, 0, 20, 0, 0,
+	0, 0, 3492, 0, 0, 0, 8466, 0, 577, 0, 0, 0, 0, 0, 6344, 5697,
+	0, 5397, 0, 0, 0, 0, 0, 0, 1884, 0, 0, 0, 1546, 0, 1404, 3767,
+	0, 0, 0, 0, 0, 2338, 0, 0, 9669, 2842, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3026, 0, 0, 7152, 902, 2779, 5259, 0,
+	0, 0, 405, 0, 5470, 0, 827, 0, 7157, 0, 0, 0, 0, 7687, 0, 0,
+	0, 2241, 5938, 0, 0, 0, 5729, 0, 0, 0, 0, 0, 0, 3843, 2556, 0,
+	0, 0, 0, 0, 0, 2104, 2888, 0, 48, 0, 0, 0, 0, 1192, 5998, 9195,
+	0, 0, 0, 0, 0, 0, 6290, 0, 8075, 6904, 7383, 0, 0, 3054, 4231, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7961, 0, 0, 8975, 0, 0, 2205, 3278,
+	3605, 0, 0, 0, 0, 0, 0, 0, 0, 8225, 0, 0, 0, 2915, 9253, 0,
+	0, 0, 0, 0, 4791, 5100, 0, 5612, 0, 0, 0, 0, 0, 0, 2475, 1731,
+	8789, 0, 0, 9273, 0, 0, 3368, 0, 0, 1848, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1111, 0, 0, 0, 5502, 8862, 0, 0, 0, 0, 4896, 0,
+	5607, 6203, 7511, 0, 0, 9470, 0, 0, 0, 0, 0, 7454, 0, 0, 0, 0,
+	1241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6258, 0, 0, 2266,
+	0, 0, 0, 7833, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5387, 0, 0, 0, 7456, 0, 8154, 0, 0, 0, 0,
+	0, 0, 0, 0, 3499, 7663, 0, 0, 0, 0, 0, 6806, 0, 0, 0, 0,
+	0, 8379, 0, 0, 0, 0, 0, 9124, 0, 1589, 0, 0, 0, 512, 0, 0,
+	0, 0, 0, 0, 0, 2549, 7501, 0, 0, 6735, 0, 0, 0, 1829, 0, 9162,
+	0, 0, 0, 0, 7795, 7195, 0, 1372, 117, 1876, 0, 0, 0, 0, 5837, 0,
+	7925, 3907, 8349, 344, 8326, 5419, 8410, 0, 0, 0, 0, 0, 2752, 6831, 421, 1089,
+	615, 0, 0, 8832, 5361, 0, 2879, 5723, 9411, 0, 0, 0, 0, 0, 0, 6563,
+	0, 0, 0, 0, 5497, 3563, 8264, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3057, 0, 4450, 0, 0, 0, 521, 1704, 5175, 6494, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1949, 0, 5124, 6816, 0, 0, 0, 9495, 0, 0, 0,
+	8717, 0, 0, 0, 0, 0, 0, 0, 4518, 0, 2829, 0, 0, 0, 9446, 3966,
+	0, 0, 661, 0, 612, 0, 1713, 4158, 4619, 8945, 1995, 2196, 5841, 4209, 0, 0,
+	0, 0, 0, 742, 0, 6174, 0, 0, 0, 0, 0, 1138, 0, 0, 0, 0,
+	7578, 7371, 0, 0, 0, 0, 0, 0, 0, 0, 3286, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5392, 8866, 0, 2540, 0, 0, 243, 5763, 0, 0, 609, 2244,
+	8073, 0, 2725, 5176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7486, 6953,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4358, 0, 0, 4793, 0, 0, 0,
+	3874, 4629, 3193, 0, 0, 0, 0, 0, 0, 0, 8830, 0, 0, 0, 0, 0,
+	0, 1521, 4581, 0, 0, 0, 0, 0, 0, 6521, 0, 7345, 0, 0, 0, 7769,
+	7357, 0, 0, 0, 0, 0, 0, 4503, 0, 0, 0, 0, 0, 326, 2066, 7923,
+	0, 3846, 0, 8396, 4201, 0, 0, 0, 0, 2335, 0, 0, 0, 1550, 3495, 0,
+	0, 0, 3091, 0, 3220, 0, 0, 7381, 0, 4882, 7791, 0, 1767, 0, 0, 0,
+	0, 0, 0, 0, 870, 0, 0, 0, 0, 5915, 0, 0, 6011, 0, 0, 0,
+	0, 0, 0, 0, 3017, 3094, 2305, 0, 0, 0, 0, 8780, 0, 8176, 0, 199,
+	0, 8943, 0, 6368, 0, 6697, 0, 5262, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6898, 0, 5645, 0, 0, 0, 0, 0, 0, 0, 33,
+	3345, 4569, 0, 0, 0, 3699, 5028, 0, 0, 5289, 0, 0, 0, 0, 901, 4368,
+	0, 0, 0, 0, 4779, 0, 0, 0, 0, 4375, 9309, 0, 2502, 0, 2358, 0,
+	0, 0, 581, 0, 0, 0, 0, 0, 3968, 9547, 6784, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3478, 0, 4764, 0, 0,
+	0, 0, 0, 0, 0, 8336, 0, 0, 0, 0, 8067, 1768, 0, 0, 0, 2149,
+	9250, 0, 7867, 0, 9512, 6296, 7635, 0, 0, 0, 0, 0, 7536, 916, 9420, 7079,
+	7318, 0, 0, 0, 0, 0, 0, 0, 4800, 0, 0, 0, 6231, 5202, 5208, 0,
+	9678, 0, 0, 0, 0, 0, 0, 3105, 0, 0, 5643, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1889,
+	5889, 0, 0, 9084, 5107, 0, 5271, 9026, 8260, 0, 0, 5131, 0, 5739, 0, 0,
+	0, 0, 0, 0, 3390, 0, 2150, 0, 0, 0, 0, 0, 0, 0, 3213, 0,
+	0, 909, 1871, 1035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9092, 0, 0,
+	0, 0, 359, 0, 0, 0, 6226, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 470, 0, 0, 0,
+	0, 6608, 0, 0, 0, 0, 0, 3113, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5324, 6243, 9177, 0, 0, 0, 7244, 0, 5587,
+	0, 0, 7417, 0, 0, 0, 5556, 0, 0, 0, 3288, 28, 1509, 1588, 8397, 0,
+	0, 1087, 0, 0, 0, 0, 0, 0, 4834, 3653, 4658, 5528, 8927, 0, 0, 0,
+	0, 0, 6804, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 510, 0, 7147, 0, 0, 2846, 2018, 2800, 0, 0, 0, 776, 857,
+	0, 0, 0, 0, 0, 3734, 8377, 0, 0, 474, 0, 0, 9631, 5664, 0, 3646,
+	0, 0, 0, 5111, 0, 0, 0, 462, 8127, 0, 0, 0, 8354, 686, 0, 0,
+	3793, 8491, 0, 4633, 0, 7864, 0, 0, 0, 1447, 0, 0, 2641, 9268, 9625, 0,
+	0, 0, 0, 0, 4763, 4768, 0, 0, 0, 0, 8884, 9275, 0, 9455, 0, 0,
+	0, 0, 0, 0, 3670, 0, 1319, 377, 329, 6617, 1028, 3433, 0, 2056, 7056, 0,
+	6382, 0, 0, 0, 7873, 0, 0, 0, 0, 0, 8136, 8890, 0, 6856, 7775, 0,
+	0, 0, 611, 5874, 0, 4635, 0, 0, 0, 0, 0, 0, 0, 4908, 7944, 0,
+	0, 0, 0, 0, 1362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2007, 0, 0, 4318, 7194, 0, 388, 1809, 8152, 0,
+	0, 0, 0, 0, 5401, 8230, 9410, 0, 0, 7881, 0, 0, 0, 4086, 8151, 0,
+	0, 0, 6954, 4737, 0, 228, 0, 0, 0, 49, 0, 0, 0, 0, 0, 685,
+	0, 0, 8332, 8976, 0, 0, 0, 5569, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4119, 0, 0, 0, 635, 0, 0, 0, 0, 2411, 0, 0, 0, 0, 0,
+	0, 4484, 0, 0, 0, 8261, 0, 0, 0, 8939, 4292, 7970, 2162, 2711, 520, 0,
+	0, 0, 0, 6746, 7525, 9248, 0, 0, 0, 0, 0, 8307, 0, 0, 0, 0,
+	942, 0, 0, 0, 0, 0, 0, 0, 3414, 0, 0, 0, 0, 0, 0, 0,
+	1101, 3296, 0, 4140, 6251, 0, 0, 8371, 0, 0, 0, 0, 0, 0, 1246, 0,
+	0, 0, 6719, 0, 0, 0, 8390, 0, 4053, 0, 337, 0, 0, 0, 0, 0,
+	0, 5157, 2962, 0, 0, 0, 4806, 0, 0, 9311, 0, 0, 0, 5667, 0, 1936,
+	0, 0, 0, 8053, 0, 0, 0, 1113, 7858, 0, 2843, 2650, 78, 0, 0, 4701,
+	4829, 0, 0, 0, 0, 0, 0, 6925, 0, 8928, 0, 0, 0, 0, 3387, 0,
+	0, 0, 0, 0, 0, 5281, 0, 0, 0, 0, 970, 8467, 0, 0, 0, 0,
+	0, 6644, 0, 0, 0, 0, 4075, 0, 0, 0, 0, 0, 0, 849, 3610, 4676,
+	3620, 0, 0, 0, 0, 3783, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8901, 0, 0, 0, 0, 4017, 0, 0, 0, 2674, 3542, 0, 0, 0, 0,
+	0, 0, 6792, 0, 0, 0, 0, 0, 0, 0, 6974, 4387, 0, 0, 7907, 3416,
+	0, 0, 5490, 0, 4547, 0, 3838, 3990, 0, 5816, 7753, 0, 0, 2929, 5225, 9135,
+	5146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1324, 3923, 5762, 7554,
+	6972, 7580, 5809, 8340, 0, 0, 0, 0, 3014, 0, 8574, 0, 2739, 0, 0, 0,
+	0, 0, 0, 555, 4822, 6067, 7542, 6912, 7793, 0, 0, 0, 2219, 0, 1510, 0,
+	3243, 3361, 0, 0, 0, 8034, 0, 9108, 0, 0, 0, 0, 2079, 2093, 0, 0,
+	0, 432, 0, 5720, 7822, 0, 3199, 0, 0, 0, 0, 0, 0, 0, 0, 8404,
+	0, 0, 9378, 0, 0, 0, 0, 0, 2592, 0, 0, 4278, 8180, 0, 0, 1698,
+	0, 0, 529, 0, 0, 0, 2024, 2307, 1307, 6388, 0, 0, 0, 0, 0, 0,
+	0, 4223, 0, 1221, 3218, 0, 0, 0, 0, 0, 913, 2503, 0, 0, 0, 7587,
+	0, 0, 0, 0, 6190, 0, 0, 0, 1520, 0, 0, 0, 0, 0, 0, 0,
+	0, 3343, 0, 0, 0, 0, 0, 0, 8107, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 610, 3103, 5785, 0, 0, 0, 9247, 9660, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4373, 0, 0, 0, 8426, 3520, 0, 0, 0,
+	0, 9147, 0, 0, 0, 0, 0, 3628, 0, 0, 0, 0, 0, 0, 0, 0,
+	1957, 9030, 912, 9469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5360,
+	0, 0, 8583, 0, 0, 0, 0, 515, 0, 0, 0, 0, 7948, 0, 0, 0,
+	0, 0, 0, 0, 0, 225, 6779, 0, 0, 0, 0, 0, 0, 302, 0, 713,
+	0, 0, 8366, 0, 0, 0, 3509, 0, 0, 0, 2369, 2973, 0, 8046, 3294, 0,
+	4442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3443, 597, 0, 3714,
+	0, 1238, 0, 4030, 0, 0, 0, 0, 0, 0, 0, 1514, 0, 0, 0, 1283,
+	0, 0, 0, 0, 995, 7630, 4482, 0, 0, 0, 0, 0, 0, 0, 0, 8564,
+	0, 0, 2653, 0, 7693, 0, 8782, 0, 0, 5921, 0, 0, 0, 2740, 2163, 0,
+	0, 0, 0, 0, 7861, 0, 0, 0, 0, 3980, 0, 306, 5177, 2902, 6992, 8116,
+	9418, 0, 0, 1954, 8343, 0, 0, 2727, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3056, 8069, 0, 6474, 0, 0, 0, 0, 4869, 4038, 0, 7503, 0, 0, 0,
+	4909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5331, 3849, 0,
+	0, 0, 4670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3163, 0, 0, 0,
+	0, 1455, 1308, 0, 0, 0, 0, 0, 3431, 0, 0, 0, 6115, 9638, 0, 0,
+	4126, 0, 0, 0, 7642, 0, 0, 0, 0, 0, 0, 0, 2144, 4585, 0, 2793,
+	8500, 0, 0, 0, 0, 5210, 1262, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8360, 0, 0, 0, 0, 0, 7718, 0, 0, 3436, 0, 0, 0, 152, 0, 0,
+	509, 4986, 0, 0, 6298, 0, 298, 2865, 7002, 3373, 9293, 0, 0, 0, 0, 8063,
+	5249, 0, 0, 2923, 0, 6294, 0, 8750, 0, 0, 0, 0, 0, 5150, 7107, 968,
+	0, 6915, 0, 0, 0, 0, 4929, 0, 6186, 0, 8787, 0, 9682, 0, 0, 0,
+	0, 0, 0, 7162, 0, 0, 0, 0, 0, 0, 0, 0, 2580, 9461, 0, 0,
+	0, 0, 0, 0, 2044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3672, 9465,
+	0, 0, 0, 0, 0, 2874, 8870, 0, 0, 0, 0, 0, 0, 0, 5174, 2223,
+	8188, 0, 0, 7342, 0, 8270, 5924, 0, 0, 2454, 0, 4867, 0, 6420, 0, 0,
+	0, 0, 0, 0, 0, 0, 3211, 7401, 5492, 0, 0, 0, 0, 9341, 0, 0,
+	0, 7731, 0, 0, 2083, 0, 0, 0, 0, 0, 0, 0, 9316, 0, 0, 8381,
+	0, 0, 6376, 7831, 0, 8373, 0, 0, 0, 0, 0, 6416, 0, 2080, 0, 0,
+	0, 0, 0, 5712, 0, 0, 507, 0, 7902, 0, 0, 0, 0, 0, 0, 9172,
+	0, 0, 0, 5868, 0, 0, 0, 2878, 0, 8217, 9489, 0, 3924, 0, 0, 0,
+	3063, 0, 9585, 1123, 0, 0, 6522, 0, 0, 0, 0, 8931, 3334, 0, 0, 0,
+	0, 0, 0, 0, 4761, 0, 472, 0, 0, 0, 0, 0, 0, 3830, 2567, 0,
+	8652, 0, 0, 0, 0, 0, 6501, 0, 0, 0, 0, 0, 0, 4937, 0, 0,
+	2459, 0, 0, 1516, 3424, 8741, 0, 0, 0, 9190, 0, 0, 0, 0, 8413, 0,
+	0, 0, 721, 0, 3821, 0, 8546, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7134, 6149, 0,
+	0, 0, 0, 0, 0, 0, 0, 2942, 5517, 0, 0, 0, 0, 0, 7905, 0,
+	0, 0, 4133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 621, 0, 0, 0,
+	0, 2792, 6802, 4329, 8289, 0, 4020, 0, 0, 517, 820, 0, 0, 0, 0, 0,
+	0, 0, 0, 5872, 0, 6232, 0, 0, 0, 0, 0, 1617, 0, 0, 0, 0,
+	4819, 0, 0, 0, 0, 105, 0, 0, 0, 0, 392, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5239, 0, 0, 9308, 3097, 0,
+	0, 0, 0, 2794, 0, 0, 0, 0, 214, 5466, 0, 0, 0, 6582, 0, 0,
+	0, 0, 2028, 2135, 0, 6406, 0, 3072, 0, 0, 9606, 245, 8506, 9218, 0, 0,
+	4045, 2437, 677, 0, 0, 0, 0, 0, 0, 8648, 0, 0, 0, 0, 4840, 0,
+	0, 0, 0, 0, 0, 0, 6991, 0, 0, 0, 0, 0, 6730, 0, 0, 1658,
+	3757, 980, 2555, 2088, 5297, 5531, 4960, 8913, 0, 0, 0, 0, 0, 9008, 0, 0,
+	4978, 0, 0, 0, 0, 0, 0, 3268, 0, 0, 5847, 0, 0, 0, 0, 0,
+	0, 7442, 8510, 0, 6688, 7976, 0, 11, 4313, 5777, 0, 0, 0, 0, 0, 0,
+	0, 3558, 5322, 0, 0, 0, 0, 5784, 0, 0, 0, 0, 0, 0, 0, 179,
+	5197, 0, 0, 8499, 0, 0, 7825, 2651, 8070, 0, 0, 0, 0, 0, 5335, 0,
+	0, 0, 0, 0, 2119, 0, 0, 8385, 0, 0, 0, 0, 0, 0, 5519, 9467,
+	1014, 0, 9019, 0, 0, 0, 0, 3280, 0, 3752, 0, 0, 1195, 0, 0, 0,
+	479, 0, 0, 0, 0, 0, 7483, 0, 0, 3025, 6887, 0, 0, 0, 1445, 0,
+	0, 0, 0, 0, 0, 0, 0, 6908, 927, 7095, 8679, 0, 0, 3505, 6880, 0,
+	0, 1677, 1931, 5746, 6744, 0, 0, 0, 0, 0, 0, 0, 6813, 0, 0, 0,
+	0, 0, 0, 0, 0, 3622, 4046, 5743, 7981, 8443, 8585, 0, 5812, 0, 0, 0,
+	0, 0, 0, 4432, 5035, 6405, 0, 0, 6485, 6860, 0, 8837, 1367, 0, 1349, 0,
+	7903, 9359, 0, 0, 3523, 0, 0, 0, 2787, 3148, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2277, 0, 7494, 0, 0, 5573, 0, 3031, 0, 0, 0, 0,
+	9380, 0, 0, 1222, 5056, 5995, 2828, 0, 0, 0, 0, 9379, 0, 0, 0, 7982,
+	0, 0, 0, 7997, 0, 0, 0, 3326, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 14, 0, 0, 1302, 0, 0, 0, 0, 0, 0, 0, 6607, 8920, 0,
+	0, 0, 6867, 583, 9336, 0, 0, 0, 0, 0, 0, 8139, 3855, 4423, 2350, 0,
+	0, 459, 0, 4471, 0, 0, 0, 1304, 3230, 3886, 0, 0, 2824, 0, 0, 0,
+	4218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6365, 346, 0, 0,
+	0, 4067, 6327, 0, 0, 7106, 0, 0, 0, 0, 0, 0, 0, 9685, 604, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 8729, 0, 0, 0, 169, 2688, 0,
+	4936, 7805, 0, 0, 0, 0, 0, 0, 0, 7559, 3261, 0, 0, 0, 6446, 0,
+	0, 0, 0, 0, 0, 0, 0, 4441, 0, 0, 9016, 0, 0, 0, 3114, 0,
+	1670, 0, 4122, 231, 7834, 0, 3987, 0, 0, 0, 0, 0, 2439, 1380, 0, 2446,
+	235, 3363, 0, 0, 5268, 0, 0, 1946, 0, 0, 0, 5069, 0, 0, 2089, 0,
+	0, 0, 0, 3790, 3819, 0, 0, 0, 209, 6384, 0, 0, 0, 0, 1656, 0,
+	0, 0, 6146, 7767, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5063, 6239, 5027, 0, 0, 0, 0, 9175,
+	0, 0, 0, 38, 0, 0, 2222, 73, 1052, 5253, 0, 0, 0, 0, 6088, 0,
+	0, 0, 367, 0, 0, 5402, 7571, 8720, 0, 1423, 6683, 0, 0, 5513, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8570, 0, 0, 892, 7685, 0, 5494, 0, 6761,
+	0, 9607, 0, 255, 6176, 5128, 0, 1741, 3395, 4575, 5476, 7109, 9224, 0, 0, 0,
+	433, 0, 9029, 3465, 0, 0, 0, 0, 0, 0, 7185, 0, 0, 0, 6048, 0,
+	0, 6648, 1151, 3191, 9261, 2106, 4589, 7706, 3129, 8947, 0, 0, 5941, 5377, 0, 6932,
+	4757, 0, 0, 0, 0, 0, 3568, 0, 0, 0, 0, 2321, 0, 0, 0, 0,
+	4727, 0, 0, 0, 0, 0, 0, 9265, 4348, 4645, 7468, 0, 0, 5326, 7330, 1480,
+	7838, 580, 7667, 3956, 8974, 0, 6084, 0, 0, 0, 0, 3303, 0, 0, 0, 5310,
+	8416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4097, 0, 0, 0, 0, 9408,
+	0, 1690, 0, 0, 0, 0, 0, 0, 3249, 7230, 4603, 8714, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7444, 0, 0, 7186, 0, 0, 0, 0, 0, 0,
+	7747, 2516, 3228, 1682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6612, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5835, 6726, 0, 0,
+	0, 0, 0, 0, 8740, 0, 0, 0, 0, 2568, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5444, 5198, 0, 0, 0, 0, 0, 5231, 0, 0, 6129, 0,
+	0, 3397, 5223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3972, 0, 8455,
+	0, 3227, 0, 0, 3887, 9402, 0, 0, 0, 4098, 0, 0, 0, 0, 0, 711,
+	0, 0, 0, 0, 0, 0, 2861, 2182, 0, 0, 5885, 0, 0, 0, 0, 4062,
+	0, 9095, 0, 0, 0, 0, 0, 0, 0, 1496, 5541, 0, 8368, 0, 1500, 3951,
+	6233, 9131, 236, 0, 0, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4483,
+	9565, 0, 0, 0, 8345, 0, 0, 556, 0, 0, 0, 0, 3489, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3621, 9155, 7091, 3727, 6877, 0, 0, 0, 0, 2607,
+	0, 0, 0, 0, 0, 1355, 6920, 0, 0, 0, 1525, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4985, 0, 0, 0, 0, 0, 0, 7198, 0, 4511, 9492,
+	0, 0, 0, 5076, 3292, 7061, 0, 0, 0, 4675, 6903, 6995, 4035, 0, 0, 0,
+	0, 0, 6104, 0, 5099, 0, 0, 2697, 5378, 5482, 3467, 2743, 0, 0, 3892, 8560,
+	1679, 0, 0, 0, 0, 0, 3234, 0, 0, 0, 6135, 7057, 7949, 0, 0, 0,
+	0, 0, 0, 0, 0, 7892, 0, 0, 0, 0, 0, 0, 0, 0, 1272, 0,
+	0, 0, 0, 0, 7904, 1325, 0, 0, 0, 4324, 7288, 0, 2270, 1666, 0, 966,
+	8108, 0, 9125, 9393, 2429, 0, 0, 0, 0, 0, 0, 0, 0, 5393, 0, 0,
+	0, 5536, 2211, 0, 0, 0, 0, 0, 9130, 0, 0, 9573, 0, 0, 6533, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4703, 8703, 0, 0, 9267, 0, 3052,
+	5577, 7492, 0, 0, 0, 0, 0, 0, 0, 0, 1708, 3749, 0, 0, 7301, 0,
+	0, 815, 6016, 7728, 933, 8210, 0, 0, 0, 5478, 8972, 0, 0, 0, 0, 0,
+	0, 0, 0, 480, 4697, 0, 0, 6899, 3740, 6370, 0, 0, 1474, 0, 0, 106,
+	0, 0, 0, 0, 0, 4995, 0, 0, 0, 350, 0, 7080, 0, 0, 0, 3594,
+	0, 0, 22, 0, 5702, 0, 0, 0, 865, 7597, 0, 0, 7335, 0, 0, 0,
+	0, 451, 8052, 0, 0, 2058, 6703, 4583, 0, 0, 0, 0, 7913, 0, 0, 0,
+	0, 0, 8321, 0, 0, 8873, 0, 0, 0, 0, 0, 0, 3045, 7841, 5272, 7344,
+	5559, 5169, 0, 0, 5159, 0, 0, 5598, 522, 4357, 0, 0, 0, 1667, 0, 0,
+	8018, 0, 0, 0, 0, 0, 0, 2586, 7163, 8892, 0, 0, 4211, 0, 0, 0,
+	0, 6917, 0, 1642, 3260, 1599, 0, 0, 0, 589, 0, 0, 6303, 9112, 0, 4291,
+	2110, 2498, 9502, 0, 6211, 4604, 0, 0, 1205, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 7607, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271,
+	0, 0, 0, 0, 0, 0, 8482, 0, 0, 1091, 5093, 5912, 0, 0, 0, 7027,
+	0, 0, 1145, 0, 0, 0, 7627, 8891, 0, 1630, 0, 0, 8993, 0, 0, 6015,
+	0, 3863, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4504, 167, 0,
+	0, 2603, 4597, 9361, 0, 0, 0, 0, 0, 0, 900, 3504, 0, 0, 9560, 1926,
+	0, 8707, 0, 0, 0, 4066, 4772, 0, 0, 0, 4826, 9196, 0, 6536, 8128, 0,
+	0, 0, 0, 0, 0, 0, 7159, 0, 0, 7631, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4958, 0, 0, 0, 0, 5332, 0, 0,
+	1439, 0, 6412, 0, 6249, 6965, 0, 0, 0, 3975, 2373, 1777, 3371, 8216, 0, 0,
+	0, 0, 3705, 400, 0, 863, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3687,
+	5008, 0, 0, 0, 0, 5113, 4812, 0, 0, 0, 0, 8909, 8310, 0, 0, 0,
+	0, 0, 0, 0, 0, 4341, 0, 0, 0, 0, 3487, 0, 0, 4074, 0, 0,
+	0, 0, 0, 2953, 3381, 0, 0, 0, 0, 0, 0, 0, 4121, 0, 0, 4197,
+	0, 0, 9524, 0, 7672, 0, 8686, 0, 0, 0, 0, 0, 0, 0, 0, 9586,
+	0, 0, 0, 9385, 0, 0, 0, 0, 0, 0, 0, 0, 772, 5873, 0, 3592,
+	0, 0, 0, 0, 0, 0, 0, 0, 8730, 0, 0, 0, 717, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7632, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3210, 0, 7608, 0, 0, 3313, 0, 0, 0, 0, 0,
+	710, 0, 0, 0, 0, 0, 1778, 0, 3903, 0, 0, 0, 2116, 0, 0, 0,
+	4210, 2587, 0, 0, 0, 0, 0, 0, 8512, 0, 0, 1649, 3380, 0, 0, 0,
+	0, 817, 0, 0, 0, 7040, 8659, 4559, 0, 6308, 0, 240, 0, 0, 3349, 0,
+	0, 0, 0, 0, 0, 1298, 5756, 0, 7897, 0, 0, 0, 0, 0, 0, 0,
+	5430, 0, 0, 0, 0, 0, 0, 0, 0, 7688, 2422, 5609, 0, 0, 4825, 0,
+	2374, 0, 149, 0, 0, 6421, 0, 5539, 0, 0, 0, 4224, 0, 8071, 0, 0,
+	0, 0, 0, 0, 6025, 0, 0, 0, 3388, 7356, 0, 0, 0, 0, 9531, 0,
+	0, 0, 0, 0, 3517, 0, 0, 5944, 0, 0, 0, 0, 0, 227, 0, 0,
+	0, 6351, 0, 1634, 2959, 9007, 0, 3908, 0, 0, 0, 812, 0, 0, 2313, 9277,
+	0, 0, 7121, 0, 3798, 1781, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	128, 1782, 0, 0, 453, 3764, 0, 0, 0, 0, 0, 0, 0, 2371, 0, 0,
+	0, 0, 0, 0, 0, 0, 816, 4678, 0, 1409, 3847, 0, 9198, 0, 0, 0,
+	0, 0, 0, 4367, 0, 0, 9462, 0, 0, 0, 0, 0, 0, 8411, 6787, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 534, 9659, 0, 0, 4360,
+	0, 0, 0, 0, 0, 0, 3304, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2935, 0, 0, 0, 6694,
+	0, 0, 5300, 6086, 6301, 6555, 0, 0, 809, 5951, 0, 7860, 6670, 8984, 0, 9041,
+	0, 0, 2685, 0, 2673, 0, 4170, 4315, 7059, 1927, 8327, 0, 3209, 0, 0, 0,
+	0, 6729, 5552, 653, 2749, 5294, 3378, 8699, 9337, 0, 0, 0, 0, 9486, 0, 1783,
+	8448, 0, 0, 0, 424, 0, 0, 0, 247, 253, 0, 6680, 0, 4754, 6690, 1818,
+	7126, 0, 2155, 8412, 5229, 0, 0, 0, 0, 5094, 0, 0, 0, 0, 519, 4445,
+	0, 0, 0, 7049, 0, 0, 0, 6528, 0, 0, 0, 0, 0, 807, 0, 0,
+	7682, 0, 0, 0, 0, 0, 0, 0, 0, 2393, 0, 0, 0, 0, 0, 0,
+	781, 0, 0, 0, 53, 0, 0, 9599, 1790, 0, 3037, 0, 4922, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1384, 0, 0, 0, 0, 0, 0,
+	0, 0, 1733, 0, 0, 0, 0, 0, 0, 0, 4055, 1498, 5957, 0, 0, 0,
+	5381, 0, 8012, 9006, 0, 0, 8201, 0, 0, 0, 0, 0, 0, 5737, 6069, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1044, 3181, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8524, 1337, 0, 6835, 0, 0, 0, 8823, 0,
+	0, 0, 0, 0, 0, 0, 0, 6339, 1329, 0, 6483, 0, 3879, 6276, 8565, 0,
+	1934, 640, 0, 0, 6884, 0, 0, 0, 2807, 8140, 1780, 0, 9382, 0, 5499, 0,
+	0, 276, 0, 0, 0, 0, 4338, 391, 3546, 8617, 725, 0, 0, 2921, 2640, 3873,
+	7785, 0, 0, 0, 0, 0, 0, 3949, 0, 1415, 5678, 121, 0, 2554, 0, 0,
+	0, 3151, 0, 1619, 4340, 0, 1303, 0, 0, 0, 0, 3779, 1707, 0, 1805, 320,
+	0, 0, 1792, 0, 0, 0, 0, 0, 5593, 6387, 2107, 0, 0, 1903, 8701, 0,
+	0, 0, 0, 0, 8175, 0, 0, 0, 5074, 3862, 8713, 1006, 8819, 0, 0, 0,
+	0, 0, 0, 0, 834, 2212, 0, 4736, 0, 1785, 0, 0, 0, 0, 0, 0,
+	0, 3437, 7560, 5663, 0, 0, 0, 0, 0, 0, 0, 0, 3407, 6583, 4246, 0,
+	0, 0, 0, 0, 0, 0, 0, 3098, 4000, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7209, 0, 0, 0, 0, 0, 0, 3376, 0, 0, 0, 0, 0, 2963,
+	0, 0, 0, 5384, 8834, 0, 0, 0, 0, 4771, 0, 0, 226, 0, 0, 767,
+	2890, 5825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4297, 0, 0, 6508, 4314,
+	0, 0, 0, 8988, 1887, 0, 0, 651, 7664, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6292, 0, 0, 0, 4920, 805, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6681, 0, 2062, 2972, 0, 0, 5525, 0, 0, 6289,
+	0, 0, 0, 4127, 0, 7512, 0, 0, 0, 0, 0, 0, 0, 7188, 6381, 7423,
+	0, 4747, 2462, 0, 644, 676, 3507, 4897, 7885, 0, 0, 8638, 2179, 3515, 9148, 0,
+	8917, 0, 0, 0, 0, 0, 622, 3530, 6865, 0, 0, 0, 0, 9076, 0, 0,
+	19, 0, 0, 0, 0, 6758, 7184, 0, 0, 0, 0, 0, 7347, 0, 5989, 0,
+	0, 0, 0, 1501, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9590,
+	0, 5858, 0, 0, 0, 164, 6419, 0, 0, 4076, 5168, 0, 0, 0, 1019, 1102,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4942, 0, 0, 0, 0, 0, 0, 0, 0, 1499, 2302, 2845, 6550,
+	8193, 442, 361, 0, 0, 0, 782, 0, 0, 3003, 187, 3244, 0, 0, 0, 0,
+	0, 0, 4591, 0, 0, 0, 8732, 1975, 0, 0, 0, 0, 0, 0, 4043, 0,
+	0, 0, 0, 0, 3859, 3756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6801,
+	0, 0, 0, 0, 0, 6667, 0, 0, 0, 0, 0, 4566, 5724, 3991, 5984, 0,
+	0, 0, 7372, 9404, 0, 0, 0, 6369, 9684, 0, 0, 0, 0, 443, 4931, 0,
+	0, 0, 545, 0, 3784, 0, 0, 0, 3257, 3971, 6014, 0, 0, 0, 0, 1547,
+	2647, 0, 0, 0, 0, 3730, 0, 0, 0, 4713, 0, 0, 7875, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6871, 0, 0, 0, 0, 0, 0, 5636,
+	0, 0, 5848, 0, 0, 0, 0, 0, 0, 0, 9299, 0, 0, 0, 0, 0,
+	2572, 7945, 1611, 86, 5207, 0, 0, 6335, 0, 0, 0, 1143, 7910, 0, 0, 0,
+	65, 1486, 0, 1180, 0, 9051, 0, 0, 5192, 2085, 3657, 0, 0, 2777, 8183, 0,
+	0, 0, 0, 0, 0, 7289, 6480, 8131, 0, 0, 5479, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8344, 0, 0, 0, 0, 0, 0, 0, 0, 2465, 8437, 0,
+	0, 5068, 0, 0, 0, 312, 0, 0, 2854, 0, 0, 1260, 0, 0, 7596, 0,
+	0, 0, 0, 0, 8138, 0, 4811, 0, 0, 0, 0, 2146, 3314, 0, 0, 2774,
+	0, 7265, 0, 0, 0, 0, 0, 0, 0, 2826, 0, 0, 9473, 0, 1788, 0,
+	0, 4428, 2392, 0, 0, 1479, 9643, 4154, 6346, 0, 0, 0, 0, 0, 0, 0,
+	6959, 0, 0, 9075, 0, 0, 0, 0, 5686, 8035, 698, 5935, 2086, 63, 8017, 8794,
+	0, 1534, 0, 194, 8885, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 296,
+	5623, 0, 0, 0, 7308, 0, 0, 0, 2491, 434, 620, 0, 0, 0, 0, 5053,
+	579, 5042, 0, 0, 0, 0, 0, 7000, 0, 0, 0, 0, 0, 0, 0, 940,
+	0, 1969, 3853, 7938, 0, 0, 0, 602, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 8171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1789, 0, 0,
+	8808, 0, 0, 874, 0, 0, 0, 0, 9484, 0, 0, 4123, 0, 0, 0, 140,
+	4699, 5973, 0, 0, 0, 6829, 42, 0, 0, 0, 0, 3375, 0, 0, 0, 4115,
+	0, 0, 0, 0, 0, 5000, 0, 0, 3579, 0, 0, 3265, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2065, 0, 3302, 0, 0, 0, 0, 0, 6799, 0,
+	0, 0, 0, 4741, 0, 0, 0, 0, 7740, 9588, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3331, 0, 5610, 0, 0, 0, 0, 0, 0, 2076,
+	3648, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7738, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4565, 0, 0, 0, 6484, 0, 7502, 0, 0, 0, 5306, 252, 7036,
+	7187, 0, 0, 0, 0, 0, 763, 0, 2265, 0, 0, 0, 0, 0, 0, 0,
+	1893, 0, 9417, 0, 0, 0, 0, 3877, 0, 0, 0, 8208, 0, 0, 6281, 3485,
+	8319, 0, 0, 0, 0, 7139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5557, 5474, 0, 0, 0, 3367, 0, 0, 8971, 0, 0, 0, 0, 0, 5493, 0,
+	0, 0, 0, 0, 0, 4180, 5901, 0, 0, 0, 0, 0, 4667, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9013, 0, 0, 0, 0, 0, 0, 0, 0,
+	3466, 3864, 3861, 0, 0, 0, 3344, 0, 0, 0, 0, 4895, 934, 1492, 0, 0,
+	0, 0, 3611, 0, 0, 0, 2892, 0, 0, 0, 0, 0, 3444, 6881, 1846, 2505,
+	8095, 0, 0, 0, 0, 780, 1128, 0, 7088, 0, 882, 5087, 7586, 7877, 0, 3171,
+	0, 0, 0, 0, 0, 0, 0, 4685, 5125, 0, 0, 127, 0, 0, 0, 0,
+	0, 8403, 1851, 4208, 4865, 8529, 0, 0, 7022, 4921, 8959, 0, 0, 0, 0, 4389,
+	0, 0, 806, 2983, 8361, 0, 0, 0, 0, 0, 0, 0, 0, 5086, 0, 0,
+	0, 4977, 0, 0, 0, 0, 5765, 0, 0, 4644, 4230, 0, 0, 0, 0, 0,
+	2862, 0, 0, 0, 0, 0, 0, 0, 0, 7792, 0, 6180, 32, 3410, 0, 0,
+	0, 0, 4968, 0, 0, 0, 0, 0, 0, 0, 7679, 5908, 6724, 0, 0, 0,
+	0, 0, 3342, 0, 0, 0, 0, 5002, 6709, 0, 0, 6809, 0, 0, 0, 0,
+	0, 0, 0, 6000, 0, 8575, 0, 1391, 0, 0, 3896, 0, 1987, 0, 0, 0,
+	0, 0, 0, 0, 0, 9662, 9325, 0, 0, 404, 0, 7783, 6003, 0, 628, 1178,
+	0, 80, 0, 5576, 1857, 7127, 8425, 0, 0, 0, 0, 0, 3403, 0, 0, 0,
+	0, 1793, 0, 0, 9630, 6320, 2776, 3167, 5606, 9564, 4052, 369, 7715, 0, 0, 0,
+	1242, 0, 0, 2908, 0, 0, 7225, 0, 0, 0, 0, 0, 4181, 9362, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7132, 389, 0, 0, 0, 223,
+	0, 0, 835, 0, 0, 824, 0, 5004, 8752, 0, 0, 1286, 4219, 0, 6993, 0,
+	0, 6869, 0, 0, 0, 0, 0, 0, 0, 0, 5937, 3359, 0, 0, 0, 0,
+	0, 7530, 0, 0, 0, 0, 0, 0, 3147, 0, 0, 6010, 0, 542, 5655, 0,
+	0, 0, 0, 6295, 7415, 457, 5913, 8594, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1624, 0, 0, 0, 4884, 0, 0, 0, 0, 2309, 0, 0, 0, 0,
+	0, 0, 303, 0, 0, 1139, 0, 0, 0, 0, 6819, 0, 6507, 9343, 9526, 0,
+	0, 0, 0, 1057, 0, 0, 0, 0, 0, 2765, 0, 0, 0, 0, 7868, 0,
+	0, 0, 0, 5496, 0, 0, 0, 0, 0, 0, 0, 3446, 6147, 8334, 9000, 0,
+	0, 8192, 7612, 0, 0, 0, 0, 2658, 0, 0, 0, 0, 0, 3279, 4002, 8495,
+	8248, 744, 1285, 3647, 4979, 2127, 4664, 1032, 3301, 6358, 8651, 9055, 0, 0, 2936, 4573,
+	0, 8335, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4647, 7164, 182, 3921,
+	2214, 4312, 8582, 4345, 9033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2441,
+	7467, 9698, 7655, 0, 0, 7306, 1484, 0, 0, 0, 0, 0, 8578, 2747, 0, 0,
+	9365, 0, 0, 0, 0, 0, 0, 4150, 0, 0, 0, 0, 5947, 9312, 0, 0,
+	0, 0, 0, 0, 51, 2602, 0, 0, 9548, 4202, 0, 0, 0, 1406, 0, 0,
+	2300, 183, 4019, 0, 0, 0, 0, 0, 0, 0, 8026, 4961, 4281, 0, 0, 0,
+	9037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5129, 0, 0, 0,
+	0, 0, 722, 3502, 6636, 3248, 7761, 0, 0, 0, 0, 0, 0, 9482, 0, 4257,
+	4272, 6423, 1030, 0, 0, 0, 9319, 0, 0, 1738, 9143, 0, 9035, 6971, 8728, 2898,
+	2700, 123, 5119, 5684, 0, 0, 8009, 0, 0, 0, 0, 5199, 0, 0, 552, 1051,
+	7138, 0, 0, 0, 0, 0, 2691, 0, 0, 0, 0, 0, 8475, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1413, 9690, 0, 6828, 0, 5782, 0, 0, 8695,
+	0, 2164, 2889, 0, 0, 0, 0, 0, 0, 0, 3571, 0, 15, 0, 4858, 0,
+	0, 9532, 0, 0, 0, 0, 7644, 0, 0, 8094, 0, 0, 0, 0, 0, 0,
+	5634, 0, 0, 0, 176, 0, 0, 1753, 0, 0, 0, 8914, 0, 5194, 0, 0,
+	0, 5179, 0, 8861, 4810, 3143, 8049, 0, 6035, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3698, 2608, 0, 0, 0, 0, 5376, 9483, 4217, 0, 0, 0,
+	8239, 0, 3004, 0, 0, 0, 0, 0, 8339, 1680, 6782, 6788, 0, 9609, 0, 0,
+	0, 0, 0, 2063, 4177, 6516, 6513, 6679, 6572, 8879, 0, 9675, 3060, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4161, 0, 2978, 0, 0, 0, 0,
+	0, 0, 0, 2796, 0, 0, 92, 4807, 2946, 0, 0, 0, 0, 0, 0, 0,
+	0, 3306, 0, 0, 2537, 0, 0, 0, 0, 5902, 0, 5009, 0, 1639, 8014, 2844,
+	6165, 6283, 0, 0, 0, 0, 0, 410, 0, 2593, 7427, 919, 0, 0, 9171, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 530, 6824, 0, 0,
+	0, 0, 0, 0, 7343, 8710, 0, 3839, 0, 0, 0, 0, 0, 6017, 0, 0,
+	0, 600, 0, 0, 0, 8905, 0, 3513, 0, 0, 0, 5352, 0, 0, 0, 0,
+	0, 0, 0, 0, 6637, 5771, 2582, 0, 0, 0, 0, 0, 0, 0, 7090, 0,
+	0, 4449, 0, 5509, 0, 0, 0, 0, 455, 5363, 8149, 8757, 0, 8177, 0, 0,
+	0, 0, 7581, 3498, 2905, 0, 0, 0, 8199, 5930, 0, 0, 0, 4169, 8374, 5147,
+	0, 0, 8572, 0, 1186, 0, 0, 0, 0, 0, 0, 0, 2876, 8893, 0, 0,
+	7283, 0, 0, 0, 0, 0, 4939, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 325, 9012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3755, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3607, 0, 0, 6891, 0, 0, 0, 0, 0, 0, 0, 7983, 0,
+	0, 0, 6825, 0, 0, 0, 0, 878, 0, 7012, 0, 0, 0, 0, 0, 7100,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9330, 4636, 0, 0, 0,
+	6126, 0, 0, 0, 0, 0, 0, 1985, 0, 4579, 4082, 0, 0, 9580, 0, 0,
+	0, 0, 0, 0, 0, 7736, 0, 0, 0, 8472, 0, 8557, 1148, 0, 0, 0,
+	8944, 0, 5398, 0, 0, 0, 0, 0, 0, 5681, 0, 4506, 0, 0, 0, 6400,
+	0, 7856, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1645, 1419,
+	7260, 0, 0, 4654, 0, 0, 0, 0, 0, 7174, 0, 0, 2948, 0, 0, 0,
+	0, 0, 2386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6496, 0, 0,
+	0, 2325, 0, 8763, 2471, 0, 8739, 0, 0, 0, 0, 0, 4299, 0, 0, 0,
+	4462, 2408, 5907, 6408, 0, 0, 0, 0, 2285, 0, 0, 420, 8797, 0, 8477, 0,
+	1867, 8733, 0, 0, 0, 0, 4184, 0, 0, 0, 0, 0, 0, 0, 4490, 9431,
+	0, 6059, 5637, 8494, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1980,
+	9622, 9164, 9496, 1275, 2694, 0, 0, 0, 0, 720, 9478, 0, 0, 0, 2496, 3564,
+	6645, 0, 8628, 6638, 0, 0, 0, 4970, 0, 0, 0, 0, 3936, 0, 1882, 2875,
+	0, 0, 2867, 0, 0, 0, 0, 0, 0, 0, 272, 3085, 9056, 3778, 9023, 0,
+	6121, 1537, 0, 0, 0, 0, 3130, 8761, 0, 0, 0, 0, 6713, 0, 0, 0,
+	0, 0, 0, 0, 0, 7734, 0, 0, 0, 0, 0, 0, 0, 670, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8515, 0, 0, 0,
+	0, 3973, 0, 0, 0, 7609, 0, 0, 0, 6329, 0, 2283, 3809, 0, 0, 4481,
+	0, 0, 0, 0, 7438, 0, 0, 0, 0, 0, 0, 0, 0, 5368, 0, 0,
+	0, 0, 0, 0, 0, 0, 854, 2255, 8302, 0, 0, 4788, 4964, 401, 0, 0,
+	0, 5892, 0, 0, 0, 0, 0, 0, 2675, 9058, 0, 0, 0, 7602, 0, 0,
+	0, 0, 0, 8595, 0, 0, 0, 0, 4473, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9022, 837, 0, 3429, 2478, 0, 0, 0,
+	0, 0, 0, 0, 0, 839, 9400, 5355, 6981, 2279, 0, 7436, 0, 0, 3140, 4190,
+	3432, 0, 0, 0, 0, 0, 0, 0, 0, 7320, 0, 0, 1511, 0, 6175, 8708,
+	0, 5045, 0, 0, 0, 0, 0, 0, 5437, 0, 0, 0, 0, 5662, 0, 9117,
+	0, 0, 0, 3204, 9021, 0, 1513, 435, 0, 0, 0, 853, 0, 0, 0, 6728,
+	0, 0, 0, 0, 0, 0, 0, 0, 9572, 0, 0, 0, 0, 2370, 0, 0,
+	0, 0, 4886, 0, 0, 0, 0, 0, 0, 0, 746, 0, 0, 0, 668, 5897,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2334, 0, 0, 8105, 7286, 5658,
+	0, 0, 8607, 5142, 6902, 0, 0, 0, 0, 0, 0, 8982, 0, 0, 3127, 0,
+	0, 95, 9287, 0, 0, 0, 985, 81, 3469, 4499, 3993, 6437, 4233, 0, 0, 0,
+	0, 5878, 1389, 0, 0, 0, 4517, 0, 172, 7590, 4151, 7787, 8801, 0, 0, 0,
+	0, 0, 3153, 3269, 4587, 0, 9641, 0, 0, 0, 0, 4945, 0, 0, 0, 3981,
+	0, 0, 6333, 0, 0, 0, 0, 0, 0, 0, 0, 1393, 6123, 0, 9018, 0,
+	0, 0, 0, 0, 0, 0, 3532, 0, 0, 0, 0, 0, 0, 0, 0, 4519,
+	0, 7044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1250, 4596,
+	1433, 1472, 4455, 6030, 0, 0, 7951, 0, 0, 0, 6201, 0, 0, 6489, 0, 0,
+	0, 0, 8382, 1928, 0, 3035, 0, 0, 0, 0, 0, 0, 0, 0, 9458, 0,
+	7558, 9071, 0, 3308, 0, 7711, 0, 8409, 3780, 6598, 0, 0, 0, 0, 0, 5875,
+	1058, 6094, 428, 7702, 2200, 0, 6958, 3362, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 8804, 0, 0, 4270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5608, 0, 0, 3120, 0, 0, 0, 8954, 2068, 0, 0, 0,
+	0, 0, 8042, 0, 511, 125, 0, 0, 8601, 5700, 0, 0, 0, 0, 36, 4988,
+	0, 0, 5321, 6472, 6502, 0, 0, 0, 7294, 0, 0, 0, 0, 1654, 8387, 0,
+	2099, 436, 0, 0, 0, 0, 0, 514, 0, 0, 5740, 0, 2758, 3208, 2591, 7013,
+	0, 5942, 1873, 2354, 0, 0, 0, 1468, 0, 0, 0, 0, 8469, 0, 0, 148,
+	6038, 7197, 0, 0, 0, 0, 0, 0, 0, 7847, 0, 1706, 1933, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9141, 3174, 0, 1648, 4108,
+	5127, 0, 0, 1010, 0, 0, 1292, 3927, 5603, 0, 0, 0, 0, 6482, 7103, 0,
+	0, 0, 0, 0, 0, 0, 7987, 0, 0, 3932, 0, 0, 7290, 0, 0, 0,
+	0, 0, 8441, 0, 5990, 0, 0, 0, 0, 6640, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1681, 2818, 0, 7403, 0, 0, 3669, 0, 0,
+	0, 3522, 0, 0, 0, 0, 9192, 0, 1177, 5181, 0, 0, 0, 0, 4915, 7248,
+	0, 1910, 8711, 0, 0, 0, 0, 0, 0, 0, 1655, 9119, 0, 0, 0, 4940,
+	0, 3016, 0, 0, 0, 7922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6481, 0, 8202, 0, 0, 0, 0, 0, 0, 0, 0, 3032, 0, 0, 0, 0,
+	4274, 0, 2460, 5761, 6139, 9391, 8187, 7210, 9692, 0, 0, 0, 0, 0, 0, 0,
+	8962, 8347, 0, 0, 7429, 0, 5701, 0, 7201, 0, 0, 90, 0, 7261, 0, 0,
+	0, 4783, 9386, 0, 0, 0, 0, 1970, 3333, 0, 2811, 3643, 4525, 0, 0, 0,
+	4453, 6223, 0, 0, 0, 0, 0, 811, 631, 0, 0, 0, 0, 0, 9434, 6066,
+	0, 0, 3516, 3795, 5379, 5391, 0, 0, 0, 0, 0, 0, 2689, 0, 0, 5441,
+	5504, 0, 0, 7570, 0, 8038, 0, 1791, 0, 0, 2617, 0, 0, 0, 0, 0,
+	3598, 0, 0, 0, 0, 898, 0, 0, 0, 0, 0, 3352, 0, 0, 3854, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5480, 1784, 3131, 883, 7364, 0, 0,
+	0, 0, 0, 0, 0, 0, 5411, 4510, 9696, 2426, 0, 0, 0, 7451, 0, 9481,
+	0, 0, 0, 8814, 0, 0, 0, 3022, 0, 0, 0, 0, 6635, 9671, 0, 0,
+	0, 0, 0, 0, 0, 8965, 0, 0, 0, 1176, 7177, 7005, 0, 0, 8296, 3391,
+	0, 9395, 0, 1816, 0, 0, 0, 0, 136, 0, 0, 0, 1740, 6700, 0, 0,
+	0, 370, 0, 1688, 9285, 0, 0, 0, 0, 0, 0, 9183, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3711, 0, 0, 6868, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5814, 9491, 1491, 5334, 0,
+	0, 0, 1115, 8312, 0, 0, 0, 0, 4330, 6756, 0, 0, 0, 0, 0, 8268,
+	7459, 0, 280, 0, 0, 0, 3573, 1225, 0, 0, 0, 833, 6689, 0, 7016, 0,
+	946, 0, 0, 0, 0, 0, 1992, 0, 0, 0, 570, 0, 0, 0, 4390, 7115,
+	0, 7691, 0, 671, 3332, 0, 0, 0, 3473, 0, 1699, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 9165, 0, 0, 0, 0, 0, 6682, 0, 0, 0, 0, 0,
+	1441, 0, 0, 0, 0, 0, 0, 0, 8251, 0, 9323, 0, 0, 0, 339, 0,
+	0, 6739, 0, 0, 0, 3745, 0, 481, 7650, 0, 0, 0, 0, 0, 3820, 6994,
+	0, 219, 4466, 0, 0, 4706, 2985, 0, 3426, 0, 0, 0, 0, 7653, 0, 0,
+	4003, 0, 7469, 0, 0, 2519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5668,
+	0, 0, 0, 3013, 0, 0, 6153, 0, 0, 0, 8642, 0, 0, 3415, 7993, 0,
+	0, 0, 0, 4040, 0, 0, 0, 0, 0, 0, 0, 4486, 4690, 0, 0, 0,
+	0, 0, 0, 923, 6377, 0, 0, 0, 4008, 0, 0, 2362, 7540, 0, 956, 0,
+	7522, 0, 0, 0, 8197, 0, 0, 0, 3870, 0, 0, 0, 0, 7936, 0, 0,
+	0, 2925, 0, 0, 804, 9545, 3728, 0, 4414, 93, 9372, 0, 0, 0, 5105, 8610,
+	0, 0, 5857, 0, 0, 0, 0, 0, 2447, 0, 585, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9619, 0, 543,
+	0, 8815, 9645, 1470, 0, 8605, 0, 1326, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 215, 267, 0, 2060, 3102, 0, 0, 0, 484, 1351, 0, 0, 0, 0, 8770,
+	1675, 0, 0, 0, 0, 0, 0, 0, 0, 2443, 9550, 0, 0, 9673, 0, 0,
+	0, 0, 3172, 0, 0, 0, 1073, 0, 0, 0, 0, 0, 0, 0, 826, 7232,
+	0, 8694, 0, 7960, 0, 2966, 8179, 0, 0, 1922, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4491, 0, 0, 0, 0, 1541,
+	2683, 0, 0, 0, 0, 1994, 0, 0, 0, 0, 3872, 1041, 5228, 0, 0, 110,
+	0, 0, 5043, 0, 9653, 0, 0, 0, 0, 0, 0, 0, 0, 3438, 3483, 0,
+	6775, 0, 5182, 0, 2521, 0, 1110, 8955, 7623, 8883, 0, 0, 0, 0, 3910, 0,
+	0, 3020, 0, 0, 8813, 4328, 0, 0, 5206, 0, 0, 8064, 0, 0, 0, 0,
+	0, 6103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1062, 0, 0, 0, 0, 0, 0, 8480, 0, 0, 0, 0, 2511, 1000, 2644, 4277,
+	5734, 0, 0, 1076, 793, 0, 0, 0, 126, 5149, 4102, 8669, 0, 0, 0, 0,
+	0, 0, 2278, 0, 0, 0, 0, 0, 9498, 0, 0, 0, 5018, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1587, 0, 1544, 8948, 0, 4051, 0, 2033, 5243, 0,
+	0, 876, 5776, 656, 2291, 9318, 0, 0, 3100, 0, 0, 0, 0, 0, 0, 2045,
+	3263, 0, 0, 0, 1775, 6982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4817, 4657, 0, 1776, 6748, 0, 7698, 8163, 8568, 0, 0, 0, 0, 4641, 0, 0,
+	0, 2692, 0, 6672, 0, 0, 1843, 0, 0, 0, 0, 0, 845, 3073, 4415, 0,
+	5939, 525, 0, 0, 6194, 6128, 0, 6949, 0, 0, 3394, 0, 0, 0, 0, 0,
+	0, 0, 1993, 0, 0, 4750, 0, 0, 1646, 2221, 0, 5462, 7640, 0, 0, 0,
+	0, 967, 5553, 0, 0, 0, 0, 8323, 0, 3082, 0, 0, 0, 0, 3514, 0,
+	9700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5273, 0, 0, 0, 0, 0, 4672, 2336, 7594, 394, 5970, 0,
+	0, 0, 2435, 0, 0, 0, 0, 0, 0, 0, 0, 6185, 0, 6906, 0, 0,
+	0, 0, 9291, 0, 3152, 0, 0, 0, 4605, 0, 2988, 0, 664, 0, 0, 0,
+	0, 9027, 4065, 6137, 0, 7003, 0, 0, 0, 7626, 1046, 0, 0, 0, 0, 7298,
+	0, 0, 0, 6987, 0, 0, 0, 0, 0, 8497, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8279, 7116, 0, 0, 6311, 0, 0, 8160, 0,
+	0, 0, 0, 0, 5443, 266, 2850, 0, 0, 0, 0, 6815, 0, 0, 0, 0,
+	0, 0, 0, 9191, 0, 0, 0, 7346, 0, 1274, 0, 3119, 0, 7798, 9161, 0,
+	0, 467, 0, 1554, 0, 5922, 0, 0, 3824, 0, 0, 7496, 8457, 0, 0, 0,
+	0, 0, 0, 1939, 0, 0, 0, 9533, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6107, 9185,
+	0, 0, 3115, 5880, 6385, 6564, 0, 0, 0, 0, 0, 0, 0, 0, 3238, 0,
+	0, 0, 0, 0, 0, 0, 8977, 0, 0, 1339, 0, 1539, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2723, 8421, 0, 0, 0, 8325, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5638, 1845,
+	2663, 0, 0, 1493, 0, 0, 0, 0, 0, 0, 0, 9394, 2855, 4093, 1865, 0,
+	0, 0, 0, 0, 0, 1835, 3242, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9081, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3527, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2573, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8267, 4216, 1636, 9025, 3079,
+	0, 0, 0, 0, 939, 2745, 959, 8760, 3353, 9472, 0, 0, 6998, 0, 0, 0,
+	0, 6687, 0, 4660, 0, 5485, 0, 0, 0, 0, 0, 0, 0, 8973, 2461, 0,
+	0, 0, 0, 0, 0, 3377, 0, 0, 6323, 0, 0, 0, 9220, 9231, 1572, 7305,
+	0, 4683, 0, 9549, 1153, 0, 7297, 0, 0, 0, 0, 0, 6574, 0, 0, 0,
+	1048, 0, 0, 0, 0, 6051, 0, 0, 0, 4498, 957, 6177, 5544, 7240, 7986, 0,
+	0, 0, 0, 5445, 0, 0, 0, 770, 0, 7957, 469, 0, 0, 0, 0, 0,
+	1907, 0, 0, 0, 5927, 0, 0, 4874, 0, 0, 4775, 1098, 0, 3457, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8263, 0, 0, 7977, 0, 5829,
+	9584, 6252, 0, 5863, 9384, 0, 0, 0, 0, 0, 0, 4054, 6900, 0, 0, 0,
+	0, 7537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7980, 0,
+	0, 0, 0, 0, 0, 0, 6844, 4214, 6171, 0, 0, 0, 0, 8350, 823, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4805, 0, 0, 0, 0, 0, 1862, 0, 0, 0, 0, 4643, 0, 0, 0,
+	0, 0, 0, 0, 0, 1467, 0, 3370, 2005, 0, 0, 8346, 0, 0, 0, 0,
+	7112, 0, 2868, 244, 0, 1620, 8125, 6317, 0, 0, 0, 0, 0, 9004, 0, 3811,
+	0, 0, 0, 0, 1251, 0, 0, 0, 0, 0, 4350, 6078, 8827, 0, 0, 3716,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5232, 0, 1170, 330, 6759, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2518, 3983, 1126, 5945, 7045, 5349,
+	4424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 8406, 0, 0, 0, 0, 0, 0, 2665, 0, 2598, 0,
+	0, 1124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2351, 0, 0, 1316, 4354, 5818, 0, 0, 1017, 0, 0, 0,
+	0, 0, 0, 0, 0, 5475, 0, 0, 1053, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 378, 663, 5342, 0, 572, 1020, 0, 0, 0, 0, 0, 0, 0,
+	0, 548, 0, 0, 0, 4911, 0, 0, 0, 0, 0, 0, 1974, 23, 2365, 0,
+	0, 0, 0, 0, 0, 487, 0, 0, 6927, 1216, 0, 0, 5527, 0, 0, 7328,
+	0, 0, 3739, 5626, 0, 0, 0, 0, 8037, 0, 7123, 7409, 1824, 0, 0, 0,
+	0, 0, 0, 0, 0, 7340, 1581, 0, 1878, 0, 0, 1580, 0, 0, 0, 0,
+	0, 6415, 0, 0, 0, 5742, 0, 0, 0, 153, 0, 0, 2754, 114, 4910, 0,
+	0, 0, 0, 0, 975, 2872, 0, 8616, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3511, 1264, 838, 5085, 0, 0, 8471, 0, 6668, 0, 0, 0, 0,
+	0, 0, 0, 3583, 1163, 8452, 9497, 5647, 0, 0, 0, 4564, 0, 0, 0, 8681,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4830, 7405, 8868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 655, 2869, 6090, 0, 4813, 0, 0, 0, 0,
+	6293, 8025, 5083, 0, 0, 0, 1114, 0, 0, 2273, 0, 0, 4798, 0, 0, 0,
+	0, 5855, 0, 2257, 0, 9335, 0, 8930, 0, 0, 0, 0, 0, 0, 1490, 5096,
+	8414, 962, 0, 0, 0, 3355, 0, 9640, 0, 4388, 0, 0, 0, 0, 0, 0,
+	0, 8401, 0, 6649, 0, 1279, 0, 0, 0, 0, 4759, 0, 8530, 0, 6942, 0,
+	0, 0, 0, 0, 0, 3285, 0, 0, 0, 441, 0, 0, 0, 0, 0, 8253,
+	3316, 7449, 0, 9594, 704, 0, 0, 0, 1743, 7628, 7281, 0, 0, 0, 0, 0,
+	0, 9569, 0, 0, 0, 0, 0, 9072, 0, 3024, 0, 0, 0, 0, 0, 2022,
+	6924, 0, 4980, 9313, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 840, 0,
+	0, 1421, 0, 0, 3402, 138, 3925, 4572, 0, 0, 0, 0, 0, 0, 2870, 4694,
+	0, 0, 0, 8359, 0, 5524, 0, 0, 0, 0, 0, 0, 0, 4552, 9281, 0,
+	0, 3076, 0, 0, 0, 7259, 0, 0, 6125, 0, 0, 0, 0, 0, 0, 7827,
+	0, 0, 0, 9009, 0, 1594, 0, 0, 0, 3769, 0, 0, 0, 8342, 7161, 0,
+	0, 0, 0, 0, 0, 0, 0, 2213, 0, 1618, 0, 954, 9582, 0, 5224, 7282,
+	1560, 0, 0, 2814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7622, 0, 0, 0, 0, 0, 0, 5887, 0, 5465, 0, 0, 0,
+	0, 3101, 9249, 2122, 0, 0, 0, 3399, 3979, 334, 5062, 8033, 0, 0, 0, 7985,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8690, 275, 0, 0,
+	8436, 9632, 0, 8843, 1663, 0, 0, 0, 0, 7725, 4784, 0, 0, 0, 0, 0,
+	7156, 6628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7229, 9104,
+	0, 0, 333, 5315, 0, 0, 5044, 0, 0, 0, 0, 1610, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6345, 1140, 6334, 0, 0, 6366, 0,
+	5139, 0, 5455, 0, 0, 7068, 0, 0, 0, 4452, 9011, 3061, 0, 1371, 0, 0,
+	0, 0, 4717, 2525, 0, 0, 0, 0, 0, 0, 141, 0, 0, 0, 0, 994,
+	6569, 0, 0, 1515, 0, 0, 0, 0, 0, 0, 2574, 0, 0, 0, 0, 733,
+	7931, 7153, 8509, 0, 9086, 0, 0, 0, 0, 0, 4395, 0, 0, 0, 0, 0,
+	0, 2111, 0, 0, 5041, 0, 0, 0, 0, 1306, 8538, 0, 7319, 0, 2073, 0,
+	1066, 463, 8320, 0, 0, 2234, 0, 2625, 5311, 6702, 0, 2539, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4638, 0, 2981, 3078, 0,
+	1045, 0, 0, 0, 0, 0, 0, 0, 7155, 0, 0, 0, 0, 3321, 4407, 4495,
+	0, 0, 0, 0, 0, 0, 873, 5226, 0, 0, 0, 4669, 0, 5424, 0, 5,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2003, 5185, 7658, 0, 0, 2823, 5240, 6488, 7568, 0, 0, 0,
+	0, 6652, 0, 0, 414, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2177, 0, 0, 0, 0, 0, 0,
+	0, 6044, 0, 0, 0, 0, 0, 0, 0, 1293, 0, 8899, 0, 0, 0, 2118,
+	0, 0, 0, 1328, 0, 0, 8226, 0, 0, 0, 0, 0, 9567, 0, 0, 0,
+	0, 2546, 4041, 0, 0, 0, 0, 6907, 0, 0, 3033, 0, 0, 1024, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1239,
+	2294, 6544, 6901, 0, 0, 6429, 0, 0, 0, 3569, 0, 0, 0, 0, 1633, 6451,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2751, 0, 4236, 6001, 0, 0,
+	9088, 0, 0, 0, 0, 1872, 2153, 2216, 2319, 5452, 6577, 4323, 774, 4835, 0, 0,
+	0, 7341, 0, 0, 0, 0, 4207, 0, 4234, 0, 0, 0, 0, 0, 0, 0,
+	0, 2732, 6073, 4078, 5558, 9223, 151, 0, 0, 0, 0, 0, 0, 0, 0, 6623,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7267, 3293, 4422, 4639, 5705, 7829, 4064,
+	5269, 0, 0, 0, 0, 0, 0, 4849, 1256, 8519, 9258, 0, 6684, 0, 0, 5333,
+	0, 4063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1387,
+	0, 536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1524, 5170,
+	5193, 0, 0, 0, 0, 0, 6328, 0, 0, 0, 0, 0, 8933, 0, 0, 0,
+	466, 3161, 6632, 0, 0, 0, 0, 0, 0, 4740, 0, 1545, 0, 0, 0, 8736,
+	0, 0, 0, 0, 6041, 0, 0, 9392, 0, 0, 0, 0, 0, 0, 8737, 0,
+	0, 0, 0, 0, 624, 0, 0, 0, 0, 0, 0, 0, 0, 364, 0, 0,
+	0, 0, 0, 0, 0, 0, 2630, 0, 0, 0, 0, 0, 0, 0, 1967, 6822,
+	0, 0, 0, 0, 5260, 0, 0, 0, 94, 0, 7557, 0, 0, 0, 0, 0,
+	3982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 551, 7166, 0, 0, 0,
+	6705, 2074, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2289, 4025, 0, 0,
+	0, 0, 4554, 0, 0, 0, 0, 7413, 3881, 5205, 0, 6411, 6568, 0, 3239, 6534,
+	8878, 8970, 0, 0, 0, 0, 0, 0, 0, 4132, 4864, 0, 2477, 2414, 4096, 0,
+	0, 0, 0, 6786, 0, 0, 0, 5966, 0, 0, 0, 0, 0, 7490, 0, 0,
+	0, 0, 0, 0, 1093, 0, 0, 5798, 0, 0, 454, 2661, 7412, 7422, 0, 5282,
+	0, 0, 0, 0, 606, 8666, 7819, 8141, 0, 0, 0, 0, 6250, 0, 726, 4871,
+	0, 0, 0, 1687, 8593, 0, 0, 0, 0, 6845, 0, 0, 0, 0, 0, 2466,
+	0, 0, 0, 0, 4024, 1758, 0, 9118, 0, 0, 0, 0, 1228, 5933, 8304, 0,
+	0, 0, 0, 4189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6978, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4044, 0, 0,
+	0, 6442, 945, 2361, 7772, 0, 0, 5162, 0, 0, 0, 0, 8020, 0, 0, 2804,
+	7561, 7611, 0, 0, 0, 0, 1159, 5856, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6606, 0, 8198, 0, 0, 0, 0, 0, 0, 0, 0,
+	3434, 9596, 0, 2169, 0, 0, 0, 2724, 0, 1530, 0, 3961, 3965, 0, 0, 1394,
+	0, 0, 8887, 0, 0, 0, 0, 0, 3706, 2764, 0, 0, 0, 0, 0, 0,
+	0, 3413, 7964, 0, 0, 1265, 0, 0, 0, 0, 0, 0, 0, 0, 3044, 8762,
+	0, 0, 0, 0, 0, 0, 5751, 2314, 4646, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2037, 4091, 0, 0, 1652, 4981, 0, 0, 0, 8846, 0, 0, 0, 0,
+	295, 319, 0, 3177, 0, 4540, 3729, 7700, 0, 0, 0, 7001, 0, 0, 0, 0,
+	1822, 0, 0, 0, 2384, 0, 0, 0, 5395, 0, 7063, 0, 8306, 0, 0, 0,
+	2280, 0, 7392, 8981, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2117, 6706, 5337, 8126, 0, 0, 0, 0, 0, 0, 9559, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2636, 3287, 5280, 0, 0, 0, 7384, 0, 0, 0, 1686,
+	0, 0, 0, 8768, 0, 0, 0, 3676, 7802, 1998, 8137, 0, 8181, 3255, 0, 4247,
+	4894, 0, 0, 0, 0, 0, 0, 57, 5120, 0, 0, 0, 0, 0, 2333, 44,
+	7566, 0, 0, 4543, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6552, 9034,
+	4016, 0, 0, 6145, 0, 6443, 0, 4595, 0, 0, 3002, 0, 0, 0, 0, 0,
+	0, 351, 0, 0, 0, 2968, 8041, 4953, 7550, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2203, 5134, 8237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8030, 0,
+	0, 0, 0, 0, 0, 904, 2326, 0, 3794, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6188, 1204, 2578, 0, 2919, 9656,
+	0, 6839, 0, 0, 0, 9039, 0, 0, 0, 8429, 3497, 0, 0, 0, 0, 2151,
+	0, 0, 0, 7909, 2035, 0, 0, 0, 0, 0, 0, 0, 9415, 0, 9387, 0,
+	0, 8569, 3386, 0, 0, 0, 2504, 0, 0, 0, 8980, 1732, 0, 0, 0, 2783,
+	0, 0, 0, 3766, 0, 0, 1623, 0, 0, 0, 0, 0, 0, 0, 0, 9042,
+	0, 0, 0, 0, 0, 0, 0, 0, 8048, 7385, 7681, 0, 5339, 0, 0, 0,
+	0, 0, 4237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3709, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 8219, 5116, 0, 5547, 0, 0, 0,
+	0, 4275, 0, 1040, 5566, 0, 0, 4391, 6549, 8489, 6247, 0, 0, 0, 538, 3682,
+	0, 0, 9005, 0, 0, 0, 0, 0, 0, 794, 0, 1714, 1296, 0, 0, 1157,
+	0, 9441, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4532, 0, 0, 0, 0, 0, 0, 2955, 0, 0, 6776, 0, 473, 1759, 9651, 0,
+	3953, 0, 0, 0, 0, 0, 7190, 0, 9407, 5811, 6468, 0, 0, 1092, 5375, 27,
+	7754, 9506, 2920, 4311, 9556, 0, 0, 0, 0, 0, 5522, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 9320, 1476, 7140, 5891, 0, 0, 0, 0, 1854, 3322, 0, 7641,
+	0, 0, 0, 0, 0, 2139, 0, 0, 0, 0, 0, 0, 0, 1434, 0, 9349,
+	0, 0, 0, 133, 9297, 0, 3649, 0, 0, 5132, 8672, 0, 0, 0, 0, 0,
+	0, 0, 5460, 0, 0, 0, 3602, 714, 0, 0, 5417, 0, 0, 2941, 0, 0,
+	0, 0, 336, 5367, 0, 718, 0, 0, 0, 5385, 0, 0, 0, 0, 0, 0,
+	4401, 0, 0, 0, 0, 0, 0, 6193, 0, 0, 0, 5583, 0, 0, 0, 4175,
+	5390, 1129, 0, 0, 8896, 5079, 0, 0, 1042, 5200, 0, 0, 2643, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9691, 0, 7085, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3253, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2029, 2487, 287, 3400, 0, 0, 0, 0, 0, 5948, 0, 0, 0, 2853, 6609,
+	8656, 0, 0, 0, 0, 0, 0, 0, 2893, 0, 0, 0, 0, 4173, 0, 0,
+	0, 0, 77, 4594, 0, 4841, 7250, 0, 2672, 0, 397, 5725, 1864, 0, 0, 0,
+	7189, 5972, 0, 9068, 0, 0, 1749, 3449, 0, 0, 0, 1517, 0, 9239, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6169, 0, 1, 0, 8781, 0, 0, 0, 0,
+	0, 0, 0, 2490, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1432, 4103,
+	8074, 0, 0, 0, 0, 1890, 0, 4198, 0, 0, 0, 0, 0, 0, 0, 0,
+	3270, 0, 0, 0, 0, 9203, 0, 0, 0, 0, 0, 0, 3258, 669, 0, 0,
+	0, 0, 0, 4862, 6674, 0, 0, 0, 0, 0, 0, 0, 4843, 0, 0, 1146,
+	288, 5962, 9069, 0, 6206, 0, 0, 0, 8902, 0, 0, 0, 0, 0, 0, 0,
+	9528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7327, 0, 1071, 1983, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4325, 0, 0, 3813, 0, 0,
+	9356, 5791, 9290, 0, 0, 0, 4851, 5484, 0, 560, 4687, 0, 3417, 1944, 9103, 1571,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 270, 0, 0, 9142, 0, 5572, 0,
+	4039, 0, 0, 0, 7836, 0, 2579, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4430, 0, 0, 0, 5121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5987, 7992, 8148, 8553, 8243, 0, 0, 0, 7178, 0, 1403, 4586, 5843, 5735, 8447, 9240,
+	124, 180, 9339, 7006, 0, 0, 0, 0, 0, 697, 7354, 2976, 6297, 0, 0, 0,
+	0, 0, 7748, 2094, 3906, 0, 0, 0, 0, 0, 0, 4142, 9566, 9529, 0, 0,
+	9209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6750, 6841, 9151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4047,
+	0, 6270, 0, 0, 0, 0, 6068, 0, 0, 0, 0, 0, 0, 0, 0, 331,
+	1119, 0, 0, 0, 0, 0, 2484, 3425, 5487, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8523, 699, 4139, 4541, 7113, 0, 0, 0, 0, 2822, 0, 5468,
+	7593, 1375, 666, 0, 0, 6397, 3393, 0, 0, 0, 3566, 0, 232, 0, 1171, 6248,
+	0, 0, 0, 4728, 0, 0, 5277, 3074, 0, 4260, 0, 9303, 0, 0, 0, 8324,
+	491, 0, 1182, 0, 0, 0, 0, 3978, 0, 0, 1613, 0, 0, 0, 0, 0,
+	1819, 974, 425, 1465, 2996, 9474, 0, 7193, 0, 0, 8675, 0, 0, 0, 0, 3787,
+	218, 0, 0, 0, 0, 0, 0, 0, 0, 7984, 0, 0, 0, 6435, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6941, 7050, 0, 0, 0,
+	0, 2159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	614, 0, 0, 0, 0, 0, 0, 0, 0, 1061, 3911, 1745, 0, 0, 0, 0,
+	0, 0, 0, 7567, 0, 0, 1640, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2715, 8854, 0, 0, 0, 104, 7750, 0, 0, 7817, 0, 0, 0, 0,
+	0, 0, 1425, 6619, 5155, 412, 8983, 0, 0, 0, 0, 0, 5828, 0, 8621, 2087,
+	0, 1179, 0, 0, 0, 0, 0, 0, 2102, 0, 0, 0, 0, 0, 2918, 0,
+	9139, 0, 5622, 0, 0, 0, 2839, 0, 5551, 61, 0, 0, 0, 7532, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6209, 5925, 0, 7307, 0, 0, 0, 0, 8662, 0, 0, 0, 0,
+	5046, 0, 0, 7547, 0, 5871, 1039, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 8855, 754, 2136, 0, 0, 0, 0, 7541, 0, 0, 0, 1142, 0, 0,
+	0, 0, 0, 5436, 0, 0, 0, 0, 56, 6976, 0, 0, 0, 0, 3015, 0,
+	0, 0, 0, 0, 2606, 0, 0, 0, 8895, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4077, 0, 7387, 0, 0, 6255, 3340, 0, 4873, 0, 788, 2448, 0,
+	0, 0, 0, 9272, 0, 0, 0, 0, 0, 0, 973, 5591, 6390, 1340, 6487, 0,
+	0, 5327, 0, 0, 0, 0, 1917, 0, 0, 2881, 0, 0, 8615, 9106, 9219, 6425,
+	0, 0, 7527, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5516, 0, 8567,
+	131, 5775, 1023, 2956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3083,
+	0, 0, 0, 0, 0, 5774, 0, 2329, 2762, 8618, 0, 6773, 0, 3744, 0, 0,
+	7999, 0, 0, 0, 0, 0, 4213, 0, 4842, 0, 0, 0, 0, 0, 4989, 9067,
+	0, 0, 0, 4974, 3496, 0, 0, 3274, 0, 0, 9443, 0, 0, 0, 6224, 9587,
+	0, 0, 0, 0, 3644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2252, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 549, 1037, 0, 4904, 0, 0, 0, 0, 0, 8496, 0, 0, 0, 0, 0,
+	2538, 485, 0, 0, 1831, 3283, 0, 5201, 0, 0, 0, 0, 0, 0, 6154, 0,
+	0, 88, 16, 5832, 277, 4302, 5144, 2191, 1248, 4745, 7389, 0, 0, 0, 0, 0,
+	0, 0, 5808, 9107, 0, 0, 6770, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9562, 0, 6315, 0, 0, 0, 0, 0, 0, 0, 7918,
+	0, 0, 0, 7358, 0, 0, 0, 0, 0, 5161, 5343, 0, 0, 0, 2734, 5950,
+	6542, 0, 0, 0, 1001, 0, 4949, 0, 0, 0, 5472, 7808, 0, 0, 0, 4548,
+	3633, 0, 0, 0, 5694, 0, 0, 0, 3271, 0, 0, 0, 0, 0, 0, 0,
+	0, 5932, 6861, 4809, 0, 5293, 0, 0, 0, 0, 4369, 8880, 0, 0, 3829, 0,
+	0, 0, 0, 0, 2269, 3068, 0, 0, 9412, 0, 0, 0, 1105, 0, 0, 1577,
+	0, 8577, 1269, 0, 3240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4290, 0, 0, 7946, 0, 2534, 3637, 1825, 6590, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6685, 0, 1144, 0, 0, 0,
+	0, 0, 0, 0, 3688, 5459, 0, 0, 0, 8835, 6111, 0, 1557, 0, 0, 0,
+	0, 5073, 6436, 0, 0, 0, 2616, 3720, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 297, 799, 0, 0, 0, 8748, 0, 0, 1943, 3805, 0, 0, 0, 0,
+	0, 6911, 1300, 5770, 0, 5156, 0, 0, 0, 0, 2753, 1826, 675, 5022, 2120, 9317,
+	0, 0, 0, 0, 7705, 5274, 0, 0, 8898, 0, 0, 0, 0, 0, 0, 0,
+	0, 7303, 0, 0, 0, 0, 5394, 0, 0, 0, 0, 0, 0, 162, 2090, 0,
+	6087, 0, 0, 0, 7670, 0, 1217, 0, 0, 0, 0, 0, 0, 6946, 9577, 0,
+	0, 0, 8591, 0, 0, 8420, 0, 0, 3553, 0, 0, 9212, 7302, 0, 0, 0,
+	0, 2798, 0, 0, 0, 0, 0, 0, 0, 0, 7524, 9193, 7915, 490, 0, 1915,
+	8631, 0, 0, 0, 5983, 0, 0, 0, 8566, 2563, 0, 4836, 3447, 0, 0, 3667,
+	0, 5954, 0, 0, 0, 0, 1258, 9232, 3722, 0, 0, 0, 0, 0, 0, 0,
+	8888, 1164, 0, 0, 0, 0, 0, 3723, 3251, 0, 2132, 0, 0, 0, 0, 0,
+	6432, 4088, 9105, 0, 0, 630, 0, 0, 0, 0, 492, 0, 0, 7181, 0, 0,
+	983, 0, 0, 0, 0, 0, 7249, 0, 0, 4378, 0, 8174, 196, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6600, 0, 6693, 638, 0, 3685, 0, 0, 7254,
+	0, 9421, 9598, 6461, 0, 1215, 5710, 7024, 0, 6497, 0, 0, 0, 0, 0, 8936,
+	0, 0, 7135, 0, 0, 3533, 5067, 0, 0, 0, 0, 0, 0, 0, 627, 0,
+	0, 0, 0, 0, 0, 122, 0, 9170, 7180, 0, 0, 1232, 8461, 4999, 1451, 0,
+	0, 0, 0, 7634, 0, 2887, 4997, 0, 0, 0, 0, 0, 0, 0, 0, 662,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3574, 5370, 6202, 1905, 6237, 0, 2201, 0, 0, 0, 6947, 0, 0, 2493, 0,
+	0, 0, 0, 0, 0, 0, 0, 681, 803, 5759, 0, 0, 0, 2317, 0, 6361,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3245, 8019, 1267, 0, 0, 0,
+	5489, 2949, 0, 0, 0, 4514, 0, 0, 0, 6348, 0, 0, 0, 0, 6614, 9680,
+	0, 7179, 9304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3724, 5055,
+	3668, 5820, 0, 0, 0, 0, 0, 0, 709, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4827, 0, 0, 9205, 0, 0, 365, 0, 8445, 0, 0, 250, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4955, 0, 0, 0, 1245, 0, 0,
+	0, 6527, 3575, 0, 0, 0, 0, 1003, 2183, 0, 2896, 6062, 9357, 0, 0, 0,
+	0, 0, 0, 0, 0, 8485, 0, 0, 0, 0, 0, 0, 5371, 1173, 3236, 4627,
+	0, 0, 7598, 5104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3701, 0, 0, 0, 0, 0, 6091, 8744, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6401, 7826, 8092, 0, 0, 6855, 0, 0, 0, 0, 0, 5140,
+	0, 0, 0, 0, 0, 0, 0, 2366, 8169, 0, 0, 0, 3398, 2415, 2254, 0,
+	1860, 0, 0, 4648, 7026, 0, 0, 7350, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1218, 0, 0, 0, 0, 9233, 5057, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 9213, 0, 0, 0, 9010, 7102, 6896, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 971, 2746, 3732, 7275, 8692, 0, 7863, 0, 0, 0, 0, 3170,
+	0, 0, 0, 0, 0, 7972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2001, 0, 0, 3726, 3788, 3223, 5446, 0, 0, 0, 0,
+	2105, 0, 0, 0, 6260, 0, 0, 4048, 0, 0, 0, 0, 0, 1959, 0, 0,
+	859, 899, 2713, 0, 0, 0, 4196, 0, 8904, 0, 0, 0, 0, 917, 0, 0,
+	0, 3310, 3011, 0, 0, 0, 6945, 0, 0, 0, 0, 0, 0, 0, 0, 937,
+	578, 60, 0, 0, 0, 0, 0, 0, 2123, 8090, 0, 0, 0, 0, 2284, 0,
+	8076, 0, 1856, 5914, 1598, 6747, 0, 0, 6318, 0, 0, 0, 0, 4136, 0, 8795,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2671, 0, 0, 0,
+	0, 7950, 5257, 0, 7507, 0, 0, 0, 0, 8309, 0, 1402, 0, 0, 0, 0,
+	0, 773, 0, 0, 5642, 0, 6356, 0, 5030, 0, 0, 0, 0, 0, 0, 0,
+	0, 7279, 0, 0, 6399, 0, 0, 1808, 9321, 0, 0, 0, 3894, 7790, 0, 0,
+	6537, 0, 0, 0, 0, 0, 5233, 0, 0, 0, 0, 0, 0, 2533, 0, 6653,
+	0, 0, 6379, 8758, 0, 0, 0, 5646, 0, 0, 9611, 0, 1531, 1600, 6466, 0,
+	0, 0, 0, 0, 0, 0, 3383, 0, 0, 0, 9578, 0, 4167, 0, 2420, 0,
+	0, 0, 0, 7823, 0, 7380, 4134, 0, 0, 7233, 0, 0, 0, 0, 0, 0,
+	3567, 1193, 4085, 0, 8407, 0, 1977, 0, 0, 0, 0, 0, 8358, 0, 6083, 0,
+	0, 2367, 6148, 0, 0, 4265, 0, 0, 2036, 0, 0, 7683, 0, 0, 0, 0,
+	2805, 0, 0, 0, 0, 0, 0, 4310, 5082, 0, 0, 0, 0, 0, 5301, 0,
+	0, 0, 0, 0, 0, 2585, 0, 6933, 0, 0, 0, 0, 4786, 0, 4513, 4987,
+	0, 7268, 9255, 1244, 6862, 0, 0, 8807, 0, 0, 0, 0, 0, 0, 0, 6675,
+	0, 0, 0, 3560, 4296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2750, 0, 0, 0, 7745, 0, 0, 0, 0, 0, 0, 1815, 4440, 5158, 0,
+	0, 727, 0, 9302, 0, 0, 0, 2903, 0, 7291, 0, 0, 2039, 0, 5693, 0,
+	2143, 2848, 5703, 9216, 0, 0, 5840, 3623, 0, 4185, 0, 0, 0, 6615, 7067, 0,
+	1185, 7846, 9398, 0, 0, 0, 6754, 0, 0, 0, 8150, 0, 8853, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2288, 0, 0, 0, 6219, 1820, 753, 3109, 1596, 728,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6065, 8816,
+	7837, 8246, 0, 4885, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2527, 7146, 1210,
+	0, 0, 0, 0, 6493, 9036, 0, 0, 0, 0, 0, 0, 8559, 0, 0, 4671,
+	4752, 0, 0, 0, 0, 0, 7878, 8182, 0, 2801, 0, 1168, 4710, 5578, 0, 9450,
+	0, 8536, 0, 0, 0, 0, 4089, 0, 7255, 0, 3093, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 8285, 0, 0, 0, 0, 1629, 3266,
+	6246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3092, 0, 0, 0, 4901, 0,
+	929, 5956, 0, 0, 0, 0, 0, 0, 0, 0, 1700, 0, 0, 0, 0, 665,
+	5488, 7924, 4362, 0, 0, 0, 5359, 0, 6772, 0, 5481, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7665,
+	2810, 3679, 9194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5420, 1323, 8059, 0,
+	5975, 5246, 5653, 6491, 0, 9256, 0, 0, 7656, 5581, 0, 0, 0, 1428, 3116, 0,
+	0, 9228, 0, 5031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8576,
+	0, 5903, 0, 6360, 6977, 0, 0, 0, 0, 3717, 0, 0, 8539, 6347, 0, 0,
+	0, 2852, 7104, 0, 0, 0, 0, 6986, 7199, 5790, 0, 0, 0, 0, 0, 0,
+	0, 0, 9442, 0, 0, 0, 0, 1612, 1627, 0, 0, 0, 6588, 0, 5920, 0,
+	0, 0, 0, 0, 9074, 0, 0, 2027, 0, 4284, 0, 0, 0, 0, 6151, 0,
+	0, 2699, 0, 0, 4172, 0, 0, 0, 0, 8196, 0, 0, 0, 0, 0, 3851,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9145, 0, 0, 3750, 8400, 0,
+	0, 0, 0, 0, 0, 6540, 0, 2421, 0, 0, 0, 928, 0, 0, 0, 7545,
+	0, 318, 1754, 9040, 2233, 1593, 0, 0, 0, 0, 0, 4227, 5621, 5330, 6659, 9243,
+	0, 6601, 0, 0, 0, 8934, 1906, 0, 0, 0, 0, 0, 0, 9020, 0, 0,
+	0, 9423, 0, 0, 9333, 9448, 242, 9208, 0, 3640, 0, 0, 0, 0, 0, 2770,
+	0, 8352, 0, 0, 0, 0, 1436, 0, 0, 0, 5313, 6595, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1243, 5674, 0, 0, 0, 0, 2991,
+	747, 750, 0, 6192, 7098, 0, 0, 0, 2708, 0, 0, 0, 0, 7848, 6229, 0,
+	0, 0, 9052, 0, 0, 0, 0, 8688, 0, 557, 6004, 8833, 4069, 0, 0, 0,
+	0, 918, 0, 0, 1625, 6113, 8277, 0, 0, 1056, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8389, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4073, 4203, 3018, 8000, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6398, 8842, 1691, 0, 0, 5052, 0, 0, 0, 0, 7362, 0, 0, 0, 0,
+	0, 0, 3959, 0, 1386, 0, 0, 3518, 0, 8200, 0, 0, 0, 0, 2649, 0,
+	0, 0, 444, 3994, 0, 0, 7425, 0, 972, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2914, 0, 0, 0, 0, 0, 0, 1494, 0, 0, 0, 0, 1979, 6989,
+	1750, 0, 9102, 0, 0, 0, 0, 0, 0, 0, 2267, 6105, 3561, 4186, 0, 905,
+	0, 0, 0, 0, 0, 0, 0, 6280, 689, 7256, 0, 0, 0, 0, 0, 0,
+	2128, 0, 0, 0, 7411, 390, 0, 908, 0, 0, 0, 7471, 0, 5709, 0, 0,
+	0, 0, 0, 715, 4457, 5255, 4914, 6538, 9188, 0, 0, 0, 0, 0, 0, 0,
+	8313, 0, 0, 0, 4026, 7686, 0, 1184, 3379, 0, 0, 9284, 9222, 0, 76, 1730,
+	0, 0, 6559, 0, 0, 0, 0, 0, 0, 0, 4229, 4015, 6095, 0, 0, 0,
+	0, 0, 0, 0, 3282, 5256, 0, 0, 0, 0, 0, 0, 2939, 0, 0, 0,
+	0, 0, 1352, 1160, 6434, 9057, 0, 0, 0, 3180, 0, 2348, 0, 0, 0, 0,
+	0, 0, 0, 0, 8552, 0, 8473, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6178, 0, 0, 0, 0, 8821, 0, 5238, 0, 0, 6266, 0, 0,
+	0, 0, 0, 1099, 0, 0, 5595, 6910, 0, 0, 0, 0, 0, 7676, 0, 0,
+	0, 0, 0, 4743, 5014, 0, 0, 0, 0, 371, 7182, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4916, 7633, 8704, 0, 1301, 5288, 0,
+	0, 0, 0, 0, 0, 0, 2901, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5165, 0, 0, 0, 0, 1573, 0, 8106, 3168, 0, 0,
+	0, 0, 0, 4932, 0, 7508, 0, 0, 0, 0, 0, 4332, 4790, 1236, 0, 0,
+	0, 0, 0, 8881, 1558, 6093, 0, 0, 1103, 0, 7033, 0, 0, 0, 262, 3776,
+	7148, 0, 836, 0, 0, 0, 0, 0, 0, 2943, 0, 0, 0, 0, 0, 0,
+	8091, 9546, 0, 0, 0, 9241, 3743, 0, 0, 652, 0, 0, 0, 0, 0, 8926,
+	0, 2831, 7657, 9140, 6040, 6723, 0, 0, 4496, 9683, 0, 1956, 0, 0, 1131, 8238,
+	0, 7314, 7906, 0, 71, 0, 0, 6830, 0, 0, 0, 0, 6997, 2474, 2583, 4226,
+	0, 9371, 8240, 0, 0, 2856, 2838, 0, 2124, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4833, 0, 0, 0, 4508, 0, 0, 0, 0, 0, 4567, 0, 0,
+	0, 0, 0, 0, 0, 0, 5058, 8391, 0, 0, 0, 8563, 0, 0, 0, 4614,
+	0, 0, 0, 0, 0, 0, 0, 0, 206, 0, 9215, 0, 0, 0, 6738, 0,
+	3110, 5567, 0, 4159, 9463, 0, 0, 0, 0, 1923, 0, 2368, 0, 1505, 0, 0,
+	8132, 3233, 2249, 0, 0, 0, 6722, 5981, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3540, 9618, 7087, 3597, 0, 822, 0, 0, 8886, 3133, 3692, 5152, 0,
+	0, 926, 5115, 0, 0, 0, 0, 6585, 0, 1291, 2969, 0, 0, 0, 7083, 0,
+	0, 0, 2217, 0, 0, 5698, 0, 0, 0, 0, 0, 0, 0, 1736, 4702, 0,
+	0, 5380, 0, 1968, 0, 0, 4337, 0, 0, 1059, 0, 0, 4416, 7111, 0, 0,
+	0, 0, 0, 0, 0, 0, 6055, 0, 0, 0, 9617, 0, 0, 0, 0, 1896,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6749, 0, 0, 7722,
+	7526, 9616, 1622, 2910, 0, 0, 0, 0, 2339, 0, 0, 0, 0, 7269, 2733, 6673,
+	0, 307, 0, 7386, 0, 0, 0, 4785, 0, 0, 0, 0, 0, 0, 0, 861,
+	0, 4071, 0, 5012, 0, 6968, 0, 0, 0, 5969, 0, 5805, 0, 0, 0, 0,
+	3689, 0, 0, 0, 6099, 0, 0, 0, 6134, 0, 0, 0, 0, 0, 7472, 0,
+	0, 0, 888, 0, 0, 8812, 0, 1960, 0, 0, 0, 0, 0, 0, 3762, 3070,
+	8297, 0, 0, 0, 0, 0, 0, 0, 4382, 0, 0, 6288, 0, 0, 0, 0,
+	0, 2049, 0, 732, 1643, 0, 0, 0, 449, 8462, 562, 3603, 2716, 0, 3889, 8233,
+	0, 4105, 0, 0, 0, 0, 0, 0, 0, 0, 4293, 3888, 0, 0, 0, 0,
+	0, 0, 9652, 0, 0, 0, 0, 0, 1005, 5699, 8252, 5537, 3614, 0, 0, 0,
+	0, 0, 0, 0, 9527, 5366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3844,
+	6535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2131, 0, 6167, 0, 0, 6840, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3942, 0, 0, 0, 3992, 8743, 0, 0, 5963, 6256,
+	8978, 0, 5064, 6757, 0, 0, 0, 5996, 0, 0, 0, 0, 0, 4620, 0, 0,
+	0, 0, 0, 0, 0, 1626, 646, 6952, 0, 0, 0, 0, 0, 0, 0, 7239,
+	0, 0, 1556, 0, 0, 0, 7004, 0, 0, 5112, 3878, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4598, 0, 2467, 0, 0, 0, 0, 0, 0, 0, 0, 3162,
+	6340, 768, 9668, 0, 0, 0, 9538, 0, 7183, 0, 5508, 0, 6343, 0, 0, 0,
+	0, 0, 0, 4926, 0, 3931, 0, 0, 6373, 4561, 0, 7404, 0, 0, 0, 3366,
+	0, 0, 0, 0, 0, 0, 0, 0, 3933, 0, 0, 9610, 0, 1290, 3651, 5163,
+	7424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6372, 537, 9099, 8423, 0, 0,
+	0, 3696, 0, 0, 1021, 3408, 2187, 7270, 7493, 0, 0, 0, 0, 0, 2256, 0,
+	0, 0, 2912, 3645, 4522, 0, 0, 0, 0, 6916, 5106, 0, 0, 0, 0, 0,
+	134, 6207, 0, 0, 0, 0, 4137, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2866, 0, 0, 6096, 0, 0, 0, 0, 0, 0, 7704, 0, 0, 1444, 0, 0,
+	0, 0, 0, 0, 3636, 0, 3707, 0, 0, 0, 0, 0, 0, 0, 5862, 0,
+	0, 0, 0, 0, 0, 0, 0, 6671, 0, 0, 8751, 7271, 2681, 7445, 7839, 0,
+	0, 0, 0, 0, 0, 8759, 0, 0, 1277, 0, 0, 3027, 0, 0, 0, 322,
+	0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8402,
+	0, 0, 0, 596, 5817, 6928, 0, 5118, 0, 0, 9271, 0, 5839, 0, 0, 0,
+	0, 0, 0, 0, 0, 8863, 0, 0, 0, 3556, 0, 0, 0, 1220, 0, 0,
+	0, 0, 0, 5988, 8008, 0, 0, 0, 0, 785, 4722, 0, 0, 0, 0, 8156,
+	0, 1719, 4570, 4905, 0, 0, 0, 0, 0, 0, 4079, 7339, 2186, 5145, 0, 0,
+	0, 0, 0, 0, 0, 2550, 3578, 0, 0, 0, 0, 0, 2418, 0, 0, 0,
+	2832, 0, 0, 0, 0, 0, 5351, 0, 0, 3058, 4467, 0, 0, 2615, 0, 0,
+	0, 0, 5741, 0, 0, 0, 2226, 0, 0, 0, 1833, 3539, 0, 0, 0, 1812,
+	0, 8644, 8209, 0, 0, 0, 0, 0, 0, 2344, 0, 2877, 3412, 4852, 7809, 0,
+	0, 7591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5806, 0, 0, 0, 3986, 0, 0, 3576, 0, 0, 0, 0, 2514, 4112, 0,
+	0, 0, 2140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 906, 17, 0, 0, 0, 4721, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5738, 0, 2667, 8308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1694,
+	281, 6620, 0, 7329, 0, 0, 0, 0, 0, 9138, 0, 9437, 5727, 0, 0, 0,
+	0, 559, 5898, 6655, 7930, 0, 0, 0, 7601, 5554, 0, 690, 6367, 0, 0, 0,
+	4164, 0, 0, 0, 0, 0, 0, 0, 0, 6743, 0, 0, 0, 0, 0, 0,
+	0, 8784, 0, 0, 0, 7810, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 408, 1940, 0, 0, 0,
+	0, 0, 5713, 2442, 0, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9490, 9235, 0, 0, 0, 0, 3409, 3626, 1449, 0, 0, 3277, 8266, 8465, 1607, 0,
+	0, 7015, 0, 0, 1382, 0, 0, 0, 0, 0, 0, 261, 2160, 4162, 7620, 0,
+	0, 0, 0, 0, 0, 0, 5356, 0, 8417, 0, 0, 0, 4632, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2938, 0, 0, 951, 0,
+	3178, 4349, 0, 7093, 0, 0, 0, 0, 0, 9207, 0, 0, 7871, 0, 0, 0,
+	5687, 6161, 0, 4294, 0, 0, 0, 0, 0, 0, 0, 3940, 6026, 0, 0, 0,
+	0, 0, 8851, 0, 5679, 0, 0, 0, 8250, 7942, 9355, 0, 0, 0, 0, 0,
+	3182, 0, 2282, 0, 858, 1166, 3096, 3850, 0, 0, 0, 9150, 0, 0, 0, 1606,
+	4060, 0, 8667, 0, 6626, 0, 0, 178, 0, 0, 0, 0, 6711, 8013, 0, 0,
+	386, 1948, 0, 8857, 9354, 0, 0, 0, 0, 2, 0, 3275, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2756, 0, 0, 0, 2427, 0, 0, 0, 0, 438, 0,
+	0, 0, 0, 0, 692, 7517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4971,
+	0, 0, 0, 0, 0, 0, 5065, 0, 0, 0, 0, 0, 0, 0, 1015, 0,
+	0, 0, 0, 0, 0, 0, 6950, 0, 0, 2202, 0, 0, 0, 0, 0, 0,
+	2458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3411, 0, 0, 7939,
+	6943, 0, 667, 0, 0, 0, 1147, 0, 5594, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1947, 0, 0, 8231, 8580, 8521, 1702, 7673, 7788, 0, 0, 0, 0, 0,
+	0, 0, 4057, 3712, 0, 1201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7988, 6163, 0, 3945, 0, 0, 0, 0, 0, 0, 0, 3169, 844, 0, 0, 0,
+	0, 505, 0, 0, 7529, 0, 0, 0, 0, 0, 0, 2517, 0, 0, 0, 9257,
+	0, 409, 1158, 3641, 9375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5834, 0, 0, 7669, 6028, 0, 0, 0, 0, 0, 0, 0, 0, 868, 3176, 6951,
+	2995, 4379, 8749, 0, 0, 5563, 6310, 0, 1011, 0, 678, 5347, 7167, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2789, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1188, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 830, 0,
+	0, 8484, 8430, 0, 9688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5040, 4381,
+	0, 0, 0, 1918, 0, 3307, 0, 0, 0, 0, 0, 2827, 1660, 1849, 5137, 0,
+	1080, 1671, 2618, 8039, 0, 0, 0, 166, 0, 0, 0, 0, 0, 0, 0, 3519,
+	0, 1988, 0, 0, 8527, 0, 0, 736, 1181, 5091, 6551, 4674, 7552, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7463, 0, 0, 7624, 7227, 0,
+	0, 0, 0, 0, 0, 0, 9062, 0, 3763, 1497, 143, 4801, 5227, 6220, 0, 0,
+	0, 0, 0, 0, 0, 7615, 0, 0, 3826, 0, 0, 0, 489, 0, 0, 0,
+	0, 0, 0, 2676, 4899, 0, 6883, 8543, 0, 0, 936, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8516, 8836, 1951, 0, 0, 7418, 0, 0, 0,
+	0, 8687, 0, 0, 0, 0, 0, 4720, 0, 0, 0, 0, 0, 0, 3059, 0,
+	0, 0, 0, 0, 5911, 0, 8333, 7582, 0, 0, 0, 0, 0, 869, 0, 278,
+	5279, 8098, 2436, 2825, 0, 0, 0, 0, 0, 6159, 2488, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6440, 5940, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 594, 2469, 0, 6556, 6656, 0, 0, 0, 0, 2185, 546, 0,
+	0, 0, 0, 0, 0, 930, 1766, 3276, 0, 0, 8294, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2399, 3759, 6195, 9363, 0, 0, 0, 0, 1227, 3882,
+	1674, 8099, 3586, 0, 0, 0, 0, 6336, 0, 0, 4898, 0, 791, 8275, 0, 0,
+	0, 0, 2015, 0, 0, 0, 6049, 0, 0, 0, 0, 332, 0, 2900, 0, 7446,
+	2359, 0, 0, 0, 2619, 0, 5036, 8112, 0, 0, 4304, 5325, 2400, 7617, 0, 0,
+	527, 0, 0, 7604, 0, 0, 0, 0, 0, 5314, 5059, 5588, 3934, 0, 7273, 4346,
+	0, 0, 0, 324, 2820, 0, 0, 1152, 0, 3401, 4947, 0, 0, 2860, 0, 0,
+	0, 0, 0, 0, 2224, 3686, 7447, 7786, 0, 6519, 0, 9061, 0, 0, 0, 0,
+	237, 4239, 0, 0, 0, 8671, 0, 0, 0, 0, 0, 0, 4155, 0, 0, 0,
+	0, 0, 8956, 0, 0, 566, 5982, 0, 8010, 0, 0, 0, 5893, 6545, 398, 5810,
+	8908, 0, 3758, 1881, 0, 0, 0, 7477, 0, 0, 2161, 7760, 9464, 0, 3663, 0,
+	0, 0, 0, 0, 3300, 5715, 7498, 7952, 0, 0, 1729, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8882, 4095, 0, 0, 0, 0, 2637, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2678, 3215, 599, 0, 0, 2712,
+	8314, 4331, 2559, 0, 0, 5358, 6184, 5189, 0, 0, 6767, 0, 0, 7217, 0, 6324,
+	0, 1999, 0, 0, 0, 4738, 8940, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 8639, 9259, 0, 0, 1549, 6172, 0, 0, 6204, 0, 0,
+	0, 2737, 0, 0, 4838, 3918, 0, 6938, 0, 1512, 0, 944, 0, 0, 5659, 0,
+	1311, 1354, 1832, 0, 0, 6811, 0, 0, 0, 2175, 3815, 6836, 0, 0, 0, 2432,
+	0, 0, 0, 0, 7618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8721, 0, 0, 0, 0, 0, 0, 0, 1644, 3146, 0, 8996, 0, 0, 0, 0,
+	0, 8186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1912, 3186, 0, 6321, 0, 0, 1167, 5633, 1855, 0, 0, 0, 0, 0, 0, 0,
+	8278, 0, 0, 0, 7710, 0, 0, 1259, 729, 2227, 0, 0, 0, 0, 0, 4611,
+	2142, 9206, 4814, 2906, 4528, 3952, 5428, 0, 313, 0, 9427, 0, 0, 3190, 935, 5787,
+	0, 0, 0, 9644, 0, 0, 0, 9687, 0, 0, 1821, 7941, 0, 1187, 0, 0,
+	0, 0, 0, 0, 0, 0, 1721, 0, 0, 0, 9424, 6230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 0,
+	955, 6769, 9282, 292, 2548, 4307, 0, 0, 7549, 0, 8636, 0, 0, 3036, 6144, 2495,
+	0, 0, 0, 0, 0, 0, 3559, 0, 0, 0, 0, 9280, 0, 4863, 8778, 0,
+	0, 0, 0, 0, 9388, 0, 0, 0, 7898, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9591, 0, 0, 4808, 0, 0, 0, 0, 7959, 220, 0, 0, 7574,
+	0, 0, 0, 5708, 0, 0, 0, 0, 0, 234, 0, 0, 9126, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8255, 0, 0, 0, 5860,
+	6599, 0, 0, 0, 0, 4465, 4760, 0, 0, 0, 0, 4655, 0, 0, 7857, 9677,
+	7023, 0, 0, 8769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2705, 1552, 0, 0, 0, 0, 0, 0, 0, 0, 4166, 0, 0, 0, 5404,
+	0, 0, 2322, 0, 7759, 0, 0, 0, 2114, 0, 8790, 0, 0, 856, 8111, 0,
+	0, 0, 0, 6253, 6660, 2340, 0, 0, 0, 200, 0, 0, 0, 0, 0, 0,
+	9592, 0, 0, 7034, 9350, 1213, 0, 0, 12, 8966, 0, 0, 7782, 0, 0, 0,
+	3659, 1953, 5779, 0, 0, 0, 0, 0, 0, 0, 0, 8590, 0, 0, 5286, 5819,
+	7894, 7928, 0, 0, 7643, 8968, 0, 0, 0, 0, 6215, 0, 0, 0, 6631, 0,
+	0, 0, 0, 0, 119, 6274, 0, 9364, 0, 0, 0, 0, 9672, 0, 0, 0,
+	829, 1249, 6218, 8841, 0, 4156, 0, 0, 5861, 0, 3468, 0, 0, 0, 5449, 0,
+	0, 9182, 0, 0, 0, 0, 0, 0, 0, 2834, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5317, 0, 0, 0, 625, 9002, 5298, 0, 0, 0, 0, 0, 1945,
+	0, 2064, 1116, 0, 0, 0, 0, 7064, 7763, 0, 0, 0, 0, 0, 731, 8256,
+	0, 0, 1535, 0, 3157, 0, 9514, 9123, 0, 1853, 6627, 5373, 2055, 7991, 6205, 8643,
+	0, 0, 0, 0, 2069, 0, 0, 0, 0, 0, 0, 0, 2738, 4668, 0, 0,
+	0, 3454, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6071, 0, 0, 0, 0, 0, 0, 0, 8783, 0, 4872, 0,
+	4114, 7321, 3126, 0, 0, 0, 0, 120, 4677, 5287, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3599, 5362, 0, 5164, 0, 0, 0, 0, 0, 211,
+	0, 6076, 7491, 0, 749, 0, 0, 0, 0, 6765, 0, 7143, 8258, 0, 6108, 4816,
+	0, 0, 0, 0, 0, 0, 1132, 8709, 0, 0, 0, 0, 0, 0, 3964, 0,
+	0, 0, 0, 494, 0, 0, 0, 0, 0, 3328, 0, 0, 0, 0, 0, 0,
+	9589, 7799, 0, 0, 0, 7009, 5130, 0, 6866, 0, 0, 0, 0, 0, 0, 4507,
+	0, 0, 0, 8247, 0, 0, 4621, 5830, 2611, 734, 3453, 1495, 0, 137, 8435, 0,
+	0, 0, 0, 0, 0, 0, 0, 2662, 0, 0, 571, 1748, 6022, 0, 0, 5270,
+	2916, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 9260, 9604,
+	0, 0, 7954, 9428, 623, 8444, 0, 3631, 0, 0, 0, 4773, 0, 0, 0, 0,
+	0, 0, 0, 0, 2468, 5691, 0, 0, 0, 0, 0, 3350, 0, 0, 7807, 0,
+	3601, 7842, 8584, 8951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6751, 0, 0,
+	8245, 8367, 0, 8093, 0, 0, 0, 0, 0, 5245, 5736, 0, 0, 0, 0, 0,
+	0, 0, 2328, 0, 738, 4751, 0, 0, 0, 0, 0, 4823, 0, 0, 0, 8439,
+	9468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6503, 0, 0, 0, 1438, 0,
+	0, 7538, 0, 0, 0, 0, 4592, 0, 2232, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1637, 0, 6789, 526, 4551, 0, 0, 0, 0, 0, 0,
+	0, 4780, 0, 0, 0, 0, 0, 0, 352, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4128, 0, 0, 0, 9661, 2513, 9270, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3476, 0, 0, 0, 1712, 960, 9539, 8318, 0, 0, 5651, 0, 3604,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 403, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7874, 0, 0, 852, 0, 0, 2984, 4261, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1925, 0, 1211, 0, 0, 0, 0, 8119, 0, 0, 0, 0,
+	310, 0, 0, 0, 0, 0, 0, 4799, 0, 0, 9595, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2748, 0, 4531, 0, 0, 4906, 7348, 1669, 0, 0, 0,
+	756, 0, 0, 9397, 6394, 977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4708, 1765, 0, 0, 6097, 0, 0, 3000, 8254, 0, 0, 0, 9541, 0,
+	0, 0, 4607, 0, 8645, 5992, 0, 0, 4950, 0, 8481, 0, 0, 0, 0, 0,
+	0, 0, 0, 3967, 0, 2148, 0, 0, 0, 841, 0, 8370, 0, 0, 2693, 2660,
+	8689, 0, 0, 0, 0, 0, 8900, 0, 0, 0, 0, 0, 0, 850, 9405, 0,
+	9342, 0, 0, 0, 0, 3183, 5923, 0, 8685, 0, 6580, 0, 3565, 0, 0, 0,
+	0, 2833, 0, 0, 0, 0, 0, 0, 0, 0, 3108, 0, 759, 6052, 0, 0,
+	0, 0, 0, 0, 0, 3053, 8329, 0, 9686, 0, 0, 0, 0, 4460, 1464, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6130, 0, 5564,
+	0, 0, 0, 574, 0, 1602, 0, 0, 0, 0, 0, 0, 4688, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 5959, 0, 0, 0, 0, 9627, 0, 7851, 0, 0,
+	0, 0, 0, 0, 4353, 0, 0, 5682, 6261, 540, 6342, 0, 5943, 5999, 1268, 0,
+	6064, 8205, 0, 0, 4374, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4944, 0,
+	0, 0, 0, 0, 0, 9199, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5312,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2480, 0, 0, 0, 0, 0, 8897, 0, 1013, 2178, 0, 860, 1904, 0, 0,
+	0, 2771, 1460, 1755, 0, 0, 4624, 7263, 0, 9306, 964, 0, 0, 0, 129, 8840,
+	0, 0, 0, 0, 0, 0, 0, 2541, 0, 0, 0, 5665, 0, 4269, 0, 8184,
+	156, 1814, 9657, 0, 0, 0, 5296, 0, 0, 0, 0, 3205, 0, 0, 9593, 0,
+	0, 0, 8422, 0, 465, 7043, 0, 4036, 4696, 0, 5364, 0, 0, 0, 0, 0,
+	0, 2403, 0, 0, 0, 0, 9507, 0, 4131, 5980, 0, 0, 0, 0, 4608, 6827,
+	0, 0, 0, 0, 0, 0, 4263, 0, 0, 1900, 0, 1125, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8272, 0, 0, 0, 0, 0, 2410, 2735, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7367, 1377, 0, 8079, 9059, 4712, 3125, 0, 0,
+	0, 0, 0, 0, 0, 0, 1255, 0, 0, 0, 8427, 0, 7548, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9346, 8676, 0, 0, 6894, 4927,
+	0, 9689, 0, 0, 0, 0, 0, 0, 0, 2260, 0, 0, 5521, 0, 0, 0,
+	0, 0, 1914, 0, 0, 0, 9326, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8633, 3055, 0, 4012, 3884, 0, 0, 0, 0, 7223, 0, 0, 3988, 953, 4094,
+	4537, 0, 0, 0, 0, 355, 0, 1107, 0, 0, 0, 0, 0, 1579, 0, 2520,
+	5964, 2332, 0, 0, 1527, 5451, 0, 0, 8479, 0, 0, 0, 0, 0, 7712, 7092,
+	0, 0, 0, 0, 0, 0, 0, 8113, 0, 6268, 4558, 0, 6737, 0, 0, 0,
+	0, 6587, 0, 0, 0, 0, 0, 5952, 8498, 1578, 7379, 0, 6445, 0, 0, 3577,
+	3860, 2016, 3897, 0, 0, 7168, 0, 0, 7818, 3939, 0, 0, 0, 0, 0, 5102,
+	2742, 0, 7519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4006, 0, 0, 0, 0, 0, 7220, 550, 305, 8809, 2440, 0, 0, 0,
+	0, 0, 0, 1161, 0, 2387, 0, 0, 5869, 0, 3867, 4555, 0, 0, 0, 0,
+	0, 4666, 0, 5234, 0, 0, 4262, 4615, 0, 0, 6325, 8718, 0, 0, 0, 0,
+	0, 6305, 0, 0, 0, 0, 0, 0, 0, 0, 5676, 0, 0, 0, 0, 0,
+	0, 6846, 0, 6353, 0, 0, 4526, 0, 3796, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7621, 0, 0, 0,
+	0, 8558, 9276, 0, 2323, 0, 0, 0, 0, 0, 0, 0, 0, 7464, 0, 9460,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4485, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2741, 0, 0,
+	0, 0, 5258, 5760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8502,
+	0, 0, 0, 0, 0, 0, 592, 6714, 0, 5389, 6475, 1901, 5797, 0, 0, 8023,
+	5773, 0, 0, 0, 0, 7518, 0, 0, 0, 0, 0, 0, 0, 285, 0, 0,
+	0, 0, 0, 2761, 375, 5764, 3782, 7171, 0, 0, 0, 0, 1763, 0, 0, 0,
+	0, 0, 0, 6575, 0, 0, 0, 2318, 0, 0, 6505, 7815, 2395, 3543, 0, 0,
+	0, 2596, 0, 4171, 0, 0, 0, 0, 0, 0, 0, 1025, 0, 0, 0, 5188,
+	7086, 9477, 6350, 0, 0, 0, 1526, 0, 0, 595, 0, 3456, 603, 7551, 0, 0,
+	0, 0, 0, 7361, 0, 0, 0, 0, 0, 0, 0, 1899, 1697, 340, 0, 0,
+	0, 8520, 0, 0, 3046, 0, 3189, 0, 0, 4969, 0, 5050, 2863, 5264, 0, 5250,
+	5341, 6851, 456, 999, 1802, 1892, 914, 4673, 4707, 2784, 7037, 0, 0, 0, 965, 0,
+	0, 8654, 0, 1803, 0, 8115, 0, 6969, 0, 0, 0, 0, 0, 3955, 0, 8745,
+	0, 0, 113, 0, 0, 0, 3198, 0, 0, 3900, 0, 0, 0, 0, 5796, 0,
+	3510, 9666, 0, 0, 0, 0, 0, 0, 0, 8458, 0, 0, 0, 6967, 4439, 0,
+	0, 7218, 0, 0, 0, 0, 0, 4, 0, 6448, 0, 0, 4470, 5109, 7966, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6428, 6838, 0, 0, 0, 1528, 0, 0, 0, 0, 0, 0, 0, 0, 501, 0,
+	0, 0, 0, 0, 3803, 0, 2239, 0, 0, 0, 0, 0, 0, 0, 1937, 9301,
+	4032, 4523, 6102, 0, 0, 1463, 3237, 2642, 422, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4130, 0, 0, 0, 3139, 0, 0, 0, 9113, 0, 8055, 0, 5545, 0,
+	0, 8798, 0, 0, 0, 9358, 0, 0, 0, 0, 544, 5265, 0, 0, 684, 0,
+	0, 0, 3552, 5568, 0, 0, 6375, 0, 8793, 0, 0, 0, 573, 4018, 3555, 7588,
+	7866, 1725, 2385, 0, 0, 0, 1448, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4796, 0, 4363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9522, 3179,
+	0, 0, 0, 273, 6254, 0, 0, 0, 0, 0, 0, 8990, 9425, 3585, 0, 0,
+	0, 8803, 0, 0, 4993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1641,
+	4435, 5732, 9225, 0, 0, 0, 0, 8088, 0, 0, 2809, 7781, 0, 0, 2566, 1834,
+	1746, 257, 7221, 6812, 0, 0, 0, 0, 0, 8190, 0, 0, 0, 8432, 0, 0,
+	0, 4129, 0, 0, 0, 0, 4553, 2451, 0, 5624, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7473, 8805, 6338, 1282, 5001, 0, 792, 6023, 0, 3589, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2530, 0,
+	0, 0, 0, 0, 0, 0, 7689, 0, 0, 0, 5237, 0, 9603, 0, 843, 0,
+	0, 0, 0, 4497, 8120, 0, 0, 0, 0, 0, 0, 1859, 0, 0, 9430, 0,
+	0, 0, 0, 8715, 3928, 7151, 0, 0, 0, 0, 2261, 0, 0, 0, 8203, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9373, 0, 9340, 0, 0, 0, 0, 0,
+	6622, 1990, 0, 0, 8353, 0, 0, 2638, 4271, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4847, 0, 0, 59, 0, 188, 8802, 0, 0, 0, 0, 0,
+	866, 0, 0, 9403, 0, 0, 0, 1266, 0, 0, 6240, 6364, 0, 4880, 0, 0,
+	0, 0, 0, 0, 0, 9601, 0, 0, 335, 4520, 0, 8454, 0, 0, 0, 0,
+	3777, 3221, 0, 0, 2428, 0, 0, 0, 3318, 4912, 0, 3185, 0, 1112, 0, 99,
+	1487, 7589, 0, 0, 0, 3441, 0, 0, 0, 0, 0, 0, 0, 961, 4153, 0,
+	345, 0, 7035, 762, 0, 0, 0, 0, 0, 0, 0, 0, 2612, 440, 4298, 6019,
+	0, 8775, 0, 6857, 0, 0, 8468, 0, 0, 6235, 4168, 0, 0, 0, 0, 4820,
+	7506, 0, 0, 2195, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5726, 7766, 7804, 9360, 0, 4174, 0, 0, 0, 0, 7359,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2802, 0, 0, 5409, 0,
+	222, 130, 0, 0, 3747, 5795, 0, 0, 0, 0, 0, 4795, 5671, 0, 6785, 0,
+	357, 0, 0, 0, 0, 0, 0, 0, 0, 636, 0, 0, 6832, 0, 0, 5442,
+	0, 0, 0, 0, 0, 2680, 924, 4116, 0, 0, 4890, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5555, 4334, 0, 0, 0, 0, 0, 8756, 0,
+	0, 6597, 8725, 9390, 0, 3175, 0, 0, 0, 0, 0, 7042, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9197, 9348, 0, 0, 0,
+	0, 0, 0, 0, 1121, 2308, 0, 0, 0, 0, 0, 0, 0, 4056, 7509, 9229,
+	0, 0, 7089, 8587, 6650, 1982, 0, 0, 0, 0, 0, 2670, 0, 0, 0, 0,
+	0, 0, 0, 632, 2806, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7531, 8155, 9634, 2306, 0, 0, 0, 0, 0,
+	0, 0, 5928, 1583, 5754, 0, 6198, 5456, 2714, 4143, 8632, 0, 0, 0, 0, 3311,
+	3389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3904, 1104, 2729,
+	1886, 5117, 0, 0, 0, 0, 309, 4146, 0, 0, 0, 0, 0, 0, 5601, 0,
+	0, 0, 0, 0, 0, 5985, 0, 832, 7070, 0, 0, 0, 0, 6734, 1134, 0,
+	0, 0, 0, 0, 5241, 0, 0, 5748, 0, 6892, 8043, 0, 0, 0, 0, 9614,
+	0, 7797, 0, 0, 0, 0, 1543, 0, 5316, 907, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6054, 0, 0, 5719, 3135, 0, 705, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5793, 7971, 0, 0, 3635, 0, 0, 0, 0, 4935, 0, 0, 0,
+	989, 1935, 2726, 0, 0, 0, 0, 0, 0, 0, 7889, 0, 5747, 0, 0, 0,
+	0, 3445, 0, 3440, 4117, 0, 0, 3460, 0, 0, 353, 0, 0, 7053, 0, 6621,
+	0, 0, 7365, 4383, 9278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3799, 5032, 4846, 0, 5103, 1077, 0, 0, 0, 2696, 6715, 0, 1338,
+	8057, 0, 0, 0, 9620, 0, 0, 0, 0, 0, 0, 8608, 0, 0, 0, 4090,
+	9230, 4327, 0, 0, 0, 0, 0, 0, 0, 0, 9613, 0, 0, 0, 6512, 7349,
+	0, 0, 0, 0, 0, 5692, 9032, 0, 2061, 3690, 1127, 0, 0, 0, 1081, 2960,
+	9202, 0, 203, 0, 0, 1837, 0, 0, 0, 0, 8021, 0, 4769, 3816, 0, 0,
+	3122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3950, 6332, 0, 0, 0, 0, 0, 0, 1278, 0, 0, 0,
+	0, 0, 1169, 0, 0, 0, 9535, 7487, 0, 5382, 0, 6273, 0, 102, 674, 0,
+	0, 269, 5448, 0, 0, 0, 0, 0, 0, 0, 1155, 0, 0, 8221, 5275, 0,
+	6362, 0, 641, 0, 0, 2347, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3537, 3746, 6032, 6043, 0, 0, 0, 3678, 8274, 0, 2041, 0, 0, 9345, 0, 0,
+	0, 0, 4087, 0, 0, 2961, 9553, 0, 3066, 3195, 0, 0, 0, 0, 702, 7940,
+	0, 0, 0, 5486, 5883, 0, 0, 5971, 0, 0, 0, 0, 0, 0, 2115, 0,
+	0, 0, 0, 0, 0, 5842, 0, 0, 0, 8606, 0, 0, 0, 0, 0, 0,
+	0, 2551, 0, 0, 0, 0, 2635, 323, 4199, 7901, 8380, 0, 0, 0, 0, 0,
+	0, 0, 0, 1869, 0, 8889, 0, 0, 0, 0, 0, 0, 0, 0, 3765, 0,
+	0, 0, 1353, 0, 0, 2180, 4283, 1330, 0, 0, 0, 0, 8852, 8330, 0, 0,
+	0, 0, 4542, 565, 0, 8507, 0, 0, 0, 4249, 2091, 4602, 8653, 0, 0, 5993,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 831, 0, 0, 3526, 0,
+	0, 3837, 8440, 0, 5212, 8405, 0, 0, 0, 7222, 0, 0, 0, 4022, 0, 0,
+	9001, 0, 3985, 0, 0, 0, 0, 0, 0, 0, 5038, 0, 0, 1735, 3235, 8195,
+	8378, 0, 0, 0, 3196, 6578, 4365, 0, 0, 0, 0, 0, 0, 6322, 8168, 0,
+	8464, 0, 0, 0, 1665, 0, 3549, 0, 0, 0, 0, 0, 6698, 0, 9049, 0,
+	0, 0, 0, 0, 0, 0, 6520, 293, 8555, 3652, 0, 0, 0, 0, 0, 0,
+	5386, 0, 0, 0, 3256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1410, 0, 0, 0, 0, 0, 0, 1913, 0, 0, 0, 3252, 0, 9636,
+	0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 381, 6131, 0, 0, 0,
+	7824, 7434, 0, 0, 9110, 0, 0, 0, 5831, 3753, 4946, 1950, 2337, 1874, 6278, 0,
+	0, 0, 0, 1996, 6021, 0, 0, 0, 4515, 0, 0, 0, 0, 6498, 0, 0,
+	0, 0, 6589, 0, 0, 0, 9612, 0, 0, 0, 0, 1462, 0, 0, 0, 7216,
+	0, 0, 0, 0, 1908, 8766, 4397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1047, 7019, 0, 3508, 0, 0, 4276, 0, 3155, 0, 0, 0, 0, 9510, 0,
+	1036, 7388, 0, 4319, 2248, 0, 7979, 0, 0, 8647, 0, 2207, 6763, 0, 5905, 10,
+	4273, 8551, 0, 0, 0, 0, 0, 0, 0, 6557, 0, 2928, 6031, 1452, 0, 8650,
+	0, 0, 5534, 0, 0, 0, 1488, 0, 0, 0, 0, 0, 4778, 0, 0, 0,
+	0, 5854, 9551, 1683, 7474, 0, 0, 0, 6805, 7020, 0, 0, 8788, 0, 0, 6990,
+	9180, 0, 0, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6476,
+	0, 0, 0, 0, 0, 0, 2416, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 144, 0, 8045, 6143, 7149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3214,
+	0, 0, 0, 3203, 0, 5946, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3354, 1734, 0, 0, 1801, 0, 0, 0, 0, 0, 0,
+	0, 0, 7694, 0, 2316, 5501, 0, 5801, 0, 0, 0, 0, 0, 0, 0, 0,
+	1883, 0, 1054, 0, 0, 0, 0, 2303, 6212, 0, 0, 3071, 0, 0, 0, 0,
+	0, 0, 3693, 1461, 0, 0, 0, 0, 0, 3160, 0, 383, 0, 0, 4344, 0,
+	0, 0, 0, 1921, 5968, 0, 1757, 5011, 0, 0, 0, 3639, 0, 4756, 0, 6189,
+	0, 5403, 8774, 564, 0, 0, 0, 0, 0, 0, 7600, 2157, 0, 0, 2464, 9217,
+	0, 0, 8153, 0, 0, 0, 0, 0, 598, 2262, 8747, 0, 0, 0, 0, 0,
+	4179, 0, 925, 0, 0, 0, 3792, 7958, 0, 0, 0, 0, 7120, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3121, 0, 0, 1442, 6886, 0, 0, 0, 0,
+	1601, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0,
+	0, 268, 0, 0, 1786, 0, 0, 0, 5400, 5523, 0, 6658, 0, 0, 0, 6495,
+	9115, 9214, 0, 5803, 3385, 0, 3895, 9664, 0, 3957, 2614, 0, 0, 0, 3392, 6817,
+	0, 0, 0, 0, 396, 1004, 0, 9552, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7584, 0, 9663, 0, 4724, 464, 0, 6124, 969, 3315, 5438, 0,
+	4289, 0, 8129, 0, 0, 9649, 993, 8438, 0, 6478, 0, 1317, 4192, 569, 2030, 8356,
+	0, 0, 0, 0, 0, 0, 1288, 0, 0, 0, 5926, 0, 0, 0, 2633, 0,
+	0, 0, 0, 4952, 8114, 533, 0, 4420, 0, 0, 2858, 7309, 0, 0, 0, 4215,
+	0, 6800, 0, 0, 963, 8191, 0, 3708, 5532, 0, 0, 0, 5305, 0, 7482, 6441,
+	0, 0, 0, 0, 0, 0, 0, 3069, 0, 0, 0, 0, 0, 9414, 0, 0,
+	0, 0, 0, 1787, 0, 3562, 7812, 0, 0, 4716, 4739, 0, 7039, 0, 3317, 4731,
+	7426, 6259, 9144, 0, 9557, 0, 0, 0, 0, 0, 8693, 0, 0, 0, 0, 0,
+	9374, 0, 0, 6063, 0, 9679, 0, 0, 0, 3141, 0, 0, 0, 0, 0, 0,
+	6524, 0, 0, 0, 0, 0, 0, 5685, 0, 0, 8362, 0, 0, 1207, 0, 0,
+	0, 0, 0, 0, 0, 3930, 0, 0, 0, 0, 5506, 0, 0, 4948, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 395, 3550, 0, 0, 0, 5412, 0, 7891, 0,
+	0, 9043, 0, 0, 0, 6963, 0, 0, 0, 8995, 0, 5114, 0, 0, 0, 2346,
+	0, 0, 8726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 8077, 0, 0, 2759, 0, 0, 0, 0, 695, 0, 0, 0, 1454, 7599,
+	1008, 2113, 0, 0, 7, 4394, 0, 0, 0, 0, 0, 192, 0, 8579, 0, 0,
+	7516, 8992, 0, 0, 0, 0, 4347, 0, 0, 0, 0, 2388, 0, 3319, 4279, 5454,
+	0, 0, 0, 0, 6213, 0, 0, 0, 0, 0, 2558, 2101, 9454, 9456, 0, 4451,
+	9487, 0, 0, 427, 0, 0, 0, 7408, 0, 7081, 0, 0, 447, 7029, 0, 8811,
+	471, 0, 0, 3104, 0, 0, 0, 0, 0, 4468, 0, 8611, 426, 0, 0, 0,
+	5781, 5680, 0, 0, 7932, 0, 5214, 8586, 0, 0, 0, 3825, 0, 0, 0, 0,
+	0, 7699, 8925, 0, 3136, 0, 0, 0, 0, 541, 8118, 6, 7351, 988, 0, 0,
+	0, 0, 7280, 0, 932, 1360, 7017, 7366, 800, 0, 0, 0, 0, 0, 786, 0,
+	0, 0, 0, 7431, 8753, 0, 0, 0, 0, 0, 0, 7295, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6948, 0,
+	5768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3786, 3298, 6518, 7441, 7956, 8963, 0, 0, 0, 8101, 0, 0, 0, 107, 9642, 1657,
+	2100, 3474, 5344, 7934, 3865, 0, 9174, 0, 0, 707, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 784, 0, 0, 0, 1237, 3619, 0, 4900, 2391, 2020, 0, 0, 6238,
+	8903, 0, 4582, 0, 7647, 0, 9488, 0, 7780, 6515, 0, 6341, 9047, 4007, 4408, 0,
+	0, 0, 0, 0, 0, 0, 7739, 0, 0, 0, 0, 0, 0, 0, 0, 3442,
+	0, 0, 0, 8222, 798, 0, 0, 0, 0, 1200, 0, 1388, 3875, 4107, 5173, 4371,
+	6312, 7701, 5323, 8894, 6355, 0, 4458, 0, 0, 0, 0, 96, 0, 8299, 7326, 0,
+	3272, 8047, 8817, 0, 5530, 0, 5471, 0, 7613, 6752, 0, 0, 0, 0, 2402, 0,
+	0, 0, 0, 0, 0, 0, 2453, 0, 0, 0, 5755, 0, 0, 0, 0, 0,
+	1888, 7947, 0, 0, 0, 0, 7895, 0, 0, 0, 0, 0, 0, 0, 6895, 506,
+	8449, 0, 0, 4417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2501, 0, 846, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2997, 284, 0, 0, 0, 0, 0, 6707, 2147, 0, 976, 0, 0, 7562,
+	3909, 7674, 0, 0, 0, 0, 0, 2096, 0, 0, 0, 0, 4593, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 911, 2971, 5979, 6477, 8828, 2327, 4650,
+	0, 0, 0, 9307, 0, 6410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2553, 0, 0, 0, 0, 0, 2006, 0, 7680, 5511, 0, 362,
+	0, 0, 6439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6430,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 5535, 0, 0, 0, 0, 2396,
+	0, 0, 0, 775, 1120, 4280, 8989, 0, 0, 4815, 0, 6768, 0, 0, 0, 0,
+	0, 2781, 0, 0, 1590, 175, 2926, 0, 1659, 0, 0, 170, 0, 0, 0, 0,
+	789, 0, 0, 851, 2121, 0, 0, 0, 0, 0, 0, 0, 0, 9045, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 282, 0, 0, 0, 9028, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 9597, 0, 0, 0, 0, 8269, 0, 0, 3374, 5215,
+	0, 8218, 1069, 2899, 4662, 5931, 7510, 0, 0, 0, 4860, 0, 0, 0, 0, 7274,
+	0, 4413, 0, 0, 0, 531, 0, 0, 0, 6056, 0, 0, 0, 875, 1997, 2528,
+	3009, 5997, 6731, 7478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2357, 4762, 0, 0, 3448, 0, 98, 0, 0, 0, 4377, 0, 1357,
+	0, 0, 0, 0, 0, 0, 0, 9065, 0, 8185, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2499, 0, 1631, 0, 1839, 0, 0, 4059, 4530, 0, 8044,
+	0, 0, 0, 0, 0, 0, 0, 259, 4488, 9100, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1074, 8384, 1662, 6961, 0, 6210, 7742, 7774, 0,
+	5876, 0, 8287, 0, 0, 2610, 0, 0, 2992, 0, 0, 0, 0, 0, 0, 0,
+	2590, 0, 0, 0, 260, 0, 0, 0, 0, 0, 0, 189, 0, 3500, 0, 0,
+	0, 0, 0, 5431, 6079, 8311, 0, 0, 0, 0, 0, 0, 0, 0, 7292, 0,
+	8964, 0, 3207, 6244, 8950, 67, 8276, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9063, 0, 0, 0, 4994, 0, 7625, 0, 3356, 7813, 2008,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7489, 8845, 0, 0, 7927, 0, 0,
+	2677, 3521, 6337, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 238, 0, 0, 0, 0, 0, 998, 5965, 0, 387, 5372, 0, 0, 3673,
+	0, 0, 2360, 7293, 0, 0, 9429, 0, 385, 6404, 0, 0, 0, 0, 1971, 1356,
+	0, 0, 0, 1067, 1574, 2717, 0, 0, 0, 0, 0, 7935, 0, 0, 0, 0,
+	0, 0, 3357, 0, 0, 0, 0, 0, 4404, 524, 0, 0, 0, 9540, 0, 0,
+	5750, 0, 0, 0, 0, 0, 0, 3773, 0, 0, 9621, 0, 3632, 6029, 0, 6136,
+	0, 8942, 8166, 0, 0, 1075, 6553, 0, 0, 0, 1437, 2882, 4695, 2584, 5491, 8056,
+	0, 0, 1724, 0, 0, 0, 0, 0, 0, 0, 8104, 0, 0, 0, 0, 0,
+	0, 7213, 0, 0, 0, 0, 0, 0, 0, 0, 5187, 0, 6966, 0, 0, 0,
+	0, 5195, 0, 0, 5216, 7638, 0, 0, 0, 0, 0, 0, 0, 1305, 0, 0,
+	0, 5718, 0, 2057, 0, 0, 0, 0, 0, 0, 7479, 0, 0, 0, 0, 4730,
+	8952, 2457, 7212, 0, 0, 3486, 0, 0, 0, 0, 0, 0, 0, 382, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	341, 5890, 0, 0, 5433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9116, 2482,
+	0, 0, 8442, 0, 0, 0, 0, 0, 0, 0, 1868, 0, 7773, 0, 8223, 0,
+	691, 1090, 2438, 9647, 7974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3958, 1565, 1469, 7757, 1254, 0, 0, 0, 0, 7047, 7555, 0, 949, 5627, 0,
+	0, 0, 6531, 0, 0, 2019, 9178, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3064, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6983, 6132, 0, 0,
+	0, 0, 0, 0, 0, 0, 1398, 0, 0, 0, 0, 0, 8727, 0, 0, 0,
+	8573, 9179, 379, 0, 0, 0, 0, 0, 1430, 0, 0, 3832, 1252, 3876, 6486, 0,
+	0, 0, 0, 0, 0, 0, 4617, 2851, 0, 0, 4160, 0, 0, 0, 0, 0,
+	0, 0, 2002, 9453, 0, 0, 0, 5991, 2220, 0, 0, 0, 0, 3138, 0, 0,
+	0, 2434, 0, 1318, 4600, 3475, 0, 9352, 0, 0, 0, 922, 0, 4512, 5850, 6386,
+	0, 0, 0, 6605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3482, 9475, 0,
+	5978, 0, 0, 2158, 0, 0, 0, 0, 0, 150, 8657, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1519, 0, 0, 0, 0, 0, 0,
+	3490, 0, 2295, 0, 0, 0, 0, 0, 0, 5953, 0, 304, 8505, 7735, 3506, 0,
+	0, 1022, 0, 7814, 0, 9432, 1309, 4700, 1396, 5026, 5526, 0, 0, 0, 0, 808,
+	0, 0, 2509, 4472, 885, 6897, 0, 0, 0, 6457, 0, 0, 3891, 8986, 0, 0,
+	0, 0, 0, 4212, 0, 0, 0, 0, 315, 7277, 0, 9111, 3023, 0, 0, 0,
+	0, 2687, 0, 0, 0, 0, 0, 0, 0, 1966, 5660, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1165, 0, 2009, 0, 0, 0, 0, 5769, 0, 8446,
+	0, 783, 991, 5088, 0, 0, 5652, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8061, 0, 0, 0, 0, 4109, 4398, 0, 0, 418, 0, 2431,
+	0, 1810, 0, 0, 0, 0, 0, 6117, 0, 0, 1473, 0, 0, 0, 0, 0,
+	0, 6592, 0, 0, 0, 0, 5824, 0, 0, 0, 0, 2424, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2786, 0, 3047, 0, 0, 0, 0, 0, 0, 0, 0,
+	7021, 3384, 7055, 0, 0, 0, 5405, 0, 0, 5650, 8742, 2053, 0, 0, 0, 0,
+	0, 0, 5618, 0, 1417, 1136, 0, 0, 3295, 0, 0, 0, 0, 0, 0, 3305,
+	6957, 4306, 2704, 8348, 0, 0, 0, 0, 0, 0, 0, 0, 748, 0, 0, 0,
+	1870, 0, 3494, 7565, 0, 8735, 9376, 3691, 0, 0, 191, 1235, 0, 6695, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5752, 5867, 0, 0, 7920, 0, 5075,
+	0, 5851, 2372, 0, 0, 4516, 0, 0, 1551, 9251, 0, 0, 0, 0, 0, 0,
+	0, 8490, 0, 6610, 0, 0, 0, 0, 0, 5204, 0, 0, 6803, 0, 0, 0,
+	0, 6780, 0, 0, 0, 0, 0, 1063, 8066, 0, 3451, 3899, 5473, 0, 0, 0,
+	0, 0, 2557, 0, 6036, 0, 0, 0, 2343, 3512, 5423, 0, 0, 8518, 0, 0,
+	0, 0, 0, 0, 2084, 5426, 202, 0, 0, 5827, 4502, 9292, 0, 0, 3273, 6591,
+	0, 0, 0, 2409, 7051, 2836, 0, 1591, 0, 0, 0, 0, 2444, 0, 0, 0,
+	0, 5033, 0, 0, 3617, 0, 0, 0, 0, 248, 6818, 8478, 0, 0, 5078, 3470,
+	8858, 9168, 0, 69, 0, 0, 0, 0, 0, 0, 0, 2098, 2034, 0, 0, 0,
+	7830, 0, 0, 6962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2940, 4631, 0, 0, 8540, 0, 0, 0, 0, 0, 0, 0, 0, 1257, 0,
+	0, 0, 0, 5575, 0, 4792, 0, 0, 0, 7247, 7893, 0, 2571, 0, 0, 0,
+	0, 0, 0, 0, 0, 2052, 2669, 6970, 9646, 0, 0, 0, 0, 3917, 4612, 7933,
+	0, 0, 0, 0, 9575, 0, 0, 7546, 0, 0, 4206, 0, 0, 0, 0, 3841,
+	0, 0, 0, 0, 0, 0, 5020, 0, 0, 8474, 8554, 2767, 3642, 0, 0, 7396,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9289, 0, 0, 0, 4853,
+	6579, 7287, 0, 0, 8935, 0, 5408, 0, 0, 0, 0, 0, 0, 0, 0, 9176,
+	354, 0, 1728, 0, 0, 0, 0, 0, 0, 1190, 5821, 0, 0, 0, 7158, 0,
+	0, 0, 4431, 7373, 0, 0, 0, 0, 0, 6820, 0, 0, 0, 8829, 2494, 0,
+	6140, 0, 217, 1475, 9676, 0, 5584, 7514, 0, 0, 0, 8322, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1932, 0, 0, 0, 0, 0, 0, 0,
+	0, 4913, 4355, 2492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9435, 0, 0,
+	0, 0, 0, 2999, 0, 9070, 0, 7713, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 184, 0, 0, 0, 0, 0, 5329, 0, 0, 8050, 3738, 6641, 8810,
+	0, 0, 0, 2137, 4659, 6012, 0, 0, 0, 0, 0, 0, 0, 1361, 0, 0,
+	8603, 0, 2609, 0, 0, 6141, 2895, 4364, 0, 0, 0, 0, 0, 0, 4578, 0,
+	0, 0, 0, 0, 0, 0, 0, 205, 1405, 0, 0, 0, 7310, 0, 0, 4120,
+	4264, 0, 0, 0, 347, 0, 0, 0, 0, 249, 7533, 3591, 4463, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9503, 0, 0, 1358, 0, 0, 0, 2070, 0, 0, 0, 0, 0, 0, 0,
+	0, 6510, 8664, 0, 0, 0, 0, 755, 4854, 0, 0, 0, 0, 0, 0, 0,
+	0, 3524, 0, 0, 0, 0, 5826, 8765, 6663, 7191, 3634, 3222, 6651, 8820, 0, 0,
+	1332, 1295, 0, 0, 0, 9449, 9298, 2072, 0, 0, 7899, 880, 9459, 0, 0, 4892,
+	0, 0, 0, 0, 0, 0, 0, 0, 6245, 787, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3852, 0, 0, 0, 9438, 0, 0, 0, 0,
+	0, 0, 5822, 4240, 0, 712, 1621, 0, 5619, 0, 195, 0, 0, 0, 0, 7414,
+	3396, 7969, 0, 0, 8483, 8082, 0, 0, 0, 0, 0, 0, 0, 5285, 9127, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7443, 3662, 0, 6265, 0,
+	0, 0, 0, 0, 6024, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 0, 0,
+	9066, 4870, 0, 0, 0, 4831, 8987, 0, 0, 0, 0, 1961, 4336, 1135, 2497, 0,
+	0, 0, 0, 0, 0, 0, 3525, 864, 7075, 6852, 0, 4493, 0, 3099, 0, 0,
+	0, 0, 0, 958, 0, 0, 0, 0, 0, 0, 2885, 3430, 7333, 9635, 2242, 6764,
+	0, 0, 0, 0, 2830, 0, 0, 0, 0, 0, 0, 0, 6316, 9513, 0, 0,
+	0, 5153, 0, 0, 0, 0, 0, 2390, 3974, 0, 2570, 7264, 0, 7165, 9517, 0,
+	0, 2964, 0, 0, 1209, 0, 0, 0, 6732, 7334, 0, 0, 0, 0, 0, 1661,
+	0, 0, 0, 0, 7278, 4356, 7453, 7914, 0, 0, 0, 0, 4321, 0, 0, 7094,
+	0, 0, 0, 0, 0, 4221, 0, 0, 0, 0, 0, 891, 0, 0, 7378, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6760, 0, 7206, 7716, 0, 0, 0, 4011,
+	0, 0, 0, 0, 0, 0, 8545, 0, 3075, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3935, 0, 0, 3010, 0, 0, 0, 0, 3145, 3329, 0,
+	0, 2778, 0, 0, 0, 0, 0, 0, 0, 4917, 0, 0, 0, 0, 5318, 0,
+	3493, 0, 0, 0, 0, 0, 0, 2331, 0, 0, 6586, 0, 0, 0, 0, 0,
+	0, 0, 0, 8173, 0, 411, 6526, 0, 0, 4821, 246, 6795, 8415, 0, 0, 0,
+	0, 0, 0, 0, 619, 0, 9674, 9295, 4941, 5958, 0, 0, 0, 0, 1366, 1840,
+	0, 0, 0, 0, 561, 0, 8556, 0, 0, 0, 142, 9650, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 819, 4726, 0, 0, 9416, 4634, 0, 766,
+	7521, 9519, 0, 0, 0, 0, 0, 0, 0, 7382, 0, 0, 0, 0, 0, 0,
+	1710, 0, 3219, 0, 0, 5320, 0, 0, 724, 0, 0, 0, 0, 0, 0, 0,
+	7241, 2627, 348, 1576, 0, 0, 72, 0, 1973, 263, 0, 0, 1261, 2021, 2246, 2229,
+	3264, 5714, 0, 5217, 0, 0, 0, 7900, 0, 0, 4454, 4934, 0, 0, 0, 2952,
+	0, 0, 0, 5435, 4536, 0, 0, 0, 0, 0, 0, 2419, 0, 0, 7211, 7614,
+	0, 0, 0, 8058, 0, 0, 0, 0, 0, 0, 448, 6596, 0, 26, 0, 0,
+	0, 0, 0, 886, 0, 3920, 4990, 3192, 7963, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3996, 0, 0, 3090, 0, 760, 5302, 5590, 6380, 0, 0, 0, 0,
+	0, 3938, 3913, 6919, 0, 0, 0, 0, 0, 4406, 0, 0, 0, 9500, 504, 0,
+	0, 2125, 3535, 0, 0, 45, 8110, 0, 0, 1313, 0, 0, 6492, 4933, 0, 0,
+	0, 0, 5529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3040, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5406, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 9520, 0, 0, 0, 6272, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4924, 0, 0, 1564, 0, 0, 0, 8849, 0, 0, 1828, 0,
+	0, 0, 0, 0, 0, 2355, 1033, 3822, 6197, 1668, 1800, 5802, 8511, 0, 9159, 0,
+	0, 7245, 283, 0, 5348, 0, 0, 0, 0, 6654, 682, 0, 0, 0, 0, 0,
+	1879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3922, 0, 0, 8622,
+	0, 0, 0, 1715, 0, 0, 0, 0, 0, 0, 5614, 0, 6409, 8698, 0, 0,
+	0, 0, 429, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7585, 0, 0, 0, 0, 0, 2977, 0, 0, 0,
+	0, 6020, 0, 2174, 0, 0, 0, 3807, 0, 0, 0, 7968, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 308, 5574, 0, 7475, 9633, 0, 0, 0,
+	0, 0, 7741, 0, 8786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1007, 0, 0, 0, 7751, 0, 0, 1894, 8369, 0, 0, 7755, 5833, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1852, 0, 0, 0, 0, 1043, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1175, 7764, 0, 0, 0, 0, 6604, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4339, 0, 0, 0, 0, 4653, 0, 0, 0, 0, 0, 7096,
+	8655, 8006, 0, 0, 0, 135, 5090, 5061, 3833, 9166, 8028, 0, 0, 1747, 3785, 0,
+	0, 0, 0, 2071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1459, 0, 688,
+	0, 0, 0, 0, 6985, 0, 5786, 0, 6890, 0, 0, 0, 7480, 0, 703, 2849,
+	4845, 0, 0, 0, 0, 8281, 0, 0, 0, 0, 0, 6162, 0, 0, 0, 0,
+	3439, 0, 0, 0, 2883, 0, 0, 0, 0, 0, 7835, 0, 0, 6930, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7228, 0, 0, 992, 430, 8678,
+	764, 4316, 0, 0, 0, 0, 0, 0, 0, 0, 8083, 3551, 5374, 0, 0, 0,
+	0, 0, 0, 0, 6677, 2320, 0, 2755, 477, 4100, 0, 0, 0, 0, 0, 0,
+	0, 3297, 4576, 0, 0, 0, 0, 0, 0, 0, 1635, 4599, 115, 0, 9602, 5823,
+	0, 0, 0, 0, 157, 0, 0, 4412, 8525, 1002, 3419, 8700, 0, 0, 0, 0,
+	0, 0, 0, 6686, 0, 0, 0, 0, 0, 0, 1055, 3427, 6467, 0, 0, 0,
+	0, 0, 6727, 6075, 6560, 1346, 0, 0, 6469, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5089, 0, 0, 6070, 7470, 0, 0, 3737, 0, 0, 0, 0,
+	0, 0, 0, 314, 0, 0, 6849, 0, 0, 0, 0, 0, 0, 0, 5024, 0,
+	0, 0, 0, 221, 5049, 5003, 0, 0, 0, 0, 7313, 4718, 0, 0, 0, 0,
+	4188, 0, 416, 0, 0, 2042, 0, 0, 943, 0, 0, 0, 0, 1955, 0, 0,
+	0, 0, 0, 2980, 0, 2315, 6460, 0, 0, 0, 0, 8649, 0, 6717, 4975, 7563,
+	0, 5439, 0, 0, 0, 3912, 0, 3554, 264, 3338, 5236, 7170, 0, 0, 6465, 0,
+	0, 0, 2134, 1569, 0, 0, 0, 0, 0, 0, 0, 116, 1369, 3748, 0, 0,
+	0, 0, 0, 0, 2210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5896, 0,
+	0, 9451, 7746, 0, 0, 0, 0, 0, 0, 6716, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6160, 8386, 0, 0, 9262, 0, 0, 7659, 2803,
+	3216, 2686, 0, 3503, 0, 0, 1796, 0, 0, 8419, 5977, 6127, 6462, 0, 7231, 0,
+	8290, 0, 0, 0, 0, 1797, 0, 0, 0, 0, 0, 5092, 0, 0, 3700, 6913,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4492, 0, 0, 4309, 2376, 0, 7207, 2706, 0, 0, 0, 0, 0, 0, 0,
+	6454, 2170, 4400, 3501, 4574, 0, 0, 3868, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9046, 0, 0, 8089, 0, 5731, 0, 3150, 0, 0, 8051, 0, 0, 6392, 4544,
+	9629, 1559, 558, 5866, 0, 0, 3232, 0, 0, 0, 0, 0, 6300, 8531, 1804, 0,
+	7879, 0, 0, 0, 2730, 0, 0, 0, 0, 2522, 0, 9083, 0, 301, 0, 8682,
+	6319, 7462, 4802, 0, 0, 0, 0, 5396, 0, 1411, 2703, 5635, 0, 0, 0, 3309,
+	0, 0, 0, 4124, 7130, 316, 3041, 0, 145, 2659, 9288, 9694, 0, 5749, 0, 0,
+	0, 0, 0, 1962, 0, 0, 0, 423, 0, 3804, 0, 0, 0, 0, 0, 0,
+	5900, 1395, 0, 0, 0, 5565, 4686, 0, 0, 0, 0, 0, 0, 6798, 2472, 0,
+	0, 5235, 7743, 0, 0, 0, 0, 0, 0, 5309, 6284, 0, 0, 6922, 0, 0,
+	0, 3557, 0, 0, 0, 0, 0, 0, 0, 3976, 0, 0, 0, 0, 0, 0,
+	0, 1693, 2757, 3212, 5244, 0, 0, 190, 0, 0, 0, 0, 0, 158, 7724, 0,
+	4692, 0, 0, 0, 8800, 6471, 952, 0, 0, 0, 0, 0, 0, 0, 3042, 0,
+	0, 8383, 0, 0, 3937, 0, 4888, 0, 2990, 5994, 4144, 7671, 0, 6960, 0, 0,
+	0, 82, 8979, 8941, 0, 0, 0, 9485, 950, 0, 0, 1863, 0, 0, 0, 0,
+	0, 2126, 0, 0, 0, 1154, 2507, 5654, 0, 0, 0, 0, 0, 5629, 0, 735,
+	1503, 3224, 1592, 197, 5017, 5178, 0, 212, 0, 7845, 0, 0, 0, 0, 3898, 1799,
+	0, 8548, 0, 0, 0, 2268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8818, 0, 0, 0, 9003, 3970, 5767, 0, 0, 0, 0, 7908, 0, 0, 0, 2577,
+	4774, 613, 0, 0, 0, 8002, 8206, 8859, 0, 0, 7654, 818, 4384, 7076, 8228, 0,
+	0, 7737, 618, 6114, 2599, 0, 0, 0, 723, 4715, 7060, 7315, 0, 0, 8492, 0,
+	7684, 0, 4628, 9447, 0, 0, 535, 0, 5016, 0, 0, 0, 0, 8865, 0, 0,
+	0, 716, 0, 0, 0, 0, 7331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8328, 0, 0, 380, 0, 0, 0, 0, 8991, 0, 0, 0, 0, 0, 0, 0,
+	0, 1247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6562,
+	0, 0, 0, 0, 0, 0, 7214, 5882, 7407, 7840, 0, 6736, 0, 0, 0, 0,
+	0, 0, 0, 6810, 1701, 0, 0, 0, 0, 0, 6790, 687, 0, 0, 0, 0,
+	0, 0, 3802, 0, 0, 0, 155, 0, 0, 4781, 0, 0, 0, 758, 0, 0,
+	0, 0, 0, 0, 2702, 0, 0, 1458, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1270, 0, 7539, 0, 3536, 0, 0, 0, 0, 0, 0, 0, 0,
+	6042, 0, 0, 6931, 7806, 7125, 0, 740, 1397, 0, 0, 7440, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3471, 0, 0, 0, 0, 0, 7398, 0,
+	0, 0, 5477, 3608, 0, 0, 0, 0, 6236, 0, 0, 6859, 0, 0, 0, 0,
+	0, 0, 7844, 0, 0, 0, 6594, 0, 0, 0, 0, 2930, 0, 0, 4789, 0,
+	5021, 8081, 6885, 0, 0, 2023, 4106, 8839, 0, 4248, 0, 0, 0, 0, 0, 3570,
+	6118, 0, 0, 0, 7421, 0, 0, 0, 1739, 0, 0, 0, 0, 0, 1072, 5582,
+	0, 8723, 0, 0, 0, 7564, 0, 0, 3806, 9516, 0, 0, 0, 0, 0, 8284,
+	4308, 7849, 0, 8450, 0, 0, 0, 0, 0, 0, 0, 0, 7765, 3291, 2032, 2449,
+	3661, 0, 0, 0, 0, 0, 0, 0, 0, 1149, 0, 0, 0, 0, 2054, 0,
+	0, 6458, 0, 2353, 0, 0, 4533, 0, 4438, 1964, 1584, 0, 0, 0, 0, 0,
+	0, 0, 8096, 0, 0, 1414, 6046, 0, 9053, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6662, 0, 0, 0, 0, 4868, 0, 0, 0, 0, 0, 0, 274, 7077,
+	0, 6164, 0, 0, 6872, 0, 0, 2506, 1529, 0, 0, 2235, 0, 0, 0, 9296,
+	0, 0, 0, 0, 0, 0, 0, 894, 0, 0, 0, 5414, 6427, 0, 0, 2652,
+	0, 0, 0, 584, 0, 0, 0, 4976, 0, 0, 0, 6999, 0, 0, 8871, 0,
+	0, 0, 0, 0, 0, 0, 0, 1233, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 5328, 1756, 0, 0, 0, 0, 0, 0, 0, 2236,
+	0, 0, 0, 8938, 0, 8847, 6449, 7376, 0, 6541, 0, 4487, 6514, 0, 0, 0,
+	5388, 6783, 0, 2500, 3247, 8561, 9555, 0, 0, 0, 0, 7466, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 8145, 0, 25, 5656, 2077, 0, 0, 0, 0, 0, 0,
+	2840, 0, 0, 8459, 4711, 0, 0, 0, 680, 7610, 0, 0, 0, 2206, 0, 0,
+	0, 0, 0, 7144, 4489, 0, 0, 0, 2657, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 342, 4837, 0, 5542, 0, 0, 3801, 0, 0, 3963, 0, 0, 4342, 6821,
+	0, 5611, 0, 0, 0, 0, 0, 0, 4010, 0, 0, 0, 0, 0, 0, 7332,
+	0, 4748, 0, 0, 4856, 0, 0, 0, 0, 0, 0, 2264, 0, 0, 0, 0,
+	0, 4770, 3528, 0, 0, 0, 0, 1038, 6089, 0, 0, 0, 0, 0, 0, 0,
+	0, 879, 21, 0, 0, 0, 0, 1214, 0, 0, 0, 0, 0, 3081, 0, 0,
+	0, 0, 6267, 9334, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6692, 0, 0, 3768, 139, 0, 6794, 0, 0, 3916, 8627, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5110, 4301, 0, 0, 0, 0, 0, 0,
+	0, 3606, 0, 5597, 1466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 343, 0, 165, 0, 6870, 0, 0, 8754, 0, 0, 0, 0, 6678, 7714, 1456,
+	0, 0, 0, 8792, 0, 7215, 9368, 0, 0, 3484, 0, 0, 0, 0, 2679, 0,
+	0, 8229, 4182, 0, 0, 6170, 0, 1385, 0, 0, 9542, 0, 1376, 0, 0, 0,
+	6092, 0, 0, 0, 0, 0, 0, 0, 4766, 0, 0, 0, 0, 3462, 893, 7994,
+	0, 0, 1334, 0, 0, 0, 0, 7870, 3948, 3463, 8791, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 0, 6973, 0, 0,
+	7078, 0, 9381, 8503, 0, 0, 0, 2173, 0, 3733, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 9189, 0, 0, 0, 0, 0, 2886, 9294, 9558, 0,
+	0, 0, 0, 0, 8961, 7720, 0, 5015, 6740, 0, 0, 0, 0, 0, 0, 0,
+	0, 5307, 0, 0, 0, 4746, 8124, 516, 2218, 1586, 0, 0, 0, 0, 0, 0,
+	1798, 0, 0, 2225, 1133, 8408, 0, 0, 1875, 4183, 6452, 7452, 7576, 0, 7196, 2721,
+	0, 0, 0, 6450, 0, 0, 0, 0, 0, 0, 5670, 0, 0, 0, 0, 0,
+	0, 4288, 0, 0, 0, 0, 0, 0, 8592, 0, 0, 0, 4256, 0, 0, 0,
+	0, 0, 683, 0, 2835, 0, 0, 5846, 0, 0, 2141, 0, 0, 2950, 0, 0,
+	8365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 9445, 9153, 0, 0, 0, 3791, 0, 0, 4982, 4804,
+	0, 0, 0, 769, 0, 7500, 0, 0, 0, 0, 0, 0, 0, 0, 300, 0,
+	0, 0, 0, 204, 1723, 0, 0, 4187, 0, 0, 0, 6008, 0, 1095, 8178, 0,
+	0, 0, 0, 0, 0, 0, 1253, 0, 1536, 0, 0, 4113, 0, 0, 0, 0,
+	0, 0, 0, 7175, 0, 0, 8773, 0, 0, 0, 0, 0, 871, 1034, 5967, 0,
+	0, 4286, 0, 0, 6657, 0, 0, 2543, 8918, 0, 6616, 0, 7124, 0, 8562, 0,
+	0, 5191, 0, 0, 0, 0, 0, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5429, 0, 0, 0, 495, 0, 0, 6120, 0,
+	0, 0, 0, 374, 8526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5936, 0, 0, 0, 0, 0, 0, 0, 0, 2389, 0, 0, 0, 258, 0,
+	0, 0, 7990, 0, 0, 417, 608, 4878, 9367, 0, 0, 4956, 0, 0, 0, 0,
+	0, 0, 7285, 0, 0, 0, 0, 0, 0, 6643, 0, 0, 0, 0, 0, 0,
+	0, 0, 3421, 0, 0, 5721, 6529, 1401, 0, 9505, 0, 7828, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7173, 0, 0, 0, 0, 779,
+	0, 0, 0, 3665, 0, 0, 0, 0, 0, 4092, 9286, 0, 0, 9422, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1585, 7998, 0, 0,
+	0, 0, 1813, 5267, 0, 0, 0, 0, 0, 0, 5620, 0, 4351, 0, 0, 0,
+	0, 0, 0, 0, 7141, 0, 0, 0, 0, 0, 0, 0, 0, 4392, 0, 0,
+	0, 0, 0, 2470, 0, 0, 0, 2775, 6593, 0, 5648, 0, 0, 8022, 0, 0,
+	0, 0, 3124, 0, 0, 0, 0, 0, 9322, 0, 0, 0, 0, 0, 0, 0,
+	58, 0, 0, 0, 2880, 7888, 0, 0, 0, 0, 147, 3118, 6742, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8029, 0, 3674, 9389, 0, 0, 0, 0, 0, 68,
+	6793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4152, 0,
+	0, 8164, 0, 0, 0, 0, 8923, 0, 0, 3420, 0, 0, 0, 0, 0, 7460,
+	7556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2817, 0, 0, 0, 0, 6222,
+	0, 0, 8825, 256, 0, 8712, 6013, 0, 0, 8661, 0, 0, 4165, 0, 0, 0,
+	3828, 0, 0, 0, 0, 0, 0, 0, 6618, 0, 0, 0, 0, 0, 0, 7011,
+	0, 0, 6733, 513, 1615, 7266, 0, 0, 0, 5704, 0, 0, 6639, 4396, 0, 6718,
+	9210, 3618, 0, 0, 0, 3893, 5219, 0, 1761, 0, 9639, 693, 2728, 9244, 0, 0,
+	0, 0, 8969, 0, 0, 0, 0, 0, 5190, 0, 0, 0, 0, 0, 2894, 0,
+	9169, 0, 0, 0, 0, 0, 1836, 0, 2864, 0, 8161, 0, 3422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 553, 0, 0, 814, 3351, 8876, 0,
+	0, 0, 0, 0, 0, 0, 1400, 0, 0, 9536, 2152, 210, 0, 0, 647, 0,
+	0, 0, 4475, 0, 3741, 0, 0, 0, 0, 0, 0, 0, 3030, 0, 0, 0,
+	154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 4220, 0, 0, 0, 3600,
+	0, 0, 0, 0, 0, 0, 5879, 0, 0, 0, 5098, 8705, 0, 0, 402, 0,
+	0, 2299, 399, 0, 1965, 0, 0, 0, 7912, 0, 5013, 0, 7097, 0, 0, 0,
+	5304, 0, 9120, 0, 0, 0, 1427, 5136, 0, 0, 0, 4429, 0, 0, 0, 0,
+	0, 1399, 0, 0, 0, 7962, 0, 0, 626, 6217, 0, 0, 0, 0, 6848, 0,
+	6359, 9615, 0, 0, 0, 0, 0, 0, 0, 0, 482, 0, 0, 0, 0, 1084,
+	0, 539, 3089, 0, 0, 5171, 0, 0, 2668, 0, 828, 0, 2797, 0, 0, 0,
+	0, 0, 0, 0, 0, 3455, 0, 0, 1440, 0, 0, 1938, 8244, 0, 0, 1310,
+	3464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 821, 0, 6691, 0,
+	0, 1321, 3883, 0, 2129, 0, 0, 0, 0, 0, 0, 0, 3721, 0, 0, 3369,
+	5080, 0, 0, 2947, 0, 9681, 29, 0, 0, 5143, 4998, 0, 1485, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5604, 0, 0, 0, 3926, 0, 0,
+	1720, 0, 3947, 0, 0, 0, 0, 0, 349, 0, 5758, 6473, 2632, 5081, 0, 0,
+	0, 0, 0, 1012, 0, 0, 5549, 0, 0, 0, 0, 0, 8121, 1478, 0, 0,
+	0, 0, 0, 0, 0, 0, 3418, 5706, 0, 1350, 1065, 5463, 8399, 0, 0, 0,
+	0, 1050, 0, 0, 4919, 7370, 0, 0, 0, 0, 3534, 778, 0, 0, 0, 0,
+	0, 18, 0, 2483, 4141, 9570, 2011, 5336, 6642, 3341, 1418, 2092, 0, 0, 0, 0,
+	0, 6395, 0, 3039, 0, 6570, 0, 0, 0, 0, 0, 0, 679, 0, 0, 0,
+	3901, 493, 0, 0, 0, 8779, 0, 0, 0, 0, 0, 0, 0, 6546, 9080, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7242, 0, 0,
+	4938, 0, 0, 0, 0, 4963, 4557, 7169, 4027, 5025, 0, 1989, 7224, 9583, 5135, 5707,
+	0, 0, 0, 0, 0, 7360, 0, 3327, 0, 0, 0, 0, 0, 0, 3137, 0,
+	0, 0, 0, 2782, 5251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5353, 0, 0, 0, 0, 0, 0, 3666, 0, 0, 0, 0, 0, 0, 0,
+	9476, 0, 0, 0, 0, 576, 8214, 8668, 0, 0, 8588, 0, 0, 8338, 0, 6228,
+	6422, 0, 0, 0, 0, 0, 0, 0, 0, 3405, 3596, 0, 0, 0, 0, 0,
+	0, 0, 2363, 6225, 9246, 0, 0, 0, 0, 6888, 7160, 4776, 0, 0, 0, 0,
+	0, 0, 9274, 0, 3962, 0, 0, 2604, 5520, 0, 0, 0, 0, 1653, 0, 327,
+	0, 0, 5613, 0, 0, 0, 4326, 6309, 0, 0, 8235, 0, 1276, 0, 9078, 0,
+	30, 0, 0, 0, 2531, 4509, 0, 0, 0, 0, 8777, 1482, 0, 6863, 0, 1909,
+	0, 0, 5213, 0, 0, 0, 3144, 568, 3823, 4259, 8734, 0, 0, 0, 0, 0,
+	0, 0, 5507, 0, 0, 1717, 413, 0, 0, 4626, 0, 1031, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6150, 0, 0, 6509, 8604,
+	0, 0, 0, 0, 0, 0, 0, 7708, 0, 0, 0, 0, 0, 0, 7646, 0,
+	0, 0, 7397, 0, 0, 0, 5154, 0, 7843, 0, 0, 0, 0, 8456, 0, 3337,
+	1919, 3062, 4072, 5580, 6081, 8005, 6547, 6566, 0, 0, 0, 0, 0, 0, 0, 3423,
+	0, 0, 0, 0, 0, 0, 0, 0, 2526, 0, 0, 0, 0, 3544, 1422, 0,
+	0, 0, 0, 0, 4494, 5029, 0, 3735, 0, 0, 4875, 0, 8282, 7882, 0, 0,
+	0, 0, 1762, 0, 0, 0, 0, 0, 0, 0, 0, 9654, 0, 0, 3590, 4682,
+	6438, 9154, 997, 0, 8351, 0, 0, 6122, 1312, 2639, 0, 730, 0, 0, 0, 0,
+	6500, 0, 0, 0, 9399, 0, 2515, 7794, 0, 7543, 9537, 9648, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6777, 0, 0, 0, 0, 4984, 0, 0, 0, 0,
+	0, 0, 0, 0, 2097, 5778, 9576, 2259, 0, 0, 476, 0, 0, 358, 0, 2897,
+	0, 0, 0, 8134, 0, 7723, 6158, 0, 0, 0, 9508, 890, 1628, 4287, 7010, 0,
+	0, 0, 0, 0, 0, 5066, 0, 0, 0, 0, 4962, 1064, 3049, 0, 0, 0,
+	0, 0, 8207, 9054, 3751, 0, 0, 0, 0, 0, 0, 0, 9085, 0, 0, 8673,
+	2927, 0, 0, 3336, 0, 1542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4469, 0, 0, 0, 0, 2958, 1916, 3718, 0,
+	0, 0, 3201, 0, 0, 0, 0, 0, 3595, 0, 5070, 9605, 0, 0, 0, 0,
+	6874, 0, 0, 0, 8612, 1374, 0, 0, 0, 0, 0, 0, 0, 6279, 0, 0,
+	0, 0, 7419, 7876, 79, 601, 9038, 0, 0, 0, 0, 938, 4652, 8776, 0, 7779,
+	7402, 0, 0, 0, 7284, 7577, 0, 0, 0, 5904, 0, 0, 1453, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4723, 0, 0, 0,
+	9338, 0, 0, 0, 0, 460, 0, 0, 0, 0, 0, 0, 3166, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3541,
+	4474, 5844, 0, 3834, 8924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9637, 0, 6696, 9245, 0, 0, 0, 4923, 0, 0, 0, 0, 0, 0, 0, 1984,
+	4252, 0, 0, 5772, 2766, 4501, 7917, 0, 6262, 7137, 0, 0, 0, 0, 8831, 0,
+	0, 7504, 0, 0, 0, 0, 0, 3188, 0, 3006, 4714, 9353, 311, 4689, 8146, 0,
+	0, 5888, 5579, 0, 4013, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2957, 0, 4992, 0, 5789, 0, 0, 0, 0,
+	3703, 7025, 8133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3814, 658, 1018, 2156, 0,
+	0, 0, 0, 0, 0, 4433, 0, 0, 0, 0, 4147, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 3128, 8428, 7172, 9665, 0, 0, 0, 2364, 4480, 0, 0,
+	0, 0, 0, 5657, 0, 0, 0, 0, 0, 0, 9186, 4590, 0, 0, 0, 0,
+	0, 0, 6791, 0, 2404, 0, 0, 0, 0, 5788, 0, 0, 0, 0, 0, 8194,
+	0, 0, 0, 0, 0, 294, 9695, 0, 0, 0, 0, 0, 0, 3320, 0, 0,
+	7629, 2576, 1206, 5804, 7796, 0, 0, 0, 2760, 0, 0, 1412, 0, 0, 903, 1842,
+	0, 0, 0, 0, 0, 0, 7041, 4881, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3629, 0, 2552, 1695, 0, 0, 4176, 0, 0, 0, 0, 0, 0, 0,
+	0, 8535, 6053, 0, 0, 797, 0, 0, 6191, 0, 0, 0, 0, 0, 6833, 0,
+	0, 0, 0, 1689, 177, 9479, 4765, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2296, 0, 6199, 0, 1722, 0, 0, 0, 0, 0, 3142, 0, 0, 0,
+	0, 0, 5037, 0, 0, 659, 745, 2907, 0, 0, 0, 0, 4625, 0, 0, 0,
+	590, 0, 1752, 6214, 0, 1561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1771, 0, 2924, 1331, 233, 2815, 979, 6875, 6554, 0, 0, 9163, 4893, 0, 0,
+	0, 5184, 0, 0, 1751, 0, 0, 6854, 0, 2081, 0, 198, 118, 7054, 5585, 8949,
+	0, 1172, 0, 0, 0, 5929, 7336, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 7176, 0, 0, 1027, 0, 0, 0, 0, 0, 0, 0,
+	0, 7758, 0, 0, 0, 739, 2634, 3107, 9160, 4577, 5599, 0, 0, 0, 0, 9073,
+	0, 9494, 6060, 0, 0, 0, 0, 0, 0, 0, 5498, 0, 0, 0, 3905, 6374,
+	2017, 3616, 4538, 8549, 0, 0, 0, 0, 0, 2040, 0, 0, 0, 0, 0, 0,
+	650, 2445, 0, 5261, 0, 0, 0, 0, 5425, 0, 9608, 0, 0, 6455, 3710, 4818,
+	0, 5906, 0, 0, 4563, 6996, 0, 0, 9133, 0, 468, 0, 0, 0, 0, 356,
+	5278, 0, 0, 0, 2813, 0, 0, 0, 0, 0, 0, 3123, 0, 0, 1772, 2718,
+	0, 1553, 2589, 0, 6444, 0, 0, 0, 0, 0, 0, 6602, 0, 0, 0, 1284,
+	0, 0, 1807, 0, 2413, 7192, 0, 0, 0, 0, 0, 0, 0, 0, 9157, 0,
+	0, 0, 4255, 0, 0, 0, 1838, 0, 0, 0, 0, 317, 1083, 0, 0, 645,
+	2562, 4879, 0, 0, 7821, 0, 0, 0, 0, 0, 7375, 2103, 9221, 0, 0, 0,
+	0, 3348, 3217, 0, 0, 0, 0, 0, 1189, 5711, 8541, 0, 0, 8550, 2330, 0,
+	0, 0, 0, 1294, 0, 461, 0, 0, 0, 0, 7544, 0, 0, 0, 0, 8431,
+	0, 7803, 0, 0, 7717, 0, 0, 0, 0, 0, 0, 0, 0, 9655, 0, 0,
+	2785, 0, 5666, 0, 0, 2394, 4410, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6646, 0, 0, 6363, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2857, 0, 0, 5039, 0, 0, 0, 0, 0, 0, 0, 1963, 0, 0, 8212,
+	7919, 0, 3149, 8957, 0, 0, 0, 0, 5514, 452, 0, 0, 0, 5266, 7732, 7768,
+	0, 0, 0, 8640, 8504, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5986, 0,
+	3545, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9283, 0, 0, 2082, 0, 0,
+	5292, 7756, 0, 0, 0, 0, 0, 0, 848, 0, 0, 0, 0, 0, 0, 8514,
+	0, 0, 0, 0, 0, 0, 7133, 3612, 0, 0, 0, 9098, 0, 0, 4959, 0,
+	2184, 0, 0, 0, 0, 0, 1570, 0, 2542, 9628, 0, 0, 0, 0, 0, 0,
+	6306, 0, 0, 0, 0, 0, 1924, 0, 0, 0, 1183, 0, 5122, 0, 0, 0,
+	1212, 0, 431, 0, 0, 6299, 0, 0, 0, 0, 0, 0, 4889, 0, 0, 0,
+	0, 1609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 503, 3202, 0, 0, 0,
+	0, 0, 8257, 0, 8158, 0, 7119, 0, 0, 7488, 0, 0, 8273, 0, 8874, 0,
+	0, 0, 0, 112, 7032, 0, 0, 8544, 0, 0, 6669, 0, 7369, 0, 0, 1716,
+	0, 5560, 0, 0, 0, 0, 0, 0, 0, 0, 5757, 0, 2176, 0, 0, 0,
+	0, 0, 0, 0, 1608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5632, 0,
+	6710, 0, 4464, 0, 0, 2208, 8946, 0, 0, 0, 0, 0, 0, 0, 0, 6034,
+	0, 0, 0, 0, 3267, 8691, 0, 0, 498, 2790, 0, 0, 2884, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7208, 0, 0, 0, 0, 7850, 0, 6955, 159, 4527,
+	2545, 2951, 6463, 0, 0, 0, 895, 0, 0, 1929, 1976, 0, 0, 0, 0, 0,
+	7316, 0, 0, 0, 0, 0, 2656, 0, 0, 0, 0, 0, 4446, 0, 8159, 0,
+	0, 1779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7697, 0, 0, 0, 0,
+	5836, 607, 5641, 4359, 0, 2198, 0, 6216, 0, 0, 0, 0, 3312, 9264, 0, 0,
+	0, 0, 0, 4957, 7317, 8493, 0, 7101, 4832, 0, 0, 0, 0, 7967, 0, 0,
+	0, 0, 5949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2605, 0, 0, 0,
+	0, 1348, 2251, 6909, 0, 0, 0, 0, 8755, 0, 2383, 8508, 8620, 0, 0, 0,
+	0, 0, 0, 887, 6459, 7136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3866, 1088, 8007, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 338, 5716, 8040, 8702, 0, 0, 6006, 0, 0, 0, 0, 0, 6964, 4787,
+	0, 0, 6929, 0, 446, 0, 0, 0, 7276, 0, 719, 0, 708, 0, 2349, 3488,
+	0, 0, 0, 0, 0, 7859, 7660, 9263, 5570, 0, 0, 0, 1794, 8, 896, 4370,
+	5283, 8915, 0, 4996, 0, 637, 5500, 7311, 0, 366, 0, 0, 8395, 0, 0, 0,
+	0, 5399, 3547, 0, 0, 0, 0, 0, 0, 2769, 0, 0, 0, 7937, 593, 0,
+	0, 0, 5838, 8143, 0, 478, 0, 4630, 0, 1844, 0, 0, 8122, 0, 5242, 5672,
+	50, 0, 0, 8785, 0, 0, 0, 3206, 6196, 7513, 0, 0, 6634, 0, 0, 0,
+	0, 0, 0, 0, 0, 2621, 0, 0, 0, 3810, 0, 0, 0, 0, 0, 0,
+	7535, 0, 0, 0, 0, 0, 0, 8487, 0, 0, 0, 1673, 0, 1941, 2166, 2240,
+	4001, 5546, 0, 0, 0, 0, 0, 0, 0, 0, 810, 1009, 0, 3719, 5211, 0,
+	0, 0, 0, 0, 7030, 0, 0, 0, 0, 0, 0, 5415, 7262, 4443, 8295, 0,
+	1507, 0, 0, 4588, 0, 8364, 8907, 8696, 0, 8646, 9238, 84, 1795, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4844, 0, 5196, 6453, 0, 3944, 0, 0, 0, 0,
+	0, 0, 6721, 0, 0, 0, 0, 0, 8697, 0, 0, 588, 0, 173, 5034, 8856,
+	0, 0, 0, 0, 7645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 771, 6499, 9158, 4973, 0, 0, 0, 0, 4616, 0, 3134, 7355, 4601, 0, 0,
+	0, 0, 0, 0, 7890, 7129, 7476, 0, 0, 4361, 0, 1705, 0, 6914, 0, 0,
+	0, 7886, 0, 0, 0, 0, 0, 8614, 0, 0, 0, 0, 0, 0, 0, 0,
+	1532, 0, 3770, 0, 0, 0, 8376, 0, 0, 0, 0, 0, 0, 4758, 0, 2954,
+	8767, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8571,
+	3246, 0, 0, 0, 0, 639, 0, 0, 0, 1958, 7234, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5095, 5543, 5766, 7896, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4393, 1891, 0, 0, 0, 0, 0, 6796, 3051, 1097, 4925, 6814, 1363,
+	0, 0, 0, 5458, 0, 0, 1817, 8476, 0, 0, 2423, 4245, 0, 0, 0, 0,
+	0, 3845, 8937, 0, 0, 0, 0, 0, 3154, 0, 2031, 0, 0, 0, 2171, 1150,
+	2345, 0, 0, 0, 0, 0, 0, 0, 6424, 0, 0, 0, 0, 0, 0, 5894,
+	372, 0, 0, 0, 0, 5048, 0, 0, 0, 0, 0, 0, 0, 947, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5019, 0, 0, 5483, 7246, 7048, 9310,
+	6002, 0, 0, 0, 6504, 6889, 5596, 0, 5072, 6517, 0, 0, 0, 0, 7312, 4402,
+	0, 0, 0, 5625, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7065, 0, 0, 0, 0, 0, 6285, 2297, 7118, 4014, 5696, 0,
+	0, 0, 563, 4505, 9237, 0, 0, 5800, 7253, 0, 0, 2664, 0, 3428, 5077, 5447,
+	2544, 0, 6302, 6701, 3695, 0, 0, 0, 3871, 0, 0, 0, 0, 3077, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9518, 0, 0, 0, 0, 0, 0, 6045, 8117,
+	0, 0, 0, 368, 2078, 4679, 0, 0, 2763, 0, 0, 0, 0, 0, 0, 1315,
+	40, 4681, 5416, 2624, 3580, 0, 1726, 0, 1426, 0, 0, 0, 0, 9329, 4427, 6330,
+	4704, 0, 0, 0, 1877, 0, 0, 5631, 2304, 3817, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 1773, 0, 0, 8532,
+	7142, 0, 0, 5218, 2430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3984, 0, 0, 0, 0, 0, 867, 0, 8078, 0, 0, 0, 0, 0, 0, 0,
+	8418, 0, 9300, 0, 0, 4991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4883, 0, 2253, 0, 0, 0, 0, 0, 1118, 0, 0, 0, 0,
+	0, 0, 3452, 0, 1952, 0, 0, 291, 4421, 0, 0, 0, 7337, 0, 0, 0,
+	1920, 0, 0, 3998, 0, 0, 0, 0, 0, 1672, 0, 8967, 0, 0, 0, 6173,
+	0, 7257, 9471, 1978, 0, 0, 0, 2581, 0, 0, 2909, 0, 4251, 5138, 0, 0,
+	2209, 8872, 0, 0, 8522, 0, 0, 3615, 0, 0, 8921, 0, 0, 0, 5209, 4732,
+	0, 0, 0, 0, 0, 0, 9436, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7534, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3890, 5859, 3028, 0, 0, 0, 0,
+	0, 9561, 0, 0, 0, 8372, 6106, 0, 0, 0, 0, 8912, 0, 0, 0, 0,
+	0, 0, 4376, 0, 0, 0, 5350, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1191, 0, 0, 0, 0, 181, 2456, 3325, 5247, 0, 6456, 0, 0, 0, 0, 0,
+	0, 0, 0, 3459, 6979, 0, 0, 5639, 8142, 0, 0, 43, 0, 4058, 0, 0,
+	8062, 8424, 0, 0, 4549, 0, 6085, 0, 0, 0, 8215, 0, 948, 0, 0, 0,
+	0, 0, 0, 0, 0, 9122, 0, 0, 0, 0, 6778, 0, 0, 0, 0, 1408,
+	0, 0, 0, 4753, 0, 2536, 3929, 5222, 0, 3346, 0, 0, 2172, 0, 0, 0,
+	0, 0, 0, 0, 4550, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1841,
+	8716, 0, 289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4719,
+	161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5166, 0, 6007, 0, 0, 0, 0, 0, 0, 0, 1224,
+	0, 6936, 0, 0, 0, 0, 9525, 0, 0, 0, 0, 0, 101, 0, 0, 0,
+	0, 0, 7236, 0, 0, 2613, 0, 0, 9128, 0, 0, 6573, 0, 5338, 0, 0,
+	0, 7243, 0, 0, 2601, 5151, 5410, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 825, 654, 1911, 0, 0, 2989, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7439, 0, 0, 2791, 0, 0, 0, 0, 987, 54, 0, 0, 0, 132,
+	3808, 0, 0, 8172, 0, 6179, 0, 0, 0, 4436, 0, 0, 0, 0, 0, 0,
+	0, 0, 9579, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2967, 0, 6935, 0,
+	0, 0, 0, 7338, 0, 0, 0, 0, 0, 0, 0, 8084, 8288, 0, 4266, 0,
+	0, 877, 0, 0, 1489, 0, 5881, 0, 0, 6077, 8433, 0, 0, 4709, 0, 0,
+	0, 0, 1650, 2780, 6112, 3914, 5884, 3159, 0, 0, 8004, 2473, 4803, 7528, 0, 1281,
+	0, 0, 7110, 8072, 0, 3902, 8375, 0, 0, 0, 0, 0, 0, 9048, 4637, 6561,
+	8850, 2594, 8875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8331, 6905, 0, 0, 0, 6893, 2600, 5172, 0, 0, 0, 0, 0, 0, 254,
+	8265, 0, 0, 2979, 0, 0, 0, 0, 7880, 0, 7862, 3481, 7572, 0, 0, 7832,
+	0, 0, 8635, 7074, 0, 8298, 0, 0, 3997, 1897, 0, 0, 4861, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3943, 7505, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4539, 7420, 0, 0, 0, 3581, 0, 0, 0,
+	0, 0, 0, 0, 3187, 4204, 2937, 3842, 7394, 617, 3005, 9480, 6548, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 982, 0, 2911, 0, 0, 0, 0, 0, 0, 5457, 0, 0, 0, 0, 0,
+	0, 2412, 0, 0, 0, 0, 6470, 0, 0, 0, 0, 0, 1676, 0, 0, 0,
+	0, 6774, 0, 0, 0, 0, 884, 8001, 0, 0, 0, 0, 2095, 0, 3797, 0,
+	2312, 0, 0, 0, 3450, 0, 0, 2628, 0, 0, 0, 0, 8609, 0, 1711, 0,
+	0, 8501, 3111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9509, 0, 0, 0, 0, 0, 0, 0, 0, 8953, 0, 0, 4749, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 363, 3584, 4866, 0, 8157, 0, 8236,
+	9236, 0, 0, 2698, 8877, 0, 9152, 0, 0, 0, 0, 5422, 4385, 0, 0, 0,
+	0, 0, 0, 920, 0, 0, 3880, 6834, 9134, 0, 0, 0, 0, 1563, 7800, 0,
+	0, 0, 0, 8806, 0, 0, 0, 0, 6313, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2025, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1582, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6781, 0, 0, 0, 2043, 1638, 6047,
+	4145, 4225, 5870, 9014, 0, 9266, 9544, 0, 0, 0, 3254, 0, 0, 1483, 0, 1390,
+	0, 0, 0, 0, 0, 0, 2479, 2986, 4663, 0, 0, 0, 0, 0, 0, 2048,
+	0, 6944, 4352, 0, 0, 4268, 0, 0, 0, 0, 0, 0, 0, 0, 6603, 0,
+	0, 0, 0, 0, 1122, 6956, 5299, 0, 0, 0, 0, 0, 0, 0, 0, 1880,
+	0, 5006, 0, 0, 7579, 0, 5910, 6037, 0, 0, 0, 0, 5974, 0, 488, 0,
+	0, 0, 0, 0, 3725, 0, 0, 9101, 0, 445, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4409, 8929, 7073, 8960, 9440, 0, 0, 0, 0, 2245, 0, 0, 5133,
+	0, 5853, 0, 1942, 0, 0, 0, 0, 0, 2922, 0, 5688, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5510, 0, 0, 0, 6665, 0, 0, 4178, 9091, 6287, 0,
+	0, 0, 0, 0, 0, 0, 0, 6391, 0, 8670, 0, 0, 0, 0, 9156, 0,
+	0, 0, 0, 0, 3812, 0, 0, 0, 0, 0, 0, 0, 0, 3477, 0, 3007,
+	4125, 0, 7150, 0, 0, 1684, 0, 0, 1774, 3158, 1383, 0, 0, 0, 0, 0,
+	0, 0, 0, 7727, 0, 0, 4459, 8626, 8641, 0, 55, 185, 0, 7811, 0, 0,
+	3491, 0, 2564, 4372, 1429, 0, 0, 4104, 0, 0, 0, 0, 0, 0, 1885, 5284,
+	0, 8547, 0, 0, 0, 0, 4698, 0, 0, 801, 0, 0, 0, 0, 0, 1079,
+	0, 0, 0, 0, 0, 802, 5071, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2821, 9096, 0, 0, 0, 0,
+	0, 2274, 1760, 0, 0, 0, 0, 6286, 0, 5899, 0, 0, 5561, 0, 0, 0,
+	0, 3587, 0, 3480, 0, 0, 0, 4111, 8731, 0, 0, 1068, 0, 9132, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3671, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5683, 8003, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4477, 4777, 0, 0, 0, 0, 0, 0, 0,
+	4285, 4649, 1070, 0, 0, 0, 1049, 5467, 0, 0, 0, 0, 0, 0, 2524, 0,
+	0, 0, 4782, 915, 9242, 0, 0, 0, 4447, 3848, 0, 0, 741, 4403, 7258, 0,
+	9167, 0, 0, 9499, 0, 0, 31, 0, 4335, 0, 0, 0, 0, 3324, 0, 672,
+	8738, 0, 0, 8724, 8597, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4902, 0, 8722, 0, 0, 0, 0, 0, 0, 0, 0, 5186, 2998, 0, 2720, 2871,
+};
+
+}  // namespace ada::public_suffix::details
+#endif  // ADA_PUBLIC_SUFFIX_TABLES_H
@@ -0,0 +1,142 @@
+#include "ada/stats.h"
+
+#if ADA_STATS
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif  // ADA_STATS
+
+namespace ada::stats {
+
+#if ADA_STATS
+namespace details {
+
+constexpr size_t total_count = state_count + counter_count;
+
+struct thread_counters;
+
+/**
+ * The counters of the live threads, and the totals of the threads that have
+ * exited.
+ */
+struct registry {
+  std::mutex lock{};
+  std::vector<thread_counters*> live{};
+  std::array<uint64_t, total_count> retired{};
+};
+
+/**
+ * The registry is never destroyed: threads may exit (and retire their
+ * counters) after the static destructors have run.
+ */
+registry& get_registry() {
+  static registry* instance = new registry();
+  return *instance;
+}
+
+/**
+ * Counters of one thread. Only the owning thread writes them, other threads
+ * read them in get().
+ */
+struct thread_counters {
+  std::array<std::atomic<uint64_t>, total_count> values{};
+
+  thread_counters() {
+    registry& r = get_registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    r.live.push_back(this);
+  }
+
+  thread_counters(const thread_counters&) = delete;
+  thread_counters& operator=(const thread_counters&) = delete;
+
+  ~thread_counters() {
+    registry& r = get_registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    for (size_t i = 0; i < total_count; i++) {
+      r.retired[i] += values[i].load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < r.live.size(); i++) {
+      if (r.live[i] == this) {
+        r.live[i] = r.live.back();
+        r.live.pop_back();
+        break;
+      }
+    }
+  }
+};
+
+void increment(size_t index) noexcept {
+  thread_local thread_counters counters;
+  std::atomic<uint64_t>& value = counters.values[index];
+  // Only this thread writes the counter: no need for an atomic addition.
+  value.store(value.load(std::memory_order_relaxed) + 1,
+              std::memory_order_relaxed);
+}
+
+}  // namespace details
+
+snapshot get() {
+  std::array<uint64_t, details::total_count> totals{};
+  details::registry& r = details::get_registry();
+  {
+    std::lock_guard<std::mutex> guard(r.lock);
+    totals = r.retired;
+    for (const details::thread_counters* counters : r.live) {
+      for (size_t i = 0; i < details::total_count; i++) {
+        totals[i] += counters->values[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+  snapshot answer{};
+  for (size_t i = 0; i < state_count; i++) {
+    answer.states[i] = totals[i];
+  }
+  for (size_t i = 0; i < counter_count; i++) {
+    answer.counters[i] = totals[state_count + i];
+  }
+  return answer;
+}
+
+void reset() {
+  details::registry& r = details::get_registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  r.retired.fill(0);
+  for (details::thread_counters* counters : r.live) {
+    for (std::atomic<uint64_t>& value : counters->values) {
+      value.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+#else
+namespace details {
+void increment(size_t) noexcept {}
+}  // namespace details
+
+snapshot get() { return {}; }
+
+void reset() {}
+#endif  // ADA_STATS
+
+std::string_view to_string(counter c) {
+  switch (c) {
+    case counter::PARSE:
+      return "PARSE";
+    case counter::TABS_OR_NEWLINE:
+      return "TABS_OR_NEWLINE";
+    case counter::BASE_RESOLUTION:
+      return "BASE_RESOLUTION";
+    case counter::IPV4_FAST_PATH:
+      return "IPV4_FAST_PATH";
+    case counter::IDNA:
+      return "IDNA";
+    case counter::PATH_PERCENT_ENCODING:
+      return "PATH_PERCENT_ENCODING";
+    case counter::DOT_SEGMENT:
+      return "DOT_SEGMENT";
+    default:
+      return "unknown counter";
+  }
+}
+
+}  // namespace ada::stats
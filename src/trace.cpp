@@ -0,0 +1,456 @@
+#include "ada/trace.h"
+#include "ada/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#if ADA_LOGGING
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif  // ADA_LOGGING
+
+namespace ada::trace {
+
+file_sink::file_sink(const char* filename) : file(std::fopen(filename, "wb")) {
+  if (file == nullptr) {
+    return;
+  }
+  uint8_t header[12];
+  std::memcpy(header, file_magic.data(), file_magic.size());
+  uint32_t size = sizeof(event);
+  for (size_t i = 0; i < 4; i++) {
+    header[8 + i] = uint8_t(size >> (8 * i));
+  }
+  std::fwrite(header, 1, sizeof(header), file);
+}
+
+file_sink::~file_sink() {
+  if (file != nullptr) {
+    std::fclose(file);
+  }
+}
+
+void file_sink::write(const event* events, size_t count) {
+  if (file != nullptr) {
+    std::fwrite(events, sizeof(event), count, file);
+  }
+}
+
+void file_sink::flush() {
+  if (file != nullptr) {
+    std::fflush(file);
+  }
+}
+
+struct text_sink::pending_messages {
+  std::unordered_map<uint32_t, std::string> by_thread{};
+};
+
+text_sink::text_sink(std::ostream& output)
+    : out(output), pending(new pending_messages()) {}
+
+text_sink::~text_sink() = default;
+
+void text_sink::write(const event* events, size_t count) {
+  std::string line;
+  for (size_t i = 0; i < count; i++) {
+    const event& e = events[i];
+    if (e.kind == event_kind::MESSAGE) {
+      std::string& message = pending->by_thread[e.thread];
+      message.append(e.payload.text, std::min<size_t>(e.length, 32));
+      if (e.state == 0) {
+        out << "ADA_LOG: " << message << '\n';
+        pending->by_thread.erase(e.thread);
+      }
+      continue;
+    }
+    line.clear();
+    append_description(e, line);
+    out << line << '\n';
+  }
+}
+
+void text_sink::flush() { out.flush(); }
+
+void append_description(const event& e, std::string& out) {
+  out += "ADA_TRACE: [";
+  out += std::to_string(e.timestamp);
+  out += " ns] thread ";
+  out += std::to_string(e.thread);
+  switch (e.kind) {
+    case event_kind::STATE:
+      out += " state ";
+      out += e.state <= uint8_t(ada::state::PORT)
+                 ? ada::to_string(ada::state(e.state))
+                 : "unknown state";
+      out += " at ";
+      out += std::to_string(e.position);
+      out += " out of ";
+      out += std::to_string(e.input_size);
+      break;
+    case event_kind::RESULT: {
+      out += e.state ? " valid url (" : " invalid url (";
+      out += std::to_string(e.input_size);
+      out += " bytes)";
+      constexpr const char* names[] = {
+          "protocol_end",   "username_end", "host_start",   "host_end",
+          "port",           "pathname_start", "search_start", "hash_start"};
+      for (size_t i = 0; i < 8; i++) {
+        out += ' ';
+        out += names[i];
+        out += '=';
+        out += e.payload.components[i] == ada::url_components::omitted
+                   ? "omitted"
+                   : std::to_string(e.payload.components[i]);
+      }
+      break;
+    }
+    case event_kind::MESSAGE:
+      out += " message (";
+      out += std::to_string(e.length);
+      out += e.state ? " bytes, continued)" : " bytes)";
+      break;
+    case event_kind::DROPPED:
+      out += " dropped ";
+      out += std::to_string(e.position);
+      out += " events";
+      break;
+    default:
+      out += " unknown event";
+  }
+}
+
+#if ADA_LOGGING
+namespace details {
+
+constexpr size_t ring_capacity = size_t(1) << 12;
+
+struct ring;
+
+/**
+ * The ring buffers of the live threads, the sink and the background thread.
+ * The registry is never destroyed: threads may exit (and drain their ring
+ * buffer) after the static destructors have run.
+ */
+struct registry {
+  std::mutex lock{};
+  std::vector<ring*> rings{};
+  sink* destination{new text_sink(std::cerr)};
+  uint32_t next_thread{0};
+  std::thread drainer{};
+  std::condition_variable wake{};
+  bool running{false};
+  bool started{false};
+};
+
+registry& get_registry() {
+  static registry* instance = new registry();
+  return *instance;
+}
+
+/**
+ * Single-producer single-consumer ring buffer: the owning thread appends
+ * events without locking, the events are removed under the registry lock.
+ */
+struct ring {
+  std::unique_ptr<event[]> events{new event[ring_capacity]};
+  /** Written by the owning thread only. */
+  std::atomic<uint64_t> head{0};
+  /** Written under the registry lock only. */
+  std::atomic<uint64_t> tail{0};
+  /** Events dropped since the last DROPPED event (owning thread). */
+  uint64_t dropped{0};
+  uint32_t thread{0};
+
+  /**
+   * May throw, before the ring buffer is registered: the thread then has no
+   * ring buffer, see local_ring.
+   */
+  ring() {
+    registry& r = get_registry();
+    bool should_start;
+    {
+      std::lock_guard<std::mutex> guard(r.lock);
+      should_start = !r.started;
+    }
+    if (should_start) {
+      start();
+    }
+    std::lock_guard<std::mutex> guard(r.lock);
+    r.rings.push_back(this);
+    thread = r.next_thread++;
+  }
+
+  ring(const ring&) = delete;
+  ring& operator=(const ring&) = delete;
+
+  ~ring() {
+    registry& r = get_registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    move_to(r.destination);
+    if (r.destination != nullptr) {
+      r.destination->flush();
+    }
+    for (size_t i = 0; i < r.rings.size(); i++) {
+      if (r.rings[i] == this) {
+        r.rings[i] = r.rings.back();
+        r.rings.pop_back();
+        break;
+      }
+    }
+  }
+
+  bool try_push(const event& e) noexcept {
+    uint64_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= ring_capacity) {
+      return false;
+    }
+    events[h % ring_capacity] = e;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  void push(event& e) noexcept {
+    e.thread = thread;
+    if (dropped > 0) {
+      event lost{};
+      lost.timestamp = e.timestamp;
+      lost.thread = thread;
+      lost.kind = event_kind::DROPPED;
+      lost.position = uint32_t(dropped);
+      if (!try_push(lost)) {
+        dropped++;
+        return;
+      }
+      dropped = 0;
+    }
+    if (!try_push(e)) {
+      dropped++;
+    }
+  }
+
+  /**
+   * Removes all the events, passing them to the sink. Requires the registry
+   * lock.
+   */
+  void move_to(sink* destination) {
+    uint64_t h = head.load(std::memory_order_acquire);
+    uint64_t t = tail.load(std::memory_order_relaxed);
+    while (t < h) {
+      size_t begin = size_t(t % ring_capacity);
+      size_t count = size_t(std::min<uint64_t>(h - t, ring_capacity - begin));
+      if (destination != nullptr) {
+        destination->write(events.get() + begin, count);
+      }
+      t += count;
+    }
+    tail.store(t, std::memory_order_release);
+  }
+};
+
+/**
+ * The ring buffer of the thread, created on first use. Returns nullptr if it
+ * could not be created (e.g., out of memory): the events are then dropped,
+ * since the emitting functions must not throw. The creation is retried on
+ * the next event.
+ */
+ring* local_ring() noexcept {
+  try {
+    thread_local ring answer;
+    return &answer;
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+event make_event(event_kind kind) noexcept {
+  event e{};
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  e.timestamp = uint64_t(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+  e.kind = kind;
+  return e;
+}
+
+void drain_locked(registry& r) {
+  for (ring* buffer : r.rings) {
+    buffer->move_to(r.destination);
+  }
+  if (r.destination != nullptr) {
+    r.destination->flush();
+  }
+}
+
+void emit_state(ada::state s, size_t position, size_t input_size) noexcept {
+  event e = make_event(event_kind::STATE);
+  e.state = uint8_t(s);
+  e.position = uint32_t(position);
+  e.input_size = uint32_t(input_size);
+  ring* buffer = local_ring();
+  if (buffer != nullptr) {
+    buffer->push(e);
+  }
+}
+
+void emit_result(bool is_valid, const ada::url_components& components,
+                 size_t input_size) noexcept {
+  event e = make_event(event_kind::RESULT);
+  e.state = is_valid;
+  e.input_size = uint32_t(input_size);
+  e.payload.components[0] = components.protocol_end;
+  e.payload.components[1] = components.username_end;
+  e.payload.components[2] = components.host_start;
+  e.payload.components[3] = components.host_end;
+  e.payload.components[4] = components.port;
+  e.payload.components[5] = components.pathname_start;
+  e.payload.components[6] = components.search_start;
+  e.payload.components[7] = components.hash_start;
+  ring* buffer = local_ring();
+  if (buffer != nullptr) {
+    buffer->push(e);
+  }
+}
+
+void emit_message(std::string_view text) noexcept {
+  ring* buffer = local_ring();
+  if (buffer == nullptr) {
+    return;
+  }
+  do {
+    event e = make_event(event_kind::MESSAGE);
+    size_t length = std::min(text.size(), sizeof(e.payload.text));
+    std::memcpy(e.payload.text, text.data(), length);
+    e.length = uint16_t(length);
+    text.remove_prefix(length);
+    e.state = !text.empty();
+    buffer->push(e);
+  } while (!text.empty());
+}
+
+/**
+ * The buffer of message_stream: unlike std::stringbuf, it gives a view of
+ * its content and keeps its capacity from one message to the next.
+ */
+class message_buffer : public std::streambuf {
+ public:
+  [[nodiscard]] std::string_view view() const noexcept { return text; }
+  void clear() noexcept { text.clear(); }
+
+ protected:
+  int_type overflow(int_type c) override {
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      text.push_back(traits_type::to_char_type(c));
+    }
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char* s, std::streamsize count) override {
+    text.append(s, size_t(count));
+    return count;
+  }
+
+ private:
+  std::string text{};
+};
+
+struct message_state {
+  message_buffer buffer{};
+  std::ostream stream{&buffer};
+};
+
+message_state& local_message() {
+  thread_local message_state answer;
+  return answer;
+}
+
+std::ostream& message_stream() { return local_message().stream; }
+
+void emit_formatted_message() noexcept {
+  message_buffer& buffer = local_message().buffer;
+  emit_message(buffer.view());
+  buffer.clear();
+}
+
+}  // namespace details
+
+bool enabled() noexcept { return true; }
+
+void set_sink(sink* destination) {
+  details::registry& r = details::get_registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  details::drain_locked(r);
+  r.destination = destination;
+}
+
+void start(std::chrono::milliseconds period) {
+  details::registry& r = details::get_registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  r.started = true;
+  if (r.running) {
+    return;
+  }
+  // Set once the thread exists: std::thread throws if it cannot start one.
+  r.drainer = std::thread([&r, period]() {
+    std::unique_lock<std::mutex> lock(r.lock);
+    while (r.running) {
+      r.wake.wait_for(lock, period);
+      details::drain_locked(r);
+    }
+  });
+  r.running = true;
+}
+
+void stop() {
+  details::registry& r = details::get_registry();
+  {
+    std::lock_guard<std::mutex> guard(r.lock);
+    if (!r.running) {
+      return;
+    }
+    r.running = false;
+  }
+  r.wake.notify_all();
+  r.drainer.join();
+  drain();
+}
+
+void drain() {
+  details::registry& r = details::get_registry();
+  std::lock_guard<std::mutex> guard(r.lock);
+  details::drain_locked(r);
+}
+#else
+namespace details {
+void emit_state(ada::state, size_t, size_t) noexcept {}
+
+void emit_result(bool, const ada::url_components&, size_t) noexcept {}
+
+void emit_message(std::string_view) noexcept {}
+
+std::ostream& message_stream() {
+  // Without a buffer, the stream discards what is written to it.
+  thread_local std::ostream stream{nullptr};
+  return stream;
+}
+
+void emit_formatted_message() noexcept {}
+}  // namespace details
+
+bool enabled() noexcept { return false; }
+
+void set_sink(sink*) {}
+
+void start(std::chrono::milliseconds) {}
+
+void stop() {}
+
+void drain() {}
+#endif  // ADA_LOGGING
+
+}  // namespace ada::trace
@@ -8,6 +8,7 @@ ADA_PUSH_DISABLE_ALL_WARNINGS
 ADA_POP_DISABLE_WARNINGS
 
 #include <algorithm>
+#include <utility>
 #if ADA_NEON
 #include <arm_neon.h>
 #elif ADA_SSE2
@@ -151,6 +152,370 @@ ada_really_inline bool has_tabs_or_newline(
 }
 #endif
 
+#if ADA_NEON
+ada_really_inline bool is_ascii(std::string_view input) noexcept {
+  size_t i = 0;
+  uint8x16_t running = vdupq_n_u8(0);
+  for (; i + 15 < input.size(); i += 16) {
+    running = vorrq_u8(running, vld1q_u8((const uint8_t*)input.data() + i));
+  }
+  uint8_t tail = 0;
+  for (; i < input.size(); i++) {
+    tail |= uint8_t(input[i]);
+  }
+  return (vmaxvq_u8(running) | tail) < 0x80;
+}
+#elif ADA_SSE2
+ada_really_inline bool is_ascii(std::string_view input) noexcept {
+  size_t i = 0;
+  __m128i running = _mm_setzero_si128();
+  for (; i + 15 < input.size(); i += 16) {
+    running = _mm_or_si128(
+        running, _mm_loadu_si128((const __m128i*)(input.data() + i)));
+  }
+  uint8_t tail = 0;
+  for (; i < input.size(); i++) {
+    tail |= uint8_t(input[i]);
+  }
+  return _mm_movemask_epi8(running) == 0 && tail < 0x80;
+}
+#else
+ada_really_inline bool is_ascii(std::string_view input) noexcept {
+  size_t i = 0;
+  uint64_t running{0};
+  for (; i + 7 < input.size(); i += 8) {
+    uint64_t word{};
+    memcpy(&word, input.data() + i, sizeof(word));
+    running |= word;
+  }
+  if (i < input.size()) {
+    uint64_t word{};
+    memcpy(&word, input.data() + i, input.size() - i);
+    running |= word;
+  }
+  return (running & broadcast(0x80)) == 0;
+}
+#endif
+
+/**
+ * Copies the 16 ASCII bytes of block to output without the ASCII tabs and
+ * newlines, possibly in place. Returns the number of bytes written.
+ */
+ada_really_inline size_t remove_tabs_or_newline_block(const char* block,
+                                                      char* output) noexcept {
+  size_t written = 0;
+  for (size_t k = 0; k < 16; k++) {
+    output[written] = block[k];
+    written += !is_tabs_or_newline(block[k]);
+  }
+  return written;
+}
+
+#if ADA_NEON
+/**
+ * If the 16 code units at input are ASCII, writes them to output, without
+ * the ASCII tabs and newlines, and returns the number of bytes written.
+ * Otherwise, returns -1 and output is unspecified.
+ */
+ada_really_inline ptrdiff_t narrow_ascii_block(const char16_t* input,
+                                               char* output) noexcept {
+  const uint16x8_t low = vld1q_u16((const uint16_t*)input);
+  const uint16x8_t high = vld1q_u16((const uint16_t*)input + 8);
+  if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80) {
+    return -1;
+  }
+  const uint8x16_t bytes = vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+  vst1q_u8((uint8_t*)output, bytes);
+  // See has_tabs_or_newline for the table lookup.
+  static uint8_t rnt_array[16] = {1, 0, 0,  0, 0, 0,  0, 0,
+                                  0, 9, 10, 0, 0, 13, 0, 0};
+  const uint8x16_t rnt = vld1q_u8(rnt_array);
+  if (vmaxvq_u8(vceqq_u8(vqtbl1q_u8(rnt, bytes), bytes)) == 0) {
+    return 16;
+  }
+  return ptrdiff_t(remove_tabs_or_newline_block(output, output));
+}
+
+/** As narrow_ascii_block, for 16 Latin-1 characters. */
+ada_really_inline ptrdiff_t copy_ascii_block(const char* input,
+                                             char* output) noexcept {
+  const uint8x16_t bytes = vld1q_u8((const uint8_t*)input);
+  if (vmaxvq_u8(bytes) >= 0x80) {
+    return -1;
+  }
+  vst1q_u8((uint8_t*)output, bytes);
+  static uint8_t rnt_array[16] = {1, 0, 0,  0, 0, 0,  0, 0,
+                                  0, 9, 10, 0, 0, 13, 0, 0};
+  const uint8x16_t rnt = vld1q_u8(rnt_array);
+  if (vmaxvq_u8(vceqq_u8(vqtbl1q_u8(rnt, bytes), bytes)) == 0) {
+    return 16;
+  }
+  return ptrdiff_t(remove_tabs_or_newline_block(input, output));
+}
+#elif ADA_SSE2
+ada_really_inline bool has_tabs_or_newline_block(__m128i bytes) noexcept {
+  const __m128i found =
+      _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')),
+                                _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))),
+                   _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+  return _mm_movemask_epi8(found) != 0;
+}
+
+/**
+ * If the 16 code units at input are ASCII, writes them to output, without
+ * the ASCII tabs and newlines, and returns the number of bytes written.
+ * Otherwise, returns -1 and output is unspecified.
+ */
+ada_really_inline ptrdiff_t narrow_ascii_block(const char16_t* input,
+                                               char* output) noexcept {
+  const __m128i low = _mm_loadu_si128((const __m128i*)input);
+  const __m128i high = _mm_loadu_si128((const __m128i*)(input + 8));
+  const __m128i non_ascii = _mm_and_si128(_mm_or_si128(low, high),
+                                          _mm_set1_epi16(int16_t(0xff80)));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(non_ascii, _mm_setzero_si128())) !=
+      0xffff) {
+    return -1;
+  }
+  const __m128i bytes = _mm_packus_epi16(low, high);
+  _mm_storeu_si128((__m128i*)output, bytes);
+  if (!has_tabs_or_newline_block(bytes)) {
+    return 16;
+  }
+  return ptrdiff_t(remove_tabs_or_newline_block(output, output));
+}
+
+/** As narrow_ascii_block, for 16 Latin-1 characters. */
+ada_really_inline ptrdiff_t copy_ascii_block(const char* input,
+                                             char* output) noexcept {
+  const __m128i bytes = _mm_loadu_si128((const __m128i*)input);
+  if (_mm_movemask_epi8(bytes) != 0) {
+    return -1;
+  }
+  _mm_storeu_si128((__m128i*)output, bytes);
+  if (!has_tabs_or_newline_block(bytes)) {
+    return 16;
+  }
+  return ptrdiff_t(remove_tabs_or_newline_block(input, output));
+}
+#else
+/**
+ * If the 16 code units at input are ASCII, writes them to output, without
+ * the ASCII tabs and newlines, and returns the number of bytes written.
+ * Otherwise, returns -1 and output is unspecified.
+ */
+ada_really_inline ptrdiff_t narrow_ascii_block(const char16_t* input,
+                                               char* output) noexcept {
+  char16_t running = 0;
+  for (size_t k = 0; k < 16; k++) {
+    running = char16_t(running | input[k]);
+  }
+  if (running >= 0x80) {
+    return -1;
+  }
+  size_t written = 0;
+  for (size_t k = 0; k < 16; k++) {
+    output[written] = char(input[k]);
+    written += !is_tabs_or_newline(char(input[k]));
+  }
+  return ptrdiff_t(written);
+}
+
+/** As narrow_ascii_block, for 16 Latin-1 characters. */
+ada_really_inline ptrdiff_t copy_ascii_block(const char* input,
+                                             char* output) noexcept {
+  if (!is_ascii(std::string_view(input, 16))) {
+    return -1;
+  }
+  return ptrdiff_t(remove_tabs_or_newline_block(input, output));
+}
+#endif
+
+/**
+ * Returns the range of input without its leading and trailing C0 control or
+ * space code units.
+ */
+template <typename char_type>
+ada_really_inline std::pair<size_t, size_t> trim_c0_control_or_space(
+    const char_type* input, size_t length) noexcept {
+  size_t start = 0;
+  size_t end = length;
+  while (start < end && uint16_t(input[start]) <= 0x20) {
+    start++;
+  }
+  while (end > start && uint16_t(input[end - 1]) <= 0x20) {
+    end--;
+  }
+  return {start, end};
+}
+
+size_t utf16_to_url_input(std::u16string_view input, char* output) noexcept {
+  const auto [start, end] = trim_c0_control_or_space(input.data(),
+                                                     input.size());
+  const char16_t* data = input.data();
+  char* out = output;
+  size_t i = start;
+  while (i < end) {
+    // Most URLs are ASCII: we narrow them 16 code units at a time.
+    const size_t block_end = std::min(i + 16, end);
+    if (block_end == i + 16) {
+      const ptrdiff_t written = narrow_ascii_block(data + i, out);
+      if (written >= 0) {
+        out += written;
+        i += 16;
+        continue;
+      }
+    }
+    while (i < block_end) {
+      const char16_t c = data[i++];
+      if (c < 0x80) {
+        *out = char(c);
+        out += !is_tabs_or_newline(char(c));
+      } else if (c < 0x800) {
+        *out++ = char(0xc0 | (c >> 6));
+        *out++ = char(0x80 | (c & 0x3f));
+      } else if (c >= 0xd800 && c <= 0xdbff && i < end && data[i] >= 0xdc00 &&
+                 data[i] <= 0xdfff) {
+        const uint32_t code_point =
+            0x10000 + ((uint32_t(c) - 0xd800) << 10) + (data[i++] - 0xdc00);
+        *out++ = char(0xf0 | (code_point >> 18));
+        *out++ = char(0x80 | ((code_point >> 12) & 0x3f));
+        *out++ = char(0x80 | ((code_point >> 6) & 0x3f));
+        *out++ = char(0x80 | (code_point & 0x3f));
+      } else if (c >= 0xd800 && c <= 0xdfff) {
+        // An unpaired surrogate becomes U+FFFD, as in the conversion of a
+        // JavaScript string to a USVString.
+        *out++ = char(0xef);
+        *out++ = char(0xbf);
+        *out++ = char(0xbd);
+      } else {
+        *out++ = char(0xe0 | (c >> 12));
+        *out++ = char(0x80 | ((c >> 6) & 0x3f));
+        *out++ = char(0x80 | (c & 0x3f));
+      }
+    }
+  }
+  return size_t(out - output);
+}
+
+size_t latin1_to_url_input(std::string_view input, char* output) noexcept {
+  const auto [start, end] = trim_c0_control_or_space(input.data(),
+                                                     input.size());
+  const char* data = input.data();
+  char* out = output;
+  size_t i = start;
+  while (i < end) {
+    const size_t block_end = std::min(i + 16, end);
+    if (block_end == i + 16) {
+      const ptrdiff_t written = copy_ascii_block(data + i, out);
+      if (written >= 0) {
+        out += written;
+        i += 16;
+        continue;
+      }
+    }
+    for (; i < block_end; i++) {
+      const auto c = uint8_t(data[i]);
+      if (c < 0x80) {
+        *out = char(c);
+        out += !is_tabs_or_newline(char(c));
+      } else {
+        *out++ = char(0xc0 | (c >> 6));
+        *out++ = char(0x80 | (c & 0x3f));
+      }
+    }
+  }
+  return size_t(out - output);
+}
+
+#if ADA_NEON
+/**
+ * If the 16 bytes at input are ASCII, widens them to output and returns
+ * true. Otherwise, returns false and output is unspecified.
+ */
+ada_really_inline bool widen_ascii_block(const char* input,
+                                         char16_t* output) noexcept {
+  const uint8x16_t bytes = vld1q_u8((const uint8_t*)input);
+  if (vmaxvq_u8(bytes) >= 0x80) {
+    return false;
+  }
+  vst1q_u16((uint16_t*)output, vmovl_u8(vget_low_u8(bytes)));
+  vst1q_u16((uint16_t*)output + 8, vmovl_u8(vget_high_u8(bytes)));
+  return true;
+}
+#elif ADA_SSE2
+/**
+ * If the 16 bytes at input are ASCII, widens them to output and returns
+ * true. Otherwise, returns false and output is unspecified.
+ */
+ada_really_inline bool widen_ascii_block(const char* input,
+                                         char16_t* output) noexcept {
+  const __m128i bytes = _mm_loadu_si128((const __m128i*)input);
+  if (_mm_movemask_epi8(bytes) != 0) {
+    return false;
+  }
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128((__m128i*)output, _mm_unpacklo_epi8(bytes, zero));
+  _mm_storeu_si128((__m128i*)(output + 8), _mm_unpackhi_epi8(bytes, zero));
+  return true;
+}
+#else
+/**
+ * If the 16 bytes at input are ASCII, widens them to output and returns
+ * true. Otherwise, returns false and output is unspecified.
+ */
+ada_really_inline bool widen_ascii_block(const char* input,
+                                         char16_t* output) noexcept {
+  if (!is_ascii(std::string_view(input, 16))) {
+    return false;
+  }
+  for (size_t k = 0; k < 16; k++) {
+    output[k] = char16_t(input[k]);
+  }
+  return true;
+}
+#endif
+
+size_t utf8_to_utf16(std::string_view input, char16_t* output) noexcept {
+  const char* data = input.data();
+  const size_t length = input.size();
+  char16_t* out = output;
+  size_t i = 0;
+  while (i < length) {
+    const size_t block_end = std::min(i + 16, length);
+    if (block_end == i + 16 && widen_ascii_block(data + i, out)) {
+      out += 16;
+      i += 16;
+      continue;
+    }
+    while (i < block_end) {
+      const auto c = uint8_t(data[i]);
+      if (c < 0x80) {
+        *out++ = char16_t(c);
+        i++;
+        continue;
+      }
+      // The input is valid UTF-8: c starts a sequence of 2 to 4 bytes.
+      const size_t sequence_length = c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+      if (i + sequence_length > length) {
+        return size_t(out - output);
+      }
+      uint32_t code_point = c & (0x7f >> sequence_length);
+      for (size_t k = 1; k < sequence_length; k++) {
+        code_point = (code_point << 6) | (uint8_t(data[i + k]) & 0x3f);
+      }
+      if (code_point >= 0x10000) {
+        code_point -= 0x10000;
+        *out++ = char16_t(0xd800 + (code_point >> 10));
+        *out++ = char16_t(0xdc00 + (code_point & 0x3ff));
+      } else {
+        *out++ = char16_t(code_point);
+      }
+      i += sequence_length;
+    }
+  }
+  return size_t(out - output);
+}
+
 // A forbidden host code point is U+0000 NULL, U+0009 TAB, U+000A LF, U+000D CR,
 // U+0020 SPACE, U+0023 (#), U+002F (/), U+003A (:), U+003C (<), U+003E (>),
 // U+003F (?), U+0040 (@), U+005B ([), U+005C (\), U+005D (]), U+005E (^), or
@@ -384,6 +749,31 @@ std::string percent_decode(const std::string_view input, size_t first_percent) {
   return dest;
 }
 
+std::string percent_decode_form_urlencoded(const std::string_view input) {
+  std::string dest;
+  dest.reserve(input.length());
+  const char* pointer = input.data();
+  const char* end = input.data() + input.size();
+  while (pointer < end) {
+    const char ch = pointer[0];
+    if (ch == '+') {
+      dest += ' ';
+      pointer++;
+    } else if (ch == '%' && end - pointer > 2 &&
+               is_ascii_hex_digit(pointer[1]) &&
+               is_ascii_hex_digit(pointer[2])) {
+      unsigned a = convert_hex_to_binary(pointer[1]);
+      unsigned b = convert_hex_to_binary(pointer[2]);
+      dest += static_cast<char>(a * 16 + b);
+      pointer += 3;
+    } else {
+      dest += ch;
+      pointer++;
+    }
+  }
+  return dest;
+}
+
 std::string percent_encode(const std::string_view input,
                            const uint8_t character_set[]) {
   auto pointer =
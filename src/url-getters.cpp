@@ -11,29 +11,7 @@
 
 namespace ada {
 [[nodiscard]] std::string url::get_origin() const noexcept {
-  if (is_special()) {
-    // Return a new opaque origin.
-    if (type == scheme::FILE) {
-      return "null";
-    }
-    return ada::helpers::concat(get_protocol(), "//", get_host());
-  }
-
-  if (non_special_scheme == "blob") {
-    if (!path.empty()) {
-      auto result = ada::parse<ada::url>(path);
-      if (result &&
-          (result->type == scheme::HTTP || result->type == scheme::HTTPS)) {
-        // If pathURL's scheme is not "http" and not "https", then return a
-        // new opaque origin.
-        return ada::helpers::concat(result->get_protocol(), "//",
-                                    result->get_host());
-      }
-    }
-  }
-
-  // Return a new opaque origin.
-  return "null";
+  return ada::origin::from(*this).to_string();
 }
 
 [[nodiscard]] std::string url::get_protocol() const noexcept {
@@ -44,6 +22,70 @@ namespace ada {
   return helpers::concat(non_special_scheme, ":");
 }
 
+void url::write_href(std::string &output) const {
+  const std::string_view scheme =
+      is_special() ? ada::scheme::details::is_special_list[type]
+                   : std::string_view(non_special_scheme);
+  const std::string port_string = get_port();
+  const bool needs_path_prefix = !host.has_value() && !has_opaque_path &&
+                                 checkers::begins_with(path, "//");
+  // We compute the size of the href first so that it takes a single
+  // allocation.
+  size_t size = scheme.size() + 1 + path.size();
+  if (host.has_value()) {
+    size += 2 + host->size();
+    if (has_credentials()) {
+      size += username.size() + password.size() + 2;
+    }
+    if (port.has_value()) {
+      size += 1 + port_string.size();
+    }
+  } else if (needs_path_prefix) {
+    size += 2;
+  }
+  if (query.has_value()) {
+    size += 1 + query->size();
+  }
+  if (hash.has_value()) {
+    size += 1 + hash->size();
+  }
+  output.clear();
+  output.reserve(size);
+
+  output.append(scheme);
+  output += ':';
+  if (host.has_value()) {
+    output.append("//");
+    if (has_credentials()) {
+      output.append(username);
+      if (!password.empty()) {
+        output += ':';
+        output.append(password);
+      }
+      output += '@';
+    }
+    output.append(*host);
+    if (port.has_value()) {
+      output += ':';
+      output.append(port_string);
+    }
+  } else if (needs_path_prefix) {
+    // If url's host is null, url does not have an opaque path, url's path's
+    // size is greater than 1, and url's path[0] is the empty string, then
+    // append U+002F (/) followed by U+002E (.) to output.
+    output.append("/.");
+  }
+  output.append(path);
+  if (query.has_value()) {
+    output += '?';
+    output.append(*query);
+  }
+  if (hash.has_value()) {
+    output += '#';
+    output.append(*hash);
+  }
+}
+
 [[nodiscard]] std::string url::get_host() const noexcept {
   // If url's host is null, then return the empty string.
   // If url's port is null, return url's host, serialized.
@@ -463,12 +463,14 @@ ada_really_inline bool url::parse_host(std::string_view input) {
     host = std::move(buffer);
     if (checkers::is_ipv4(host.value())) {
       ada_log("parse_host fast path ipv4");
+      ada_stats_count(ada::stats::counter::IPV4_FAST_PATH);
       return parse_ipv4(host.value());
     }
     ada_log("parse_host fast path ", *host);
     return true;
   }
   ada_log("parse_host calling to_ascii");
+  ada_stats_count(ada::stats::counter::IDNA);
   is_valid = ada::unicode::to_ascii(host, input, input.find('%'));
   if (!is_valid) {
     ada_log("parse_host to_ascii returns false");
@@ -589,4 +591,62 @@ ada_really_inline void url::parse_path(std::string_view input) {
   return checkers::verify_dns_length(host.value());
 }
 
+url_aggregator url::to_aggregator() const {
+  ada_log("url::to_aggregator");
+  url_aggregator out;
+  out.is_valid = is_valid;
+  out.has_opaque_path = has_opaque_path;
+  out.host_type = host_type;
+  out.type = type;
+  if (!is_valid) {
+    return out;
+  }
+  write_href(out.buffer);
+  // The components follow the layout of the href written by write_href.
+  url_components &components = out.components;
+  components.protocol_end = uint32_t(
+      (is_special() ? ada::scheme::details::is_special_list[type].size()
+                    : non_special_scheme.size()) +
+      1);
+  uint32_t index = components.protocol_end;
+  if (host.has_value()) {
+    index += 2;  // "//"
+    components.username_end = index;
+    components.host_start = index;
+    if (has_credentials()) {
+      components.username_end += uint32_t(username.size());
+      components.host_start = components.username_end;
+      if (!password.empty()) {
+        components.host_start += uint32_t(password.size() + 1);
+      }
+      // The host starts at the '@'.
+      index = components.host_start + 1;
+    }
+    components.host_end = index + uint32_t(host->size());
+    index = components.host_end;
+    if (port.has_value()) {
+      components.port = *port;
+      index += uint32_t(helpers::fast_digit_count(*port) + 1);
+    }
+  } else {
+    components.username_end = index;
+    components.host_start = index;
+    components.host_end = index;
+    if (!has_opaque_path && checkers::begins_with(path, "//")) {
+      index += 2;  // "/."
+    }
+  }
+  components.pathname_start = index;
+  index += uint32_t(path.size());
+  if (query.has_value()) {
+    components.search_start = index;
+    index += uint32_t(query->size() + 1);
+  }
+  if (hash.has_value()) {
+    components.hash_start = index;
+  }
+  ADA_ASSERT_TRUE(out.validate());
+  return out;
+}
+
 }  // namespace ada
@@ -8,8 +8,10 @@
 #include "ada/url_aggregator.h"
 #include "ada/url_aggregator-inl.h"
 
+#include <algorithm>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace ada {
 template <bool has_state_override>
@@ -407,6 +409,258 @@ void url_aggregator::set_hash(const std::string_view input) {
   ADA_ASSERT_TRUE(validate());
 }
 
+void url_aggregator::erase_search_range(uint32_t start, uint32_t end) {
+  ada_log("url_aggregator::erase_search_range ", start, " ", end);
+  ADA_ASSERT_TRUE(components.search_start != url_components::omitted);
+  const uint32_t query_end = components.hash_start == url_components::omitted
+                                 ? uint32_t(buffer.size())
+                                 : components.hash_start;
+  ADA_ASSERT_TRUE(start > components.search_start && end <= query_end);
+  if (start == components.search_start + 1 && end == query_end) {
+    // If the serialized query is the empty string, it is set to null.
+    clear_search();
+    helpers::strip_trailing_spaces_from_opaque_path(*this);
+    return;
+  }
+  buffer.erase(start, end - start);
+  if (components.hash_start != url_components::omitted) {
+    components.hash_start -= end - start;
+  }
+  ADA_ASSERT_TRUE(validate());
+}
+
+void url_aggregator::set_search_param(const std::string_view key,
+                                      const std::string_view value) {
+  ada_log("url_aggregator::set_search_param ", key, "=", value);
+  ADA_ASSERT_TRUE(validate());
+  ADA_ASSERT_TRUE(!helpers::overlaps(key, buffer));
+  ADA_ASSERT_TRUE(!helpers::overlaps(value, buffer));
+  auto encode = [](std::string_view input) {
+    std::string out = ada::unicode::percent_encode(
+        input, ada::character_sets::WWW_FORM_URLENCODED_PERCENT_ENCODE);
+    std::replace(out.begin(), out.end(), ' ', '+');
+    return out;
+  };
+  // We only need to decode the keys that contain '+' or '%'.
+  auto key_matches = [key](std::string_view candidate) {
+    if (candidate.find_first_of("%+") == std::string_view::npos) {
+      return candidate == key;
+    }
+    return unicode::percent_decode_form_urlencoded(candidate) == key;
+  };
+  const std::string encoded_value = encode(value);
+
+  if (components.search_start == url_components::omitted) {
+    update_base_search(helpers::concat(encode(key), "=", encoded_value));
+    ADA_ASSERT_TRUE(validate());
+    return;
+  }
+
+  const uint32_t query_start = components.search_start + 1;
+  const uint32_t query_end = components.hash_start == url_components::omitted
+                                 ? uint32_t(buffer.size())
+                                 : components.hash_start;
+  std::string_view query =
+      helpers::substring(buffer, query_start, query_end);
+  size_t parameter_start = 0;
+  while (true) {
+    size_t parameter_end = query.find('&', parameter_start);
+    if (parameter_end == std::string_view::npos) {
+      parameter_end = query.size();
+    }
+    std::string_view parameter =
+        query.substr(parameter_start, parameter_end - parameter_start);
+    size_t equal = parameter.find('=');
+    if (!parameter.empty() && key_matches(parameter.substr(0, equal))) {
+      // We first remove the duplicates that follow: the offsets of the
+      // parameter we update remain valid.
+      if (parameter_end != query.size()) {
+        auto is_duplicate = [&key_matches](std::string_view k,
+                                           std::string_view) {
+          return key_matches(k);
+        };
+        remove_search_params_from(query_start + uint32_t(parameter_end) + 1,
+                                  is_duplicate);
+      }
+      uint32_t difference;
+      if (equal == std::string_view::npos) {
+        const uint32_t insert_at = query_start + uint32_t(parameter_end);
+        buffer.insert(insert_at, "=");
+        buffer.insert(insert_at + 1, encoded_value);
+        difference = uint32_t(encoded_value.size() + 1);
+      } else {
+        const uint32_t value_start =
+            query_start + uint32_t(parameter_start + equal + 1);
+        difference = replace_and_resize(
+            value_start, query_start + uint32_t(parameter_end), encoded_value);
+      }
+      if (components.hash_start != url_components::omitted) {
+        components.hash_start += difference;
+      }
+      ADA_ASSERT_TRUE(validate());
+      return;
+    }
+    if (parameter_end == query.size()) {
+      break;
+    }
+    parameter_start = parameter_end + 1;
+  }
+
+  // There is no parameter named key: we append one.
+  std::string parameter = helpers::concat(encode(key), "=", encoded_value);
+  if (!query.empty() && query.back() != '&') {
+    parameter.insert(parameter.begin(), '&');
+  }
+  buffer.insert(query_end, parameter);
+  if (components.hash_start != url_components::omitted) {
+    components.hash_start += uint32_t(parameter.size());
+  }
+  ADA_ASSERT_TRUE(validate());
+}
+
+void url_aggregator::sort_search_params() {
+  ada_log("url_aggregator::sort_search_params");
+  ADA_ASSERT_TRUE(validate());
+  if (components.search_start == url_components::omitted) {
+    return;
+  }
+  const uint32_t query_start = components.search_start + 1;
+  const uint32_t query_end = components.hash_start == url_components::omitted
+                                 ? uint32_t(buffer.size())
+                                 : components.hash_start;
+  std::string_view query =
+      helpers::substring(buffer, query_start, query_end);
+
+  struct search_param {
+    std::string_view parameter;
+    std::string_view key;
+    // Keys containing '+' or '%' are compared once decoded.
+    bool is_encoded;
+    std::string decoded_key;
+
+    std::string_view sort_key() const noexcept {
+      return is_encoded ? std::string_view(decoded_key) : key;
+    }
+  };
+  std::vector<search_param> params;
+  bool has_empty_parameter = false;
+  size_t parameter_start = 0;
+  while (parameter_start <= query.size()) {
+    size_t parameter_end = query.find('&', parameter_start);
+    if (parameter_end == std::string_view::npos) {
+      parameter_end = query.size();
+    }
+    std::string_view parameter =
+        query.substr(parameter_start, parameter_end - parameter_start);
+    parameter_start = parameter_end + 1;
+    if (parameter.empty()) {
+      has_empty_parameter = true;
+      continue;
+    }
+    std::string_view key = parameter.substr(0, parameter.find('='));
+    bool is_encoded = key.find_first_of("%+") != std::string_view::npos;
+    params.push_back(
+        {parameter, key, is_encoded,
+         is_encoded ? unicode::percent_decode_form_urlencoded(key) : ""});
+  }
+  auto compare = [](const search_param &lhs, const search_param &rhs) {
+    return lhs.sort_key() < rhs.sort_key();
+  };
+  if (!has_empty_parameter &&
+      std::is_sorted(params.begin(), params.end(), compare)) {
+    return;
+  }
+  std::stable_sort(params.begin(), params.end(), compare);
+
+  if (params.empty()) {
+    erase_search_range(query_start, query_end);
+    return;
+  }
+  std::string sorted;
+  sorted.reserve(query.size());
+  for (const search_param &param : params) {
+    if (!sorted.empty()) {
+      sorted += '&';
+    }
+    sorted.append(param.parameter);
+  }
+  uint32_t difference = replace_and_resize(query_start, query_end, sorted);
+  if (components.hash_start != url_components::omitted) {
+    components.hash_start += difference;
+  }
+  ADA_ASSERT_TRUE(validate());
+}
+
+bool url_aggregator::editor::apply() {
+  ada_log("url_aggregator::editor::apply ", url.buffer);
+  ADA_ASSERT_TRUE(url.validate());
+  const std::string &buffer = url.buffer;
+  const url_components &components = url.components;
+  const uint32_t query_end = components.hash_start == url_components::omitted
+                                 ? uint32_t(buffer.size())
+                                 : components.hash_start;
+  const uint32_t path_end = components.search_start == url_components::omitted
+                                ? query_end
+                                : components.search_start;
+
+  // Percent-encoding may triple the size of an input.
+  size_t capacity = buffer.size();
+  for (const auto &value : {protocol, username, password, host, hostname, port,
+                            pathname, search, hash}) {
+    if (value.has_value()) {
+      capacity += 3 * value->size();
+    }
+  }
+
+  // The setters of the components that come before the search run on a copy
+  // that ends with the pathname, so that they only ever move the pathname.
+  url_aggregator out;
+  out.is_valid = url.is_valid;
+  out.has_opaque_path = url.has_opaque_path;
+  out.host_type = url.host_type;
+  out.type = url.type;
+  out.reserve(uint32_t(capacity));
+  out.buffer.append(buffer, 0, path_end);
+  out.components = components;
+  out.components.search_start = url_components::omitted;
+  out.components.hash_start = url_components::omitted;
+
+  if ((protocol.has_value() && !out.set_protocol(*protocol)) ||
+      (username.has_value() && !out.set_username(*username)) ||
+      (password.has_value() && !out.set_password(*password)) ||
+      (host.has_value() && !out.set_host(*host)) ||
+      (hostname.has_value() && !out.set_hostname(*hostname)) ||
+      (port.has_value() && !out.set_port(*port)) ||
+      (pathname.has_value() && !out.set_pathname(*pathname))) {
+    return false;
+  }
+
+  // The search and the hash are appended.
+  if (search.has_value()) {
+    if (!search->empty()) {
+      out.set_search(*search);
+    } else if (components.hash_start == url_components::omitted) {
+      // set_search only strips the trailing spaces of an opaque path when
+      // there is no hash.
+      helpers::strip_trailing_spaces_from_opaque_path(out);
+    }
+  } else if (components.search_start != url_components::omitted) {
+    out.components.search_start = uint32_t(out.buffer.size());
+    out.buffer.append(buffer, components.search_start,
+                      query_end - components.search_start);
+  }
+  if (hash.has_value()) {
+    out.set_hash(*hash);
+  } else if (components.hash_start != url_components::omitted) {
+    out.components.hash_start = uint32_t(out.buffer.size());
+    out.buffer.append(buffer, components.hash_start);
+  }
+
+  url = std::move(out);
+  ADA_ASSERT_TRUE(url.validate());
+  return true;
+}
+
 bool url_aggregator::set_href(const std::string_view input) {
   ADA_ASSERT_TRUE(!helpers::overlaps(input, buffer));
   ada_log("url_aggregator::set_href ", input, " [", input.size(), " bytes]");
@@ -474,6 +728,7 @@ ada_really_inline bool url_aggregator::parse_host(std::string_view input) {
     update_base_hostname(input);
     if (checkers::is_ipv4(get_hostname())) {
       ada_log("parse_host fast path ipv4");
+      ada_stats_count(ada::stats::counter::IPV4_FAST_PATH);
       return parse_ipv4(get_hostname(), true);
     }
     ada_log("parse_host fast path ", get_hostname());
@@ -484,6 +739,7 @@ ada_really_inline bool url_aggregator::parse_host(std::string_view input) {
   // conversion.
 
   ada_log("parse_host calling to_ascii");
+  ada_stats_count(ada::stats::counter::IDNA);
   std::optional<std::string> host = std::string(get_hostname());
   is_valid = ada::unicode::to_ascii(host, input, input.find('%'));
   if (!is_valid) {
@@ -621,29 +877,7 @@ bool url_aggregator::set_hostname(const std::string_view input) {
 
 [[nodiscard]] std::string url_aggregator::get_origin() const noexcept {
   ada_log("url_aggregator::get_origin");
-  if (is_special()) {
-    // Return a new opaque origin.
-    if (type == scheme::FILE) {
-      return "null";
-    }
-
-    return helpers::concat(get_protocol(), "//", get_host());
-  }
-
-  if (get_protocol() == "blob:") {
-    std::string_view path = get_pathname();
-    if (!path.empty()) {
-      auto out = ada::parse<ada::url_aggregator>(path);
-      if (out && (out->type == scheme::HTTP || out->type == scheme::HTTPS)) {
-        // If pathURL's scheme is not "http" and not "https", then return a
-        // new opaque origin.
-        return helpers::concat(out->get_protocol(), "//", out->get_host());
-      }
-    }
-  }
-
-  // Return a new opaque origin.
-  return "null";
+  return ada::origin::from(*this).to_string();
 }
 
 [[nodiscard]] std::string_view url_aggregator::get_username() const noexcept {
@@ -754,6 +988,44 @@ bool url_aggregator::set_hostname(const std::string_view input) {
   return helpers::substring(buffer, 0, components.protocol_end);
 }
 
+[[nodiscard]] url url_aggregator::to_url() const {
+  ada_log("url_aggregator::to_url ", buffer);
+  url out;
+  out.is_valid = is_valid;
+  out.has_opaque_path = has_opaque_path;
+  out.host_type = host_type;
+  out.type = type;
+  if (!is_valid) {
+    return out;
+  }
+  if (!is_special()) {
+    // The buffer starts with the scheme followed by ':'.
+    out.non_special_scheme.assign(buffer, 0, components.protocol_end - 1);
+  }
+  out.username = get_username();
+  out.password = get_password();
+  if (has_hostname()) {
+    out.host.emplace(get_hostname());
+  }
+  if (components.port != url_components::omitted) {
+    out.port = uint16_t(components.port);
+  }
+  out.path = get_pathname();
+  // The getters omit an empty query or fragment: we copy them from the
+  // buffer, without their '?' or '#'.
+  if (components.search_start != url_components::omitted) {
+    const uint32_t search_end = components.hash_start == url_components::omitted
+                                    ? uint32_t(buffer.size())
+                                    : components.hash_start;
+    out.query.emplace(helpers::substring(buffer, components.search_start + 1,
+                                         search_end));
+  }
+  if (components.hash_start != url_components::omitted) {
+    out.hash.emplace(helpers::substring(buffer, components.hash_start + 1));
+  }
+  return out;
+}
+
 [[nodiscard]] std::string ada::url_aggregator::to_string() const {
   ada_log("url_aggregator::to_string buffer:", buffer, " [", buffer.size(),
           " bytes]");
@@ -1632,6 +1904,7 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
       if (new_location == std::string_view::npos) {
         std::string_view path_view = input.substr(previous_location);
         if (path_view == "..") {  // The path ends with ..
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
           // e.g., if you receive ".." with an empty path, you go to "/".
           if (path.empty()) {
             path = '/';
@@ -1652,6 +1925,8 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
         path += '/';
         if (path_view != ".") {
           path.append(path_view);
+        } else {
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         }
         update_base_pathname(path);
         return;
@@ -1661,6 +1936,7 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
             input.substr(previous_location, new_location - previous_location);
         previous_location = new_location + 1;
         if (path_view == "..") {
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
           size_t last_delimiter = path.rfind('/');
           if (last_delimiter != std::string::npos) {
             path.erase(last_delimiter);
@@ -1668,6 +1944,8 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
         } else if (path_view != ".") {
           path += '/';
           path.append(path_view);
+        } else {
+          ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         }
       }
     } while (true);
@@ -1675,6 +1953,9 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
     ada_log("parse_path slow");
     // we have reached the general case
     bool needs_percent_encoding = (accumulator & 1);
+    if (needs_percent_encoding) {
+      ada_stats_count(ada::stats::counter::PATH_PERCENT_ENCODING);
+    }
     std::string path_buffer_tmp;
     do {
       size_t location = (special && (accumulator & 2))
@@ -1694,12 +1975,14 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
               ? path_buffer_tmp
               : path_view;
       if (unicode::is_double_dot_path_segment(path_buffer)) {
+        ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         if ((helpers::shorten_path(path, type) || special) &&
             location == std::string_view::npos) {
           path += '/';
         }
       } else if (unicode::is_single_dot_path_segment(path_buffer) &&
                  (location == std::string_view::npos)) {
+        ada_stats_count(ada::stats::counter::DOT_SEGMENT);
         path += '/';
       }
       // Otherwise, if path_buffer is not a single-dot path segment, then:
@@ -1719,6 +2002,8 @@ inline void url_aggregator::consume_prepared_path(std::string_view input) {
           path += '/';
           path.append(path_buffer);
         }
+      } else {
+        ada_stats_count(ada::stats::counter::DOT_SEGMENT);
       }
       if (location == std::string_view::npos) {
         update_base_pathname(path);
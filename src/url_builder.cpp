@@ -0,0 +1,233 @@
+#include "ada.h"
+#include "ada/character_sets-inl.h"
+#include "ada/checkers-inl.h"
+#include "ada/helpers.h"
+#include "ada/unicode.h"
+#include "ada/url_aggregator-inl.h"
+#include "ada/url_builder-inl.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+namespace ada {
+
+url_builder &url_builder::append_path_segment(std::string_view input) {
+  ada_log("url_builder::append_path_segment ", input);
+  path_segments.reserve(path_segments.size() + input.size() + 1);
+  path_segments += '/';
+  for (const char c : input) {
+    // '%', '/' and '\' are encoded so that the path parser sees a single
+    // segment with the same content.
+    if (character_sets::bit_at(character_sets::PATH_PERCENT_ENCODE,
+                               uint8_t(c)) ||
+        c == '%' || c == '/' || c == '\\') {
+      path_segments.append(character_sets::hex + uint8_t(c) * 4, 3);
+    } else {
+      path_segments += c;
+    }
+  }
+  return *this;
+}
+
+url_builder &url_builder::append_search_param(std::string_view key,
+                                              std::string_view value) {
+  ada_log("url_builder::append_search_param ", key, "=", value);
+  auto append_encoded = [this](std::string_view input) {
+    const size_t start = search_params.size();
+    if (!unicode::percent_encode<true>(
+            input, character_sets::WWW_FORM_URLENCODED_PERCENT_ENCODE,
+            search_params)) {
+      search_params.append(input);
+    }
+    std::replace(search_params.begin() + start, search_params.end(), ' ',
+                 '+');
+  };
+  if (!search_params.empty()) {
+    search_params += '&';
+  }
+  append_encoded(key);
+  search_params += '=';
+  append_encoded(value);
+  return *this;
+}
+
+ada::result<url_aggregator> url_builder::build() const {
+  ada_log("url_builder::build");
+  std::string_view scheme_view = scheme;
+  if (!scheme_view.empty() && scheme_view.back() == ':') {
+    scheme_view.remove_suffix(1);
+  }
+  // Schemes start with an ASCII alpha, followed by ASCII alphanumerics, '+',
+  // '-' or '.'.
+  if (scheme_view.empty() || !checkers::is_alpha(scheme_view[0]) ||
+      !std::all_of(scheme_view.begin(), scheme_view.end(),
+                   unicode::is_alnum_plus)) {
+    return tl::unexpected(errors::generic_error);
+  }
+
+  // Percent-encoding may triple the size of an input. We allow for the same
+  // growth for the host, which may go through IDNA.
+  const std::string_view host_view = host.value_or(std::string_view());
+  size_t capacity = scheme_view.size() + 1 + 2 + 1 + 6 + 2 + 1 + 1 +
+                    path_segments.size() + search_params.size();
+  for (const size_t size :
+       {username.size(), password.size(), host_view.size(), pathname.size(),
+        search.size(), hash.size()}) {
+    capacity += 3 * size;
+  }
+
+  url_aggregator out;
+  out.reserve(uint32_t(capacity));
+  out.buffer.append(scheme_view);
+  unicode::to_lower_ascii(out.buffer.data(), out.buffer.size());
+  out.type = ada::scheme::get_scheme_type(out.buffer);
+  out.buffer += ':';
+  out.components.protocol_end = uint32_t(out.buffer.size());
+  out.components.username_end = out.components.protocol_end;
+  out.components.host_start = out.components.protocol_end;
+  out.components.host_end = out.components.protocol_end;
+  out.components.pathname_start = out.components.protocol_end;
+
+  // Returns input, or its percent-encoding in storage when it is needed.
+  auto encode = [](std::string_view input, const uint8_t *character_set,
+                   std::string &storage) -> std::string_view {
+    size_t index = unicode::percent_encode_index(input, character_set);
+    if (index == input.size()) {
+      return input;
+    }
+    storage = unicode::percent_encode(input, character_set, index);
+    return storage;
+  };
+  std::string storage{};
+
+  const bool has_credentials = !username.empty() || !password.empty();
+  if (host.has_value() || out.is_special()) {
+    if (host_view.empty()) {
+      // A URL cannot have credentials or a port if its host is empty, and
+      // special URLs other than file URLs cannot have an empty host.
+      if ((out.is_special() && out.type != ada::scheme::FILE) ||
+          has_credentials || port != url_components::omitted) {
+        return tl::unexpected(errors::generic_error);
+      }
+      out.update_base_hostname("");
+    } else {
+      if (has_credentials) {
+        if (out.type == ada::scheme::FILE) {
+          return tl::unexpected(errors::generic_error);
+        }
+        out.append_base_username(encode(
+            username, character_sets::USERINFO_PERCENT_ENCODE, storage));
+        out.append_base_password(encode(
+            password, character_sets::USERINFO_PERCENT_ENCODE, storage));
+      }
+      if (!out.parse_host(host_view)) {
+        return tl::unexpected(errors::generic_error);
+      }
+      // If host is "localhost", then set host to the empty string.
+      if (out.type == ada::scheme::FILE && out.get_hostname() == "localhost") {
+        out.update_base_hostname("");
+      }
+    }
+    if (port != url_components::omitted) {
+      if (out.type == ada::scheme::FILE) {
+        return tl::unexpected(errors::generic_error);
+      }
+      if (!out.is_special() || port != out.get_special_port()) {
+        out.update_base_port(port);
+      }
+    }
+  } else if (has_credentials || port != url_components::omitted) {
+    return tl::unexpected(errors::generic_error);
+  }
+
+  // The path segments are appended to the pathname.
+  std::string_view path = pathname;
+  std::string path_storage{};
+  if (!path_segments.empty()) {
+    if (path.empty()) {
+      path = path_segments;
+    } else {
+      path_storage = pathname;
+      if (path_storage.back() == '/') {
+        path_storage.pop_back();
+      }
+      path_storage += path_segments;
+      path = path_storage;
+    }
+  }
+  if (!out.is_special() && !out.has_authority() &&
+      (path.empty() || path[0] != '/')) {
+    // A URL without a host, such as "mailto:user@example.com", has an opaque
+    // path.
+    out.has_opaque_path = true;
+    std::string_view opaque_path =
+        encode(path, character_sets::C0_CONTROL_PERCENT_ENCODE, storage);
+    // A '?' or a '#' would start the query or the fragment.
+    if (opaque_path.find_first_of("?#") != std::string_view::npos) {
+      std::string escaped{};
+      escaped.reserve(opaque_path.size() + 8);
+      for (const char c : opaque_path) {
+        if (c == '?') {
+          escaped += "%3F";
+        } else if (c == '#') {
+          escaped += "%23";
+        } else {
+          escaped += c;
+        }
+      }
+      storage = std::move(escaped);
+      opaque_path = storage;
+    }
+    out.update_base_pathname(opaque_path);
+  } else {
+    out.parse_path(path);
+    // A path starting with "//" cannot follow the scheme directly.
+    if (checkers::begins_with(out.get_pathname(), "//") &&
+        !out.has_authority() && !out.has_dash_dot()) {
+      out.buffer.insert(out.components.pathname_start, "/.");
+      out.components.pathname_start += 2;
+    }
+  }
+
+  // The search parameters are appended to the query.
+  std::string_view query = search;
+  if (!query.empty() && query[0] == '?') {
+    query.remove_prefix(1);
+  }
+  std::string query_storage{};
+  if (!search_params.empty()) {
+    if (query.empty()) {
+      query = search_params;
+    } else {
+      query_storage = query;
+      if (query_storage.back() != '&') {
+        query_storage += '&';
+      }
+      query_storage += search_params;
+      query = query_storage;
+    }
+  }
+  if (!query.empty()) {
+    out.update_base_search(
+        query, out.is_special()
+                   ? ada::character_sets::SPECIAL_QUERY_PERCENT_ENCODE
+                   : ada::character_sets::QUERY_PERCENT_ENCODE);
+  }
+
+  std::string_view fragment = hash;
+  if (!fragment.empty() && fragment[0] == '#') {
+    fragment.remove_prefix(1);
+  }
+  if (!fragment.empty()) {
+    out.update_unencoded_base_hash(fragment);
+  }
+  if (out.has_opaque_path && out.buffer.back() == ' ') {
+    helpers::strip_trailing_spaces_from_opaque_path(out);
+  }
+
+  ADA_ASSERT_TRUE(out.validate());
+  return out;
+}
+
+}  // namespace ada
@@ -0,0 +1,1286 @@
+#include "ada.h"
+#include "ada/url_pattern.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ada::url_pattern_helpers {
+
+enum class modifier : uint8_t { NONE, OPTIONAL, ZERO_OR_MORE, ONE_OR_MORE };
+
+enum class part_type : uint8_t {
+  /** Text matched as is. */
+  FIXED,
+  /** A segment: one or more characters, up to the delimiter. */
+  SEGMENT,
+  /** A wildcard: any characters. */
+  FULL_WILDCARD,
+};
+
+/**
+ * A part of the pattern of a component, as in the URLPattern standard: for
+ * a group, prefix(value)suffix followed by a modifier.
+ *
+ * @see https://urlpattern.spec.whatwg.org/#part
+ */
+struct part {
+  part_type type{part_type::FIXED};
+  modifier mod{modifier::NONE};
+  /** The text of a FIXED part. */
+  std::string value{};
+  std::string prefix{};
+  std::string suffix{};
+  std::string name{};
+  /** The index of the group in url_pattern_result::groups. */
+  uint8_t group{0};
+};
+
+/** Whether the text appears in the input at the given position. */
+ada_really_inline bool matches_at(std::string_view input, size_t position,
+                                  std::string_view text) noexcept {
+  return position <= input.size() && input.size() - position >= text.size() &&
+         std::memcmp(input.data() + position, text.data(), text.size()) == 0;
+}
+
+/**
+ * The steps of the matcher after which it memoizes the states that failed:
+ * from then on, a match takes O(p n^2) steps, with p parts and an input of n
+ * characters.
+ */
+constexpr size_t memo_threshold = 1024;
+/** The memo of the failures is skipped beyond this size, in bits. */
+constexpr size_t max_memo_bits = size_t(1) << 26;
+/** The steps after which the matcher gives up and reports no match. */
+constexpr size_t max_match_steps = size_t(1) << 24;
+
+/**
+ * The matcher of a component: a backtracking matcher following the order of
+ * evaluation of the regular expression the standard would generate, so that
+ * the captured groups are the same.
+ */
+struct component_matcher {
+  std::string pattern{};
+  std::vector<part> parts{};
+  /** The end of a segment: '/' in a pathname, '.' in a hostname. */
+  char delimiter{0};
+  /** The pattern is "*": the matcher always succeeds. */
+  bool matches_everything{false};
+
+  struct state {
+    std::string_view input{};
+    const component_matcher *matcher{nullptr};
+    /** Where the captured groups go, nullptr when they are not needed. */
+    url_pattern_result::group *groups{nullptr};
+    /** The steps taken so far, see max_match_steps. */
+    size_t steps{0};
+    /**
+     * The states known to fail, two bits per part and position: the rest of
+     * the pattern from the part, and the next repetition of its value. Empty
+     * until memo_threshold steps, so that simple matches do not allocate.
+     */
+    std::vector<uint64_t> failures{};
+    /**
+     * Per part, the start from which a wildcard value is known to fail, as
+     * the ends of a wildcard starting later are a subset.
+     */
+    std::vector<size_t> wildcard_failures{};
+  };
+
+  /** The candidate ends of a value, in the order of the regular expression. */
+  struct value_ends {
+    size_t next{0};
+    size_t count{0};
+    bool descending{false};
+  };
+
+  /** A repetition of the value of a group, see match_repetitions. */
+  struct repetition {
+    size_t value_start{0};
+    value_ends ends{};
+    /** Whether the next repetition was tried at the current end. */
+    bool repeated{false};
+  };
+
+  /**
+   * The repetitions being tried: the first ones are kept inline, so that
+   * only a value repeated more than inline_repetitions times allocates.
+   */
+  class repetition_stack {
+   public:
+    [[nodiscard]] size_t size() const noexcept { return count; }
+    repetition &top() noexcept {
+      return count <= inline_repetitions
+                 ? first[count - 1]
+                 : others[count - 1 - inline_repetitions];
+    }
+    void push(const repetition &r) {
+      if (count < inline_repetitions) {
+        first[count] = r;
+      } else {
+        others.push_back(r);
+      }
+      count++;
+    }
+    void pop() noexcept {
+      if (count > inline_repetitions) {
+        others.pop_back();
+      }
+      count--;
+    }
+
+   private:
+    static constexpr size_t inline_repetitions = 16;
+    repetition first[inline_repetitions]{};
+    std::vector<repetition> others{};
+    size_t count{0};
+  };
+
+  [[nodiscard]] bool match(std::string_view input,
+                           url_pattern_result::group *groups) const {
+    if (matches_everything && groups == nullptr) {
+      return true;
+    }
+    state s{input, this, groups};
+    return match_parts(s, 0, 0);
+  }
+
+  static void capture(const state &s, const part &p,
+                      std::optional<std::string_view> value) noexcept {
+    if (s.groups != nullptr) {
+      s.groups[p.group].value = value;
+    }
+  }
+
+  /**
+   * Counts a step, starting to memoize the failures at memo_threshold.
+   * @return false when the matcher is out of steps.
+   */
+  static bool step(state &s) {
+    if (++s.steps == memo_threshold) {
+      const size_t bits =
+          s.matcher->parts.size() * (s.input.size() + 1) * 2;
+      if (bits <= max_memo_bits) {
+        s.failures.resize(bits / 64 + 1);
+        s.wildcard_failures.assign(s.matcher->parts.size(),
+                                   s.input.size() + 1);
+      }
+    }
+    return s.steps <= max_match_steps;
+  }
+
+  static size_t failure_key(const state &s, size_t index, size_t position,
+                            bool repetition) noexcept {
+    return (index * (s.input.size() + 1) + position) * 2 + repetition;
+  }
+
+  static bool has_failed(const state &s, size_t key) noexcept {
+    return !s.failures.empty() && ((s.failures[key / 64] >> (key % 64)) & 1);
+  }
+
+  static void set_failed(state &s, size_t key) noexcept {
+    if (!s.failures.empty()) {
+      s.failures[key / 64] |= uint64_t(1) << (key % 64);
+    }
+  }
+
+  static bool match_parts(state &s, size_t index, size_t position) {
+    const std::vector<part> &parts = s.matcher->parts;
+    if (index == parts.size()) {
+      return position == s.input.size();
+    }
+    const size_t key = failure_key(s, index, position, false);
+    if (!step(s) || has_failed(s, key)) {
+      return false;
+    }
+    if (match_part(s, index, position)) {
+      return true;
+    }
+    set_failed(s, key);
+    return false;
+  }
+
+  static bool match_part(state &s, size_t index, size_t position) {
+    const part &p = s.matcher->parts[index];
+    if (p.type == part_type::FIXED) {
+      return match_fixed(s, index, position);
+    }
+    if (match_group(s, index, position)) {
+      return true;
+    }
+    if (p.mod == modifier::OPTIONAL || p.mod == modifier::ZERO_OR_MORE) {
+      // Without prefix and suffix, ((?:value)*) matches the empty string.
+      const bool empty_match = p.mod == modifier::ZERO_OR_MORE &&
+                               p.prefix.empty() && p.suffix.empty();
+      capture(s, p,
+              empty_match ? std::optional<std::string_view>(
+                                s.input.substr(position, 0))
+                          : std::nullopt);
+      return match_parts(s, index + 1, position);
+    }
+    return false;
+  }
+
+  static bool match_fixed(state &s, size_t index, size_t position) {
+    const part &p = s.matcher->parts[index];
+    const std::string_view text = p.value;
+    if (p.mod == modifier::NONE) {
+      return matches_at(s.input, position, text) &&
+             match_parts(s, index + 1, position + text.size());
+    }
+    if (p.mod == modifier::OPTIONAL) {
+      return (matches_at(s.input, position, text) &&
+              match_parts(s, index + 1, position + text.size())) ||
+             match_parts(s, index + 1, position);
+    }
+    if (text.empty()) {
+      return match_parts(s, index + 1, position);
+    }
+    // (?:text)* and (?:text)+ are greedy: the most repetitions first.
+    size_t count = 0;
+    while (matches_at(s.input, position + count * text.size(), text)) {
+      count++;
+    }
+    const size_t minimum = p.mod == modifier::ONE_OR_MORE ? 1 : 0;
+    for (size_t n = count + 1; n-- > minimum;) {
+      if (match_parts(s, index + 1, position + n * text.size())) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static value_ends get_value_ends(const state &s, const part &p,
+                                   size_t value_start, size_t minimum_end) {
+    const std::string_view input = s.input;
+    if (p.type == part_type::SEGMENT) {
+      // [^delimiter]+? is lazy: the shortest segment first.
+      size_t limit = s.matcher->delimiter == 0
+                         ? input.size()
+                         : input.find(s.matcher->delimiter, value_start);
+      if (limit == std::string_view::npos) {
+        limit = input.size();
+      }
+      const size_t first = std::max(value_start + 1, minimum_end);
+      return {first, limit >= first ? limit - first + 1 : 0, false};
+    }
+    // .* is greedy: the longest value first.
+    return {input.size(),
+            input.size() >= minimum_end ? input.size() - minimum_end + 1 : 0,
+            true};
+  }
+
+  /**
+   * Ends the value of the group, which started at start, at end, then
+   * matches the rest of the pattern.
+   */
+  static bool match_end(state &s, size_t index, size_t start, size_t end) {
+    const part &p = s.matcher->parts[index];
+    if (!matches_at(s.input, end, p.suffix)) {
+      return false;
+    }
+    capture(s, p, s.input.substr(start, end - start));
+    return match_parts(s, index + 1, end + p.suffix.size());
+  }
+
+  static bool match_group(state &s, size_t index, size_t position) {
+    const part &p = s.matcher->parts[index];
+    const std::string_view input = s.input;
+    if (!matches_at(input, position, p.prefix)) {
+      return false;
+    }
+    const size_t start = position + p.prefix.size();
+    if (p.mod == modifier::ZERO_OR_MORE || p.mod == modifier::ONE_OR_MORE) {
+      return match_repetitions(s, index, start);
+    }
+
+    if (index + 1 == s.matcher->parts.size()) {
+      // The last part: the value ends where the suffix ends the input.
+      if (input.size() < start + p.suffix.size()) {
+        return false;
+      }
+      const size_t end = input.size() - p.suffix.size();
+      if (p.type == part_type::SEGMENT) {
+        if (end == start ||
+            (s.matcher->delimiter != 0 &&
+             input.substr(start, end - start).find(s.matcher->delimiter) !=
+                 std::string_view::npos)) {
+          return false;
+        }
+      }
+      return match_end(s, index, start, end);
+    }
+
+    value_ends ends = get_value_ends(s, p, start, start);
+    const bool memoized = ends.descending && !s.wildcard_failures.empty();
+    if (memoized) {
+      // Only the ends before those known to fail are left to try.
+      const size_t failed_from = s.wildcard_failures[index];
+      if (start >= failed_from) {
+        return false;
+      }
+      ends = {failed_from - 1, failed_from - start, true};
+    }
+    for (; ends.count > 0; ends.count--) {
+      const size_t end = ends.descending ? ends.next-- : ends.next++;
+      if (!step(s)) {
+        return false;
+      }
+      if (match_end(s, index, start, end)) {
+        return true;
+      }
+    }
+    if (memoized) {
+      s.wildcard_failures[index] = start;
+    }
+    return false;
+  }
+
+  /**
+   * Matches the value of a group with the modifier '*' or '+', as in
+   * prefix((?:value)(?:suffix prefix(?:value))*)suffix, then the rest of the
+   * pattern. The repetitions are tried depth first, as by recursion, but on
+   * an explicit stack: a long input must not exhaust the call stack.
+   */
+  static bool match_repetitions(state &s, size_t index, size_t start) {
+    const part &p = s.matcher->parts[index];
+    const std::string_view input = s.input;
+    const size_t separator_size = p.suffix.size() + p.prefix.size();
+    repetition_stack stack{};
+    stack.push({start, get_value_ends(s, p, start, start)});
+    while (stack.size() > 0) {
+      if (!step(s)) {
+        return false;
+      }
+      repetition &f = stack.top();
+      if (f.ends.count == 0) {
+        if (stack.size() > 1) {
+          set_failed(s, failure_key(s, index, f.value_start, true));
+        }
+        stack.pop();
+        continue;
+      }
+      const size_t end = f.ends.next;
+      if (!f.repeated) {
+        f.repeated = true;
+        const size_t next_start = end + separator_size;
+        // An iteration of the repetition must not match the empty string.
+        if (end < input.size() && matches_at(input, end, p.suffix) &&
+            matches_at(input, end + p.suffix.size(), p.prefix) &&
+            (separator_size > 0 || end > f.value_start) &&
+            !has_failed(s, failure_key(s, index, next_start, true))) {
+          const size_t minimum_end =
+              separator_size == 0 ? next_start + 1 : next_start;
+          stack.push(
+              {next_start, get_value_ends(s, p, next_start, minimum_end)});
+          continue;
+        }
+      }
+      if (match_end(s, index, start, end)) {
+        return true;
+      }
+      f.ends.next = f.ends.descending ? end - 1 : end + 1;
+      f.ends.count--;
+      f.repeated = false;
+    }
+    return false;
+  }
+};
+
+/**
+ * The tokens of a pattern string.
+ *
+ * @see https://urlpattern.spec.whatwg.org/#tokenizing
+ */
+enum class token_type : uint8_t {
+  OPEN,
+  CLOSE,
+  REGEXP,
+  NAME,
+  CHAR,
+  ESCAPED_CHAR,
+  OTHER_MODIFIER,
+  ASTERISK,
+  END,
+};
+
+struct token {
+  token_type type{token_type::END};
+  std::string_view value{};
+};
+
+constexpr bool is_name_start(char c) noexcept {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+         c == '$' || uint8_t(c) >= 0x80;
+}
+
+constexpr bool is_name_part(char c) noexcept {
+  return is_name_start(c) || (c >= '0' && c <= '9');
+}
+
+/**
+ * Returns the size of the regular expression group starting at the
+ * parenthesis, 0 if it is not terminated.
+ */
+size_t regexp_size(std::string_view input, size_t start) noexcept {
+  size_t depth = 0;
+  for (size_t i = start; i < input.size(); i++) {
+    if (input[i] == '\\') {
+      i++;
+    } else if (input[i] == '(') {
+      depth++;
+    } else if (input[i] == ')' && --depth == 0) {
+      return i + 1 - start;
+    }
+  }
+  return 0;
+}
+
+bool tokenize(std::string_view input, std::vector<token> &tokens) {
+  for (size_t i = 0; i < input.size(); i++) {
+    const char c = input[i];
+    switch (c) {
+      case '*':
+        tokens.push_back({token_type::ASTERISK, input.substr(i, 1)});
+        break;
+      case '+':
+      case '?':
+        tokens.push_back({token_type::OTHER_MODIFIER, input.substr(i, 1)});
+        break;
+      case '\\':
+        if (++i == input.size()) {
+          return false;
+        }
+        tokens.push_back({token_type::ESCAPED_CHAR, input.substr(i, 1)});
+        break;
+      case '{':
+        tokens.push_back({token_type::OPEN, input.substr(i, 1)});
+        break;
+      case '}':
+        tokens.push_back({token_type::CLOSE, input.substr(i, 1)});
+        break;
+      case ':': {
+        size_t end = i + 1;
+        if (end < input.size() && is_name_start(input[end])) {
+          while (end < input.size() && is_name_part(input[end])) {
+            end++;
+          }
+        }
+        if (end == i + 1) {
+          return false;
+        }
+        tokens.push_back({token_type::NAME, input.substr(i + 1, end - i - 1)});
+        i = end - 1;
+        break;
+      }
+      case '(': {
+        size_t size = regexp_size(input, i);
+        if (size <= 2) {
+          return false;
+        }
+        tokens.push_back({token_type::REGEXP, input.substr(i + 1, size - 2)});
+        i += size - 1;
+        break;
+      }
+      default:
+        tokens.push_back({token_type::CHAR, input.substr(i, 1)});
+    }
+  }
+  tokens.push_back({token_type::END, {}});
+  return true;
+}
+
+/**
+ * Parses the pattern string of a component into its parts.
+ *
+ * @see https://urlpattern.spec.whatwg.org/#parse-a-pattern-string
+ */
+struct pattern_parser {
+  std::vector<token> tokens{};
+  size_t index{0};
+  std::string pending_fixed{};
+  /** "/" in a pathname: the character that may prefix a group. */
+  std::string_view segment_prefix{};
+  component_matcher &matcher;
+  size_t next_numeric_name{0};
+
+  explicit pattern_parser(component_matcher &m) : matcher(m) {}
+
+  const token *try_consume(token_type type) noexcept {
+    if (tokens[index].type != type) {
+      return nullptr;
+    }
+    return &tokens[index++];
+  }
+
+  /** After a name, '*' is a modifier, as in ":path*". */
+  const token *try_consume_regexp_or_wildcard(
+      const token *name_token) noexcept {
+    const token *t = try_consume(token_type::REGEXP);
+    if (t == nullptr && name_token == nullptr) {
+      t = try_consume(token_type::ASTERISK);
+    }
+    return t;
+  }
+
+  modifier try_consume_modifier() noexcept {
+    const token *t = try_consume(token_type::OTHER_MODIFIER);
+    if (t == nullptr) {
+      t = try_consume(token_type::ASTERISK);
+    }
+    if (t == nullptr) {
+      return modifier::NONE;
+    }
+    switch (t->value[0]) {
+      case '?':
+        return modifier::OPTIONAL;
+      case '*':
+        return modifier::ZERO_OR_MORE;
+      default:
+        return modifier::ONE_OR_MORE;
+    }
+  }
+
+  std::string consume_text() {
+    std::string text;
+    while (true) {
+      const token *t = try_consume(token_type::CHAR);
+      if (t == nullptr) {
+        t = try_consume(token_type::ESCAPED_CHAR);
+      }
+      if (t == nullptr) {
+        return text;
+      }
+      text.append(t->value);
+    }
+  }
+
+  void flush_pending_fixed() {
+    if (!pending_fixed.empty()) {
+      part p;
+      p.value = std::move(pending_fixed);
+      matcher.parts.push_back(std::move(p));
+      pending_fixed.clear();
+    }
+  }
+
+  bool add_part(std::string prefix, const token *name_token,
+                const token *regexp_or_wildcard, std::string suffix,
+                modifier mod) {
+    if (name_token == nullptr && regexp_or_wildcard == nullptr) {
+      // {text} is fixed text, with a modifier.
+      if (mod == modifier::NONE) {
+        pending_fixed.append(prefix);
+        return true;
+      }
+      flush_pending_fixed();
+      if (!prefix.empty()) {
+        part p;
+        p.value = std::move(prefix);
+        p.mod = mod;
+        matcher.parts.push_back(std::move(p));
+      }
+      return true;
+    }
+    flush_pending_fixed();
+    part p;
+    p.type = part_type::SEGMENT;
+    if (regexp_or_wildcard != nullptr) {
+      const std::string_view regexp = regexp_or_wildcard->value;
+      const std::string segment_wildcard =
+          matcher.delimiter == 0
+              ? "[^]+?"
+              : std::string("[^\\") + matcher.delimiter + "]+?";
+      if (regexp_or_wildcard->type == token_type::ASTERISK ||
+          regexp == ".*") {
+        p.type = part_type::FULL_WILDCARD;
+      } else if (regexp != segment_wildcard) {
+        // Any other regular expression would need a regular expression
+        // engine.
+        return false;
+      }
+    }
+    if (name_token != nullptr) {
+      p.name = std::string(name_token->value);
+    } else {
+      p.name = std::to_string(next_numeric_name++);
+    }
+    for (const part &other : matcher.parts) {
+      if (other.type != part_type::FIXED && other.name == p.name) {
+        return false;
+      }
+    }
+    p.prefix = std::move(prefix);
+    p.suffix = std::move(suffix);
+    p.mod = mod;
+    matcher.parts.push_back(std::move(p));
+    return true;
+  }
+
+  bool parse() {
+    while (tokens[index].type != token_type::END) {
+      const token *char_token = try_consume(token_type::CHAR);
+      const token *name_token = try_consume(token_type::NAME);
+      const token *regexp_or_wildcard =
+          try_consume_regexp_or_wildcard(name_token);
+      if (name_token != nullptr || regexp_or_wildcard != nullptr) {
+        std::string prefix =
+            char_token != nullptr ? std::string(char_token->value) : "";
+        if (prefix != segment_prefix) {
+          pending_fixed.append(prefix);
+          prefix.clear();
+        }
+        flush_pending_fixed();
+        modifier mod = try_consume_modifier();
+        if (!add_part(std::move(prefix), name_token, regexp_or_wildcard, "",
+                      mod)) {
+          return false;
+        }
+        continue;
+      }
+      const token *fixed_token =
+          char_token != nullptr ? char_token
+                                : try_consume(token_type::ESCAPED_CHAR);
+      if (fixed_token != nullptr) {
+        pending_fixed.append(fixed_token->value);
+        continue;
+      }
+      if (try_consume(token_type::OPEN) != nullptr) {
+        std::string prefix = consume_text();
+        name_token = try_consume(token_type::NAME);
+        regexp_or_wildcard = try_consume_regexp_or_wildcard(name_token);
+        std::string suffix = consume_text();
+        if (try_consume(token_type::CLOSE) == nullptr) {
+          return false;
+        }
+        modifier mod = try_consume_modifier();
+        if (!add_part(std::move(prefix), name_token, regexp_or_wildcard,
+                      std::move(suffix), mod)) {
+          return false;
+        }
+        continue;
+      }
+      // A modifier without group, or a '}' without '{'.
+      return false;
+    }
+    flush_pending_fixed();
+    return true;
+  }
+};
+
+/**
+ * Canonicalizes fixed text of a hostname: lowercased, with its non-ASCII
+ * labels converted to punycode. @return false if a label is invalid.
+ */
+bool canonicalize_hostname_text(std::string &text) {
+  std::string result{};
+  std::string_view input = text;
+  while (true) {
+    const size_t dot = input.find('.');
+    const std::string_view label = input.substr(0, dot);
+    if (std::any_of(label.begin(), label.end(),
+                    [](char c) { return uint8_t(c) >= 0x80; })) {
+      const std::string ascii = ada::idna::to_ascii(label);
+      if (ascii.empty()) {
+        return false;
+      }
+      result += ascii;
+    } else {
+      result += label;
+    }
+    if (dot == std::string_view::npos) {
+      break;
+    }
+    result += '.';
+    input.remove_prefix(dot + 1);
+  }
+  unicode::to_lower_ascii(result.data(), result.size());
+  text = std::move(result);
+  return true;
+}
+
+/**
+ * Compiles the pattern of a component. Its fixed text is canonicalized as
+ * the URL parser canonicalizes the component, so that "/café" matches the
+ * pathname "/caf%C3%A9": the protocol is lowercased, the hostname goes
+ * through IDNA, and the other components, but the port, are
+ * percent-encoded. The pathname is opaque when the protocol is fixed and
+ * not special, and the pathname does not start with '/'.
+ */
+bool compile_component(std::string_view pattern, url_pattern_component type,
+                       bool special, component_matcher &matcher) {
+  matcher.pattern = std::string(pattern);
+  matcher.delimiter = type == url_pattern_component::PATHNAME   ? '/'
+                      : type == url_pattern_component::HOSTNAME ? '.'
+                                                                : 0;
+  pattern_parser parser(matcher);
+  if (type == url_pattern_component::PATHNAME) {
+    parser.segment_prefix = "/";
+  }
+  if (!tokenize(pattern, parser.tokens) || !parser.parse()) {
+    return false;
+  }
+  const uint8_t *character_set = nullptr;
+  switch (type) {
+    case url_pattern_component::USERNAME:
+    case url_pattern_component::PASSWORD:
+      character_set = character_sets::USERINFO_PERCENT_ENCODE;
+      break;
+    case url_pattern_component::PATHNAME:
+      character_set = (!special && !pattern.empty() && pattern[0] != '/')
+                          ? character_sets::C0_CONTROL_PERCENT_ENCODE
+                          : character_sets::PATH_PERCENT_ENCODE;
+      break;
+    case url_pattern_component::SEARCH:
+      character_set = special ? character_sets::SPECIAL_QUERY_PERCENT_ENCODE
+                              : character_sets::QUERY_PERCENT_ENCODE;
+      break;
+    case url_pattern_component::HASH:
+      character_set = character_sets::FRAGMENT_PERCENT_ENCODE;
+      break;
+    default:
+      break;
+  }
+  for (part &p : matcher.parts) {
+    for (std::string *text : {&p.value, &p.prefix, &p.suffix}) {
+      if (type == url_pattern_component::PROTOCOL) {
+        unicode::to_lower_ascii(text->data(), text->size());
+      } else if (type == url_pattern_component::HOSTNAME) {
+        if (!canonicalize_hostname_text(*text)) {
+          return false;
+        }
+      } else if (character_set != nullptr) {
+        const size_t index =
+            unicode::percent_encode_index(*text, character_set);
+        if (index != text->size()) {
+          *text = unicode::percent_encode(*text, character_set, index);
+        }
+      }
+    }
+  }
+  matcher.matches_everything =
+      matcher.parts.size() == 1 &&
+      matcher.parts[0].type == part_type::FULL_WILDCARD &&
+      matcher.parts[0].mod == modifier::NONE &&
+      matcher.parts[0].prefix.empty() && matcher.parts[0].suffix.empty();
+  return true;
+}
+
+/** Whether the pattern is made of fixed text only, without modifier. */
+bool is_fixed(const component_matcher &matcher) noexcept {
+  return matcher.parts.empty() ||
+         (matcher.parts.size() == 1 &&
+          matcher.parts[0].type == part_type::FIXED &&
+          matcher.parts[0].mod == modifier::NONE);
+}
+
+std::string_view fixed_text(const component_matcher &matcher) noexcept {
+  return matcher.parts.empty() ? std::string_view()
+                               : std::string_view(matcher.parts[0].value);
+}
+
+/**
+ * Returns the first segment of the pathnames matched by the pattern, as
+ * "users" for "/users/:id", if it is fixed.
+ */
+std::optional<std::string> first_segment(const component_matcher &matcher) {
+  if (matcher.parts.empty() || matcher.parts[0].type != part_type::FIXED ||
+      matcher.parts[0].mod != modifier::NONE) {
+    return std::nullopt;
+  }
+  std::string_view text = matcher.parts[0].value;
+  if (text.empty() || text[0] != '/') {
+    return std::nullopt;
+  }
+  text.remove_prefix(1);
+  size_t slash = text.find('/');
+  if (slash != std::string_view::npos) {
+    return std::string(text.substr(0, slash));
+  }
+  // "/users" alone, or followed by a group starting a new segment.
+  if (matcher.parts.size() == 1 || matcher.parts[1].prefix == "/") {
+    return std::string(text);
+  }
+  return std::nullopt;
+}
+
+/** Returns the first segment of a pathname, if it starts with '/'. */
+std::optional<std::string_view> first_segment(std::string_view pathname) {
+  if (pathname.empty() || pathname[0] != '/') {
+    return std::nullopt;
+  }
+  pathname.remove_prefix(1);
+  return pathname.substr(0, pathname.find('/'));
+}
+
+/**
+ * Returns the component of the URL, as matched by the patterns: without the
+ * ':' of the protocol, the '?' of the search and the '#' of the hash.
+ */
+std::string_view get_component(const ada::url_aggregator &url,
+                               url_pattern_component component) noexcept {
+  std::string_view value;
+  switch (component) {
+    case url_pattern_component::PROTOCOL:
+      value = url.get_protocol();
+      if (!value.empty()) {
+        value.remove_suffix(1);
+      }
+      return value;
+    case url_pattern_component::USERNAME:
+      return url.get_username();
+    case url_pattern_component::PASSWORD:
+      return url.get_password();
+    case url_pattern_component::HOSTNAME:
+      return url.get_hostname();
+    case url_pattern_component::PORT:
+      return url.get_port();
+    case url_pattern_component::PATHNAME:
+      return url.get_pathname();
+    case url_pattern_component::SEARCH:
+      value = url.get_search();
+      if (!value.empty()) {
+        value.remove_prefix(1);
+      }
+      return value;
+    case url_pattern_component::HASH:
+      value = url.get_hash();
+      if (!value.empty()) {
+        value.remove_prefix(1);
+      }
+      return value;
+  }
+  ada::unreachable();
+}
+
+constexpr size_t component_count = 8;
+
+/**
+ * The order in which the components are matched: the most selective and the
+ * cheapest first.
+ */
+constexpr url_pattern_component match_order[component_count] = {
+    url_pattern_component::PROTOCOL, url_pattern_component::HOSTNAME,
+    url_pattern_component::PORT,     url_pattern_component::PATHNAME,
+    url_pattern_component::SEARCH,   url_pattern_component::HASH,
+    url_pattern_component::USERNAME, url_pattern_component::PASSWORD,
+};
+
+/**
+ * The top-level characters of a constructor string: outside of the groups
+ * and of the escapes.
+ */
+struct constructor_scanner {
+  std::string_view input;
+
+  /**
+   * Whether input[i] is a '?' modifying what precedes it, rather than the
+   * start of the search.
+   */
+  [[nodiscard]] bool is_modifier(size_t i) const noexcept {
+    if (i == 0) {
+      return false;
+    }
+    const char previous = input[i - 1];
+    if (previous == '*' || previous == ')' || previous == '}') {
+      return true;
+    }
+    // After a named group, as in ":id?".
+    size_t start = i;
+    while (start > 0 && is_name_part(input[start - 1])) {
+      start--;
+    }
+    return start < i && start > 0 && input[start - 1] == ':' &&
+           is_name_start(input[start]);
+  }
+
+  /**
+   * Returns the first top-level character of the set, from the given index,
+   * or npos.
+   */
+  [[nodiscard]] size_t find(std::string_view characters,
+                            size_t from) const noexcept {
+    size_t depth = 0;
+    for (size_t i = from; i < input.size(); i++) {
+      const char c = input[i];
+      if (c == '\\') {
+        i++;
+      } else if (c == '(') {
+        i += std::max<size_t>(regexp_size(input, i), 1) - 1;
+      } else if (c == '{') {
+        depth++;
+      } else if (c == '}') {
+        depth -= depth > 0;
+      } else if (c == ':' && i + 1 < input.size() &&
+                 is_name_start(input[i + 1]) &&
+                 characters.find(':') != std::string_view::npos) {
+        // A named group, not a separator.
+        i++;
+      } else if (depth == 0 &&
+                 characters.find(c) != std::string_view::npos &&
+                 !(c == '?' && is_modifier(i))) {
+        return i;
+      }
+    }
+    return std::string_view::npos;
+  }
+};
+
+}  // namespace ada::url_pattern_helpers
+
+namespace ada {
+
+std::optional<std::string_view> url_pattern_result::get(
+    url_pattern_component component, std::string_view name) const noexcept {
+  for (size_t i = 0; i < group_count; i++) {
+    if (groups[i].component == component && groups[i].name == name) {
+      return groups[i].value;
+    }
+  }
+  return std::nullopt;
+}
+
+struct url_pattern::compiled {
+  url_pattern_helpers::component_matcher
+      components[url_pattern_helpers::component_count];
+  size_t group_count{0};
+  /** The first segment of the matched pathnames, if fixed. */
+  std::optional<std::string> first_segment{};
+
+  [[nodiscard]] const url_pattern_helpers::component_matcher &operator[](
+      url_pattern_component component) const noexcept {
+    return components[size_t(component)];
+  }
+};
+
+url_pattern::url_pattern(std::unique_ptr<compiled> pattern) noexcept
+    : data(std::move(pattern)) {}
+url_pattern::url_pattern(const url_pattern &other)
+    : data(std::make_unique<compiled>(*other.data)) {}
+url_pattern::url_pattern(url_pattern &&other) noexcept = default;
+url_pattern &url_pattern::operator=(const url_pattern &other) {
+  if (this != &other) {
+    data = std::make_unique<compiled>(*other.data);
+  }
+  return *this;
+}
+url_pattern &url_pattern::operator=(url_pattern &&other) noexcept = default;
+url_pattern::~url_pattern() = default;
+
+bool url_pattern::test(const ada::url_aggregator &url) const {
+  for (url_pattern_component component : url_pattern_helpers::match_order) {
+    const auto &matcher = (*data)[component];
+    if (!matcher.matches_everything &&
+        !matcher.match(url_pattern_helpers::get_component(url, component),
+                       nullptr)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::optional<url_pattern_result> url_pattern::exec(
+    const ada::url_aggregator &url) const {
+  std::optional<url_pattern_result> result(std::in_place);
+  result->group_count = data->group_count;
+  for (size_t i = 0; i < url_pattern_helpers::component_count; i++) {
+    for (const auto &p : data->components[i].parts) {
+      if (p.type != url_pattern_helpers::part_type::FIXED) {
+        result->groups[p.group].component = url_pattern_component(i);
+        result->groups[p.group].name = p.name;
+      }
+    }
+  }
+  for (url_pattern_component component : url_pattern_helpers::match_order) {
+    const auto &matcher = (*data)[component];
+    if (!matcher.match(url_pattern_helpers::get_component(url, component),
+                       result->groups)) {
+      return std::nullopt;
+    }
+  }
+  return result;
+}
+
+std::string_view url_pattern::get_component(
+    url_pattern_component component) const noexcept {
+  return (*data)[component].pattern;
+}
+
+std::optional<std::string_view> url_pattern::get_fixed_hostname()
+    const noexcept {
+  const auto &matcher = (*data)[url_pattern_component::HOSTNAME];
+  if (!url_pattern_helpers::is_fixed(matcher)) {
+    return std::nullopt;
+  }
+  return url_pattern_helpers::fixed_text(matcher);
+}
+
+ada::result<url_pattern> parse_url_pattern(const url_pattern_init &init) {
+  using url_pattern_helpers::component_count;
+  auto pattern = std::make_unique<url_pattern::compiled>();
+  const std::optional<std::string> *inputs[component_count] = {
+      &init.protocol, &init.username, &init.password, &init.hostname,
+      &init.port,     &init.pathname, &init.search,   &init.hash};
+  for (size_t i = 0; i < component_count; i++) {
+    std::string_view input = "*";
+    if (inputs[i]->has_value()) {
+      input = **inputs[i];
+      // As the setters, we accept "https:", "?q" and "#top".
+      if (i == size_t(url_pattern_component::PROTOCOL) &&
+          !input.empty() && input.back() == ':') {
+        input.remove_suffix(1);
+      } else if ((i == size_t(url_pattern_component::SEARCH) &&
+                  !input.empty() && input.front() == '?') ||
+                 (i == size_t(url_pattern_component::HASH) &&
+                  !input.empty() && input.front() == '#')) {
+        input.remove_prefix(1);
+      }
+    }
+    // Unless the protocol is fixed, the other components are canonicalized
+    // as those of a special URL.
+    const auto &protocol = pattern->components[0];
+    const bool special = i == 0 || !url_pattern_helpers::is_fixed(protocol) ||
+                         scheme::is_special(
+                             url_pattern_helpers::fixed_text(protocol));
+    if (!url_pattern_helpers::compile_component(
+            input, url_pattern_component(i), special,
+            pattern->components[i])) {
+      return tl::unexpected(errors::generic_error);
+    }
+  }
+  // The default port of a special scheme is the empty port, as in the URLs.
+  const auto &protocol = pattern->components[0];
+  auto &port = pattern->components[size_t(url_pattern_component::PORT)];
+  if (url_pattern_helpers::is_fixed(protocol) &&
+      scheme::is_special(url_pattern_helpers::fixed_text(protocol)) &&
+      url_pattern_helpers::is_fixed(port) && !port.parts.empty() &&
+      port.parts[0].value ==
+          std::to_string(scheme::get_special_port(
+              url_pattern_helpers::fixed_text(protocol)))) {
+    port.parts.clear();
+  }
+  size_t group_count = 0;
+  for (auto &component : pattern->components) {
+    for (auto &p : component.parts) {
+      if (p.type != url_pattern_helpers::part_type::FIXED) {
+        if (group_count == url_pattern_result::max_groups) {
+          return tl::unexpected(errors::generic_error);
+        }
+        p.group = uint8_t(group_count++);
+      }
+    }
+  }
+  pattern->group_count = group_count;
+  pattern->first_segment = url_pattern_helpers::first_segment(
+      pattern->components[size_t(url_pattern_component::PATHNAME)]);
+  return url_pattern(std::move(pattern));
+}
+
+ada::result<url_pattern> parse_url_pattern(std::string_view input) {
+  url_pattern_helpers::constructor_scanner scanner{input};
+  // The protocol ends with the first top-level "://".
+  size_t protocol_end = 0;
+  while (true) {
+    protocol_end = scanner.find(":", protocol_end);
+    if (protocol_end == std::string_view::npos) {
+      return tl::unexpected(errors::generic_error);
+    }
+    if (input.substr(protocol_end + 1, 2) == "//") {
+      break;
+    }
+    protocol_end++;
+  }
+  url_pattern_init init;
+  init.protocol = std::string(input.substr(0, protocol_end));
+  const size_t authority_start = protocol_end + 3;
+  size_t authority_end = scanner.find("/?#", authority_start);
+  if (authority_end == std::string_view::npos) {
+    authority_end = input.size();
+  }
+  std::string_view authority =
+      input.substr(authority_start, authority_end - authority_start);
+  url_pattern_helpers::constructor_scanner authority_scanner{authority};
+  // The credentials end with the last top-level '@'.
+  size_t at = std::string_view::npos;
+  for (size_t i = authority_scanner.find("@", 0);
+       i != std::string_view::npos; i = authority_scanner.find("@", i + 1)) {
+    at = i;
+  }
+  if (at != std::string_view::npos) {
+    std::string_view credentials = authority.substr(0, at);
+    url_pattern_helpers::constructor_scanner credentials_scanner{credentials};
+    size_t colon = credentials_scanner.find(":", 0);
+    init.username = std::string(credentials.substr(0, colon));
+    if (colon != std::string_view::npos) {
+      init.password = std::string(credentials.substr(colon + 1));
+    }
+    authority = authority.substr(at + 1);
+    authority_scanner.input = authority;
+  }
+  // The port follows the first top-level ':', after an IPv6 address.
+  size_t colon = authority_scanner.find(
+      ":", (!authority.empty() && authority[0] == '[')
+               ? std::min(authority.find(']'), authority.size())
+               : 0);
+  init.hostname = std::string(authority.substr(0, colon));
+  if (colon != std::string_view::npos) {
+    init.port = std::string(authority.substr(colon + 1));
+  }
+
+  size_t position = authority_end;
+  if (position < input.size() && input[position] == '/') {
+    size_t end = scanner.find("?#", position);
+    end = std::min(end, input.size());
+    init.pathname = std::string(input.substr(position, end - position));
+    position = end;
+  }
+  if (position < input.size() && input[position] == '?') {
+    size_t end = std::min(scanner.find("#", position + 1), input.size());
+    init.search = std::string(input.substr(position + 1, end - position - 1));
+    position = end;
+  }
+  if (position < input.size() && input[position] == '#') {
+    init.hash = std::string(input.substr(position + 1));
+  }
+  // The components preceding the last component present are empty.
+  if (init.hash.has_value() && !init.search.has_value()) {
+    init.search = "";
+  }
+  if (!init.pathname.has_value() &&
+      (init.search.has_value() || init.hash.has_value())) {
+    init.pathname = scheme::is_special(*init.protocol) ? "/" : "";
+  }
+  if (!init.port.has_value() && init.pathname.has_value()) {
+    init.port = "";
+  }
+  return parse_url_pattern(init);
+}
+
+struct url_pattern_set::index {
+  std::vector<url_pattern> patterns{};
+
+  /** The patterns with the same hostname, indexed by first segment. */
+  struct bucket {
+    std::unordered_map<std::string_view, std::vector<uint32_t>> by_segment{};
+    std::vector<uint32_t> any_segment{};
+
+    void add(const url_pattern &pattern, uint32_t position) {
+      if (pattern.data->first_segment.has_value()) {
+        by_segment[*pattern.data->first_segment].push_back(position);
+      } else {
+        any_segment.push_back(position);
+      }
+    }
+  };
+
+  std::unordered_map<std::string_view, bucket> by_hostname{};
+  bucket any_hostname{};
+
+  /**
+   * The candidates for a URL: the sorted lists of the positions of the
+   * patterns whose hostname and first segment may match.
+   */
+  struct candidates {
+    const std::vector<uint32_t> *lists[4]{};
+    size_t count{0};
+
+    void add(const bucket &b, std::optional<std::string_view> segment) {
+      if (segment.has_value()) {
+        auto it = b.by_segment.find(*segment);
+        if (it != b.by_segment.end()) {
+          lists[count++] = &it->second;
+        }
+      }
+      if (!b.any_segment.empty()) {
+        lists[count++] = &b.any_segment;
+      }
+    }
+  };
+
+  [[nodiscard]] candidates get_candidates(
+      const ada::url_aggregator &url) const noexcept {
+    candidates result;
+    const std::optional<std::string_view> segment =
+        url_pattern_helpers::first_segment(url.get_pathname());
+    auto it = by_hostname.find(url.get_hostname());
+    if (it != by_hostname.end()) {
+      result.add(it->second, segment);
+    }
+    result.add(any_hostname, segment);
+    return result;
+  }
+
+  /**
+   * Calls the function on the candidates, in the order of insertion, until
+   * it returns true: @return the position of that candidate.
+   */
+  template <typename F>
+  std::optional<size_t> find_first(const ada::url_aggregator &url,
+                                   F f) const {
+    candidates c = get_candidates(url);
+    size_t cursors[4] = {0, 0, 0, 0};
+    while (true) {
+      size_t best = c.count;
+      for (size_t i = 0; i < c.count; i++) {
+        if (cursors[i] < c.lists[i]->size() &&
+            (best == c.count ||
+             (*c.lists[i])[cursors[i]] < (*c.lists[best])[cursors[best]])) {
+          best = i;
+        }
+      }
+      if (best == c.count) {
+        return std::nullopt;
+      }
+      const size_t position = (*c.lists[best])[cursors[best]++];
+      if (f(patterns[position])) {
+        return position;
+      }
+    }
+  }
+};
+
+url_pattern_set::url_pattern_set() : data(std::make_unique<index>()) {}
+url_pattern_set::url_pattern_set(url_pattern_set &&other) noexcept = default;
+url_pattern_set &url_pattern_set::operator=(url_pattern_set &&other) noexcept =
+    default;
+url_pattern_set::~url_pattern_set() = default;
+
+size_t url_pattern_set::add(url_pattern pattern) {
+  const auto position = uint32_t(data->patterns.size());
+  data->patterns.push_back(std::move(pattern));
+  // The keys are views into the compiled pattern, which does not move.
+  const url_pattern &added = data->patterns.back();
+  std::optional<std::string_view> hostname = added.get_fixed_hostname();
+  if (hostname.has_value()) {
+    data->by_hostname[*hostname].add(added, position);
+  } else {
+    data->any_hostname.add(added, position);
+  }
+  return position;
+}
+
+std::optional<size_t> url_pattern_set::match(
+    const ada::url_aggregator &url) const {
+  return data->find_first(
+      url, [&url](const url_pattern &pattern) { return pattern.test(url); });
+}
+
+std::optional<std::pair<size_t, url_pattern_result>> url_pattern_set::exec(
+    const ada::url_aggregator &url) const {
+  std::optional<size_t> position = match(url);
+  if (!position.has_value()) {
+    return std::nullopt;
+  }
+  return std::make_pair(*position, *data->patterns[*position].exec(url));
+}
+
+const url_pattern &url_pattern_set::operator[](size_t position) const noexcept {
+  return data->patterns[position];
+}
+
+size_t url_pattern_set::size() const noexcept { return data->patterns.size(); }
+
+}  // namespace ada
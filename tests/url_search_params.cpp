@@ -257,3 +257,41 @@ TEST(url_search_params, test_character_set) {
   }
   SUCCEED();
 }
+
+TEST(url_search_params, string_constructor_decoding) {
+  auto p = ada::url_search_params("a+b=c+d%2Be&x=%41=%3D&%zz=+%2");
+  ASSERT_EQ(p.size(), 3);
+  ASSERT_EQ(p[0].first, "a b");
+  ASSERT_EQ(p[0].second, "c d+e");
+  ASSERT_EQ(p[1].first, "x");
+  ASSERT_EQ(p[1].second, "A==");
+  ASSERT_EQ(p[2].first, "%zz");
+  ASSERT_EQ(p[2].second, " %2");
+  SUCCEED();
+}
+
+TEST(url_search_params, string_constructor_long_input) {
+  // Long enough for fields and delimiters to straddle 16-byte blocks.
+  std::string input;
+  std::vector<std::pair<std::string, std::string>> expected;
+  for (size_t i = 0; i < 64; i++) {
+    std::string key = "key" + std::to_string(i) + std::string(i % 7, 'k');
+    std::string value = std::string(i % 13, 'v') + "+%2B" + std::to_string(i);
+    if (i % 3 == 0) {
+      value = std::string(i % 17, 'w');
+    }
+    input += key + "=" + value + std::string(1 + i % 3, '&');
+    std::string decoded_value = value;
+    if (i % 3 != 0) {
+      decoded_value = std::string(i % 13, 'v') + " +" + std::to_string(i);
+    }
+    expected.emplace_back(key, decoded_value);
+  }
+  auto p = ada::url_search_params(input);
+  ASSERT_EQ(p.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(p[i].first, expected[i].first);
+    ASSERT_EQ(p[i].second, expected[i].second);
+  }
+  SUCCEED();
+}
@@ -0,0 +1,146 @@
+/**
+ * Decodes the binary traces written by ada::trace::file_sink (ada built with
+ * ADA_LOGGING=1).
+ *
+ * Usage: adatrace [--summary] [--thread N] trace.bin
+ *
+ * By default, the events are printed as text, one line per event. With
+ * --summary, we print the number of events per kind and per state, and the
+ * number of dropped events.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ada.h"
+
+struct summary {
+  size_t events{0};
+  uint64_t first_timestamp{0};
+  uint64_t last_timestamp{0};
+  uint64_t dropped{0};
+  size_t results{0};
+  size_t invalid_results{0};
+  size_t messages{0};
+  std::map<uint32_t, size_t> threads{};
+  std::map<uint8_t, size_t> states{};
+
+  void add(const ada::trace::event& e) {
+    if (events == 0 || e.timestamp < first_timestamp) {
+      first_timestamp = e.timestamp;
+    }
+    if (e.timestamp > last_timestamp) {
+      last_timestamp = e.timestamp;
+    }
+    events++;
+    threads[e.thread]++;
+    switch (e.kind) {
+      case ada::trace::event_kind::STATE:
+        states[e.state]++;
+        break;
+      case ada::trace::event_kind::RESULT:
+        results++;
+        invalid_results += e.state == 0;
+        break;
+      case ada::trace::event_kind::MESSAGE:
+        messages += e.state == 0;
+        break;
+      case ada::trace::event_kind::DROPPED:
+        dropped += e.position;
+        break;
+    }
+  }
+
+  void print(std::ostream& out) const {
+    out << "events: " << events << "\n";
+    out << "duration: " << (last_timestamp - first_timestamp) << " ns\n";
+    out << "dropped events: " << dropped << "\n";
+    out << "parsed urls: " << results << " (" << invalid_results
+        << " invalid)\n";
+    out << "log messages: " << messages << "\n";
+    for (const auto& [thread, count] : threads) {
+      out << "thread " << thread << ": " << count << " events\n";
+    }
+    for (const auto& [state, count] : states) {
+      out << "state "
+          << (state <= uint8_t(ada::state::PORT)
+                  ? ada::to_string(ada::state(state))
+                  : std::to_string(state))
+          << ": " << count << "\n";
+    }
+  }
+};
+
+int main(int argc, char** argv) {
+  bool print_summary = false;
+  std::optional<uint32_t> thread;
+  const char* filename = nullptr;
+  for (int i = 1; i < argc; i++) {
+    std::string_view argument = argv[i];
+    if (argument == "--summary") {
+      print_summary = true;
+    } else if (argument == "--thread" && i + 1 < argc) {
+      thread = uint32_t(std::strtoul(argv[++i], nullptr, 10));
+    } else {
+      filename = argv[i];
+    }
+  }
+  if (filename == nullptr) {
+    std::cerr << "Usage: " << argv[0] << " [--summary] [--thread N] trace.bin"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::FILE* file = std::fopen(filename, "rb");
+  if (file == nullptr) {
+    std::cerr << "Cannot open " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+  uint8_t header[12]{};
+  uint32_t size = 0;
+  if (std::fread(header, 1, sizeof(header), file) == sizeof(header)) {
+    for (size_t i = 0; i < 4; i++) {
+      size |= uint32_t(header[8 + i]) << (8 * i);
+    }
+  }
+  if (std::memcmp(header, ada::trace::file_magic.data(),
+                  ada::trace::file_magic.size()) != 0 ||
+      size != sizeof(ada::trace::event)) {
+    std::cerr << filename << " is not a trace of this version of ada"
+              << std::endl;
+    std::fclose(file);
+    return EXIT_FAILURE;
+  }
+
+  ada::trace::text_sink text(std::cout);
+  summary totals{};
+  std::vector<ada::trace::event> events(4096);
+  size_t count;
+  while ((count = std::fread(events.data(), sizeof(ada::trace::event),
+                             events.size(), file)) > 0) {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (!thread.has_value() || events[i].thread == *thread) {
+        events[kept++] = events[i];
+      }
+    }
+    if (print_summary) {
+      for (size_t i = 0; i < kept; i++) {
+        totals.add(events[i]);
+      }
+    } else {
+      text.write(events.data(), kept);
+    }
+  }
+  std::fclose(file);
+  if (print_summary) {
+    totals.print(std::cout);
+  }
+  text.flush();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+Compares two benchmark result files and fails on significant regressions.
+
+The files are in the JSON format of Google Benchmark, as written by
+--benchmark_out=FILE --benchmark_out_format=json, or by the --json option of
+the benchmarks that do not use Google Benchmark (see benchmarks/json_report.h).
+When the benchmarks ran with --benchmark_repetitions=N, the repetitions are
+compared with Welch's t-test.
+
+The benchmarks share the names of their counters: url/s (throughput),
+cycle/byte and instructions/byte and branch_misses/url (with performance
+counters), allocs/url (heap allocations per URL).
+
+    ./tools/compare_benchmarks.py baseline.json contender.json --metric url/s --threshold 5
+
+The exit code is 1 when a benchmark regresses by more than the threshold (in
+percent) and the difference is significant, 0 otherwise.
+"""
+
+import argparse
+import json
+import math
+import re
+import sys
+from statistics import fmean, variance
+
+
+def load_results(filename: str, metric: str, name_filter: str | None) -> dict[str, list[float]]:
+    with open(filename) as f:
+        document = json.load(f)
+    results: dict[str, list[float]] = {}
+    for benchmark in document.get('benchmarks', []):
+        # Skip the mean, median and stddev entries computed by Google Benchmark.
+        if benchmark.get('run_type', 'iteration') != 'iteration':
+            continue
+        name = benchmark.get('run_name', benchmark['name'])
+        if name_filter is not None and re.search(name_filter, name) is None:
+            continue
+        if metric in benchmark:
+            results.setdefault(name, []).append(float(benchmark[metric]))
+    return results
+
+
+def incomplete_beta_fraction(a: float, b: float, x: float) -> float:
+    # Continued fraction for the regularized incomplete beta function
+    # (Numerical Recipes, betacf).
+    tiny = 1e-300
+    c = 1.0
+    d = 1.0 - (a + b) * x / (a + 1.0)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        for numerator in (
+            m * (b - m) * x / ((a + m2 - 1.0) * (a + m2)),
+            -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0)),
+        ):
+            d = 1.0 + numerator * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + numerator / c
+            c = c if abs(c) > tiny else tiny
+            h *= d * c
+        if abs(d * c - 1.0) < 1e-12:
+            break
+    return h
+
+
+def regularized_incomplete_beta(a: float, b: float, x: float) -> float:
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) + a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * incomplete_beta_fraction(a, b, x) / a
+    return 1.0 - front * incomplete_beta_fraction(b, a, 1.0 - x) / b
+
+
+def welch_p_value(baseline: list[float], contender: list[float]) -> float | None:
+    """Two-sided p-value of Welch's t-test, None without enough repetitions."""
+    if len(baseline) < 2 or len(contender) < 2:
+        return None
+    variance_of_mean = variance(baseline) / len(baseline) + variance(contender) / len(contender)
+    if variance_of_mean == 0.0:
+        return 0.0 if fmean(baseline) != fmean(contender) else 1.0
+    t = (fmean(contender) - fmean(baseline)) / math.sqrt(variance_of_mean)
+    degrees = variance_of_mean**2 / (
+        (variance(baseline) / len(baseline)) ** 2 / (len(baseline) - 1)
+        + (variance(contender) / len(contender)) ** 2 / (len(contender) - 1)
+    )
+    return regularized_incomplete_beta(degrees / 2.0, 0.5, degrees / (degrees + t * t))
+
+
+def higher_is_better(metric: str) -> bool:
+    # Rates (url/s, speed) improve when they grow, times and counts when they shrink.
+    return metric.endswith('/s') or metric == 'speed'
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Compare two benchmark result files (Google Benchmark JSON).')
+    parser.add_argument('baseline', help='results of the reference version')
+    parser.add_argument('contender', help='results of the version under test')
+    parser.add_argument('--metric', default='url/s', help='counter to compare (default: url/s)')
+    parser.add_argument('--threshold', type=float, default=5.0, help='tolerated regression in percent (default: 5)')
+    parser.add_argument('--alpha', type=float, default=0.05, help='significance level (default: 0.05)')
+    parser.add_argument('--filter', default=None, help='only compare the benchmarks matching this regex')
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline, args.metric, args.filter)
+    contender = load_results(args.contender, args.metric, args.filter)
+    common = [name for name in baseline if name in contender]
+    if not common:
+        print(f'No benchmark reports {args.metric} in both files.', file=sys.stderr)
+        return 1
+
+    better_when_higher = higher_is_better(args.metric)
+    regressions = 0
+    width = max(len(name) for name in common)
+    print(f'{"benchmark":<{width}} {"baseline":>14} {"contender":>14} {"change":>9} {"p-value":>9}  verdict')
+    for name in common:
+        before = fmean(baseline[name])
+        after = fmean(contender[name])
+        change = 100.0 * (after - before) / before if before != 0.0 else 0.0
+        loss = -change if better_when_higher else change
+        p_value = welch_p_value(baseline[name], contender[name])
+        significant = p_value is None or p_value < args.alpha
+        if loss > args.threshold and significant:
+            verdict = 'REGRESSION'
+            regressions += 1
+        elif loss < -args.threshold and significant:
+            verdict = 'improvement'
+        else:
+            verdict = ''
+        p_text = '-' if p_value is None else f'{p_value:.4f}'
+        print(f'{name:<{width}} {before:>14.6g} {after:>14.6g} {change:>+8.2f}% {p_text:>9}  {verdict}')
+
+    for name in sorted(set(baseline) ^ set(contender)):
+        print(f'{name}: only in {"baseline" if name in baseline else "contender"}')
+    if any(len(values) < 2 for name in common for values in (baseline[name], contender[name])):
+        print('Some benchmarks have a single repetition: rerun with --benchmark_repetitions for significance tests.')
+    if regressions:
+        print(f'{regressions} benchmark(s) regressed by more than {args.threshold}% on {args.metric}.')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
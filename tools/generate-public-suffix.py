@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+#
+# Compiles the Public Suffix List into src/public_suffix_tables.h.
+#
+# Usage: tools/generate-public-suffix.py [public_suffix_list.dat]
+#
+# Without argument, the list is downloaded from publicsuffix.org. The rules
+# are stored as a trie of labels, read from right to left. The edges of the
+# trie are stored in an open addressing hash table, keyed by the parent node
+# and the label of the child, so that most labels are found in one probe.
+# Unicode
+# labels are stored in their ASCII (punycode) form, as they appear in the
+# canonical hosts.
+#
+
+import hashlib
+import os
+import sys
+import urllib.request
+
+LIST_URL = 'https://publicsuffix.org/list/public_suffix_list.dat'
+SCRIPTPATH = os.path.dirname(os.path.abspath(sys.argv[0]))
+PROJECTPATH = os.path.dirname(SCRIPTPATH)
+OUTPUT = os.path.join(PROJECTPATH, 'src', 'public_suffix_tables.h')
+
+# The flags of a node, see ada::public_suffix::details::node.
+RULE = 1
+EXCEPTION = 2
+WILDCARD = 4
+PRIVATE_RULE = 8
+PRIVATE_WILDCARD = 16
+
+
+NODE_DECLARATION = '''enum node_flags : uint8_t {
+  /** A rule ends at this node, e.g., "co.uk". */
+  RULE = %d,
+  /** An exception rule ends at this node, e.g., "!www.ck". */
+  EXCEPTION = %d,
+  /** A wildcard rule applies to the children of this node, e.g., "*.ck". */
+  WILDCARD = %d,
+  /** The rule (or the exception) of this node is a private domain. */
+  PRIVATE_RULE = %d,
+  /** The wildcard rule of this node is a private domain. */
+  PRIVATE_WILDCARD = %d,
+};
+
+/**
+ * A label of the trie, the labels being read from right to left. The root is
+ * the first node.
+ */
+struct node {
+  uint32_t label_offset;
+  uint16_t parent;
+  uint8_t label_length;
+  uint8_t flags;
+};
+
+/**
+ * The hash of an edge of the trie: must match edge_hash in
+ * tools/generate-public-suffix.py.
+ */
+constexpr uint32_t edge_hash(uint32_t parent, const char *label,
+                             size_t length) noexcept {
+  uint32_t h = 2166136261u ^ (parent * 2654435761u);
+  for (size_t i = 0; i < length; i++) {
+    h = (h ^ uint8_t(label[i])) * 16777619u;
+  }
+  return h ^ (h >> 15);
+}
+
+''' % (RULE, EXCEPTION, WILDCARD, PRIVATE_RULE, PRIVATE_WILDCARD)
+
+# The size of the hash table of the edges, a power of two: at least twice the
+# number of nodes, so that the searches for missing labels stay short.
+TABLE_BITS = 15
+
+
+def edge_hash(parent, label):
+    h = (2166136261 ^ (parent * 2654435761)) & 0xFFFFFFFF
+    for c in label.encode('ascii'):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h ^ (h >> 15)
+
+
+class Node:
+    def __init__(self, label):
+        self.label = label
+        self.flags = 0
+        self.children = {}
+
+
+def to_ascii(label):
+    if label.isascii():
+        return label.lower()
+    return 'xn--' + label.lower().encode('punycode').decode('ascii')
+
+
+def read_list(source):
+    if source is None:
+        with urllib.request.urlopen(LIST_URL) as response:
+            return response.read()
+    with open(source, 'rb') as f:
+        return f.read()
+
+
+def build_trie(content):
+    root = Node('')
+    private = False
+    rules = 0
+    for line in content.decode('utf-8').splitlines():
+        line = line.strip()
+        if line.startswith('// ===BEGIN PRIVATE DOMAINS==='):
+            private = True
+        if not line or line.startswith('//'):
+            continue
+        rule = line.split()[0]
+        exception = rule.startswith('!')
+        labels = rule.lstrip('!').split('.')
+        wildcard = labels[0] == '*'
+        if wildcard:
+            labels = labels[1:]
+        node = root
+        for label in reversed(labels):
+            if label == '*':
+                raise ValueError('unsupported rule: ' + rule)
+            label = to_ascii(label)
+            node = node.children.setdefault(label, Node(label))
+        if exception:
+            node.flags |= EXCEPTION | (PRIVATE_RULE if private else 0)
+        elif wildcard:
+            node.flags |= WILDCARD | (PRIVATE_WILDCARD if private else 0)
+        else:
+            node.flags |= RULE | (PRIVATE_RULE if private else 0)
+        rules += 1
+    return root, rules
+
+
+def flatten(root):
+    # Breadth-first, the children in alphabetical order.
+    nodes = [root]
+    parent = {id(root): 0}
+    index = 0
+    while index < len(nodes):
+        for child in sorted(nodes[index].children.values(),
+                            key=lambda n: n.label):
+            parent[id(child)] = index
+            nodes.append(child)
+        index += 1
+    return nodes, parent
+
+
+def build_edge_table(nodes, parent):
+    # Linear probing; 0 (the root, never a child) marks the empty slots.
+    mask = (1 << TABLE_BITS) - 1
+    table = [0] * (1 << TABLE_BITS)
+    for index, node in enumerate(nodes[1:], start=1):
+        slot = edge_hash(parent[id(node)], node.label) & mask
+        while table[slot] != 0:
+            slot = (slot + 1) & mask
+        table[slot] = index
+    return table
+
+
+def build_label_data(nodes):
+    # Longest labels first, so that shorter labels are often found inside.
+    data = ''
+    offsets = {}
+    for label in sorted({n.label for n in nodes}, key=lambda s: (-len(s), s)):
+        position = data.find(label)
+        if position < 0:
+            position = len(data)
+            data += label
+        offsets[label] = position
+    return data, offsets
+
+
+def main():
+    source = sys.argv[1] if len(sys.argv) > 1 else None
+    content = read_list(source)
+    root, rules = build_trie(content)
+    nodes, parent = flatten(root)
+    data, offsets = build_label_data(nodes)
+    if 2 * len(nodes) > 1 << TABLE_BITS or len(data) >= 1 << 32:
+        raise ValueError('the table does not fit in the node format')
+    if any(len(node.label) > 255 for node in nodes):
+        raise ValueError('the table does not fit in the node format')
+    table = build_edge_table(nodes, parent)
+
+    with open(OUTPUT, 'w') as out:
+        out.write('// Generated by tools/generate-public-suffix.py from the\n')
+        out.write('// Public Suffix List (https://publicsuffix.org/).\n')
+        out.write('// Do not edit!\n')
+        out.write('// sha256 of the list: %s\n'
+                  % hashlib.sha256(content).hexdigest())
+        out.write('// %d rules, %d nodes, %d bytes of labels.\n'
+                  % (rules, len(nodes), len(data)))
+        out.write('// clang-format off\n')
+        out.write('#ifndef ADA_PUBLIC_SUFFIX_TABLES_H\n')
+        out.write('#define ADA_PUBLIC_SUFFIX_TABLES_H\n')
+        out.write('#include <cstddef>\n#include <cstdint>\n\n')
+        out.write('namespace ada::public_suffix::details {\n\n')
+        out.write(NODE_DECLARATION)
+        out.write('constexpr char label_data[%d] = {\n' % len(data))
+        for i in range(0, len(data), 20):
+            chunk = data[i:i + 20]
+            out.write('\t' + ', '.join(str(ord(c)) for c in chunk) + ',\n')
+        out.write('};\n\n')
+        out.write('constexpr node nodes[%d] = {\n' % len(nodes))
+        for node in nodes:
+            out.write('\t{%d, %d, %d, %d},\n' % (
+                offsets[node.label], parent[id(node)], len(node.label),
+                node.flags))
+        out.write('};\n\n')
+        out.write('constexpr size_t edge_table_mask = %d;\n\n'
+                  % ((1 << TABLE_BITS) - 1))
+        out.write('constexpr uint16_t edge_table[%d] = {\n' % len(table))
+        for i in range(0, len(table), 16):
+            out.write('\t' + ', '.join(str(v) for v in table[i:i + 16])
+                      + ',\n')
+        out.write('};\n\n')
+        out.write('}  // namespace ada::public_suffix::details\n')
+        out.write('#endif  // ADA_PUBLIC_SUFFIX_TABLES_H\n')
+    print('wrote %s: %d rules, %d nodes, %d bytes of labels'
+          % (OUTPUT, rules, len(nodes), len(data)))
+
+
+if __name__ == '__main__':
+    main()